@@ -25,7 +25,7 @@ import (
 
 // An imported function to ensure that the broker supports this ABI version.
 //
-//go:wasmimport redpanda_transform check_abi_version_2
+//go:wasmimport redpanda_transform check_abi_version_3
 func checkAbiVersion()
 
 // readRecordHeader reads all the data from the batch header into memory.
@@ -47,10 +47,18 @@ func readBatchHeader(
 	baseSequence unsafe.Pointer,
 ) int32
 
-// readRecord reads the next record in the current batch.
+// readRecords reads as many of the remaining records of the current batch as
+// fit into `buf`.
+//
+// Each record is written as its metadata followed by its serialized
+// "payload":
+//
+// attributes: int8
+// timestamp: varint
+// offset: varint
+// payloadLength: varint
+// payload: byte[]
 //
-// In addition to the record metadata, into `buf` the serialized the "payload"
-// of a record will be written.
 // The payload is the key, value and headers as specified by kafka's serialized
 // wire protocol. In particular, the following fields should be as included:
 //
@@ -60,48 +68,32 @@ func readBatchHeader(
 // value: byte[]
 // Headers => [Header]
 //
+// A buffer of the maximum record size for the batch plus maxRecordOverhead
+// holds any record of the batch.
+//
 // Returns the amount that was written into `buf` on success, otherwise
 // returns a negative number to indicate an error.
 //
-//go:wasmimport redpanda_transform read_next_record
-func readNextRecord(
-	attributes unsafe.Pointer,
-	timestamp unsafe.Pointer,
-	offset unsafe.Pointer,
-	buf unsafe.Pointer,
-	len int32,
-) int32
+//go:wasmimport redpanda_transform read_records
+func readRecords(buf unsafe.Pointer, len int32) int32
 
-// writeRecord writes a new record by copying the data pointed to.
+// writeRecords writes a series of new records by copying the data pointed to.
 //
-// The `buf` here is expected to be the serialized the "payload" of a record
-// as specified by kafka's serialized wire protocol. In particular, the following
-// fields should be as included:
+// Each record is written as:
 //
-// keyLength: varint
-// key: byte[]
-// valueLen: varint
-// value: byte[]
-// Headers => [Header]
-//
-// The record metdata such as the total length, attributes, timestamp and offset
-// should be omitted - the broker will handle adding that information as required.
-//
-// See: https://kafka.apache.org/documentation/#record for more information.
-//
-// Returns a negative number to indicate an error.
+// optionsLength: varint
+// options: byte[]
+// payloadLength: varint
+// payload: byte[]
 //
-//go:wasmimport redpanda_transform write_record
-func writeRecord(data unsafe.Pointer, length int32) int32
-
-// writeRecordWithOptions writes a new record by copying the data buffer.
-//
-// The data buffer here is the same format as `writeRecord`, but additionally it is
-// possible to pass options for the write.
+// The payload is the serialized "payload" of a record as specified by kafka's
+// serialized wire protocol, as described in `readRecords`. The record metadata
+// such as the total length, attributes, timestamp and offset should be
+// omitted - the broker will handle adding that information as required.
 //
-// At the time of writing the options that are supported are only setting a different
-// output topic. The format for this options object is a series of keys with key specific
-// data.
+// The options are empty to write to the default output topic. At the time of
+// writing the only supported option is setting a different output topic. The
+// format for this options object is a series of keys with key specific data.
 //
 // Supported Options:
 //
@@ -110,10 +102,8 @@ func writeRecord(data unsafe.Pointer, length int32) int32
 //     topicNameLength: varint
 //     topicName: byte[]
 //
-//go:wasmimport redpanda_transform write_record_with_options
-func writeRecordWithOptions(
-	data unsafe.Pointer,
-	dataLength int32,
-	opts unsafe.Pointer,
-	optsLength int32,
-) int32
+// Returns the amount of records written on success, otherwise returns a
+// negative number to indicate an error.
+//
+//go:wasmimport redpanda_transform write_records
+func writeRecords(buf unsafe.Pointer, len int32) int32
@@ -15,6 +15,7 @@
 package transform
 
 import (
+	"encoding/binary"
 	"errors"
 	"strconv"
 	"time"
@@ -44,52 +45,61 @@ func (e *writeEvent) Record() Record {
 	return e.record
 }
 
+// The size of the metadata of a record read with readRecords is at most
+// an attributes byte and three varints.
+const maxRecordOverhead = 1 + 3*binary.MaxVarintLen64
+
+// The records of a batch are read in one go up to this size.
+const maxReadBufferSize = 256 * 1024
+
+// recordWriter buffers the records written while transforming the records of
+// a read, they are written to the broker all at once by flush.
 type recordWriter struct {
 	outbuf *rwbuf.RWBuf
 	optbuf *rwbuf.RWBuf
+	recbuf *rwbuf.RWBuf
 }
 
 func (w *recordWriter) Write(r Record, opts ...WriteOpt) error {
-	// Serialize the record
-	w.outbuf.Reset()
-	r.serializePayload(w.outbuf)
-	b := w.outbuf.ReadAll()
-
 	// Apply write options
 	wo := writeOpts{}
 	for _, opt := range opts {
 		opt.apply(&wo)
 	}
 
-	// Do the write
-	var amt int32
-	if wo.topic == "" {
-		// Directly write the record to the default output topic.
-		amt = writeRecord(unsafe.Pointer(&b[0]), int32(len(b)))
-	} else {
-		// Serialize the options
-		w.optbuf.Reset()
+	// Serialize the options, none for the default output topic
+	w.optbuf.Reset()
+	if wo.topic != "" {
 		wo.serialize(w.optbuf)
-		o := w.optbuf.ReadAll()
-		amt = writeRecordWithOptions(
-			unsafe.Pointer(&b[0]),
-			int32(len(b)),
-			unsafe.Pointer(&o[0]),
-			int32(len(o)),
-		)
-	}
-	if int(amt) != len(b) {
-		return errors.New("writing record failed with errno: " + strconv.Itoa(int(amt)))
 	}
+	w.outbuf.WriteBytesWithSize(w.optbuf.ReadAll())
+
+	// Serialize the record
+	w.recbuf.Reset()
+	r.serializePayload(w.recbuf)
+	w.outbuf.WriteBytesWithSize(w.recbuf.ReadAll())
 	return nil
 }
 
+// flush writes the buffered records to the broker.
+func (w *recordWriter) flush() {
+	b := w.outbuf.ReadAll()
+	w.outbuf.Reset()
+	if len(b) == 0 {
+		return
+	}
+	amt := writeRecords(unsafe.Pointer(&b[0]), int32(len(b)))
+	if amt < 0 {
+		panic("writing records failed with errno: " + strconv.Itoa(int(amt)))
+	}
+}
+
 // Cache a bunch of objects to not GC
 var (
 	currentHeader batchHeader  = batchHeader{}
 	inbuf         *rwbuf.RWBuf = rwbuf.New(128)
 	e             writeEvent
-	w             recordWriter = recordWriter{rwbuf.New(128), rwbuf.New(32)}
+	w             recordWriter = recordWriter{rwbuf.New(128), rwbuf.New(32), rwbuf.New(128)}
 )
 
 // run our transformation loop
@@ -105,7 +115,7 @@ func process(userTransformFunction OnRecordWrittenCallback) {
 
 // process and transform a single batch
 func processBatch(userTransformFunction OnRecordWrittenCallback) {
-	bufSize := int(readBatchHeader(
+	maxRecordSize := int(readBatchHeader(
 		unsafe.Pointer(&currentHeader.baseOffset),
 		unsafe.Pointer(&currentHeader.recordCount),
 		unsafe.Pointer(&currentHeader.partitionLeaderEpoch),
@@ -117,32 +127,72 @@ func processBatch(userTransformFunction OnRecordWrittenCallback) {
 		unsafe.Pointer(&currentHeader.producerEpoch),
 		unsafe.Pointer(&currentHeader.baseSequence),
 	))
-	if bufSize < 0 {
-		panic("failed to read batch header errno: " + strconv.Itoa(bufSize))
+	if maxRecordSize < 0 {
+		panic("failed to read batch header errno: " + strconv.Itoa(maxRecordSize))
 	}
 
-	for i := 0; i < int(currentHeader.recordCount); i++ {
+	// Size the buffer to read all the records at once, unless they add up to
+	// more than maxReadBufferSize, in which case they are read in a few goes.
+	bufSize := currentHeader.recordCount * (maxRecordSize + maxRecordOverhead)
+	if bufSize > maxReadBufferSize {
+		bufSize = maxReadBufferSize
+	}
+	if bufSize < maxRecordSize+maxRecordOverhead {
+		bufSize = maxRecordSize + maxRecordOverhead
+	}
+	inbuf.EnsureSize(bufSize)
+
+	for read := 0; read < currentHeader.recordCount; {
 		inbuf.Reset()
-		inbuf.EnsureSize(bufSize)
-		var timestamp int64
-		amt := int(readNextRecord(
-			unsafe.Pointer(&e.record.Attrs.attr),
-			unsafe.Pointer(&timestamp),
-			unsafe.Pointer(&e.record.Offset),
+		amt := int(readRecords(
 			unsafe.Pointer(inbuf.WriterBufPtr()),
-			int32(bufSize)),
+			int32(inbuf.WriterLen())),
 		)
-		// Assign the timestamp value to the record
-		e.record.Timestamp = time.UnixMilli(timestamp)
-		inbuf.AdvanceWriter(amt)
 		if amt < 0 {
-			panic("reading record failed with errno: " + strconv.Itoa(amt) + " buffer size: " + strconv.Itoa(bufSize))
+			panic("reading records failed with errno: " + strconv.Itoa(amt) + " buffer size: " + strconv.Itoa(inbuf.WriterLen()))
 		}
-		if err := e.record.deserializePayload(inbuf); err != nil {
-			panic("deserializing record failed: " + err.Error())
-		}
-		if err := userTransformFunction(&e, &w); err != nil {
-			panic("transforming record failed: " + err.Error())
+		inbuf.AdvanceWriter(amt)
+		for inbuf.ReaderLen() > 0 {
+			if err := readRecord(inbuf, &e.record); err != nil {
+				panic("deserializing record failed: " + err.Error())
+			}
+			if err := userTransformFunction(&e, &w); err != nil {
+				panic("transforming record failed: " + err.Error())
+			}
+			read++
 		}
+		w.flush()
 	}
 }
+
+// readRecord reads the metadata and the payload of a record as written by
+// readRecords.
+func readRecord(b *rwbuf.RWBuf, r *Record) error {
+	attr, err := b.ReadByte()
+	if err != nil {
+		return err
+	}
+	timestamp, err := binary.ReadVarint(b)
+	if err != nil {
+		return err
+	}
+	offset, err := binary.ReadVarint(b)
+	if err != nil {
+		return err
+	}
+	payloadLen, err := binary.ReadVarint(b)
+	if err != nil {
+		return err
+	}
+	remaining := b.ReaderLen()
+	if err := r.deserializePayload(b); err != nil {
+		return err
+	}
+	if remaining-b.ReaderLen() != int(payloadLen) {
+		return errors.New("record payload size mismatch")
+	}
+	r.Attrs.attr = attr
+	r.Timestamp = time.UnixMilli(timestamp)
+	r.Offset = offset
+	return nil
+}
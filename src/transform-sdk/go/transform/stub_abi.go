@@ -43,20 +43,10 @@ func readBatchHeader(
 	panic("stub")
 }
 
-func readNextRecord(
-	attributes unsafe.Pointer,
-	timestampDelta unsafe.Pointer,
-	offsetDelta unsafe.Pointer,
-	buf unsafe.Pointer,
-	len int32,
-) int32 {
-	panic("stub")
-}
-
-func writeRecord(buf unsafe.Pointer, len int32) int32 {
+func readRecords(buf unsafe.Pointer, len int32) int32 {
 	panic("stub")
 }
 
-func writeRecordWithOptions(data unsafe.Pointer, dataLength int32, opts unsafe.Pointer, optsLength int32) int32 {
+func writeRecords(buf unsafe.Pointer, len int32) int32 {
 	panic("stub")
 }
@@ -14,7 +14,7 @@
 
 #[link(wasm_import_module = "redpanda_transform")]
 extern "C" {
-    #[link_name = "check_abi_version_1"]
+    #[link_name = "check_abi_version_3"]
     pub(crate) fn check_abi();
 
     #[link_name = "read_batch_header"]
@@ -31,15 +31,9 @@ extern "C" {
         base_sequence: *mut i32,
     ) -> i32;
 
-    #[link_name = "read_next_record"]
-    pub(crate) fn read_next_record(
-        attributes: *mut u8,
-        timestamp: *mut i64,
-        offset: *mut i64,
-        buf: *mut u8,
-        len: u32,
-    ) -> i32;
+    #[link_name = "read_records"]
+    pub(crate) fn read_records(buf: *mut u8, len: u32) -> i32;
 
-    #[link_name = "write_record"]
-    pub(crate) fn write_record(buf: *const u8, len: u32) -> i32;
+    #[link_name = "write_records"]
+    pub(crate) fn write_records(buf: *const u8, len: u32) -> i32;
 }
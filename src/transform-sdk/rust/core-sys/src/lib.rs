@@ -42,6 +42,13 @@ extern crate quickcheck;
 #[cfg(test)]
 extern crate rand;
 
+/// The size of the metadata of a record read with `read_records` is at most an
+/// attributes byte and three varints.
+const MAX_RECORD_OVERHEAD: usize = 1 + 3 * 10;
+
+/// The records of a batch are read in one go up to this size.
+const MAX_READ_BUFFER_SIZE: usize = 256 * 1024;
+
 pub fn process<E, F>(cb: F) -> !
 where
     E: Debug,
@@ -52,9 +59,8 @@ where
     }
     let mut input_buffer: Vec<u8> = vec![];
     let mut sink = AbiRecordWriter::new();
-    let mut writer = RecordWriter::new(&mut sink);
     loop {
-        process_batch(&mut input_buffer, &mut writer, &cb);
+        process_batch(&mut input_buffer, &mut sink, &cb);
     }
 }
 
@@ -71,34 +77,48 @@ struct BatchHeader {
     pub base_sequence: i32,
 }
 
+/// Buffers the records written while transforming the records of a read, they
+/// are written to the broker all at once by `flush`.
 struct AbiRecordWriter {
     pub output_buffer: Vec<u8>,
+    pub record_buffer: Vec<u8>,
 }
 
 impl AbiRecordWriter {
     fn new() -> Self {
         Self {
             output_buffer: Vec::new(),
+            record_buffer: Vec::new(),
+        }
+    }
+
+    fn flush(&mut self) {
+        if self.output_buffer.is_empty() {
+            return;
         }
+        let errno_or_amt = unsafe {
+            abi::write_records(self.output_buffer.as_ptr(), self.output_buffer.len() as u32)
+        };
+        assert!(
+            errno_or_amt >= 0,
+            "writing records failed (errno: {errno_or_amt})"
+        );
+        self.output_buffer.clear();
     }
 }
 
 impl RecordSink for AbiRecordWriter {
     fn write(&mut self, r: BorrowedRecord) -> Result<(), WriteError> {
-        self.output_buffer.clear();
-        serde::write_record_payload(r, &mut self.output_buffer);
-        let errno_or_amt = unsafe {
-            abi::write_record(self.output_buffer.as_ptr(), self.output_buffer.len() as u32)
-        };
-        if errno_or_amt == self.output_buffer.len() as i32 {
-            Ok(())
-        } else {
-            Err(WriteError::Unknown(errno_or_amt))
-        }
+        // No options, the record goes to the default output topic.
+        varint::write(&mut self.output_buffer, 0);
+        self.record_buffer.clear();
+        serde::write_record_payload(r, &mut self.record_buffer);
+        varint::write_sized_buffer(&mut self.output_buffer, Some(&self.record_buffer));
+        Ok(())
     }
 }
 
-fn process_batch<E, F>(input_buffer: &mut Vec<u8>, writer: &mut RecordWriter, cb: &F)
+fn process_batch<E, F>(input_buffer: &mut Vec<u8>, sink: &mut AbiRecordWriter, cb: &F)
 where
     E: Debug,
     F: Fn(WriteEvent, &mut RecordWriter) -> Result<(), E>,
@@ -115,7 +135,7 @@ where
         producer_epoch: 0,
         base_sequence: 0,
     };
-    let errno_or_buf_size = unsafe {
+    let errno_or_max_record_size = unsafe {
         abi::read_batch_header(
             &mut header.base_offset,
             &mut header.record_count,
@@ -130,38 +150,41 @@ where
         )
     };
     assert!(
-        errno_or_buf_size >= 0,
-        "failed to read batch header (errno: {errno_or_buf_size})"
+        errno_or_max_record_size >= 0,
+        "failed to read batch header (errno: {errno_or_max_record_size})"
     );
-    let buf_size = errno_or_buf_size as usize;
+    // Size the buffer to read all the records at once, unless they add up to
+    // more than MAX_READ_BUFFER_SIZE, in which case they are read in a few goes.
+    let max_record_size = errno_or_max_record_size as usize + MAX_RECORD_OVERHEAD;
+    let buf_size = (header.record_count as usize * max_record_size)
+        .min(MAX_READ_BUFFER_SIZE)
+        .max(max_record_size);
     input_buffer.resize(buf_size, 0);
-    for _ in 0..header.record_count {
-        let mut attr: u8 = 0;
-        let mut timestamp: i64 = 0;
-        let mut offset: i64 = 0;
-        let errno_or_amt = unsafe {
-            abi::read_next_record(
-                &mut attr,
-                &mut timestamp,
-                &mut offset,
-                input_buffer.as_mut_ptr(),
-                input_buffer.len() as u32,
-            )
-        };
+    let mut read = 0;
+    while read < header.record_count {
+        let errno_or_amt =
+            unsafe { abi::read_records(input_buffer.as_mut_ptr(), input_buffer.len() as u32) };
         assert!(
             errno_or_amt >= 0,
-            "reading record failed (errno: {errno_or_amt}, buffer_size: {buf_size})"
+            "reading records failed (errno: {errno_or_amt}, buffer_size: {buf_size})"
         );
-        let amt = errno_or_amt as usize;
-        let ts = SystemTime::UNIX_EPOCH + Duration::from_millis(timestamp as u64);
-        let record = serde::read_record_from_payload(&input_buffer[0..amt])
-            .expect("deserializing record failed");
-        cb(
-            WriteEvent {
-                record: WrittenRecord::from_record(record, ts),
-            },
-            writer,
-        )
-        .expect("transforming record failed");
+        let mut buf = &input_buffer[0..errno_or_amt as usize];
+        let mut writer = RecordWriter::new(sink);
+        while !buf.is_empty() {
+            let decoded =
+                serde::read_record_with_metadata(buf).expect("deserializing record failed");
+            buf = &buf[decoded.read..];
+            let (timestamp, record) = decoded.value;
+            let ts = SystemTime::UNIX_EPOCH + Duration::from_millis(timestamp as u64);
+            cb(
+                WriteEvent {
+                    record: WrittenRecord::from_record(record, ts),
+                },
+                &mut writer,
+            )
+            .expect("transforming record failed");
+            read += 1;
+        }
+        sink.flush();
     }
 }
@@ -55,6 +55,31 @@ pub(crate) fn read_record_from_payload(
     Ok(BorrowedRecord::new_with_headers(key, value, headers))
 }
 
+/// Reads a record as written by the `read_records` host call, returning its
+/// timestamp along with it.
+///
+/// attributes: int8
+/// timestamp: varint
+/// offset: varint
+/// payload_length: varint
+/// payload: byte[]
+pub(crate) fn read_record_with_metadata(
+    buf: &[u8],
+) -> Result<Decoded<(i64, BorrowedRecord<'_>)>, VarintDecodeError> {
+    // The attributes and offset are not surfaced to transforms
+    let (_attributes, payload) = buf.split_first().ok_or(VarintDecodeError::ShortRead)?;
+    let timestamp = varint::read(payload)?;
+    let payload = &payload[timestamp.read..];
+    let offset = varint::read(payload)?;
+    let payload = &payload[offset.read..];
+    let record_payload = varint::read_sized_buffer(payload)?;
+    let record = read_record_from_payload(record_payload.value.unwrap_or_default())?;
+    Ok(Decoded {
+        value: (timestamp.value, record),
+        read: 1 + timestamp.read + offset.read + record_payload.read,
+    })
+}
+
 pub(crate) fn write_record_payload(r: BorrowedRecord, payload: &mut Vec<u8>) {
     varint::write_sized_buffer(payload, r.key());
     varint::write_sized_buffer(payload, r.value());
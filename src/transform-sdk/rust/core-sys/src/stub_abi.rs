@@ -34,16 +34,10 @@ pub(crate) unsafe fn read_batch_header(
     panic!("stub");
 }
 
-pub(crate) unsafe fn read_next_record(
-    _attributes: *mut u8,
-    _timestamp: *mut i64,
-    _offset: *mut i64,
-    _buf: *mut u8,
-    _len: u32,
-) -> i32 {
+pub(crate) unsafe fn read_records(_buf: *mut u8, _len: u32) -> i32 {
     panic!("stub");
 }
 
-pub(crate) unsafe fn write_record(_buf: *const u8, _len: u32) -> i32 {
+pub(crate) unsafe fn write_records(_buf: *const u8, _len: u32) -> i32 {
     panic!("stub");
 }
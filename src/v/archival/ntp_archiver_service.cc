@@ -18,11 +18,13 @@
 #include "archival/segment_reupload.h"
 #include "archival/types.h"
 #include "base/vlog.h"
+#include "bytes/iostream.h"
 #include "cloud_storage/async_manifest_view.h"
 #include "cloud_storage/partition_manifest.h"
 #include "cloud_storage/remote.h"
 #include "cloud_storage/remote_segment.h"
 #include "cloud_storage/remote_segment_index.h"
+#include "cloud_storage/segment_packer.h"
 #include "cloud_storage/spillover_manifest.h"
 #include "cloud_storage/topic_manifest.h"
 #include "cloud_storage/tx_range_manifest.h"
@@ -41,6 +43,8 @@
 #include "storage/fs_utils.h"
 #include "storage/ntp_config.h"
 #include "storage/parser.h"
+#include "storage/segment.h"
+#include "storage/segment_appender_utils.h"
 #include "utils/human.h"
 #include "utils/retry_chain_node.h"
 #include "utils/stream_utils.h"
@@ -113,8 +117,10 @@ ntp_archiver_upload_result::ntp_archiver_upload_result(
 
 // Success result
 ntp_archiver_upload_result::ntp_archiver_upload_result(
-  const cloud_storage::segment_record_stats& m)
+  const cloud_storage::segment_record_stats& m,
+  std::optional<cloud_storage::packed_segment_location> packed)
   : _stats(m)
+  , _packed(std::move(packed))
   , _result(cloud_storage::upload_result::success) {}
 
 ntp_archiver_upload_result ntp_archiver_upload_result::merge(
@@ -124,16 +130,20 @@ ntp_archiver_upload_result ntp_archiver_upload_result::merge(
       "list of ntp_archiver_upload_result values can't be empty");
     auto res = cloud_storage::upload_result::success;
     std::optional<cloud_storage::segment_record_stats> stats;
+    std::optional<cloud_storage::packed_segment_location> packed;
     for (auto& r : results) {
         if (r.has_record_stats()) {
             stats = r.record_stats();
         }
+        if (r.packed_location().has_value()) {
+            packed = r.packed_location();
+        }
         if (r.result() != cloud_storage::upload_result::success) {
             res = r.result();
         }
     }
     if (stats && res == cloud_storage::upload_result::success) {
-        return ntp_archiver_upload_result(stats.value());
+        return ntp_archiver_upload_result(stats.value(), std::move(packed));
     }
     vassert(
       res != cloud_storage::upload_result::success,
@@ -1140,6 +1150,65 @@ split_segment_stream(
       std::move(std::get<0>(res)), std::move(std::get<1>(res)));
 }
 
+/// Rebuild the on-disk bytes of \p candidate from the batch cache of its
+/// segments. Returns nullopt if any batch of the candidate isn't cached.
+static std::optional<iobuf>
+read_candidate_from_cache(const upload_candidate& candidate) {
+    iobuf data;
+    auto next = candidate.starting_offset;
+    for (const auto& segment : candidate.sources) {
+        auto last = std::min(
+          candidate.final_offset, segment->offsets().dirty_offset);
+        if (next > last) {
+            continue;
+        }
+        auto cached = segment->cache_get(
+          next,
+          last,
+          std::nullopt,
+          std::nullopt,
+          std::numeric_limits<size_t>::max(),
+          true);
+        for (auto& batch : cached.batches) {
+            if (batch.base_offset() != next) {
+                return std::nullopt;
+            }
+            next = model::next_offset(batch.last_offset());
+            data.append(storage::disk_header_to_iobuf(batch.header()));
+            data.append(std::move(batch).release_data());
+        }
+        if (next <= last) {
+            // a batch of the segment was evicted
+            return std::nullopt;
+        }
+    }
+    if (
+      next <= candidate.final_offset
+      || data.size_bytes() != candidate.content_length) {
+        return std::nullopt;
+    }
+    return data;
+}
+
+std::pair<ss::input_stream<char>, ss::input_stream<char>>
+ntp_archiver::make_upload_streams(const upload_candidate& candidate) {
+    if (config::shard_local_cfg().cloud_storage_upload_from_batch_cache()) {
+        if (auto data = read_candidate_from_cache(candidate); data) {
+            vlog(
+              _rtclog.debug,
+              "Uploading {} bytes of {} from the batch cache",
+              data->size_bytes(),
+              candidate.exposed_name);
+            _probe->uploaded_from_cache_bytes(data->size_bytes());
+            auto index_data = data->share(0, data->size_bytes());
+            return std::make_pair(
+              make_iobuf_input_stream(std::move(*data)),
+              make_iobuf_input_stream(std::move(index_data)));
+        }
+    }
+    return split_segment_stream(candidate, _conf->upload_io_priority);
+}
+
 ss::future<cloud_storage::upload_result> ntp_archiver::do_upload_segment(
   const remote_segment_path& path,
   upload_candidate candidate,
@@ -1237,6 +1306,14 @@ static ss::sstring make_index_path(const remote_segment_path& segment_path) {
     return fmt::format("{}.index", segment_path().native());
 }
 
+/// Serialize the index of a segment in the format it's uploaded in
+static iobuf serialize_index(cloud_storage::offset_index& ix) {
+    if (config::shard_local_cfg().cloud_storage_upload_segment_index_v2()) {
+        return ix.to_iobuf_v2();
+    }
+    return ix.to_iobuf();
+}
+
 // from offset to offset (by record batch boundary)
 ss::future<ntp_archiver_upload_result> ntp_archiver::upload_segment(
   model::term_id archiver_term,
@@ -1247,8 +1324,7 @@ ss::future<ntp_archiver_upload_result> ntp_archiver::upload_segment(
       candidate.remote_sources.empty(),
       "This method can only work with local segments");
 
-    auto [stream_upload, stream_index] = split_segment_stream(
-      candidate, _conf->upload_io_priority);
+    auto [stream_upload, stream_index] = make_upload_streams(candidate);
 
     auto path = segment_path_for_candidate(archiver_term, candidate);
 
@@ -1287,7 +1363,7 @@ ss::future<ntp_archiver_upload_result> ntp_archiver::upload_segment(
             .success_cb = [](auto& probe) { probe.index_upload(); },
             .failure_cb = [](auto& probe) { probe.failed_index_upload(); }},
           .type = cloud_storage::upload_type::segment_index,
-          .payload = idx_res->index.to_iobuf(),
+          .payload = serialize_index(idx_res->index),
         });
 
         co_return ntp_archiver_upload_result(idx_res->stats);
@@ -1336,6 +1412,64 @@ ss::future<ntp_archiver_upload_result> ntp_archiver::upload_segment(
     // manifest.
 }
 
+bool ntp_archiver::should_pack_segment(
+  const upload_candidate& candidate, segment_upload_kind kind) const {
+    // Compacted reuploads replace segments which may be packed, they are
+    // uploaded on their own.
+    return kind == segment_upload_kind::non_compacted
+           && candidate.remote_sources.empty()
+           && _remote.packer().should_pack(candidate.content_length)
+           && _feature_table.local().is_active(
+             features::feature::cloud_storage_segment_packing);
+}
+
+ss::future<ntp_archiver_upload_result> ntp_archiver::pack_segment(
+  model::term_id archiver_term,
+  upload_candidate candidate,
+  std::vector<ss::rwlock::holder> segment_read_locks) {
+    auto streams = make_upload_streams(candidate);
+    auto path = segment_path_for_candidate(archiver_term, candidate);
+    auto index_path = make_index_path(path);
+
+    auto read_fut = read_iobuf_exactly(
+                      streams.first, candidate.content_length)
+                      .finally([&streams] { return streams.first.close(); });
+    auto make_idx_fut = make_segment_index(
+      candidate.starting_offset,
+      candidate.base_timestamp,
+      _rtclog,
+      index_path,
+      std::move(streams.second));
+    auto [data, idx_res] = co_await ss::when_all_succeed(
+      std::move(read_fut), std::move(make_idx_fut));
+    // The segment is in memory, the packed object may take a while to fill
+    segment_read_locks.clear();
+
+    if (data.size_bytes() != candidate.content_length || !idx_res) {
+        vlog(
+          _rtclog.warn,
+          "Can't pack segment {}, read {} of {} bytes, stats available: {}",
+          path,
+          data.size_bytes(),
+          candidate.content_length,
+          idx_res.has_value());
+        co_return cloud_storage::upload_result::failed;
+    }
+
+    std::optional<cloud_storage::packed_segment_location> location;
+    try {
+        location = co_await _remote.packer().pack(
+          get_bucket_name(), std::move(data));
+    } catch (const ss::gate_closed_exception&) {
+        co_return cloud_storage::upload_result::cancelled;
+    }
+    if (!location) {
+        co_return cloud_storage::upload_result::failed;
+    }
+    vlog(_rtclog.debug, "Packed segment {} at {}", path, *location);
+    co_return ntp_archiver_upload_result(idx_res->stats, std::move(location));
+}
+
 std::optional<ss::sstring> ntp_archiver::upload_should_abort() {
     auto original_term = _parent.term();
     auto lost_leadership = !_parent.is_leader()
@@ -1477,8 +1611,13 @@ ntp_archiver::do_schedule_single_upload(
     // uploaded.
     std::vector<ss::future<ntp_archiver_upload_result>> all_uploads;
 
-    all_uploads.emplace_back(
-      upload_segment(archiver_term, upload, std::move(locks)));
+    if (should_pack_segment(upload, upload_kind)) {
+        all_uploads.emplace_back(
+          pack_segment(archiver_term, upload, std::move(locks)));
+    } else {
+        all_uploads.emplace_back(
+          upload_segment(archiver_term, upload, std::move(locks)));
+    }
 
     ss::log_level level{};
     std::exception_ptr ep;
@@ -1826,6 +1965,7 @@ ss::future<ntp_archiver::upload_group_result> ntp_archiver::wait_uploads(
                        - (total.num_succeeded + total.num_cancelled);
 
     std::vector<cloud_storage::segment_meta> mdiff;
+    cloud_storage::partition_manifest::packed_segments_map packed;
     const bool checks_disabled
       = config::shard_local_cfg()
           .cloud_storage_disable_upload_consistency_checks.value();
@@ -1894,6 +2034,9 @@ ss::future<ntp_archiver::upload_group_result> ntp_archiver::wait_uploads(
         }
 
         mdiff.push_back(*upload.meta);
+        if (const auto& loc = segment_results[i].packed_location()) {
+            packed.emplace(upload.meta->base_offset, *loc);
+        }
     }
 
     if (total.num_succeeded != 0) {
@@ -1928,7 +2071,8 @@ ss::future<ntp_archiver::upload_group_result> ntp_archiver::wait_uploads(
           deadline,
           _as,
           checks_disabled ? cluster::segment_validated::no
-                          : cluster::segment_validated::yes);
+                          : cluster::segment_validated::yes,
+          std::move(packed));
         if (
           error != cluster::errc::success
           && error != cluster::errc::not_leader) {
@@ -2507,6 +2651,9 @@ ss::future<> ntp_archiver::apply_spillover() {
             cloud_storage::spillover_manifest tail(_ntp, _rev);
             for (const auto& meta : manifest()) {
                 tail.add(meta);
+                if (auto loc = manifest().packed_segment(meta.base_offset)) {
+                    tail.add_packed_segment(meta.base_offset, std::move(*loc));
+                }
                 // No performance impact since all writes here are
                 // sequential.
                 tail.flush_write_buffer();
@@ -2802,7 +2949,10 @@ ntp_archiver::find_reupload_candidate(manifest_scanner_t scanner) {
         vlog(_rtclog.debug, "Scan result: {}", run);
     }
     auto units = co_await ss::get_units(_mutex, 1, _as);
-    if (run->meta.base_offset >= _parent.raft_start_offset()) {
+    if (
+      run->meta.base_offset >= _parent.raft_start_offset()
+      && !config::shard_local_cfg()
+            .cloud_storage_segment_merging_server_side()) {
         auto log_generic = _parent.log();
         auto& log = *log_generic;
         segment_collector collector(
@@ -2889,8 +3039,10 @@ ss::future<bool> ntp_archiver::upload(
     if (upload_locks.candidate.sources.size() > 0) {
         co_return co_await do_upload_local(std::move(upload_locks), source_rtc);
     }
-    // Currently, the uploading of remote segments is disabled and
-    // the only reason why the list of locks is empty is truncation.
+    if (upload_locks.candidate.remote_sources.size() > 0) {
+        co_return co_await do_upload_remote(
+          std::move(upload_locks), source_rtc);
+    }
     // The log could be truncated right after we scanned the manifest to
     // find upload candidate. In this case we will get an empty candidate
     // which is not a failure so we shuld return 'true'.
@@ -3043,9 +3195,187 @@ ss::future<bool> ntp_archiver::do_upload_local(
 ss::future<bool> ntp_archiver::do_upload_remote(
   upload_candidate_with_locks candidate,
   std::optional<std::reference_wrapper<retry_chain_node>> source_rtc) {
-    std::ignore = candidate;
-    std::ignore = source_rtc;
-    throw std::runtime_error("Not implemented");
+    if (!may_begin_uploads()) {
+        co_return false;
+    }
+    auto upload = std::move(candidate.candidate);
+    auto archiver_term = _start_term;
+
+    std::vector<cloud_storage::segment_meta> segments;
+    std::vector<cloud_storage::remote::compose_source> sources;
+    for (auto it = manifest().find(upload.starting_offset);
+         it != manifest().end() && it->base_offset <= upload.final_offset;
+         ++it) {
+        auto s = *it;
+        if (s.metadata_size_hint > 0) {
+            // The tx manifests of the segments would have to be merged as
+            // well, leave them as they are.
+            vlog(
+              _rtclog.info,
+              "Segment {} has aborted transactions, not merging {}",
+              s,
+              upload.exposed_name);
+            co_return true;
+        }
+        cloud_storage::remote::compose_source src{
+          .path = manifest().segment_object_path(s),
+          .size_bytes = s.size_bytes,
+        };
+        if (auto packed = manifest().packed_segment(s.base_offset); packed) {
+            src.byte_range = cloud_storage_clients::http_byte_range{
+              packed->offset, packed->offset + s.size_bytes - 1};
+        }
+        sources.push_back(std::move(src));
+        segments.push_back(s);
+    }
+    if (
+      segments.empty() || segments.front().base_offset != upload.starting_offset
+      || segments.back().committed_offset != upload.final_offset) {
+        vlog(
+          _rtclog.warn,
+          "Segments of the upload {} are no longer in the manifest",
+          upload.exposed_name);
+        co_return false;
+    }
+
+    auto rtc = source_rtc.value_or(std::ref(_rtcnode));
+    retry_chain_node fib(
+      _conf->segment_upload_timeout,
+      _conf->cloud_storage_initial_backoff,
+      &rtc.get());
+    auto lazy_abort_source = cloud_storage::lazy_abort_source{
+      [this]() { return upload_should_abort(); },
+    };
+    auto path = segment_path_for_candidate(archiver_term, upload);
+    vlog(
+      _rtclog.debug,
+      "Composing segment {} out of {} segments",
+      path,
+      sources.size());
+    auto res = co_await _remote.compose_segment(
+      get_bucket_name(), path, sources, fib, lazy_abort_source);
+    if (res != cloud_storage::upload_result::success) {
+        vlog(
+          _rtclog.warn,
+          "Failed to compose segment: {}, error: {}",
+          upload.exposed_name,
+          res);
+        co_return false;
+    }
+
+    // The read path builds the index on the fly if it's missing, so the
+    // segment is added even if its index can't be uploaded.
+    auto ix = co_await make_composed_segment_index(segments, fib);
+    if (ix.has_value()) {
+        std::ignore = co_await _remote.upload_object({
+          .transfer_details = {
+            .bucket = get_bucket_name(),
+            .key = cloud_storage_clients::object_key{make_index_path(path)},
+            .parent_rtc = fib,
+            .success_cb = [](auto& probe) { probe.index_upload(); },
+            .failure_cb = [](auto& probe) { probe.failed_index_upload(); }},
+          .type = cloud_storage::upload_type::segment_index,
+          .payload = serialize_index(*ix),
+        });
+    }
+
+    auto meta = cloud_storage::partition_manifest::segment_meta{
+      .is_compacted = false,
+      .size_bytes = upload.content_length,
+      .base_offset = upload.starting_offset,
+      .committed_offset = upload.final_offset,
+      .base_timestamp = upload.base_timestamp,
+      .max_timestamp = upload.max_timestamp,
+      .delta_offset = segments.front().delta_offset,
+      .ntp_revision = _rev,
+      .archiver_term = archiver_term,
+      .segment_term = upload.term,
+      .delta_offset_end = segments.back().delta_offset_end,
+      .sname_format = cloud_storage::segment_name_format::v3,
+    };
+
+    const bool checks_disabled
+      = config::shard_local_cfg()
+          .cloud_storage_disable_upload_consistency_checks.value();
+    if (!checks_disabled && !manifest().safe_segment_meta_to_add(meta)) {
+        co_return false;
+    }
+
+    auto highest_producer_id
+      = _feature_table.local().is_active(
+          features::feature::cloud_metadata_cluster_recovery)
+          ? _parent.highest_producer_id()
+          : model::producer_id{};
+    auto deadline = ss::lowres_clock::now() + _conf->manifest_upload_timeout;
+    auto error = co_await _parent.archival_meta_stm()->add_segments(
+      {meta},
+      std::nullopt,
+      highest_producer_id,
+      deadline,
+      _as,
+      checks_disabled ? cluster::segment_validated::no
+                      : cluster::segment_validated::yes);
+    if (error != cluster::errc::success && error != cluster::errc::not_leader) {
+        vlog(
+          _rtclog.warn,
+          "archival metadata STM update failed: {}",
+          error.message());
+        co_return false;
+    }
+    if (
+      co_await upload_manifest(segment_merger_ctx_label, source_rtc)
+      != cloud_storage::upload_result::success) {
+        vlog(
+          _rtclog.info,
+          "archival metadata replicated but manifest is not re-uploaded");
+    } else {
+        co_await flush_manifest_clean_offset();
+    }
+    co_return true;
+}
+
+ss::future<std::optional<cloud_storage::offset_index>>
+ntp_archiver::make_composed_segment_index(
+  const std::vector<cloud_storage::segment_meta>& segments,
+  retry_chain_node& parent) {
+    const auto& first = segments.front();
+    cloud_storage::offset_index ix(
+      first.base_offset,
+      first.base_kafka_offset(),
+      0,
+      cloud_storage::remote_segment_sampling_step_bytes,
+      first.base_timestamp);
+    int64_t file_pos = 0;
+    for (const auto& s : segments) {
+        if (manifest().packed_segment(s.base_offset).has_value()) {
+            // Packed segments are uploaded without an index
+            co_return std::nullopt;
+        }
+        cloud_storage::offset_index source_ix(
+          s.base_offset,
+          s.base_kafka_offset(),
+          0,
+          cloud_storage::remote_segment_sampling_step_bytes,
+          s.base_timestamp);
+        auto res = co_await _remote.download_index(
+          get_bucket_name(),
+          cloud_storage::remote_segment_path{cloud_storage::generate_index_path(
+            manifest().generate_segment_path(s))},
+          source_ix,
+          parent);
+        if (res != cloud_storage::download_result::success) {
+            vlog(
+              _rtclog.info,
+              "Index of segment {} is not available: {}, not uploading the "
+              "index of the composed segment",
+              s,
+              res);
+            co_return std::nullopt;
+        }
+        ix.append(source_ix, file_pos);
+        file_pos += static_cast<int64_t>(s.size_bytes);
+    }
+    co_return ix;
 }
 
 size_t ntp_archiver::get_local_segment_size() const {
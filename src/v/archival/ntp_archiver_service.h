@@ -67,9 +67,12 @@ public:
     static ntp_archiver_upload_result
     merge(const std::vector<ntp_archiver_upload_result>& results);
 
-    /// Success result with value
+    /// Success result with value, \p packed is set if the segment was
+    /// packed into a shared object
     explicit ntp_archiver_upload_result(
-      const cloud_storage::segment_record_stats& m);
+      const cloud_storage::segment_record_stats& m,
+      std::optional<cloud_storage::packed_segment_location> packed
+      = std::nullopt);
 
     /// Check if segment meta is present
     bool has_record_stats() const;
@@ -77,6 +80,12 @@ public:
     /// Extract segment stats
     const cloud_storage::segment_record_stats& record_stats() const;
 
+    /// Location of the segment if it was packed into a shared object
+    const std::optional<cloud_storage::packed_segment_location>&
+    packed_location() const {
+        return _packed;
+    }
+
     /// Extract operation upload_result
     cloud_storage::upload_result result() const;
 
@@ -85,6 +94,7 @@ public:
 
 private:
     std::optional<cloud_storage::segment_record_stats> _stats;
+    std::optional<cloud_storage::packed_segment_location> _packed;
     cloud_storage::upload_result _result{cloud_storage::upload_result::success};
 };
 
@@ -376,6 +386,12 @@ private:
     ss::future<bool> do_upload_remote(
       upload_candidate_with_locks candidate,
       std::optional<std::reference_wrapper<retry_chain_node>> source_rtc);
+    /// Build the index of a segment composed of \p segments out of their
+    /// indexes. Returns nullopt if any of them can't be downloaded.
+    ss::future<std::optional<cloud_storage::offset_index>>
+    make_composed_segment_index(
+      const std::vector<cloud_storage::segment_meta>& segments,
+      retry_chain_node& parent);
     /// Information about started upload
     struct scheduled_upload {
         /// The future that will be ready when the segment will be fully
@@ -466,6 +482,24 @@ private:
       std::optional<std::reference_wrapper<retry_chain_node>> source_rtc
       = std::nullopt);
 
+    /// Upload a small segment packed with the segments of other partitions
+    /// into a shared object, without its index.
+    ss::future<ntp_archiver_upload_result> pack_segment(
+      model::term_id archiver_term,
+      upload_candidate candidate,
+      std::vector<ss::rwlock::holder> segment_read_locks);
+
+    /// Whether the segment \p candidate should be packed into a shared
+    /// object instead of being uploaded on its own
+    bool should_pack_segment(
+      const upload_candidate& candidate, segment_upload_kind kind) const;
+
+    /// Make two streams of the data of \p candidate, one to upload and one
+    /// to build its index from. The data comes from the batch cache while
+    /// all of its batches are cached, and from disk otherwise.
+    std::pair<ss::input_stream<char>, ss::input_stream<char>>
+    make_upload_streams(const upload_candidate& candidate);
+
     /// Isolates segment upload and accepts a stream reference, so that if the
     /// upload fails the exception can be handled in the caller and the stream
     /// can be closed.
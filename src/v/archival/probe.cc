@@ -60,6 +60,13 @@ void ntp_level_probe::setup_ntp_metrics(const model::ntp& ntp) {
           [this] { return _uploaded_bytes; },
           sm::description("Total number of uploaded bytes"),
           labels),
+        sm::make_total_bytes(
+          "uploaded_from_cache_bytes",
+          [this] { return _uploaded_from_cache_bytes; },
+          sm::description(
+            "Total number of bytes uploaded from the batch cache instead of "
+            "being read from disk"),
+          labels),
         sm::make_counter(
           "missing",
           [this] { return _missing; },
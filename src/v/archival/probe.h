@@ -46,6 +46,11 @@ public:
 
     void uploaded_bytes(uint64_t bytes) { _uploaded_bytes += bytes; }
 
+    /// Register bytes of segments uploaded from the batch cache
+    void uploaded_from_cache_bytes(uint64_t bytes) {
+        _uploaded_from_cache_bytes += bytes;
+    }
+
     /// Register gap
     void gap_detected(model::offset offset_delta) { _missing += offset_delta; }
 
@@ -65,6 +70,8 @@ private:
     uint64_t _uploaded = 0;
     /// Total uploaded bytes
     uint64_t _uploaded_bytes = 0;
+    /// Bytes of segments uploaded from the batch cache
+    uint64_t _uploaded_from_cache_bytes = 0;
     /// Missing offsets due to gaps
     int64_t _missing = 0;
     /// Width of the offset range yet to be uploaded
@@ -17,9 +17,78 @@
 
 #include <seastar/core/temporary_buffer.hh>
 
+#include <array>
+#include <memory>
+#include <new>
+
 namespace details {
+
+/**
+ * A shard local cache of the memory of fragment control blocks, so that the
+ * fragments of iobufs created and destroyed at a high rate, e.g. per request,
+ * reuse their memory rather than going through the allocator every time.
+ */
+class io_fragment_pool {
+public:
+    static constexpr size_t max_cached = 256;
+
+    io_fragment_pool() = default;
+    io_fragment_pool(const io_fragment_pool&) = delete;
+    io_fragment_pool& operator=(const io_fragment_pool&) = delete;
+    io_fragment_pool(io_fragment_pool&&) = delete;
+    io_fragment_pool& operator=(io_fragment_pool&&) = delete;
+    ~io_fragment_pool() noexcept {
+        while (_cached > 0) {
+            ::operator delete(_blocks[--_cached]);
+        }
+    }
+
+    void* allocate(size_t size) {
+        if (_cached > 0) {
+            return _blocks[--_cached];
+        }
+        return ::operator new(size);
+    }
+
+    void deallocate(void* p) noexcept {
+        if (_cached < max_cached) {
+            _blocks[_cached++] = p;
+            return;
+        }
+        ::operator delete(p);
+    }
+
+    size_t cached() const { return _cached; }
+
+    static io_fragment_pool& local() {
+        static thread_local io_fragment_pool pool;
+        return pool;
+    }
+
+private:
+    std::array<void*, max_cached> _blocks{};
+    size_t _cached{0};
+};
+
 class io_fragment {
 public:
+    /// Payloads up to this size are allocated inline, together with the
+    /// control block of their fragment
+    static constexpr size_t max_inline_size = 512;
+
+    /**
+     * Create an empty fragment of a given size. Small fragments take a single
+     * allocation, for both the control block and the payload.
+     */
+    static std::unique_ptr<io_fragment> create(size_t size) {
+        if (size > max_inline_size) {
+            return std::make_unique<io_fragment>(size);
+        }
+        void* mem = ::operator new(sizeof(io_fragment) + size);
+        return std::unique_ptr<io_fragment>(
+          ::new (mem) io_fragment(inline_payload{}, size));
+    }
+
     /**
      * Initialize fragment from the provided temporary buffer.
      */
@@ -40,6 +109,23 @@ public:
     io_fragment& operator=(const io_fragment& o) = delete;
     ~io_fragment() noexcept = default;
 
+    static void* operator new(size_t size) {
+        return io_fragment_pool::local().allocate(size);
+    }
+    // destroying delete, to tell inline fragments from the pooled ones
+    static void operator delete(io_fragment* f, std::destroying_delete_t) {
+        const bool is_inline = f->_inline;
+        f->~io_fragment();
+        if (is_inline) {
+            ::operator delete(static_cast<void*>(f));
+        } else {
+            io_fragment_pool::local().deallocate(f);
+        }
+    }
+
+    /// whether the payload is allocated together with the fragment
+    bool is_inline() const { return _inline; }
+
     bool is_empty() const { return _used_bytes == 0; }
     size_t available_bytes() const { return _buf.size() - _used_bytes; }
     void reserve(size_t reservation) {
@@ -60,17 +146,26 @@ public:
         _used_bytes += sz;
         return sz;
     }
+    /// An inline payload dies with its fragment, so sharing it copies it,
+    /// which costs about the same as sharing the buffer of a fragment.
     ss::temporary_buffer<char> share() {
         // needed for output_stream<char> wrapper
-        return _buf.share(0, _used_bytes);
+        return share(0, _used_bytes);
     }
     ss::temporary_buffer<char> share(size_t pos, size_t len) {
+        if (_inline) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            return ss::temporary_buffer<char>(_buf.get() + pos, len);
+        }
         return _buf.share(pos, len);
     }
 
     /// destructive move. place special care when calling this method
     /// on a shared iobuf. most of the time you want share() instead of release
     ss::temporary_buffer<char> release() && {
+        if (_inline) {
+            return share();
+        }
         trim();
         return std::move(_buf);
     }
@@ -78,6 +173,10 @@ public:
         if (_used_bytes == _buf.size()) {
             return;
         }
+        if (_inline) {
+            _buf.trim(_used_bytes);
+            return;
+        }
         size_t half = _buf.size() / 2;
         if (_used_bytes <= half) {
             // this is an important optimization. often times during RPC
@@ -98,8 +197,19 @@ public:
     safe_intrusive_list_hook hook;
 
 private:
+    struct inline_payload {};
+
+    // the payload follows the fragment in the same allocation, the buffer
+    // does not own it
+    io_fragment(inline_payload, size_t size)
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      : _buf(reinterpret_cast<char*>(this + 1), size, ss::deleter())
+      , _used_bytes(0)
+      , _inline(true) {}
+
     ss::temporary_buffer<char> _buf;
     size_t _used_bytes;
+    bool _inline{false};
 };
 
 inline void __attribute__((noinline)) dispose_io_fragment(io_fragment* f) {
@@ -19,6 +19,7 @@
 #include <seastar/core/future-util.hh>
 
 #include <algorithm>
+#include <span>
 
 /*
  * It is common for an io_iterator_consumer to be initialized with the begin and
@@ -163,6 +164,11 @@ public:
     // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
     size_t segment_bytes_left() const { return _frag_index_end - _frag_index; }
     bool is_finished() const { return _frag == _frag_end; }
+    /// the bytes left in the current fragment, e.g. to decode a value in
+    /// place when it doesn't straddle fragments
+    std::span<const char> segment() const {
+        return {_frag_index, segment_bytes_left()};
+    }
 
     /// starts a new iterator byte-for-byte starting at *this* index
     /// useful for varint decoding that need to peek ahead
@@ -0,0 +1,43 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "base/seastarx.h"
+#include "bytes/iobuf.h"
+
+#include <seastar/core/deleter.hh>
+#include <seastar/core/shared_ptr.hh>
+#include <seastar/core/sharded.hh>
+#include <seastar/core/temporary_buffer.hh>
+
+#include <memory>
+
+/**
+ * Returns an iobuf sharing the fragments of \p buf, which lives on another
+ * shard and is kept alive by \p owner. Nothing is copied: the fragments
+ * reference the memory of the owner shard, and the owner is destroyed with the
+ * last of them, which releases the memory on that shard.
+ *
+ * The returned iobuf must not leave the calling shard.
+ */
+template<typename Ptr>
+iobuf share_foreign_iobuf(const iobuf& buf, ss::foreign_ptr<Ptr> owner) {
+    auto holder = ss::make_lw_shared<ss::foreign_ptr<Ptr>>(std::move(owner));
+    iobuf ret;
+    for (const auto& frag : buf) {
+        ret.append(std::make_unique<iobuf::fragment>(ss::temporary_buffer<char>(
+          const_cast<char*>(frag.get()), // NOLINT
+          frag.size(),
+          ss::make_deleter([holder] {}))));
+    }
+    return ret;
+}
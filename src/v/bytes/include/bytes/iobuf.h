@@ -307,7 +307,7 @@ inline void iobuf::create_new_fragment(size_t sz) {
     oncore_debug_verify(_verify_shard);
     auto chunk_max = std::max(sz, last_allocation_size());
     auto asz = details::io_allocation_size::next_allocation_size(chunk_max);
-    append(std::make_unique<fragment>(asz));
+    append(fragment::create(asz));
 }
 /// only ensures that a segment of at least reservation is avaible
 /// as an empty details::io_fragment
@@ -19,7 +19,9 @@
 
 #include <seastar/core/sstring.hh>
 
+#include <array>
 #include <memory>
+#include <span>
 
 /**
  * iobuf parser interface suitable for an iobuf passed by const-ref. also
@@ -46,9 +48,29 @@ public:
     size_t bytes_consumed() const { return _in.bytes_consumed(); }
 
     std::pair<int64_t, uint8_t> read_varlong() {
-        auto [val, length_size] = vint::deserialize(_in);
+        int64_t val = 0;
+        if (auto [decoded, length_size] = vint::deserialize_run(
+              segment(), {&val, 1});
+            likely(decoded == 1)) {
+            _in.skip(length_size);
+            return {val, length_size};
+        }
+        auto [slow_val, length_size] = vint::deserialize(_in);
         _in.skip(length_size);
-        return {val, length_size};
+        return {slow_val, length_size};
+    }
+
+    /// Reads N consecutive varlongs, all at once as long as they are
+    /// contiguous in a fragment of the buffer and one by one past that.
+    template<size_t N>
+    std::array<int64_t, N> read_varlongs() {
+        std::array<int64_t, N> values{};
+        auto [decoded, bytes_read] = vint::deserialize_run(segment(), values);
+        _in.skip(bytes_read);
+        for (size_t i = decoded; i < N; ++i) {
+            values[i] = read_varlong().first;
+        }
+        return values;
     }
 
     std::pair<uint32_t, uint8_t> read_unsigned_varint() {
@@ -117,6 +139,12 @@ private:
     size_t _original_size;
 
     const iobuf& cref() const { return *std::get<const_ref>(_buf); }
+
+    std::span<const uint8_t> segment() const {
+        auto seg = _in.segment();
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        return {reinterpret_cast<const uint8_t*>(seg.data()), seg.size()};
+    }
 };
 
 class iobuf_const_parser final : public iobuf_parser_base {
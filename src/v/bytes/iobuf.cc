@@ -139,20 +139,20 @@ iobuf iobuf_copy(iobuf::iterator_consumer& in, size_t len) {
 
     int bytes_left = len;
     while (bytes_left) {
-        ss::temporary_buffer<char> buf(
-          details::io_allocation_size::ss_next_allocation_size(bytes_left));
+        const size_t sz = details::io_allocation_size::ss_next_allocation_size(
+          bytes_left);
+        auto f = iobuf::fragment::create(sz);
 
         size_t offset = 0;
-        in.consume(buf.size(), [&buf, &offset](const char* src, size_t size) {
+        in.consume(sz, [&f, &offset](const char* src, size_t size) {
             // NOLINTNEXTLINE
-            std::copy_n(src, size, buf.get_write() + offset);
+            std::copy_n(src, size, f->get_write() + offset);
             offset += size;
             return ss::stop_iteration::no;
         });
+        f->reserve(sz);
 
-        bytes_left -= buf.size();
-
-        auto f = std::make_unique<iobuf::fragment>(std::move(buf));
+        bytes_left -= static_cast<int>(sz);
         ret.append(std::move(f));
     }
 
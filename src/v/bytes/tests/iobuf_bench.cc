@@ -0,0 +1,100 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "bytes/iobuf.h"
+
+#include <seastar/testing/perf_tests.hh>
+
+#include <array>
+#include <cstdint>
+
+/*
+ * The allocations column of the results is the thing to watch here: the
+ * cases mimic the iobufs built and torn down per request on the kafka and rpc
+ * paths, e.g. small headers, envelopes of a few fields and shares of them.
+ */
+
+namespace {
+
+constexpr size_t ops = 1000;
+
+const std::array<char, 128> small_payload{};
+
+template<size_t Size>
+size_t append_small() {
+    perf_tests::start_measuring_time();
+    for (size_t i = 0; i < ops; ++i) {
+        iobuf buf;
+        buf.append(small_payload.data(), Size);
+        perf_tests::do_not_optimize(buf);
+    }
+    perf_tests::stop_measuring_time();
+    return ops;
+}
+
+} // namespace
+
+PERF_TEST(iobuf, append_8_bytes) { return append_small<8>(); }
+
+PERF_TEST(iobuf, append_128_bytes) { return append_small<128>(); }
+
+PERF_TEST(iobuf, append_fields) {
+    perf_tests::start_measuring_time();
+    for (size_t i = 0; i < ops; ++i) {
+        iobuf buf;
+        for (uint32_t field = 0; field < 16; ++field) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            buf.append(reinterpret_cast<const uint8_t*>(&field), sizeof(field));
+        }
+        perf_tests::do_not_optimize(buf);
+    }
+    perf_tests::stop_measuring_time();
+    return ops;
+}
+
+PERF_TEST(iobuf, share_small) {
+    iobuf buf;
+    buf.append(small_payload.data(), small_payload.size());
+    perf_tests::start_measuring_time();
+    for (size_t i = 0; i < ops; ++i) {
+        auto shared = buf.share(0, buf.size_bytes());
+        perf_tests::do_not_optimize(shared);
+    }
+    perf_tests::stop_measuring_time();
+    return ops;
+}
+
+PERF_TEST(iobuf, copy_small) {
+    iobuf buf;
+    buf.append(small_payload.data(), small_payload.size());
+    perf_tests::start_measuring_time();
+    for (size_t i = 0; i < ops; ++i) {
+        auto copy = buf.copy();
+        perf_tests::do_not_optimize(copy);
+    }
+    perf_tests::stop_measuring_time();
+    return ops;
+}
+
+PERF_TEST(iobuf, append_fragments) {
+    ss::temporary_buffer<char> data(
+      details::io_allocation_size::max_chunk_size);
+    // the first share allocates the shared deleter
+    data.share();
+    perf_tests::start_measuring_time();
+    for (size_t i = 0; i < ops; ++i) {
+        iobuf buf;
+        for (size_t frag = 0; frag < 4; ++frag) {
+            buf.append(data.share());
+        }
+        perf_tests::do_not_optimize(buf);
+    }
+    perf_tests::stop_measuring_time();
+    return ops;
+}
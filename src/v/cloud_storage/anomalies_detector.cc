@@ -39,6 +39,10 @@ ss::future<anomalies_detector::result> anomalies_detector::run(
 
     vlog(_logger.debug, "Downloading partition manifest ...");
 
+    if (!co_await acquire_request()) {
+        _result.status = scrub_status::failed;
+        co_return _result;
+    }
     partition_manifest manifest(_ntp, _initial_rev);
     auto [dl_result, format] = co_await _remote.try_download_partition_manifest(
       _bucket, manifest, rtc_node);
@@ -53,40 +57,11 @@ ss::future<anomalies_detector::result> anomalies_detector::run(
         co_return _result;
     }
 
-    std::deque<ss::sstring> spill_manifest_paths;
-    const auto& spillovers = manifest.get_spillover_map();
-    for (auto iter = spillovers.begin(); iter != spillovers.end(); ++iter) {
-        spillover_manifest_path_components comp{
-          .base = iter->base_offset,
-          .last = iter->committed_offset,
-          .base_kafka = iter->base_kafka_offset(),
-          .next_kafka = iter->next_kafka_offset(),
-          .base_ts = iter->base_timestamp,
-          .last_ts = iter->max_timestamp,
-        };
-
-        auto spill_path = generate_spillover_manifest_path(
-          _ntp, _initial_rev, comp);
-        auto exists_result = co_await _remote.segment_exists(
-          _bucket, remote_segment_path{spill_path()}, rtc_node);
-        ++_result.ops;
-        if (exists_result == download_result::notfound) {
-            _result.detected.missing_spillover_manifests.emplace(comp);
-        } else if (dl_result != download_result::success) {
-            vlog(
-              _logger.debug,
-              "Failed to check existence of spillover manifest {}",
-              spill_path());
-            _result.status = scrub_status::partial;
-        } else {
-            spill_manifest_paths.emplace_front(spill_path());
-        }
-    }
-
     // Binary manifest encoding and spillover manifests were both added
     // in the same release. Hence, it's an anomaly to have a JSON
     // encoded manifest and spillover manifests.
-    if (format == manifest_format::json && spill_manifest_paths.size() > 0) {
+    const auto& spillovers = manifest.get_spillover_map();
+    if (format == manifest_format::json && !spillovers.empty()) {
         _result.detected.missing_partition_manifest = true;
     }
 
@@ -102,43 +77,67 @@ ss::future<anomalies_detector::result> anomalies_detector::run(
         first_seg_previous_manifest = *manifest.begin();
     }
 
-    for (size_t i = 0; i < spill_manifest_paths.size(); ++i) {
+    // Spillover manifests are scrubbed from the newest to the oldest. The
+    // ones above the scrub starting offset were scrubbed by the previous
+    // runs, so they are neither checked for existence nor downloaded again.
+    // The existence of a spillover manifest is established by downloading
+    // it, no separate HEAD request is needed.
+    for (auto i = static_cast<int64_t>(spillovers.size()) - 1; i >= 0; --i) {
+        auto iter = spillovers.at_index(i);
+        if (scrub_from && iter->base_offset > *scrub_from) {
+            first_seg_previous_manifest = std::nullopt;
+            continue;
+        }
         if (should_stop()) {
             _result.status = scrub_status::partial;
             co_return _result;
         }
 
-        const auto spill = co_await download_spill_manifest(
-          spill_manifest_paths[i], rtc_node);
-        if (spill) {
-            // Check adjacent segments which have a manifest
-            // boundary between them.
-            if (auto last_in_spill = spill->last_segment();
-                last_in_spill && first_seg_previous_manifest) {
-                scrub_segment_meta(
-                  *first_seg_previous_manifest,
-                  last_in_spill,
-                  _result.detected.segment_metadata_anomalies);
-            }
-
-            const auto stop_at_spill = co_await check_manifest(
-              *spill, scrub_from, rtc_node);
-            if (stop_at_spill == stop_detector::yes) {
-                _result.status = scrub_status::partial;
-                co_return _result;
-            }
-
-            if (!spill->empty()) {
-                first_seg_previous_manifest = *spill->begin();
-            } else {
-                vlog(
-                  _logger.warn,
-                  "Empty spillover manifest at {}",
-                  spill_manifest_paths[i]);
-            }
-        } else {
+        spillover_manifest_path_components comp{
+          .base = iter->base_offset,
+          .last = iter->committed_offset,
+          .base_kafka = iter->base_kafka_offset(),
+          .next_kafka = iter->next_kafka_offset(),
+          .base_ts = iter->base_timestamp,
+          .last_ts = iter->max_timestamp,
+        };
+        auto spill_path = generate_spillover_manifest_path(
+          _ntp, _initial_rev, comp);
+
+        spillover_manifest spill{_ntp, _initial_rev};
+        const auto spill_result = co_await download_spill_manifest(
+          spill_path(), spill, rtc_node);
+        if (spill_result == download_result::notfound) {
+            _result.detected.missing_spillover_manifests.emplace(comp);
+            first_seg_previous_manifest = std::nullopt;
+            continue;
+        } else if (spill_result != download_result::success) {
             _result.status = scrub_status::partial;
             first_seg_previous_manifest = std::nullopt;
+            continue;
+        }
+
+        // Check adjacent segments which have a manifest
+        // boundary between them.
+        if (auto last_in_spill = spill.last_segment();
+            last_in_spill && first_seg_previous_manifest) {
+            scrub_segment_meta(
+              *first_seg_previous_manifest,
+              last_in_spill,
+              _result.detected.segment_metadata_anomalies);
+        }
+
+        const auto stop_at_spill = co_await check_manifest(
+          spill, scrub_from, rtc_node);
+        if (stop_at_spill == stop_detector::yes) {
+            _result.status = scrub_status::partial;
+            co_return _result;
+        }
+
+        if (!spill.empty()) {
+            first_seg_previous_manifest = *spill.begin();
+        } else {
+            vlog(_logger.warn, "Empty spillover manifest at {}", spill_path());
         }
     }
 
@@ -150,14 +149,17 @@ ss::future<anomalies_detector::result> anomalies_detector::run(
     co_return _result;
 }
 
-ss::future<std::optional<spillover_manifest>>
-anomalies_detector::download_spill_manifest(
-  const ss::sstring& path, retry_chain_node& rtc_node) {
+ss::future<download_result> anomalies_detector::download_spill_manifest(
+  const ss::sstring& path,
+  spillover_manifest& spill,
+  retry_chain_node& rtc_node) {
     vlog(_logger.debug, "Downloading spillover manifest {}", path);
 
+    if (!co_await acquire_request()) {
+        co_return download_result::failed;
+    }
     ++_result.ops;
 
-    spillover_manifest spill{_ntp, _initial_rev};
     auto manifest_get_result = co_await _remote.download_manifest(
       _bucket,
       {manifest_format::serde, remote_manifest_path{path}},
@@ -165,12 +167,27 @@ anomalies_detector::download_spill_manifest(
       rtc_node);
 
     if (manifest_get_result != download_result::success) {
-        vlog(_logger.debug, "Failed downloading spillover manifest {}", path);
-
-        co_return std::nullopt;
+        vlog(
+          _logger.debug,
+          "Failed downloading spillover manifest {}: {}",
+          path,
+          manifest_get_result);
     }
 
-    co_return spill;
+    co_return manifest_get_result;
+}
+
+ss::future<bool> anomalies_detector::acquire_request() {
+    try {
+        co_await _remote.scrubber_budget().throttle(1, _as);
+        co_return true;
+    } catch (...) {
+        vlog(
+          _logger.debug,
+          "Scrubber request budget is not available: {}",
+          std::current_exception());
+    }
+    co_return false;
 }
 
 ss::future<anomalies_detector::stop_detector>
@@ -213,7 +230,11 @@ anomalies_detector::check_manifest(
 
         const auto seg_meta = *seg_iter;
 
-        const auto segment_path = manifest.generate_segment_path(seg_meta);
+        const auto segment_path = manifest.segment_object_path(seg_meta);
+        if (!co_await acquire_request()) {
+            _result.status = scrub_status::partial;
+            co_return stop_detector::yes;
+        }
         const auto exists_result = co_await _remote.segment_exists(
           _bucket, segment_path, rtc_node);
         _result.ops += 1;
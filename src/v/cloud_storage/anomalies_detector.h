@@ -29,10 +29,14 @@ namespace cloud_storage {
  *
  * It performs the following steps:
  * 1. Download partition manifest
- * 2. Check for existence of spillover manifests
- * 3. Check for existence of segments referenced by partition manifest
- * 4. For each spillover manifest, check for existence of the referenced
- * segments
+ * 2. Check for existence of segments referenced by partition manifest
+ * 3. For each spillover manifest, newest first, download it and check for
+ * existence of the referenced segments
+ *
+ * A run stops once it used up its quota and the next one resumes from the
+ * last scrubbed offset, skipping the manifests which were already checked.
+ * Every request waits for the shard-wide budget of the scrubbers
+ * ('cloud_storage_scrubbing_max_requests_per_sec').
  */
 class anomalies_detector {
 public:
@@ -59,8 +63,14 @@ public:
       std::optional<model::offset> = std::nullopt);
 
 private:
-    ss::future<std::optional<spillover_manifest>> download_spill_manifest(
-      const ss::sstring& path, retry_chain_node& rtc_node);
+    ss::future<download_result> download_spill_manifest(
+      const ss::sstring& path,
+      spillover_manifest& spill,
+      retry_chain_node& rtc_node);
+
+    /// Wait for the shard-wide request budget of the scrubbers. Returns
+    /// false if the detector is stopping.
+    ss::future<bool> acquire_request();
 
     using stop_detector = ss::bool_class<struct stop_detector_tag>;
 
@@ -40,9 +40,11 @@
 #include <boost/lexical_cast.hpp>
 #include <boost/outcome/success_failure.hpp>
 
+#include <algorithm>
 #include <exception>
 #include <functional>
 #include <iterator>
+#include <limits>
 #include <system_error>
 #include <variant>
 
@@ -238,6 +240,20 @@ async_manifest_view_cursor::seek(async_view_search_query_t q) {
     co_return true;
 }
 
+bool async_manifest_view_cursor::current_contains(
+  const async_view_search_query_t& q) const {
+    return ss::visit(
+      _current,
+      [](std::monostate) { return false; },
+      [](stale_manifest) { return false; },
+      [&q](std::reference_wrapper<const partition_manifest> p) {
+          return contains(p, q);
+      },
+      [&q](const ss::shared_ptr<materialized_manifest>& m) {
+          return !m->evicted && contains(m->manifest, q);
+      });
+}
+
 bool async_manifest_view_cursor::manifest_in_range(
   const manifest_section_t& m) {
     return ss::visit(
@@ -386,7 +402,10 @@ async_manifest_view::async_manifest_view(
   , _manifest_meta_ttl(
       config::shard_local_cfg().cloud_storage_manifest_cache_ttl_ms.bind())
   , _manifest_cache(
-      _remote.local().materialized().get_materialized_manifest_cache()) {}
+      _remote.local().materialized().get_materialized_manifest_cache()) {
+    // Reserve the space upfront so 'release_cursor' never allocates
+    _cursor_pool.reserve(max_pooled_cursors + 1);
+}
 
 ss::future<> async_manifest_view::start() {
     ssx::spawn_with_gate(_gate, [this] { return run_bg_loop(); });
@@ -396,6 +415,7 @@ ss::future<> async_manifest_view::start() {
 ss::future<> async_manifest_view::stop() {
     _as.request_abort();
     _cvar.broken();
+    _cursor_pool.clear();
     co_await _gate.close();
 }
 
@@ -600,6 +620,10 @@ async_manifest_view::get_cursor(
           end,
           _stm_manifest.get_start_offset(),
           _stm_manifest.get_last_offset());
+        if (auto pooled = acquire_cursor(query, begin, end); pooled) {
+            vlog(_ctxlog.debug, "reusing pooled cursor for {}", query);
+            co_return pooled;
+        }
         auto cursor = std::make_unique<async_manifest_view_cursor>(
           *this, begin, end, _manifest_meta_ttl());
         // This calls 'get_materialized_manifest' internally which
@@ -646,6 +670,75 @@ async_manifest_view::get_cursor(
     co_return error_outcome::failure;
 }
 
+void async_manifest_view::release_cursor(
+  std::unique_ptr<async_manifest_view_cursor> c) noexcept {
+    if (
+      !c || _gate.is_closed() || _as.abort_requested()
+      || c->get_status()
+           != async_manifest_view_cursor_status::materialized_spillover) {
+        // Cursors which point at the STM manifest are cheap to create
+        return;
+    }
+    _cursor_pool.insert(_cursor_pool.begin(), std::move(c));
+    if (_cursor_pool.size() > max_pooled_cursors) {
+        _cursor_pool.pop_back();
+    }
+}
+
+std::unique_ptr<async_manifest_view_cursor>
+async_manifest_view::acquire_cursor(
+  const async_view_search_query_t& q,
+  model::offset begin,
+  model::offset end_inclusive) {
+    if (_cursor_pool.empty() || in_stm(q)) {
+        return nullptr;
+    }
+    if (std::holds_alternative<model::offset>(q)) {
+        auto o = std::get<model::offset>(q);
+        if (o < begin || o > end_inclusive) {
+            return nullptr;
+        }
+    }
+    // Drop the cursors which lost their manifests while in the pool
+    std::erase_if(_cursor_pool, [](const auto& c) {
+        return c->get_status()
+               != async_manifest_view_cursor_status::materialized_spillover;
+    });
+    for (auto it = _cursor_pool.begin(); it != _cursor_pool.end(); ++it) {
+        auto& c = *it;
+        c->_begin = begin;
+        c->_end = end_inclusive;
+        if (!c->current_contains(q) || !c->manifest_in_range(c->_current)) {
+            continue;
+        }
+        if (std::holds_alternative<model::timestamp>(q)) {
+            // The timequery has to return the first manifest which
+            // may contain the timestamp, an overlapping manifest is
+            // not good enough.
+            auto ix = search_spillover_manifests_by_timestamp(
+              std::get<model::timestamp>(q));
+            if (ix < 0) {
+                continue;
+            }
+            auto meta = _stm_manifest.get_spillover_map().at_index(ix);
+            const auto& m = std::get<ss::shared_ptr<materialized_manifest>>(
+              c->_current);
+            if (
+              meta.is_end()
+              || meta->base_offset
+                   != m->manifest.get_start_offset().value_or(
+                     model::offset{})) {
+                continue;
+            }
+        }
+        auto cursor = std::move(c);
+        _cursor_pool.erase(it);
+        cursor->_timer.rearm(cursor->_idle_timeout + ss::lowres_clock::now());
+        return cursor;
+    }
+    return nullptr;
+}
+
 ss::future<result<std::unique_ptr<async_manifest_view_cursor>, error_outcome>>
 async_manifest_view::get_retention_backlog() noexcept {
     try {
@@ -1482,24 +1575,7 @@ std::optional<segment_meta> async_manifest_view::search_spillover_manifests(
           } else if (t > max_t) {
               return -1;
           }
-
-          const auto& bt_col = manifests.get_base_timestamp_column();
-          const auto& mt_col = manifests.get_max_timestamp_column();
-          auto mt_it = mt_col.begin();
-          auto bt_it = bt_col.begin();
-          int target_ix = -1;
-          while (!bt_it.is_end()) {
-              if (*mt_it >= t.value() || *bt_it > t.value()) {
-                  // Handle case when we're overshooting the target
-                  // (base_timestamp > t) or the case when the target is in the
-                  // middle of the manifest (max_timestamp >= t)
-                  target_ix = static_cast<int>(bt_it.index());
-                  break;
-              }
-              ++bt_it;
-              ++mt_it;
-          }
-          return target_ix;
+          return search_spillover_manifests_by_timestamp(t);
       });
 
     if (ix < 0) {
@@ -1512,6 +1588,70 @@ std::optional<segment_meta> async_manifest_view::search_spillover_manifests(
     return *res;
 }
 
+const async_manifest_view::spillover_timestamp_index&
+async_manifest_view::get_timestamp_index() const {
+    const auto& manifests = _stm_manifest.get_spillover_map();
+    auto first = manifests.empty() ? model::offset{}
+                                   : manifests.begin()->base_offset;
+    auto last = manifests.empty() ? model::offset{}
+                                  : manifests.last_segment()->base_offset;
+    if (
+      _ts_index.size == manifests.size() && _ts_index.first == first
+      && _ts_index.last == last) {
+        return _ts_index;
+    }
+    constexpr auto stride = spillover_timestamp_index::stride;
+    _ts_index = spillover_timestamp_index{
+      .size = manifests.size(),
+      .first = first,
+      .last = last,
+    };
+    _ts_index.prefix_max.reserve(manifests.size() / stride + 1);
+    const auto& bt_col = manifests.get_base_timestamp_column();
+    const auto& mt_col = manifests.get_max_timestamp_column();
+    auto mt_it = mt_col.begin();
+    auto bt_it = bt_col.begin();
+    auto running_max = std::numeric_limits<int64_t>::min();
+    size_t n = 0;
+    while (!bt_it.is_end()) {
+        running_max = std::max({running_max, *mt_it, *bt_it - 1});
+        ++bt_it;
+        ++mt_it;
+        if (++n % stride == 0 || n == manifests.size()) {
+            _ts_index.prefix_max.push_back(running_max);
+        }
+    }
+    return _ts_index;
+}
+
+int async_manifest_view::search_spillover_manifests_by_timestamp(
+  model::timestamp t) const {
+    const auto& index = get_timestamp_index();
+    // First block which contains a manifest that matches the query
+    auto block = std::lower_bound(
+      index.prefix_max.begin(), index.prefix_max.end(), t.value());
+    if (block == index.prefix_max.end()) {
+        return -1;
+    }
+    auto start = static_cast<size_t>(
+                   std::distance(index.prefix_max.begin(), block))
+                 * spillover_timestamp_index::stride;
+    const auto& manifests = _stm_manifest.get_spillover_map();
+    auto mt_it = manifests.get_max_timestamp_column().at_index(start);
+    auto bt_it = manifests.get_base_timestamp_column().at_index(start);
+    while (!bt_it.is_end()) {
+        if (*mt_it >= t.value() || *bt_it > t.value()) {
+            // Handle case when we're overshooting the target
+            // (base_timestamp > t) or the case when the target is in the
+            // middle of the manifest (max_timestamp >= t)
+            return static_cast<int>(bt_it.index());
+        }
+        ++bt_it;
+        ++mt_it;
+    }
+    return -1;
+}
+
 remote_manifest_path async_manifest_view::get_spillover_manifest_path(
   const segment_meta& meta) const {
     spillover_manifest_path_components comp{
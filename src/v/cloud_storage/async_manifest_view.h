@@ -32,8 +32,10 @@
 #include <chrono>
 #include <exception>
 #include <map>
+#include <memory>
 #include <type_traits>
 #include <variant>
+#include <vector>
 
 namespace cloud_storage {
 
@@ -91,6 +93,15 @@ public:
       async_view_search_query_t q,
       std::optional<model::offset> end_inclusive = std::nullopt) noexcept;
 
+    /// Return the cursor which is no longer needed to the view
+    ///
+    /// The view keeps a few cursors which point at the materialized
+    /// spillover manifests. The next 'get_cursor' call which targets one of
+    /// these manifests reuses the cursor instead of looking up the manifest
+    /// again.
+    void
+    release_cursor(std::unique_ptr<async_manifest_view_cursor> c) noexcept;
+
     /// Get inactive spillover manifests which are waiting for
     /// retention
     ss::future<
@@ -178,6 +189,17 @@ private:
     std::optional<segment_meta>
     search_spillover_manifests(async_view_search_query_t query) const;
 
+    /// Find index of the first spillover manifest which may contain the
+    /// timestamp or -1 if there is no such manifest
+    int search_spillover_manifests_by_timestamp(model::timestamp t) const;
+
+    /// Take the pooled cursor which points at the manifest that satisfies
+    /// the query, or return null if there is no such cursor
+    std::unique_ptr<async_manifest_view_cursor> acquire_cursor(
+      const async_view_search_query_t& q,
+      model::offset begin,
+      model::offset end_inclusive);
+
     /// Convert segment_meta to spillover manifest path
     remote_manifest_path
     get_spillover_manifest_path(const segment_meta& meta) const;
@@ -211,6 +233,29 @@ private:
     };
     std::deque<materialization_request_t> _requests;
     ss::condition_variable _cvar;
+
+    /// Sparse index over the timestamps of the spillover manifests
+    ///
+    /// The manifest 'i' matches the timequery 't' if its max_timestamp is
+    /// not below 't' or if its base_timestamp is above 't'. The index stores
+    /// the largest 'max(max_timestamp, base_timestamp - 1)' of every prefix
+    /// of 'stride' manifests, so the match can be found with a binary search
+    /// followed by a scan of a single block of the spillover map.
+    struct spillover_timestamp_index {
+        static constexpr size_t stride = 64;
+        size_t size{0};
+        model::offset first;
+        model::offset last;
+        std::vector<int64_t> prefix_max;
+    };
+    /// Return the index, rebuild it if the spillover map has changed
+    const spillover_timestamp_index& get_timestamp_index() const;
+    mutable spillover_timestamp_index _ts_index;
+
+    /// Released cursors that point at the spillover manifests, the most
+    /// recently released first
+    static constexpr size_t max_pooled_cursors = 4;
+    std::vector<std::unique_ptr<async_manifest_view_cursor>> _cursor_pool;
 };
 
 enum class async_manifest_view_cursor_status {
@@ -239,6 +284,8 @@ std::ostream& operator<<(std::ostream&, async_manifest_view_cursor_status);
 /// - time budget limits amount of time the cursor can hold the materialized
 ///   manifest
 class async_manifest_view_cursor {
+    friend class async_manifest_view;
+
 public:
     /// Create cursor with allowed offset range limits
     ///
@@ -327,6 +374,9 @@ private:
 
     bool manifest_in_range(const manifest_section_t& m);
 
+    /// Returns true if the current manifest satisfies the query
+    bool current_contains(const async_view_search_query_t& q) const;
+
     /// Manifest view ref
     async_manifest_view& _view;
 
@@ -334,8 +384,8 @@ private:
 
     ss::lowres_clock::duration _idle_timeout;
     ss::timer<ss::lowres_clock> _timer;
-    const model::offset _begin;
-    const model::offset _end;
+    model::offset _begin;
+    model::offset _end;
     std::optional<model::offset> _stm_start_offset{std::nullopt};
 };
 
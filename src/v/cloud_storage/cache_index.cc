@@ -0,0 +1,76 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "cloud_storage/cache_index.h"
+
+namespace cloud_storage {
+
+void cache_index::insert(
+  std::string_view path, uint64_t size, clock::time_point atime) {
+    auto [it, inserted] = _entries.try_emplace(
+      std::string(path), entry{.size = size, .access_time = atime});
+    if (!inserted) {
+        _by_access_time.erase({it->second.access_time, it->first});
+        _size_bytes -= it->second.size;
+        it->second = entry{.size = size, .access_time = atime};
+    }
+    _by_access_time.emplace(atime, it->first);
+    _size_bytes += size;
+}
+
+void cache_index::touch(std::string_view path, clock::time_point atime) {
+    auto it = _entries.find(path);
+    if (it == _entries.end() || it->second.access_time >= atime) {
+        return;
+    }
+    _by_access_time.erase({it->second.access_time, it->first});
+    it->second.access_time = atime;
+    _by_access_time.emplace(atime, it->first);
+}
+
+void cache_index::remove(std::string_view path) {
+    auto it = _entries.find(path);
+    if (it == _entries.end()) {
+        return;
+    }
+    _by_access_time.erase({it->second.access_time, it->first});
+    _size_bytes -= it->second.size;
+    _entries.erase(it);
+}
+
+void cache_index::merge_accessed_since(
+  const cache_index& other, clock::time_point since) {
+    for (auto it = other._by_access_time.lower_bound({since, {}});
+         it != other._by_access_time.end();
+         ++it) {
+        const auto& e = other._entries.find(it->second)->second;
+        insert(it->second, e.size, e.access_time);
+    }
+}
+
+fragmented_vector<file_list_item>
+cache_index::coldest(uint64_t bytes, size_t objects) const {
+    fragmented_vector<file_list_item> result;
+    uint64_t total_size = 0;
+    for (auto it = _by_access_time.begin();
+         it != _by_access_time.end()
+         && (total_size < bytes || result.size() < objects);
+         ++it) {
+        const auto& e = _entries.find(it->second)->second;
+        result.push_back(file_list_item{
+          .access_time = e.access_time,
+          .path = ss::sstring(it->second),
+          .size = e.size});
+        total_size += e.size;
+    }
+    return result;
+}
+
+} // namespace cloud_storage
@@ -0,0 +1,78 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#pragma once
+
+#include "cloud_storage/recursive_directory_walker.h"
+#include "container/fragmented_vector.h"
+
+#include <absl/container/btree_set.h>
+#include <absl/container/node_hash_map.h>
+
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace cloud_storage {
+
+/// In-memory index of the evictable files of the cache, ordered by access
+/// time.
+///
+/// The index is built from a walk of the cache directory and then kept up to
+/// date by the cache as files are written, read and deleted, so that a trim
+/// can pick the coldest files without walking the directory again and sorting
+/// all of its files.
+class cache_index {
+public:
+    using clock = std::chrono::system_clock;
+
+    cache_index() = default;
+    cache_index(const cache_index&) = delete;
+    cache_index& operator=(const cache_index&) = delete;
+    cache_index(cache_index&&) noexcept = default;
+    cache_index& operator=(cache_index&&) noexcept = default;
+    ~cache_index() = default;
+
+    /// Add a file, or update its size and access time if it is indexed.
+    void insert(std::string_view path, uint64_t size, clock::time_point atime);
+
+    /// Bump the access time of a file if it is indexed.
+    void touch(std::string_view path, clock::time_point atime);
+
+    void remove(std::string_view path);
+
+    /// Copy the entries of \p other accessed at or after \p since, which a
+    /// walk started at \p since may have missed.
+    void
+    merge_accessed_since(const cache_index& other, clock::time_point since);
+
+    /// Return the least recently accessed files, oldest first, until their
+    /// total size reaches \p bytes and their count reaches \p objects.
+    fragmented_vector<file_list_item>
+    coldest(uint64_t bytes, size_t objects) const;
+
+    size_t size() const { return _entries.size(); }
+    uint64_t size_bytes() const { return _size_bytes; }
+
+private:
+    struct entry {
+        uint64_t size;
+        clock::time_point access_time;
+    };
+
+    // The keys of the node map are stable, the ordered set refers to them.
+    absl::node_hash_map<std::string, entry> _entries;
+    absl::btree_set<std::pair<clock::time_point, std::string_view>>
+      _by_access_time;
+    uint64_t _size_bytes{0};
+};
+
+} // namespace cloud_storage
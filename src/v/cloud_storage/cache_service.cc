@@ -23,6 +23,7 @@
 #include <seastar/core/seastar.hh>
 #include <seastar/core/smp.hh>
 #include <seastar/core/sstring.hh>
+#include <seastar/coroutine/maybe_yield.hh>
 #include <seastar/util/defer.hh>
 
 #include <cloud_storage/cache_service.h>
@@ -186,6 +187,7 @@ uint64_t cache::get_total_cleaned() { return _total_cleaned; }
 
 ss::future<> cache::clean_up_at_start() {
     auto guard = _gate.hold();
+    const auto walk_started = std::chrono::system_clock::now();
     auto [walked_size, filtered_out_files, candidates_for_deletion, empty_dirs]
       = co_await _walker.walk(_cache_dir.native(), _access_time_tracker);
 
@@ -233,6 +235,8 @@ ss::future<> cache::clean_up_at_start() {
         }
     }
 
+    co_await rebuild_index(candidates_for_deletion, walk_started);
+
     _total_cleaned = deleted_bytes;
     _current_cache_size = walked_size - deleted_bytes;
     _current_cache_objects = filtered_out_files + candidates_for_deletion.size()
@@ -294,6 +298,17 @@ ss::future<> cache::trim(
   std::optional<size_t> object_limit_override) {
     vassert(ss::this_shard_id() == 0, "Method can only be invoked on shard 0");
     auto guard = _gate.hold();
+    if (!walk_due()) {
+        if (co_await trim_indexed(size_limit_override, object_limit_override)) {
+            co_return;
+        }
+        vlog(
+          cst_log.info,
+          "trim: the cache index does not hold enough files to reach the "
+          "target, walking the cache directory");
+    }
+
+    const auto walk_started = std::chrono::system_clock::now();
     auto [walked_cache_size, filtered_out_files, candidates_for_deletion, _]
       = co_await _walker.walk(
         _cache_dir.native(), _access_time_tracker, [](std::string_view path) {
@@ -305,44 +320,10 @@ ss::future<> cache::trim(
     // Updating the access time tracker in case if some files were removed
     // from cache directory by the user manually.
     co_await _access_time_tracker.trim(candidates_for_deletion);
+    co_await rebuild_index(candidates_for_deletion, walk_started);
 
-    auto size_limit = size_limit_override.value_or(_max_bytes);
-    auto object_limit = object_limit_override.value_or(_max_objects());
-
-    // We aim to trim to within the upper size limit, and additionally
-    // free enough space for anyone waiting in `reserve_space` to proceed
-    auto target_size = uint64_t(
-      (size_limit - std::min(_reservations_pending, size_limit)));
-
-    size_t target_objects = static_cast<size_t>(object_limit)
-                            - std::min(
-                              _reservations_pending_objects,
-                              static_cast<size_t>(object_limit));
-
-    // Apply _cache_size_low_watermark to the size and/or the object count,
-    // depending on which is currently the limiting factor for the trim.
-    if (_current_cache_objects + _reserved_cache_objects > target_objects) {
-        target_objects *= _cache_size_low_watermark;
-    }
-
-    if (_current_cache_size + _reserved_cache_size > target_size) {
-        target_size *= _cache_size_low_watermark;
-    }
-
-    // In the extreme case where even trimming to the low watermark wouldn't
-    // free enough space to enable writing to the cache, go even further.
-    if (_free_space < config::shard_local_cfg().storage_min_free_bytes()) {
-        target_size = std::min(
-          target_size,
-          _current_cache_size
-            - std::min(
-              _current_cache_size,
-              config::shard_local_cfg().storage_min_free_bytes()));
-        vlog(
-          cst_log.warn,
-          "Critically low space, trimming to {} bytes",
-          target_size);
-    }
+    auto [target_size, target_objects] = get_trim_target(
+      size_limit_override, object_limit_override);
 
     // Calculate total space used by tmp files: we will use this later
     // when updating current_cache_size.
@@ -363,8 +344,8 @@ ss::future<> cache::trim(
       _current_cache_size,
       _current_cache_objects,
       walked_cache_size,
-      size_limit,
-      object_limit,
+      size_limit_override.value_or(_max_bytes),
+      object_limit_override.value_or(_max_objects()),
       _reserved_cache_size,
       _reserved_cache_objects,
       _reservations_pending,
@@ -529,6 +510,160 @@ ss::future<> cache::trim(
     _last_trim_failed = false;
 }
 
+cache::trim_target cache::get_trim_target(
+  std::optional<uint64_t> size_limit_override,
+  std::optional<size_t> object_limit_override) const {
+    auto size_limit = size_limit_override.value_or(_max_bytes);
+    auto object_limit = object_limit_override.value_or(_max_objects());
+
+    // We aim to trim to within the upper size limit, and additionally
+    // free enough space for anyone waiting in `reserve_space` to proceed
+    auto target_size = uint64_t(
+      (size_limit - std::min(_reservations_pending, size_limit)));
+
+    size_t target_objects = static_cast<size_t>(object_limit)
+                            - std::min(
+                              _reservations_pending_objects,
+                              static_cast<size_t>(object_limit));
+
+    // Apply _cache_size_low_watermark to the size and/or the object count,
+    // depending on which is currently the limiting factor for the trim.
+    if (_current_cache_objects + _reserved_cache_objects > target_objects) {
+        target_objects *= _cache_size_low_watermark;
+    }
+
+    if (_current_cache_size + _reserved_cache_size > target_size) {
+        target_size *= _cache_size_low_watermark;
+    }
+
+    // In the extreme case where even trimming to the low watermark wouldn't
+    // free enough space to enable writing to the cache, go even further.
+    if (_free_space < config::shard_local_cfg().storage_min_free_bytes()) {
+        target_size = std::min(
+          target_size,
+          _current_cache_size
+            - std::min(
+              _current_cache_size,
+              config::shard_local_cfg().storage_min_free_bytes()));
+        vlog(
+          cst_log.warn,
+          "Critically low space, trimming to {} bytes",
+          target_size);
+    }
+
+    return {.size = target_size, .objects = target_objects};
+}
+
+bool cache::walk_due() const {
+    const auto interval
+      = config::shard_local_cfg().cloud_storage_cache_walk_interval_ms();
+    return !_last_walk.has_value() || interval == 0ms
+           || ss::lowres_clock::now() - *_last_walk >= interval;
+}
+
+bool cache::is_indexed(const ss::sstring& path) const {
+    const std::string_view p{path};
+    return !(
+      p.ends_with(tmp_extension) || p.ends_with(".tx") || p.ends_with(".index")
+      || is_trim_exempt(path));
+}
+
+ss::future<> cache::rebuild_index(
+  const fragmented_vector<file_list_item>& files,
+  std::chrono::system_clock::time_point since) {
+    cache_index index;
+    for (const auto& f : files) {
+        if (is_indexed(f.path)) {
+            index.insert(f.path, f.size, f.access_time);
+        }
+        co_await ss::coroutine::maybe_yield();
+    }
+    // Files written or read while the walk was running may be missing from
+    // its result.
+    index.merge_accessed_since(_index, since);
+    _index = std::move(index);
+    _last_walk = ss::lowres_clock::now();
+    vlog(
+      cst_log.debug,
+      "Rebuilt cache index of {} files, {} bytes",
+      _index.size(),
+      _index.size_bytes());
+}
+
+void cache::index_put(ss::sstring path, uint64_t size) {
+    if (!is_indexed(path)) {
+        return;
+    }
+    if (ss::this_shard_id() == 0) {
+        _index.insert(path, size, std::chrono::system_clock::now());
+        return;
+    }
+    ssx::spawn_with_gate(_gate, [this, path = std::move(path), size] {
+        return container().invoke_on(0, [path, size](cache& c) {
+            c._index.insert(path, size, std::chrono::system_clock::now());
+        });
+    });
+}
+
+ss::future<bool> cache::trim_indexed(
+  std::optional<uint64_t> size_limit_override,
+  std::optional<size_t> object_limit_override) {
+    auto [target_size, target_objects] = get_trim_target(
+      size_limit_override, object_limit_override);
+    const auto used_size = _current_cache_size + _reserved_cache_size;
+    const auto used_objects = _current_cache_objects + _reserved_cache_objects;
+    if (used_size < target_size && used_objects < target_objects) {
+        co_return true;
+    }
+
+    const auto size_to_delete = used_size - std::min(target_size, used_size);
+    const auto objects_to_delete = used_objects
+                                   - std::min(target_objects, used_objects);
+    auto candidates = _index.coldest(size_to_delete, objects_to_delete);
+    vlog(
+      cst_log.debug,
+      "trim: removing {}/{} bytes, {}/{} objects to reach target {}/{}, {} "
+      "candidates out of {} indexed files",
+      size_to_delete,
+      _current_cache_size,
+      objects_to_delete,
+      _current_cache_objects,
+      target_size,
+      target_objects,
+      candidates.size(),
+      _index.size());
+
+    auto result = co_await trim_fast(
+      candidates, size_to_delete, objects_to_delete);
+    _total_cleaned += result.deleted_size;
+    probe.set_size(_current_cache_size);
+    probe.set_num_files(_current_cache_objects);
+    vlog(
+      cst_log.debug,
+      "trim: deleted {} indexed files of total size {}",
+      result.deleted_count,
+      result.deleted_size);
+    if (
+      result.deleted_size < size_to_delete
+      || result.deleted_count < objects_to_delete) {
+        co_return false;
+    }
+
+    vlog(
+      cst_log.info,
+      "trim: post-trim cache size {}/{} (reserved {}/{}, pending {}/{})",
+      _current_cache_size,
+      _current_cache_objects,
+      _reserved_cache_size,
+      _reserved_cache_objects,
+      _reservations_pending,
+      _reservations_pending_objects);
+
+    _last_clean_up = ss::lowres_clock::now();
+    _last_trim_failed = false;
+    co_return true;
+}
+
 ss::future<cache::trim_result> cache::trim_fast(
   const fragmented_vector<file_list_item>& candidates,
   uint64_t size_to_delete,
@@ -633,6 +768,7 @@ ss::future<cache::trim_result> cache::trim_fast(
             // leak
             _access_time_tracker.remove_timestamp(
               std::string_view(file_stat.path));
+            _index.remove(file_stat.path);
 
             vlog(
               cst_log.trace,
@@ -707,6 +843,7 @@ cache::trim_exhaustive(uint64_t size_to_delete, size_t objects_to_delete) {
             co_await delete_file_and_empty_parents(file_stat.path);
             _access_time_tracker.remove_timestamp(
               std::string_view(file_stat.path));
+            _index.remove(file_stat.path);
 
             _current_cache_size -= std::min(
               file_stat.size, _current_cache_size);
@@ -913,13 +1050,15 @@ ss::future<std::optional<cache_item>> cache::get(std::filesystem::path key) {
 
         // Bump access time of the file
         if (ss::this_shard_id() == 0) {
-            _access_time_tracker.add_timestamp(
-              source, std::chrono::system_clock::now());
+            const auto now = std::chrono::system_clock::now();
+            _access_time_tracker.add_timestamp(source, now);
+            _index.touch(source, now);
         } else {
             ssx::spawn_with_gate(_gate, [this, source] {
                 return container().invoke_on(0, [source](cache& c) {
-                    c._access_time_tracker.add_timestamp(
-                      source, std::chrono::system_clock::now());
+                    const auto now = std::chrono::system_clock::now();
+                    c._access_time_tracker.add_timestamp(source, now);
+                    c._index.touch(source, now);
                 });
             });
         }
@@ -1063,6 +1202,7 @@ ss::future<> cache::put(
     auto put_size = co_await ss::file_size(src);
 
     co_await ss::rename_file(src, dest);
+    index_put(ss::sstring(dest), put_size);
 
     // We will now update
     reservation.wrote_data(put_size, 1);
@@ -1095,6 +1235,7 @@ ss::future<> cache::invalidate(const std::filesystem::path& key) {
         auto stat = co_await ss::file_stat(path);
         _access_time_tracker.remove_timestamp(key.native());
         co_await delete_file_and_empty_parents(path);
+        _index.remove(path);
         _current_cache_size -= stat.size;
         _current_cache_objects -= 1;
         probe.set_size(_current_cache_size);
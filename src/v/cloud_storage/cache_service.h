@@ -13,6 +13,7 @@
 #include "base/seastarx.h"
 #include "base/units.h"
 #include "cloud_storage/access_time_tracker.h"
+#include "cloud_storage/cache_index.h"
 #include "cloud_storage/cache_probe.h"
 #include "cloud_storage/recursive_directory_walker.h"
 #include "config/property.h"
@@ -212,6 +213,39 @@ private:
         bool trim_missed_tmp_files{false};
     };
 
+    struct trim_target {
+        uint64_t size;
+        size_t objects;
+    };
+
+    /// Size and object count to trim the cache down to, leaving room for the
+    /// pending reservations.
+    trim_target get_trim_target(
+      std::optional<uint64_t> size_limit_override,
+      std::optional<size_t> object_limit_override) const;
+
+    /// Trim the least recently accessed files of the index, without walking
+    /// the cache directory. Returns false if the index did not hold enough
+    /// files to reach the target, in which case the caller should walk.
+    ss::future<bool> trim_indexed(
+      std::optional<uint64_t> size_limit_override,
+      std::optional<size_t> object_limit_override);
+
+    /// Whether the next trim should walk the cache directory and rebuild the
+    /// index from it.
+    bool walk_due() const;
+
+    /// Rebuild the index from the files found by a walk started at \p since.
+    ss::future<> rebuild_index(
+      const fragmented_vector<file_list_item>& files,
+      std::chrono::system_clock::time_point since);
+
+    /// Whether a file is evicted on its own, and therefore indexed.
+    bool is_indexed(const ss::sstring& path) const;
+
+    /// Record a file written to the cache in the index on shard 0.
+    void index_put(ss::sstring path, uint64_t size);
+
     /// Ordinary trim: prioritze trimming data chunks, only delete indices etc
     /// if all their chunks are dropped.
     ss::future<trim_result> trim_fast(
@@ -318,6 +352,10 @@ private:
     std::set<std::filesystem::path> _files_in_progress;
     cache_probe probe;
     access_time_tracker _access_time_tracker;
+    /// Evictable files of the cache by access time (shard 0 only)
+    cache_index _index;
+    /// When the directory was last walked to rebuild _index, if ever.
+    std::optional<ss::lowres_clock::time_point> _last_walk;
     ss::timer<ss::lowres_clock> _tracker_timer;
     ssx::semaphore _access_tracker_writer_sm{
       1, "cloud/cache/access_tracker_writer"};
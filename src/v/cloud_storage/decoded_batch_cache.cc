@@ -0,0 +1,92 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "cloud_storage/decoded_batch_cache.h"
+
+#include "config/configuration.h"
+
+namespace cloud_storage {
+
+decoded_batch_cache::decoded_batch_cache()
+  : _max_bytes(config::shard_local_cfg()
+                 .cloud_storage_decoded_batch_cache_max_bytes.bind()) {}
+
+size_t decoded_batch_cache::entry_size(const entry& e) {
+    return sizeof(entry) + (e.records ? e.records->size_bytes() : 0);
+}
+
+decoded_batch_cache::entry decoded_batch_cache::share(entry& e) {
+    std::optional<iobuf> records;
+    if (e.records) {
+        records = e.records->share(0, e.records->size_bytes());
+    }
+    return {
+      .header = e.header, .records = std::move(records), .delta = e.delta};
+}
+
+void decoded_batch_cache::put(
+  const model::record_batch_header& header,
+  std::optional<iobuf> records,
+  model::offset_delta delta) {
+    if (!enabled()) {
+        return;
+    }
+    auto [it, inserted] = _entries.try_emplace(
+      header.base_offset,
+      entry{.header = header, .records = std::nullopt, .delta = delta});
+    if (!inserted && (it->second.records || !records)) {
+        // already cached by another reader
+        return;
+    }
+    _size_bytes -= inserted ? 0 : entry_size(it->second);
+    it->second.records = std::move(records);
+    _size_bytes += entry_size(it->second);
+
+    while (_size_bytes > _max_bytes() && !_entries.empty()) {
+        auto lowest = _entries.begin();
+        _size_bytes -= entry_size(lowest->second);
+        _entries.erase(lowest);
+    }
+}
+
+std::optional<decoded_batch_cache::entry>
+decoded_batch_cache::get(model::offset base) {
+    auto it = _entries.find(base);
+    if (it == _entries.end()) {
+        ++_misses;
+        return std::nullopt;
+    }
+    ++_hits;
+    return share(it->second);
+}
+
+std::optional<decoded_batch_cache::entry>
+decoded_batch_cache::find(kafka::offset o) {
+    for (auto& [base, e] : _entries) {
+        if (e.header.type != model::record_batch_type::raft_data) {
+            continue;
+        }
+        auto kafka_base = base - e.delta;
+        auto kafka_last = e.header.last_offset() - e.delta;
+        if (kafka_last < o) {
+            continue;
+        }
+        if (kafka_base > o) {
+            // the batches holding the offset are not cached
+            break;
+        }
+        ++_hits;
+        return share(e);
+    }
+    ++_misses;
+    return std::nullopt;
+}
+
+} // namespace cloud_storage
@@ -0,0 +1,77 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#pragma once
+
+#include "bytes/iobuf.h"
+#include "config/property.h"
+#include "model/fundamental.h"
+#include "model/record.h"
+
+#include <absl/container/btree_map.h>
+
+#include <optional>
+
+namespace cloud_storage {
+
+/// Bounded cache of the batches parsed out of a remote segment.
+///
+/// The readers of a segment record every batch they parse, with the offset
+/// delta in effect before it. A reader that starts at an offset the cache
+/// covers replays the cached batches instead of seeking the segment and
+/// parsing them again, so that consumers replaying the same range share the
+/// parsing. Batches the parser skipped are cached without their records to
+/// keep the offset translation of the runs that follow them. Once the cache
+/// exceeds `cloud_storage_decoded_batch_cache_max_bytes` the batches with
+/// the lowest offsets are dropped.
+class decoded_batch_cache {
+public:
+    struct entry {
+        /// Header with redpanda offsets
+        model::record_batch_header header;
+        /// Records of the batch, unless the parser skipped it
+        std::optional<iobuf> records;
+        /// Offset delta before the batch
+        model::offset_delta delta;
+    };
+
+    decoded_batch_cache();
+
+    bool enabled() const { return _max_bytes() > 0; }
+
+    /// Record a batch parsed out of the segment. The records are shared.
+    void put(
+      const model::record_batch_header& header,
+      std::optional<iobuf> records,
+      model::offset_delta delta);
+
+    /// The cached batch starting at redpanda offset \p base
+    std::optional<entry> get(model::offset base);
+
+    /// The cached data batch holding kafka offset \p o, the start of a replay
+    std::optional<entry> find(kafka::offset o);
+
+    size_t size() const { return _entries.size(); }
+    size_t size_bytes() const { return _size_bytes; }
+    uint64_t hits() const { return _hits; }
+    uint64_t misses() const { return _misses; }
+
+private:
+    static size_t entry_size(const entry&);
+    static entry share(entry&);
+
+    config::binding<size_t> _max_bytes;
+    absl::btree_map<model::offset, entry> _entries;
+    size_t _size_bytes{0};
+    uint64_t _hits{0};
+    uint64_t _misses{0};
+};
+
+} // namespace cloud_storage
@@ -0,0 +1,111 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "cloud_storage/hot_tier.h"
+
+#include "base/vlog.h"
+#include "cloud_storage/logger.h"
+#include "config/configuration.h"
+
+namespace cloud_storage {
+
+hot_tier::hot_tier(adjustable_semaphore& memory)
+  : _max_bytes(
+      config::shard_local_cfg().cloud_storage_hot_tier_max_bytes.bind())
+  , _memory(memory) {
+    _max_bytes.watch([this] {
+        while (_size_bytes > _max_bytes() && !_lru.empty()) {
+            evict_lru();
+        }
+    });
+}
+
+hot_tier::~hot_tier() { _lru.clear(); }
+
+std::optional<iobuf> hot_tier::get(const std::filesystem::path& key) {
+    if (!enabled()) {
+        return std::nullopt;
+    }
+    ss::sstring k{key.native()};
+    count_access(k);
+    auto it = _entries.find(k);
+    if (it == _entries.end()) {
+        ++_misses;
+        return std::nullopt;
+    }
+    ++_hits;
+    auto& e = *it->second;
+    e._hook.unlink();
+    _lru.push_back(e);
+    return e.data.share(0, e.data.size_bytes());
+}
+
+bool hot_tier::should_admit(const std::filesystem::path& key) const {
+    if (!enabled()) {
+        return false;
+    }
+    auto it = _frequency.find(ss::sstring{key.native()});
+    return it != _frequency.end() && it->second >= admission_threshold;
+}
+
+void hot_tier::put(const std::filesystem::path& key, iobuf data) {
+    const auto size = data.size_bytes();
+    ss::sstring k{key.native()};
+    if (size > _max_bytes() || _entries.contains(k)) {
+        return;
+    }
+    while (_size_bytes + size > _max_bytes() && !_lru.empty()) {
+        evict_lru();
+    }
+    auto units = _memory.try_get_units(size);
+    if (!units.has_value()) {
+        vlog(cst_log.trace, "hot tier: no memory to admit {}", k);
+        return;
+    }
+    auto e = std::make_unique<entry>(entry{
+      .key = k, .data = std::move(data), .units = std::move(*units)});
+    _lru.push_back(*e);
+    _entries.emplace(std::move(k), std::move(e));
+    _size_bytes += size;
+    vlog(
+      cst_log.trace,
+      "hot tier: admitted {}, {} bytes, {} files in {} bytes",
+      key.native(),
+      size,
+      _entries.size(),
+      _size_bytes);
+}
+
+void hot_tier::release(size_t target_free) {
+    while (_memory.current() < target_free && !_lru.empty()) {
+        evict_lru();
+    }
+}
+
+void hot_tier::count_access(const ss::sstring& key) {
+    if (_frequency.size() >= max_tracked_files && !_frequency.contains(key)) {
+        for (auto& f : _frequency) {
+            f.second /= 2;
+        }
+        absl::erase_if(
+          _frequency, [](const auto& f) { return f.second == 0; });
+    }
+    ++_frequency[key];
+}
+
+void hot_tier::evict_lru() {
+    auto& e = _lru.front();
+    _lru.pop_front();
+    _size_bytes -= e.data.size_bytes();
+    auto key = e.key;
+    _entries.erase(key);
+}
+
+} // namespace cloud_storage
@@ -0,0 +1,98 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#pragma once
+
+#include "base/seastarx.h"
+#include "bytes/iobuf.h"
+#include "config/property.h"
+#include "container/intrusive_list_helpers.h"
+#include "ssx/semaphore.h"
+#include "utils/adjustable_semaphore.h"
+
+#include <seastar/core/sstring.hh>
+
+#include <absl/container/flat_hash_map.h>
+
+#include <filesystem>
+#include <memory>
+#include <optional>
+
+namespace cloud_storage {
+
+/// Bounded in-memory tier above the cache for the chunks and segment indexes
+/// read most often.
+///
+/// Every read of a file counts as an access, and a file read from the cache
+/// is admitted once it was accessed `admission_threshold` times recently, so
+/// that a single scan does not flush the files many readers share. Admitted
+/// files are served from memory without any file I/O. The memory comes from
+/// the tiered storage memory group, and is given back, least recently used
+/// first, when the readers need it or the tier exceeds
+/// `cloud_storage_hot_tier_max_bytes`.
+class hot_tier {
+public:
+    static constexpr uint32_t admission_threshold = 2;
+
+    explicit hot_tier(adjustable_semaphore& memory);
+
+    hot_tier(const hot_tier&) = delete;
+    hot_tier& operator=(const hot_tier&) = delete;
+    hot_tier(hot_tier&&) = delete;
+    hot_tier& operator=(hot_tier&&) = delete;
+    ~hot_tier();
+
+    bool enabled() const { return _max_bytes() > 0; }
+
+    /// Count an access to the cache file \p key and return the content of
+    /// the file if it is in the tier.
+    std::optional<iobuf> get(const std::filesystem::path& key);
+
+    /// Whether the cache file \p key was accessed often enough to be
+    /// admitted once read.
+    bool should_admit(const std::filesystem::path& key) const;
+
+    /// Admit the content of the cache file \p key, if there is memory for it.
+    void put(const std::filesystem::path& key, iobuf data);
+
+    /// Evict files until \p target_free units of the memory group are free,
+    /// or the tier is empty.
+    void release(size_t target_free);
+
+    size_t size_bytes() const { return _size_bytes; }
+    uint64_t hits() const { return _hits; }
+    uint64_t misses() const { return _misses; }
+
+private:
+    struct entry {
+        ss::sstring key;
+        iobuf data;
+        ssx::semaphore_units units;
+        intrusive_list_hook _hook;
+    };
+
+    // Number of files whose accesses are counted. Once reached, the counts
+    // are halved so that the frequencies reflect recent accesses.
+    static constexpr size_t max_tracked_files = 4096;
+
+    void count_access(const ss::sstring& key);
+    void evict_lru();
+
+    config::binding<size_t> _max_bytes;
+    adjustable_semaphore& _memory;
+    absl::flat_hash_map<ss::sstring, std::unique_ptr<entry>> _entries;
+    intrusive_list<entry, &entry::_hook> _lru;
+    absl::flat_hash_map<ss::sstring, uint32_t> _frequency;
+    size_t _size_bytes{0};
+    uint64_t _hits{0};
+    uint64_t _misses{0};
+};
+
+} // namespace cloud_storage
@@ -202,6 +202,10 @@ void materialized_manifest_cache::put(
               key));
         }
     }
+    // Segments which were added to the manifest after it was decoded are
+    // held uncompressed in the write buffer of the column store, encode
+    // them before the manifest is cached.
+    manifest.flush_write_buffer();
     auto item = ss::make_shared<materialized_manifest>(
       std::move(manifest), std::move(s));
     auto [it, ok] = _cache.insert(std::make_pair(key, std::move(item)));
@@ -78,6 +78,10 @@ struct materialized_manifest
 /// The memory limit is specified in bytes. The cache uses LRU
 /// eviction policy and will try to evict least recently used
 /// materialized manifest.
+///
+/// The segments of the cached manifests stay encoded in their column store
+/// (see segment_meta_cstore). Only the frames which are accessed are decoded,
+/// so the memory limit applies to the compressed size of the metadata.
 class materialized_manifest_cache {
     using access_list_t
       = intrusive_list<materialized_manifest, &materialized_manifest::_hook>;
@@ -166,6 +166,7 @@ materialized_resources::materialized_resources()
       memory_groups().tiered_storage_max_memory(),
       "cst_materialized_resources_memory")
   , _hydration_units(max_parallel_hydrations(), "cst_hydrations")
+  , _hot_tier(_mem_units)
   , _manifest_meta_size(
       config::shard_local_cfg().cloud_storage_manifest_cache_size.bind())
   , _manifest_cache(ss::make_shared<materialized_manifest_cache>(
@@ -487,6 +488,10 @@ void materialized_resources::trim_segment_readers(size_t target_free) {
       target_free,
       _mem_units.available_units());
 
+    // The files of the hot tier are the first to go, they are still in the
+    // cache.
+    _hot_tier.release(target_free);
+
     // We sort segments by their reader count before culling, to avoid unfairly
     // targeting whichever segments happen to be first in the list.
     // Sorting by atime doesn't work well, because atime is a per-segment
@@ -573,6 +578,10 @@ void materialized_resources::trim_segments(std::optional<size_t> target_free) {
       "collecting stale materialized segments, {} segments materialized",
       _materialized.size());
 
+    if (target_free) {
+        _hot_tier.release(*target_free);
+    }
+
     auto now = ss::lowres_clock::now();
 
     // The pointers in offload_list_t are safe because there are no scheduling
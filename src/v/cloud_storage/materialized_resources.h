@@ -11,7 +11,9 @@
 #pragma once
 
 #include "base/seastarx.h"
+#include "cloud_storage/hot_tier.h"
 #include "cloud_storage/materialized_manifest_cache.h"
+#include "cloud_storage/read_cost_table.h"
 #include "cloud_storage/read_path_probes.h"
 #include "cloud_storage/remote_partition.h"
 #include "cloud_storage/segment_state.h"
@@ -78,6 +80,11 @@ public:
     ///
     /// The undrlying semaphore limits number of parallel hydrations
     ss::future<ssx::semaphore_units> get_hydration_units(size_t n);
+
+    hot_tier& get_hot_tier() { return _hot_tier; }
+
+    ts_read_cost_table& get_read_cost_table() { return _read_costs; }
+
     ss::input_stream<char>
     throttle_download(ss::input_stream<char> underlying, ss::abort_source& as);
 
@@ -162,6 +169,9 @@ private:
     adjustable_semaphore _mem_units;
     adjustable_semaphore _hydration_units;
 
+    /// In-memory tier above the cache, using units of _mem_units
+    hot_tier _hot_tier;
+
     /// Size of the materialized_manifest_cache
     config::binding<size_t> _manifest_meta_size;
 
@@ -174,6 +184,7 @@ private:
     uint64_t _segments_delayed{0};
 
     ts_read_path_probe _read_path_probe;
+    ts_read_cost_table _read_costs;
     token_bucket<> _throughput_limit;
     config::binding<std::optional<size_t>> _throughput_shard_limit_config;
     config::binding<std::optional<size_t>> _relative_throughput;
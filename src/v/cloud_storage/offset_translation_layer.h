@@ -28,12 +28,19 @@ struct stream_stats {
     model::offset min_offset = model::offset::max();
     model::offset max_offset = model::offset::min();
     uint64_t size_bytes{};
+    /// Offset ranges of the batches that are not translated to kafka
+    /// offsets, collected if the translator has no state to add them to
+    std::vector<std::pair<model::offset, model::offset>> gaps;
 };
 
 /// This instance of this class is supposed to be used to
 /// translate from redpanda offsets to kafka offsets in the
 /// shadow-indexing and recovery contexts.
 /// It consumes information stored in the manifest.
+///
+/// Without an offset translator state the gaps are returned in the
+/// stream_stats instead, so that segments can be copied concurrently and
+/// their gaps added in order afterwards.
 class offset_translator final {
 public:
     offset_translator(
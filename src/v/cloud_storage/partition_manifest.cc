@@ -477,6 +477,28 @@ partition_manifest::generate_segment_path(const lw_segment_meta& meta) const {
     return generate_segment_path(lw_segment_meta::convert(meta));
 }
 
+remote_segment_path
+partition_manifest::segment_object_path(const segment_meta& meta) const {
+    if (auto it = _packed_segments.find(meta.base_offset);
+        it != _packed_segments.end()) {
+        return remote_segment_path{std::filesystem::path{it->second.object}};
+    }
+    return generate_segment_path(meta);
+}
+
+void partition_manifest::add_packed_segment(
+  model::offset base, packed_segment_location loc) {
+    _packed_segments.insert_or_assign(base, std::move(loc));
+}
+
+std::optional<packed_segment_location>
+partition_manifest::packed_segment(model::offset base) const {
+    if (auto it = _packed_segments.find(base); it != _packed_segments.end()) {
+        return it->second;
+    }
+    return std::nullopt;
+}
+
 segment_name partition_manifest::generate_remote_segment_name(
   const partition_manifest::value& val) {
     switch (val.sname_format) {
@@ -931,6 +953,11 @@ bool partition_manifest::add(segment_meta meta) {
     if (meta.ntp_revision == model::initial_revision_id{}) {
         meta.ntp_revision = _rev;
     }
+    // The replaced segments take their packed locations with them, the
+    // location of the new segment, if any, is added after it.
+    _packed_segments.erase(
+      _packed_segments.lower_bound(meta.base_offset),
+      _packed_segments.upper_bound(meta.committed_offset));
     _segments.insert(meta);
 
     _last_offset = std::max(meta.committed_offset, _last_offset);
@@ -1139,9 +1166,14 @@ partition_manifest partition_manifest::truncate() {
         // it->committed_offset < _start_offset should be true for the whole
         // [it, end_it) range
         removed.add(*it);
+        if (auto loc = packed_segment(it->base_offset)) {
+            removed.add_packed_segment(it->base_offset, std::move(*loc));
+        }
     }
 
     _segments.prefix_truncate(_start_offset);
+    _packed_segments.erase(
+      _packed_segments.begin(), _packed_segments.lower_bound(_start_offset));
 
     if (_segments.empty()) {
         // start offset only makes sense if we have segments
@@ -1193,7 +1225,8 @@ partition_manifest partition_manifest::clone() const {
       _last_partition_scrub,
       _last_scrubbed_offset,
       _detected_anomalies,
-      _highest_producer_id);
+      _highest_producer_id,
+      _packed_segments);
     return tmp;
 }
 
@@ -2650,6 +2683,7 @@ struct partition_manifest_serde
     model::timestamp _last_partition_scrub;
     std::optional<model::offset> _last_scrubbed_offset;
     model::producer_id _highest_producer_id;
+    partition_manifest::packed_segments_map _packed_segments;
 };
 
 static_assert(
@@ -25,6 +25,8 @@
 #include <seastar/core/iostream.hh>
 #include <seastar/core/shared_ptr.hh>
 
+#include <absl/container/btree_map.h>
+
 #include <deque>
 
 namespace cloud_storage {
@@ -117,6 +119,9 @@ public:
     using spillover_manifest_map = segment_meta_cstore;
     using replaced_segments_list = fragmented_vector<lw_segment_meta>;
     using const_iterator = segment_map::const_iterator;
+    /// Locations of the segments uploaded into shared objects, by base offset
+    using packed_segments_map
+      = absl::btree_map<model::offset, packed_segment_location>;
 
     /// Generate segment name to use in the cloud
     static segment_name generate_remote_segment_name(const value& val);
@@ -157,7 +162,8 @@ public:
       model::timestamp last_partition_scrub,
       std::optional<model::offset> last_scrubbed_offset,
       anomalies detected_anomalies,
-      model::producer_id highest_producer_id)
+      model::producer_id highest_producer_id,
+      packed_segments_map packed_segments = {})
       : _ntp(std::move(ntp))
       , _rev(rev)
       , _mem_tracker(std::move(manifest_mem_tracker))
@@ -174,7 +180,8 @@ public:
       , _last_partition_scrub(last_partition_scrub)
       , _last_scrubbed_offset(last_scrubbed_offset)
       , _detected_anomalies(std::move(detected_anomalies))
-      , _highest_producer_id(highest_producer_id) {
+      , _highest_producer_id(highest_producer_id)
+      , _packed_segments(std::move(packed_segments)) {
         for (auto nm : replaced) {
             auto key = parse_segment_name(nm.name);
             vassert(
@@ -276,6 +283,10 @@ public:
     remote_segment_path generate_segment_path(const segment_meta&) const;
     remote_segment_path generate_segment_path(const lw_segment_meta&) const;
 
+    /// Path of the object that holds the data of the segment: the shared
+    /// object for packed segments, the segment path otherwise.
+    remote_segment_path segment_object_path(const segment_meta&) const;
+
     /// Return an iterator to the first addressable segment (i.e. base offset
     /// is greater than or equal to the start offset). If no such segment
     /// exists, return the end iterator.
@@ -421,6 +432,17 @@ public:
         return _highest_producer_id;
     }
 
+    /// Record that the segment with base offset \p base was uploaded into a
+    /// shared object at \p loc. The location is dropped along with the
+    /// segment when it is truncated or replaced.
+    void add_packed_segment(model::offset base, packed_segment_location loc);
+    /// Location of the segment with base offset \p base if it is packed
+    std::optional<packed_segment_location>
+    packed_segment(model::offset base) const;
+    const packed_segments_map& packed_segments() const {
+        return _packed_segments;
+    }
+
     /// Get segment if available or nullopt
     std::optional<segment_meta> get(const key& key) const;
     std::optional<segment_meta> get(const segment_name& name) const;
@@ -537,7 +559,8 @@ public:
           _spillover_manifests,
           _last_partition_scrub,
           _last_scrubbed_offset,
-          _highest_producer_id);
+          _highest_producer_id,
+          _packed_segments);
     }
     auto serde_fields() const {
         // this list excludes _mem_tracker, which is not serialized
@@ -559,7 +582,8 @@ public:
           _spillover_manifests,
           _last_partition_scrub,
           _last_scrubbed_offset,
-          _highest_producer_id);
+          _highest_producer_id,
+          _packed_segments);
     }
 
     /// Compare two manifests for equality. Don't compare the mem_tracker.
@@ -678,6 +702,8 @@ private:
     // all partitions during cluster recovery time to determine a new starting
     // id_allocator ID that is higher than any used so far.
     model::producer_id _highest_producer_id;
+    // Segments uploaded into objects shared with other partitions
+    packed_segments_map _packed_segments;
 };
 
 } // namespace cloud_storage
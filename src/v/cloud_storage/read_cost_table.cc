@@ -0,0 +1,65 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "cloud_storage/read_cost_table.h"
+
+#include <algorithm>
+
+namespace cloud_storage {
+
+namespace {
+bool more_expensive(const ts_read_cost& lhs, const ts_read_cost& rhs) {
+    return std::tie(lhs.get_requests, lhs.bytes_downloaded)
+           > std::tie(rhs.get_requests, rhs.bytes_downloaded);
+}
+} // namespace
+
+void ts_read_cost_table::add(
+  const ts_reader_key& key, const ts_read_cost& cost) {
+    if (auto it = _costs.find(key); it != _costs.end()) {
+        it->second += cost;
+        return;
+    }
+    if (_capacity == 0) {
+        return;
+    }
+    ts_read_cost inherited{};
+    if (_costs.size() >= _capacity) {
+        auto min = std::min_element(
+          _costs.begin(), _costs.end(), [](const auto& lhs, const auto& rhs) {
+              return more_expensive(rhs.second, lhs.second);
+          });
+        inherited = min->second;
+        _costs.erase(min);
+    }
+    inherited += cost;
+    _costs.emplace(key, inherited);
+}
+
+std::vector<ts_read_cost_table::entry>
+ts_read_cost_table::top(size_t limit) const {
+    std::vector<entry> res;
+    res.reserve(_costs.size());
+    for (const auto& [key, cost] : _costs) {
+        res.push_back({.key = key, .cost = cost});
+    }
+    auto n = std::min(limit, res.size());
+    std::partial_sort(
+      res.begin(),
+      res.begin() + static_cast<ptrdiff_t>(n),
+      res.end(),
+      [](const entry& lhs, const entry& rhs) {
+          return more_expensive(lhs.cost, rhs.cost);
+      });
+    res.resize(n);
+    return res;
+}
+
+} // namespace cloud_storage
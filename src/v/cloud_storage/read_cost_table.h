@@ -0,0 +1,95 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#pragma once
+
+#include "base/seastarx.h"
+#include "model/fundamental.h"
+
+#include <seastar/core/sstring.hh>
+
+#include <absl/container/node_hash_map.h>
+
+#include <chrono>
+#include <functional>
+#include <vector>
+
+namespace cloud_storage {
+
+/// The partition and the client which caused a read from object storage
+struct ts_reader_key {
+    model::ntp ntp;
+    /// Kafka client id of the reader, or its address if it has none
+    ss::sstring client;
+
+    bool operator==(const ts_reader_key&) const = default;
+
+    template<typename H>
+    friend H AbslHashValue(H h, const ts_reader_key& k) {
+        return H::combine(
+          std::move(h),
+          std::hash<model::ntp>{}(k.ntp),
+          std::hash<ss::sstring>{}(k.client));
+    }
+};
+
+/// Cost of the reads of a reader from object storage
+struct ts_read_cost {
+    uint64_t get_requests{0};
+    uint64_t bytes_downloaded{0};
+    uint64_t cache_hits{0};
+    /// Time the reader waited for segments or chunks to be hydrated
+    std::chrono::milliseconds hydration_wait{0};
+
+    ts_read_cost& operator+=(const ts_read_cost& o) {
+        get_requests += o.get_requests;
+        bytes_downloaded += o.bytes_downloaded;
+        cache_hits += o.cache_hits;
+        hydration_wait += o.hydration_wait;
+        return *this;
+    }
+};
+
+/// Attributes the cost of the reads from object storage on a shard to the
+/// partitions and clients which caused them.
+///
+/// A shard can serve many more readers than it is reasonable to track, so
+/// the table only keeps the `capacity` most expensive ones, with the
+/// space-saving algorithm: when the table is full, the reader with the
+/// fewest GET requests is replaced by the new one, which inherits its cost.
+/// The cost of the readers in the table is then overestimated by at most
+/// the GET requests of the smallest one, and the heavy hitters are never
+/// evicted.
+class ts_read_cost_table {
+public:
+    static constexpr size_t default_capacity = 256;
+
+    explicit ts_read_cost_table(size_t capacity = default_capacity)
+      : _capacity(capacity) {}
+
+    void add(const ts_reader_key& key, const ts_read_cost& cost);
+
+    struct entry {
+        ts_reader_key key;
+        ts_read_cost cost;
+    };
+
+    /// The \p limit readers with the most GET requests, then bytes
+    /// downloaded, in descending order
+    std::vector<entry> top(size_t limit) const;
+
+    size_t size() const { return _costs.size(); }
+
+private:
+    size_t _capacity;
+    absl::node_hash_map<ts_reader_key, ts_read_cost> _costs;
+};
+
+} // namespace cloud_storage
@@ -0,0 +1,71 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "cloud_storage/read_hedging.h"
+
+#include "config/configuration.h"
+
+#include <algorithm>
+
+namespace cloud_storage {
+
+read_hedging_policy::read_hedging_policy()
+  : _percentile(
+      config::shard_local_cfg().cloud_storage_hedged_read_percentile.bind())
+  , _budget_ratio(
+      config::shard_local_cfg().cloud_storage_hedged_read_budget_ratio.bind()) {
+    _samples.reserve(max_samples);
+    _percentile.watch([this] { recompute(); });
+}
+
+void read_hedging_policy::record(std::chrono::microseconds ttfb) {
+    if (_samples.size() < max_samples) {
+        _samples.push_back(ttfb);
+    } else {
+        _samples[_next] = ttfb;
+        _next = (_next + 1) % max_samples;
+    }
+    if (++_since_recompute >= recompute_interval) {
+        recompute();
+    }
+}
+
+std::optional<std::chrono::microseconds> read_hedging_policy::start_request() {
+    if (_percentile() <= 0.0) {
+        return std::nullopt;
+    }
+    _tokens = std::min(max_tokens, _tokens + _budget_ratio());
+    return _threshold;
+}
+
+bool read_hedging_policy::try_hedge() {
+    if (_tokens < 1.0) {
+        return false;
+    }
+    _tokens -= 1.0;
+    return true;
+}
+
+void read_hedging_policy::recompute() {
+    _since_recompute = 0;
+    if (_percentile() <= 0.0 || _samples.size() < min_samples) {
+        _threshold = std::nullopt;
+        return;
+    }
+    auto sorted = _samples;
+    auto ix = std::min(
+      sorted.size() - 1,
+      static_cast<size_t>(
+        static_cast<double>(sorted.size()) * _percentile() / 100.0));
+    std::nth_element(sorted.begin(), sorted.begin() + ix, sorted.end());
+    _threshold = sorted[ix];
+}
+
+} // namespace cloud_storage
@@ -0,0 +1,71 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#pragma once
+
+#include "base/seastarx.h"
+#include "config/property.h"
+
+#include <chrono>
+#include <optional>
+#include <vector>
+
+namespace cloud_storage {
+
+/// Decides when a GET request to object storage should be hedged.
+///
+/// The policy tracks the time to first byte of the recent GET requests
+/// sent to an endpoint. A request which didn't get its response within
+/// `cloud_storage_hedged_read_percentile` of them is duplicated and the
+/// first response is used. Every request adds
+/// `cloud_storage_hedged_read_budget_ratio` tokens to a budget and every
+/// hedge takes a whole one, so that an endpoint which is slow for all
+/// requests doesn't get its load multiplied.
+class read_hedging_policy {
+public:
+    /// Number of recent requests the percentile is computed over
+    static constexpr size_t max_samples = 1024;
+    /// Requests are not hedged until this many were measured
+    static constexpr size_t min_samples = 100;
+    /// Number of samples after which the percentile is recomputed
+    static constexpr size_t recompute_interval = 64;
+    /// Largest number of hedges which can be sent in a burst
+    static constexpr double max_tokens = 10.0;
+
+    read_hedging_policy();
+
+    /// Record the time to first byte of a GET request
+    void record(std::chrono::microseconds ttfb);
+
+    /// Account a new GET request. Returns the delay after which the request
+    /// should be hedged, or nullopt if hedging is disabled.
+    std::optional<std::chrono::microseconds> start_request();
+
+    /// Take a hedge from the budget. Returns false if it's exhausted.
+    bool try_hedge();
+
+    std::optional<std::chrono::microseconds> threshold() const {
+        return _threshold;
+    }
+
+private:
+    void recompute();
+
+    config::binding<double> _percentile;
+    config::binding<double> _budget_ratio;
+    /// Ring buffer of the recent samples
+    std::vector<std::chrono::microseconds> _samples;
+    size_t _next{0};
+    size_t _since_recompute{0};
+    std::optional<std::chrono::microseconds> _threshold;
+    double _tokens{0};
+};
+
+} // namespace cloud_storage
@@ -88,26 +88,31 @@ ss::future<std::vector<recovery_result>> gather_recovery_results(
   retry_chain_node& parent) {
     retry_chain_node fib{&parent};
     std::vector<recovery_result> results{};
-    auto result = co_await remote.list_objects(
-      bucket, fib, cloud_storage_clients::object_key{recovery_result_prefix});
+    auto result = co_await remote.list_objects_paged(
+      bucket,
+      fib,
+      [&results](cloud_storage_clients::client::list_bucket_result page) {
+          for (const auto& item : page.contents) {
+              std::cmatch matches;
+              if (std::regex_match(
+                    item.key.begin(), item.key.end(), matches, result_expr)) {
+                  results.emplace_back(
+                    model::topic_namespace{
+                      model::ns{matches[1].str()},
+                      model::topic{matches[2].str()}},
+                    model::partition_id{std::stoi(matches[3].str())},
+                    matches[4].str(),
+                    matches[5].str() == "true");
+              }
+          }
+          return ss::make_ready_future<ss::stop_iteration>(
+            ss::stop_iteration::no);
+      },
+      cloud_storage_clients::object_key{recovery_result_prefix});
     if (result.has_error()) {
         vlog(
           cst_log.error, "failed to list recovery results: {}", result.error());
-        co_return results;
-    }
-
-    results.reserve(result.value().contents.size());
-    for (const auto& item : result.value().contents) {
-        std::cmatch matches;
-        if (std::regex_match(
-              item.key.begin(), item.key.end(), matches, result_expr)) {
-            results.emplace_back(
-              model::topic_namespace{
-                model::ns{matches[1].str()}, model::topic{matches[2].str()}},
-              model::partition_id{std::stoi(matches[3].str())},
-              matches[4].str(),
-              matches[5].str() == "true");
-        }
+        co_return std::vector<recovery_result>{};
     }
     co_return results;
 }
@@ -10,10 +10,12 @@
 
 #include "cloud_storage/remote.h"
 
+#include "base/units.h"
 #include "bytes/iostream.h"
 #include "cloud_storage/base_manifest.h"
 #include "cloud_storage/logger.h"
 #include "cloud_storage/materialized_resources.h"
+#include "cloud_storage/segment_packer.h"
 #include "cloud_storage/types.h"
 #include "cloud_storage_clients/client_pool.h"
 #include "cloud_storage_clients/types.h"
@@ -24,6 +26,7 @@
 #include "utils/retry_chain_node.h"
 
 #include <seastar/core/abort_source.hh>
+#include <seastar/core/condition-variable.hh>
 #include <seastar/core/fstream.hh>
 #include <seastar/core/loop.hh>
 #include <seastar/core/lowres_clock.hh>
@@ -37,6 +40,7 @@
 #include <boost/range/irange.hpp>
 #include <fmt/chrono.h>
 
+#include <algorithm>
 #include <exception>
 #include <iterator>
 #include <utility>
@@ -75,6 +79,7 @@ remote::remote(
   : _pool(clients)
   , _auth_refresh_bg_op{_gate, _as, conf, cloud_credentials_source}
   , _materialized(std::make_unique<materialized_resources>())
+  , _packer(std::make_unique<segment_packer>(*this))
   , _probe(
       remote_metrics_disabled(static_cast<bool>(
         std::visit([](auto&& cfg) { return cfg.disable_metrics; }, conf))),
@@ -83,6 +88,9 @@ remote::remote(
       *_materialized)
   , _azure_shared_key_binding(
       config::shard_local_cfg().cloud_storage_azure_shared_key.bind())
+  , _scrubber_rate(config::shard_local_cfg()
+                     .cloud_storage_scrubbing_max_requests_per_sec.bind())
+  , _scrubber_budget(_scrubber_rate(), "cst/scrubber")
   , _cloud_storage_backend{
       cloud_storage_clients::infer_backend_from_configuration(
         conf, cloud_credentials_source)} {
@@ -98,6 +106,9 @@ remote::remote(
           _auth_refresh_bg_op.build_static_credentials());
     }
 
+    _scrubber_rate.watch(
+      [this] { _scrubber_budget.update_rate(_scrubber_rate()); });
+
     _azure_shared_key_binding.watch([this] {
         auto current_config = _auth_refresh_bg_op.get_client_config();
         if (!std::holds_alternative<cloud_storage_clients::abs_configuration>(
@@ -162,6 +173,8 @@ ss::future<> remote::start() {
 ss::future<> remote::stop() {
     cst_log.debug("Stopping remote...");
     _as.request_abort();
+    _scrubber_budget.shutdown();
+    co_await _packer->stop();
     co_await _materialized->stop();
     co_await _gate.close();
     co_await _auth_refresh_bg_op.stop();
@@ -633,6 +646,18 @@ ss::future<upload_result> remote::upload_segment(
   const reset_input_stream& reset_str,
   retry_chain_node& parent,
   lazy_abort_source& lazy_abort_source) {
+    const uint64_t part_size
+      = config::shard_local_cfg().cloud_storage_multipart_upload_part_size();
+    if (part_size > 0 && content_length > part_size) {
+        return upload_segment_multipart(
+          bucket,
+          segment_path,
+          content_length,
+          part_size,
+          reset_str,
+          parent,
+          lazy_abort_source);
+    }
     return upload_stream(
       bucket,
       segment_path,
@@ -647,6 +672,456 @@ ss::future<upload_result> remote::upload_segment(
       [this] { _probe.upload_backoff(); });
 }
 
+template<typename RequestFn>
+ss::future<upload_result> remote::multipart_request(
+  const cloud_storage_clients::bucket_name& bucket,
+  const cloud_storage_clients::object_key& key,
+  std::string_view request_label,
+  retry_chain_node& parent,
+  lazy_abort_source& lazy_abort_source,
+  RequestFn request) {
+    retry_chain_node fib(&parent);
+    retry_chain_logger ctxlog(cst_log, fib);
+    auto permit = fib.retry();
+    while (!_gate.is_closed() && permit.is_allowed) {
+        auto lease = co_await _pool.local().acquire(fib.root_abort_source());
+        if (lazy_abort_source.abort_requested()) {
+            vlog(
+              ctxlog.warn,
+              "{}: cancelled {} of {} to {}",
+              lazy_abort_source.abort_reason(),
+              request_label,
+              key,
+              bucket);
+            co_return upload_result::cancelled;
+        }
+
+        auto res = co_await request(*lease.client, fib.get_timeout());
+        if (res) {
+            co_return upload_result::success;
+        }
+
+        lease.client->shutdown();
+        switch (res.error()) {
+        case cloud_storage_clients::error_outcome::retry:
+            vlog(
+              ctxlog.debug,
+              "{} of {} to {}, {} backoff required",
+              request_label,
+              key,
+              bucket,
+              std::chrono::duration_cast<std::chrono::milliseconds>(
+                permit.delay));
+            _probe.upload_backoff();
+            if (!lazy_abort_source.abort_requested()) {
+                co_await ss::sleep_abortable(
+                  permit.delay, fib.root_abort_source());
+            }
+            permit = fib.retry();
+            break;
+        case cloud_storage_clients::error_outcome::key_not_found:
+            // not expected during upload
+            [[fallthrough]];
+        case cloud_storage_clients::error_outcome::fail:
+            vlog(
+              ctxlog.warn, "{} of {} to {} failed", request_label, key, bucket);
+            co_return upload_result::failed;
+        }
+    }
+    vlog(
+      ctxlog.warn,
+      "{} of {} to {}, backoff quota exceded",
+      request_label,
+      key,
+      bucket);
+    co_return upload_result::timedout;
+}
+
+ss::future<upload_result> remote::upload_part(
+  cloud_storage_clients::bucket_name bucket,
+  cloud_storage_clients::object_key key,
+  ss::sstring upload_id,
+  uint32_t part_number,
+  iobuf data,
+  cloud_storage_clients::client::multipart_upload_part& part,
+  retry_chain_node& parent,
+  lazy_abort_source& lazy_abort_source) {
+    // retries send the buffered part again, the rest of the segment is not
+    // read again
+    co_return co_await multipart_request(
+      bucket,
+      key,
+      "UploadPart",
+      parent,
+      lazy_abort_source,
+      [&](auto& client, auto timeout) {
+          return client
+            .upload_part(
+              bucket,
+              key,
+              upload_id,
+              part_number,
+              data.size_bytes(),
+              make_iobuf_input_stream(data.share(0, data.size_bytes())),
+              timeout)
+            .then([&part](auto res) {
+                if (res) {
+                    part = res.value();
+                }
+                return res;
+            });
+      });
+}
+
+ss::future<upload_result> remote::upload_segment_multipart(
+  const cloud_storage_clients::bucket_name& bucket,
+  const remote_segment_path& segment_path,
+  uint64_t content_length,
+  uint64_t part_size,
+  const reset_input_stream& reset_str,
+  retry_chain_node& parent,
+  lazy_abort_source& lazy_abort_source) {
+    using multipart_upload_part
+      = cloud_storage_clients::client::multipart_upload_part;
+
+    auto guard = _gate.hold();
+    retry_chain_node fib(&parent);
+    retry_chain_logger ctxlog(cst_log, fib);
+    auto key = cloud_storage_clients::object_key(segment_path());
+    const auto num_parts = static_cast<uint32_t>(
+      (content_length + part_size - 1) / part_size);
+    vlog(
+      ctxlog.debug,
+      "Uploading segment to path {}, length {}, in {} parts",
+      segment_path,
+      content_length,
+      num_parts);
+
+    notify_external_subscribers(
+      api_activity_notification{
+        .type = api_activity_type::segment_upload, .is_retry = false},
+      parent);
+
+    ss::sstring upload_id;
+    auto result = co_await multipart_request(
+      bucket,
+      key,
+      "CreateMultipartUpload",
+      fib,
+      lazy_abort_source,
+      [&](auto& client, auto timeout) {
+          return client.initiate_multipart_upload(bucket, key, timeout)
+            .then([&upload_id](auto res) {
+                if (res) {
+                    upload_id = res.value();
+                }
+                return res;
+            });
+      });
+    if (result != upload_result::success) {
+        _probe.failed_upload();
+        co_return result;
+    }
+
+    // The parts are read in order from a single stream and buffered until
+    // they're sent, so that the memory is bounded by the parallelism.
+    ssx::semaphore parallelism{
+      config::shard_local_cfg().cloud_storage_multipart_upload_parallelism(),
+      "cst/multipart"};
+    std::vector<multipart_upload_part> parts(num_parts);
+    std::vector<upload_result> part_results(
+      num_parts, upload_result::success);
+    ss::gate parts_gate;
+    auto reader_handle = co_await reset_str();
+    auto stream = reader_handle->take_stream();
+    try {
+        for (uint32_t i = 0; i < num_parts; ++i) {
+            auto units = co_await ss::get_units(parallelism, 1);
+            if (std::ranges::any_of(part_results, [](upload_result r) {
+                    return r != upload_result::success;
+                })) {
+                break;
+            }
+            const auto size = std::min(
+              part_size, content_length - uint64_t{i} * part_size);
+            auto data = co_await read_iobuf_exactly(stream, size);
+            if (data.size_bytes() != size) {
+                vlog(
+                  ctxlog.error,
+                  "Segment {} is shorter than its length {}",
+                  segment_path,
+                  content_length);
+                part_results[i] = upload_result::failed;
+                break;
+            }
+            ssx::spawn_with_gate(
+              parts_gate,
+              [this,
+               &bucket,
+               &key,
+               &upload_id,
+               &parts,
+               &part_results,
+               &fib,
+               &lazy_abort_source,
+               i,
+               data = std::move(data),
+               units = std::move(units)]() mutable {
+                  return upload_part(
+                           bucket,
+                           key,
+                           upload_id,
+                           i + 1,
+                           std::move(data),
+                           parts[i],
+                           fib,
+                           lazy_abort_source)
+                    .handle_exception([](const std::exception_ptr&) {
+                        return upload_result::failed;
+                    })
+                    .then([&part_results, i, u = std::move(units)](
+                            upload_result r) { part_results[i] = r; });
+              });
+        }
+    } catch (...) {
+        vlog(
+          ctxlog.warn,
+          "Failed to read segment {}: {}",
+          segment_path,
+          std::current_exception());
+        part_results.front() = upload_result::failed;
+    }
+    co_await parts_gate.close();
+    co_await stream.close();
+    co_await reader_handle->close();
+
+    auto failed = std::ranges::find_if(part_results, [](upload_result r) {
+        return r != upload_result::success;
+    });
+    if (failed == part_results.end()) {
+        result = co_await multipart_request(
+          bucket,
+          key,
+          "CompleteMultipartUpload",
+          fib,
+          lazy_abort_source,
+          [&](auto& client, auto timeout) {
+              return client.complete_multipart_upload(
+                bucket, key, upload_id, parts, timeout);
+          });
+    } else {
+        result = *failed;
+    }
+    if (result == upload_result::success) {
+        _probe.successful_upload();
+        _probe.register_upload_size(content_length);
+        co_return result;
+    }
+
+    _probe.failed_upload();
+    vlog(
+      ctxlog.warn,
+      "Multipart upload of segment {} to {} failed: {}, aborting it",
+      segment_path,
+      bucket,
+      result);
+    // the parts are dropped by the lifecycle of the bucket if this fails
+    co_await multipart_request(
+      bucket,
+      key,
+      "AbortMultipartUpload",
+      fib,
+      lazy_abort_source,
+      [&](auto& client, auto timeout) {
+          return client.abort_multipart_upload(
+            bucket, key, upload_id, timeout);
+      });
+    co_return result;
+}
+
+// Every part of a multipart upload but the last one has to be at least this
+// large.
+static constexpr uint64_t min_multipart_part_size = 5_MiB;
+
+ss::future<upload_result> remote::compose_segment(
+  const cloud_storage_clients::bucket_name& bucket,
+  const remote_segment_path& segment_path,
+  const std::vector<compose_source>& sources,
+  retry_chain_node& parent,
+  lazy_abort_source& lazy_abort_source) {
+    using multipart_upload_part
+      = cloud_storage_clients::client::multipart_upload_part;
+
+    auto guard = _gate.hold();
+    retry_chain_node fib(&parent);
+    retry_chain_logger ctxlog(cst_log, fib);
+    auto key = cloud_storage_clients::object_key(segment_path());
+    vlog(
+      ctxlog.debug,
+      "Composing segment {} out of {} objects",
+      segment_path,
+      sources.size());
+
+    notify_external_subscribers(
+      api_activity_notification{
+        .type = api_activity_type::segment_upload, .is_retry = false},
+      parent);
+
+    ss::sstring upload_id;
+    auto result = co_await multipart_request(
+      bucket,
+      key,
+      "CreateMultipartUpload",
+      fib,
+      lazy_abort_source,
+      [&](auto& client, auto timeout) {
+          return client.initiate_multipart_upload(bucket, key, timeout)
+            .then([&upload_id](auto res) {
+                if (res) {
+                    upload_id = res.value();
+                }
+                return res;
+            });
+      });
+    if (result != upload_result::success) {
+        _probe.failed_upload();
+        co_return result;
+    }
+
+    // Small sources are downloaded and sent as regular parts once they add
+    // up to the minimal part size. A source is only copied when nothing is
+    // pending before it, so that the order of the data is kept.
+    std::vector<multipart_upload_part> parts;
+    iobuf pending;
+    uint64_t content_length = 0;
+    try {
+        for (size_t i = 0; i < sources.size(); ++i) {
+            const auto& src = sources[i];
+            const bool last = i + 1 == sources.size();
+            const auto part_number = static_cast<uint32_t>(parts.size() + 1);
+            content_length += src.size_bytes;
+            if (
+              pending.empty() && !src.byte_range.has_value()
+              && (src.size_bytes >= min_multipart_part_size || last)) {
+                auto& part = parts.emplace_back();
+                result = co_await multipart_request(
+                  bucket,
+                  key,
+                  "UploadPartCopy",
+                  fib,
+                  lazy_abort_source,
+                  [&](auto& client, auto timeout) {
+                      return client
+                        .upload_part_copy(
+                          bucket,
+                          key,
+                          upload_id,
+                          part_number,
+                          cloud_storage_clients::object_key(src.path()),
+                          timeout)
+                        .then([&part](auto res) {
+                            if (res) {
+                                part = res.value();
+                            }
+                            return res;
+                        });
+                  });
+                if (result != upload_result::success) {
+                    break;
+                }
+                continue;
+            }
+
+            iobuf data;
+            auto consume = [&data](uint64_t len, ss::input_stream<char> in) {
+                return ss::do_with(
+                  std::move(in), [&data, len](ss::input_stream<char>& in) {
+                      return read_iobuf_exactly(in, len)
+                        .then([&data](iobuf buf) {
+                            data = std::move(buf);
+                            return data.size_bytes();
+                        })
+                        .finally([&in] { return in.close(); });
+                  });
+            };
+            auto dl = co_await download_segment(
+              bucket, src.path, consume, fib, src.byte_range);
+            if (
+              dl != download_result::success
+              || data.size_bytes() != src.size_bytes) {
+                vlog(
+                  ctxlog.warn,
+                  "Failed to download {} to compose segment {}: {}",
+                  src.path,
+                  segment_path,
+                  dl);
+                result = upload_result::failed;
+                break;
+            }
+            pending.append(std::move(data));
+            if (pending.size_bytes() >= min_multipart_part_size || last) {
+                auto& part = parts.emplace_back();
+                result = co_await upload_part(
+                  bucket,
+                  key,
+                  upload_id,
+                  part_number,
+                  std::exchange(pending, iobuf{}),
+                  part,
+                  fib,
+                  lazy_abort_source);
+                if (result != upload_result::success) {
+                    break;
+                }
+            }
+        }
+    } catch (...) {
+        vlog(
+          ctxlog.warn,
+          "Failed to compose segment {}: {}",
+          segment_path,
+          std::current_exception());
+        result = upload_result::failed;
+    }
+
+    if (result == upload_result::success) {
+        result = co_await multipart_request(
+          bucket,
+          key,
+          "CompleteMultipartUpload",
+          fib,
+          lazy_abort_source,
+          [&](auto& client, auto timeout) {
+              return client.complete_multipart_upload(
+                bucket, key, upload_id, parts, timeout);
+          });
+    }
+    if (result == upload_result::success) {
+        _probe.successful_upload();
+        _probe.register_upload_size(content_length);
+        co_return result;
+    }
+
+    _probe.failed_upload();
+    vlog(
+      ctxlog.warn,
+      "Composing segment {} in {} failed: {}, aborting it",
+      segment_path,
+      bucket,
+      result);
+    co_await multipart_request(
+      bucket,
+      key,
+      "AbortMultipartUpload",
+      fib,
+      lazy_abort_source,
+      [&](auto& client, auto timeout) {
+          return client.abort_multipart_upload(
+            bucket, key, upload_id, timeout);
+      });
+    co_return result;
+}
+
 ss::future<download_result> remote::download_stream(
   const cloud_storage_clients::bucket_name& bucket,
   const remote_segment_path& path,
@@ -687,6 +1162,112 @@ ss::future<download_result> remote::download_segment(
       byte_range);
 }
 
+struct remote::get_object_race {
+    /// The first response, along with the lease of its client
+    std::optional<std::pair<get_object_result, client_lease>> winner;
+    /// Clients of the requests in flight
+    std::vector<cloud_storage_clients::client_pool::http_client_ptr> clients;
+    ss::condition_variable cvar;
+};
+
+ss::future<std::pair<remote::get_object_result, remote::client_lease>>
+remote::hedged_get_object(
+  client_lease lease,
+  const cloud_storage_clients::bucket_name& bucket,
+  const cloud_storage_clients::object_key& path,
+  ss::lowres_clock::duration timeout,
+  std::optional<cloud_storage_clients::http_byte_range> byte_range,
+  ss::abort_source& as) {
+    auto& policy = _probe.read_hedging();
+    auto delay = policy.start_request();
+    if (!delay.has_value()) {
+        auto start = std::chrono::steady_clock::now();
+        auto resp = co_await lease.client->get_object(
+          bucket, path, timeout, false, byte_range);
+        if (resp) {
+            policy.record(
+              std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - start));
+        }
+        co_return std::make_pair(std::move(resp), std::move(lease));
+    }
+
+    auto race = ss::make_lw_shared<get_object_race>();
+    auto send = [&](client_lease l, bool hedge) {
+        race->clients.push_back(l.client);
+        ssx::spawn_with_gate(
+          _gate,
+          [this,
+           race,
+           l = std::move(l),
+           bucket,
+           path,
+           timeout,
+           byte_range,
+           hedge]() mutable {
+              return race_get_object(
+                race, std::move(l), bucket, path, timeout, byte_range, hedge);
+          });
+    };
+    auto has_winner = [&race] { return race->winner.has_value(); };
+
+    send(std::move(lease), false);
+    try {
+        co_await race->cvar.wait(*delay, has_winner);
+    } catch (const ss::condition_variable_timed_out&) {
+    }
+    if (!has_winner() && _pool.local().size() > 0 && policy.try_hedge()) {
+        auto hedge_lease = co_await _pool.local().acquire(as);
+        if (!has_winner()) {
+            _probe.hedged_download();
+            send(std::move(hedge_lease), true);
+        }
+    }
+    co_await race->cvar.wait(has_winner);
+    co_return std::move(*race->winner);
+}
+
+ss::future<> remote::race_get_object(
+  ss::lw_shared_ptr<get_object_race> race,
+  client_lease lease,
+  cloud_storage_clients::bucket_name bucket,
+  cloud_storage_clients::object_key path,
+  ss::lowres_clock::duration timeout,
+  std::optional<cloud_storage_clients::http_byte_range> byte_range,
+  bool hedge) {
+    auto start = std::chrono::steady_clock::now();
+    get_object_result resp = cloud_storage_clients::error_outcome::retry;
+    try {
+        resp = co_await lease.client->get_object(
+          bucket, path, timeout, false, byte_range);
+    } catch (...) {
+        resp = cloud_storage_clients::util::handle_client_transport_error(
+          std::current_exception(), cst_log);
+    }
+    std::erase(race->clients, lease.client);
+    if (race->winner.has_value() || (!resp && !race->clients.empty())) {
+        // Either the other request responded first, or this one failed and
+        // the other one may still succeed.
+        lease.client->shutdown();
+        co_return;
+    }
+    if (resp) {
+        _probe.read_hedging().record(
+          std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start));
+        if (hedge) {
+            _probe.hedged_download_win();
+        }
+    }
+    // The request which lost the race is aborted, its fiber returns the
+    // lease to the pool.
+    for (auto& client : race->clients) {
+        client->shutdown();
+    }
+    race->winner.emplace(std::move(resp), std::move(lease));
+    race->cvar.broadcast();
+}
+
 template<
   typename DownloadLatencyMeasurementFn,
   typename FailedDownloadMetricFn,
@@ -728,8 +1309,14 @@ ss::future<download_result> remote::download_stream(
           parent);
 
         auto download_latency_measure = download_latency_measurement();
-        auto resp = co_await lease.client->get_object(
-          bucket, path, fib.get_timeout(), false, byte_range);
+        auto [resp, winner] = co_await hedged_get_object(
+          std::move(lease),
+          bucket,
+          path,
+          fib.get_timeout(),
+          byte_range,
+          fib.root_abort_source());
+        lease = std::move(winner);
 
         if (resp) {
             vlog(ctxlog.debug, "Receive OK response from {}", path);
@@ -1322,6 +1909,50 @@ ss::future<remote::list_result> remote::list_objects(
   retry_chain_node& parent,
   std::optional<cloud_storage_clients::object_key> prefix,
   std::optional<char> delimiter,
+  std::optional<cloud_storage_clients::client::item_filter> item_filter) {
+    // Gathers the items from a series of successful ListObjectsV2 calls
+    cloud_storage_clients::client::list_bucket_result list_bucket_result;
+
+    auto res = co_await list_objects_paged(
+      bucket,
+      parent,
+      [&list_bucket_result](
+        cloud_storage_clients::client::list_bucket_result page) {
+          std::copy(
+            std::make_move_iterator(page.contents.begin()),
+            std::make_move_iterator(page.contents.end()),
+            std::back_inserter(list_bucket_result.contents));
+
+          // Move common prefixes to the result, only if they have not been
+          // copied yet. These values will remain the same during pagination
+          // of list call results, so they should only be copied once.
+          if (
+            list_bucket_result.common_prefixes.empty()
+            && !page.common_prefixes.empty()) {
+              list_bucket_result.common_prefixes = std::move(
+                page.common_prefixes);
+          }
+
+          list_bucket_result.prefix = std::move(page.prefix);
+          return ss::make_ready_future<ss::stop_iteration>(
+            ss::stop_iteration::no);
+      },
+      std::move(prefix),
+      delimiter,
+      std::move(item_filter));
+    if (res.has_error()) {
+        co_return res.error();
+    }
+    co_return list_bucket_result;
+}
+
+ss::future<result<void, cloud_storage_clients::error_outcome>>
+remote::list_objects_paged(
+  const cloud_storage_clients::bucket_name& bucket,
+  retry_chain_node& parent,
+  list_page_consumer consumer,
+  std::optional<cloud_storage_clients::object_key> prefix,
+  std::optional<char> delimiter,
   std::optional<cloud_storage_clients::client::item_filter> item_filter) {
     ss::gate::holder gh{_gate};
     retry_chain_node fib(&parent);
@@ -1329,14 +1960,10 @@ ss::future<remote::list_result> remote::list_objects(
     auto lease = co_await _pool.local().acquire(fib.root_abort_source());
     auto permit = fib.retry();
     vlog(ctxlog.debug, "List objects {}", bucket);
-    std::optional<list_result> result;
+    std::optional<cloud_storage_clients::error_outcome> result;
 
-    bool items_remaining = true;
     std::optional<ss::sstring> continuation_token = std::nullopt;
 
-    // Gathers the items from a series of successful ListObjectsV2 calls
-    cloud_storage_clients::client::list_bucket_result list_bucket_result;
-
     // Keep iterating while the ListObjectsV2 calls has more items to return
     while (!_gate.is_closed() && permit.is_allowed && !result) {
         auto res = co_await lease.client->list_objects(
@@ -1350,36 +1977,21 @@ ss::future<remote::list_result> remote::list_objects(
           item_filter);
 
         if (res) {
-            auto list_result = res.value();
+            auto& page = res.value();
             // Successful call, prepare for future calls by getting
             // continuation_token if result was truncated
-            items_remaining = list_result.is_truncated;
-            continuation_token.emplace(list_result.next_continuation_token);
-            std::copy(
-              std::make_move_iterator(list_result.contents.begin()),
-              std::make_move_iterator(list_result.contents.end()),
-              std::back_inserter(list_bucket_result.contents));
-
-            // Move common prefixes to the result, only if they have not been
-            // copied yet. These values will remain the same during pagination
-            // of list call results, so they should only be copied once.
-            if (
-              list_bucket_result.common_prefixes.empty()
-              && !list_result.common_prefixes.empty()) {
-                std::copy(
-                  std::make_move_iterator(list_result.common_prefixes.begin()),
-                  std::make_move_iterator(list_result.common_prefixes.end()),
-                  std::back_inserter(list_bucket_result.common_prefixes));
-            }
+            bool items_remaining = page.is_truncated;
+            continuation_token.emplace(
+              std::move(page.next_continuation_token));
 
-            list_bucket_result.prefix = list_result.prefix;
+            auto stop = co_await consumer(std::move(page));
 
             // Continue to list the remaining items
-            if (items_remaining) {
+            if (items_remaining && stop == ss::stop_iteration::no) {
                 continue;
             }
 
-            co_return list_bucket_result;
+            co_return outcome::success();
         }
 
         lease.client->shutdown();
@@ -1415,7 +2027,7 @@ ss::future<remote::list_result> remote::list_objects(
           ctxlog.warn,
           "ListObjectsV2 {}, unexpected error: {}",
           bucket,
-          result->error());
+          *result);
     }
     co_return *result;
 }
@@ -24,10 +24,12 @@
 #include "model/metadata.h"
 #include "random/simple_time_jitter.h"
 #include "utils/retry_chain_node.h"
+#include "utils/token_bucket.h"
 
 #include <seastar/core/abort_source.hh>
 #include <seastar/core/gate.hh>
 #include <seastar/core/loop.hh>
+#include <seastar/core/shared_ptr.hh>
 
 #include <ranges>
 #include <utility>
@@ -35,6 +37,7 @@
 namespace cloud_storage {
 
 class materialized_resources;
+class segment_packer;
 
 /// \brief Predicate required to continue operation
 ///
@@ -304,6 +307,30 @@ public:
       retry_chain_node& parent,
       lazy_abort_source& lazy_abort_source);
 
+    /// Object of the bucket which is a part of a composed segment
+    struct compose_source {
+        /// Name of the object, the shared object for packed segments
+        remote_segment_path path;
+        uint64_t size_bytes{0};
+        /// Range of the object with the data, set for packed segments
+        std::optional<cloud_storage_clients::http_byte_range> byte_range;
+    };
+
+    /// \brief Create a segment out of the concatenation of existing objects
+    ///
+    /// The segment is assembled by a multipart upload. Sources of at least
+    /// the minimal part size are copied by the storage service with
+    /// UploadPartCopy, smaller ones are downloaded and coalesced into
+    /// regular parts, since every part but the last one has to be at least
+    /// 5 MiB.
+    /// \param sources are the objects to concatenate, in order
+    ss::future<upload_result> compose_segment(
+      const cloud_storage_clients::bucket_name& bucket,
+      const remote_segment_path& segment_path,
+      const std::vector<compose_source>& sources,
+      retry_chain_node& parent,
+      lazy_abort_source& lazy_abort_source);
+
     /// \brief Download segment from S3
     ///
     /// The method downloads the segment while tolerating some errors. It can
@@ -434,6 +461,36 @@ public:
       std::optional<cloud_storage_clients::client::item_filter> item_filter
       = std::nullopt) override;
 
+    /// Consumer of the pages of a listing. Returning stop_iteration::yes
+    /// ends the listing.
+    using list_page_consumer
+      = ss::noncopyable_function<ss::future<ss::stop_iteration>(
+        cloud_storage_clients::client::list_bucket_result)>;
+
+    /// \brief Lists objects in a bucket one page at a time
+    ///
+    /// Every page is handed to \p consumer as soon as it's received, so that
+    /// listing a large bucket only holds a single page in memory. Failed
+    /// requests are retried from the last page received.
+    ///
+    /// \param name The bucket to list
+    /// \param parent The retry chain node to manage timeouts
+    /// \param consumer The consumer of the pages
+    /// \param prefix Optional prefix to restrict listing of objects
+    /// \param delimiter A character to use as a delimiter when grouping list
+    /// results
+    /// \param item_filter Optional filter to apply to items before
+    /// collecting
+    ss::future<result<void, cloud_storage_clients::error_outcome>>
+    list_objects_paged(
+      const cloud_storage_clients::bucket_name& name,
+      retry_chain_node& parent,
+      list_page_consumer consumer,
+      std::optional<cloud_storage_clients::object_key> prefix = std::nullopt,
+      std::optional<char> delimiter = std::nullopt,
+      std::optional<cloud_storage_clients::client::item_filter> item_filter
+      = std::nullopt);
+
     /// \brief Upload small objects to bucket. Suitable for uploading simple
     /// strings, does not check for leadership before upload like the segment
     /// upload function.
@@ -449,6 +506,13 @@ public:
 
     materialized_resources& materialized() { return *_materialized; }
 
+    /// Packer of the small segments uploaded by the partitions of the shard
+    segment_packer& packer() { return *_packer; }
+
+    /// Requests budget shared by the scrubbers of the partitions of the
+    /// shard, one token per request
+    token_bucket<>& scrubber_budget() { return _scrubber_budget; }
+
     /// Event filter class.
     ///
     /// The filter can be used to subscribe to subset of events.
@@ -528,6 +592,70 @@ private:
       SuccessfulUploadMetricFn successful_upload_metric,
       UploadBackoffMetricFn upload_backoff_metric);
 
+    /// Upload the segment in parts of \p part_size read from a single
+    /// stream. Up to `cloud_storage_multipart_upload_parallelism` parts are
+    /// buffered and sent at once, and every part is retried on its own.
+    ss::future<upload_result> upload_segment_multipart(
+      const cloud_storage_clients::bucket_name& bucket,
+      const remote_segment_path& segment_path,
+      uint64_t content_length,
+      uint64_t part_size,
+      const reset_input_stream& reset_str,
+      retry_chain_node& parent,
+      lazy_abort_source& lazy_abort_source);
+
+    /// Upload a single part of a multipart upload, with retries
+    ss::future<upload_result> upload_part(
+      cloud_storage_clients::bucket_name bucket,
+      cloud_storage_clients::object_key key,
+      ss::sstring upload_id,
+      uint32_t part_number,
+      iobuf data,
+      cloud_storage_clients::client::multipart_upload_part& part,
+      retry_chain_node& parent,
+      lazy_abort_source& lazy_abort_source);
+
+    /// Send a request of a multipart upload until it succeeds, fails or
+    /// runs out of retries. \p request is invoked with a client and the
+    /// timeout of every attempt.
+    template<typename RequestFn>
+    ss::future<upload_result> multipart_request(
+      const cloud_storage_clients::bucket_name& bucket,
+      const cloud_storage_clients::object_key& key,
+      std::string_view request_label,
+      retry_chain_node& parent,
+      lazy_abort_source& lazy_abort_source,
+      RequestFn request);
+
+    using client_lease = cloud_storage_clients::client_pool::client_lease;
+    using get_object_result = result<
+      http::client::response_stream_ref,
+      cloud_storage_clients::error_outcome>;
+    struct get_object_race;
+
+    /// Send a GET request with the client of \p lease. If it doesn't respond
+    /// within the threshold of the read hedging policy, a duplicate is sent
+    /// with another client of the pool. Returns the first response along
+    /// with the lease of the client which received it, the other request is
+    /// dropped in the background.
+    ss::future<std::pair<get_object_result, client_lease>> hedged_get_object(
+      client_lease lease,
+      const cloud_storage_clients::bucket_name& bucket,
+      const cloud_storage_clients::object_key& path,
+      ss::lowres_clock::duration timeout,
+      std::optional<cloud_storage_clients::http_byte_range> byte_range,
+      ss::abort_source& as);
+
+    /// One of the GET requests of a hedged read
+    ss::future<> race_get_object(
+      ss::lw_shared_ptr<get_object_race> race,
+      client_lease lease,
+      cloud_storage_clients::bucket_name bucket,
+      cloud_storage_clients::object_key path,
+      ss::lowres_clock::duration timeout,
+      std::optional<cloud_storage_clients::http_byte_range> byte_range,
+      bool hedge);
+
     template<
       typename DownloadLatencyMeasurementFn,
       typename FailedDownloadMetricFn,
@@ -574,6 +702,7 @@ private:
     ss::abort_source _as;
     auth_refresh_bg_op _auth_refresh_bg_op;
     std::unique_ptr<materialized_resources> _materialized;
+    std::unique_ptr<segment_packer> _packer;
 
     // Lifetime: probe has reference to _materialized, must be destroyed after
     remote_probe _probe;
@@ -582,6 +711,9 @@ private:
 
     config::binding<std::optional<ss::sstring>> _azure_shared_key_binding;
 
+    config::binding<size_t> _scrubber_rate;
+    token_bucket<> _scrubber_budget;
+
     model::cloud_storage_backend _cloud_storage_backend;
 };
 
@@ -57,7 +57,8 @@ using storage_t = model::record_batch_reader::storage_t;
 remote_partition::iterator remote_partition::get_or_materialize_segment(
   const remote_segment_path& path,
   const segment_meta& meta,
-  segment_units unit) {
+  segment_units unit,
+  std::optional<packed_segment_location> packed) {
     _as.check();
 
     if (auto iter = _segments.find(meta.base_offset); iter != _segments.end()) {
@@ -71,7 +72,7 @@ remote_partition::iterator remote_partition::get_or_materialize_segment(
     }
 
     auto st = std::make_unique<materialized_segment_state>(
-      meta, path, *this, std::move(unit));
+      meta, path, *this, std::move(unit), std::move(packed));
     auto [new_iter, ok] = _segments.insert(
       std::make_pair(meta.base_offset, std::move(st)));
 
@@ -198,7 +199,11 @@ remote_partition::borrow_result_t remote_partition::borrow_next_segment_reader(
     }
     if (iter == _segments.end()) {
         auto path = manifest.generate_segment_path(*mit);
-        iter = get_or_materialize_segment(path, *mit, std::move(segment_unit));
+        iter = get_or_materialize_segment(
+          path,
+          *mit,
+          std::move(segment_unit),
+          manifest.packed_segment(mit->base_offset));
     }
     auto mit_committed_offset = mit->committed_offset;
     auto next_it = std::next(std::move(mit));
@@ -222,6 +227,45 @@ remote_partition::borrow_result_t remote_partition::borrow_next_segment_reader(
       .next_segment_offset = next_offset};
 }
 
+void remote_partition::maybe_prefetch_segment_index(
+  const partition_manifest& manifest, model::offset base_offset) {
+    if (
+      config::shard_local_cfg().cloud_storage_chunk_prefetch_max() == 0
+      || base_offset == model::offset{} || _segments.contains(base_offset)) {
+        return;
+    }
+    auto mit = manifest.find(base_offset);
+    // Segments without an index are hydrated in full by their first reader.
+    if (
+      mit == manifest.end() || mit->sname_format <= segment_name_format::v2
+      || manifest.packed_segment(base_offset).has_value()) {
+        return;
+    }
+    ssx::spawn_with_gate(
+      _gate,
+      [this, path = manifest.generate_segment_path(*mit), meta = *mit] {
+          return prefetch_segment_index(path, meta);
+      });
+}
+
+ss::future<> remote_partition::prefetch_segment_index(
+  remote_segment_path path, segment_meta meta) {
+    auto unit = co_await materialized().get_segment_units(_as);
+    auto it = get_or_materialize_segment(path, meta, std::move(unit));
+    auto segment = it->second->segment;
+    vlog(_ctxlog.debug, "prefetching index of segment {}", path);
+    try {
+        co_await segment->hydrate(_as);
+    } catch (...) {
+        // The reader of the segment hydrates the index on its own.
+        vlog(
+          _ctxlog.debug,
+          "failed to prefetch index of segment {}: {}",
+          path,
+          std::current_exception());
+    }
+}
+
 class partition_record_batch_reader_impl final
   : public model::record_batch_reader::impl {
 public:
@@ -273,6 +317,10 @@ public:
         auto ntp = _partition->get_ntp();
         vlog(_ctxlog.trace, "Destructing reader {}", ntp);
         _partition->_ts_probe.reader_destroyed();
+        if (_view_cursor) {
+            _partition->_manifest_view->release_cursor(
+              std::move(_view_cursor));
+        }
         if (_seg_reader) {
             // We must not destroy this reader: it is not safe to do so
             // without calling stop() on it.  The remote_partition is
@@ -801,6 +849,10 @@ private:
                     _next_segment_base_offset);
                 _next_segment_base_offset = new_next_offset;
                 _seg_reader = std::move(new_reader);
+                if (_seg_reader) {
+                    _partition->maybe_prefetch_segment_index(
+                      maybe_manifest.value(), _next_segment_base_offset);
+                }
             }
             if (maybe_manifest.has_value() && _seg_reader != nullptr) {
                 vassert(
@@ -1024,7 +1076,10 @@ remote_partition::aborted_transactions(offset_range offsets) {
               std::nullopt);
             auto path = stm_manifest.generate_segment_path(*it);
             auto m = get_or_materialize_segment(
-              path, *it, std::move(segment_unit));
+              path,
+              *it,
+              std::move(segment_unit),
+              stm_manifest.packed_segment(it->base_offset));
             remote_segs.emplace_back(m->second->segment);
         }
         for (const auto& segment : remote_segs) {
@@ -1034,7 +1089,10 @@ remote_partition::aborted_transactions(offset_range offsets) {
         }
     } else {
         // Target archive section of the log
-        std::deque<std::pair<segment_meta, remote_segment_path>>
+        std::deque<std::tuple<
+          segment_meta,
+          remote_segment_path,
+          std::optional<packed_segment_location>>>
           meta_to_materialize;
 
         meta_to_materialize.clear();
@@ -1063,16 +1121,17 @@ remote_partition::aborted_transactions(offset_range offsets) {
                       return ss::stop_iteration::yes;
                   }
                   auto path = manifest->generate_segment_path(*it);
-                  meta_to_materialize.emplace_back(*it, path);
+                  meta_to_materialize.emplace_back(
+                    *it, path, manifest->packed_segment(it->base_offset));
               }
               return ss::stop_iteration::no;
           });
 
-        for (const auto& [meta, path] : meta_to_materialize) {
+        for (const auto& [meta, path, packed] : meta_to_materialize) {
             auto segment_unit = co_await materialized().get_segment_units(
               std::nullopt);
             auto m = get_or_materialize_segment(
-              path, meta, std::move(segment_unit));
+              path, meta, std::move(segment_unit), packed);
             auto tx = co_await m->second->segment->aborted_transactions(
               offsets.begin_rp, offsets.end_rp);
             std::copy(tx.begin(), tx.end(), std::back_inserter(result));
@@ -211,11 +211,23 @@ private:
       segment_reader_units segment_reader_unit,
       model::offset hint = {});
 
-    /// Materialize a new segment or grab one if it already exists
+    /// Materialize a new segment or grab one if it already exists. The data
+    /// of a segment packed into a shared object is read from \p packed.
     /// @return iterator that points a materialized segment (always valid
     /// iterator)
     iterator get_or_materialize_segment(
-      const remote_segment_path& path, const segment_meta&, segment_units);
+      const remote_segment_path& path,
+      const segment_meta&,
+      segment_units,
+      std::optional<packed_segment_location> packed = std::nullopt);
+
+    /// Hydrate in the background the index of the segment starting at
+    /// \p base_offset, which a sequential reader is about to read next, so
+    /// that switching to it does not wait for the index download.
+    void maybe_prefetch_segment_index(
+      const partition_manifest& manifest, model::offset base_offset);
+    ss::future<>
+    prefetch_segment_index(remote_segment_path path, segment_meta meta);
 
     model::ntp _ntp;
     retry_chain_node _rtc;
@@ -143,6 +143,16 @@ remote_probe::remote_probe(
               [this] { return get_controller_snapshot_upload_backoffs(); },
               sm::description("Number of times backoff was applied during "
                               "controller snapshot uploads")),
+            sm::make_counter(
+              "hedged_downloads",
+              [this] { return get_hedged_downloads(); },
+              sm::description("Number of duplicate GET requests sent for "
+                              "slow ones")),
+            sm::make_counter(
+              "hedged_download_wins",
+              [this] { return get_hedged_download_wins(); },
+              sm::description(
+                "Number of duplicate GET requests which responded first")),
             sm::make_histogram(
               "client_acquisition_latency",
               [this] {
@@ -11,6 +11,7 @@
 #pragma once
 
 #include "base/seastarx.h"
+#include "cloud_storage/read_hedging.h"
 #include "cloud_storage/types.h"
 #include "metrics/metrics.h"
 #include "model/fundamental.h"
@@ -217,6 +218,20 @@ public:
 
     auto segment_download() { return _segment_download_latency.auto_measure(); }
 
+    read_hedging_policy& read_hedging() { return _read_hedging; }
+
+    /// Register a duplicate GET request sent for a slow one
+    void hedged_download() { ++_cnt_hedged_downloads; }
+
+    /// Register a hedged GET request which responded first
+    void hedged_download_win() { ++_cnt_hedged_download_wins; }
+
+    uint64_t get_hedged_downloads() const { return _cnt_hedged_downloads; }
+
+    uint64_t get_hedged_download_wins() const {
+        return _cnt_hedged_download_wins;
+    }
+
     void controller_snapshot_successful_upload() {
         _cnt_controller_snapshot_successful_uploads++;
     }
@@ -295,9 +310,14 @@ private:
     uint64_t _cnt_spillover_manifest_uploads{0};
     /// Number of spillover manifest downloads
     uint64_t _cnt_spillover_manifest_downloads{0};
+    /// Number of duplicate GET requests sent for slow ones
+    uint64_t _cnt_hedged_downloads{0};
+    /// Number of duplicate GET requests which responded first
+    uint64_t _cnt_hedged_download_wins{0};
 
     hist_t _client_acquisition_latency;
     hist_t _segment_download_latency;
+    read_hedging_policy _read_hedging;
 
     metrics::internal_metric_groups _metrics;
     metrics::public_metric_groups _public_metrics;
@@ -15,6 +15,7 @@
 #include "cloud_storage/cache_service.h"
 #include "cloud_storage/download_exception.h"
 #include "cloud_storage/logger.h"
+#include "cloud_storage/materialized_resources.h"
 #include "cloud_storage/partition_manifest.h"
 #include "cloud_storage/remote_segment_index.h"
 #include "cloud_storage/segment_chunk_data_source.h"
@@ -49,6 +50,7 @@
 #include <seastar/util/defer.hh>
 #include <seastar/util/log.hh>
 
+#include <boost/range/irange.hpp>
 #include <fmt/core.h>
 
 #include <exception>
@@ -139,12 +141,14 @@ remote_segment::remote_segment(
   const segment_meta& meta,
   retry_chain_node& parent,
   partition_probe& probe,
-  ts_read_path_probe& ts_probe)
+  ts_read_path_probe& ts_probe,
+  std::optional<packed_segment_location> packed)
   : _api(r)
   , _cache(c)
   , _bucket(std::move(bucket))
   , _ntp(ntp)
   , _path(path)
+  , _packed(std::move(packed))
   , _index_path(generate_index_path(path))
   , _chunk_root(fmt::format("{}_chunks", _path().native()))
   , _term(meta.segment_term)
@@ -210,6 +214,12 @@ remote_segment::remote_segment(
         vlog(_ctxlog.debug, "fallback mode enabled");
         _fallback_mode = fallback_mode::yes;
     }
+    if (_packed) {
+        // Packed segments are uploaded without an index, they are small and
+        // hydrated in full, the index being built while downloading.
+        vlog(_ctxlog.debug, "segment is packed at {}", *_packed);
+        _fallback_mode = fallback_mode::yes;
+    }
 
     // run hydration loop in the background
     _hydration_loop_running = true;
@@ -286,12 +296,30 @@ remote_segment::offset_data_stream(
   kafka::offset end,
   std::optional<model::timestamp> first_timestamp,
   ss::io_priority_class io_priority,
-  storage::opt_abort_source_t as) {
+  storage::opt_abort_source_t as,
+  std::optional<ts_reader_key> reader) {
     vlog(_ctxlog.debug, "remote segment file input stream at offset {}", start);
     ss::gate::holder g(_gate);
 
+    const bool was_hydrated = is_state_materialized();
+    const auto hydration_started = ss::lowres_clock::now();
     co_await hydrate(as);
 
+    // In legacy mode the whole segment is hydrated above. With chunks, the
+    // data source accounts each chunk it loads.
+    if (reader.has_value() && is_legacy_mode_engaged()) {
+        get_read_cost_table().add(
+          *reader,
+          {
+            .get_requests = was_hydrated ? 0U : 1U,
+            .bytes_downloaded = was_hydrated ? 0 : get_segment_size(),
+            .cache_hits = was_hydrated ? 1U : 0U,
+            .hydration_wait
+            = std::chrono::duration_cast<std::chrono::milliseconds>(
+              ss::lowres_clock::now() - hydration_started),
+          });
+    }
+
     std::optional<offset_index::find_result> indexed_pos;
     std::optional<uint16_t> prefetch_override = std::nullopt;
 
@@ -341,7 +369,8 @@ remote_segment::offset_data_stream(
           end,
           pos.file_pos,
           std::move(options),
-          prefetch_override);
+          prefetch_override,
+          std::move(reader));
         data_stream = ss::input_stream<char>{
           ss::data_source{std::move(chunk_ds)}};
     }
@@ -508,10 +537,19 @@ ss::future<> remote_segment::do_hydrate_segment() {
     auto reservation = co_await _cache.reserve_space(
       _size + storage::segment_index::estimate_size(_size), 1);
 
+    // A packed segment is the range of its shared object it was packed at
+    auto object_path = _packed ? remote_segment_path{std::filesystem::path{
+                                   _packed->object}}
+                               : _path;
+    std::optional<cloud_storage_clients::http_byte_range> byte_range;
+    if (_packed) {
+        byte_range.emplace(_packed->offset, _packed->offset + _size - 1);
+    }
+
     track_hydration t{_ts_probe};
     auto res = co_await _api.download_segment(
       _bucket,
-      _path,
+      object_path,
       [this, &reservation](uint64_t size_bytes, ss::input_stream<char> s) {
           // Always create the index because we are in legacy mode if we ended
           // up hydrating the segment. Legacy mode indicates a missing index, so
@@ -519,7 +557,8 @@ ss::future<> remote_segment::do_hydrate_segment() {
           return put_segment_in_cache_and_create_index(
             size_bytes, reservation, std::move(s));
       },
-      local_rtc);
+      local_rtc,
+      byte_range);
 
     if (res != download_result::success) {
         vlog(
@@ -715,6 +754,16 @@ ss::future<bool> remote_segment::maybe_materialize_index() {
       0,
       remote_segment_sampling_step_bytes,
       _base_timestamp);
+    auto& tier = get_hot_tier();
+    if (auto state = tier.get(path); state.has_value()) {
+        vlog(_ctxlog.debug, "Materializing index '{}' from memory", path);
+        ix.from_iobuf(std::move(*state));
+        _index = std::move(ix);
+        _coarse_index.emplace(
+          _index->build_coarse_index(_chunk_size, _index_path.native()));
+        co_await _chunks_api->start();
+        co_return true;
+    }
     if (auto cache_item = co_await _cache.get(path); cache_item.has_value()) {
         // The cache item is expected to be present if the segment is present
         // so it's very unlikely that we will call this method if there is no
@@ -736,6 +785,9 @@ ss::future<bool> remote_segment::maybe_materialize_index() {
             co_await ss::copy(inp_stream, out_stream).finally([&inp_stream] {
                 return inp_stream.close();
             });
+            if (tier.should_admit(path)) {
+                tier.put(path, state.share(0, state.size_bytes()));
+            }
             ix.from_iobuf(std::move(state));
             _index = std::move(ix);
             _coarse_index.emplace(
@@ -999,28 +1051,48 @@ ss::future<> remote_segment::hydrate_chunk(segment_chunk_range range) {
         co_return;
     }
 
-    retry_chain_node rtc{
-      cache_hydration_timeout, cache_hydration_backoff, &_rtc};
-
     const auto chunk_count = range.chunk_count();
 
-    const auto end = range.last_offset().value_or(_size - 1);
-    auto consumer = split_segment_into_chunk_range_consumer{
-      *this, std::move(range)};
-
     auto measurement = _ts_probe.chunk_hydration_latency();
     track_hydration t{_ts_probe};
 
-    auto res = co_await _api.download_segment(
-      _bucket, _path, std::move(consumer), rtc, std::make_pair(start, end));
-    if (res != download_result::success) {
-        measurement->cancel();
-        throw download_exception{res, _path};
+    // A single GET is capped at the throughput of one HTTP stream. A range
+    // of prefetched chunks is split into ranged GETs of adjacent chunks, run
+    // concurrently with a client each, every chunk still being written to its
+    // own file in the cache.
+    auto ranges = std::move(range).split(
+      config::shard_local_cfg().cloud_storage_chunk_hydration_parallelism());
+    std::vector<download_result> results(
+      ranges.size(), download_result::success);
+    co_await ss::parallel_for_each(
+      boost::irange(ranges.size()), [this, &ranges, &results](size_t i) {
+          return download_chunk_range(std::move(ranges[i]))
+            .then([&results, i](download_result res) { results[i] = res; });
+      });
+    for (auto res : results) {
+        if (res != download_result::success) {
+            measurement->cancel();
+            throw download_exception{res, _path};
+        }
     }
 
     _ts_probe.on_chunks_hydration(chunk_count);
 }
 
+ss::future<download_result>
+remote_segment::download_chunk_range(segment_chunk_range range) {
+    retry_chain_node rtc{
+      cache_hydration_timeout, cache_hydration_backoff, &_rtc};
+
+    const auto start = range.first_offset();
+    const auto end = range.last_offset().value_or(_size - 1);
+    auto consumer = split_segment_into_chunk_range_consumer{
+      *this, std::move(range)};
+
+    co_return co_await _api.download_segment(
+      _bucket, _path, std::move(consumer), rtc, std::make_pair(start, end));
+}
+
 ss::future<ss::file>
 remote_segment::materialize_chunk(chunk_start_offset_t chunk_start) {
     auto res = co_await _cache.get(get_path_to_chunk(chunk_start));
@@ -1090,6 +1162,14 @@ remote_segment::get_chunk_start_for_kafka_offset(kafka::offset koff) const {
     return static_cast<uint64_t>(it->second);
 }
 
+hot_tier& remote_segment::get_hot_tier() {
+    return _api.materialized().get_hot_tier();
+}
+
+ts_read_cost_table& remote_segment::get_read_cost_table() {
+    return _api.materialized().get_read_cost_table();
+}
+
 const offset_index::coarse_index_t& remote_segment::get_coarse_index() const {
     vassert(_coarse_index.has_value(), "coarse index is not initialized");
     return _coarse_index.value();
@@ -1269,6 +1349,8 @@ public:
           "[{}] skip_batch_start called for {}",
           _config.client_address,
           header.base_offset);
+        _seg_reader._seg->get_batch_cache().put(
+          header, std::nullopt, _seg_reader._cur_delta);
         advance_config_offsets(header);
         if (
           std::count(
@@ -1298,6 +1380,10 @@ public:
 
     /// Produce batch if within memory limits
     ss::future<stop_parser> consume_batch_end() override {
+        _seg_reader._seg->get_batch_cache().put(
+          _header,
+          _records.share(0, _records.size_bytes()),
+          _seg_reader._cur_delta);
         auto batch = model::record_batch{
           _header, std::move(_records), model::record_batch::tag_ctor_ng{}};
 
@@ -1365,6 +1451,10 @@ remote_segment_batch_reader::read_some(
   model::timeout_clock::time_point deadline,
   storage::offset_translator_state& ot_state) {
     ss::gate::holder h(_gate);
+    if (_ringbuf.empty() && !_parser && co_await read_cached(ot_state)) {
+        _total_size = 0;
+        co_return std::move(_ringbuf);
+    }
     if (_ringbuf.empty()) {
         if (!_parser) {
             // remote_segment_batch_reader shouldn't be used concurrently
@@ -1423,12 +1513,22 @@ remote_segment_batch_reader::init_parser() {
       _config.start_offset,
       _config.client_address);
 
+    // Reads are accounted to the client id of the reader, or to its address
+    // for clients without one. Internal readers are not accounted.
+    std::optional<ts_reader_key> reader;
+    if (_config.client_id.has_value()) {
+        reader = ts_reader_key{_seg->get_ntp(), *_config.client_id};
+    } else if (_config.client_address.has_value()) {
+        reader = ts_reader_key{_seg->get_ntp(), (*_config.client_address)()};
+    }
+
     auto stream_off = co_await _seg->offset_data_stream(
       model::offset_cast(_config.start_offset),
       model::offset_cast(_config.max_offset),
       _config.first_timestamp,
       priority_manager::local().shadow_indexing_priority(),
-      _config.abort_source);
+      _config.abort_source,
+      std::move(reader));
 
     vlog(
       _ctxlog.debug,
@@ -1446,6 +1546,62 @@ remote_segment_batch_reader::init_parser() {
     co_return parser;
 }
 
+ss::future<bool> remote_segment_batch_reader::read_cached(
+  storage::offset_translator_state& ot_state) {
+    using consume_result = storage::batch_consumer::consume_result;
+    using stop_parser = storage::batch_consumer::stop_parser;
+
+    auto& cache = _seg->get_batch_cache();
+    if (!cache.enabled()) {
+        co_return false;
+    }
+    auto cached = cache.find(kafka::offset_cast(_config.start_offset));
+    if (!cached) {
+        co_return false;
+    }
+    vlog(
+      _ctxlog.debug,
+      "[{}] replaying cached batches from {}, start_offset: {}",
+      _config.client_address,
+      cached->header.base_offset,
+      _config.start_offset);
+
+    _cur_rp_offset = cached->header.base_offset;
+    _cur_delta = cached->delta;
+    ot_state.add_absolute_delta(_cur_rp_offset, _cur_delta);
+    _cur_ot_state = ot_state;
+    auto deferred = ss::defer([this] { _cur_ot_state = std::nullopt; });
+
+    // the cached batches go through the consumer of the parser, so that
+    // they're filtered and translated the same way
+    remote_segment_batch_consumer consumer(
+      _config, *this, _seg->get_term(), _seg->get_ntp(), _rtc);
+    while (cached) {
+        auto res = consumer.accept_batch_start(cached->header);
+        if (res == consume_result::stop_parser) {
+            break;
+        }
+        if (res == consume_result::skip_batch) {
+            consumer.skip_batch_start(cached->header, 0, 0);
+        } else {
+            if (!cached->records) {
+                // the parser skipped the batch, read it from the segment
+                break;
+            }
+            consumer.consume_batch_start(cached->header, 0, 0);
+            consumer.consume_records(std::move(*cached->records));
+            if (co_await consumer.consume_batch_end() == stop_parser::yes) {
+                break;
+            }
+        }
+        if (is_eof()) {
+            break;
+        }
+        cached = cache.get(_cur_rp_offset);
+    }
+    co_return !_ringbuf.empty() || is_eof();
+}
+
 size_t remote_segment_batch_reader::produce(model::record_batch batch) {
     ss::gate::holder h(_gate);
     vlog(_ctxlog.debug, "remote_segment_batch_reader::produce");
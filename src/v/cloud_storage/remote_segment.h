@@ -11,8 +11,11 @@
 #pragma once
 
 #include "cloud_storage/cache_service.h"
+#include "cloud_storage/decoded_batch_cache.h"
+#include "cloud_storage/hot_tier.h"
 #include "cloud_storage/logger.h"
 #include "cloud_storage/partition_manifest.h"
+#include "cloud_storage/read_cost_table.h"
 #include "cloud_storage/read_path_probes.h"
 #include "cloud_storage/remote.h"
 #include "cloud_storage/remote_segment_index.h"
@@ -72,7 +75,8 @@ public:
       const segment_meta& meta,
       retry_chain_node& parent,
       partition_probe& probe,
-      ts_read_path_probe& ts_probe);
+      ts_read_path_probe& ts_probe,
+      std::optional<packed_segment_location> packed = std::nullopt);
 
     remote_segment(const remote_segment&) = delete;
     remote_segment(remote_segment&&) = delete;
@@ -113,13 +117,15 @@ public:
         kafka::offset kafka_offset;
     };
     /// create an input stream _sharing_ the underlying file handle
-    /// starting at position @pos
+    /// starting at position @pos. The downloads, cache hits and hydration
+    /// wait of the stream are accounted to @reader if it's set.
     ss::future<input_stream_with_offsets> offset_data_stream(
       kafka::offset start,
       kafka::offset end,
       std::optional<model::timestamp>,
       ss::io_priority_class,
-      storage::opt_abort_source_t as);
+      storage::opt_abort_source_t as,
+      std::optional<ts_reader_key> reader = std::nullopt);
 
     /// Hydrates the segment, index or tx-range depending on segment meta
     /// version, returning a future that the caller can use to wait for the
@@ -182,6 +188,22 @@ public:
 
     const offset_index::coarse_index_t& get_coarse_index() const;
 
+    /// Cache key of the chunk starting at \p chunk_start
+    std::filesystem::path
+    get_path_to_chunk(chunk_start_offset_t chunk_start) const {
+        return _chunk_root / fmt::format("{}", chunk_start);
+    }
+
+    /// The in-memory tier above the cache that chunks and indexes of the
+    /// segment are admitted to.
+    hot_tier& get_hot_tier();
+
+    /// The read costs of the shard, the reads of the segment are accounted to
+    ts_read_cost_table& get_read_cost_table();
+
+    /// The batches the readers of the segment parsed
+    decoded_batch_cache& get_batch_cache() { return _batch_cache; }
+
     bool is_fallback_engaged() const {
         return _fallback_mode == fallback_mode::yes;
     }
@@ -223,6 +245,9 @@ private:
     ss::future<uint64_t> put_segment_in_cache(
       uint64_t, space_reservation_guard&, ss::input_stream<char>);
 
+    /// Downloads the chunks of \p range with a single ranged GET.
+    ss::future<download_result> download_chunk_range(segment_chunk_range);
+
     /// Stores a segment chunk in cache. The chunk is stored in a path derived
     /// from the segment path: <segment_path>_chunks/chunk_start_file_offset.
     ss::future<> put_chunk_in_cache(
@@ -245,11 +270,6 @@ private:
     /// Load segment index from file (if available)
     ss::future<bool> maybe_materialize_index();
 
-    std::filesystem::path
-    get_path_to_chunk(chunk_start_offset_t chunk_start) const {
-        return _chunk_root / fmt::format("{}", chunk_start);
-    }
-
     /// Decides if the remote segment should download the full segment as part
     /// of the hydration process. This is true if we are working with a segment
     /// format older than v3 or we are in fallback mode. In newer formats we
@@ -268,6 +288,10 @@ private:
     cloud_storage_clients::bucket_name _bucket;
     const model::ntp& _ntp;
     remote_segment_path _path;
+    /// Set if the segment was uploaded into an object shared with other
+    /// segments, which is where the data is downloaded from. The segment,
+    /// its index and its tx manifest are still cached under `_path`.
+    std::optional<packed_segment_location> _packed;
     std::filesystem::path _index_path;
     std::filesystem::path _chunk_root;
 
@@ -315,6 +339,7 @@ private:
 
     std::optional<segment_chunks> _chunks_api;
     std::optional<offset_index::coarse_index_t> _coarse_index;
+    decoded_batch_cache _batch_cache;
     partition_probe& _probe;
     ts_read_path_probe& _ts_probe;
 
@@ -408,6 +433,10 @@ private:
     friend class single_record_consumer;
     ss::future<std::unique_ptr<storage::continuous_batch_parser>> init_parser();
 
+    /// Replay the batches of the segment cache from the start offset of the
+    /// config. Returns false if the cache does not hold the start offset.
+    ss::future<bool> read_cached(storage::offset_translator_state&);
+
     size_t produce(model::record_batch batch);
 
     ss::lw_shared_ptr<remote_segment> _seg;
@@ -78,6 +78,66 @@ void offset_index::add(
     }
 }
 
+void offset_index::append(const offset_index& other, int64_t file_pos_shift) {
+    auto last_file_pos = _pos == 0 ? _initial_file_pos
+                                   : _file_offsets.at((_pos - 1) & index_mask);
+    auto add_rows = [this, file_pos_shift, &last_file_pos](
+                      const auto& rp_row,
+                      const auto& kaf_row,
+                      const auto& file_row,
+                      const auto& time_row,
+                      size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            auto file_pos = file_row.at(i) + file_pos_shift;
+            if (file_pos - last_file_pos < _min_file_pos_step) {
+                continue;
+            }
+            add(
+              model::offset(rp_row.at(i)),
+              kafka::offset(kaf_row.at(i)),
+              file_pos,
+              model::timestamp(time_row.at(i)));
+            last_file_pos = file_pos;
+        }
+    };
+
+    decoder_t rp_dec(
+      other._rp_index.get_initial_value(),
+      other._rp_index.get_row_count(),
+      other._rp_index.copy());
+    decoder_t kaf_dec(
+      other._kaf_index.get_initial_value(),
+      other._kaf_index.get_row_count(),
+      other._kaf_index.copy());
+    foffset_decoder_t file_dec(
+      other._file_index.get_initial_value(),
+      other._file_index.get_row_count(),
+      other._file_index.copy(),
+      delta_delta_t(other._min_file_pos_step));
+    decoder_t time_dec(
+      other._time_index.get_initial_value(),
+      other._time_index.get_row_count(),
+      other._time_index.copy());
+    std::array<int64_t, buffer_depth> rp_row{};
+    std::array<int64_t, buffer_depth> kaf_row{};
+    std::array<int64_t, buffer_depth> file_row{};
+    std::array<int64_t, buffer_depth> time_row{};
+    while (rp_dec.read(rp_row) && kaf_dec.read(kaf_row)
+           && file_dec.read(file_row) && time_dec.read(time_row)) {
+        add_rows(rp_row, kaf_row, file_row, time_row, buffer_depth);
+        rp_row = {};
+        kaf_row = {};
+        file_row = {};
+        time_row = {};
+    }
+    add_rows(
+      other._rp_offsets,
+      other._kaf_offsets,
+      other._file_offsets,
+      other._time_offsets,
+      other._pos & index_mask);
+}
+
 std::
   variant<std::monostate, offset_index::index_value, offset_index::find_result>
   offset_index::maybe_find_offset(
@@ -349,7 +409,296 @@ iobuf offset_index::to_iobuf() {
     return serde::to_iobuf(std::move(hdr));
 }
 
+/// Marks the beginning and the end of the v2 format objects. The first
+/// bytes of the v1 format are the version of its envelope.
+static constexpr uint32_t offset_index_v2_magic = 0x32495052; // "RPI2"
+
+struct offset_index_v2_block
+  : serde::envelope<
+      offset_index_v2_block,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    iobuf rp_index;
+    iobuf kaf_index;
+    iobuf file_index;
+    iobuf time_index;
+};
+
+iobuf offset_index::to_iobuf_v2(uint32_t rows_per_block) {
+    vassert(rows_per_block > 0, "Block of the index can't be empty");
+    iobuf out;
+    serde::write(out, offset_index_v2_magic);
+
+    offset_index_v2_footer footer{
+      .min_file_pos_step = _min_file_pos_step,
+      .num_elements = _pos,
+      .base_rp = _initial_rp(),
+      .base_kaf = _initial_kaf(),
+      .base_file = _initial_file_pos,
+      .base_time = _initial_time.value(),
+      .rp_write_buf = std::vector<int64_t>(
+        _rp_offsets.begin(), _rp_offsets.end()),
+      .kaf_write_buf = std::vector<int64_t>(
+        _kaf_offsets.begin(), _kaf_offsets.end()),
+      .file_write_buf = std::vector<int64_t>(
+        _file_offsets.begin(), _file_offsets.end()),
+      .time_write_buf = std::vector<int64_t>(
+        _time_offsets.begin(), _time_offsets.end()),
+    };
+
+    decoder_t rp_dec(
+      _rp_index.get_initial_value(),
+      _rp_index.get_row_count(),
+      _rp_index.copy());
+    decoder_t kaf_dec(
+      _kaf_index.get_initial_value(),
+      _kaf_index.get_row_count(),
+      _kaf_index.copy());
+    foffset_decoder_t file_dec(
+      _file_index.get_initial_value(),
+      _file_index.get_row_count(),
+      _file_index.copy(),
+      delta_delta_t(_min_file_pos_step));
+    decoder_t time_dec(
+      _time_index.get_initial_value(),
+      _time_index.get_row_count(),
+      _time_index.copy());
+
+    // Every block is encoded starting from the last values of the previous
+    // block, so the blocks of a column can be concatenated into a single
+    // delta_for stream. The object always has at least one block.
+    int64_t rp_last = _initial_rp();
+    int64_t kaf_last = _initial_kaf();
+    int64_t file_last = _initial_file_pos;
+    int64_t time_last = _initial_time.value();
+    uint32_t rows_left = _rp_index.get_row_count();
+    do {
+        offset_index_v2_block_meta meta{
+          .offset = out.size_bytes(),
+          .initial_rp = rp_last,
+          .initial_kaf = kaf_last,
+          .initial_file = file_last,
+          .initial_time = time_last,
+        };
+        encoder_t rp_enc(rp_last);
+        encoder_t kaf_enc(kaf_last);
+        foffset_encoder_t file_enc(
+          file_last, delta_delta_t(_min_file_pos_step));
+        encoder_t time_enc(time_last);
+        std::array<int64_t, buffer_depth> rp_row{};
+        std::array<int64_t, buffer_depth> kaf_row{};
+        std::array<int64_t, buffer_depth> file_row{};
+        std::array<int64_t, buffer_depth> time_row{};
+        while (meta.num_rows < rows_per_block && rows_left > 0) {
+            rp_dec.read(rp_row);
+            kaf_dec.read(kaf_row);
+            file_dec.read(file_row);
+            time_dec.read(time_row);
+            rp_enc.add(rp_row);
+            kaf_enc.add(kaf_row);
+            file_enc.add(file_row);
+            time_enc.add(time_row);
+            ++meta.num_rows;
+            --rows_left;
+        }
+        rp_last = rp_enc.get_last_value();
+        kaf_last = kaf_enc.get_last_value();
+        file_last = file_enc.get_last_value();
+        time_last = time_enc.get_last_value();
+        meta.last_rp = rp_last;
+        meta.last_kaf = kaf_last;
+        meta.last_file = file_last;
+        meta.last_time = time_last;
+
+        auto block = serde::to_iobuf(offset_index_v2_block{
+          .rp_index = rp_enc.copy(),
+          .kaf_index = kaf_enc.copy(),
+          .file_index = file_enc.copy(),
+          .time_index = time_enc.copy(),
+        });
+        meta.size = block.size_bytes();
+        out.append(std::move(block));
+        footer.blocks.push_back(meta);
+    } while (rows_left > 0);
+
+    auto footer_buf = serde::to_iobuf(std::move(footer));
+    auto footer_size = static_cast<uint32_t>(footer_buf.size_bytes());
+    out.append(std::move(footer_buf));
+    serde::write(out, footer_size);
+    serde::write(out, offset_index_v2_magic);
+    return out;
+}
+
+std::optional<uint32_t> offset_index::parse_v2_trailer(iobuf trailer) {
+    if (trailer.size_bytes() != v2_trailer_size) {
+        return std::nullopt;
+    }
+    iobuf_parser parser(std::move(trailer));
+    auto footer_size = serde::read_nested<uint32_t>(parser, 0);
+    auto magic = serde::read_nested<uint32_t>(parser, 0);
+    if (magic != offset_index_v2_magic) {
+        return std::nullopt;
+    }
+    return footer_size;
+}
+
+offset_index_v2_footer offset_index::parse_v2_footer(iobuf footer) {
+    return serde::from_iobuf<offset_index_v2_footer>(std::move(footer));
+}
+
+offset_index offset_index::from_v2_block(
+  const offset_index_v2_footer& footer, size_t block_ix, iobuf block) {
+    const auto& meta = footer.blocks.at(block_ix);
+    auto blk = serde::from_iobuf<offset_index_v2_block>(std::move(block));
+    offset_index ix(
+      model::offset(meta.initial_rp),
+      kafka::offset(meta.initial_kaf),
+      meta.initial_file,
+      footer.min_file_pos_step,
+      model::timestamp(meta.initial_time));
+    ix._rp_index = encoder_t(
+      meta.initial_rp, meta.num_rows, meta.last_rp, std::move(blk.rp_index));
+    ix._kaf_index = encoder_t(
+      meta.initial_kaf,
+      meta.num_rows,
+      meta.last_kaf,
+      std::move(blk.kaf_index));
+    ix._file_index = foffset_encoder_t(
+      meta.initial_file,
+      meta.num_rows,
+      meta.last_file,
+      std::move(blk.file_index),
+      delta_delta_t(footer.min_file_pos_step));
+    ix._time_index = encoder_t(
+      meta.initial_time,
+      meta.num_rows,
+      meta.last_time,
+      std::move(blk.time_index));
+    ix._pos = meta.num_rows * buffer_depth;
+    if (block_ix == footer.blocks.size() - 1) {
+        // The entries which don't fill a row belong to the last block
+        ix._pos += footer.num_elements & index_mask;
+        std::copy(
+          footer.rp_write_buf.begin(),
+          footer.rp_write_buf.end(),
+          ix._rp_offsets.begin());
+        std::copy(
+          footer.kaf_write_buf.begin(),
+          footer.kaf_write_buf.end(),
+          ix._kaf_offsets.begin());
+        std::copy(
+          footer.file_write_buf.begin(),
+          footer.file_write_buf.end(),
+          ix._file_offsets.begin());
+        std::copy(
+          footer.time_write_buf.begin(),
+          footer.time_write_buf.end(),
+          ix._time_offsets.begin());
+    }
+    return ix;
+}
+
+void offset_index::from_iobuf_v2(iobuf b) {
+    auto size = b.size_bytes();
+    auto footer_size = parse_v2_trailer(
+      b.share(size - v2_trailer_size, v2_trailer_size));
+    if (
+      !footer_size.has_value()
+      || *footer_size + v2_trailer_size + sizeof(uint32_t) > size) {
+        throw std::runtime_error(
+          fmt::format("Malformed offset index, size: {}", size));
+    }
+    auto footer = parse_v2_footer(
+      b.share(size - v2_trailer_size - *footer_size, *footer_size));
+
+    iobuf rp_index;
+    iobuf kaf_index;
+    iobuf file_index;
+    iobuf time_index;
+    uint32_t num_rows = 0;
+    for (const auto& meta : footer.blocks) {
+        auto blk = serde::from_iobuf<offset_index_v2_block>(
+          b.share(meta.offset, meta.size));
+        rp_index.append(std::move(blk.rp_index));
+        kaf_index.append(std::move(blk.kaf_index));
+        file_index.append(std::move(blk.file_index));
+        time_index.append(std::move(blk.time_index));
+        num_rows += meta.num_rows;
+    }
+    const auto& last = footer.blocks.back();
+
+    _pos = footer.num_elements;
+    _min_file_pos_step = footer.min_file_pos_step;
+    _initial_rp = model::offset(footer.base_rp);
+    _initial_kaf = kafka::offset(footer.base_kaf);
+    _initial_file_pos = footer.base_file;
+    _initial_time = model::timestamp(footer.base_time);
+    _rp_index = encoder_t(
+      footer.base_rp, num_rows, last.last_rp, std::move(rp_index));
+    _kaf_index = encoder_t(
+      footer.base_kaf, num_rows, last.last_kaf, std::move(kaf_index));
+    _file_index = foffset_encoder_t(
+      footer.base_file,
+      num_rows,
+      last.last_file,
+      std::move(file_index),
+      delta_delta_t(_min_file_pos_step));
+    _time_index = encoder_t(
+      footer.base_time, num_rows, last.last_time, std::move(time_index));
+    std::copy(
+      footer.rp_write_buf.begin(),
+      footer.rp_write_buf.end(),
+      _rp_offsets.begin());
+    std::copy(
+      footer.kaf_write_buf.begin(),
+      footer.kaf_write_buf.end(),
+      _kaf_offsets.begin());
+    std::copy(
+      footer.file_write_buf.begin(),
+      footer.file_write_buf.end(),
+      _file_offsets.begin());
+    std::copy(
+      footer.time_write_buf.begin(),
+      footer.time_write_buf.end(),
+      _time_offsets.begin());
+}
+
+template<class Fn>
+static size_t find_v2_block(const offset_index_v2_footer& footer, Fn last) {
+    auto it = std::find_if(
+      footer.blocks.begin(), footer.blocks.end(), [&last](const auto& m) {
+          return m.num_rows > 0 && last(m);
+      });
+    if (it == footer.blocks.end()) {
+        return footer.blocks.size() - 1;
+    }
+    return std::distance(footer.blocks.begin(), it);
+}
+
+size_t offset_index_v2_footer::find_block(model::offset upper_bound) const {
+    return find_v2_block(
+      *this, [&](const auto& m) { return m.last_rp >= upper_bound(); });
+}
+
+size_t offset_index_v2_footer::find_block(kafka::offset upper_bound) const {
+    return find_v2_block(
+      *this, [&](const auto& m) { return m.last_kaf >= upper_bound(); });
+}
+
+size_t offset_index_v2_footer::find_block(model::timestamp upper_bound) const {
+    return find_v2_block(*this, [&](const auto& m) {
+        return m.last_time >= upper_bound.value();
+    });
+}
+
 void offset_index::from_iobuf(iobuf b) {
+    if (b.size_bytes() >= v2_trailer_size + sizeof(uint32_t)) {
+        iobuf_parser magic(b.share(0, sizeof(uint32_t)));
+        if (serde::read_nested<uint32_t>(magic, 0) == offset_index_v2_magic) {
+            from_iobuf_v2(std::move(b));
+            return;
+        }
+    }
     iobuf_parser parser(std::move(b));
     auto hdr = serde::read<offset_index_header>(parser);
     auto num_rows = hdr.num_elements / buffer_depth;
@@ -16,6 +16,7 @@
 #include "bytes/iobuf_parser.h"
 #include "model/fundamental.h"
 #include "model/record_batch_types.h"
+#include "serde/envelope.h"
 #include "storage/parser.h"
 #include "utils/delta_for.h"
 
@@ -23,10 +24,67 @@
 
 #include <absl/container/btree_map.h>
 
+#include <optional>
 #include <variant>
+#include <vector>
 
 namespace cloud_storage {
 
+/// Location and boundaries of a block of the v2 offset_index format
+///
+/// The 'initial_*' fields are the values which precede the first entry of
+/// the block (the values the block's delta_for encoders start from), the
+/// 'last_*' fields are the values of its last entry.
+struct offset_index_v2_block_meta
+  : serde::envelope<
+      offset_index_v2_block_meta,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    uint64_t offset{0};
+    uint64_t size{0};
+    uint32_t num_rows{0};
+    int64_t initial_rp;
+    int64_t initial_kaf;
+    int64_t initial_file;
+    int64_t initial_time;
+    int64_t last_rp;
+    int64_t last_kaf;
+    int64_t last_file;
+    int64_t last_time;
+};
+
+/// Footer of the v2 offset_index format
+///
+/// The footer contains the directory of the blocks and the entries which
+/// don't fill a whole delta_for row. A reader which fetched the footer can
+/// pick the block that contains the entry it is looking for and fetch only
+/// that block with a range request.
+struct offset_index_v2_footer
+  : serde::envelope<
+      offset_index_v2_footer,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    int64_t min_file_pos_step;
+    uint64_t num_elements;
+    int64_t base_rp;
+    int64_t base_kaf;
+    int64_t base_file;
+    int64_t base_time;
+    std::vector<int64_t> rp_write_buf;
+    std::vector<int64_t> kaf_write_buf;
+    std::vector<int64_t> file_write_buf;
+    std::vector<int64_t> time_write_buf;
+    std::vector<offset_index_v2_block_meta> blocks;
+
+    /// Return index of the block which has to be searched to find the entry
+    /// which is strictly lower than the offset or timestamp. This is the
+    /// first block whose last entry is not lower than the query, or the last
+    /// block (which also owns the entries of the footer).
+    size_t find_block(model::offset upper_bound) const;
+    size_t find_block(kafka::offset upper_bound) const;
+    size_t find_block(model::timestamp upper_bound) const;
+};
+
 /// Offset index for remote_segment
 ///
 /// The object indexes tuples that contain three elements:
@@ -63,6 +121,12 @@ public:
       int64_t file_offset,
       model::timestamp);
 
+    /// Add all the tuples of \p other, which indexes the data that follows
+    /// the data of this index. The file offsets of \p other are shifted by
+    /// \p file_pos_shift. Tuples that are closer to the previous one than the
+    /// sampling step are skipped.
+    void append(const offset_index& other, int64_t file_pos_shift);
+
     struct find_result {
         model::offset rp_offset;
         kafka::offset kaf_offset;
@@ -107,9 +171,36 @@ public:
     /// Serialize offset_index
     iobuf to_iobuf();
 
-    /// Deserialize offset_index
+    /// Deserialize offset_index, both formats are supported
     void from_iobuf(iobuf in);
 
+    /// Default number of delta_for rows in a block of the v2 format
+    static constexpr uint32_t default_v2_rows_per_block = 64;
+
+    /// Serialize offset_index using the v2 format
+    ///
+    /// The columns are split into blocks of 'rows_per_block' rows which are
+    /// followed by a footer with the directory of the blocks. The object ends
+    /// with the size of the footer and a magic number (see 'v2_trailer_size').
+    iobuf to_iobuf_v2(uint32_t rows_per_block = default_v2_rows_per_block);
+
+    /// Size of the end of a v2 object which contains the size of the footer
+    static constexpr size_t v2_trailer_size = 2 * sizeof(uint32_t);
+
+    /// Parse the last 'v2_trailer_size' bytes of an index object. Returns
+    /// the size of the footer which precedes them or nullopt if the object
+    /// doesn't use the v2 format.
+    static std::optional<uint32_t> parse_v2_trailer(iobuf trailer);
+
+    /// Parse the footer of a v2 object
+    static offset_index_v2_footer parse_v2_footer(iobuf footer);
+
+    /// Create the index which contains only the entries of the block
+    /// 'block_ix' of a v2 object. Search methods of the result can return
+    /// nullopt if the entry is the last one of the previous block.
+    static offset_index from_v2_block(
+      const offset_index_v2_footer& footer, size_t block_ix, iobuf block);
+
 private:
     struct index_value {
         size_t ix;
@@ -153,6 +244,8 @@ private:
         return std::nullopt;
     }
 
+    void from_iobuf_v2(iobuf in);
+
 private:
     std::array<int64_t, buffer_depth> _rp_offsets;
     std::array<int64_t, buffer_depth> _kaf_offsets;
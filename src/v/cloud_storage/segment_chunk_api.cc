@@ -288,6 +288,14 @@ segment_chunks::get_next_chunk_start(chunk_start_offset_t f) const {
     return next->first;
 }
 
+uint64_t segment_chunks::get_chunk_size(chunk_start_offset_t f) const {
+    vassert(_chunks.contains(f), "No chunk found starting at {}", f);
+    auto next = std::next(_chunks.find(f));
+    const uint64_t end = next == _chunks.end() ? _segment.get_segment_size()
+                                               : next->first;
+    return end - f;
+}
+
 segment_chunks::iterator_t segment_chunks::begin() { return _chunks.begin(); }
 
 segment_chunks::iterator_t segment_chunks::end() { return _chunks.end(); }
@@ -489,4 +497,26 @@ segment_chunk_range::map_t::iterator segment_chunk_range::end() {
     return _chunks.end();
 }
 
+std::vector<segment_chunk_range> segment_chunk_range::split(size_t parts) && {
+    parts = std::clamp<size_t>(parts, 1, std::max<size_t>(_chunks.size(), 1));
+    if (parts == 1) {
+        std::vector<segment_chunk_range> ranges;
+        ranges.push_back(std::move(*this));
+        return ranges;
+    }
+    const auto chunks_per_range = (_chunks.size() + parts - 1) / parts;
+    std::vector<segment_chunk_range> ranges;
+    ranges.reserve(parts);
+    auto it = _chunks.begin();
+    while (it != _chunks.end()) {
+        map_t chunks;
+        for (size_t i = 0; i < chunks_per_range && it != _chunks.end();
+             ++i, ++it) {
+            chunks.emplace(it->first, it->second);
+        }
+        ranges.push_back(segment_chunk_range(std::move(chunks)));
+    }
+    return ranges;
+}
+
 } // namespace cloud_storage
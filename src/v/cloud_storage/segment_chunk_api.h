@@ -69,6 +69,9 @@ public:
 
     chunk_start_offset_t get_next_chunk_start(chunk_start_offset_t f) const;
 
+    // Returns the size in bytes of the chunk starting at the given offset
+    uint64_t get_chunk_size(chunk_start_offset_t f) const;
+
     using iterator_t = chunk_map_t::iterator;
     iterator_t begin();
     iterator_t end();
@@ -186,7 +189,14 @@ public:
     map_t::iterator begin();
     map_t::iterator end();
 
+    /// Splits the range into at most \p parts ranges of adjacent chunks, of
+    /// about the same number of chunks each.
+    std::vector<segment_chunk_range> split(size_t parts) &&;
+
 private:
+    explicit segment_chunk_range(map_t chunks)
+      : _chunks(std::move(chunks)) {}
+
     map_t _chunks;
 };
 
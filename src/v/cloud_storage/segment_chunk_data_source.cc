@@ -11,7 +11,13 @@
 
 #include "cloud_storage/segment_chunk_data_source.h"
 
+#include "bytes/iostream.h"
 #include "cloud_storage/remote_segment.h"
+#include "config/configuration.h"
+#include "ssx/future-util.h"
+
+#include <algorithm>
+#include <utility>
 
 namespace cloud_storage {
 
@@ -22,7 +28,8 @@ chunk_data_source_impl::chunk_data_source_impl(
   kafka::offset end,
   int64_t begin_stream_at,
   ss::file_input_stream_options stream_options,
-  std::optional<uint16_t> prefetch_override)
+  std::optional<uint16_t> prefetch_override,
+  std::optional<ts_reader_key> reader)
   : _chunks(chunks)
   , _segment(segment)
   , _first_chunk_start(_segment.get_chunk_start_for_kafka_offset(start))
@@ -32,7 +39,13 @@ chunk_data_source_impl::chunk_data_source_impl(
   , _stream_options(std::move(stream_options))
   , _rtc{_as}
   , _ctxlog{cst_log, _rtc, _segment.get_segment_path()().native()}
-  , _prefetch_override{prefetch_override} {
+  , _prefetch_override{prefetch_override}
+  , _prefetch_max(
+      config::shard_local_cfg().cloud_storage_chunk_prefetch_max.bind())
+  , _download_latency(
+      ss::make_lw_shared<ss::lowres_clock::duration>(
+        ss::lowres_clock::duration::zero()))
+  , _reader(std::move(reader)) {
     vlog(
       _ctxlog.trace,
       "chunk data source initialized with file position {} to {}",
@@ -96,10 +109,26 @@ ss::future<> chunk_data_source_impl::load_stream_for_chunk(
 
     std::exception_ptr eptr;
 
-    try {
-        co_await load_chunk_handle(chunk_start);
-    } catch (...) {
-        eptr = std::current_exception();
+    // Chunks in the hot tier are shared among readers without file I/O.
+    auto& tier = _segment.get_hot_tier();
+    const auto chunk_path = _segment.get_path_to_chunk(chunk_start);
+    auto in_memory = tier.get(chunk_path);
+
+    const auto state_before_load = in_memory.has_value()
+                                     ? chunk_state::hydrated
+                                     : _chunks.get(chunk_start).current_state;
+    const auto load_started = ss::lowres_clock::now();
+    if (!in_memory.has_value()) {
+        try {
+            co_await load_chunk_handle(chunk_start);
+            if (tier.should_admit(chunk_path)) {
+                in_memory = co_await read_chunk(*_current_data_file);
+                tier.put(
+                  chunk_path, in_memory->share(0, in_memory->size_bytes()));
+            }
+        } catch (...) {
+            eptr = std::current_exception();
+        }
     }
 
     if (eptr) {
@@ -113,6 +142,25 @@ ss::future<> chunk_data_source_impl::load_stream_for_chunk(
     _chunks.mark_acquired_and_update_stats(
       _current_chunk_start, _last_chunk_start);
 
+    const auto load_time = ss::lowres_clock::now() - load_started;
+    if (_reader.has_value()) {
+        // A chunk which was being downloaded by another reader only costs
+        // this one the wait.
+        const bool downloaded = state_before_load == chunk_state::not_available;
+        _segment.get_read_cost_table().add(
+          *_reader,
+          {
+            .get_requests = downloaded ? 1U : 0U,
+            .bytes_downloaded = downloaded ? _chunks.get_chunk_size(chunk_start)
+                                           : 0,
+            .cache_hits = state_before_load == chunk_state::hydrated ? 1U : 0U,
+            .hydration_wait
+            = std::chrono::duration_cast<std::chrono::milliseconds>(load_time),
+          });
+    }
+
+    maybe_prefetch(chunk_start, state_before_load, load_time);
+
     if (_current_stream) {
         co_await _current_stream->close();
     }
@@ -133,8 +181,110 @@ ss::future<> chunk_data_source_impl::load_stream_for_chunk(
       _current_chunk_start,
       begin);
 
-    _current_stream = ss::make_file_input_stream(
-      *_current_data_file, begin, _stream_options);
+    if (in_memory.has_value()) {
+        in_memory->trim_front(begin);
+        _current_stream = make_iobuf_input_stream(std::move(*in_memory));
+    } else {
+        _current_stream = ss::make_file_input_stream(
+          *_current_data_file, begin, _stream_options);
+    }
+}
+
+ss::future<iobuf> chunk_data_source_impl::read_chunk(ss::file& file) {
+    const auto size = co_await file.size();
+    auto in = ss::make_file_input_stream(file, 0, size, _stream_options);
+    iobuf data;
+    auto out = make_iobuf_ref_output_stream(data);
+    co_await ss::copy(in, out).finally([&in] { return in.close(); });
+    co_return data;
+}
+
+void chunk_data_source_impl::maybe_prefetch(
+  chunk_start_offset_t chunk_start,
+  chunk_state state_before_load,
+  ss::lowres_clock::duration load_time) {
+    const auto now = ss::lowres_clock::now();
+    const auto loaded_previous_at = std::exchange(_chunk_loaded_at, now);
+    const uint16_t max_depth = _prefetch_max();
+    // Reads with an explicit prefetch, such as timequeries, read a few chunks
+    // at most and are left alone.
+    if (max_depth == 0 || _prefetch_override.has_value()) {
+        return;
+    }
+
+    if (chunk_start == _first_chunk_start) {
+        // Until the reader crosses into its next chunk there is nothing
+        // to tell about its access pattern, only the latency of the download
+        // of its first chunk.
+        if (state_before_load == chunk_state::not_available) {
+            *_download_latency = load_time;
+        }
+        return;
+    }
+
+    // The reader consumed the previous chunk between the two loads.
+    _consume_time = now - load_time - loaded_previous_at;
+    const auto consume_time = std::max(
+      _consume_time, ss::lowres_clock::duration{1});
+    auto depth = static_cast<uint64_t>(
+      (*_download_latency + consume_time - ss::lowres_clock::duration{1})
+      / consume_time);
+    if (state_before_load == chunk_state::download_in_progress) {
+        // The reader caught up with a prefetch, look further ahead.
+        depth = std::max<uint64_t>(depth, _prefetch_depth + 1);
+    }
+    // Chunks prefetched past the hydrated chunks budget of the segment would
+    // be trimmed before they are read.
+    _prefetch_depth = static_cast<uint16_t>(std::clamp<uint64_t>(
+      depth,
+      1,
+      std::min<uint64_t>(max_depth, _segment.max_hydrated_chunks())));
+
+    auto window_end = chunk_start;
+    for (uint16_t i = 0; i < _prefetch_depth && window_end < _last_chunk_start;
+         ++i) {
+        window_end = _chunks.get_next_chunk_start(window_end);
+    }
+    auto start = std::max(chunk_start, _prefetched_until.value_or(0));
+    if (start >= window_end) {
+        return;
+    }
+    start = _chunks.get_next_chunk_start(start);
+    while (start < window_end
+           && _chunks.get(start).current_state != chunk_state::not_available) {
+        start = _chunks.get_next_chunk_start(start);
+    }
+    if (_chunks.get(start).current_state != chunk_state::not_available) {
+        _prefetched_until = window_end;
+        return;
+    }
+    uint16_t prefetch = 0;
+    for (auto c = start; c < window_end; c = _chunks.get_next_chunk_start(c)) {
+        ++prefetch;
+    }
+    _prefetched_until = window_end;
+
+    vlog(
+      _ctxlog.debug,
+      "prefetching chunks {} to {}, depth {}, consume time {}ms, download "
+      "latency {}ms",
+      start,
+      window_end,
+      _prefetch_depth,
+      std::chrono::duration_cast<std::chrono::milliseconds>(_consume_time)
+        .count(),
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+        *_download_latency)
+        .count());
+    ssx::background = _chunks.hydrate_chunk(start, prefetch)
+                        .then([latency = _download_latency,
+                               started = now](segment_chunk::handle_t) {
+                            *latency = ss::lowres_clock::now() - started;
+                        })
+                        .handle_exception([](const std::exception_ptr&) {
+                            // The reader retries the download once it gets
+                            // to the chunk.
+                        });
 }
 
 ss::future<> chunk_data_source_impl::close() {
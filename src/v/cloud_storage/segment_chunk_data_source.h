@@ -11,7 +11,10 @@
 
 #pragma once
 
+#include "bytes/iobuf.h"
+#include "cloud_storage/read_cost_table.h"
 #include "cloud_storage/segment_chunk_api.h"
+#include "config/property.h"
 #include "model/fundamental.h"
 
 #include <seastar/core/fstream.hh>
@@ -28,7 +31,8 @@ public:
       kafka::offset end,
       int64_t begin_stream_at,
       ss::file_input_stream_options stream_options,
-      std::optional<uint16_t> prefetch_override = std::nullopt);
+      std::optional<uint16_t> prefetch_override = std::nullopt,
+      std::optional<ts_reader_key> reader = std::nullopt);
 
     chunk_data_source_impl(const chunk_data_source_impl&) = delete;
     chunk_data_source_impl& operator=(const chunk_data_source_impl&) = delete;
@@ -51,6 +55,17 @@ private:
     ss::future<> maybe_close_stream();
     ss::future<> load_chunk_handle(chunk_start_offset_t chunk_start);
 
+    // Reads a whole chunk file into memory, to admit it to the hot tier.
+    ss::future<iobuf> read_chunk(ss::file&);
+
+    // Adapts the prefetch depth to the time it took to load the chunk starting
+    // at chunk_start and, once the reader moved past its first chunk, starts
+    // hydrating the chunks ahead of it in the background.
+    void maybe_prefetch(
+      chunk_start_offset_t chunk_start,
+      chunk_state state_before_load,
+      ss::lowres_clock::duration load_time);
+
     segment_chunks& _chunks;
     remote_segment& _segment;
 
@@ -70,6 +85,20 @@ private:
     retry_chain_node _rtc;
     retry_chain_logger _ctxlog;
     std::optional<uint16_t> _prefetch_override;
+
+    // Sequential prefetch state. The depth is the number of chunks hydrated
+    // ahead of the reader, sized so that the chunks arrive before the reader
+    // gets to them.
+    config::binding<uint16_t> _prefetch_max;
+    uint16_t _prefetch_depth{0};
+    ss::lowres_clock::time_point _chunk_loaded_at{};
+    ss::lowres_clock::duration _consume_time{};
+    // Shared with the background prefetches, which may outlive the source.
+    ss::lw_shared_ptr<ss::lowres_clock::duration> _download_latency;
+    std::optional<chunk_start_offset_t> _prefetched_until;
+
+    // The reader the loads of the chunks are accounted to
+    std::optional<ts_reader_key> _reader;
 };
 
 } // namespace cloud_storage
@@ -0,0 +1,139 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "cloud_storage/segment_packer.h"
+
+#include "base/vlog.h"
+#include "cloud_storage/logger.h"
+#include "cloud_storage/remote.h"
+#include "config/configuration.h"
+#include "hashing/xx.h"
+#include "ssx/future-util.h"
+#include "ssx/sformat.h"
+#include "utils/retry_chain_node.h"
+#include "utils/uuid.h"
+
+#include <seastar/core/coroutine.hh>
+
+namespace cloud_storage {
+
+segment_packer::segment_packer(remote& r)
+  : _remote(r)
+  , _max_segment_bytes(
+      config::shard_local_cfg().cloud_storage_segment_packing_max_bytes.bind())
+  , _object_size(config::shard_local_cfg()
+                   .cloud_storage_segment_packing_object_size.bind())
+  , _delay(
+      config::shard_local_cfg().cloud_storage_segment_packing_delay_ms.bind()) {
+    _timer.set_callback([this] {
+        if (_pending) {
+            flush();
+        }
+    });
+}
+
+ss::future<> segment_packer::stop() {
+    _timer.cancel();
+    _as.request_abort();
+    if (_pending) {
+        for (auto& w : _pending->waiters) {
+            w.set_value(upload_result::cancelled);
+        }
+        _pending.reset();
+    }
+    co_await _gate.close();
+}
+
+ss::sstring segment_packer::make_object_key() {
+    auto name = ssx::sformat("packed/{}.log", uuid_t::create());
+    uint32_t hash = xxhash_32(name.data(), name.size());
+    return ssx::sformat("{:08x}/{}", hash, name);
+}
+
+ss::future<std::optional<packed_segment_location>> segment_packer::pack(
+  const cloud_storage_clients::bucket_name& bucket, iobuf segment) {
+    auto holder = _gate.hold();
+    if (_pending && _pending->bucket != bucket) {
+        flush();
+    }
+    if (!_pending) {
+        _pending.emplace(pending_object{
+          .bucket = bucket,
+          .key = make_object_key(),
+        });
+        _timer.arm(_delay());
+    }
+    packed_segment_location location{
+      .object = _pending->key,
+      .offset = _pending->data.size_bytes(),
+    };
+    _pending->data.append(std::move(segment));
+    auto uploaded = _pending->waiters.emplace_back().get_future();
+    if (_pending->data.size_bytes() >= _object_size()) {
+        flush();
+    }
+
+    auto res = co_await std::move(uploaded);
+    if (res != upload_result::success) {
+        co_return std::nullopt;
+    }
+    co_return location;
+}
+
+void segment_packer::flush() {
+    _timer.cancel();
+    auto object = std::move(*_pending);
+    _pending.reset();
+    ssx::spawn_with_gate(_gate, [this, object = std::move(object)]() mutable {
+        return upload(std::move(object));
+    });
+}
+
+ss::future<> segment_packer::upload(pending_object object) {
+    const auto& cfg = config::shard_local_cfg();
+    retry_chain_node rtc(
+      _as,
+      cfg.cloud_storage_segment_upload_timeout_ms(),
+      cfg.cloud_storage_initial_backoff_ms());
+    vlog(
+      cst_log.debug,
+      "Uploading {} packed segments of {} bytes to {}",
+      object.waiters.size(),
+      object.data.size_bytes(),
+      object.key);
+
+    auto res = upload_result::failed;
+    try {
+        res = co_await _remote.upload_object({
+          .transfer_details = {
+            .bucket = object.bucket,
+            .key = cloud_storage_clients::object_key{object.key},
+            .parent_rtc = rtc,
+            .success_cb = [](auto& probe) { probe.successful_upload(); },
+            .failure_cb = [](auto& probe) { probe.failed_upload(); }},
+          .type = upload_type::object,
+          .payload = std::move(object.data),
+        });
+    } catch (...) {
+        vlog(
+          cst_log.warn,
+          "Failed to upload packed segments to {}: {}",
+          object.key,
+          std::current_exception());
+    }
+    if (res == upload_result::success) {
+        ++_objects_uploaded;
+    }
+    for (auto& w : object.waiters) {
+        w.set_value(res);
+    }
+}
+
+} // namespace cloud_storage
@@ -0,0 +1,94 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#pragma once
+
+#include "base/seastarx.h"
+#include "bytes/iobuf.h"
+#include "cloud_storage/fwd.h"
+#include "cloud_storage/types.h"
+#include "cloud_storage_clients/types.h"
+#include "config/property.h"
+
+#include <seastar/core/abort_source.hh>
+#include <seastar/core/future.hh>
+#include <seastar/core/gate.hh>
+#include <seastar/core/sstring.hh>
+#include <seastar/core/timer.hh>
+
+#include <chrono>
+#include <optional>
+#include <vector>
+
+namespace cloud_storage {
+
+/// Packs the small segments uploaded by the partitions of a shard into
+/// shared objects.
+///
+/// Partitions with little traffic upload a small segment every
+/// `cloud_storage_segment_max_upload_interval_sec`, and with thousands of
+/// them the PUT requests dominate the cost of the bucket. The segments given
+/// to the packer are appended to an object that is uploaded once it reaches
+/// `cloud_storage_segment_packing_object_size`, or once its first segment
+/// waited for `cloud_storage_segment_packing_delay_ms`. Each segment gets the
+/// location of its bytes in the object, which its partition records in the
+/// manifest, and readers fetch the segment with a ranged GET.
+class segment_packer {
+public:
+    explicit segment_packer(remote& r);
+
+    segment_packer(const segment_packer&) = delete;
+    segment_packer& operator=(const segment_packer&) = delete;
+    segment_packer(segment_packer&&) = delete;
+    segment_packer& operator=(segment_packer&&) = delete;
+    ~segment_packer() = default;
+
+    ss::future<> stop();
+
+    /// Whether a segment of \p size_bytes should be packed
+    bool should_pack(size_t size_bytes) const {
+        return size_bytes > 0 && size_bytes < _max_segment_bytes();
+    }
+
+    /// Pack \p segment into an object in \p bucket and wait until the object
+    /// is uploaded. Returns the location of the segment in the object, or
+    /// nullopt if the object could not be uploaded.
+    ss::future<std::optional<packed_segment_location>>
+    pack(const cloud_storage_clients::bucket_name& bucket, iobuf segment);
+
+    /// Number of objects of packed segments uploaded
+    uint64_t objects_uploaded() const { return _objects_uploaded; }
+
+private:
+    struct pending_object {
+        cloud_storage_clients::bucket_name bucket;
+        ss::sstring key;
+        iobuf data;
+        std::vector<ss::promise<upload_result>> waiters;
+    };
+
+    static ss::sstring make_object_key();
+
+    /// Start the upload of the pending object
+    void flush();
+    ss::future<> upload(pending_object);
+
+    remote& _remote;
+    config::binding<size_t> _max_segment_bytes;
+    config::binding<size_t> _object_size;
+    config::binding<std::chrono::milliseconds> _delay;
+    std::optional<pending_object> _pending;
+    ss::timer<> _timer;
+    uint64_t _objects_uploaded{0};
+    ss::abort_source _as;
+    ss::gate _gate;
+};
+
+} // namespace cloud_storage
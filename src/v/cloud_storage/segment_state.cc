@@ -30,7 +30,8 @@ materialized_segment_state::materialized_segment_state(
   const segment_meta& meta,
   const remote_segment_path& path,
   remote_partition& p,
-  ssx::semaphore_units u)
+  ssx::semaphore_units u,
+  std::optional<packed_segment_location> packed)
   : atime(ss::lowres_clock::now())
   , parent(p.weak_from_this())
   , _units(std::move(u)) {
@@ -43,7 +44,8 @@ materialized_segment_state::materialized_segment_state(
       meta,
       p._rtc,
       p._probe,
-      p._ts_probe);
+      p._ts_probe,
+      std::move(packed));
     p.materialized().register_segment(*this);
 }
 
@@ -37,7 +37,8 @@ struct materialized_segment_state {
       const segment_meta& meta,
       const remote_segment_path& path,
       remote_partition& p,
-      ssx::semaphore_units u);
+      ssx::semaphore_units u,
+      std::optional<packed_segment_location> packed = std::nullopt);
 
     void return_reader(std::unique_ptr<remote_segment_batch_reader> reader);
 
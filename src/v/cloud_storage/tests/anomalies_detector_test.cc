@@ -505,14 +505,13 @@ FIXTURE_TEST(test_no_anomalies, bucket_view_fixture) {
     }
 
     {
-        auto result = run_detector(archival::run_quota_t{5});
+        auto result = run_detector(archival::run_quota_t{3});
         BOOST_REQUIRE_EQUAL(
           result.status, cloud_storage::scrub_status::partial);
         BOOST_REQUIRE(!result.detected.has_value());
 
-        // We have a quota of 5 requests:
+        // We have a quota of 3 requests:
         // * 1 download request for the partitions manifest
-        // * 2 requests to check for the existence of spill manifests
         // * 2 requests to check for the existence of the segments in the stm
         // manifest
         BOOST_REQUIRE_EQUAL(
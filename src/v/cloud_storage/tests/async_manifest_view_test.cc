@@ -1171,3 +1171,47 @@ FIXTURE_TEST(
           .get();
     }
 }
+
+FIXTURE_TEST(
+  test_async_manifest_view_cursor_pool, async_manifest_view_fixture) {
+    // Released cursors are reused by the lookups which target the manifest
+    // they point at, the results should be the same as with the new cursors.
+    std::vector<segment_meta> expected;
+    collect_segments_to(expected);
+    generate_manifest_section(100);
+    generate_manifest_section(100);
+    generate_manifest_section(100);
+    generate_manifest_section(100);
+    generate_manifest_section(100);
+    generate_random_segments(stm_manifest, 10);
+    listen();
+
+    for (int i = 0; i < 2; i++) {
+        for (const auto& meta : expected) {
+            auto target = model::timestamp(meta.base_timestamp.value() - 1);
+            auto maybe_cursor = view.get_cursor(target).get();
+            BOOST_REQUIRE(!maybe_cursor.has_failure());
+            auto cursor = std::move(maybe_cursor.value());
+            cursor
+              ->with_manifest([&](const partition_manifest& m) {
+                  auto res = m.timequery(target);
+                  BOOST_REQUIRE(res.has_value());
+                  BOOST_REQUIRE(res.value().base_offset == meta.base_offset);
+              })
+              .get();
+            view.release_cursor(std::move(cursor));
+
+            maybe_cursor = view.get_cursor(meta.base_offset).get();
+            BOOST_REQUIRE(!maybe_cursor.has_failure());
+            cursor = std::move(maybe_cursor.value());
+            cursor
+              ->with_manifest([&](const partition_manifest& m) {
+                  auto it = m.find(meta.base_offset);
+                  BOOST_REQUIRE(it != m.end());
+                  BOOST_REQUIRE(*it == meta);
+              })
+              .get();
+            view.release_cursor(std::move(cursor));
+        }
+    }
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "cloud_storage/cache_index.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+
+using namespace cloud_storage;
+using namespace std::chrono_literals;
+
+namespace {
+const cache_index::clock::time_point t0{};
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_cache_index_coldest) {
+    cache_index index;
+    index.insert("/c/a", 10, t0 + 3s);
+    index.insert("/c/b", 20, t0 + 1s);
+    index.insert("/c/c", 30, t0 + 2s);
+    BOOST_REQUIRE_EQUAL(index.size(), 3);
+    BOOST_REQUIRE_EQUAL(index.size_bytes(), 60);
+
+    // enough files to cover the bytes, oldest first
+    auto coldest = index.coldest(25, 0);
+    BOOST_REQUIRE_EQUAL(coldest.size(), 2);
+    BOOST_REQUIRE_EQUAL(coldest[0].path, "/c/b");
+    BOOST_REQUIRE_EQUAL(coldest[1].path, "/c/c");
+
+    // a read makes a file the most recently accessed
+    index.touch("/c/b", t0 + 4s);
+    coldest = index.coldest(0, 1);
+    BOOST_REQUIRE_EQUAL(coldest.size(), 1);
+    BOOST_REQUIRE_EQUAL(coldest[0].path, "/c/c");
+
+    // access times never go back
+    index.touch("/c/b", t0);
+    BOOST_REQUIRE_EQUAL(index.coldest(0, 3).back().path, "/c/b");
+
+    index.remove("/c/c");
+    index.remove("/c/missing");
+    BOOST_REQUIRE_EQUAL(index.size(), 2);
+    BOOST_REQUIRE_EQUAL(index.size_bytes(), 30);
+    BOOST_REQUIRE_EQUAL(index.coldest(100, 0).size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(test_cache_index_update_and_merge) {
+    cache_index index;
+    index.insert("/c/a", 10, t0 + 1s);
+    // rewriting a file replaces its entry
+    index.insert("/c/a", 15, t0 + 2s);
+    BOOST_REQUIRE_EQUAL(index.size(), 1);
+    BOOST_REQUIRE_EQUAL(index.size_bytes(), 15);
+
+    index.insert("/c/b", 5, t0 + 5s);
+    cache_index rebuilt;
+    rebuilt.insert("/c/a", 15, t0 + 2s);
+    // only the files accessed since the walk started are carried over
+    rebuilt.merge_accessed_since(index, t0 + 3s);
+    BOOST_REQUIRE_EQUAL(rebuilt.size(), 2);
+    BOOST_REQUIRE_EQUAL(rebuilt.size_bytes(), 20);
+    BOOST_REQUIRE_EQUAL(rebuilt.coldest(0, 2).back().path, "/c/b");
+}
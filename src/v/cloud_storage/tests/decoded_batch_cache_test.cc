@@ -0,0 +1,112 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "bytes/iobuf.h"
+#include "cloud_storage/decoded_batch_cache.h"
+#include "config/configuration.h"
+#include "model/fundamental.h"
+#include "model/record.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace cloud_storage;
+
+namespace {
+
+iobuf make_records(size_t size) {
+    iobuf buf;
+    buf.append(ss::sstring(size, 'x').data(), size);
+    return buf;
+}
+
+model::record_batch_header make_header(
+  int64_t base,
+  int32_t records,
+  model::record_batch_type type = model::record_batch_type::raft_data) {
+    model::record_batch_header header{};
+    header.base_offset = model::offset(base);
+    header.last_offset_delta = records - 1;
+    header.record_count = records;
+    header.type = type;
+    return header;
+}
+
+struct batch_cache_config {
+    explicit batch_cache_config(size_t max_bytes) {
+        config::shard_local_cfg()
+          .cloud_storage_decoded_batch_cache_max_bytes.set_value(max_bytes);
+    }
+    ~batch_cache_config() {
+        config::shard_local_cfg()
+          .cloud_storage_decoded_batch_cache_max_bytes.reset();
+    }
+};
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(test_decoded_batch_cache_find) {
+    batch_cache_config cfg(100000);
+    decoded_batch_cache cache;
+
+    // data [10, 19], a configuration batch at 20, data [21, 30]
+    cache.put(make_header(10, 10), make_records(100), model::offset_delta(2));
+    cache.put(
+      make_header(20, 1, model::record_batch_type::raft_configuration),
+      std::nullopt,
+      model::offset_delta(2));
+    cache.put(make_header(21, 10), make_records(100), model::offset_delta(3));
+    BOOST_REQUIRE_EQUAL(cache.size(), 3);
+
+    // kafka offsets of the first batch are [8, 17], of the last [18, 27]
+    auto first = cache.find(kafka::offset(8));
+    BOOST_REQUIRE(first.has_value());
+    BOOST_REQUIRE_EQUAL(first->header.base_offset, model::offset(10));
+    BOOST_REQUIRE_EQUAL(first->records->size_bytes(), 100);
+
+    auto last = cache.find(kafka::offset(18));
+    BOOST_REQUIRE(last.has_value());
+    BOOST_REQUIRE_EQUAL(last->header.base_offset, model::offset(21));
+    BOOST_REQUIRE_EQUAL(last->delta, model::offset_delta(3));
+
+    // the batches holding these offsets are not cached
+    BOOST_REQUIRE(!cache.find(kafka::offset(7)).has_value());
+    BOOST_REQUIRE(!cache.find(kafka::offset(28)).has_value());
+
+    // the run continues past the configuration batch
+    auto next = cache.get(first->header.last_offset() + model::offset(1));
+    BOOST_REQUIRE(next.has_value());
+    BOOST_REQUIRE(!next->records.has_value());
+}
+
+SEASTAR_THREAD_TEST_CASE(test_decoded_batch_cache_eviction) {
+    batch_cache_config cfg(
+      2 * (sizeof(decoded_batch_cache::entry) + 100) + 50);
+    decoded_batch_cache cache;
+
+    cache.put(make_header(0, 10), std::nullopt, model::offset_delta(0));
+    // the records of a batch skipped by another reader are added
+    cache.put(make_header(0, 10), make_records(100), model::offset_delta(0));
+    BOOST_REQUIRE(cache.get(model::offset(0))->records.has_value());
+
+    cache.put(make_header(10, 10), make_records(100), model::offset_delta(0));
+    // the lowest offsets make room for new batches
+    cache.put(make_header(20, 10), make_records(100), model::offset_delta(0));
+    BOOST_REQUIRE_EQUAL(cache.size(), 2);
+    BOOST_REQUIRE(!cache.get(model::offset(0)).has_value());
+    BOOST_REQUIRE(cache.get(model::offset(20)).has_value());
+
+    // a disabled cache holds nothing
+    config::shard_local_cfg()
+      .cloud_storage_decoded_batch_cache_max_bytes.set_value(size_t{0});
+    cache.put(make_header(30, 10), make_records(100), model::offset_delta(0));
+    BOOST_REQUIRE(!cache.get(model::offset(30)).has_value());
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "bytes/iobuf.h"
+#include "cloud_storage/hot_tier.h"
+#include "config/configuration.h"
+#include "utils/adjustable_semaphore.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace cloud_storage;
+
+namespace {
+
+iobuf make_data(size_t size) {
+    iobuf buf;
+    buf.append(ss::sstring(size, 'x').data(), size);
+    return buf;
+}
+
+struct hot_tier_config {
+    explicit hot_tier_config(size_t max_bytes) {
+        config::shard_local_cfg().cloud_storage_hot_tier_max_bytes.set_value(
+          max_bytes);
+    }
+    ~hot_tier_config() {
+        config::shard_local_cfg().cloud_storage_hot_tier_max_bytes.reset();
+    }
+};
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(test_hot_tier_admission) {
+    hot_tier_config cfg(1000);
+    adjustable_semaphore memory(10000);
+    hot_tier tier(memory);
+    const std::filesystem::path key{"a/b_chunks/0"};
+
+    // a file read once is not admitted
+    BOOST_REQUIRE(!tier.get(key).has_value());
+    BOOST_REQUIRE(!tier.should_admit(key));
+
+    // the second read admits it
+    BOOST_REQUIRE(!tier.get(key).has_value());
+    BOOST_REQUIRE(tier.should_admit(key));
+    tier.put(key, make_data(100));
+    BOOST_REQUIRE_EQUAL(tier.size_bytes(), 100);
+    BOOST_REQUIRE_EQUAL(memory.current(), 9900);
+
+    auto hit = tier.get(key);
+    BOOST_REQUIRE(hit.has_value());
+    BOOST_REQUIRE_EQUAL(hit->size_bytes(), 100);
+    BOOST_REQUIRE_EQUAL(tier.hits(), 1);
+    BOOST_REQUIRE_EQUAL(tier.misses(), 2);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_hot_tier_eviction) {
+    hot_tier_config cfg(250);
+    adjustable_semaphore memory(10000);
+    hot_tier tier(memory);
+    const std::filesystem::path a{"a"}, b{"b"}, c{"c"};
+
+    tier.put(a, make_data(100));
+    tier.put(b, make_data(100));
+    // a is now the most recently used
+    BOOST_REQUIRE(tier.get(a).has_value());
+    // c exceeds the limit of the tier, and b is evicted for it
+    tier.put(c, make_data(100));
+    BOOST_REQUIRE_EQUAL(tier.size_bytes(), 200);
+    BOOST_REQUIRE(tier.get(a).has_value());
+    BOOST_REQUIRE(!tier.get(b).has_value());
+    BOOST_REQUIRE(tier.get(c).has_value());
+
+    // the readers need memory back
+    tier.release(10000);
+    BOOST_REQUIRE_EQUAL(tier.size_bytes(), 0);
+    BOOST_REQUIRE_EQUAL(memory.current(), 10000);
+
+    // a disabled tier holds nothing
+    config::shard_local_cfg().cloud_storage_hot_tier_max_bytes.set_value(
+      size_t{0});
+    tier.put(a, make_data(100));
+    BOOST_REQUIRE(!tier.get(a).has_value());
+}
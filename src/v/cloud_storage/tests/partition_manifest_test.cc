@@ -2656,3 +2656,58 @@ SEASTAR_THREAD_TEST_CASE(test_last_partition_scrub_json_serde) {
 
     BOOST_REQUIRE(manifest == manifest_after_round_trip);
 }
+
+SEASTAR_THREAD_TEST_CASE(test_packed_segments) {
+    partition_manifest m(manifest_ntp, model::initial_revision_id(0));
+    for (int64_t base : {1000, 2000, 3000}) {
+        m.add(
+          segment_name(fmt::format("{}-1-v1.log", base)),
+          {
+            .size_bytes = 100,
+            .base_offset = model::offset{base},
+            .committed_offset = model::offset{base + 999},
+          });
+    }
+    const packed_segment_location first{.object = "packed/a.log", .offset = 0};
+    const packed_segment_location second{
+      .object = "packed/a.log", .offset = 100};
+    m.add_packed_segment(model::offset{1000}, first);
+    m.add_packed_segment(model::offset{2000}, second);
+
+    auto seg = m.get(model::offset{2000}).value();
+    BOOST_REQUIRE_EQUAL(
+      m.segment_object_path(seg)().native(), std::string("packed/a.log"));
+    auto unpacked = m.get(model::offset{3000}).value();
+    BOOST_REQUIRE(!m.packed_segment(model::offset{3000}).has_value());
+    BOOST_REQUIRE_EQUAL(
+      m.segment_object_path(unpacked), m.generate_segment_path(unpacked));
+
+    // The locations survive serialization
+    auto [is, size] = m.serialize().get();
+    iobuf buf;
+    auto os = make_iobuf_ref_output_stream(buf);
+    ss::copy(is, os).get();
+    partition_manifest restored;
+    restored.update(make_iobuf_input_stream(std::move(buf))).get();
+    BOOST_REQUIRE(restored.packed_segment(model::offset{1000}) == first);
+    BOOST_REQUIRE(restored.packed_segment(model::offset{2000}) == second);
+    BOOST_REQUIRE(restored == m);
+
+    // A segment uploaded on its own replaces the packed one
+    m.add(
+      segment_name("2000-1-v1.log"),
+      {
+        .size_bytes = 80,
+        .base_offset = model::offset{2000},
+        .committed_offset = model::offset{2999},
+        .sname_format = segment_name_format::v2,
+      });
+    BOOST_REQUIRE(!m.packed_segment(model::offset{2000}).has_value());
+
+    // Truncated segments take their locations with them
+    BOOST_REQUIRE(m.advance_start_offset(model::offset{2000}));
+    auto removed = m.truncate();
+    BOOST_REQUIRE(!m.packed_segment(model::offset{1000}).has_value());
+    BOOST_REQUIRE(removed.packed_segment(model::offset{1000}) == first);
+    BOOST_REQUIRE_EQUAL(m.packed_segments().size(), 0);
+}
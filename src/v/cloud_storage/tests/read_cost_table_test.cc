@@ -0,0 +1,74 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "cloud_storage/read_cost_table.h"
+#include "model/namespace.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace cloud_storage;
+using namespace std::chrono_literals;
+
+namespace {
+
+ts_reader_key make_key(int partition, ss::sstring client) {
+    return {
+      .ntp = model::ntp(
+        model::kafka_namespace,
+        model::topic("tp"),
+        model::partition_id(partition)),
+      .client = std::move(client),
+    };
+}
+
+ts_read_cost gets(uint64_t n) {
+    return {.get_requests = n, .bytes_downloaded = n * 1024};
+}
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(test_read_cost_table_accumulates) {
+    ts_read_cost_table table;
+    table.add(make_key(0, "a"), gets(2));
+    table.add(make_key(0, "a"), {.cache_hits = 3, .hydration_wait = 10ms});
+    table.add(make_key(1, "a"), gets(1));
+
+    auto top = table.top(10);
+    BOOST_REQUIRE_EQUAL(top.size(), 2);
+    BOOST_REQUIRE(top[0].key == make_key(0, "a"));
+    BOOST_REQUIRE_EQUAL(top[0].cost.get_requests, 2);
+    BOOST_REQUIRE_EQUAL(top[0].cost.bytes_downloaded, 2048);
+    BOOST_REQUIRE_EQUAL(top[0].cost.cache_hits, 3);
+    BOOST_REQUIRE(top[0].cost.hydration_wait == 10ms);
+    BOOST_REQUIRE(top[1].key == make_key(1, "a"));
+
+    BOOST_REQUIRE_EQUAL(table.top(1).size(), 1);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_read_cost_table_keeps_heavy_hitters) {
+    ts_read_cost_table table(4);
+    table.add(make_key(0, "heavy"), gets(100));
+    for (int i = 0; i < 100; ++i) {
+        table.add(make_key(i, "light"), gets(1));
+    }
+    BOOST_REQUIRE_EQUAL(table.size(), 4);
+
+    auto top = table.top(4);
+    BOOST_REQUIRE(top[0].key == make_key(0, "heavy"));
+    BOOST_REQUIRE_EQUAL(top[0].cost.get_requests, 100);
+    // The light readers inherit the cost of the ones they evicted
+    uint64_t total = 0;
+    for (const auto& e : top) {
+        total += e.cost.get_requests;
+    }
+    BOOST_REQUIRE_EQUAL(total, 200);
+}
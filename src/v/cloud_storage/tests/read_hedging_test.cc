@@ -0,0 +1,99 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "cloud_storage/read_hedging.h"
+#include "config/configuration.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace cloud_storage;
+using namespace std::chrono_literals;
+
+namespace {
+
+struct hedging_config {
+    hedging_config(double percentile, double budget_ratio) {
+        auto& cfg = config::shard_local_cfg();
+        cfg.cloud_storage_hedged_read_percentile.set_value(percentile);
+        cfg.cloud_storage_hedged_read_budget_ratio.set_value(budget_ratio);
+    }
+    ~hedging_config() {
+        auto& cfg = config::shard_local_cfg();
+        cfg.cloud_storage_hedged_read_percentile.reset();
+        cfg.cloud_storage_hedged_read_budget_ratio.reset();
+    }
+};
+
+void record_range(read_hedging_policy& policy, size_t count) {
+    for (size_t i = 1; i <= count; ++i) {
+        policy.record(std::chrono::microseconds(i * 1000));
+    }
+}
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(test_read_hedging_disabled) {
+    read_hedging_policy policy;
+    record_range(policy, read_hedging_policy::max_samples);
+    BOOST_REQUIRE(!policy.start_request().has_value());
+}
+
+SEASTAR_THREAD_TEST_CASE(test_read_hedging_threshold) {
+    hedging_config cfg(90.0, 1.0);
+    read_hedging_policy policy;
+
+    // no threshold until enough requests were measured
+    record_range(policy, read_hedging_policy::recompute_interval);
+    BOOST_REQUIRE(!policy.start_request().has_value());
+
+    // the ring holds samples of 1ms to 1024ms
+    record_range(policy, read_hedging_policy::max_samples);
+    auto delay = policy.start_request();
+    BOOST_REQUIRE(delay.has_value());
+    BOOST_REQUIRE_EQUAL(delay->count(), 922000);
+
+    // once the ring is filled with fast requests the threshold drops
+    for (size_t i = 0; i < read_hedging_policy::max_samples; ++i) {
+        policy.record(1ms);
+    }
+    BOOST_REQUIRE_EQUAL(policy.start_request().value().count(), 1000);
+
+    // changing the percentile applies to the recorded samples
+    config::shard_local_cfg().cloud_storage_hedged_read_percentile.set_value(
+      0.0);
+    BOOST_REQUIRE(!policy.threshold().has_value());
+}
+
+SEASTAR_THREAD_TEST_CASE(test_read_hedging_budget) {
+    hedging_config cfg(50.0, 0.25);
+    read_hedging_policy policy;
+    record_range(policy, read_hedging_policy::max_samples);
+
+    // every four requests pay for one hedge
+    BOOST_REQUIRE(!policy.try_hedge());
+    for (int i = 0; i < 4; ++i) {
+        policy.start_request();
+    }
+    BOOST_REQUIRE(policy.try_hedge());
+    BOOST_REQUIRE(!policy.try_hedge());
+
+    // the budget is capped to bound bursts of hedges
+    for (int i = 0; i < 1000; ++i) {
+        policy.start_request();
+    }
+    int hedges = 0;
+    while (policy.try_hedge()) {
+        ++hedges;
+    }
+    BOOST_REQUIRE_EQUAL(
+      hedges, static_cast<int>(read_hedging_policy::max_tokens));
+}
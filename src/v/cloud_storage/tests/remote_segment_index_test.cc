@@ -317,3 +317,99 @@ SEASTAR_THREAD_TEST_CASE(
         BOOST_REQUIRE_GT(it_b->second, it_a->second);
     }
 }
+
+BOOST_AUTO_TEST_CASE(remote_segment_index_append_test) {
+    // Two indexes of adjacent segments with 100 and 37 samples. Neither is a
+    // multiple of the row width, so that the write buffers are merged too.
+    constexpr int64_t step = 1000;
+    constexpr int64_t first_size = 100 * step;
+    offset_index first(
+      model::offset{0}, kafka::offset{0}, 0, step, model::timestamp{0});
+    offset_index second(
+      model::offset{100}, kafka::offset{100}, 0, step, model::timestamp{100});
+    for (int64_t i = 0; i < 100; i++) {
+        first.add(
+          model::offset{i},
+          kafka::offset{i},
+          (i + 1) * step,
+          model::timestamp{i});
+    }
+    for (int64_t i = 0; i < 37; i++) {
+        second.add(
+          model::offset{100 + i},
+          kafka::offset{100 + i},
+          (i + 1) * step,
+          model::timestamp{100 + i});
+    }
+
+    first.append(second, first_size);
+
+    for (int64_t i = 1; i < 137; i++) {
+        auto res = first.find_rp_offset(model::offset{i});
+        BOOST_REQUIRE(res.has_value());
+        BOOST_REQUIRE_EQUAL(res->rp_offset, model::offset{i - 1});
+        BOOST_REQUIRE_EQUAL(res->kaf_offset, kafka::offset{i - 1});
+        BOOST_REQUIRE_EQUAL(res->file_pos, i * step);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(remote_segment_index_v2_format_test) {
+    // 1000 samples are 62 full rows and a write buffer with 8 elements. With
+    // 4 rows per block the v2 object has 16 blocks and the last one is short.
+    constexpr int64_t step = 1000;
+    constexpr int64_t num_samples = 1000;
+    offset_index index(
+      model::offset{0}, kafka::offset{0}, 0, step, model::timestamp{0});
+    for (int64_t i = 0; i < num_samples; i++) {
+        index.add(
+          model::offset{i * 2},
+          kafka::offset{i},
+          (i + 1) * step,
+          model::timestamp{i * 2});
+    }
+    auto v2 = index.to_iobuf_v2(4);
+
+    offset_index decoded(
+      model::offset{}, kafka::offset{}, 0, 0, model::timestamp{});
+    decoded.from_iobuf(v2.copy());
+    for (int64_t i = 0; i < num_samples; i++) {
+        auto res = decoded.find_rp_offset(model::offset{i * 2 + 1});
+        BOOST_REQUIRE(res.has_value());
+        BOOST_REQUIRE_EQUAL(res->rp_offset, model::offset{i * 2});
+        BOOST_REQUIRE_EQUAL(res->kaf_offset, kafka::offset{i});
+        BOOST_REQUIRE_EQUAL(res->file_pos, (i + 1) * step);
+        auto kres = decoded.find_kaf_offset(kafka::offset{i + 1});
+        BOOST_REQUIRE(kres.has_value());
+        BOOST_REQUIRE_EQUAL(kres->rp_offset, model::offset{i * 2});
+    }
+
+    // Read the footer and then only the block which contains the entry
+    auto size = v2.size_bytes();
+    auto footer_size = offset_index::parse_v2_trailer(v2.share(
+      size - offset_index::v2_trailer_size, offset_index::v2_trailer_size));
+    BOOST_REQUIRE(footer_size.has_value());
+    auto footer = offset_index::parse_v2_footer(v2.share(
+      size - offset_index::v2_trailer_size - *footer_size, *footer_size));
+    BOOST_REQUIRE_EQUAL(footer.blocks.size(), 16);
+    auto v1 = index.to_iobuf();
+    BOOST_REQUIRE(!offset_index::parse_v2_trailer(v1.share(
+                     v1.size_bytes() - offset_index::v2_trailer_size,
+                     offset_index::v2_trailer_size))
+                     .has_value());
+    for (int64_t i = 0; i < num_samples; i++) {
+        model::offset query{i * 2 + 1};
+        auto block_ix = footer.find_block(query);
+        const auto& meta = footer.blocks.at(block_ix);
+        auto block = offset_index::from_v2_block(
+          footer, block_ix, v2.share(meta.offset, meta.size));
+        auto res = block.find_rp_offset(query);
+        if (res.has_value()) {
+            BOOST_REQUIRE_EQUAL(res->rp_offset, model::offset{i * 2});
+            BOOST_REQUIRE_EQUAL(res->file_pos, (i + 1) * step);
+        } else {
+            // The entry is the last one of the previous block
+            BOOST_REQUIRE_EQUAL(meta.initial_rp, i * 2);
+            BOOST_REQUIRE_EQUAL(meta.initial_file, (i + 1) * step);
+        }
+    }
+}
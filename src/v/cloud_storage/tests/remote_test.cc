@@ -707,6 +707,45 @@ FIXTURE_TEST(test_list_bucket_with_filter, remote_fixture) {
     BOOST_REQUIRE_EQUAL(items[0].key, "b");
 }
 
+FIXTURE_TEST(test_list_bucket_paged, remote_fixture) {
+    set_expectations_and_listen({});
+    retry_chain_node fib(never_abort, 100ms, 20ms);
+    cloud_storage_clients::bucket_name bucket{"test"};
+    for (const char name : {'a', 'b', 'c'}) {
+        cloud_storage_clients::object_key path{fmt::format("{}", name)};
+        auto result
+          = remote.local()
+              .upload_object(
+                {.transfer_details
+                 = {.bucket = bucket, .key = path, .parent_rtc = fib},
+                 .payload = iobuf{}})
+              .get();
+        BOOST_REQUIRE_EQUAL(cloud_storage::upload_result::success, result);
+    }
+
+    std::vector<ss::sstring> keys;
+    size_t pages = 0;
+    auto result = remote.local()
+                    .list_objects_paged(
+                      bucket,
+                      fib,
+                      [&](cloud_storage_clients::client::list_bucket_result
+                            page) {
+                          ++pages;
+                          for (auto& item : page.contents) {
+                              keys.push_back(std::move(item.key));
+                          }
+                          return ss::make_ready_future<ss::stop_iteration>(
+                            ss::stop_iteration::yes);
+                      })
+                    .get();
+    BOOST_REQUIRE(result.has_value());
+    BOOST_REQUIRE_EQUAL(pages, 1);
+    std::vector<ss::sstring> expected{"a", "b", "c"};
+    BOOST_REQUIRE_EQUAL_COLLECTIONS(
+      keys.begin(), keys.end(), expected.begin(), expected.end());
+}
+
 FIXTURE_TEST(test_put_string, remote_fixture) {
     set_expectations_and_listen({});
     auto conf = get_configuration();
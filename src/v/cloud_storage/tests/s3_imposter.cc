@@ -16,11 +16,13 @@
 #include "cloud_storage/types.h"
 #include "cloud_storage_clients/client.h"
 #include "cloud_storage_clients/client_probe.h"
+#include "random/generators.h"
 #include "test_utils/async.h"
 #include "test_utils/test_macros.h"
 
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/iostream.hh>
+#include <seastar/core/sleep.hh>
 #include <seastar/core/temporary_buffer.hh>
 #include <seastar/http/function_handlers.hh>
 #include <seastar/net/socket_defs.hh>
@@ -168,6 +170,42 @@ struct s3_imposter_fixture::content_handler {
     using const_req = const ss::http::request&;
     using reply = ss::http::reply;
 
+    static constexpr auto slow_down_response
+      = R"xml(<?xml version="1.0" encoding="UTF-8"?>
+                        <Error>
+                            <Code>SlowDown</Code>
+                            <Message>Object not found</Message>
+                            <Resource>resource</Resource>
+                            <RequestId>requestid</RequestId>
+                        </Error>)xml";
+
+    /// Handle the request as an object store described by the network
+    /// model of the fixture would
+    ss::future<std::unique_ptr<reply>> handle_with_model(
+      std::unique_ptr<ss::http::request> request,
+      std::unique_ptr<reply> repl) {
+        auto model = fixture._network_model;
+        if (model.max_latency > 0us) {
+            co_await ss::sleep(
+              std::chrono::microseconds(random_generators::get_int<int64_t>(
+                model.min_latency.count(), model.max_latency.count())));
+        }
+        if (
+          model.error_rate > 0.0
+          && random_generators::get_real<double>() < model.error_rate) {
+            repl->set_status(reply::status_type::service_unavailable);
+            repl->_content = slow_down_response;
+            co_return repl;
+        }
+        repl->_content += handle(*request, *repl);
+        if (model.bytes_per_sec > 0) {
+            auto transferred = request->content.size() + repl->_content.size();
+            co_await ss::sleep(std::chrono::microseconds(
+              transferred * 1000000 / model.bytes_per_sec));
+        }
+        co_return repl;
+    }
+
     ss::sstring handle(const_req request, reply& repl) {
         static constexpr auto error_payload
           = R"xml(<?xml version="1.0" encoding="UTF-8"?>
@@ -177,14 +215,6 @@ struct s3_imposter_fixture::content_handler {
                             <Resource>resource</Resource>
                             <RequestId>requestid</RequestId>
                         </Error>)xml";
-        static constexpr auto slow_down_response
-          = R"xml(<?xml version="1.0" encoding="UTF-8"?>
-                            <Error>
-                                <Code>SlowDown</Code>
-                                <Message>Object not found</Message>
-                                <Resource>resource</Resource>
-                                <RequestId>requestid</RequestId>
-                            </Error>)xml";
         http_test_utils::request_info ri(request);
 
         if (headers) {
@@ -419,8 +449,10 @@ void s3_imposter_fixture::set_routes(
     _content_handler = ss::make_shared<content_handler>(
       expectations, *this, std::move(headers_to_store));
     _handler = std::make_unique<function_handler>(
-      [this](const_req req, reply& repl) {
-          return _content_handler->handle(req, repl);
+      [this](
+        std::unique_ptr<ss::http::request> req, std::unique_ptr<reply> repl) {
+          return _content_handler->handle_with_model(
+            std::move(req), std::move(repl));
       },
       "txt");
     r.add_default_handler(_handler.get());
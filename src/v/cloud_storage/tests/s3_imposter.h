@@ -95,6 +95,20 @@ public:
 
     void set_search_on_get_list(bool should) { _search_on_get_list = should; }
 
+    /// Latency, bandwidth and errors of an object store which the imposter
+    /// applies to every request. The default model replies immediately.
+    struct network_model {
+        /// Time to first byte is uniformly distributed in this range
+        std::chrono::microseconds min_latency{0};
+        std::chrono::microseconds max_latency{0};
+        /// Transfer rate of the payload of a request, zero is unlimited
+        size_t bytes_per_sec{0};
+        /// Probability of a request to be throttled with a SlowDown error
+        double error_rate{0.0};
+    };
+
+    void set_network_model(network_model model) { _network_model = model; }
+
 private:
     void set_routes(
       ss::httpd::routes& r,
@@ -117,6 +131,8 @@ private:
     /// Whether or not to search through expectations for content when handling
     /// a list GET request.
     bool _search_on_get_list{true};
+
+    network_model _network_model;
 };
 
 class enable_cloud_storage_fixture {
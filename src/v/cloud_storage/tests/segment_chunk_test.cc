@@ -290,3 +290,43 @@ SEASTAR_THREAD_TEST_CASE(test_chunk_range_calculations) {
         BOOST_REQUIRE(std::next(it) == range.end());
     }
 }
+
+SEASTAR_THREAD_TEST_CASE(test_chunk_range_split) {
+    segment_chunks::chunk_map_t chunks;
+    auto handle = ss::make_lw_shared(ss::file{});
+    for (chunk_start_offset_t start = 0; start < 100; start += 10) {
+        chunks.insert({start, segment_chunk{.handle = handle}});
+    }
+
+    {
+        // seven chunks from 30 to the end of the segment, in three ranges
+        segment_chunk_range range{chunks, 111110, 30};
+        auto ranges = std::move(range).split(3);
+        BOOST_REQUIRE_EQUAL(ranges.size(), 3);
+        BOOST_REQUIRE_EQUAL(ranges[0].first_offset(), 30);
+        BOOST_REQUIRE_EQUAL(ranges[0].last_offset().value(), 59);
+        BOOST_REQUIRE_EQUAL(ranges[1].first_offset(), 60);
+        BOOST_REQUIRE_EQUAL(ranges[1].last_offset().value(), 89);
+        BOOST_REQUIRE_EQUAL(ranges[2].first_offset(), 90);
+        BOOST_REQUIRE(!ranges[2].last_offset().has_value());
+        BOOST_REQUIRE_EQUAL(ranges[2].chunk_count(), 1);
+    }
+
+    {
+        // never more ranges than chunks
+        segment_chunk_range range{chunks, 1, 30};
+        auto ranges = std::move(range).split(8);
+        BOOST_REQUIRE_EQUAL(ranges.size(), 2);
+        BOOST_REQUIRE_EQUAL(ranges[0].last_offset().value(), 39);
+        BOOST_REQUIRE_EQUAL(ranges[1].first_offset(), 40);
+    }
+
+    {
+        // no split
+        segment_chunk_range range{chunks, 3, 30};
+        auto ranges = std::move(range).split(0);
+        BOOST_REQUIRE_EQUAL(ranges.size(), 1);
+        BOOST_REQUIRE_EQUAL(ranges[0].chunk_count(), 4);
+        BOOST_REQUIRE_EQUAL(ranges[0].last_offset().value(), 69);
+    }
+}
@@ -286,6 +286,46 @@ void cs_deserialize_test(auto& store, size_t sz) {
     store.from_iobuf(std::move(buf));
     perf_tests::stop_measuring_time();
 }
+template<class ColumnT>
+ColumnT make_column(size_t sz) {
+    namespace rg = random_generators;
+    ColumnT column;
+    int64_t value = 0;
+    for (size_t i = 0; i < sz; i++) {
+        column.append(value);
+        value += rg::get_int(1, 1000);
+    }
+    return column;
+}
+
+/// Decode every value of a single column, this is dominated by the
+/// unpacking of the rows
+template<class ColumnT>
+void column_decode_test(size_t sz) {
+    auto column = make_column<ColumnT>(sz);
+
+    perf_tests::start_measuring_time();
+    for (auto v : column) {
+        perf_tests::do_not_optimize(v);
+    }
+    perf_tests::stop_measuring_time();
+}
+
+/// Search the end of a single large frame, this is dominated by the scan
+/// inside of the frame
+template<class ColumnT>
+void column_lower_bound_test(size_t sz) {
+    auto column = make_column<ColumnT>(sz);
+    auto last = *column.at_index(sz - 1);
+
+    perf_tests::start_measuring_time();
+    for (int64_t i = 0; i < 20; i++) {
+        auto it = column.lower_bound(last - i * 100);
+        perf_tests::do_not_optimize(it);
+    }
+    perf_tests::stop_measuring_time();
+}
+
 PERF_TEST(cstore_bench, column_store_append_baseline) {
     baseline_column_store store;
     cs_append_test(store, 10000);
@@ -374,3 +414,16 @@ PERF_TEST(cstore_bench, column_store_deserialize_result) {
     segment_meta_cstore store;
     cs_deserialize_test(store, 10000);
 }
+
+PERF_TEST(cstore_bench, counter_column_decode) {
+    column_decode_test<segment_meta_cstore::counter_col_t>(100000);
+}
+
+PERF_TEST(cstore_bench, gauge_column_decode) {
+    column_decode_test<segment_meta_cstore::gauge_col_t>(100000);
+}
+
+PERF_TEST(cstore_bench, counter_column_lower_bound) {
+    column_lower_bound_test<segment_meta_cstore::counter_col_t>(
+      cloud_storage::cstore_max_frame_size);
+}
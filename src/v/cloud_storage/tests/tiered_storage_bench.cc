@@ -0,0 +1,229 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "base/units.h"
+#include "bytes/iostream.h"
+#include "cloud_storage/async_manifest_view.h"
+#include "cloud_storage/remote.h"
+#include "cloud_storage/remote_partition.h"
+#include "cloud_storage/tests/cloud_storage_fixture.h"
+#include "cloud_storage/tests/common_def.h"
+#include "cloud_storage/tests/util.h"
+#include "model/timeout_clock.h"
+#include "ssx/sformat.h"
+#include "storage/segment_reader.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/coroutine/parallel_for_each.hh>
+#include <seastar/testing/perf_tests.hh>
+
+#include <boost/range/irange.hpp>
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+using namespace std::chrono_literals;
+using namespace cloud_storage;
+
+namespace {
+
+constexpr int num_segments = 8;
+constexpr int num_batches_per_segment = 64;
+constexpr size_t uploads_per_run = 32;
+
+const cloud_storage_clients::bucket_name bucket("bucket");
+
+using bench_clock = std::chrono::steady_clock;
+using network_model = s3_imposter_fixture::network_model;
+
+/// An object store in the same network
+constexpr network_model lan{
+  .min_latency = 100us,
+  .max_latency = 500us,
+};
+
+/// An object store in the same region
+constexpr network_model region{
+  .min_latency = 10ms,
+  .max_latency = 50ms,
+  .bytes_per_sec = 100_MiB,
+};
+
+/// An object store in the same region which throttles some of the requests
+constexpr network_model region_throttled{
+  .min_latency = 10ms,
+  .max_latency = 50ms,
+  .bytes_per_sec = 100_MiB,
+  .error_rate = 0.05,
+};
+
+struct scan_consumer {
+    ss::future<ss::stop_iteration> operator()(model::record_batch b) {
+        if (!first_batch.has_value()) {
+            first_batch = bench_clock::now();
+        }
+        bytes += b.size_bytes();
+        co_return ss::stop_iteration::no;
+    }
+    scan_consumer end_of_stream() { return *this; }
+
+    std::optional<bench_clock::time_point> first_batch;
+    size_t bytes{0};
+};
+
+template<class Duration>
+double percentile_ms(std::vector<Duration> samples, double p) {
+    if (samples.empty()) {
+        return 0.0;
+    }
+    auto ix = std::min(
+      samples.size() - 1,
+      static_cast<size_t>(static_cast<double>(samples.size()) * p));
+    std::nth_element(samples.begin(), samples.begin() + ix, samples.end());
+    return std::chrono::duration<double, std::milli>(samples[ix]).count();
+}
+
+} // namespace
+
+/*
+ * A partition in the S3 imposter which replies as described by a network
+ * model. Reads of the partition always start with an empty cache, so every
+ * run measures the hydration of all of its segments. The results which
+ * perf_tests can't measure are printed when the benchmark is done.
+ */
+struct tiered_storage_bench : cloud_storage_fixture {
+    tiered_storage_bench()
+      : segments(
+          setup_s3_imposter(*this, num_segments, num_batches_per_segment))
+      , manifest(hydrate_manifest(api.local(), bucket)) {}
+
+    tiered_storage_bench(const tiered_storage_bench&) = delete;
+    tiered_storage_bench& operator=(const tiered_storage_bench&) = delete;
+    tiered_storage_bench(tiered_storage_bench&&) = delete;
+    tiered_storage_bench& operator=(tiered_storage_bench&&) = delete;
+
+    ~tiered_storage_bench() {
+        if (!first_batch_latency.empty()) {
+            fmt::print(
+              "hydration: {:.2f} MiB/s, time to first batch p50 {:.2f}ms "
+              "p99 {:.2f}ms\n",
+              static_cast<double>(bytes_read) / 1_MiB
+                / std::chrono::duration<double>(read_time).count(),
+              percentile_ms(first_batch_latency, 0.5),
+              percentile_ms(first_batch_latency, 0.99));
+        }
+        if (!upload_lag.empty()) {
+            fmt::print(
+              "upload lag: p50 {:.2f}ms p99 {:.2f}ms\n",
+              percentile_ms(upload_lag, 0.5),
+              percentile_ms(upload_lag, 0.99));
+        }
+    }
+
+    /// Read the whole partition with an empty cache, returns the number of
+    /// hydrated segments
+    ss::future<size_t> read(network_model model) {
+        co_await cache.local().trim_manually(0, 0);
+        set_network_model(model);
+
+        partition_probe probe(manifest.get_ntp());
+        auto view = ss::make_shared<async_manifest_view>(
+          api, cache, manifest, bucket);
+        auto partition = ss::make_shared<remote_partition>(
+          view, api.local(), cache.local(), bucket, probe);
+        co_await partition->start();
+
+        storage::log_reader_config cfg(
+          model::offset(0), model::offset::max(), ss::default_priority_class());
+        perf_tests::start_measuring_time();
+        auto start = bench_clock::now();
+        auto reader = (co_await partition->make_reader(cfg)).reader;
+        auto res = co_await reader.consume(scan_consumer{}, model::no_timeout);
+        auto end = bench_clock::now();
+        perf_tests::stop_measuring_time();
+        std::move(reader).release();
+
+        co_await partition->stop();
+        bytes_read += res.bytes;
+        read_time += end - start;
+        if (res.first_batch.has_value()) {
+            first_batch_latency.push_back(*res.first_batch - start);
+        }
+        co_return num_segments;
+    }
+
+    /// Upload 'uploads_per_run' segments concurrently
+    ss::future<size_t> upload(network_model model) {
+        set_network_model(model);
+        const auto& payload = segments.front().bytes;
+        auto reset_stream = [&payload]()
+          -> ss::future<std::unique_ptr<storage::stream_provider>> {
+            iobuf out;
+            out.append(payload.data(), payload.size());
+            co_return std::make_unique<storage::segment_reader_handle>(
+              make_iobuf_input_stream(std::move(out)));
+        };
+        auto run = num_runs++;
+
+        perf_tests::start_measuring_time();
+        co_await ss::coroutine::parallel_for_each(
+          boost::irange(uploads_per_run), [&](size_t i) -> ss::future<> {
+              remote_segment_path path(
+                ssx::sformat("bench/{}/{}.log", run, i));
+              retry_chain_node rtc(as, 300s, 100ms);
+              lazy_abort_source never_abort{
+                []() { return std::optional<ss::sstring>(); }};
+              auto start = bench_clock::now();
+              auto res = co_await api.local().upload_segment(
+                bucket, path, payload.size(), reset_stream, rtc, never_abort);
+              if (res == upload_result::success) {
+                  upload_lag.push_back(bench_clock::now() - start);
+              }
+          });
+        perf_tests::stop_measuring_time();
+        co_return uploads_per_run;
+    }
+
+    std::vector<in_memory_segment> segments;
+    partition_manifest manifest;
+    ss::abort_source as;
+    size_t num_runs{0};
+
+    size_t bytes_read{0};
+    bench_clock::duration read_time{0};
+    std::vector<bench_clock::duration> first_batch_latency;
+    std::vector<bench_clock::duration> upload_lag;
+};
+
+PERF_TEST_C(tiered_storage_bench, hydrate_lan) {
+    co_return co_await read(lan);
+}
+
+PERF_TEST_C(tiered_storage_bench, hydrate_region) {
+    co_return co_await read(region);
+}
+
+PERF_TEST_C(tiered_storage_bench, hydrate_region_throttled) {
+    co_return co_await read(region_throttled);
+}
+
+PERF_TEST_C(tiered_storage_bench, upload_lan) {
+    co_return co_await upload(lan);
+}
+
+PERF_TEST_C(tiered_storage_bench, upload_region) {
+    co_return co_await upload(region);
+}
+
+PERF_TEST_C(tiered_storage_bench, upload_region_throttled) {
+    co_return co_await upload(region_throttled);
+}
@@ -73,6 +73,11 @@ std::ostream& operator<<(std::ostream& o, const segment_meta& s) {
     return o;
 }
 
+std::ostream& operator<<(std::ostream& o, const packed_segment_location& r) {
+    fmt::print(o, "{{object: {}, offset: {}}}", r.object, r.offset);
+    return o;
+}
+
 std::ostream& operator<<(std::ostream& o, const segment_name_format& r) {
     switch (r) {
     case segment_name_format::v1:
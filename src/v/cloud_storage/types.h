@@ -215,6 +215,23 @@ struct segment_meta {
 };
 std::ostream& operator<<(std::ostream& o, const segment_meta& r);
 
+/// Location of a segment that was uploaded packed together with segments of
+/// other partitions into a shared object. The segment occupies `size_bytes`
+/// of its segment_meta starting at `offset` in the object.
+struct packed_segment_location
+  : serde::envelope<
+      packed_segment_location,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    ss::sstring object;
+    uint64_t offset{0};
+
+    auto serde_fields() { return std::tie(object, offset); }
+
+    bool operator==(const packed_segment_location&) const = default;
+};
+std::ostream& operator<<(std::ostream& o, const packed_segment_location& r);
+
 enum class error_outcome {
     // Represent general failure that can't be handled and doesn't fit into
     // any particular category (like download failure)
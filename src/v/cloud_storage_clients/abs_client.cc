@@ -21,7 +21,9 @@
 #include "config/configuration.h"
 #include "json/document.h"
 #include "json/istreamwrapper.h"
+#include "utils/base64.h"
 
+#include <ranges>
 #include <utility>
 
 namespace {
@@ -45,12 +47,26 @@ constexpr std::array<boost::beast::http::status, 6> retryable_http_codes = {
 constexpr boost::beast::string_view content_type_value = "text/plain";
 constexpr boost::beast::string_view blob_type_value = "BlockBlob";
 constexpr boost::beast::string_view blob_type_name = "x-ms-blob-type";
+constexpr boost::beast::string_view blob_content_type_name
+  = "x-ms-blob-content-type";
 constexpr boost::beast::string_view delete_snapshot_name
   = "x-ms-delete-snapshots";
 constexpr boost::beast::string_view is_hns_enabled_name = "x-ms-is-hns-enabled";
 constexpr boost::beast::string_view delete_snapshot_value = "include";
 constexpr boost::beast::string_view error_code_name = "x-ms-error-code";
 constexpr boost::beast::string_view content_type_name = "Content-Type";
+constexpr boost::beast::string_view copy_source_name = "x-ms-copy-source";
+constexpr boost::beast::string_view copy_source_authorization_name
+  = "x-ms-copy-source-authorization";
+constexpr std::string_view bearer_prefix = "Bearer ";
+
+// All the block ids of a blob must have the same length. The base64 of six
+// digits has no padding nor characters to escape in the query.
+ss::sstring make_block_id(uint32_t part_number) {
+    const auto id = fmt::format("{:06}", part_number);
+    return bytes_to_base64(
+      bytes_view(reinterpret_cast<const uint8_t*>(id.data()), id.size()));
+}
 
 bool is_error_retryable(
   const cloud_storage_clients::abs_rest_error_response& err) {
@@ -229,6 +245,113 @@ result<http::client::request_header> abs_request_creator::make_put_blob_request(
     return header;
 }
 
+result<http::client::request_header>
+abs_request_creator::make_put_block_request(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& block_id,
+  size_t payload_size_bytes) {
+    // PUT /{container-id}/{blob-id}?comp=block&blockid={block-id} HTTP/1.1
+    // Host: {storage-account-id}.blob.core.windows.net
+    // x-ms-date:{req-datetime in RFC9110} # added by 'add_auth'
+    // x-ms-version:"2023-01-23"           # added by 'add_auth'
+    // Authorization:{signature}           # added by 'add_auth'
+    // Content-Length:{payload-size}
+    const auto target = fmt::format(
+      "/{}/{}?comp=block&blockid={}", name(), key().string(), block_id);
+    const boost::beast::string_view host{_ap().data(), _ap().length()};
+
+    http::client::request_header header{};
+    header.method(boost::beast::http::verb::put);
+    header.target(target);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(
+      boost::beast::http::field::content_length,
+      std::to_string(payload_size_bytes));
+
+    auto error_code = _apply_credentials->add_auth(header);
+    if (error_code) {
+        return error_code;
+    }
+
+    return header;
+}
+
+result<http::client::request_header>
+abs_request_creator::make_put_block_from_url_request(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& block_id,
+  object_key const& source) {
+    // PUT /{container-id}/{blob-id}?comp=block&blockid={block-id} HTTP/1.1
+    // Host: {storage-account-id}.blob.core.windows.net
+    // x-ms-date:{req-datetime in RFC9110} # added by 'add_auth'
+    // x-ms-version:"2023-01-23"           # added by 'add_auth'
+    // Authorization:{signature}           # added by 'add_auth'
+    // x-ms-copy-source:https://{storage-account-id}/{container-id}/{source}
+    // Content-Length:0
+    const auto target = fmt::format(
+      "/{}/{}?comp=block&blockid={}", name(), key().string(), block_id);
+    const boost::beast::string_view host{_ap().data(), _ap().length()};
+
+    http::client::request_header header{};
+    header.method(boost::beast::http::verb::put);
+    header.target(target);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(
+      copy_source_name,
+      fmt::format("https://{}/{}/{}", _ap(), name(), source().string()));
+    header.insert(boost::beast::http::field::content_length, "0");
+
+    auto error_code = _apply_credentials->add_auth(header);
+    if (error_code) {
+        return error_code;
+    }
+
+    // Shared key signatures aren't accepted for the source, OAuth tokens of
+    // a managed identity are passed along.
+    auto auth = header.find(boost::beast::http::field::authorization);
+    if (
+      auth != header.end()
+      && std::string_view{auth->value().data(), auth->value().size()}
+           .starts_with(bearer_prefix)) {
+        header.insert(copy_source_authorization_name, auth->value());
+    }
+
+    return header;
+}
+
+result<http::client::request_header>
+abs_request_creator::make_put_block_list_request(
+  bucket_name const& name, object_key const& key, size_t payload_size_bytes) {
+    // PUT /{container-id}/{blob-id}?comp=blocklist HTTP/1.1
+    // Host: {storage-account-id}.blob.core.windows.net
+    // x-ms-date:{req-datetime in RFC9110} # added by 'add_auth'
+    // x-ms-version:"2023-01-23"           # added by 'add_auth'
+    // Authorization:{signature}           # added by 'add_auth'
+    // Content-Length:{payload-size}
+    // x-ms-blob-content-type: text/plain
+    const auto target = fmt::format(
+      "/{}/{}?comp=blocklist", name(), key().string());
+    const boost::beast::string_view host{_ap().data(), _ap().length()};
+
+    http::client::request_header header{};
+    header.method(boost::beast::http::verb::put);
+    header.target(target);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(
+      boost::beast::http::field::content_length,
+      std::to_string(payload_size_bytes));
+    header.insert(blob_content_type_name, content_type_value);
+
+    auto error_code = _apply_credentials->add_auth(header);
+    if (error_code) {
+        return error_code;
+    }
+
+    return header;
+}
+
 result<http::client::request_header>
 abs_request_creator::make_get_blob_metadata_request(
   bucket_name const& name, object_key const& key) {
@@ -430,6 +553,18 @@ ss::future<> abs_client::stop() {
 
 void abs_client::shutdown() { _client.shutdown(); }
 
+bool abs_client::is_warm(ss::lowres_clock::duration max_age) const {
+    return _client.is_warm(max_age);
+}
+
+ss::future<bool> abs_client::warm_up(
+  ss::lowres_clock::duration max_age, ss::lowres_clock::duration timeout) {
+    return _client.warm_up(max_age, timeout)
+      .then([](http::reconnect_result_t r) {
+          return r == http::reconnect_result_t::connected;
+      });
+}
+
 template<typename T>
 ss::future<result<T, error_outcome>> abs_client::send_request(
   ss::future<T> request_future,
@@ -619,6 +754,192 @@ ss::future<> abs_client::do_put_object(
     }
 }
 
+ss::future<result<ss::sstring, error_outcome>>
+abs_client::initiate_multipart_upload(
+  bucket_name const&, object_key const&, ss::lowres_clock::duration) {
+    return ss::make_ready_future<result<ss::sstring, error_outcome>>(
+      ss::sstring{});
+}
+
+ss::future<result<abs_client::multipart_upload_part, error_outcome>>
+abs_client::upload_part(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring&,
+  uint32_t part_number,
+  size_t payload_size,
+  ss::input_stream<char> body,
+  ss::lowres_clock::duration timeout) {
+    return send_request(
+      do_put_block(
+        name, key, part_number, payload_size, std::move(body), timeout),
+      key,
+      op_type_tag::upload);
+}
+
+ss::future<abs_client::multipart_upload_part> abs_client::do_put_block(
+  bucket_name const& name,
+  object_key const& key,
+  uint32_t part_number,
+  size_t payload_size,
+  ss::input_stream<char> body,
+  ss::lowres_clock::duration timeout) {
+    const auto block_id = make_block_id(part_number);
+
+    auto header = _requestor.make_put_block_request(
+      name, key, block_id, payload_size);
+    if (!header) {
+        co_await body.close();
+
+        vlog(
+          abs_log.warn, "Failed to create request header: {}", header.error());
+        throw std::system_error(header.error());
+    }
+
+    vlog(abs_log.trace, "send https request:\n{}", header.value());
+
+    auto response_stream = co_await _client
+                             .request(std::move(header.value()), body, timeout)
+                             .finally([&body] { return body.close(); });
+
+    co_await response_stream->prefetch_headers();
+    vassert(response_stream->is_header_done(), "Header is not received");
+
+    const auto status = response_stream->get_headers().result();
+    if (status != boost::beast::http::status::created) {
+        const auto content_type = get_response_content_type(
+          response_stream->get_headers());
+        auto buf = co_await util::drain_response_stream(
+          std::move(response_stream));
+        throw parse_rest_error_response(content_type, status, std::move(buf));
+    }
+    co_return multipart_upload_part{.part_number = part_number, .id = block_id};
+}
+
+ss::future<result<abs_client::multipart_upload_part, error_outcome>>
+abs_client::upload_part_copy(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring&,
+  uint32_t part_number,
+  object_key const& source,
+  ss::lowres_clock::duration timeout) {
+    return send_request(
+      do_put_block_from_url(name, key, part_number, source, timeout),
+      key,
+      op_type_tag::upload);
+}
+
+ss::future<abs_client::multipart_upload_part>
+abs_client::do_put_block_from_url(
+  bucket_name const& name,
+  object_key const& key,
+  uint32_t part_number,
+  object_key const& source,
+  ss::lowres_clock::duration timeout) {
+    const auto block_id = make_block_id(part_number);
+
+    auto header = _requestor.make_put_block_from_url_request(
+      name, key, block_id, source);
+    if (!header) {
+        vlog(
+          abs_log.warn, "Failed to create request header: {}", header.error());
+        throw std::system_error(header.error());
+    }
+
+    vlog(abs_log.trace, "send https request:\n{}", header.value());
+
+    auto response_stream = co_await _client.request(
+      std::move(header.value()), timeout);
+
+    co_await response_stream->prefetch_headers();
+    vassert(response_stream->is_header_done(), "Header is not received");
+
+    const auto status = response_stream->get_headers().result();
+    if (status != boost::beast::http::status::created) {
+        const auto content_type = get_response_content_type(
+          response_stream->get_headers());
+        auto buf = co_await util::drain_response_stream(
+          std::move(response_stream));
+        throw parse_rest_error_response(content_type, status, std::move(buf));
+    }
+    co_return multipart_upload_part{.part_number = part_number, .id = block_id};
+}
+
+ss::future<result<abs_client::no_response, error_outcome>>
+abs_client::complete_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring&,
+  const std::vector<multipart_upload_part>& parts,
+  ss::lowres_clock::duration timeout) {
+    return send_request(
+      do_put_block_list(name, key, parts, timeout).then([]() {
+          return ss::make_ready_future<no_response>(no_response{});
+      }),
+      key,
+      op_type_tag::upload);
+}
+
+ss::future<> abs_client::do_put_block_list(
+  bucket_name const& name,
+  object_key const& key,
+  const std::vector<multipart_upload_part>& parts,
+  ss::lowres_clock::duration timeout) {
+    // <?xml version="1.0" encoding="utf-8"?>
+    // <BlockList>
+    //   <Latest>{block-id}</Latest>
+    //   ...
+    // </BlockList>
+    auto xml = fmt::format(
+      R"(<?xml version="1.0" encoding="utf-8"?><BlockList>{}</BlockList>)",
+      fmt::join(
+        parts | std::views::transform([](const multipart_upload_part& p) {
+            return fmt::format("<Latest>{}</Latest>", p.id);
+        }),
+        ""));
+    iobuf body;
+    body.append(xml.data(), xml.size());
+
+    auto header = _requestor.make_put_block_list_request(
+      name, key, body.size_bytes());
+    if (!header) {
+        vlog(
+          abs_log.warn, "Failed to create request header: {}", header.error());
+        throw std::system_error(header.error());
+    }
+
+    vlog(abs_log.trace, "send https request:\n{}", header.value());
+
+    auto stream = make_iobuf_input_stream(std::move(body));
+    auto response_stream = co_await _client
+                             .request(
+                               std::move(header.value()), stream, timeout)
+                             .finally([&stream] { return stream.close(); });
+
+    co_await response_stream->prefetch_headers();
+    vassert(response_stream->is_header_done(), "Header is not received");
+
+    const auto status = response_stream->get_headers().result();
+    if (status != boost::beast::http::status::created) {
+        const auto content_type = get_response_content_type(
+          response_stream->get_headers());
+        auto buf = co_await util::drain_response_stream(
+          std::move(response_stream));
+        throw parse_rest_error_response(content_type, status, std::move(buf));
+    }
+}
+
+ss::future<result<abs_client::no_response, error_outcome>>
+abs_client::abort_multipart_upload(
+  bucket_name const&,
+  object_key const&,
+  const ss::sstring&,
+  ss::lowres_clock::duration) {
+    return ss::make_ready_future<result<no_response, error_outcome>>(
+      no_response{});
+}
+
 ss::future<result<abs_client::head_object_result, error_outcome>>
 abs_client::head_object(
   bucket_name const& name,
@@ -49,6 +49,43 @@ public:
       object_key const& key,
       std::optional<http_byte_range> byte_range = std::nullopt);
 
+    /// \brief Create 'Put Block' request header
+    ///
+    /// \param name is container name
+    /// \param key is the blob identifier
+    /// \param block_id is the base64 id of the uncommitted block
+    /// \param payload_size_bytes is a size of the block in bytes
+    /// \return initialized and signed http header or error
+    result<http::client::request_header> make_put_block_request(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& block_id,
+      size_t payload_size_bytes);
+
+    /// \brief Create 'Put Block From URL' request header
+    ///
+    /// \param name is container name
+    /// \param key is the blob identifier
+    /// \param block_id is the base64 id of the uncommitted block
+    /// \param source is the blob of the same container to copy
+    /// \return initialized and signed http header or error
+    result<http::client::request_header> make_put_block_from_url_request(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& block_id,
+      object_key const& source);
+
+    /// \brief Create 'Put Block List' request header
+    ///
+    /// \param name is container name
+    /// \param key is the blob identifier
+    /// \param payload_size_bytes is a size of the block list in bytes
+    /// \return initialized and signed http header or error
+    result<http::client::request_header> make_put_block_list_request(
+      bucket_name const& name,
+      object_key const& key,
+      size_t payload_size_bytes);
+
     /// \brief Create a 'Get Blob Metadata' request header
     ///
     /// \param name is a container
@@ -129,6 +166,12 @@ public:
     /// Shutdown the underlying connection
     void shutdown() override;
 
+    bool is_warm(ss::lowres_clock::duration max_age) const override;
+
+    ss::future<bool> warm_up(
+      ss::lowres_clock::duration max_age,
+      ss::lowres_clock::duration timeout) override;
+
     /// Download object from ABS container
     ///
     /// \param name is a container name
@@ -168,6 +211,48 @@ public:
       ss::input_stream<char> body,
       ss::lowres_clock::duration timeout) override;
 
+    /// Block blobs need no initiation, the returned upload id is empty.
+    ss::future<result<ss::sstring, error_outcome>> initiate_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      ss::lowres_clock::duration timeout) override;
+
+    /// Send Put Block request for the part, the id of the block is derived
+    /// from the part number.
+    ss::future<result<multipart_upload_part, error_outcome>> upload_part(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      uint32_t part_number,
+      size_t payload_size,
+      ss::input_stream<char> body,
+      ss::lowres_clock::duration timeout) override;
+
+    /// Send Put Block From URL request for the part. The source blob must be
+    /// readable with the credentials of the client.
+    ss::future<result<multipart_upload_part, error_outcome>> upload_part_copy(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      uint32_t part_number,
+      object_key const& source,
+      ss::lowres_clock::duration timeout) override;
+
+    /// Send Put Block List request to commit the blocks of the parts.
+    ss::future<result<no_response, error_outcome>> complete_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      const std::vector<multipart_upload_part>& parts,
+      ss::lowres_clock::duration timeout) override;
+
+    /// Uncommitted blocks are garbage collected by ABS, so this is a no-op.
+    ss::future<result<no_response, error_outcome>> abort_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      ss::lowres_clock::duration timeout) override;
+
     /// Send List Blobs request
     /// \param name is a container name
     /// \param prefix is an optional blob prefix to match
@@ -256,6 +341,27 @@ private:
       ss::input_stream<char> body,
       ss::lowres_clock::duration timeout);
 
+    ss::future<multipart_upload_part> do_put_block(
+      bucket_name const& name,
+      object_key const& key,
+      uint32_t part_number,
+      size_t payload_size,
+      ss::input_stream<char> body,
+      ss::lowres_clock::duration timeout);
+
+    ss::future<multipart_upload_part> do_put_block_from_url(
+      bucket_name const& name,
+      object_key const& key,
+      uint32_t part_number,
+      object_key const& source,
+      ss::lowres_clock::duration timeout);
+
+    ss::future<> do_put_block_list(
+      bucket_name const& name,
+      object_key const& key,
+      const std::vector<multipart_upload_part>& parts,
+      ss::lowres_clock::duration timeout);
+
     ss::future<head_object_result> do_head_object(
       bucket_name const& name,
       object_key const& key,
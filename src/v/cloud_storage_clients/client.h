@@ -40,6 +40,16 @@ public:
     /// Shutdown the underlying connection
     virtual void shutdown() = 0;
 
+    /// Return true if the connection is open and was used less than
+    /// 'max_age' ago
+    virtual bool is_warm(ss::lowres_clock::duration max_age) const = 0;
+
+    /// Reopen the connection unless it's warm. Returns true if the client
+    /// is connected.
+    virtual ss::future<bool> warm_up(
+      ss::lowres_clock::duration max_age, ss::lowres_clock::duration timeout)
+      = 0;
+
     /// Download object from cloud storage.
     ///
     /// \param name is a bucket name
@@ -89,6 +99,92 @@ public:
       ss::lowres_clock::duration timeout)
       = 0;
 
+    /// A part of a multipart upload
+    struct multipart_upload_part {
+        /// Position of the part in the object, starting at 1
+        uint32_t part_number;
+        /// ETag (S3) or block id (ABS) the object is assembled from
+        ss::sstring id;
+    };
+
+    /// Start the multipart upload of an object
+    ///
+    /// \param name is a bucket name
+    /// \param key is an id of the object
+    /// \param timeout is a timeout of the operation
+    /// \return future that becomes ready with the id of the upload
+    virtual ss::future<result<ss::sstring, error_outcome>>
+    initiate_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      ss::lowres_clock::duration timeout)
+      = 0;
+
+    /// Upload a part of a multipart upload. Parts can be uploaded
+    /// concurrently and in any order, and uploading a part again replaces
+    /// it.
+    ///
+    /// \param name is a bucket name
+    /// \param key is an id of the object
+    /// \param upload_id is the id returned by initiate_multipart_upload
+    /// \param part_number is the position of the part, starting at 1
+    /// \param payload_size is a size of the part in bytes
+    /// \param body is an input_stream that can be used to read the part
+    /// \param timeout is a timeout of the operation
+    /// \return future that becomes ready when the part is uploaded
+    virtual ss::future<result<multipart_upload_part, error_outcome>>
+    upload_part(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      uint32_t part_number,
+      size_t payload_size,
+      ss::input_stream<char> body,
+      ss::lowres_clock::duration timeout)
+      = 0;
+
+    /// Fill a part of a multipart upload with the content of an existing
+    /// object of the same bucket. The data is copied by the storage service
+    /// and doesn't go through the client.
+    ///
+    /// \param name is a bucket name
+    /// \param key is an id of the object
+    /// \param upload_id is the id returned by initiate_multipart_upload
+    /// \param part_number is the position of the part, starting at 1
+    /// \param source is the id of the object to copy
+    /// \param timeout is a timeout of the operation
+    /// \return future that becomes ready when the part is copied
+    virtual ss::future<result<multipart_upload_part, error_outcome>>
+    upload_part_copy(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      uint32_t part_number,
+      object_key const& source,
+      ss::lowres_clock::duration timeout)
+      = 0;
+
+    /// Assemble the object from the uploaded parts
+    ///
+    /// \param parts are the uploaded parts ordered by part number
+    virtual ss::future<result<no_response, error_outcome>>
+    complete_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      const std::vector<multipart_upload_part>& parts,
+      ss::lowres_clock::duration timeout)
+      = 0;
+
+    /// Abort a multipart upload and drop its parts
+    virtual ss::future<result<no_response, error_outcome>>
+    abort_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      ss::lowres_clock::duration timeout)
+      = 0;
+
     struct list_bucket_item {
         ss::sstring key;
         std::chrono::system_clock::time_point last_modified;
@@ -13,7 +13,9 @@
 #include "cloud_storage_clients/abs_client.h"
 #include "cloud_storage_clients/logger.h"
 #include "cloud_storage_clients/s3_client.h"
+#include "config/configuration.h"
 #include "model/timeout_clock.h"
+#include "random/generators.h"
 #include "ssx/future-util.h"
 
 #include <seastar/core/smp.hh>
@@ -26,6 +28,7 @@
 namespace {
 constexpr auto self_configure_attempts = 3;
 constexpr auto self_configure_backoff = 1s;
+constexpr auto warm_up_timeout = 5s;
 } // namespace
 
 namespace cloud_storage_clients {
@@ -38,7 +41,10 @@ client_pool::client_pool(
   : _capacity(size)
   , _config(std::move(conf))
   , _probe(std::visit([](auto&& p) { return p._probe; }, _config))
-  , _policy(policy) {
+  , _policy(policy)
+  , _warm_target(config::shard_local_cfg()
+                   .cloud_storage_client_pool_warm_connections.bind()) {
+    _warm_timer.set_callback([this] { warm_connections(); });
     if (ss::this_shard_id() == self_config_shard) {
         ssx::spawn_with_gate(
           _gate, [this, app_stop_signal = application_stop_signal]() {
@@ -157,6 +163,10 @@ ss::future<> client_pool::accept_self_configure_result(
     }
 
     populate_client_pool();
+    if (auto interval = max_idle_time() / 4;
+        interval > ss::lowres_clock::duration::zero()) {
+        _warm_timer.arm_periodic(interval);
+    }
 
     // We signal the waiters only after the client pool is initialized, so
     // that any upload operations waiting are ready to proceed.
@@ -169,6 +179,7 @@ ss::future<> client_pool::stop() {
     if (!_as.abort_requested()) {
         _as.request_abort();
     }
+    _warm_timer.cancel();
     _cvar.broken();
     _self_config_barrier.broken();
     _credentials_var.broken();
@@ -194,6 +205,7 @@ void client_pool::shutdown_connections() {
     vlog(pool_log.info, "Shutting down client pool: {}", _pool.size());
 
     _as.request_abort();
+    _warm_timer.cancel();
     _cvar.broken();
     _self_config_barrier.broken();
     _credentials_var.broken();
@@ -498,6 +510,77 @@ void client_pool::release(http_client_ptr leased) {
     _cvar.signal();
 }
 
+ss::lowres_clock::duration client_pool::max_idle_time() const {
+    return std::visit(
+      [](const auto& cfg) { return cfg.max_idle_time; }, _config);
+}
+
+void client_pool::warm_connections() {
+    if (_gate.is_closed() || _as.abort_requested()) {
+        return;
+    }
+    // Hot clients are at the back of the pool, these are handed out first
+    auto num_warm = std::min(_warm_target(), _pool.size());
+    if (num_warm == 0) {
+        return;
+    }
+    const auto interval = max_idle_time() / 4;
+    std::vector<std::pair<http_client_ptr, ss::lowres_clock::duration>> cold;
+    for (auto it = _pool.end() - num_warm; it != _pool.end();) {
+        // The connection is replaced when it has between one and two
+        // intervals left, so it's replaced before the next check finds it
+        // expired.
+        auto max_age = max_idle_time() - interval
+                       - ss::lowres_clock::duration(
+                         random_generators::get_int<int64_t>(interval.count()));
+        if ((*it)->is_warm(max_age)) {
+            ++it;
+            continue;
+        }
+        cold.emplace_back(std::move(*it), max_age);
+        it = _pool.erase(it);
+    }
+    if (cold.empty()) {
+        return;
+    }
+    vlog(
+      pool_log.debug,
+      "warming up {} client connections, pool size: {}",
+      cold.size(),
+      _pool.size());
+    update_usage_stats();
+    for (auto& c : cold) {
+        ssx::spawn_with_gate(
+          _bg_gate,
+          [this, client = std::move(c.first), max_age = c.second]() mutable {
+              return warm_up(std::move(client), max_age);
+          });
+    }
+}
+
+ss::future<> client_pool::warm_up(
+  http_client_ptr client, ss::lowres_clock::duration max_age) {
+    try {
+        if (!co_await client->warm_up(max_age, warm_up_timeout)) {
+            vlog(pool_log.debug, "client connection warm-up timed out");
+        }
+    } catch (...) {
+        vlog(
+          pool_log.debug,
+          "client connection warm-up failed: {}",
+          std::current_exception());
+    }
+    if (_gate.is_closed() || _as.abort_requested()) {
+        co_await client->stop();
+        co_return;
+    }
+    // The client is still usable even if the warm-up failed, the next
+    // request will reconnect it.
+    _pool.emplace_back(std::move(client));
+    update_usage_stats();
+    _cvar.signal();
+}
+
 void client_pool::load_credentials(cloud_roles::credentials credentials) {
     if (unlikely(!_apply_credentials)) {
         _apply_credentials = ss::make_lw_shared(
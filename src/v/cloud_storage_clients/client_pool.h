@@ -13,6 +13,7 @@
 #include "cloud_roles/apply_credentials.h"
 #include "cloud_storage_clients/client.h"
 #include "cloud_storage_clients/client_probe.h"
+#include "config/property.h"
 #include "container/intrusive_list_helpers.h"
 #include "utils/stop_signal.h"
 
@@ -20,6 +21,7 @@
 #include <seastar/core/condition-variable.hh>
 #include <seastar/core/sharded.hh>
 #include <seastar/core/shared_ptr.hh>
+#include <seastar/core/timer.hh>
 
 namespace cloud_storage_clients {
 
@@ -37,6 +39,14 @@ constexpr ss::shard_id self_config_shard = ss::shard_id{0};
 
 /// Connection pool implementation
 /// All connections share the same configuration
+///
+/// The pool is shared by all users of cloud storage on a shard. The
+/// connections which will be handed out next (the back of the pool, up to
+/// `cloud_storage_client_pool_warm_connections` of them) are kept open:
+/// every quarter of the connection idle time the pool reopens those which
+/// are closed or about to be closed as idle. The age at which a connection
+/// is replaced is randomized so that connections opened at the same time
+/// are not replaced at the same time.
 class client_pool
   : public ss::weakly_referencable<client_pool>
   , public ss::peering_sharded_service<client_pool> {
@@ -160,6 +170,12 @@ private:
 
     void update_usage_stats();
 
+    /// Start warming up the idle connections which are closed or about to
+    /// be closed as idle
+    void warm_connections();
+    ss::future<> warm_up(http_client_ptr client, ss::lowres_clock::duration);
+    ss::lowres_clock::duration max_idle_time() const;
+
     ///  Wait for credentials to be acquired. Once credentials are acquired,
     ///  based on the policy, optionally wait for client pool to initialize.
     ss::future<> wait_for_credentials();
@@ -186,6 +202,9 @@ private:
     ss::condition_variable _credentials_var;
 
     ssx::semaphore _self_config_barrier{0, "self_config_barrier"};
+
+    config::binding<size_t> _warm_target;
+    ss::timer<ss::lowres_clock> _warm_timer;
 };
 
 } // namespace cloud_storage_clients
@@ -59,6 +59,8 @@ struct aws_header_names {
     static constexpr boost::beast::string_view x_guploader_uploadid
       = "x-guploader-uploadid";
     static constexpr boost::beast::string_view delimiter = "delimiter";
+    static constexpr boost::beast::string_view x_amz_copy_source
+      = "x-amz-copy-source";
 };
 
 struct aws_header_values {
@@ -343,6 +345,183 @@ request_creator::make_delete_objects_request(
         std::make_unique<delete_objects_body>(std::move(body))}}};
 }
 
+result<http::client::request_header>
+request_creator::make_create_multipart_upload_request(
+  bucket_name const& name, object_key const& key) {
+    // POST /{object-id}?uploads HTTP/1.1
+    // Host: {bucket-name}.s3.amazonaws.com
+    // x-amz-date:{req-datetime}
+    // Authorization:{signature}
+    http::client::request_header header{};
+    auto host = fmt::format("{}.{}", name(), _ap());
+    auto target = fmt::format("/{}?uploads", key().string());
+    header.method(boost::beast::http::verb::post);
+    header.target(target);
+    header.insert(
+      boost::beast::http::field::user_agent, aws_header_values::user_agent);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(
+      boost::beast::http::field::content_type, aws_header_values::text_plain);
+    header.insert(boost::beast::http::field::content_length, "0");
+    auto ec = _apply_credentials->add_auth(header);
+    if (ec) {
+        return ec;
+    }
+    return header;
+}
+
+result<http::client::request_header>
+request_creator::make_unsigned_upload_part_request(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  uint32_t part_number,
+  size_t payload_size_bytes) {
+    // PUT /{object-id}?partNumber={part-number}&uploadId={upload-id} HTTP/1.1
+    // Host: {bucket-name}.s3.amazonaws.com
+    // x-amz-date:{req-datetime}
+    // Authorization:{signature}
+    // Content-Length: {payload-size}
+    // [payload-size bytes of the part]
+    http::client::request_header header{};
+    auto host = fmt::format("{}.{}", name(), _ap());
+    auto target = fmt::format(
+      "/{}?partNumber={}&uploadId={}", key().string(), part_number, upload_id);
+    header.method(boost::beast::http::verb::put);
+    header.target(target);
+    header.insert(
+      boost::beast::http::field::user_agent, aws_header_values::user_agent);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(
+      boost::beast::http::field::content_length,
+      std::to_string(payload_size_bytes));
+    auto ec = _apply_credentials->add_auth(header);
+    if (ec) {
+        return ec;
+    }
+    return header;
+}
+
+result<http::client::request_header>
+request_creator::make_upload_part_copy_request(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  uint32_t part_number,
+  object_key const& source) {
+    // PUT /{object-id}?partNumber={part-number}&uploadId={upload-id} HTTP/1.1
+    // Host: {bucket-name}.s3.amazonaws.com
+    // x-amz-copy-source: /{bucket-name}/{source-id}
+    // x-amz-date:{req-datetime}
+    // Authorization:{signature}
+    // Content-Length: 0
+    http::client::request_header header{};
+    auto host = fmt::format("{}.{}", name(), _ap());
+    auto target = fmt::format(
+      "/{}?partNumber={}&uploadId={}", key().string(), part_number, upload_id);
+    header.method(boost::beast::http::verb::put);
+    header.target(target);
+    header.insert(
+      boost::beast::http::field::user_agent, aws_header_values::user_agent);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(
+      aws_header_names::x_amz_copy_source,
+      fmt::format("/{}/{}", name(), source().string()));
+    header.insert(boost::beast::http::field::content_length, "0");
+    auto ec = _apply_credentials->add_auth(header);
+    if (ec) {
+        return ec;
+    }
+    return header;
+}
+
+result<std::tuple<http::client::request_header, ss::input_stream<char>>>
+request_creator::make_complete_multipart_upload_request(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  const std::vector<client::multipart_upload_part>& parts) {
+    // POST /{object-id}?uploadId={upload-id} HTTP/1.1
+    // Host: {bucket-name}.s3.amazonaws.com
+    // x-amz-date:{req-datetime}
+    // Authorization:{signature}
+    // Content-Length: <...>
+    //
+    // <CompleteMultipartUpload>
+    //     <Part>
+    //         <ETag>etag</ETag>
+    //         <PartNumber>1</PartNumber>
+    //     </Part>
+    //     ...
+    // </CompleteMultipartUpload>
+    auto body = [&] {
+        auto complete_tree = boost::property_tree::ptree{};
+        for (auto part_tree = boost::property_tree::ptree{};
+             auto const& p : parts) {
+            part_tree.put("ETag", p.id.c_str());
+            part_tree.put("PartNumber", p.part_number);
+            complete_tree.add_child("CompleteMultipartUpload.Part", part_tree);
+        }
+
+        auto out = std::ostringstream{};
+        boost::property_tree::write_xml(out, complete_tree);
+        if (!out.good()) {
+            throw std::runtime_error(fmt_with_ctx(
+              fmt::format,
+              "failed to create complete multipart upload request, state: {}",
+              out.rdstate()));
+        }
+        return out.str();
+    }();
+
+    auto header = http::client::request_header{};
+    header.method(boost::beast::http::verb::post);
+    header.target(
+      fmt::format("/{}?uploadId={}", key().string(), upload_id));
+    header.insert(
+      boost::beast::http::field::user_agent, aws_header_values::user_agent);
+    header.insert(
+      boost::beast::http::field::host, fmt::format("{}.{}", name(), _ap()));
+    header.insert(
+      boost::beast::http::field::content_length,
+      fmt::format("{}", body.size()));
+
+    auto ec = _apply_credentials->add_auth(header);
+    if (ec) {
+        return ec;
+    }
+
+    return {
+      std::move(header),
+      ss::input_stream<char>{ss::data_source{
+        std::make_unique<delete_objects_body>(std::move(body))}}};
+}
+
+result<http::client::request_header>
+request_creator::make_abort_multipart_upload_request(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id) {
+    // DELETE /{object-id}?uploadId={upload-id} HTTP/1.1
+    // Host: {bucket-name}.s3.amazonaws.com
+    // x-amz-date:{req-datetime}
+    // Authorization:{signature}
+    http::client::request_header header{};
+    auto host = fmt::format("{}.{}", name(), _ap());
+    auto target = fmt::format("/{}?uploadId={}", key().string(), upload_id);
+    header.method(boost::beast::http::verb::delete_);
+    header.target(target);
+    header.insert(
+      boost::beast::http::field::user_agent, aws_header_values::user_agent);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(boost::beast::http::field::content_length, "0");
+    auto ec = _apply_credentials->add_auth(header);
+    if (ec) {
+        return ec;
+    }
+    return header;
+}
+
 // client //
 
 inline cloud_storage_clients::s3_error_code
@@ -506,6 +685,18 @@ ss::future<> s3_client::stop() { return _client.stop(); }
 
 void s3_client::shutdown() { _client.shutdown(); }
 
+bool s3_client::is_warm(ss::lowres_clock::duration max_age) const {
+    return _client.is_warm(max_age);
+}
+
+ss::future<bool> s3_client::warm_up(
+  ss::lowres_clock::duration max_age, ss::lowres_clock::duration timeout) {
+    return _client.warm_up(max_age, timeout)
+      .then([](http::reconnect_result_t r) {
+          return r == http::reconnect_result_t::connected;
+      });
+}
+
 ss::future<result<http::client::response_stream_ref, error_outcome>>
 s3_client::get_object(
   bucket_name const& name,
@@ -714,6 +905,296 @@ ss::future<> s3_client::do_put_object(
       });
 }
 
+std::variant<ss::sstring, rest_error_response>
+iobuf_to_multipart_upload_id(iobuf&& buf) {
+    auto root = util::iobuf_to_ptree(std::move(buf), s3_log);
+    if (auto error_code = root.get_optional<ss::sstring>("Error.Code");
+        error_code) {
+        constexpr const char* empty = "";
+        auto code = root.get<ss::sstring>("Error.Code", empty);
+        auto msg = root.get<ss::sstring>("Error.Message", empty);
+        auto rid = root.get<ss::sstring>("Error.RequestId", empty);
+        auto res = root.get<ss::sstring>("Error.Resource", empty);
+        return rest_error_response(code, msg, rid, res);
+    }
+    return root.get<ss::sstring>("InitiateMultipartUploadResult.UploadId");
+}
+
+ss::future<result<ss::sstring, error_outcome>>
+s3_client::initiate_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  ss::lowres_clock::duration timeout) {
+    return send_request(
+      do_initiate_multipart_upload(name, key, timeout), name, key);
+}
+
+ss::future<ss::sstring> s3_client::do_initiate_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  ss::lowres_clock::duration timeout) {
+    auto header = _requestor.make_create_multipart_upload_request(name, key);
+    if (!header) {
+        throw std::system_error(header.error());
+    }
+    vlog(
+      s3_log.trace, "send CreateMultipartUpload request:\n{}", header.value());
+    auto response = co_await _client.request(
+      std::move(header.value()), timeout);
+    auto res = co_await util::drain_response_stream(response);
+    auto status = response->get_headers().result();
+    if (status != boost::beast::http::status::ok) {
+        vlog(
+          s3_log.warn,
+          "S3 CreateMultipartUpload request failed: {} {:l}",
+          status,
+          response->get_headers());
+        co_return co_await parse_rest_error_response<ss::sstring>(
+          status, std::move(res));
+    }
+    auto parsed = iobuf_to_multipart_upload_id(std::move(res));
+    if (std::holds_alternative<rest_error_response>(parsed)) {
+        throw std::get<rest_error_response>(parsed);
+    }
+    co_return std::get<ss::sstring>(parsed);
+}
+
+ss::future<result<s3_client::multipart_upload_part, error_outcome>>
+s3_client::upload_part(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  uint32_t part_number,
+  size_t payload_size,
+  ss::input_stream<char> body,
+  ss::lowres_clock::duration timeout) {
+    return send_request(
+      do_upload_part(
+        name,
+        key,
+        upload_id,
+        part_number,
+        payload_size,
+        std::move(body),
+        timeout),
+      name,
+      key);
+}
+
+ss::future<s3_client::multipart_upload_part> s3_client::do_upload_part(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  uint32_t part_number,
+  size_t payload_size,
+  ss::input_stream<char> body,
+  ss::lowres_clock::duration timeout) {
+    auto header = _requestor.make_unsigned_upload_part_request(
+      name, key, upload_id, part_number, payload_size);
+    if (!header) {
+        co_await body.close();
+        throw std::system_error(header.error());
+    }
+    vlog(s3_log.trace, "send UploadPart request:\n{}", header.value());
+    try {
+        auto response = co_await _client
+                          .request(std::move(header.value()), body, timeout)
+                          .finally([&body] { return body.close(); });
+        auto res = co_await util::drain_response_stream(response);
+        const auto& headers = response->get_headers();
+        auto status = headers.result();
+        if (status != boost::beast::http::status::ok) {
+            vlog(
+              s3_log.warn,
+              "S3 UploadPart request failed: {} {:l}",
+              status,
+              headers);
+            co_return co_await parse_rest_error_response<multipart_upload_part>(
+              status, std::move(res));
+        }
+        auto etag = headers.find(boost::beast::http::field::etag);
+        if (etag == headers.end()) {
+            throw rest_error_response(
+              fmt::format("{}", s3_error_code::_unknown),
+              "UploadPart response has no ETag",
+              "",
+              key().native());
+        }
+        co_return multipart_upload_part{
+          .part_number = part_number,
+          .id = ss::sstring(etag->value().data(), etag->value().size())};
+    } catch (const rest_error_response& err) {
+        _probe->register_failure(err.code(), op_type_tag::upload);
+        throw;
+    }
+}
+
+std::variant<ss::sstring, rest_error_response>
+iobuf_to_copy_part_etag(iobuf&& buf) {
+    auto root = util::iobuf_to_ptree(std::move(buf), s3_log);
+    if (auto error_code = root.get_optional<ss::sstring>("Error.Code");
+        error_code) {
+        constexpr const char* empty = "";
+        auto code = root.get<ss::sstring>("Error.Code", empty);
+        auto msg = root.get<ss::sstring>("Error.Message", empty);
+        auto rid = root.get<ss::sstring>("Error.RequestId", empty);
+        auto res = root.get<ss::sstring>("Error.Resource", empty);
+        return rest_error_response(code, msg, rid, res);
+    }
+    return root.get<ss::sstring>("CopyPartResult.ETag");
+}
+
+ss::future<result<s3_client::multipart_upload_part, error_outcome>>
+s3_client::upload_part_copy(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  uint32_t part_number,
+  object_key const& source,
+  ss::lowres_clock::duration timeout) {
+    return send_request(
+      do_upload_part_copy(name, key, upload_id, part_number, source, timeout),
+      name,
+      key);
+}
+
+ss::future<s3_client::multipart_upload_part> s3_client::do_upload_part_copy(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  uint32_t part_number,
+  object_key const& source,
+  ss::lowres_clock::duration timeout) {
+    auto header = _requestor.make_upload_part_copy_request(
+      name, key, upload_id, part_number, source);
+    if (!header) {
+        throw std::system_error(header.error());
+    }
+    vlog(s3_log.trace, "send UploadPartCopy request:\n{}", header.value());
+    try {
+        auto response = co_await _client.request(
+          std::move(header.value()), timeout);
+        auto res = co_await util::drain_response_stream(response);
+        auto status = response->get_headers().result();
+        if (status != boost::beast::http::status::ok) {
+            vlog(
+              s3_log.warn,
+              "S3 UploadPartCopy request failed: {} {:l}",
+              status,
+              response->get_headers());
+            co_return co_await parse_rest_error_response<multipart_upload_part>(
+              status, std::move(res));
+        }
+        // The copy can fail after the 200 response was sent, in which case
+        // the body holds an error instead of the ETag
+        auto parsed = iobuf_to_copy_part_etag(std::move(res));
+        if (std::holds_alternative<rest_error_response>(parsed)) {
+            throw std::get<rest_error_response>(parsed);
+        }
+        co_return multipart_upload_part{
+          .part_number = part_number,
+          .id = std::get<ss::sstring>(std::move(parsed))};
+    } catch (const rest_error_response& err) {
+        _probe->register_failure(err.code(), op_type_tag::upload);
+        throw;
+    }
+}
+
+ss::future<result<s3_client::no_response, error_outcome>>
+s3_client::complete_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  const std::vector<multipart_upload_part>& parts,
+  ss::lowres_clock::duration timeout) {
+    return send_request(
+      do_complete_multipart_upload(name, key, upload_id, parts, timeout)
+        .then(
+          []() { return ss::make_ready_future<no_response>(no_response{}); }),
+      name,
+      key);
+}
+
+ss::future<> s3_client::do_complete_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  const std::vector<multipart_upload_part>& parts,
+  ss::lowres_clock::duration timeout) {
+    auto request = _requestor.make_complete_multipart_upload_request(
+      name, key, upload_id, parts);
+    if (!request) {
+        throw std::system_error(request.error());
+    }
+    auto& [header, body] = request.value();
+    vlog(s3_log.trace, "send CompleteMultipartUpload request:\n{}", header);
+    auto response = co_await _client.request(std::move(header), body, timeout)
+                      .finally([&body] { return body.close(); });
+    auto res = co_await util::drain_response_stream(response);
+    auto status = response->get_headers().result();
+    if (status != boost::beast::http::status::ok) {
+        vlog(
+          s3_log.warn,
+          "S3 CompleteMultipartUpload request failed: {} {:l}",
+          status,
+          response->get_headers());
+        co_return co_await parse_rest_error_response<>(status, std::move(res));
+    }
+    // S3 can reply with 200 and an error in the body once the response
+    // was started
+    auto root = util::iobuf_to_ptree(std::move(res), s3_log);
+    if (auto code = root.get_optional<ss::sstring>("Error.Code"); code) {
+        constexpr const char* empty = "";
+        throw rest_error_response(
+          *code,
+          root.get<ss::sstring>("Error.Message", empty),
+          root.get<ss::sstring>("Error.RequestId", empty),
+          root.get<ss::sstring>("Error.Resource", empty));
+    }
+}
+
+ss::future<result<s3_client::no_response, error_outcome>>
+s3_client::abort_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  ss::lowres_clock::duration timeout) {
+    return send_request(
+      do_abort_multipart_upload(name, key, upload_id, timeout).then([]() {
+          return ss::make_ready_future<no_response>(no_response{});
+      }),
+      name,
+      key);
+}
+
+ss::future<> s3_client::do_abort_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  ss::lowres_clock::duration timeout) {
+    auto header = _requestor.make_abort_multipart_upload_request(
+      name, key, upload_id);
+    if (!header) {
+        throw std::system_error(header.error());
+    }
+    vlog(
+      s3_log.trace, "send AbortMultipartUpload request:\n{}", header.value());
+    auto response = co_await _client.request(
+      std::move(header.value()), timeout);
+    auto res = co_await util::drain_response_stream(response);
+    auto status = response->get_headers().result();
+    if (
+      status != boost::beast::http::status::no_content
+      && status != boost::beast::http::status::ok) {
+        vlog(
+          s3_log.warn,
+          "S3 AbortMultipartUpload request failed: {} {:l}",
+          status,
+          response->get_headers());
+        co_return co_await parse_rest_error_response<>(status, std::move(res));
+    }
+}
+
 ss::future<result<s3_client::list_bucket_result, error_outcome>>
 s3_client::list_objects(
   const bucket_name& name,
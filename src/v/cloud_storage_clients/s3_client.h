@@ -88,6 +88,69 @@ public:
     make_delete_objects_request(
       bucket_name const& name, std::span<const object_key> keys);
 
+    /// \brief Create a 'CreateMultipartUpload' request header
+    ///
+    /// \param name is a bucket that should be used to store new object
+    /// \param key is an object name
+    /// \return initialized and signed http header or error
+    result<http::client::request_header> make_create_multipart_upload_request(
+      bucket_name const& name, object_key const& key);
+
+    /// \brief Create unsigned 'UploadPart' request header
+    ///
+    /// \param name is a bucket that should be used to store new object
+    /// \param key is an object name
+    /// \param upload_id is an id of the multipart upload
+    /// \param part_number is the position of the part, starting at 1
+    /// \param payload_size_bytes is a size of the part in bytes
+    /// \return initialized and signed http header or error
+    result<http::client::request_header> make_unsigned_upload_part_request(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      uint32_t part_number,
+      size_t payload_size_bytes);
+
+    /// \brief Create an 'UploadPartCopy' request header
+    ///
+    /// \param name is a bucket that should be used to store new object
+    /// \param key is an object name
+    /// \param upload_id is an id of the multipart upload
+    /// \param part_number is the position of the part, starting at 1
+    /// \param source is the name of the object to copy into the part
+    /// \return initialized and signed http header or error
+    result<http::client::request_header> make_upload_part_copy_request(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      uint32_t part_number,
+      object_key const& source);
+
+    /// \brief Create a 'CompleteMultipartUpload' request header and body
+    ///
+    /// \param name is a bucket that should be used to store new object
+    /// \param key is an object name
+    /// \param upload_id is an id of the multipart upload
+    /// \param parts are the uploaded parts ordered by part number
+    /// \return the header and an the body as an input_stream
+    result<std::tuple<http::client::request_header, ss::input_stream<char>>>
+    make_complete_multipart_upload_request(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      const std::vector<client::multipart_upload_part>& parts);
+
+    /// \brief Create an 'AbortMultipartUpload' request header
+    ///
+    /// \param name is a bucket that should be used to store new object
+    /// \param key is an object name
+    /// \param upload_id is an id of the multipart upload
+    /// \return initialized and signed http header or error
+    result<http::client::request_header> make_abort_multipart_upload_request(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id);
+
     /// \brief Initialize http header for 'ListObjectsV2' request
     ///
     /// \param name of the bucket
@@ -134,6 +197,12 @@ public:
     /// Shutdown the underlying connection
     void shutdown() override;
 
+    bool is_warm(ss::lowres_clock::duration max_age) const override;
+
+    ss::future<bool> warm_up(
+      ss::lowres_clock::duration max_age,
+      ss::lowres_clock::duration timeout) override;
+
     /// Download object from S3 bucket
     ///
     /// \param name is a bucket name
@@ -171,6 +240,41 @@ public:
       ss::input_stream<char> body,
       ss::lowres_clock::duration timeout) override;
 
+    ss::future<result<ss::sstring, error_outcome>> initiate_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      ss::lowres_clock::duration timeout) override;
+
+    ss::future<result<multipart_upload_part, error_outcome>> upload_part(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      uint32_t part_number,
+      size_t payload_size,
+      ss::input_stream<char> body,
+      ss::lowres_clock::duration timeout) override;
+
+    ss::future<result<multipart_upload_part, error_outcome>> upload_part_copy(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      uint32_t part_number,
+      object_key const& source,
+      ss::lowres_clock::duration timeout) override;
+
+    ss::future<result<no_response, error_outcome>> complete_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      const std::vector<multipart_upload_part>& parts,
+      ss::lowres_clock::duration timeout) override;
+
+    ss::future<result<no_response, error_outcome>> abort_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      ss::lowres_clock::duration timeout) override;
+
     ss::future<result<list_bucket_result, error_outcome>> list_objects(
       const bucket_name& name,
       std::optional<object_key> prefix = std::nullopt,
@@ -211,6 +315,41 @@ private:
       ss::input_stream<char> body,
       ss::lowres_clock::duration timeout);
 
+    ss::future<ss::sstring> do_initiate_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      ss::lowres_clock::duration timeout);
+
+    ss::future<multipart_upload_part> do_upload_part(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      uint32_t part_number,
+      size_t payload_size,
+      ss::input_stream<char> body,
+      ss::lowres_clock::duration timeout);
+
+    ss::future<multipart_upload_part> do_upload_part_copy(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      uint32_t part_number,
+      object_key const& source,
+      ss::lowres_clock::duration timeout);
+
+    ss::future<> do_complete_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      const std::vector<multipart_upload_part>& parts,
+      ss::lowres_clock::duration timeout);
+
+    ss::future<> do_abort_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      ss::lowres_clock::duration timeout);
+
     ss::future<list_bucket_result> do_list_objects_v2(
       const bucket_name& name,
       std::optional<object_key> prefix = std::nullopt,
@@ -246,4 +385,12 @@ private:
 std::variant<client::delete_objects_result, rest_error_response>
 iobuf_to_delete_objects_result(iobuf&& buf);
 
+/// Parse the id of the upload out of a CreateMultipartUpload response
+std::variant<ss::sstring, rest_error_response>
+iobuf_to_multipart_upload_id(iobuf&& buf);
+
+/// Parse the ETag of the part out of an UploadPartCopy response
+std::variant<ss::sstring, rest_error_response>
+iobuf_to_copy_part_etag(iobuf&& buf);
+
 } // namespace cloud_storage_clients
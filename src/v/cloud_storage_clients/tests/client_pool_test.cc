@@ -10,12 +10,16 @@
 
 #include "base/seastarx.h"
 #include "cloud_storage_clients/client_pool.h"
+#include "config/configuration.h"
 
 #include <seastar/core/abort_source.hh>
 #include <seastar/core/future.hh>
 #include <seastar/core/gate.hh>
 #include <seastar/core/sharded.hh>
 #include <seastar/core/shared_ptr.hh>
+#include <seastar/core/sleep.hh>
+#include <seastar/core/with_timeout.hh>
+#include <seastar/net/api.hh>
 #include <seastar/testing/thread_test_case.hh>
 #include <seastar/util/defer.hh>
 #include <seastar/util/later.hh>
@@ -89,3 +93,57 @@ SEASTAR_THREAD_TEST_CASE(test_client_pool_acquire_abortable) {
 
     BOOST_REQUIRE_THROW(f.get(), ss::abort_requested_exception);
 }
+
+SEASTAR_THREAD_TEST_CASE(test_client_pool_warm_connections) {
+    config::shard_local_cfg()
+      .cloud_storage_client_pool_warm_connections.set_value(size_t{2});
+    auto reset_cfg = ss::defer([] {
+        config::shard_local_cfg()
+          .cloud_storage_client_pool_warm_connections.reset();
+    });
+
+    ss::listen_options lo;
+    lo.reuse_address = true;
+    auto listener = ss::listen(
+      ss::socket_address(
+        ss::net::inet_address(httpd_host_name), httpd_port_number),
+      lo);
+    std::vector<ss::connected_socket> accepted;
+    auto accept_loop = ss::do_until(
+      [&accepted] { return accepted.size() >= 2; },
+      [&listener, &accepted] {
+          return listener.accept().then([&accepted](ss::accept_result r) {
+              accepted.push_back(std::move(r.connection));
+          });
+      });
+
+    auto sconf = ss::sharded_parameter([] {
+        auto conf = transport_configuration();
+        conf.max_idle_time = 400ms;
+        return conf;
+    });
+    auto conf = transport_configuration();
+
+    ss::sharded<cloud_storage_clients::client_pool> pool;
+    size_t num_connections_per_shard = 2;
+    pool.start(num_connections_per_shard, sconf).get();
+    pool
+      .invoke_on_all([&conf](cloud_storage_clients::client_pool& p) {
+          auto cred = cloud_roles::aws_credentials{
+            conf.access_key.value(),
+            conf.secret_key.value(),
+            std::nullopt,
+            conf.region};
+          p.load_credentials(cred);
+      })
+      .get();
+    auto pool_stop = ss::defer([&pool] { pool.stop().get(); });
+
+    // Both connections are opened before any request is sent
+    ss::with_timeout(ss::lowres_clock::now() + 10s, std::move(accept_loop))
+      .get();
+    while (pool.local().size() < num_connections_per_shard) {
+        ss::sleep(10ms).get();
+    }
+    BOOST_REQUIRE_EQUAL(accepted.size(), 2);
+}
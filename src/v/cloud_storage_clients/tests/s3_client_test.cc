@@ -272,6 +272,55 @@ void set_routes(ss::httpd::routes& r) {
           return "unexpected";
       },
       "txt");
+    auto multipart_post_response = new function_handler(
+      [](const_req req, [[maybe_unused]] reply& reply) -> std::string {
+          if (req.query_parameters.contains("uploads")) {
+              return R"XML(<InitiateMultipartUploadResult>
+              <Bucket>test-bucket</Bucket>
+              <Key>test-multipart</Key>
+              <UploadId>upload-1</UploadId>
+              </InitiateMultipartUploadResult>)XML";
+          }
+          BOOST_REQUIRE_EQUAL(req.get_query_param("uploadId"), "upload-1");
+          auto buffer_stream = std::istringstream{std::string{req.content}};
+          auto tree = boost::property_tree::ptree{};
+          boost::property_tree::read_xml(buffer_stream, tree);
+          int expected_part = 1;
+          for (auto const& [tag, value] :
+               tree.get_child("CompleteMultipartUpload")) {
+              BOOST_REQUIRE_EQUAL(tag, "Part");
+              BOOST_REQUIRE_EQUAL(value.get<int>("PartNumber"), expected_part);
+              BOOST_REQUIRE_EQUAL(
+                value.get<std::string>("ETag"),
+                fmt::format("etag-{}", expected_part));
+              ++expected_part;
+          }
+          BOOST_REQUIRE_EQUAL(expected_part, 3);
+          return "<CompleteMultipartUploadResult/>";
+      },
+      "txt");
+    auto multipart_put_response = new function_handler(
+      [](const_req req, reply& reply) {
+          BOOST_REQUIRE_EQUAL(req.get_query_param("uploadId"), "upload-1");
+          reply.add_header(
+            "ETag", fmt::format("etag-{}", req.get_query_param("partNumber")));
+          return "";
+      },
+      "txt");
+    auto multipart_delete_response = new function_handler(
+      [](const_req req, reply& reply) {
+          BOOST_REQUIRE_EQUAL(req.get_query_param("uploadId"), "upload-1");
+          reply.set_status(reply::status_type::no_content);
+          return "";
+      },
+      "txt");
+    r.add(
+      operation_type::POST, url("/test-multipart"), multipart_post_response);
+    r.add(operation_type::PUT, url("/test-multipart"), multipart_put_response);
+    r.add(
+      operation_type::DELETE,
+      url("/test-multipart"),
+      multipart_delete_response);
     r.add(operation_type::PUT, url("/test"), empty_put_response);
     r.add(operation_type::PUT, url("/test-error"), erroneous_put_response);
     r.add(operation_type::GET, url("/test"), get_response);
@@ -364,6 +413,56 @@ SEASTAR_TEST_CASE(test_put_object_success) {
     });
 }
 
+SEASTAR_TEST_CASE(test_multipart_upload_success) {
+    return ss::async([] {
+        auto conf = transport_configuration();
+        auto [server, client] = started_client_and_server(conf);
+        const cloud_storage_clients::bucket_name bucket("test-bucket");
+        const cloud_storage_clients::object_key key("test-multipart");
+
+        auto upload_id
+          = client->initiate_multipart_upload(bucket, key, 100ms).get();
+        BOOST_REQUIRE(upload_id);
+        BOOST_REQUIRE_EQUAL(upload_id.value(), "upload-1");
+
+        std::vector<cloud_storage_clients::client::multipart_upload_part>
+          parts;
+        for (uint32_t part_number = 1; part_number <= 2; ++part_number) {
+            iobuf payload;
+            payload.append(expected_payload, expected_payload_size);
+            auto part = client
+                          ->upload_part(
+                            bucket,
+                            key,
+                            upload_id.value(),
+                            part_number,
+                            expected_payload_size,
+                            make_iobuf_input_stream(std::move(payload)),
+                            100ms)
+                          .get();
+            BOOST_REQUIRE(part);
+            BOOST_REQUIRE_EQUAL(part.value().part_number, part_number);
+            BOOST_REQUIRE_EQUAL(
+              part.value().id, fmt::format("etag-{}", part_number));
+            parts.push_back(part.value());
+        }
+
+        auto completed = client
+                           ->complete_multipart_upload(
+                             bucket, key, upload_id.value(), parts, 100ms)
+                           .get();
+        BOOST_REQUIRE(completed);
+
+        auto aborted = client
+                         ->abort_multipart_upload(
+                           bucket, key, upload_id.value(), 100ms)
+                         .get();
+        BOOST_REQUIRE(aborted);
+        client->shutdown();
+        server->stop().get();
+    });
+}
+
 SEASTAR_TEST_CASE(test_put_object_failure) {
     return ss::async([] {
         auto conf = transport_configuration();
@@ -886,3 +985,49 @@ SEASTAR_THREAD_TEST_CASE(test_parse_delete_object_response_no_error) {
     BOOST_REQUIRE_NE(response, nullptr);
     BOOST_REQUIRE(response->undeleted_keys.empty());
 }
+
+SEASTAR_THREAD_TEST_CASE(test_parse_multipart_upload_id_error) {
+    const ss::sstring xml_response
+      = "<Error><Code>SlowDown</Code><Message>Please reduce your request "
+        "rate.</Message><RequestId>R123</RequestId><HostId>H123</HostId></"
+        "Error>";
+
+    iobuf b;
+    b.append(xml_response.data(), xml_response.size());
+    const auto result = cloud_storage_clients::iobuf_to_multipart_upload_id(
+      std::move(b));
+    const auto* error = std::get_if<cloud_storage_clients::rest_error_response>(
+      &result);
+    BOOST_REQUIRE_NE(error, nullptr);
+    BOOST_REQUIRE_EQUAL(error->code_string(), "SlowDown");
+}
+
+SEASTAR_THREAD_TEST_CASE(test_parse_copy_part_etag) {
+    const ss::sstring xml_response
+      = "<CopyPartResult><LastModified>2024-01-01T00:00:00.000Z</"
+        "LastModified><ETag>\"abc123\"</ETag></CopyPartResult>";
+
+    iobuf b;
+    b.append(xml_response.data(), xml_response.size());
+    const auto result = cloud_storage_clients::iobuf_to_copy_part_etag(
+      std::move(b));
+    const auto* etag = std::get_if<ss::sstring>(&result);
+    BOOST_REQUIRE_NE(etag, nullptr);
+    BOOST_REQUIRE_EQUAL(*etag, "\"abc123\"");
+}
+
+SEASTAR_THREAD_TEST_CASE(test_parse_copy_part_etag_error) {
+    // UploadPartCopy can fail after the 200 response was started
+    const ss::sstring xml_response
+      = "<Error><Code>InternalError</Code><Message>We encountered an "
+        "internal error.</Message><RequestId>R123</RequestId></Error>";
+
+    iobuf b;
+    b.append(xml_response.data(), xml_response.size());
+    const auto result = cloud_storage_clients::iobuf_to_copy_part_etag(
+      std::move(b));
+    const auto* error = std::get_if<cloud_storage_clients::rest_error_response>(
+      &result);
+    BOOST_REQUIRE_NE(error, nullptr);
+    BOOST_REQUIRE_EQUAL(error->code_string(), "InternalError");
+}
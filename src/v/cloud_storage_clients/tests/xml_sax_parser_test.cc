@@ -247,3 +247,34 @@ BOOST_AUTO_TEST_CASE(test_parse_abs_with_continuation) {
     BOOST_REQUIRE_EQUAL(result.is_truncated, true);
     BOOST_REQUIRE_EQUAL(result.next_continuation_token, "nnn");
 }
+
+BOOST_AUTO_TEST_CASE(test_parse_payload_in_small_chunks) {
+    // The text of elements is split between chunks, libxml2 hands it to the
+    // parser in several parts.
+    for (size_t chunk_size : {1UL, 3UL, 7UL, 64UL}) {
+        cloud_storage_clients::xml_sax_parser p{};
+        p.start_parse(
+          std::make_unique<cloud_storage_clients::aws_parse_impl>());
+        for (size_t pos = 0; pos < payload.size(); pos += chunk_size) {
+            auto chunk = payload.substr(pos, chunk_size);
+            p.parse_chunk(
+              ss::temporary_buffer<char>(chunk.data(), chunk.size()));
+        }
+        p.end_parse();
+        auto result = p.result();
+        BOOST_REQUIRE_EQUAL(result.contents.size(), 2);
+        BOOST_REQUIRE_EQUAL(result.contents[0].key, "test-key1");
+        BOOST_REQUIRE_EQUAL(result.contents[0].size_bytes, 111);
+        BOOST_REQUIRE_EQUAL(result.contents[0].etag, "test-etag-1");
+        BOOST_REQUIRE(
+          result.contents[0].last_modified
+          == cloud_storage_clients::util::parse_timestamp(
+            "2021-01-10T01:00:00.000Z"));
+        BOOST_REQUIRE_EQUAL(result.contents[1].key, "test-key2");
+        BOOST_REQUIRE_EQUAL(result.contents[1].size_bytes, 222);
+        BOOST_REQUIRE_EQUAL(result.next_continuation_token, "next");
+        BOOST_REQUIRE_EQUAL(result.prefix, "test-prefix");
+        BOOST_REQUIRE_EQUAL(result.common_prefixes.size(), 1);
+        BOOST_REQUIRE_EQUAL(result.common_prefixes[0], "test-prefix");
+    }
+}
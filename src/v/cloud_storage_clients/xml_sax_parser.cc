@@ -293,8 +293,8 @@ void abs_parse_impl::handle_characters(std::string_view characters) {
     }
 }
 
-client::list_bucket_result parser_state::impl::parsed_items() const {
-    return _items;
+client::list_bucket_result parser_state::impl::take_items() {
+    return std::exchange(_items, {});
 }
 
 xml_sax_parser::xml_sax_parser(xml_sax_parser&& other) noexcept {
@@ -346,8 +346,8 @@ void xml_sax_parser::end_parse() {
     }
 }
 
-client::list_bucket_result xml_sax_parser::result() const {
-    return _state->parsed_items();
+client::list_bucket_result xml_sax_parser::result() {
+    return _state->take_items();
 }
 
 void xml_sax_parser::start_element(
@@ -15,6 +15,7 @@
 #include "libxml/parser.h"
 
 #include <stack>
+#include <string>
 
 namespace cloud_storage_clients {
 
@@ -54,7 +55,7 @@ struct parser_state {
         virtual void handle_start_element(std::string_view element_name) = 0;
         virtual void handle_end_element(std::string_view element_name) = 0;
         virtual void handle_characters(std::string_view characters) = 0;
-        client::list_bucket_result parsed_items() const;
+        client::list_bucket_result take_items();
 
         virtual ~impl() = default;
 
@@ -70,23 +71,33 @@ struct parser_state {
     explicit parser_state(std::unique_ptr<impl>);
 
     void handle_start_element(std::string_view element_name) {
+        // Text before a child element is only whitespace between tags
+        _text.clear();
         _impl->handle_start_element(element_name);
     }
 
     void handle_end_element(std::string_view element_name) {
+        if (!_text.empty()) {
+            _impl->handle_characters(_text);
+            _text.clear();
+        }
         _impl->handle_end_element(element_name);
     }
 
+    /// libxml2 may deliver the text of an element in several calls when it
+    /// spans chunks of the response, so the text is gathered and handed to
+    /// the implementation once the element ends.
     void handle_characters(std::string_view characters) {
-        _impl->handle_characters(characters);
+        _text.append(characters);
     }
 
-    client::list_bucket_result parsed_items() const {
-        return _impl->parsed_items();
-    }
+    client::list_bucket_result take_items() { return _impl->take_items(); }
 
 private:
     std::unique_ptr<impl> _impl;
+    /// Text of the current element, reused between elements to avoid
+    /// allocating for every one
+    std::string _text;
 };
 
 struct aws_parse_impl final : public parser_state::impl {
@@ -137,7 +148,9 @@ public:
     /// make sure that libxml2 parsing is finished.
     void end_parse();
 
-    client::list_bucket_result result() const;
+    /// \brief Return the parsed items. The parser state is moved out, so
+    /// this can be called only once after end_parse.
+    client::list_bucket_result result();
 
     /// \brief frees up the parser context pointer
     ~xml_sax_parser();
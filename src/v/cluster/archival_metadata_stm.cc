@@ -29,6 +29,7 @@
 #include "raft/consensus.h"
 #include "raft/persisted_stm.h"
 #include "resource_mgmt/io_priority.h"
+#include "resource_mgmt/memory_accounting.h"
 #include "serde/envelope.h"
 #include "serde/serde.h"
 #include "ssx/future-util.h"
@@ -184,9 +185,21 @@ struct archival_metadata_stm::update_highest_producer_id_cmd {
     using value = model::producer_id;
 };
 
+struct archival_metadata_stm::add_packed_segment_cmd {
+    static constexpr cmd_key key{14};
+
+    struct value
+      : serde::envelope<value, serde::version<0>, serde::compat_version<0>> {
+        model::offset base_offset;
+        cloud_storage::packed_segment_location location;
+
+        auto serde_fields() { return std::tie(base_offset, location); }
+    };
+};
+
 struct archival_metadata_stm::snapshot
   : public serde::
-      envelope<snapshot, serde::version<4>, serde::compat_version<0>> {
+      envelope<snapshot, serde::version<5>, serde::compat_version<0>> {
     /// List of segments
     fragmented_vector<segment> segments;
     /// List of replaced segments
@@ -229,6 +242,8 @@ struct archival_metadata_stm::snapshot
     cloud_storage::anomalies detected_anomalies;
     // Highest producer ID used by this partition.
     model::producer_id highest_producer_id;
+    // Locations of the segments packed into shared objects
+    cloud_storage::partition_manifest::packed_segments_map packed_segments;
 
     auto serde_fields() {
         return std::tie(
@@ -247,7 +262,8 @@ struct archival_metadata_stm::snapshot
           last_partition_scrub,
           last_scrubbed_offset,
           detected_anomalies,
-          highest_producer_id);
+          highest_producer_id,
+          packed_segments);
     }
 };
 
@@ -574,6 +590,7 @@ ss::future<> archival_metadata_stm::make_snapshot(
       .start_kafka_offset = m.get_start_kafka_offset_override(),
       .spillover_manifests = std::move(spillover),
       .highest_producer_id = m.highest_producer_id(),
+      .packed_segments = m.packed_segments(),
     });
 
     auto snapshot = raft::stm_snapshot::create(
@@ -595,7 +612,8 @@ archival_metadata_stm::archival_metadata_stm(
   ss::logger& logger)
   : raft::persisted_stm<>(archival_stm_snapshot, logger, raft)
   , _logger(logger, ssx::sformat("ntp: {}", raft->ntp()))
-  , _mem_tracker(ss::make_shared<util::mem_tracker>(raft->ntp().path()))
+  , _mem_tracker(resources::memory_accounting::local().create_tracker(
+      resources::mem_subsystem::cloud_manifests, raft->ntp().path()))
   , _manifest(ss::make_shared<cloud_storage::partition_manifest>(
       raft->ntp(), raft->log_config().get_initial_revision(), _mem_tracker))
   , _cloud_storage_api(remote)
@@ -892,7 +910,8 @@ ss::future<std::error_code> archival_metadata_stm::add_segments(
   model::producer_id highest_pid,
   ss::lowres_clock::time_point deadline,
   ss::abort_source& as,
-  segment_validated is_validated) {
+  segment_validated is_validated,
+  cloud_storage::partition_manifest::packed_segments_map packed) {
     auto now = ss::lowres_clock::now();
     auto timeout = now < deadline ? deadline - now : 0ms;
     return _lock.with(
@@ -903,14 +922,16 @@ ss::future<std::error_code> archival_metadata_stm::add_segments(
        highest_pid,
        deadline,
        &as,
-       is_validated]() mutable {
+       is_validated,
+       packed = std::move(packed)]() mutable {
           return do_add_segments(
             std::move(s),
             clean_offset,
             highest_pid,
             deadline,
             as,
-            is_validated);
+            is_validated,
+            std::move(packed));
       });
 }
 
@@ -920,7 +941,8 @@ ss::future<std::error_code> archival_metadata_stm::do_add_segments(
   model::producer_id highest_pid,
   ss::lowres_clock::time_point deadline,
   ss::abort_source& as,
-  segment_validated is_validated) {
+  segment_validated is_validated,
+  cloud_storage::partition_manifest::packed_segments_map packed) {
     {
         auto now = ss::lowres_clock::now();
         auto timeout = now < deadline ? deadline - now : 0ms;
@@ -948,6 +970,15 @@ ss::future<std::error_code> archival_metadata_stm::do_add_segments(
         b.add_raw_kv(std::move(key_buf), std::move(val_buf));
     }
 
+    // Applied after the segments, which drop the locations of any segments
+    // they replace.
+    for (auto& [base, location] : packed) {
+        iobuf key_buf = serde::to_iobuf(add_packed_segment_cmd::key);
+        iobuf val_buf = serde::to_iobuf(add_packed_segment_cmd::value{
+          .base_offset = base, .location = std::move(location)});
+        b.add_raw_kv(std::move(key_buf), std::move(val_buf));
+    }
+
     if (clean_offset.has_value()) {
         iobuf key_buf = serde::to_iobuf(
           archival_metadata_stm::mark_clean_cmd::key);
@@ -1083,6 +1114,9 @@ ss::future<> archival_metadata_stm::apply(const model::record_batch& b) {
                   serde::from_iobuf<update_highest_producer_id_cmd::value>(
                     r.release_value()));
                 break;
+            case add_packed_segment_cmd::key:
+                apply_add_packed_segment(r.release_value());
+                break;
             default:
                 throw std::runtime_error(fmt_with_ctx(
                   fmt::format,
@@ -1094,6 +1128,22 @@ ss::future<> archival_metadata_stm::apply(const model::record_batch& b) {
 
     // The offset should only be advanced after all the changes are applied.
     _manifest->advance_insync_offset(b.last_offset());
+    maybe_notify_cloud_log_size();
+}
+
+void archival_metadata_stm::set_cloud_log_size_listener(
+  cloud_log_size_listener listener) {
+    _cloud_log_size_listener = std::move(listener);
+    _notified_cloud_log_size = _manifest->cloud_log_size();
+}
+
+void archival_metadata_stm::maybe_notify_cloud_log_size() {
+    const auto size = _manifest->cloud_log_size();
+    if (!_cloud_log_size_listener || size == _notified_cloud_log_size) {
+        return;
+    }
+    _notified_cloud_log_size = size;
+    _cloud_log_size_listener();
 }
 
 ss::future<> archival_metadata_stm::apply_raft_snapshot(const iobuf&) {
@@ -1130,6 +1180,7 @@ ss::future<> archival_metadata_stm::apply_raft_snapshot(const iobuf&) {
     }
 
     *_manifest = std::move(new_manifest);
+    maybe_notify_cloud_log_size();
     auto start_offset = get_start_offset();
 
     auto iso = _manifest->get_insync_offset();
@@ -1197,7 +1248,9 @@ ss::future<> archival_metadata_stm::apply_local_snapshot(
       snap.last_partition_scrub,
       snap.last_scrubbed_offset,
       snap.detected_anomalies,
-      snap.highest_producer_id);
+      snap.highest_producer_id,
+      std::move(snap.packed_segments));
+    maybe_notify_cloud_log_size();
 
     vlog(
       _logger.info,
@@ -1238,7 +1291,8 @@ ss::future<raft::stm_snapshot> archival_metadata_stm::take_local_snapshot() {
       .last_partition_scrub = _manifest->last_partition_scrub(),
       .last_scrubbed_offset = _manifest->last_scrubbed_offset(),
       .detected_anomalies = _manifest->detected_anomalies(),
-      .highest_producer_id = _manifest->highest_producer_id()});
+      .highest_producer_id = _manifest->highest_producer_id(),
+      .packed_segments = _manifest->packed_segments()});
 
     vlog(
       _logger.debug,
@@ -1410,6 +1464,25 @@ void archival_metadata_stm::apply_reset_metadata() {
     _manifest->unsafe_reset();
 }
 
+void archival_metadata_stm::apply_add_packed_segment(iobuf buf) {
+    auto cmd = serde::from_iobuf<add_packed_segment_cmd::value>(
+      std::move(buf));
+    if (!_manifest->get(cmd.base_offset).has_value()) {
+        vlog(
+          _logger.warn,
+          "Can't add packed location {} of a missing segment at {}",
+          cmd.location,
+          cmd.base_offset);
+        return;
+    }
+    vlog(
+      _logger.debug,
+      "Segment at {} is packed at {}",
+      cmd.base_offset,
+      cmd.location);
+    _manifest->add_packed_segment(cmd.base_offset, std::move(cmd.location));
+}
+
 void archival_metadata_stm::apply_update_highest_producer_id(
   model::producer_id pid) {
     if (_manifest->advance_highest_producer_id(pid)) {
@@ -116,14 +116,16 @@ public:
       ss::logger& logger);
 
     /// Add segments to the raft log, replicate them and
-    /// wait until it is applied to the STM.
+    /// wait until it is applied to the STM. The locations of the segments
+    /// that were packed into shared objects are replicated along with them.
     ss::future<std::error_code> add_segments(
       std::vector<cloud_storage::segment_meta>,
       std::optional<model::offset> clean_offset,
       model::producer_id highest_pid,
       ss::lowres_clock::time_point deadline,
       ss::abort_source&,
-      segment_validated is_validated);
+      segment_validated is_validated,
+      cloud_storage::partition_manifest::packed_segments_map packed = {});
 
     /// Truncate local snapshot by moving start_offset forward
     ///
@@ -251,6 +253,12 @@ public:
 
     ss::future<iobuf> take_snapshot(model::offset) final { co_return iobuf{}; }
 
+    using cloud_log_size_listener = ss::noncopyable_function<void()>;
+
+    /// The listener is invoked every time an applied command or snapshot
+    /// changes the cloud log size of the manifest
+    void set_cloud_log_size_listener(cloud_log_size_listener);
+
 private:
     ss::future<std::error_code> do_add_segments(
       std::vector<cloud_storage::segment_meta>,
@@ -258,7 +266,8 @@ private:
       model::producer_id highest_pid,
       ss::lowres_clock::time_point deadline,
       ss::abort_source&,
-      segment_validated is_validated);
+      segment_validated is_validated,
+      cloud_storage::partition_manifest::packed_segments_map packed);
 
     // Replicate commands in a batch and wait for their application.
     // Should be called under _lock to ensure linearisability
@@ -289,6 +298,7 @@ private:
     struct process_anomalies_cmd;
     struct reset_scrubbing_metadata;
     struct update_highest_producer_id_cmd;
+    struct add_packed_segment_cmd;
     struct snapshot;
 
     friend segment segment_from_meta(const cloud_storage::segment_meta& meta);
@@ -317,6 +327,9 @@ private:
     void apply_process_anomalies(iobuf);
     void apply_reset_scrubbing_metadata();
     void apply_update_highest_producer_id(model::producer_id pid);
+    void apply_add_packed_segment(iobuf);
+
+    void maybe_notify_cloud_log_size();
 
 private:
     prefix_logger _logger;
@@ -326,6 +339,9 @@ private:
     ss::shared_ptr<util::mem_tracker> _mem_tracker;
     ss::shared_ptr<cloud_storage::partition_manifest> _manifest;
 
+    cloud_log_size_listener _cloud_log_size_listener;
+    uint64_t _notified_cloud_log_size{0};
+
     // The offset of the last mark_clean_cmd applied: if the manifest is
     // clean, this will equal last_applied_offset.
     model::offset _last_clean_at;
@@ -46,6 +46,8 @@
 #include <seastar/core/sharded.hh>
 #include <seastar/util/defer.hh>
 
+#include <boost/range/irange.hpp>
+
 #include <exception>
 
 namespace cluster::cloud_metadata {
@@ -136,27 +138,68 @@ ss::future<bool> cluster_recovery_backend::sync_in_term(
       && synced_term == cur_term_opt;
 }
 
+namespace {
+
+// Stages that only depend on the license and the cluster configuration having
+// been restored, and not on one another.
+bool is_independent_stage(recovery_stage stage) {
+    switch (stage) {
+    case recovery_stage::recovered_users:
+    case recovery_stage::recovered_acls:
+    case recovery_stage::recovered_remote_topic_data:
+    case recovery_stage::recovered_topic_data:
+        return true;
+    default:
+        return false;
+    }
+}
+
+} // namespace
+
 ss::future<cluster::errc>
 cluster_recovery_backend::apply_controller_actions_in_term(
   ss::abort_source& term_as,
   model::term_id term,
   cloud_metadata::controller_snapshot_reconciler::controller_actions actions) {
-    for (const auto next_stage : actions.stages) {
+    const auto& stages = actions.stages;
+    size_t begin = 0;
+    while (begin < stages.size()) {
+        // Consecutive independent stages are applied concurrently, their
+        // completion is still replicated in stage order.
+        size_t end = begin + 1;
+        while (end < stages.size() && is_independent_stage(stages[begin])
+               && is_independent_stage(stages[end])) {
+            ++end;
+        }
         if (!co_await sync_in_term(term_as, term)) {
             co_return cluster::errc::not_leader_controller;
         }
-        auto errc = co_await do_action(term_as, next_stage, actions);
-        if (errc != cluster::errc::success) {
-            co_return co_await _recovery_manager.replicate_update(
-              term,
-              recovery_stage::failed,
-              ssx::sformat(
-                "Failed to apply action for {}: {}", next_stage, errc));
-        }
-        errc = co_await _recovery_manager.replicate_update(term, next_stage);
-        if (errc != cluster::errc::success) {
-            co_return errc;
+        std::vector<cluster::errc> errs(end - begin, cluster::errc::success);
+        co_await ss::parallel_for_each(
+          boost::irange(begin, end), [&](size_t i) {
+              return do_action(term_as, stages[i], actions)
+                .then([&errs, i, begin](cluster::errc errc) {
+                    errs[i - begin] = errc;
+                });
+          });
+        for (size_t i = begin; i < end; ++i) {
+            const auto next_stage = stages[i];
+            if (errs[i - begin] != cluster::errc::success) {
+                co_return co_await _recovery_manager.replicate_update(
+                  term,
+                  recovery_stage::failed,
+                  ssx::sformat(
+                    "Failed to apply action for {}: {}",
+                    next_stage,
+                    errs[i - begin]));
+            }
+            auto errc = co_await _recovery_manager.replicate_update(
+              term, next_stage);
+            if (errc != cluster::errc::success) {
+                co_return errc;
+            }
         }
+        begin = end;
     }
     co_return cluster::errc::success;
 }
@@ -200,14 +243,24 @@ ss::future<cluster::errc> cluster_recovery_backend::do_action(
         for (size_t i = 0; i < actions.users.size(); i++) {
             users.emplace_back(std::move(actions.users[i]));
         }
-        for (auto& uc : users) {
-            auto err = co_await _security_frontend.create_user(
-              std::move(uc.user),
-              std::move(uc.cred),
-              users_retry.get_deadline());
-            if (err != make_error_code(errc::success)) {
-                co_return cluster::errc::replication_error;
-            }
+        bool failed = false;
+        co_await ss::max_concurrent_for_each(
+          users,
+          max_concurrent_users,
+          [this, &failed, &users_retry](cluster::user_credential& uc) {
+              return _security_frontend
+                .create_user(
+                  std::move(uc.user),
+                  std::move(uc.cred),
+                  users_retry.get_deadline())
+                .then([&failed](std::error_code err) {
+                    if (err != make_error_code(errc::success)) {
+                        failed = true;
+                    }
+                });
+          });
+        if (failed) {
+            co_return cluster::errc::replication_error;
         }
         break;
     }
@@ -62,6 +62,9 @@ public:
     ss::future<> recover_until_term_change();
 
 private:
+    // Users are created with that many requests in flight.
+    static constexpr size_t max_concurrent_users = 32;
+
     // Syncs the leader in the given term, ensuring it is still leader.
     // Returns false if not, or if no recovery is active.
     ss::future<bool> sync_in_term(ss::abort_source& term_as, model::term_id);
@@ -71,7 +74,8 @@ private:
       model::term_id,
       cloud_metadata::controller_snapshot_reconciler::controller_actions);
 
-    // Runs the action to get to the given stage.
+    // Runs the action to get to the given stage. Actions of independent
+    // stages may run concurrently.
     ss::future<cluster::errc> do_action(
       ss::abort_source& term_as,
       recovery_stage next_stage,
@@ -25,10 +25,12 @@
 #include "model/namespace.h"
 #include "utils/retry_chain_node.h"
 
+#include <seastar/core/loop.hh>
 #include <seastar/core/smp.hh>
 #include <seastar/util/later.hh>
 
 #include <absl/container/node_hash_set.h>
+#include <boost/range/irange.hpp>
 
 namespace cluster::cloud_metadata {
 
@@ -55,56 +57,76 @@ ss::future<error_outcome> offsets_recovery_manager::recover(
         co_await _controller_api.local().wait_for_topic(
           model::kafka_consumer_offsets_nt, parent_retry.get_deadline());
     }
-    for (size_t i = 0; i < snapshot_paths_per_pid.size(); i++) {
-        auto pid = model::partition_id(i);
-        auto ntp = model::ntp{
-          model::kafka_consumer_offsets_nt.ns,
-          model::kafka_consumer_offsets_nt.tp,
-          pid,
-        };
-        offsets_recovery_request req;
-        req.offsets_ntp = ntp;
-        req.bucket = bucket;
-        const auto& paths = snapshot_paths_per_pid[i];
-        for (const auto& snap_path : paths) {
-            req.offsets_snapshot_paths.emplace_back(snap_path());
-        }
-        vlog(
-          clusterlog.info,
-          "Sending recovery request to NTP {} for {} offsets snapshots",
-          ntp,
-          req.offsets_snapshot_paths.size());
-        const auto recovery_timeout
-          = config::shard_local_cfg().kafka_group_recovery_timeout_ms.value();
-        retry_chain_node retry_node(&parent_retry);
-        while (true) {
-            vlog(
-              clusterlog.debug, "Sending recovery request {} to {}", req, ntp);
-            auto permit = retry_node.retry();
-            if (!permit.is_allowed) {
-                vlog(
-                  clusterlog.error,
-                  "Timed out while recovering offsets on {}",
-                  ntp);
-                co_return error_outcome::download_failed;
-            }
-            auto reply = co_await _recovery_router.local().process_or_dispatch(
-              req, ntp, recovery_timeout);
-            if (reply.ec == cluster::errc::success) {
-                break;
-            }
+    auto result = error_outcome::success;
+    co_await ss::max_concurrent_for_each(
+      boost::irange<size_t>(0, snapshot_paths_per_pid.size()),
+      max_concurrent_recoveries,
+      [&](size_t i) {
+          if (result != error_outcome::success) {
+              // Don't start new requests once a partition has failed.
+              return ss::now();
+          }
+          return recover_partition(
+                   parent_retry,
+                   bucket,
+                   model::partition_id(i),
+                   snapshot_paths_per_pid[i])
+            .then([&result](error_outcome err) {
+                if (err != error_outcome::success) {
+                    result = err;
+                }
+            });
+      });
+    co_return result;
+}
+
+ss::future<error_outcome> offsets_recovery_manager::recover_partition(
+  retry_chain_node& parent_retry,
+  const cloud_storage_clients::bucket_name& bucket,
+  model::partition_id pid,
+  const std::vector<cloud_storage::remote_segment_path>& paths) {
+    auto ntp = model::ntp{
+      model::kafka_consumer_offsets_nt.ns,
+      model::kafka_consumer_offsets_nt.tp,
+      pid,
+    };
+    offsets_recovery_request req;
+    req.offsets_ntp = ntp;
+    req.bucket = bucket;
+    for (const auto& snap_path : paths) {
+        req.offsets_snapshot_paths.emplace_back(snap_path());
+    }
+    vlog(
+      clusterlog.info,
+      "Sending recovery request to NTP {} for {} offsets snapshots",
+      ntp,
+      req.offsets_snapshot_paths.size());
+    const auto recovery_timeout
+      = config::shard_local_cfg().kafka_group_recovery_timeout_ms.value();
+    retry_chain_node retry_node(&parent_retry);
+    while (true) {
+        vlog(clusterlog.debug, "Sending recovery request {} to {}", req, ntp);
+        auto permit = retry_node.retry();
+        if (!permit.is_allowed) {
             vlog(
-              clusterlog.debug,
-              "Recovery request failed on {}: {}",
-              ntp,
-              reply.ec);
-            if (reply.ec == cluster::errc::timeout) {
-                co_await ss::sleep_abortable(
-                  retry_node.get_backoff(), retry_node.root_abort_source());
-                continue;
-            }
+              clusterlog.error,
+              "Timed out while recovering offsets on {}",
+              ntp);
             co_return error_outcome::download_failed;
         }
+        auto reply = co_await _recovery_router.local().process_or_dispatch(
+          req, ntp, recovery_timeout);
+        if (reply.ec == cluster::errc::success) {
+            break;
+        }
+        vlog(
+          clusterlog.debug, "Recovery request failed on {}: {}", ntp, reply.ec);
+        if (reply.ec == cluster::errc::timeout) {
+            co_await ss::sleep_abortable(
+              retry_node.get_backoff(), retry_node.root_abort_source());
+            continue;
+        }
+        co_return error_outcome::download_failed;
     }
     co_return error_outcome::success;
 }
@@ -42,6 +42,16 @@ public:
     ~offsets_recovery_manager() override = default;
 
 private:
+    // Partitions of the offsets topic are recovered concurrently, each by the
+    // leader of its coordinator partition.
+    static constexpr size_t max_concurrent_recoveries = 16;
+
+    ss::future<error_outcome> recover_partition(
+      retry_chain_node& parent_retry,
+      const cloud_storage_clients::bucket_name& bucket,
+      model::partition_id,
+      const std::vector<cloud_storage::remote_segment_path>& snapshot_paths);
+
     ss::sharded<offsets_recovery_router>& _recovery_router;
     ss::sharded<kafka::coordinator_ntp_mapper>& _mapper;
     ss::sharded<cluster::members_table>& _members;
@@ -66,7 +66,44 @@ ss::future<std::optional<uint64_t>> cloud_storage_size_reducer::reduce() {
     }
 }
 
+ss::future<std::optional<uint64_t>>
+cloud_storage_size_reducer::reduce_from_leader_counters() {
+    const auto expected_partitions = _topic_table.local().partition_count();
+
+    std::vector<ss::future<result<cloud_storage_usage_reply>>> futs;
+    futs.reserve(_members_table.local().node_count());
+    for (const auto& [id, md] : _members_table.local().nodes()) {
+        futs.emplace_back(send_query(md.broker, {.local_leaders = true}));
+    }
+    auto results = co_await ss::when_all_succeed(futs.begin(), futs.end());
+
+    uint64_t total_cloud_storage_bytes{0};
+    uint64_t leader_partitions{0};
+    for (auto& res : results) {
+        if (res.has_error()) {
+            co_return std::nullopt;
+        }
+        total_cloud_storage_bytes += res.value().total_size_bytes;
+        leader_partitions += res.value().leader_partitions;
+    }
+
+    if (leader_partitions != expected_partitions) {
+        vlog(
+          clusterlog.debug,
+          "Cloud storage usage counters account for {} partitions out of {}, "
+          "querying all partitions",
+          leader_partitions,
+          expected_partitions);
+        co_return std::nullopt;
+    }
+    co_return total_cloud_storage_bytes;
+}
+
 ss::future<uint64_t> cloud_storage_size_reducer::do_reduce() {
+    if (auto total = co_await reduce_from_leader_counters(); total) {
+        co_return *total;
+    }
+
     topic_table_partition_generator partition_gen{_topic_table, _batch_size};
 
     uint64_t total_cloud_storage_bytes{0};
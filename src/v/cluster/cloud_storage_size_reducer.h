@@ -42,6 +42,13 @@ public:
  * throw if the topic table has been updated during the iteration. If such
  * a change does happen, it's treated as a retryable error.
  *
+ * Before the partitions are visited, every node is asked for the usage of the
+ * partitions it leads. Nodes keep it in incrementally maintained counters (see
+ * cloud_storage_usage_tracker), so this costs a single RPC per node. The sum
+ * is used only if the number of partitions the nodes account for matches the
+ * number of partitions in the topic table, e.g. it is not used while a
+ * partition is leaderless or when some nodes don't maintain the counters yet.
+ *
  * Usage: `reduce` should only be called once per object instance.
  */
 class cloud_storage_size_reducer {
@@ -60,6 +67,7 @@ public:
 
 private:
     ss::future<uint64_t> do_reduce();
+    ss::future<std::optional<uint64_t>> reduce_from_leader_counters();
 
     ss::future<result<cloud_storage_usage_reply>> send_query(
       const model::broker& destination, cloud_storage_usage_request req);
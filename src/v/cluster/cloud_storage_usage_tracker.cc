@@ -0,0 +1,92 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "cluster/cloud_storage_usage_tracker.h"
+
+namespace cluster {
+
+void cloud_storage_usage_tracker::add(
+  const model::ntp& ntp, uint64_t cloud_log_size, bool is_leader) {
+    remove(ntp);
+    auto [it, _] = _partitions.emplace(
+      ntp,
+      partition_usage{
+        .cloud_log_size = cloud_log_size, .is_leader = is_leader});
+    account(ntp, it->second);
+}
+
+void cloud_storage_usage_tracker::remove(const model::ntp& ntp) {
+    auto it = _partitions.find(ntp);
+    if (it == _partitions.end()) {
+        return;
+    }
+    unaccount(ntp, it->second);
+    _partitions.erase(it);
+}
+
+void cloud_storage_usage_tracker::update_size(
+  const model::ntp& ntp, uint64_t cloud_log_size) {
+    auto it = _partitions.find(ntp);
+    if (
+      it == _partitions.end()
+      || it->second.cloud_log_size == cloud_log_size) {
+        return;
+    }
+    unaccount(ntp, it->second);
+    it->second.cloud_log_size = cloud_log_size;
+    account(ntp, it->second);
+}
+
+void cloud_storage_usage_tracker::update_leadership(
+  const model::ntp& ntp, bool is_leader) {
+    auto it = _partitions.find(ntp);
+    if (it == _partitions.end() || it->second.is_leader == is_leader) {
+        return;
+    }
+    unaccount(ntp, it->second);
+    it->second.is_leader = is_leader;
+    account(ntp, it->second);
+}
+
+void cloud_storage_usage_tracker::account(
+  const model::ntp& ntp, const partition_usage& usage) {
+    if (!usage.is_leader) {
+        return;
+    }
+    _total_bytes += usage.cloud_log_size;
+    _leader_partitions += 1;
+    auto it = _bytes_by_topic.find(model::topic_namespace_view(ntp));
+    if (it == _bytes_by_topic.end()) {
+        it = _bytes_by_topic
+               .emplace(model::topic_namespace(ntp.ns, ntp.tp.topic), 0)
+               .first;
+    }
+    it->second += usage.cloud_log_size;
+}
+
+void cloud_storage_usage_tracker::unaccount(
+  const model::ntp& ntp, const partition_usage& usage) {
+    if (!usage.is_leader) {
+        return;
+    }
+    _total_bytes -= usage.cloud_log_size;
+    _leader_partitions -= 1;
+    auto it = _bytes_by_topic.find(model::topic_namespace_view(ntp));
+    if (it == _bytes_by_topic.end()) {
+        return;
+    }
+    it->second -= usage.cloud_log_size;
+    if (it->second == 0) {
+        _bytes_by_topic.erase(it);
+    }
+}
+
+} // namespace cluster
@@ -0,0 +1,68 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "model/fundamental.h"
+#include "model/ktp.h"
+#include "model/metadata.h"
+
+#include <absl/container/flat_hash_map.h>
+
+namespace cluster {
+
+/*
+ * Per shard cloud storage usage of the partitions led by this shard.
+ *
+ * Every partition hosted on the shard is tracked with the cloud log size last
+ * reported by its archival_metadata_stm and whether the local replica is the
+ * leader. The totals, overall and per topic, only include the leaders, so
+ * that summing them over all the shards of the cluster counts each partition
+ * exactly once. All the updates are O(1), so that the cluster wide usage can
+ * be computed without visiting every partition.
+ */
+class cloud_storage_usage_tracker {
+public:
+    using topic_usage_t = absl::flat_hash_map<
+      model::topic_namespace,
+      uint64_t,
+      model::topic_namespace_hash,
+      model::topic_namespace_eq>;
+
+    void add(const model::ntp&, uint64_t cloud_log_size, bool is_leader);
+    void remove(const model::ntp&);
+
+    void update_size(const model::ntp&, uint64_t cloud_log_size);
+    void update_leadership(const model::ntp&, bool is_leader);
+
+    /// Cloud log size of all partitions led by this shard
+    uint64_t total_bytes() const { return _total_bytes; }
+    /// Number of partitions led by this shard
+    size_t leader_partitions() const { return _leader_partitions; }
+    /// Cloud log size of all partitions led by this shard, by topic
+    const topic_usage_t& bytes_by_topic() const { return _bytes_by_topic; }
+
+private:
+    struct partition_usage {
+        uint64_t cloud_log_size{0};
+        bool is_leader{false};
+    };
+
+    void account(const model::ntp&, const partition_usage&);
+    void unaccount(const model::ntp&, const partition_usage&);
+
+    model::ntp_flat_map_type<partition_usage> _partitions;
+    topic_usage_t _bytes_by_topic;
+    uint64_t _total_bytes{0};
+    size_t _leader_partitions{0};
+};
+
+} // namespace cluster
@@ -429,7 +429,9 @@ ss::future<> controller::start(
           return _shard_balancer.start_single(
             std::ref(_tp_state),
             std::ref(_shard_placement),
-            std::ref(_backend));
+            std::ref(_backend),
+            std::ref(_partition_manager),
+            std::ref(_storage));
       })
       .then(
         [this] { return _drain_manager.invoke_on_all(&drain_manager::start); })
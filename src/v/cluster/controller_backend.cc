@@ -333,11 +333,21 @@ controller_backend::controller_backend(
       std::move(initial_retention_local_target_bytes))
   , _initial_retention_local_target_ms(
       std::move(initial_retention_local_target_ms))
-  , _as(as) {
+  , _as(as)
+  , _reconciliation_concurrency(
+      config::shard_local_cfg()
+        .controller_backend_reconciliation_concurrency.bind()) {
     _housekeeping_interval.watch([this] {
         _housekeeping_jitter = simple_time_jitter<ss::lowres_clock>(
           _housekeeping_interval());
     });
+    _reconciliation_concurrency.watch([this] {
+        // reconciliation stays blocked until the backend is started
+        if (_reconciliation_started) {
+            _reconciliation_scheduler.set_capacity(
+              _reconciliation_concurrency());
+        }
+    });
 }
 
 controller_backend::~controller_backend() = default;
@@ -352,7 +362,7 @@ ss::future<> controller_backend::stop() {
     for (auto& [_, rs] : _states) {
         rs->wakeup_event.set();
     }
-    _reconciliation_sem.broken();
+    _reconciliation_scheduler.broken();
     co_await _gate.close();
 }
 
@@ -377,6 +387,23 @@ void controller_backend::setup_metrics() {
           [this] { return _states.size(); },
           sm::description(
             "Number of partitions with ongoing/requested operations")),
+        sm::make_gauge(
+          "reconciliation_queue_depth",
+          [this] { return _reconciliation_scheduler.waiting(); },
+          sm::description(
+            "Number of partitions waiting for a reconciliation slot")),
+        sm::make_gauge(
+          "reconciliations_in_progress",
+          [this] { return _reconciliation_scheduler.running(); },
+          sm::description("Number of partitions being reconciled")),
+        sm::make_histogram(
+          "reconciliation_queue_latency",
+          [this] {
+              return _reconciliation_scheduler.wait_latency()
+                .internal_histogram_logform();
+          },
+          sm::description(
+            "Time partitions waited for a reconciliation slot")),
       });
 }
 /**
@@ -447,8 +474,8 @@ ss::future<> controller_backend::start() {
         }
 
         // unblock reconciliation fibers
-        constexpr size_t max_reconciliation_concurrency = 1024;
-        _reconciliation_sem.signal(max_reconciliation_concurrency);
+        _reconciliation_started = true;
+        _reconciliation_scheduler.set_capacity(_reconciliation_concurrency());
 
         start_fetch_deltas_loop();
         ssx::background = stuck_ntp_watchdog_fiber();
@@ -522,102 +549,14 @@ ss::future<std::error_code> revert_configuration_update(
       std::nullopt);
 }
 
-/**
- * Retrieve topic property based on the following logic
- *
- *
- * +---------------------------------+---------------+----------+-------------+
- * |Cluster(optional)\Topic(tristate)|     Empty     | Disabled |    Value    |
- * +---------------------------------+---------------+----------+-------------+
- * |Empty                            | OFF           | OFF      | Topic Value |
- * |Value                            | Cluster Value | OFF      | Topic Value |
- * +---------------------------------+---------------+----------+-------------+
- *
- */
-template<typename T>
-std::optional<T> get_topic_property(
-  std::optional<T> cluster_level_property, tristate<T> topic_property) {
-    // disabled
-    if (topic_property.is_disabled()) {
-        return std::nullopt;
-    }
-    // has value
-    if (topic_property.has_optional_value()) {
-        return *topic_property;
-    }
-    return cluster_level_property;
-}
-
 } // namespace
 
 std::optional<model::offset>
 controller_backend::calculate_learner_initial_offset(
   const ss::lw_shared_ptr<partition>& p) const {
-    /**
-     * Initial learner start offset only makes sense for partitions with cloud
-     * storage data
-     */
-    if (!p->cloud_data_available()) {
-        vlog(clusterlog.trace, "no cloud data available for: {}", p->ntp());
-        return std::nullopt;
-    }
-
-    auto log = p->log();
-    /**
-     * Calculate retention targets based on cluster and topic configuration
-     */
-    const auto initial_retention_bytes = get_topic_property(
+    return p->initial_retention_offset(
       _initial_retention_local_target_bytes(),
-      log->config().has_overrides()
-        ? log->config().get_overrides().initial_retention_local_target_bytes
-        : tristate<size_t>{std::nullopt});
-
-    const auto initial_retention_ms = get_topic_property(
-      _initial_retention_local_target_ms(),
-      log->config().has_overrides()
-        ? log->config().get_overrides().initial_retention_local_target_ms
-        : tristate<std::chrono::milliseconds>{std::nullopt});
-    /**
-     * Initial target retention disabled
-     */
-    if (
-      !initial_retention_bytes.has_value()
-      && !initial_retention_ms.has_value()) {
-        return std::nullopt;
-    }
-
-    model::timestamp retention_timestamp_threshold(0);
-    if (initial_retention_ms) {
-        retention_timestamp_threshold = model::timestamp(
-          model::timestamp::now().value() - initial_retention_ms->count());
-    }
-
-    auto retention_offset = log->retention_offset(storage::gc_config(
-      retention_timestamp_threshold, initial_retention_bytes));
-
-    if (!retention_offset) {
-        return std::nullopt;
-    }
-
-    auto const cloud_storage_safe_offset
-      = p->archival_meta_stm()->max_collectible_offset();
-    /**
-     * Last offset uploaded to the cloud is target learner retention upper
-     * bound. We can not start retention recover from the point which is not yet
-     * uploaded to Cloud Storage.
-     */
-    vlog(
-      clusterlog.trace,
-      "[{}] calculated retention offset: {}, last uploaded to cloud: {}, "
-      "manifest clean offset: {}, max_collectible_offset: {}",
-      p->ntp(),
-      *retention_offset,
-      p->archival_meta_stm()->manifest().get_last_offset(),
-      p->archival_meta_stm()->get_last_clean_at(),
-      cloud_storage_safe_offset);
-
-    return model::next_offset(
-      std::min(cloud_storage_safe_offset, *retention_offset));
+      _initial_retention_local_target_ms());
 }
 
 ss::future<> controller_backend::fetch_deltas() {
@@ -809,7 +748,8 @@ ss::future<> controller_backend::reconcile_ntp_fiber(
         }
 
         try {
-            auto sem_units = co_await ss::get_units(_reconciliation_sem, 1);
+            auto units = co_await _reconciliation_scheduler.acquire(
+              reconciliation_priority(ntp, *rs));
             rs->last_retried_at = ss::lowres_clock::now();
             co_await try_reconcile_ntp(ntp, *rs);
             if (rs->is_reconciled()) {
@@ -1835,6 +1775,25 @@ bool controller_backend::should_skip(const model::ntp& ntp) const {
     return config::node().recovery_mode_enabled() && model::is_user_topic(ntp);
 }
 
+reconciliation_scheduler::priority controller_backend::reconciliation_priority(
+  const model::ntp& ntp, const ntp_reconciliation_state& rs) const {
+    using priority = reconciliation_scheduler::priority;
+    if (rs.removed) {
+        return priority::normal;
+    }
+    // clients are waiting for the partitions that have no leader or are led
+    // by this node, and for the replicas that partition moves are adding to
+    // restore the replication factor
+    auto leader = _partition_leaders_table.local().get_leader(ntp);
+    if (!leader || *leader == _self) {
+        return priority::high;
+    }
+    if (_topics.local().is_update_in_progress(ntp)) {
+        return priority::high;
+    }
+    return priority::normal;
+}
+
 std::pair<controller_backend::vnodes, controller_backend::vnodes>
 controller_backend::split_voters_learners_for_force_reconfiguration(
   const replicas_t& original,
@@ -14,6 +14,7 @@
 #include "base/outcome.h"
 #include "cluster/errc.h"
 #include "cluster/fwd.h"
+#include "cluster/reconciliation_scheduler.h"
 #include "cluster/shard_placement_table.h"
 #include "cluster/topic_table.h"
 #include "cluster/types.h"
@@ -358,6 +359,9 @@ private:
 
     bool should_skip(const model::ntp&) const;
 
+    reconciliation_scheduler::priority reconciliation_priority(
+      const model::ntp&, const ntp_reconciliation_state&) const;
+
     std::optional<model::offset> calculate_learner_initial_offset(
       const ss::lw_shared_ptr<partition>& partition) const;
 
@@ -384,9 +388,11 @@ private:
       _states;
 
     // Limits the number of concurrently executing reconciliation fibers.
-    // Initially reconciliation is blocked and we deposit a non-zero amount of
-    // units when we are ready to start reconciling.
-    ssx::semaphore _reconciliation_sem{0, "c/controller-be"};
+    // Initially reconciliation is blocked and the capacity is set when we are
+    // ready to start reconciling.
+    reconciliation_scheduler _reconciliation_scheduler;
+    config::binding<size_t> _reconciliation_concurrency;
+    bool _reconciliation_started{false};
     ss::gate _gate;
 
     metrics::internal_metric_groups _metrics;
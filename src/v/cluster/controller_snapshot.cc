@@ -11,6 +11,8 @@
 
 #include "cluster/controller_snapshot.h"
 
+#include <seastar/coroutine/maybe_yield.hh>
+
 namespace cluster {
 
 namespace controller_snapshot_parts {
@@ -38,12 +40,17 @@ ss::future<> write_map_async(iobuf& out, Map t) {
           ssx::sformat, "serde: map size {} exceeds serde_size_t", t.size()));
     }
     write(out, static_cast<serde::serde_size_t>(t.size()));
-    return ss::do_with(std::move(t), [&out](Map& t) {
-        return ss::do_for_each(t, [&out](auto& el) {
-            write(out, el.first);
-            return serde::write_async(out, std::move(el.second));
-        });
-    });
+    // Entries are destroyed as soon as they are serialized, so that the
+    // snapshot and its serialized form are never both fully in memory.
+    auto it = t.begin();
+    while (it != t.end()) {
+        write(out, it->first);
+        co_await serde::write_async(out, std::move(it->second));
+        // erasing a range returns the next iterator for both hash and btree
+        // maps, and doesn't invalidate it
+        it = t.erase(it, std::next(it));
+        co_await ss::coroutine::maybe_yield();
+    }
 }
 
 template<typename T>
@@ -130,7 +137,7 @@ ss::future<> topics_t::serde_async_write(iobuf& out) {
     co_await write_map_async(out, std::move(topics));
     serde::write(out, highest_group_id);
     co_await write_map_async(out, std::move(lifecycle_markers));
-    co_await write_map_async(out, partitions_to_force_recover);
+    co_await write_map_async(out, std::move(partitions_to_force_recover));
 }
 
 ss::future<>
@@ -178,9 +185,13 @@ ss::future<> controller_snapshot::serde_async_write(iobuf& out) {
     co_await serde::write_async(out, std::move(bootstrap));
     co_await serde::write_async(out, std::move(features));
     co_await serde::write_async(out, std::move(members));
+    co_await ss::coroutine::maybe_yield();
     co_await serde::write_async(out, std::move(config));
+    co_await ss::coroutine::maybe_yield();
     co_await serde::write_async(out, std::move(topics));
+    co_await ss::coroutine::maybe_yield();
     co_await serde::write_async(out, std::move(security));
+    co_await ss::coroutine::maybe_yield();
     co_await serde::write_async(out, std::move(metrics_reporter));
     co_await serde::write_async(out, std::move(plugins));
     co_await serde::write_async(out, std::move(cluster_recovery));
@@ -154,10 +154,16 @@ ss::future<> controller_stm::apply_snapshot(
       size,
       get_last_applied_offset());
 
-    auto snap_buf_parser = iobuf_parser{
-      co_await read_iobuf_exactly(reader.input(), size)};
-    auto snapshot = co_await serde::read_async<controller_snapshot>(
-      snap_buf_parser);
+    controller_snapshot snapshot;
+    {
+        // release the serialized snapshot before applying it, so that large
+        // snapshots are in memory only once while the stms update their state
+        auto snap_buf_parser = iobuf_parser{
+          co_await read_iobuf_exactly(reader.input(), size)};
+        snapshot = co_await serde::read_async<controller_snapshot>(
+          snap_buf_parser);
+    }
+    co_await ss::yield();
 
     try {
         co_await std::get<bootstrap_backend&>(_state).apply_snapshot(
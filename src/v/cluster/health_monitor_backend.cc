@@ -362,6 +362,11 @@ health_monitor_backend::dispatch_refresh_cluster_health_request(
     }
 
     _status.clear();
+    // the reports received from the leader don't match the revisions acked by
+    // this node when it was the leader
+    for (auto& [_, last_reply] : _last_replies) {
+        last_reply.report_revision = std::nullopt;
+    }
     for (auto& n_status : reply.value().report->node_states) {
         _status.emplace(n_status.id, n_status);
     }
@@ -495,16 +500,24 @@ health_monitor_backend::maybe_refresh_cluster_health(
 ss::future<result<node_health_report>>
 health_monitor_backend::collect_remote_node_health(model::node_id id) {
     const auto timeout = model::timeout_clock::now() + max_metadata_age();
+    get_node_health_request req{
+      .filter = node_report_filter{},
+      .accepts_delta = true,
+    };
+    if (auto it = _last_replies.find(id);
+        it != _last_replies.end() && _reports.contains(id)) {
+        req.acked_revision = it->second.report_revision;
+    }
     return _connections.local()
       .with_node_client<controller_client_protocol>(
         _raft0->self().id(),
         ss::this_shard_id(),
         id,
         max_metadata_age(),
-        [timeout](controller_client_protocol client) mutable {
+        [timeout, req = std::move(req)](
+          controller_client_protocol client) mutable {
             return client.collect_node_health_report(
-              get_node_health_request{.filter = node_report_filter{}},
-              rpc::client_opts(timeout));
+              std::move(req), rpc::client_opts(timeout));
         })
       .then(&rpc::get_ctx_data<get_node_health_reply>)
       .then([this, id](result<get_node_health_reply> reply) {
@@ -526,8 +539,30 @@ map_reply_result(result<get_node_health_reply> reply) {
 result<node_health_report> health_monitor_backend::process_node_reply(
   model::node_id id, result<get_node_health_reply> reply) {
     auto [it, _] = _last_replies.try_emplace(id);
+    it->second.report_revision = std::nullopt;
+
+    std::optional<int64_t> report_revision;
+    if (reply && reply.value().report.has_value()) {
+        report_revision = reply.value().report_revision;
+        if (reply.value().is_delta) {
+            auto base_it = _reports.find(id);
+            if (base_it == _reports.end()) {
+                // can not happen unless the report cache was replaced while
+                // the request was in flight, the next reply will be full
+                reply = result<get_node_health_reply>(
+                  make_error_code(errc::invalid_request));
+            } else {
+                auto report = base_it->second;
+                apply_health_report_delta(
+                  report,
+                  std::move(*reply.value().report),
+                  reply.value().removed_partitions);
+                reply.value().report = std::move(report);
+            }
+        }
+    }
 
-    auto res = map_reply_result(reply);
+    auto res = map_reply_result(std::move(reply));
     if (!res) {
         vlog(
           clusterlog.trace,
@@ -545,7 +580,7 @@ result<node_health_report> health_monitor_backend::process_node_reply(
               id,
               res.error().message());
         }
-        return result<node_health_report>(reply.error());
+        return result<node_health_report>(res.error());
     }
 
     // TODO serialize storage_space_alert, instead of recomputing here.
@@ -560,6 +595,7 @@ result<node_health_report> health_monitor_backend::process_node_reply(
           id);
     }
     it->second.is_alive = alive::yes;
+    it->second.report_revision = report_revision;
 
     return res;
 }
@@ -663,6 +699,17 @@ health_monitor_backend::collect_current_node_health(node_report_filter filter) {
 
     co_return ret;
 }
+
+ss::future<result<get_node_health_reply>>
+health_monitor_backend::collect_current_node_health_delta(
+  std::optional<int64_t> acked_revision) {
+    auto res = co_await collect_current_node_health(node_report_filter{});
+    if (!res) {
+        co_return res.error();
+    }
+    co_return _delta_encoder.encode(std::move(res.value()), acked_revision);
+}
+
 namespace {
 
 struct ntp_leader {
@@ -12,6 +12,7 @@
 #pragma once
 #include "cluster/fwd.h"
 #include "cluster/health_monitor_types.h"
+#include "cluster/health_report_delta.h"
 #include "cluster/node/local_monitor.h"
 #include "features/feature_table.h"
 #include "model/metadata.h"
@@ -71,6 +72,14 @@ public:
     ss::future<result<node_health_report>>
       collect_current_node_health(node_report_filter);
 
+    /**
+     * Collects the full report of the current node and encodes it as a delta
+     * of the report whose revision was acked by the requester, see
+     * health_report_delta_encoder.
+     */
+    ss::future<result<get_node_health_reply>>
+      collect_current_node_health_delta(std::optional<int64_t> acked_revision);
+
     cluster::notification_id_type register_node_callback(health_node_cb_t cb);
     void unregister_node_callback(cluster::notification_id_type id);
 
@@ -108,6 +117,9 @@ private:
         ss::lowres_clock::time_point last_reply_timestamp
           = ss::lowres_clock::time_point::min();
         alive is_alive = alive::no;
+        // revision of the node report in the report cache, the next request
+        // acks it so that the node only sends what changed since then
+        std::optional<int64_t> report_revision;
     };
 
     using status_cache_t = absl::node_hash_map<model::node_id, node_state>;
@@ -194,6 +206,8 @@ private:
     storage::disk_space_alert _reports_disk_health
       = storage::disk_space_alert::ok;
     last_reply_cache_t _last_replies;
+    // encodes the reports of the current node sent to the controller leader
+    health_report_delta_encoder _delta_encoder;
     std::optional<size_t> _bytes_in_cloud_storage;
 
     ss::gate _gate;
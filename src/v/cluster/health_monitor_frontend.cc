@@ -64,6 +64,14 @@ health_monitor_frontend::collect_node_health(node_report_filter f) {
       });
 }
 
+ss::future<result<get_node_health_reply>>
+health_monitor_frontend::collect_node_health_delta(
+  std::optional<int64_t> acked_revision) {
+    return dispatch_to_backend([acked_revision](health_monitor_backend& be) {
+        return be.collect_current_node_health_delta(acked_revision);
+    });
+}
+
 // Return status of single node
 ss::future<result<std::vector<node_state>>>
 health_monitor_frontend::get_nodes_status(
@@ -86,6 +94,17 @@ health_monitor_frontend::get_nodes_status(
     });
 }
 
+std::optional<std::vector<node_state>>
+health_monitor_frontend::get_cached_nodes_status() const {
+    if (
+      _nodes_status.empty()
+      || ss::lowres_clock::now() - _nodes_status_updated_at
+           > nodes_status_max_age) {
+        return std::nullopt;
+    }
+    return _nodes_status;
+}
+
 ss::future<result<std::optional<cluster::drain_manager::drain_status>>>
 health_monitor_frontend::get_node_drain_status(
   model::node_id node_id, model::timeout_clock::time_point deadline) {
@@ -123,6 +142,24 @@ ss::future<> health_monitor_frontend::update_frontend_and_backend_cache() {
         _cluster_disk_health = disk_health;
         co_await update_other_shards(disk_health);
     }
+    co_await update_nodes_status_cache();
+}
+
+ss::future<> health_monitor_frontend::update_nodes_status_cache() {
+    auto res = co_await get_nodes_status(model::time_from_now(default_timeout));
+    if (!res) {
+        vlog(
+          clusterlog.debug,
+          "Unable to refresh node status cache: {}",
+          res.error().message());
+        co_return;
+    }
+    co_await container().invoke_on_all(
+      [states = std::move(res.value()),
+       now = ss::lowres_clock::now()](health_monitor_frontend& fe) {
+          fe._nodes_status = states;
+          fe._nodes_status_updated_at = now;
+      });
 }
 
 // Handler for refresh_shard's update timer
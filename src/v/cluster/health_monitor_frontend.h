@@ -30,13 +30,18 @@ namespace cluster {
  * Health monitor frontend is available on every node and dispatches requests to
  * health monitor backend which lives on single shard.
  * Most requests are forwarded to the backend shard, except cluster-level disk
- * health, which is kept cached on each core for fast access.
+ * health and the status of the nodes, which are kept cached on each core for
+ * fast access.
  */
 class health_monitor_frontend
   : public seastar::peering_sharded_service<health_monitor_frontend> {
 public:
     static constexpr auto default_timeout = std::chrono::seconds(5);
     static constexpr std::chrono::seconds disk_health_refresh_interval{5};
+    // cached node status is only used as long as the refresher keeps it up to
+    // date
+    static constexpr std::chrono::seconds nodes_status_max_age
+      = 3 * disk_health_refresh_interval;
     static constexpr ss::shard_id refresher_shard
       = cluster::controller_stm_shard;
 
@@ -59,10 +64,19 @@ public:
     ss::future<result<node_health_report>>
       collect_node_health(node_report_filter);
 
+    // Collects current node health report and encodes it as a delta of the
+    // report with the acked revision, if the revision is still known
+    ss::future<result<get_node_health_reply>>
+      collect_node_health_delta(std::optional<int64_t> acked_revision);
+
     // Return status of all nodes
     ss::future<result<std::vector<node_state>>>
       get_nodes_status(model::timeout_clock::time_point);
 
+    // Return status of all nodes from the shard local cache, without
+    // dispatching to the backend. Empty if the cache wasn't refreshed recently.
+    std::optional<std::vector<node_state>> get_cached_nodes_status() const;
+
     /**
      * Return drain status for a given node.
      */
@@ -97,11 +111,14 @@ private:
     // Currently the worst / max of all nodes' disk space state
     storage::disk_space_alert _cluster_disk_health{
       storage::disk_space_alert::ok};
+    std::vector<node_state> _nodes_status;
+    ss::lowres_clock::time_point _nodes_status_updated_at;
     ss::timer<ss::lowres_clock> _refresh_timer;
     ss::gate _refresh_gate;
 
     void disk_health_tick();
     ss::future<> update_other_shards(const storage::disk_space_alert);
+    ss::future<> update_nodes_status_cache();
     ss::future<> update_frontend_and_backend_cache();
 };
 } // namespace cluster
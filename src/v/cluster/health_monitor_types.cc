@@ -234,12 +234,26 @@ std::ostream& operator<<(std::ostream& o, const partitions_filter& filter) {
 
 std::ostream& operator<<(std::ostream& o, const get_node_health_request& r) {
     fmt::print(
-      o, "{{filter: {}, current_version: {}}}", r.filter, r.current_version);
+      o,
+      "{{filter: {}, current_version: {}, accepts_delta: {}, acked_revision: "
+      "{}}}",
+      r.filter,
+      r.current_version,
+      r.accepts_delta,
+      r.acked_revision);
     return o;
 }
 
 std::ostream& operator<<(std::ostream& o, const get_node_health_reply& r) {
-    fmt::print(o, "{{error: {}, report: {}}}", r.error, r.report);
+    fmt::print(
+      o,
+      "{{error: {}, report: {}, report_revision: {}, is_delta: {}, "
+      "removed_partitions: {}}}",
+      r.error,
+      r.report,
+      r.report_revision,
+      r.is_delta,
+      r.removed_partitions.size());
     return o;
 }
 
@@ -254,7 +268,15 @@ std::ostream& operator<<(std::ostream& o, const get_cluster_health_request& r) {
 }
 
 std::ostream& operator<<(std::ostream& o, const get_cluster_health_reply& r) {
-    fmt::print(o, "{{error: {}, report: {}}}", r.error, r.report);
+    fmt::print(
+      o,
+      "{{error: {}, report: {}, report_revision: {}, is_delta: {}, "
+      "removed_partitions: {}}}",
+      r.error,
+      r.report,
+      r.report_revision,
+      r.is_delta,
+      r.removed_partitions.size());
     return o;
 }
 
@@ -330,7 +330,7 @@ using force_refresh = ss::bool_class<struct hm_force_refresh_tag>;
 struct get_node_health_request
   : serde::envelope<
       get_node_health_request,
-      serde::version<0>,
+      serde::version<1>,
       serde::compat_version<0>> {
     using rpc_adl_exempt = std::true_type;
     static constexpr int8_t initial_version = 0;
@@ -344,6 +344,11 @@ struct get_node_health_request
     node_report_filter filter;
     // this field is not serialized
     int8_t decoded_version = current_version;
+    // set by requesters which can apply a reply carrying only the partitions
+    // which changed since acked_revision
+    bool accepts_delta{false};
+    // revision of the last report of the node that the requester applied
+    std::optional<int64_t> acked_revision;
 
     friend bool
     operator==(const get_node_health_request&, const get_node_health_request&)
@@ -352,19 +357,31 @@ struct get_node_health_request
     friend std::ostream&
     operator<<(std::ostream&, const get_node_health_request&);
 
-    auto serde_fields() { return std::tie(filter); }
+    auto serde_fields() {
+        return std::tie(filter, accepts_delta, acked_revision);
+    }
 };
 
 struct get_node_health_reply
   : serde::envelope<
       get_node_health_reply,
-      serde::version<0>,
+      serde::version<1>,
       serde::compat_version<0>> {
     using rpc_adl_exempt = std::true_type;
     static constexpr int8_t current_version = 0;
 
     errc error = cluster::errc::success;
     std::optional<node_health_report> report;
+    // revision of the report, set when the requester accepts deltas
+    std::optional<int64_t> report_revision;
+    /*
+     * when set the report topics only contain the partitions whose status
+     * changed since the revision acked in the request, and the partitions
+     * which the node doesn't host anymore are listed in removed_partitions.
+     * see health_report_delta_encoder.
+     */
+    bool is_delta{false};
+    std::vector<model::ntp> removed_partitions;
 
     friend bool
     operator==(const get_node_health_reply&, const get_node_health_reply&)
@@ -373,7 +390,10 @@ struct get_node_health_reply
     friend std::ostream&
     operator<<(std::ostream&, const get_node_health_reply&);
 
-    auto serde_fields() { return std::tie(error, report); }
+    auto serde_fields() {
+        return std::tie(
+          error, report, report_revision, is_delta, removed_partitions);
+    }
 };
 
 struct get_cluster_health_request
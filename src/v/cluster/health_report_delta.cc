@@ -0,0 +1,174 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "cluster/health_report_delta.h"
+
+#include "random/generators.h"
+
+#include <absl/container/flat_hash_set.h>
+
+#include <limits>
+
+namespace cluster {
+
+// revisions start at a random value so that an ack of a report sent before
+// a restart of this node doesn't match a report sent after it
+health_report_delta_encoder::health_report_delta_encoder(size_t max_deltas)
+  : _next_revision(random_generators::get_int<int64_t>(
+      0, std::numeric_limits<int64_t>::max() / 2))
+  , _max_deltas(max_deltas) {}
+
+get_node_health_reply health_report_delta_encoder::encode(
+  node_health_report report, std::optional<int64_t> acked_revision) {
+    const auto revision = _next_revision++;
+    const bool send_full = !_revision.has_value()
+                           || acked_revision != _revision
+                           || _deltas_since_full >= _max_deltas;
+    _revision = revision;
+
+    if (send_full) {
+        update_last_sent(report);
+        _deltas_since_full = 0;
+        return get_node_health_reply{
+          .report = std::move(report),
+          .report_revision = revision,
+        };
+    }
+
+    decltype(_last_sent) next;
+    next.reserve(report.topics.size());
+    chunked_vector<topic_status> changed;
+    for (auto& t : report.topics) {
+        auto& next_partitions = next[t.tp_ns];
+        next_partitions.reserve(t.partitions.size());
+        auto prev_it = _last_sent.find(t.tp_ns);
+
+        partition_statuses_t changed_partitions;
+        for (auto& p : t.partitions) {
+            bool is_changed = true;
+            if (prev_it != _last_sent.end()) {
+                auto prev_p = prev_it->second.find(p.id);
+                is_changed = prev_p == prev_it->second.end()
+                             || prev_p->second != p;
+            }
+            if (is_changed) {
+                changed_partitions.push_back(p);
+            }
+            next_partitions.emplace(p.id, p);
+        }
+        if (!changed_partitions.empty()) {
+            changed.emplace_back(t.tp_ns, std::move(changed_partitions));
+        }
+    }
+
+    std::vector<model::ntp> removed;
+    for (const auto& [tp_ns, partitions] : _last_sent) {
+        auto next_it = next.find(tp_ns);
+        for (const auto& [id, _] : partitions) {
+            if (next_it == next.end() || !next_it->second.contains(id)) {
+                removed.emplace_back(tp_ns.ns, tp_ns.tp, id);
+            }
+        }
+    }
+
+    _last_sent = std::move(next);
+    ++_deltas_since_full;
+    report.topics = std::move(changed);
+    return get_node_health_reply{
+      .report = std::move(report),
+      .report_revision = revision,
+      .is_delta = true,
+      .removed_partitions = std::move(removed),
+    };
+}
+
+void health_report_delta_encoder::update_last_sent(
+  const node_health_report& report) {
+    _last_sent.clear();
+    _last_sent.reserve(report.topics.size());
+    for (const auto& t : report.topics) {
+        auto& partitions = _last_sent[t.tp_ns];
+        partitions.reserve(t.partitions.size());
+        for (const auto& p : t.partitions) {
+            partitions.emplace(p.id, p);
+        }
+    }
+}
+
+void apply_health_report_delta(
+  node_health_report& base,
+  node_health_report delta,
+  const std::vector<model::ntp>& removed) {
+    absl::node_hash_map<model::topic_namespace, size_t> topic_index;
+    topic_index.reserve(base.topics.size());
+    for (size_t i = 0; i < base.topics.size(); ++i) {
+        topic_index.emplace(base.topics[i].tp_ns, i);
+    }
+
+    absl::flat_hash_map<size_t, absl::flat_hash_set<model::partition_id>>
+      removed_by_topic;
+    for (const auto& ntp : removed) {
+        auto it = topic_index.find(
+          model::topic_namespace(ntp.ns, ntp.tp.topic));
+        if (it != topic_index.end()) {
+            removed_by_topic[it->second].insert(ntp.tp.partition);
+        }
+    }
+    for (const auto& [idx, ids] : removed_by_topic) {
+        auto& partitions = base.topics[idx].partitions;
+        partition_statuses_t kept;
+        for (auto& p : partitions) {
+            if (!ids.contains(p.id)) {
+                kept.push_back(std::move(p));
+            }
+        }
+        partitions = std::move(kept);
+    }
+
+    for (auto& t : delta.topics) {
+        auto it = topic_index.find(t.tp_ns);
+        if (it == topic_index.end()) {
+            topic_index.emplace(t.tp_ns, base.topics.size());
+            base.topics.push_back(std::move(t));
+            continue;
+        }
+        auto& partitions = base.topics[it->second].partitions;
+        absl::flat_hash_map<model::partition_id, size_t> partition_index;
+        partition_index.reserve(partitions.size());
+        for (size_t i = 0; i < partitions.size(); ++i) {
+            partition_index.emplace(partitions[i].id, i);
+        }
+        for (auto& p : t.partitions) {
+            if (auto p_it = partition_index.find(p.id);
+                p_it != partition_index.end()) {
+                partitions[p_it->second] = std::move(p);
+            } else {
+                partitions.push_back(std::move(p));
+            }
+        }
+    }
+
+    if (!removed_by_topic.empty()) {
+        chunked_vector<topic_status> topics;
+        for (auto& t : base.topics) {
+            if (!t.partitions.empty()) {
+                topics.push_back(std::move(t));
+            }
+        }
+        base.topics = std::move(topics);
+    }
+
+    base.id = delta.id;
+    base.local_state = std::move(delta.local_state);
+    base.include_drain_status = delta.include_drain_status;
+    base.drain_status = std::move(delta.drain_status);
+}
+
+} // namespace cluster
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "cluster/health_monitor_types.h"
+#include "model/fundamental.h"
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/container/node_hash_map.h>
+
+#include <optional>
+#include <vector>
+
+namespace cluster {
+
+/**
+ * Encodes the health reports that a node sends to the controller leader as
+ * deltas of the last report that the leader acknowledged.
+ *
+ * The encoder keeps the partition statuses of the last report it sent. When
+ * the requester acks the revision of that report the next reply only carries
+ * the partitions whose status changed and the partitions that were removed
+ * from the node. Every `max_deltas` replies, or whenever the acked revision
+ * doesn't match (lost reply, new controller leader, restart of this node),
+ * a full report is sent so that the requester resyncs.
+ *
+ * Each revision is sent to one requester only, so a matching ack proves that
+ * the requester holds the same baseline as the encoder.
+ */
+class health_report_delta_encoder {
+public:
+    static constexpr size_t default_max_deltas = 10;
+
+    explicit health_report_delta_encoder(
+      size_t max_deltas = default_max_deltas);
+
+    get_node_health_reply
+    encode(node_health_report report, std::optional<int64_t> acked_revision);
+
+private:
+    using partitions_t
+      = absl::flat_hash_map<model::partition_id, partition_status>;
+
+    void update_last_sent(const node_health_report&);
+
+    absl::node_hash_map<model::topic_namespace, partitions_t> _last_sent;
+    // revision of _last_sent, if any report was sent
+    std::optional<int64_t> _revision;
+    int64_t _next_revision;
+    size_t _deltas_since_full{0};
+    size_t _max_deltas;
+};
+
+/**
+ * Applies the partition statuses of a delta report and the removed
+ * partitions of its reply onto the previous report of the node. Everything
+ * but the topics is taken from the delta.
+ */
+void apply_health_report_delta(
+  node_health_report& base,
+  node_health_report delta,
+  const std::vector<model::ntp>& removed);
+
+} // namespace cluster
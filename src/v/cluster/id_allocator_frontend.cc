@@ -25,6 +25,7 @@
 #include "model/namespace.h"
 #include "model/record_batch_reader.h"
 #include "rpc/connection_cache.h"
+#include "ssx/future-util.h"
 #include "vformat.h"
 
 #include <seastar/core/coroutine.hh>
@@ -137,8 +138,9 @@ reset_id_handler::process(ss::shard_id shard, reset_id_allocator_request req) {
 ss::future<allocate_id_reply>
 allocate_id_handler::process(ss::shard_id shard, allocate_id_request req) {
     auto timeout = req.timeout;
+    auto count = req.count;
     return _partition_manager.invoke_on(
-      shard, _ssg, [timeout](cluster::partition_manager& mgr) mutable {
+      shard, _ssg, [timeout, count](cluster::partition_manager& mgr) mutable {
           auto partition = mgr.get(model::id_allocator_ntp);
           if (!partition) {
               vlog(
@@ -157,8 +159,8 @@ allocate_id_handler::process(ss::shard_id shard, allocate_id_request req) {
               return ss::make_ready_future<allocate_id_reply>(
                 allocate_id_reply{0, errc::topic_not_exists});
           }
-          return stm->allocate_id(timeout).then(
-            [](id_allocator_stm::stm_allocation_result r) {
+          return stm->allocate_ids(count, timeout)
+            .then([](id_allocator_stm::stm_allocation_result r) {
                 if (r.raft_status != raft::errc::success) {
                     vlog(
                       clusterlog.warn,
@@ -167,7 +169,7 @@ allocate_id_handler::process(ss::shard_id shard, allocate_id_request req) {
                     return allocate_id_reply{r.id, errc::replication_error};
                 }
 
-                return allocate_id_reply{r.id, errc::success};
+                return allocate_id_reply{r.id, errc::success, r.count};
             });
       });
 }
@@ -200,15 +202,116 @@ id_allocator_frontend::id_allocator_frontend(
       metadata_cache,
       connection_cache,
       leaders,
-      node_id) {}
+      node_id)
+  , _lease_size(
+      config::shard_local_cfg().id_allocator_shard_lease_size.bind()) {}
+
+ss::future<> id_allocator_frontend::stop() {
+    co_await _gate.close();
+    co_await _allocator_router.shutdown();
+}
 
 ss::future<allocate_id_reply>
 id_allocator_frontend::allocate_id(model::timeout_clock::duration timeout) {
+    if (_lease_size() <= 0 && _leases.empty()) {
+        if (!co_await ensure_id_allocator_topic_exists()) {
+            co_return allocate_id_reply{0, errc::topic_not_exists};
+        }
+        co_return co_await _allocator_router
+          .allocate_router::process_or_dispatch(
+            allocate_id_request{timeout}, model::id_allocator_ntp, timeout);
+    }
+
+    auto id = take_leased_id();
+    while (!id) {
+        // concurrent callers may drain the refilled lease, retry until an id
+        // is left for this one
+        auto ec = co_await refill_lease(timeout);
+        if (ec != errc::success) {
+            co_return allocate_id_reply{0, ec};
+        }
+        id = take_leased_id();
+    }
+    maybe_refill_lease(timeout);
+    co_return allocate_id_reply{*id, errc::success};
+}
+
+int64_t id_allocator_frontend::leased_ids() const {
+    int64_t ret = 0;
+    for (const auto& range : _leases) {
+        ret += range.end - range.next;
+    }
+    return ret;
+}
+
+std::optional<int64_t> id_allocator_frontend::take_leased_id() {
+    while (!_leases.empty() && _leases.front().next >= _leases.front().end) {
+        _leases.pop_front();
+    }
+    if (_leases.empty()) {
+        return std::nullopt;
+    }
+    return _leases.front().next++;
+}
+
+void id_allocator_frontend::add_lease(id_range range) {
+    range.next = std::max(range.next, _min_id);
+    if (range.next < range.end) {
+        _leases.push_back(range);
+    }
+}
+
+void id_allocator_frontend::advance_leases(int64_t next_id) {
+    _min_id = std::max(_min_id, next_id);
+    for (auto& range : _leases) {
+        range.next = std::clamp(_min_id, range.next, range.end);
+    }
+}
+
+void id_allocator_frontend::maybe_refill_lease(
+  model::timeout_clock::duration timeout) {
+    if (
+      _lease_size() <= 0 || _refill_pending
+      || leased_ids() > _lease_size() / 4) {
+        return;
+    }
+    _refill_pending = true;
+    ssx::spawn_with_gate(_gate, [this, timeout] {
+        return refill_lease(timeout)
+          .then([](errc ec) {
+              if (ec != errc::success) {
+                  vlog(
+                    clusterlog.debug,
+                    "unable to refill the producer id lease: {}",
+                    ec);
+              }
+          })
+          .finally([this] { _refill_pending = false; });
+    });
+}
+
+ss::future<errc>
+id_allocator_frontend::refill_lease(model::timeout_clock::duration timeout) {
+    auto units = co_await _refill_lock.get_units();
+    // someone else has refilled the lease while we were waiting
+    if (leased_ids() > _lease_size() / 4) {
+        co_return errc::success;
+    }
     if (!co_await ensure_id_allocator_topic_exists()) {
-        co_return allocate_id_reply{0, errc::topic_not_exists};
+        co_return errc::topic_not_exists;
+    }
+    // older versions of the leader reply with a single id
+    auto reply = co_await _allocator_router
+                   .allocate_router::process_or_dispatch(
+                     allocate_id_request{
+                       timeout, std::max<int64_t>(_lease_size(), 1)},
+                     model::id_allocator_ntp,
+                     timeout);
+    if (reply.ec != errc::success) {
+        co_return reply.ec;
     }
-    co_return co_await _allocator_router.allocate_router::process_or_dispatch(
-      allocate_id_request{timeout}, model::id_allocator_ntp, timeout);
+    add_lease({.next = reply.id, .end = reply.id + reply.count});
+    co_return errc::success;
 }
 
 ss::future<reset_id_allocator_reply> id_allocator_frontend::reset_next_id(
@@ -216,10 +319,17 @@ ss::future<reset_id_allocator_reply> id_allocator_frontend::reset_next_id(
     if (!co_await ensure_id_allocator_topic_exists()) {
         co_return reset_id_allocator_reply{errc::topic_not_exists};
     }
-    co_return co_await _id_reset_router.reset_id_router::process_or_dispatch(
-      reset_id_allocator_request{timeout, pid},
-      model::id_allocator_ntp,
-      timeout);
+    auto reply = co_await _id_reset_router
+                   .reset_id_router::process_or_dispatch(
+                     reset_id_allocator_request{timeout, pid},
+                     model::id_allocator_ntp,
+                     timeout);
+    if (reply.ec == errc::success) {
+        // ids leased on this node before the reset may be lower than pid
+        co_await container().invoke_on_all(
+          [pid](id_allocator_frontend& f) { f.advance_leases(pid()); });
+    }
+    co_return reply;
 }
 
 ss::future<bool> id_allocator_frontend::try_create_id_allocator_topic() {
@@ -13,12 +13,16 @@
 #include "cluster/id_allocator_service.h"
 #include "cluster/leader_router.h"
 #include "cluster/types.h"
+#include "config/property.h"
 #include "rpc/fwd.h"
+#include "utils/mutex.h"
 
 #include <seastar/core/abort_source.hh>
+#include <seastar/core/gate.hh>
 #include <seastar/core/sharded.hh>
 #include <seastar/core/smp.hh>
 
+#include <deque>
 #include <vector>
 
 namespace cluster {
@@ -133,7 +137,13 @@ private:
 //
 // when the service recieves a call it triggers id_allocator_frontend
 // which in its own turn pass the request to the id_allocator_stm
-class id_allocator_frontend {
+//
+// to keep the id_allocator partition off the hot path each shard leases
+// a range of `id_allocator_shard_lease_size` ids in advance and serves
+// allocate_id from it, the lease is refilled in the background when it
+// runs low
+class id_allocator_frontend
+  : public ss::peering_sharded_service<id_allocator_frontend> {
 public:
     id_allocator_frontend(
       ss::smp_service_group,
@@ -151,7 +161,7 @@ public:
     ss::future<reset_id_allocator_reply>
     reset_next_id(model::producer_id, model::timeout_clock::duration timeout);
 
-    ss::future<> stop() { return _allocator_router.shutdown(); }
+    ss::future<> stop();
 
     allocate_id_router& allocator_router() { return _allocator_router; }
     reset_id_router& id_reset_router() { return _id_reset_router; }
@@ -173,6 +183,27 @@ private:
     ss::future<bool> try_create_id_allocator_topic();
     ss::future<bool> ensure_id_allocator_topic_exists();
 
+    struct id_range {
+        int64_t next;
+        int64_t end;
+    };
+
+    int64_t leased_ids() const;
+    std::optional<int64_t> take_leased_id();
+    void add_lease(id_range);
+    // drops the leased ids lower than the next id set by reset_next_id
+    void advance_leases(int64_t next_id);
+    void maybe_refill_lease(model::timeout_clock::duration);
+    ss::future<errc> refill_lease(model::timeout_clock::duration);
+
+    config::binding<int16_t> _lease_size;
+    std::deque<id_range> _leases;
+    // ids lower than this one were reset and must not be served
+    int64_t _min_id{0};
+    bool _refill_pending{false};
+    mutex _refill_lock{"id_allocator_frontend::refill"};
+    ss::gate _gate;
+
     friend id_allocator;
 };
 } // namespace cluster
@@ -40,6 +40,8 @@ public:
     struct stm_allocation_result {
         int64_t id;
         raft::errc raft_status{raft::errc::success};
+        // number of consecutive ids allocated starting from id
+        int64_t count{1};
     };
 
     explicit id_allocator_stm(ss::logger&, raft::consensus*);
@@ -50,6 +52,11 @@ public:
     ss::future<stm_allocation_result>
     allocate_id(model::timeout_clock::duration timeout);
 
+    // Allocates up to count consecutive ids, never more than what is left in
+    // the current batch so that the state isn't replicated more than once.
+    ss::future<stm_allocation_result>
+    allocate_ids(int64_t count, model::timeout_clock::duration timeout);
+
     ss::future<iobuf> take_snapshot(model::offset) final { co_return iobuf{}; }
 
     ss::future<stm_allocation_result>
@@ -101,7 +108,7 @@ private:
     };
 
     ss::future<stm_allocation_result>
-      do_allocate_id(model::timeout_clock::duration);
+      do_allocate_id(int64_t, model::timeout_clock::duration);
     ss::future<bool> set_state(int64_t, model::timeout_clock::duration);
 
     ss::future<> apply(const model::record_batch&) final;
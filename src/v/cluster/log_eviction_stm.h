@@ -125,6 +125,9 @@ private:
     ss::future<> do_write_raft_snapshot(model::offset);
     ss::future<> handle_log_eviction_events();
     ss::future<> apply(const model::record_batch&) final;
+    bool consumes(model::record_batch_type type) const final {
+        return type == model::record_batch_type::prefix_truncate;
+    }
     ss::future<> apply_raft_snapshot(const iobuf&) final;
 
     ss::future<offset_result> replicate_command(
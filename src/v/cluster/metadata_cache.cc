@@ -120,7 +120,12 @@ size_t metadata_cache::node_count() const {
 }
 
 ss::future<std::vector<node_metadata>> metadata_cache::alive_nodes() const {
-    std::vector<node_metadata> brokers;
+    // node status is cached on every shard, only wait for the backend shard
+    // if the cache is not available yet
+    if (auto cached = _health_monitor.local().get_cached_nodes_status()) {
+        co_return alive_nodes(*cached);
+    }
+
     auto res = co_await _health_monitor.local().get_nodes_status(
       config::shard_local_cfg().metadata_status_wait_timeout_ms()
       + model::timeout_clock::now());
@@ -129,9 +134,14 @@ ss::future<std::vector<node_metadata>> metadata_cache::alive_nodes() const {
         // (controller may be unreachable)
         co_return _members_table.local().node_list();
     }
+    co_return alive_nodes(res.value());
+}
 
+std::vector<node_metadata>
+metadata_cache::alive_nodes(const std::vector<node_state>& states) const {
+    std::vector<node_metadata> brokers;
     std::set<model::node_id> brokers_with_health;
-    for (auto& st : res.value()) {
+    for (const auto& st : states) {
         brokers_with_health.insert(st.id);
         if (st.is_alive) {
             auto broker = _members_table.local().get_node_metadata(st.id);
@@ -152,7 +162,7 @@ ss::future<std::vector<node_metadata>> metadata_cache::alive_nodes() const {
         }
     }
 
-    co_return !brokers.empty() ? brokers : _members_table.local().node_list();
+    return !brokers.empty() ? brokers : _members_table.local().node_list();
 }
 
 std::vector<node_metadata> metadata_cache::all_nodes() const {
@@ -224,6 +234,18 @@ metadata_cache::get_leaders() const {
     return _leaders.local().get_leaders();
 }
 
+uint64_t metadata_cache::topics_version() const {
+    return _topics_state.local().version();
+}
+
+uint64_t metadata_cache::leaders_version() const {
+    return _leaders.local().leadership_version();
+}
+
+uint64_t metadata_cache::leaderless_partition_count() const {
+    return _leaders.local().leaderless_partition_count();
+}
+
 void metadata_cache::set_is_node_isolated_status(bool is_node_isolated) {
     _is_node_isolated = is_node_isolated;
 }
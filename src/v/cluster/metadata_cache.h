@@ -13,6 +13,7 @@
 
 #include "base/seastarx.h"
 #include "cluster/fwd.h"
+#include "cluster/health_monitor_types.h"
 #include "cluster/members_table.h"
 #include "cluster/partition_leaders_table.h"
 #include "cluster/topic_table.h"
@@ -164,6 +165,12 @@ public:
     ss::future<> refresh_health_monitor();
     cluster::partition_leaders_table::leaders_info_t get_leaders() const;
 
+    /// Versions of the topic and partition leadership state, changed by every
+    /// update of the metadata of a topic or of the leader of a partition.
+    uint64_t topics_version() const;
+    uint64_t leaders_version() const;
+    uint64_t leaderless_partition_count() const;
+
     void set_is_node_isolated_status(bool is_node_isolated);
     bool is_node_isolated();
 
@@ -208,6 +215,9 @@ public:
       get_topic_write_caching_mode(model::topic_namespace_view) const;
 
 private:
+    std::vector<node_metadata>
+    alive_nodes(const std::vector<node_state>&) const;
+
     ss::sharded<topic_table>& _topics_state;
     ss::sharded<members_table>& _members_table;
     ss::sharded<partition_leaders_table>& _leaders;
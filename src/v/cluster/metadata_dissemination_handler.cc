@@ -23,6 +23,7 @@
 #include <seastar/core/chunked_fifo.hh>
 #include <seastar/core/loop.hh>
 #include <seastar/core/smp.hh>
+#include <seastar/coroutine/maybe_yield.hh>
 
 #include <boost/range/irange.hpp>
 
@@ -38,37 +39,42 @@ metadata_dissemination_handler::metadata_dissemination_handler(
   : metadata_dissemination_rpc_service(sg, ssg)
   , _leaders(leaders) {}
 
+namespace {
+ss::future<> apply_leadership_updates(
+  partition_leaders_table& leaders, const update_leadership_request_v2& req) {
+    for (const auto& leader : req.leaders) {
+        leaders.update_partition_leader(
+          leader.ntp, leader.revision, leader.term, leader.leader_id);
+        co_await ss::coroutine::maybe_yield();
+    }
+    for (const auto& topic : req.topics) {
+        leaders.update_topic_leaders(topic);
+        co_await ss::coroutine::maybe_yield();
+    }
+}
+} // namespace
+
 ss::future<update_leadership_reply>
 metadata_dissemination_handler::update_leadership_v2(
   update_leadership_request_v2 req, rpc::streaming_context&) {
     return ss::with_scheduling_group(
       get_scheduling_group(), [this, req = std::move(req)]() mutable {
-          return do_update_leadership(std::move(req.leaders));
+          return do_update_leadership(std::move(req));
       });
 }
 
 ss::future<update_leadership_reply>
 metadata_dissemination_handler::do_update_leadership(
-  fragmented_vector<ntp_leader_revision> leaders) {
+  update_leadership_request_v2 req) {
     vlog(clusterlog.trace, "Received a metadata update");
+    // the request is kept alive by this frame and only read on the other
+    // shards, so that its updates are not copied for every shard
     co_await ss::parallel_for_each(
       boost::irange<ss::shard_id>(0, ss::smp::count),
-      [this, leaders = std::move(leaders)](ss::shard_id shard) {
-          fragmented_vector<ntp_leader_revision> local_leaders;
-          local_leaders.reserve(leaders.size());
-          std::copy(
-            leaders.begin(), leaders.end(), std::back_inserter(local_leaders));
-
-          return ss::smp::submit_to(
-            shard, [this, leaders = std::move(local_leaders)] {
-                for (auto& leader : leaders) {
-                    _leaders.local().update_partition_leader(
-                      leader.ntp,
-                      leader.revision,
-                      leader.term,
-                      leader.leader_id);
-                }
-            });
+      [this, &req](ss::shard_id shard) {
+          return ss::smp::submit_to(shard, [this, &req] {
+              return apply_leadership_updates(_leaders.local(), req);
+          });
       });
 
     co_return update_leadership_reply{};
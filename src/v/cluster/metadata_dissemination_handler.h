@@ -48,7 +48,7 @@ public:
 
 private:
     ss::future<update_leadership_reply>
-      do_update_leadership(fragmented_vector<ntp_leader_revision>);
+      do_update_leadership(update_leadership_request_v2);
 
     ss::sharded<partition_leaders_table>& _leaders;
 }; // namespace cluster
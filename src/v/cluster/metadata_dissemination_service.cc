@@ -24,6 +24,7 @@
 #include "cluster/partition_manager.h"
 #include "cluster/topic_table.h"
 #include "config/configuration.h"
+#include "features/feature_table.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
 #include "model/namespace.h"
@@ -292,6 +293,34 @@ metadata_dissemination_service::dispatch_get_metadata_update(
       });
 }
 
+void metadata_dissemination_service::update_retry_meta::add(
+  const ntp_leader_revision& update) {
+    auto& partitions
+      = updates[model::topic_namespace(update.ntp.ns, update.ntp.tp.topic)];
+    partition_leader_revision p_update{
+      .id = update.ntp.tp.partition,
+      .term = update.term,
+      .leader_id = update.leader_id,
+      .revision = update.revision,
+    };
+    auto [it, inserted] = partitions.try_emplace(p_update.id, p_update);
+    // keep the update of the latest partition instance and term
+    if (
+      !inserted
+      && std::tie(p_update.revision, p_update.term)
+           >= std::tie(it->second.revision, it->second.term)) {
+        it->second = p_update;
+    }
+}
+
+size_t metadata_dissemination_service::update_retry_meta::size() const {
+    size_t ret = 0;
+    for (const auto& [_, partitions] : updates) {
+        ret += partitions.size();
+    }
+    return ret;
+}
+
 void metadata_dissemination_service::collect_pending_updates() {
     auto brokers = _members_table.local().node_ids();
     for (auto& ntp_leader : _requests) {
@@ -307,17 +336,12 @@ void metadata_dissemination_service::collect_pending_updates() {
             if (id == _self.id()) {
                 continue;
             }
-            if (!_pending_updates.contains(id)) {
-                _pending_updates.emplace(
-                  id,
-                  update_retry_meta{ss::chunked_fifo<ntp_leader_revision>{}});
-            }
             vlog(
               clusterlog.trace,
               "new metadata update {} for {}",
               ntp_leader,
               id);
-            _pending_updates[id].updates.push_back(ntp_leader);
+            _pending_updates[id].add(ntp_leader);
         }
     }
     _requests.clear();
@@ -395,10 +419,7 @@ ss::future<> metadata_dissemination_service::update_leaders_with_health_report(
 ss::future<> metadata_dissemination_service::dispatch_one_update(
   model::node_id target_id, update_retry_meta& meta) {
     // copy updates to make retries possible
-    fragmented_vector<ntp_leader_revision> updates;
-    updates.reserve(meta.updates.size());
-    std::copy(
-      meta.updates.begin(), meta.updates.end(), std::back_inserter(updates));
+    auto request = make_update_request(meta);
 
     return _clients.local()
       .with_node_client<metadata_dissemination_rpc_client_protocol>(
@@ -406,16 +427,16 @@ ss::future<> metadata_dissemination_service::dispatch_one_update(
         ss::this_shard_id(),
         target_id,
         _dissemination_interval,
-        [this, updates = std::move(updates), target_id](
+        [this, request = std::move(request), target_id](
           metadata_dissemination_rpc_client_protocol proto) mutable {
             vlog(
               clusterlog.trace,
               "Sending {} metadata updates to {}",
-              updates,
+              request,
               target_id);
             return proto
               .update_leadership_v2(
-                update_leadership_request_v2(std::move(updates)),
+                std::move(request),
                 rpc::client_opts(
                   _dissemination_interval + rpc::clock_type::now()))
               .then(&rpc::get_ctx_data<update_leadership_reply>);
@@ -444,6 +465,39 @@ ss::future<> metadata_dissemination_service::dispatch_one_update(
       });
 }
 
+update_leadership_request_v2
+metadata_dissemination_service::make_update_request(
+  const update_retry_meta& meta) const {
+    if (!_feature_table.local().is_active(
+          features::feature::compact_leadership_updates)) {
+        // nodes of older versions only understand the per ntp updates
+        fragmented_vector<ntp_leader_revision> leaders;
+        leaders.reserve(meta.size());
+        for (const auto& [tp_ns, partitions] : meta.updates) {
+            for (const auto& [id, p] : partitions) {
+                leaders.emplace_back(
+                  model::ntp(tp_ns.ns, tp_ns.tp, id),
+                  p.term,
+                  p.leader_id,
+                  p.revision);
+            }
+        }
+        return update_leadership_request_v2(std::move(leaders));
+    }
+
+    fragmented_vector<topic_leaders> topics;
+    topics.reserve(meta.updates.size());
+    for (const auto& [tp_ns, partitions] : meta.updates) {
+        auto& topic = topics.emplace_back();
+        topic.tp_ns = tp_ns;
+        topic.partitions.reserve(partitions.size());
+        for (const auto& [_, p] : partitions) {
+            topic.partitions.push_back(p);
+        }
+    }
+    return update_leadership_request_v2(std::move(topics));
+}
+
 ss::future<> metadata_dissemination_service::stop() {
     _raft_manager.local().unregister_leadership_notification(
       _notification_handle);
@@ -29,6 +29,7 @@
 #include <seastar/core/sharded.hh>
 
 #include <absl/container/flat_hash_map.h>
+#include <absl/container/node_hash_map.h>
 
 namespace cluster {
 
@@ -97,10 +98,18 @@ public:
 private:
     // Used to store pending updates
     // When update was delivered successfully the finished flag is set to true
-    // and object is removed from pending updates map
+    // and object is removed from pending updates map. Only the latest update
+    // of each partition is kept, so that updates superseded while waiting for
+    // the next dispatch or retry are never sent.
     struct update_retry_meta {
-        ss::chunked_fifo<ntp_leader_revision> updates;
+        using partition_updates_t = absl::
+          flat_hash_map<model::partition_id, partition_leader_revision>;
+        absl::node_hash_map<model::topic_namespace, partition_updates_t>
+          updates;
         bool finished = false;
+
+        void add(const ntp_leader_revision&);
+        size_t size() const;
     };
     // Used to track the process of requesting update when redpanda starts
     // when update using a node from ids will fail we will try the next one
@@ -131,6 +140,8 @@ private:
     void cleanup_finished_updates();
     ss::future<> dispatch_disseminate_leadership();
     ss::future<> dispatch_one_update(model::node_id, update_retry_meta&);
+    update_leadership_request_v2
+    make_update_request(const update_retry_meta&) const;
     ss::future<result<get_leadership_reply>>
       dispatch_get_metadata_update(net::unresolved_address);
     ss::future<> do_request_metadata_update(request_retry_meta&);
@@ -100,14 +100,71 @@ struct ntp_leader_revision
     auto serde_fields() { return std::tie(ntp, term, leader_id, revision); }
 };
 
+/// Leadership of a partition of the topic of the enclosing topic_leaders
+struct partition_leader_revision
+  : serde::envelope<
+      partition_leader_revision,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    model::partition_id id;
+    model::term_id term;
+    std::optional<model::node_id> leader_id;
+    model::revision_id revision;
+
+    friend bool operator==(
+      const partition_leader_revision&, const partition_leader_revision&)
+      = default;
+
+    friend std::ostream&
+    operator<<(std::ostream& o, const partition_leader_revision& r) {
+        fmt::print(
+          o,
+          "{{id: {}, term: {}, leader: {}, revision: {}}}",
+          r.id,
+          r.term,
+          r.leader_id,
+          r.revision);
+        return o;
+    }
+
+    auto serde_fields() { return std::tie(id, term, leader_id, revision); }
+};
+
+/// Leadership updates of partitions of a single topic, the topic name is
+/// encoded once for all of them
+struct topic_leaders
+  : serde::
+      envelope<topic_leaders, serde::version<0>, serde::compat_version<0>> {
+    model::topic_namespace tp_ns;
+    fragmented_vector<partition_leader_revision> partitions;
+
+    friend bool operator==(const topic_leaders&, const topic_leaders&)
+      = default;
+
+    friend std::ostream& operator<<(std::ostream& o, const topic_leaders& t) {
+        fmt::print(o, "{{tp_ns: {}, partitions: {}}}", t.tp_ns, t.partitions);
+        return o;
+    }
+
+    topic_leaders copy() const {
+        return topic_leaders{.tp_ns = tp_ns, .partitions = partitions.copy()};
+    }
+
+    auto serde_fields() { return std::tie(tp_ns, partitions); }
+};
+
 struct update_leadership_request_v2
   : serde::envelope<
       update_leadership_request_v2,
-      serde::version<0>,
+      serde::version<1>,
       serde::compat_version<0>> {
     using rpc_adl_exempt = std::true_type;
     static constexpr int8_t version = 0;
     fragmented_vector<ntp_leader_revision> leaders;
+    // Compact form of the updates grouped by topic, sent instead of leaders
+    // once the compact_leadership_updates feature is active. Receivers apply
+    // both.
+    fragmented_vector<topic_leaders> topics;
 
     update_leadership_request_v2() noexcept = default;
 
@@ -115,10 +172,15 @@ struct update_leadership_request_v2
       const update_leadership_request_v2& lhs,
       const update_leadership_request_v2& rhs) {
         return std::equal(
-          lhs.leaders.begin(),
-          lhs.leaders.end(),
-          rhs.leaders.begin(),
-          rhs.leaders.end());
+                 lhs.leaders.begin(),
+                 lhs.leaders.end(),
+                 rhs.leaders.begin(),
+                 rhs.leaders.end())
+               && std::equal(
+                 lhs.topics.begin(),
+                 lhs.topics.end(),
+                 rhs.topics.begin(),
+                 rhs.topics.end());
     };
 
     update_leadership_request_v2 copy() const {
@@ -127,12 +189,19 @@ struct update_leadership_request_v2
         std::copy(
           leaders.begin(), leaders.end(), std::back_inserter(leaders_cp));
 
-        return update_leadership_request_v2(std::move(leaders_cp));
+        fragmented_vector<topic_leaders> topics_cp;
+        topics_cp.reserve(topics.size());
+        for (const auto& t : topics) {
+            topics_cp.push_back(t.copy());
+        }
+
+        return update_leadership_request_v2(
+          std::move(leaders_cp), std::move(topics_cp));
     }
 
     friend std::ostream&
     operator<<(std::ostream& o, const update_leadership_request_v2& r) {
-        fmt::print(o, "leaders {}", r.leaders);
+        fmt::print(o, "leaders {}, topics: {}", r.leaders, r.topics);
         return o;
     }
 
@@ -140,7 +209,17 @@ struct update_leadership_request_v2
       fragmented_vector<ntp_leader_revision> leaders)
       : leaders(std::move(leaders)) {}
 
-    auto serde_fields() { return std::tie(leaders); }
+    explicit update_leadership_request_v2(
+      fragmented_vector<topic_leaders> topics)
+      : topics(std::move(topics)) {}
+
+    update_leadership_request_v2(
+      fragmented_vector<ntp_leader_revision> leaders,
+      fragmented_vector<topic_leaders> topics)
+      : leaders(std::move(leaders))
+      , topics(std::move(topics)) {}
+
+    auto serde_fields() { return std::tie(leaders, topics); }
 };
 
 struct update_leadership_reply
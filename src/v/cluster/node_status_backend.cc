@@ -16,6 +16,7 @@
 #include "cluster/logger.h"
 #include "cluster/node_status_table.h"
 #include "config/node_config.h"
+#include "raft/group_manager.h"
 #include "rpc/types.h"
 #include "ssx/future-util.h"
 
@@ -25,6 +26,7 @@
 #include <bits/types/clock_t.h>
 
 #include <exception>
+#include <iterator>
 
 namespace cluster {
 
@@ -33,6 +35,7 @@ node_status_backend::node_status_backend(
   ss::sharded<members_table>& members_table,
   ss::sharded<features::feature_table>& feature_table,
   ss::sharded<node_status_table>& node_status_table,
+  ss::sharded<raft::group_manager>& raft_manager,
   config::binding<std::chrono::milliseconds> period,
   config::binding<std::chrono::milliseconds> max_reconnect_backoff,
   ss::sharded<ss::abort_source>& as)
@@ -40,6 +43,7 @@ node_status_backend::node_status_backend(
   , _members_table(members_table)
   , _feature_table(feature_table)
   , _node_status_table(node_status_table)
+  , _raft_manager(raft_manager)
   , _period(std::move(period))
   , _max_reconnect_backoff(std::move(max_reconnect_backoff))
   , _rpc_tls_config(config::node().rpc_server_tls())
@@ -105,7 +109,8 @@ ss::future<> node_status_backend::handle_members_updated_notification(
               clusterlog.info,
               "Node {} has been discovered via members table",
               node_id);
-            _discovered_peers.insert(node_id);
+            _discovered_peers.emplace(
+              node_id, phi_accrual_failure_detector(_period()));
             // update node status table with initial state
             co_await _node_status_table.invoke_on_all(
               [node_id](node_status_table& table) {
@@ -158,7 +163,8 @@ void node_status_backend::tick() {
                           return collect_and_store_updates().finally([this] {
                               if (!_gate.is_closed()) {
                                   _timer.rearm(
-                                    ss::lowres_clock::now() + _period());
+                                    ss::lowres_clock::now()
+                                    + next_tick_delay());
                               }
                           });
                       }).handle_exception([](const std::exception_ptr& e) {
@@ -175,20 +181,114 @@ ss::future<> node_status_backend::collect_and_store_updates() {
         co_return;
     }
 
-    auto updates = co_await collect_updates_from_peers();
+    auto updates = co_await collect_updates_from_raft();
+    record_liveness(updates);
+
+    auto probed = co_await collect_updates_from_peers();
+    record_liveness(probed);
+    std::move(probed.begin(), probed.end(), std::back_inserter(updates));
+
+    if (updates.empty()) {
+        co_return;
+    }
     co_return co_await _node_status_table.invoke_on_all(
       [updates = std::move(updates)](auto& table) {
           table.update_peers(updates);
       });
 }
 
+ss::future<std::vector<node_status>>
+node_status_backend::collect_updates_from_raft() {
+    using reply_times_t = raft::heartbeat_manager::reply_times_t;
+    if (_discovered_peers.empty()) {
+        co_return std::vector<node_status>{};
+    }
+
+    // every shard sends heartbeats of its own raft groups, the most recent
+    // reply from any of them wins
+    auto reply_times = co_await _raft_manager.map_reduce0(
+      [](const raft::group_manager& gm) {
+          return gm.last_heartbeat_reply_times();
+      },
+      reply_times_t{},
+      [](reply_times_t acc, const reply_times_t& shard_times) {
+          for (const auto& [id, at] : shard_times) {
+              auto [it, inserted] = acc.try_emplace(id, at);
+              if (!inserted) {
+                  it->second = std::max(it->second, at);
+              }
+          }
+          return acc;
+      });
+
+    std::vector<node_status> updates;
+    for (const auto& [id, detector] : _discovered_peers) {
+        auto it = reply_times.find(id);
+        if (it == reply_times.end()) {
+            continue;
+        }
+        auto last = detector.last_heartbeat();
+        if (!last || it->second > *last) {
+            updates.push_back(
+              node_status{.node_id = id, .last_seen = it->second});
+        }
+    }
+    co_return updates;
+}
+
+void node_status_backend::record_liveness(
+  const std::vector<node_status>& updates) {
+    for (const auto& update : updates) {
+        if (auto it = _discovered_peers.find(update.node_id);
+            it != _discovered_peers.end()) {
+            it->second.heartbeat(update.last_seen);
+        }
+    }
+}
+
+bool node_status_backend::is_suspicious(
+  const phi_accrual_failure_detector& detector) const {
+    return detector.phi(rpc::clock_type::now()) >= suspicion_threshold;
+}
+
+bool node_status_backend::needs_probe(
+  const phi_accrual_failure_detector& detector) const {
+    auto last = detector.last_heartbeat();
+    if (!last || is_suspicious(detector)) {
+        return true;
+    }
+    // a peer that recently replied to raft heartbeats is known to be alive,
+    // probing it would only add background RPCs
+    return rpc::clock_type::now() - *last >= 2 * _period();
+}
+
+std::chrono::milliseconds node_status_backend::next_tick_delay() const {
+    for (const auto& [_, detector] : _discovered_peers) {
+        if (is_suspicious(detector)) {
+            return std::max<std::chrono::milliseconds>(
+              _period() / suspicious_probe_ratio, 1ms);
+        }
+    }
+    return _period();
+}
+
 ss::future<std::vector<node_status>>
 node_status_backend::collect_updates_from_peers() {
     node_status_request request = {.sender_metadata = {.node_id = _self}};
 
+    std::vector<model::node_id> targets;
+    targets.reserve(_discovered_peers.size());
+    for (const auto& [id, detector] : _discovered_peers) {
+        if (needs_probe(detector)) {
+            targets.push_back(id);
+        } else {
+            _stats.rpcs_skipped += 1;
+        }
+    }
+
     auto results = co_await ssx::parallel_transform(
-      _discovered_peers.begin(),
-      _discovered_peers.end(),
+      targets.begin(),
+      targets.end(),
       [this, request = std::move(request)](auto peer_id) {
           return send_node_status_request(peer_id, request);
       });
@@ -308,6 +408,13 @@ void node_status_backend::setup_metrics(
           [this] { return _stats.rpcs_received; },
           sm::description("Number of node status RPCs received by this node"))
           .aggregate({sm::shard_label}),
+        sm::make_gauge(
+          "rpcs_skipped",
+          [this] { return _stats.rpcs_skipped; },
+          sm::description(
+            "Number of node status RPCs not sent because raft heartbeats "
+            "already proved the peers alive"))
+          .aggregate({sm::shard_label}),
       });
 }
 
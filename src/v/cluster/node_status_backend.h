@@ -14,10 +14,12 @@
 #include "cluster/members_table.h"
 #include "cluster/node_status_rpc_service.h"
 #include "cluster/node_status_table.h"
+#include "cluster/phi_accrual_failure_detector.h"
 #include "config/property.h"
 #include "features/feature_table.h"
 #include "metrics/metrics.h"
 #include "model/metadata.h"
+#include "raft/fwd.h"
 #include "rpc/connection_set.h"
 #include "rpc/types.h"
 
@@ -27,7 +29,7 @@
 #include <seastar/core/lowres_clock.hh>
 #include <seastar/core/timer.hh>
 
-#include <absl/container/flat_hash_set.h>
+#include <absl/container/flat_hash_map.h>
 
 namespace cluster {
 
@@ -41,19 +43,31 @@ namespace cluster {
  * follows:
  * 1. Maintain a list of peers for this node. This is currently done via a
  * callback from the members_table.
- * 2. Send a periodic node_status RPC to all known peers
- * 3. Update the shard-local node_status_table with the metadata from the
+ * 2. Gather liveness evidence from raft: a successful heartbeat reply from a
+ * peer proves it is alive just as well as a node_status reply does.
+ * 3. Send a periodic node_status RPC to the peers without recent liveness
+ * evidence. The suspicion that a peer failed is tracked with a phi accrual
+ * failure detector, suspicious peers are probed at a shorter interval so that
+ * both their failure and their recovery are noticed sooner.
+ * 4. Update the shard-local node_status_table with the metadata from the
  * responses
  */
 class node_status_backend {
 public:
     static constexpr ss::shard_id shard = 0;
 
+    /// phi above which a peer is considered suspicious, i.e. roughly a 0.1%
+    /// chance of a false suspicion
+    static constexpr double suspicion_threshold = 3.0;
+    /// suspicious peers are probed this many times more often
+    static constexpr int suspicious_probe_ratio = 4;
+
     node_status_backend(
       model::node_id,
       ss::sharded<members_table>&,
       ss::sharded<features::feature_table>&,
       ss::sharded<node_status_table>&,
+      ss::sharded<raft::group_manager>&,
       config::binding<std::chrono::milliseconds> /* period*/,
       config::binding<std::chrono::milliseconds> /* max_backoff*/,
       ss::sharded<ss::abort_source>&);
@@ -69,7 +83,13 @@ private:
     void tick();
 
     ss::future<> collect_and_store_updates();
+    ss::future<std::vector<node_status>> collect_updates_from_raft();
     ss::future<std::vector<node_status>> collect_updates_from_peers();
+    void record_liveness(const std::vector<node_status>&);
+
+    bool needs_probe(const phi_accrual_failure_detector&) const;
+    bool is_suspicious(const phi_accrual_failure_detector&) const;
+    std::chrono::milliseconds next_tick_delay() const;
 
     result<node_status> process_reply(result<node_status_reply>);
     ss::future<node_status_reply> process_request(node_status_request);
@@ -85,6 +105,7 @@ private:
         int64_t rpcs_sent;
         int64_t rpcs_timed_out;
         int64_t rpcs_received;
+        int64_t rpcs_skipped;
     };
 
 private:
@@ -102,13 +123,15 @@ private:
     ss::sharded<members_table>& _members_table;
     ss::sharded<features::feature_table>& _feature_table;
     ss::sharded<node_status_table>& _node_status_table;
+    ss::sharded<raft::group_manager>& _raft_manager;
 
     config::binding<std::chrono::milliseconds> _period;
     config::binding<std::chrono::milliseconds> _max_reconnect_backoff;
     config::tls_config _rpc_tls_config;
     rpc::connection_set _node_connection_set;
 
-    absl::flat_hash_set<model::node_id> _discovered_peers;
+    absl::flat_hash_map<model::node_id, phi_accrual_failure_detector>
+      _discovered_peers;
     ss::gate _gate;
     ss::timer<ss::lowres_clock> _timer;
     notification_id_type _members_table_notification_handle;
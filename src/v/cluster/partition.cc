@@ -278,6 +278,104 @@ bool partition::cloud_data_available() const {
            && _cloud_storage_partition->is_data_available();
 }
 
+namespace {
+/**
+ * Retrieve topic property based on the following logic
+ *
+ *
+ * +---------------------------------+---------------+----------+-------------+
+ * |Cluster(optional)\Topic(tristate)|     Empty     | Disabled |    Value    |
+ * +---------------------------------+---------------+----------+-------------+
+ * |Empty                            | OFF           | OFF      | Topic Value |
+ * |Value                            | Cluster Value | OFF      | Topic Value |
+ * +---------------------------------+---------------+----------+-------------+
+ *
+ */
+template<typename T>
+std::optional<T> get_topic_property(
+  std::optional<T> cluster_level_property, tristate<T> topic_property) {
+    // disabled
+    if (topic_property.is_disabled()) {
+        return std::nullopt;
+    }
+    // has value
+    if (topic_property.has_optional_value()) {
+        return *topic_property;
+    }
+    return cluster_level_property;
+}
+} // namespace
+
+std::optional<model::offset> partition::initial_retention_offset(
+  std::optional<size_t> default_bytes,
+  std::optional<std::chrono::milliseconds> default_ms) const {
+    /**
+     * Initial learner start offset only makes sense for partitions with cloud
+     * storage data
+     */
+    if (!cloud_data_available()) {
+        vlog(clusterlog.trace, "no cloud data available for: {}", ntp());
+        return std::nullopt;
+    }
+
+    auto log = _raft->log();
+    /**
+     * Calculate retention targets based on cluster and topic configuration
+     */
+    const auto initial_retention_bytes = get_topic_property(
+      default_bytes,
+      log->config().has_overrides()
+        ? log->config().get_overrides().initial_retention_local_target_bytes
+        : tristate<size_t>{std::nullopt});
+
+    const auto initial_retention_ms = get_topic_property(
+      default_ms,
+      log->config().has_overrides()
+        ? log->config().get_overrides().initial_retention_local_target_ms
+        : tristate<std::chrono::milliseconds>{std::nullopt});
+    /**
+     * Initial target retention disabled
+     */
+    if (
+      !initial_retention_bytes.has_value()
+      && !initial_retention_ms.has_value()) {
+        return std::nullopt;
+    }
+
+    model::timestamp retention_timestamp_threshold(0);
+    if (initial_retention_ms) {
+        retention_timestamp_threshold = model::timestamp(
+          model::timestamp::now().value() - initial_retention_ms->count());
+    }
+
+    auto retention_offset = log->retention_offset(storage::gc_config(
+      retention_timestamp_threshold, initial_retention_bytes));
+
+    if (!retention_offset) {
+        return std::nullopt;
+    }
+
+    auto const cloud_storage_safe_offset
+      = _archival_meta_stm->max_collectible_offset();
+    /**
+     * Last offset uploaded to the cloud is target learner retention upper
+     * bound. We can not start retention recover from the point which is not yet
+     * uploaded to Cloud Storage.
+     */
+    vlog(
+      clusterlog.trace,
+      "[{}] calculated retention offset: {}, last uploaded to cloud: {}, "
+      "manifest clean offset: {}, max_collectible_offset: {}",
+      ntp(),
+      *retention_offset,
+      _archival_meta_stm->manifest().get_last_offset(),
+      _archival_meta_stm->get_last_clean_at(),
+      cloud_storage_safe_offset);
+
+    return model::next_offset(
+      std::min(cloud_storage_safe_offset, *retention_offset));
+}
+
 std::optional<uint64_t> partition::cloud_log_size() const {
     if (_cloud_storage_partition == nullptr) {
         return std::nullopt;
@@ -440,6 +538,15 @@ ss::future<> partition::start(state_machine_registry& stm_registry) {
 
     if (_cloud_storage_partition) {
         co_await _cloud_storage_partition->start();
+        // followers far behind skip to the initial retention target, the
+        // same way as new replicas do
+        _raft->set_follower_catchup_offset_provider([this] {
+            return initial_retention_offset(
+              config::shard_local_cfg()
+                .initial_retention_local_target_bytes_default(),
+              config::shard_local_cfg()
+                .initial_retention_local_target_ms_default());
+        });
     }
 
     {
@@ -480,6 +587,7 @@ ss::future<> partition::stop() {
     }
 
     if (_cloud_storage_partition) {
+        _raft->set_follower_catchup_offset_provider({});
         vlog(
           clusterlog.debug,
           "Stopping cloud_storage_partition on partition: {}",
@@ -501,6 +609,33 @@ ss::future<> partition::stop() {
 
 ss::future<std::optional<storage::timequery_result>>
 partition::timequery(storage::timequery_config cfg) {
+    // compaction may remove the batch a result points to
+    if (_raft->log_config().is_compacted()) {
+        co_return co_await do_timequery(cfg);
+    }
+    const auto state = timequery_log_state();
+    if (auto cached = _timequery_cache.get(cfg, state); cached) {
+        co_return cached;
+    }
+    auto result = co_await do_timequery(cfg);
+    // a result is cached only if the log did not change during the query
+    if (result && timequery_log_state() == state) {
+        _timequery_cache.put(cfg, state, *result);
+    }
+    co_return result;
+}
+
+timequery_cache::log_state partition::timequery_log_state() const {
+    return {
+      .term = _raft->term(),
+      .local_start = _raft->start_offset(),
+      .cloud_start = cloud_data_available() ? start_cloud_offset()
+                                            : model::offset{},
+    };
+}
+
+ss::future<std::optional<storage::timequery_result>>
+partition::do_timequery(storage::timequery_config cfg) {
     // Read replicas never consider local raft data
     if (_raft->log_config().is_read_replica_mode_enabled()) {
         co_return co_await cloud_storage_timequery(cfg);
@@ -20,6 +20,7 @@
 #include "cluster/log_eviction_stm.h"
 #include "cluster/partition_probe.h"
 #include "cluster/rm_stm.h"
+#include "cluster/timequery_cache.h"
 #include "cluster/tm_stm.h"
 #include "cluster/types.h"
 #include "config/configuration.h"
@@ -356,6 +357,16 @@ public:
 
     std::optional<uint64_t> cloud_log_size() const;
 
+    /**
+     * The offset from which a new replica keeps the initial local retention
+     * target, the data before it being available in cloud storage. Empty if
+     * there is no cloud data or no initial retention target. The cluster
+     * defaults are overridden by the topic properties.
+     */
+    std::optional<model::offset> initial_retention_offset(
+      std::optional<size_t> default_bytes,
+      std::optional<std::chrono::milliseconds> default_ms) const;
+
     /// Starting offset in the object store
     model::offset start_cloud_offset() const;
 
@@ -488,6 +499,11 @@ private:
     ss::future<>
     do_unsafe_reset_remote_partition_manifest_from_cloud(bool force);
 
+    ss::future<std::optional<storage::timequery_result>>
+      do_timequery(storage::timequery_config);
+
+    timequery_cache::log_state timequery_log_state() const;
+
     ss::future<std::optional<storage::timequery_result>>
       cloud_storage_timequery(storage::timequery_config);
 
@@ -502,6 +518,7 @@ private:
     ss::shared_ptr<archival_metadata_stm> _archival_meta_stm;
     ss::abort_source _as;
     partition_probe _probe;
+    timequery_cache _timequery_cache;
     ss::sharded<features::feature_table>& _feature_table;
     ss::lw_shared_ptr<const archival::configuration> _archival_conf;
     ss::sharded<cloud_storage::remote>& _cloud_storage_api;
@@ -86,6 +86,11 @@ public:
       ss::noncopyable_function<ss::stop_iteration(partition&)>);
     ss::future<> for_each_partition_random_order(
       ss::noncopyable_function<ss::stop_iteration(partition&)>);
+    // Visits only the partitions with a replica on one of the nodes, as
+    // indexed by partition_balancer_state.
+    ss::future<> for_each_partition_on_nodes(
+      const absl::flat_hash_set<model::node_id>&,
+      ss::noncopyable_function<ss::stop_iteration(partition&)>);
     ss::future<> with_partition(
       const model::ntp&, ss::noncopyable_function<void(partition&)>);
 
@@ -175,6 +180,8 @@ private:
     auto do_with_partition(
       const model::ntp& ntp, const partition_assignment& assignment, Visitor&);
 
+    const partition_assignment* find_assignment(const model::ntp&) const;
+
     void collect_actions(plan_data&);
 
     // returns true if the failure can be logged
@@ -1019,13 +1026,38 @@ partition_balancer_planner::request_context::for_each_partition_random_order(
     }
 }
 
-ss::future<> partition_balancer_planner::request_context::with_partition(
-  const model::ntp& ntp, ss::noncopyable_function<void(partition&)> visitor) {
+ss::future<>
+partition_balancer_planner::request_context::for_each_partition_on_nodes(
+  const absl::flat_hash_set<model::node_id>& nodes,
+  ss::noncopyable_function<ss::stop_iteration(partition&)> visitor) {
+    // Copy the ntps, the index can change while we yield.
+    absl::btree_set<model::ntp> ntps;
+    for (auto id : nodes) {
+        const auto& on_node = state().ntps_on_node(id);
+        ntps.insert(on_node.begin(), on_node.end());
+        co_await maybe_yield();
+    }
+
+    for (const auto& ntp : ntps) {
+        const auto* assignment = find_assignment(ntp);
+        if (assignment) {
+            auto stop = do_with_partition(ntp, *assignment, visitor);
+            if (stop == ss::stop_iteration::yes) {
+                co_return;
+            }
+        }
+        co_await maybe_yield();
+    }
+}
+
+const partition_assignment*
+partition_balancer_planner::request_context::find_assignment(
+  const model::ntp& ntp) const {
     auto topic = model::topic_namespace_view(ntp);
     auto topic_meta = _parent._state.topics().get_topic_metadata_ref(topic);
     if (!topic_meta) {
         vlog(clusterlog.warn, "topic {} not found", topic);
-        co_return;
+        return nullptr;
     }
     auto it = topic_meta->get().get_assignments().find(ntp.tp.partition);
     if (it == topic_meta->get().get_assignments().end()) {
@@ -1034,10 +1066,18 @@ ss::future<> partition_balancer_planner::request_context::with_partition(
           "partition {} of topic {} not found",
           ntp.tp.partition,
           topic);
-        co_return;
+        return nullptr;
     }
+    return &*it;
+}
 
-    do_with_partition(ntp, *it, visitor);
+ss::future<> partition_balancer_planner::request_context::with_partition(
+  const model::ntp& ntp, ss::noncopyable_function<void(partition&)> visitor) {
+    const auto* assignment = find_assignment(ntp);
+    if (assignment) {
+        do_with_partition(ntp, *assignment, visitor);
+    }
+    co_return;
 }
 
 allocation_constraints
@@ -1335,7 +1375,7 @@ ss::future<> partition_balancer_planner::get_node_drain_actions(
         co_return;
     }
 
-    co_await ctx.for_each_partition([&](partition& part) {
+    co_await ctx.for_each_partition_on_nodes(nodes, [&](partition& part) {
         std::vector<model::node_id> to_move;
         for (const auto& bs : part.replicas()) {
             if (nodes.contains(bs.node_id)) {
@@ -1588,11 +1628,15 @@ partition_balancer_planner::get_full_node_actions(request_context& ctx) {
     };
 
     // build an index of move candidates: full node -> movement priority -> ntp
+    absl::flat_hash_set<model::node_id> full_nodes;
+    for (const auto* node_disk : sorted_full_nodes) {
+        full_nodes.insert(node_disk->node_id);
+    }
     absl::flat_hash_map<
       model::node_id,
       absl::btree_multimap<size_t, model::ntp, std::greater<>>>
       full_node2priority2ntp;
-    co_await ctx.for_each_partition([&](partition& part) {
+    co_await ctx.for_each_partition_on_nodes(full_nodes, [&](partition& part) {
         part.match_variant(
           [&](reassignable_partition& part) {
               std::vector<model::node_id> replicas_on_full_nodes;
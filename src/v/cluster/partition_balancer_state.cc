@@ -43,6 +43,20 @@ void partition_balancer_state::handle_ntp_move_begin_or_cancel(
   model::partition_id p_id,
   const std::vector<model::broker_shard>& prev,
   const std::vector<model::broker_shard>& next) {
+    model::ntp ntp(ns, tp, p_id);
+    for (const auto& bs : prev) {
+        auto it = _node2ntps.find(bs.node_id);
+        if (it != _node2ntps.end()) {
+            it->second.erase(ntp);
+            if (it->second.empty()) {
+                _node2ntps.erase(it);
+            }
+        }
+    }
+    for (const auto& bs : next) {
+        _node2ntps[bs.node_id].insert(ntp);
+    }
+
     if (_partition_allocator.is_rack_awareness_enabled()) {
         absl::flat_hash_set<model::rack_id> racks;
         bool is_rack_constraint_violated = false;
@@ -57,7 +71,6 @@ void partition_balancer_state::handle_ntp_move_begin_or_cancel(
             }
         }
 
-        model::ntp ntp(ns, tp, p_id);
         if (is_rack_constraint_violated) {
             auto res = _ntps_with_broken_rack_constraint.insert(ntp);
             _ntps_with_broken_rack_constraint_revision++;
@@ -86,11 +99,20 @@ void partition_balancer_state::handle_ntp_move_begin_or_cancel(
     }
 }
 
+const absl::btree_set<model::ntp>&
+partition_balancer_state::ntps_on_node(model::node_id id) const {
+    static const absl::btree_set<model::ntp> empty;
+    auto it = _node2ntps.find(id);
+    if (it == _node2ntps.end()) {
+        return empty;
+    }
+    return it->second;
+}
+
 ss::future<>
 partition_balancer_state::apply_snapshot(const controller_snapshot& snap) {
-    if (!_partition_allocator.is_rack_awareness_enabled()) {
-        co_return;
-    }
+    const bool rack_awareness_enabled
+      = _partition_allocator.is_rack_awareness_enabled();
 
     absl::flat_hash_map<model::node_id, model::rack_id> node2rack;
     for (const auto& [id, node] : snap.members.nodes) {
@@ -111,6 +133,7 @@ partition_balancer_state::apply_snapshot(const controller_snapshot& snap) {
           return true;
       };
 
+    _node2ntps.clear();
     _ntps_with_broken_rack_constraint.clear();
     _ntps_with_broken_rack_constraint_revision++;
     for (const auto& [ns_tp, topic] : snap.topics.topics) {
@@ -125,9 +148,13 @@ partition_balancer_state::apply_snapshot(const controller_snapshot& snap) {
                 }
             }
 
-            if (!is_rack_placement_valid(*replicas)) {
-                _ntps_with_broken_rack_constraint.emplace(
-                  ns_tp.ns, ns_tp.tp, p_id);
+            model::ntp ntp(ns_tp.ns, ns_tp.tp, p_id);
+            for (const auto& bs : *replicas) {
+                _node2ntps[bs.node_id].insert(ntp);
+            }
+
+            if (rack_awareness_enabled && !is_rack_placement_valid(*replicas)) {
+                _ntps_with_broken_rack_constraint.insert(std::move(ntp));
                 _ntps_with_broken_rack_constraint_revision++;
             }
 
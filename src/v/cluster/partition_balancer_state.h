@@ -20,6 +20,7 @@
 #include <seastar/core/sharded.hh>
 
 #include <absl/container/btree_set.h>
+#include <absl/container/flat_hash_map.h>
 #include <absl/container/flat_hash_set.h>
 
 namespace cluster {
@@ -62,6 +63,12 @@ public:
           _ntps_with_broken_rack_constraint.end());
     }
 
+    /// Partitions with a replica on the node. For partitions that are being
+    /// moved these are the replicas of the target replica set. Maintained
+    /// from the replica set changes so that the planner visits only the
+    /// partitions of the nodes it acts on instead of all of them.
+    const absl::btree_set<model::ntp>& ntps_on_node(model::node_id) const;
+
     /// Called when the replica set of an ntp changes. Note that this doesn't
     /// account for in-progress moves - the function is called only once when
     /// the move is started.
@@ -109,6 +116,8 @@ private:
     // _ntps_with_broken_rack_constraint set. Relied upon by the iterator.
     model::revision_id _ntps_with_broken_rack_constraint_revision;
     absl::flat_hash_set<model::node_id> _nodes_to_rebalance;
+    absl::flat_hash_map<model::node_id, absl::btree_set<model::ntp>>
+      _node2ntps;
     probe _probe;
 };
 
@@ -140,6 +140,40 @@ ss::future<> partition_leaders_table::update_with_node_report(
     }
 }
 
+void partition_leaders_table::update_topic_leaders(
+  const topic_leaders& update) {
+    if (update.partitions.empty()) {
+        return;
+    }
+    const bool is_controller = update.tp_ns == model::controller_nt;
+    const bool present_in_table = _topic_table.local().contains(update.tp_ns);
+    const auto last_applied_revision
+      = _topic_table.local().last_applied_revision();
+
+    auto t_it = _topic_leaders.end();
+    for (const auto& p : update.partitions) {
+        const auto topic_removed = p.revision <= last_applied_revision
+                                   && !present_in_table;
+        if (topic_removed && !is_controller) {
+            vlog(
+              clusterlog.trace,
+              "can't update leadership of the removed topic {}",
+              update.tp_ns);
+            continue;
+        }
+        if (t_it == _topic_leaders.end()) {
+            bool new_topic_entry = false;
+            std::tie(t_it, new_topic_entry) = _topic_leaders.try_emplace(
+              update.tp_ns);
+            if (new_topic_entry) {
+                ++_topic_map_version;
+            }
+        }
+        do_update_partition_leader(
+          is_controller, t_it, p.id, p.revision, p.term, p.leader_id);
+    }
+}
+
 void partition_leaders_table::do_update_partition_leader(
   bool is_controller,
   topics_t::iterator t_it,
@@ -209,6 +243,7 @@ void partition_leaders_table::do_update_partition_leader(
             // Do nothing if update term is older
             return;
         }
+        ++_leadership_version;
         /**
          * Update leader less partition counter when leadership changed
          *
@@ -238,6 +273,7 @@ void partition_leaders_table::do_update_partition_leader(
          * We only increment version if any of the maps content was modified
          */
         ++_version;
+        ++_leadership_version;
     }
 
     vlog(
@@ -360,6 +396,7 @@ void partition_leaders_table::remove_leader(
             ++_topic_map_version;
         }
         ++_version;
+        ++_leadership_version;
     }
 }
 
@@ -369,6 +406,7 @@ void partition_leaders_table::reset() {
     _leaderless_partition_count = 0;
     ++_version;
     ++_topic_map_version;
+    ++_leadership_version;
 }
 
 partition_leaders_table::leaders_info_t
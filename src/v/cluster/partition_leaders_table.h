@@ -13,6 +13,7 @@
 
 #include "cluster/fwd.h"
 #include "cluster/health_monitor_types.h"
+#include "cluster/metadata_dissemination_types.h"
 #include "cluster/ntp_callbacks.h"
 #include "cluster/types.h"
 #include "container/contiguous_range_map.h"
@@ -141,6 +142,12 @@ public:
      */
     ss::future<> update_with_node_report(const node_health_report& node_report);
 
+    /**
+     * Applies the leadership updates of the partitions of a topic, looking up
+     * the topic only once for all of them.
+     */
+    void update_topic_leaders(const topic_leaders&);
+
     struct leader_info_t {
         model::topic_namespace tp_ns;
         model::partition_id pid;
@@ -160,6 +167,10 @@ public:
         return _leaderless_partition_count;
     }
 
+    /// Incremented on every change of the table contents, including the
+    /// leadership changes of known partitions that leave \ref version as is.
+    uint64_t leadership_version() const { return _leadership_version; }
+
     using leader_change_cb_t = ss::noncopyable_function<void(
       model::ntp, model::term_id, model::node_id)>;
 
@@ -233,6 +244,7 @@ private:
      */
     version _version{0};
     version _topic_map_version{0};
+    uint64_t _leadership_version{0};
     ss::gate _gate;
     ss::abort_source _as;
 };
@@ -78,6 +78,8 @@ partition_manager::partition_manager(
           std::optional<model::node_id> leader_id) {
             auto p = partition_for(group);
             if (p) {
+                _cloud_storage_usage.update_leadership(
+                  p->ntp(), leader_id == p->raft()->self().id());
                 auto a = p->archiver();
                 if (a) {
                     a.value().get().notify_leadership(leader_id);
@@ -259,10 +261,33 @@ ss::future<consensus_ptr> partition_manager::manage(
     _manage_watchers.notify(p->ntp(), p);
 
     co_await p->start(_stm_registry);
+    track_cloud_storage_usage(p);
 
     co_return c;
 }
 
+void partition_manager::track_cloud_storage_usage(
+  const ss::lw_shared_ptr<partition>& p) {
+    // the controller partition isn't part of the topic table, so it is not
+    // counted as a partition with cloud storage usage
+    if (p->ntp() == model::controller_ntp || get(p->ntp()) != p) {
+        return;
+    }
+    _cloud_storage_usage.add(
+      p->ntp(), p->cloud_log_size().value_or(0), p->is_leader());
+
+    if (const auto& stm = p->archival_meta_stm(); stm) {
+        stm->set_cloud_log_size_listener([this, p = p.get()] {
+            // the stm of a partition that is being shut down may still apply,
+            // don't let it override the usage of a partition recreated since
+            if (get(p->ntp()).get() == p) {
+                _cloud_storage_usage.update_size(
+                  p->ntp(), p->cloud_log_size().value_or(0));
+            }
+        });
+    }
+}
+
 ss::future<cloud_storage::log_recovery_result>
 partition_manager::maybe_download_log(
   storage::ntp_config& ntp_cfg, std::optional<remote_topic_properties> rtp) {
@@ -343,6 +368,7 @@ partition_manager::remove(const model::ntp& ntp, partition_removal_mode mode) {
     // remove partition from ntp & raft tables
     _ntp_table.erase(ntp);
     _raft_table.erase(group_id);
+    _cloud_storage_usage.remove(ntp);
     shutdown_state.update(partition_shutdown_stage::stopping_raft);
     co_await _raft_manager.local().remove(partition->raft());
     _unmanage_watchers.notify(
@@ -375,6 +401,7 @@ ss::future<> partition_manager::shutdown(const model::ntp& ntp) {
     // remove partition from ntp & raft tables
     _ntp_table.erase(ntp);
     _raft_table.erase(partition->group());
+    _cloud_storage_usage.remove(ntp);
 
     return do_shutdown(partition);
 }
@@ -13,6 +13,7 @@
 
 #include "archival/fwd.h"
 #include "cloud_storage/fwd.h"
+#include "cluster/cloud_storage_usage_tracker.h"
 #include "cluster/fwd.h"
 #include "cluster/ntp_callbacks.h"
 #include "cluster/partition.h"
@@ -205,6 +206,13 @@ public:
     ss::future<cloud_storage::cache_usage_target>
     get_cloud_cache_disk_usage_target() const;
 
+    /// Cloud storage usage of the partitions led by this shard, kept up to
+    /// date incrementally from archival_metadata_stm updates and leadership
+    /// notifications
+    const cloud_storage_usage_tracker& cloud_storage_usage() const {
+        return _cloud_storage_usage;
+    }
+
     template<typename T, typename... Args>
     void register_factory(Args&&... args) {
         _stm_registry.register_factory<T>(std::forward<Args>(args)...);
@@ -256,6 +264,9 @@ private:
     void check_partitions_shutdown_state();
 
     void maybe_arm_shutdown_watchdog();
+
+    void track_cloud_storage_usage(const ss::lw_shared_ptr<partition>&);
+
     storage::api& _storage;
     /// used to wait for concurrent recoveries
     ss::sharded<raft::group_manager>& _raft_manager;
@@ -292,6 +303,8 @@ private:
 
     state_machine_registry _stm_registry;
 
+    cloud_storage_usage_tracker _cloud_storage_usage;
+
     friend std::ostream& operator<<(std::ostream&, const partition_manager&);
     friend std::ostream& operator<<(
       std::ostream&, const partition_manager::partition_shutdown_stage&);
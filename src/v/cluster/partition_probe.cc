@@ -18,11 +18,93 @@
 
 #include <seastar/core/metrics.hh>
 
+#include <absl/container/flat_hash_map.h>
+
 namespace cluster {
 
 static const ss::sstring cluster_metrics_name
   = prometheus_sanitize::metrics_name("cluster:partition");
 
+namespace {
+// The rollups of the topics with partitions on this shard, each rollup
+// removes itself when destroyed.
+thread_local absl::flat_hash_map<model::topic_namespace, topic_rollup_probe*>
+  topic_rollups;
+} // namespace
+
+topic_rollup_probe::holder
+topic_rollup_probe::get(const model::topic_namespace& tp_ns) {
+    if (auto it = topic_rollups.find(tp_ns); it != topic_rollups.end()) {
+        return it->second->shared_from_this();
+    }
+    return ss::make_lw_shared<topic_rollup_probe>(tp_ns);
+}
+
+topic_rollup_probe::topic_rollup_probe(model::topic_namespace tp_ns)
+  : _tp_ns(std::move(tp_ns)) {
+    topic_rollups.emplace(_tp_ns, this);
+    setup_metrics();
+}
+
+topic_rollup_probe::~topic_rollup_probe() { topic_rollups.erase(_tp_ns); }
+
+void topic_rollup_probe::setup_metrics() {
+    namespace sm = ss::metrics;
+
+    auto request_label = metrics::make_namespaced_label("request");
+    auto ns_label = metrics::make_namespaced_label("namespace");
+    auto topic_label = metrics::make_namespaced_label("topic");
+
+    const std::vector<sm::label_instance> labels = {
+      ns_label(_tp_ns.ns()),
+      topic_label(_tp_ns.tp()),
+    };
+
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("kafka"),
+      {
+        sm::make_total_bytes(
+          "request_bytes_total",
+          [this] { return _bytes_produced; },
+          sm::description("Total number of bytes produced per topic"),
+          {request_label("produce"),
+           ns_label(_tp_ns.ns()),
+           topic_label(_tp_ns.tp())})
+          .aggregate({sm::shard_label}),
+        sm::make_total_bytes(
+          "request_bytes_total",
+          [this] { return _bytes_fetched; },
+          sm::description("Total number of bytes fetched (not all "
+                          "might be returned to the client)"),
+          {request_label("consume"),
+           ns_label(_tp_ns.ns()),
+           topic_label(_tp_ns.tp())})
+          .aggregate({sm::shard_label}),
+        sm::make_counter(
+          "records_produced_total",
+          [this] { return _records_produced; },
+          sm::description("Total number of records produced"),
+          labels)
+          .aggregate({sm::shard_label}),
+        sm::make_counter(
+          "records_fetched_total",
+          [this] { return _records_fetched; },
+          sm::description("Total number of records fetched"),
+          labels)
+          .aggregate({sm::shard_label}),
+        sm::make_counter(
+          "request_bytes_total",
+          [this] { return _bytes_fetched_from_follower; },
+          sm::description(
+            "Total number of bytes fetched from follower (not all "
+            "might be returned to the client)"),
+          {request_label("follower_consume"),
+           ns_label(_tp_ns.ns()),
+           topic_label(_tp_ns.tp())})
+          .aggregate({sm::shard_label}),
+      });
+}
+
 replicated_partition_probe::replicated_partition_probe(
   const partition& p) noexcept
   : _partition(p) {
@@ -31,6 +113,9 @@ replicated_partition_probe::replicated_partition_probe(
 }
 
 void replicated_partition_probe::reconfigure_metrics() {
+    // Hold on to the rollup, so that its totals carry on if this is the
+    // only partition of the topic on this shard.
+    auto topic_rollup = _topic_rollup;
     clear_metrics();
     setup_metrics(_partition.ntp());
 }
@@ -38,6 +123,7 @@ void replicated_partition_probe::reconfigure_metrics() {
 void replicated_partition_probe::clear_metrics() {
     _metrics.clear();
     _public_metrics.clear();
+    _topic_rollup = nullptr;
 }
 
 void replicated_partition_probe::setup_metrics(const model::ntp& ntp) {
@@ -190,7 +276,6 @@ void replicated_partition_probe::setup_public_metrics(const model::ntp& ntp) {
         return;
     }
 
-    auto request_label = metrics::make_namespaced_label("request");
     auto ns_label = metrics::make_namespaced_label("namespace");
     auto topic_label = metrics::make_namespaced_label("topic");
     auto partition_label = metrics::make_namespaced_label("partition");
@@ -201,6 +286,10 @@ void replicated_partition_probe::setup_public_metrics(const model::ntp& ntp) {
       partition_label(ntp.tp.partition()),
     };
 
+    // Topic level metrics are registered once per topic by the rollup
+    _topic_rollup = topic_rollup_probe::get(
+      model::topic_namespace(ntp.ns, ntp.tp.topic));
+
     _public_metrics.add_group(
       prometheus_sanitize::metrics_name("kafka"),
       {
@@ -247,49 +336,6 @@ void replicated_partition_probe::setup_public_metrics(const model::ntp& ntp) {
                           "that are live, but not at the latest offest)"),
           labels)
           .aggregate({sm::shard_label}),
-        // Topic Level Metrics
-        sm::make_total_bytes(
-          "request_bytes_total",
-          [this] { return _bytes_produced; },
-          sm::description("Total number of bytes produced per topic"),
-          {request_label("produce"),
-           ns_label(ntp.ns()),
-           topic_label(ntp.tp.topic()),
-           partition_label(ntp.tp.partition())})
-          .aggregate({sm::shard_label, partition_label}),
-        sm::make_total_bytes(
-          "request_bytes_total",
-          [this] { return _bytes_fetched; },
-          sm::description("Total number of bytes fetched (not all "
-                          "might be returned to the client)"),
-          {request_label("consume"),
-           ns_label(ntp.ns()),
-           topic_label(ntp.tp.topic()),
-           partition_label(ntp.tp.partition())})
-          .aggregate({sm::shard_label, partition_label}),
-        sm::make_counter(
-          "records_produced_total",
-          [this] { return _records_produced; },
-          sm::description("Total number of records produced"),
-          labels)
-          .aggregate({sm::shard_label, partition_label}),
-        sm::make_counter(
-          "records_fetched_total",
-          [this] { return _records_fetched; },
-          sm::description("Total number of records fetched"),
-          labels)
-          .aggregate({sm::shard_label, partition_label}),
-        sm::make_counter(
-          "request_bytes_total",
-          [this] { return _bytes_fetched_from_follower; },
-          sm::description(
-            "Total number of bytes fetched from follower (not all "
-            "might be returned to the client)"),
-          {request_label("follower_consume"),
-           ns_label(ntp.ns()),
-           topic_label(ntp.tp.topic()),
-           partition_label(ntp.tp.partition())})
-          .aggregate({sm::shard_label, partition_label}),
       });
     if (
       config::shard_local_cfg().enable_schema_id_validation()
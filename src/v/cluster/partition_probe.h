@@ -12,6 +12,7 @@
 #pragma once
 #include "metrics/metrics.h"
 #include "model/fundamental.h"
+#include "model/metadata.h"
 
 #include <seastar/core/metrics_registration.hh>
 #include <seastar/core/shared_ptr.hh>
@@ -31,6 +32,8 @@ public:
         virtual void add_bytes_fetched(uint64_t) = 0;
         virtual void add_bytes_fetched_from_follower(uint64_t) = 0;
         virtual void add_schema_id_validation_failed() = 0;
+        virtual uint64_t bytes_produced() const = 0;
+        virtual uint64_t bytes_fetched() const = 0;
         virtual void setup_metrics(const model::ntp&) = 0;
         virtual void clear_metrics() = 0;
         virtual ~impl() noexcept = default;
@@ -68,25 +71,100 @@ public:
 
     void clear_metrics() { _impl->clear_metrics(); }
 
+    /// Totals since the partition was started on this shard
+    uint64_t bytes_produced() const { return _impl->bytes_produced(); }
+    uint64_t bytes_fetched() const { return _impl->bytes_fetched(); }
+
 private:
     std::unique_ptr<impl> _impl;
 };
+/**
+ * Totals of the requests served by the partitions of a topic on this shard.
+ *
+ * The public request metrics are summed over the partitions of a topic, so
+ * the partitions of a topic on a shard share a rollup, which they add to as
+ * they serve requests, and which is registered as a single series per topic.
+ * Scrapes then iterate and aggregate one series per topic rather than one per
+ * partition. The rollup lives as long as one of the partitions holds it.
+ */
+class topic_rollup_probe
+  : public ss::enable_lw_shared_from_this<topic_rollup_probe> {
+public:
+    using holder = ss::lw_shared_ptr<topic_rollup_probe>;
+
+    /// The rollup of the topic on this shard, created on first use.
+    static holder get(const model::topic_namespace&);
+
+    explicit topic_rollup_probe(model::topic_namespace);
+    topic_rollup_probe(const topic_rollup_probe&) = delete;
+    topic_rollup_probe& operator=(const topic_rollup_probe&) = delete;
+    topic_rollup_probe(topic_rollup_probe&&) = delete;
+    topic_rollup_probe& operator=(topic_rollup_probe&&) = delete;
+    ~topic_rollup_probe();
+
+    void add_records_fetched(uint64_t cnt) { _records_fetched += cnt; }
+    void add_records_produced(uint64_t cnt) { _records_produced += cnt; }
+    void add_bytes_fetched(uint64_t cnt) { _bytes_fetched += cnt; }
+    void add_bytes_fetched_from_follower(uint64_t cnt) {
+        _bytes_fetched_from_follower += cnt;
+    }
+    void add_bytes_produced(uint64_t cnt) { _bytes_produced += cnt; }
+
+private:
+    void setup_metrics();
+
+    model::topic_namespace _tp_ns;
+    uint64_t _records_produced{0};
+    uint64_t _records_fetched{0};
+    uint64_t _bytes_produced{0};
+    uint64_t _bytes_fetched{0};
+    uint64_t _bytes_fetched_from_follower{0};
+    metrics::public_metric_groups _metrics;
+};
+
 class replicated_partition_probe : public partition_probe::impl {
 public:
     explicit replicated_partition_probe(const partition&) noexcept;
 
     void setup_metrics(const model::ntp&) final;
 
-    void add_records_fetched(uint64_t cnt) final { _records_fetched += cnt; }
-    void add_records_produced(uint64_t cnt) final { _records_produced += cnt; }
-    void add_bytes_fetched(uint64_t cnt) final { _bytes_fetched += cnt; }
+    void add_records_fetched(uint64_t cnt) final {
+        _records_fetched += cnt;
+        if (_topic_rollup) {
+            _topic_rollup->add_records_fetched(cnt);
+        }
+    }
+    void add_records_produced(uint64_t cnt) final {
+        _records_produced += cnt;
+        if (_topic_rollup) {
+            _topic_rollup->add_records_produced(cnt);
+        }
+    }
+    void add_bytes_fetched(uint64_t cnt) final {
+        _bytes_fetched += cnt;
+        if (_topic_rollup) {
+            _topic_rollup->add_bytes_fetched(cnt);
+        }
+    }
     void add_bytes_fetched_from_follower(uint64_t cnt) final {
         _bytes_fetched_from_follower += cnt;
+        if (_topic_rollup) {
+            _topic_rollup->add_bytes_fetched_from_follower(cnt);
+        }
+    }
+    void add_bytes_produced(uint64_t cnt) final {
+        _bytes_produced += cnt;
+        if (_topic_rollup) {
+            _topic_rollup->add_bytes_produced(cnt);
+        }
     }
-    void add_bytes_produced(uint64_t cnt) final { _bytes_produced += cnt; }
     void add_schema_id_validation_failed() final {
         ++_schema_id_validation_records_failed;
     };
+    uint64_t bytes_produced() const final { return _bytes_produced; }
+    uint64_t bytes_fetched() const final {
+        return _bytes_fetched + _bytes_fetched_from_follower;
+    }
 
     void clear_metrics() final;
 
@@ -107,6 +185,8 @@ private:
     uint64_t _schema_id_validation_records_failed{0};
     metrics::internal_metric_groups _metrics;
     metrics::public_metric_groups _public_metrics;
+    // Set while the public metrics are registered
+    topic_rollup_probe::holder _topic_rollup;
 };
 
 } // namespace cluster
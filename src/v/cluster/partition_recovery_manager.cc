@@ -16,6 +16,7 @@
 #include "cloud_storage/topic_manifest.h"
 #include "cloud_storage/types.h"
 #include "cluster/topic_recovery_status_frontend.h"
+#include "config/configuration.h"
 #include "hashing/xx.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
@@ -35,10 +36,12 @@
 #include <seastar/core/seastar.hh>
 #include <seastar/core/shared_ptr.hh>
 #include <seastar/core/temporary_buffer.hh>
+#include <seastar/util/defer.hh>
 #include <seastar/util/log.hh>
 
 #include <absl/container/btree_map.h>
 #include <boost/algorithm/string/detail/sequence.hpp>
+#include <boost/range/irange.hpp>
 
 #include <chrono>
 #include <exception>
@@ -70,7 +73,10 @@ partition_recovery_manager::partition_recovery_manager(
   cloud_storage_clients::bucket_name bucket, ss::sharded<remote>& remote)
   : _bucket(std::move(bucket))
   , _remote(remote)
-  , _root(_as) {}
+  , _root(_as)
+  , _download_units(
+      config::shard_local_cfg().cloud_storage_recovery_download_concurrency(),
+      "cst/recovery") {}
 
 partition_recovery_manager::~partition_recovery_manager() {
     vassert(_gate.is_closed(), "S3 downloader is not stopped properly");
@@ -107,6 +113,8 @@ ss::future<log_recovery_result> partition_recovery_manager::download_log(
       _bucket,
       _gate,
       _root,
+      _download_units,
+      _probe,
       _as);
     auto result = co_await downloader.maybe_download_log();
     retry_chain_node fib{_as, download_timeout, initial_backoff};
@@ -155,6 +163,8 @@ partition_downloader::partition_downloader(
   cloud_storage_clients::bucket_name bucket,
   ss::gate& gate_root,
   retry_chain_node& parent,
+  ssx::semaphore& download_units,
+  partition_recovery_probe& probe,
   storage::opt_abort_source_t as)
   : _ntpc(ntpc)
   , _bucket(std::move(bucket))
@@ -167,6 +177,8 @@ partition_downloader::partition_downloader(
       cst_log,
       _rtcnode,
       ssx::sformat("[{}, rev: {}]", ntpc.ntp().path(), ntpc.get_revision()))
+  , _download_units(download_units)
+  , _probe(probe)
   , _as(as) {}
 
 ss::future<log_recovery_result> partition_downloader::maybe_download_log() {
@@ -306,6 +318,8 @@ ss::future<log_recovery_result> partition_downloader::download_log() {
       prefix,
       _ntpc.get_revision(),
       retention);
+    _probe.partition_started();
+    auto stopped = ss::defer([this] { _probe.partition_stopped(); });
     auto mat = co_await find_recovery_material();
     if (cst_log.is_enabled(ss::log_level::debug)) {
         std::stringstream ostr;
@@ -317,6 +331,7 @@ ss::future<log_recovery_result> partition_downloader::download_log() {
     }
     if (mat.partition_manifest.size() == 0) {
         // If the downloaded manifest doesn't have any segments
+        _probe.partition_recovered();
         log_recovery_result result{
           .logs_recovered = true,
           .clean_download = true,
@@ -367,6 +382,7 @@ ss::future<log_recovery_result> partition_downloader::download_log() {
         co_await move_parts(part);
     }
 
+    _probe.partition_recovered();
     log_recovery_result result{
       .logs_recovered = true,
       .clean_download = part.clean_download,
@@ -449,7 +465,6 @@ partition_downloader::download_log_with_capped_size(
         }
     }
 
-    std::vector<offset_range> dloffsets;
     auto ot_state = ss::make_lw_shared<storage::offset_translator_state>(
       _ntpc.ntp(), get_prev_offset(start_offset), start_delta());
     download_part dlpart{
@@ -472,26 +487,7 @@ partition_downloader::download_log_with_capped_size(
       start_offset,
       start_delta);
 
-    for (auto s : staged_downloads) {
-        vlog(
-          dllog.debug,
-          "Starting download, base-offset: {}, term: {}, size: {}, fs "
-          "prefix: {}, "
-          "destination: {}",
-          s.base_offset,
-          s.segment_term,
-          s.size_bytes,
-          dlpart.part_prefix,
-          dlpart.dest_prefix);
-        auto offsets = co_await download_segment_file(s, dlpart);
-        if (offsets.has_value()) {
-            dloffsets.push_back(offset_range{
-              .min_offset = offsets->min_offset,
-              .max_offset = offsets->max_offset,
-            });
-        }
-    }
-
+    auto dloffsets = co_await download_segments(staged_downloads, dlpart);
     update_downloaded_offsets(std::move(dloffsets), dlpart);
     co_return dlpart;
 }
@@ -553,7 +549,6 @@ partition_downloader::download_log_with_capped_time(
       "start_delta: {}",
       start_offset,
       start_delta);
-    std::vector<offset_range> dloffsets;
     auto ot_state = ss::make_lw_shared<storage::offset_translator_state>(
       _ntpc.ntp(), get_prev_offset(start_offset), start_delta());
     download_part dlpart = {
@@ -576,23 +571,7 @@ partition_downloader::download_log_with_capped_time(
       start_offset,
       start_delta);
 
-    for (auto s : staged_downloads) {
-        vlog(
-          dllog.debug,
-          "Starting download, base_offset: {}, term: {}, fs prefix: {}, "
-          "dest: {}",
-          s.base_offset,
-          s.segment_term,
-          dlpart.part_prefix,
-          dlpart.dest_prefix);
-        auto offsets = co_await download_segment_file(s, dlpart);
-        if (offsets.has_value()) {
-            dloffsets.push_back({
-              .min_offset = offsets->min_offset,
-              .max_offset = offsets->max_offset,
-            });
-        }
-    }
+    auto dloffsets = co_await download_segments(staged_downloads, dlpart);
     update_downloaded_offsets(std::move(dloffsets), dlpart);
     co_return dlpart;
 }
@@ -664,6 +643,59 @@ ss::future<uint64_t> partition_downloader::download_segment_file_stream(
     co_return stats.size_bytes;
 }
 
+ss::future<std::vector<partition_downloader::offset_range>>
+partition_downloader::download_segments(
+  const std::deque<segment_meta>& segments, download_part& part) {
+    std::vector<std::optional<stream_stats>> results(segments.size());
+    _probe.segments_scheduled(segments.size());
+    co_await ss::max_concurrent_for_each(
+      boost::irange<size_t>(0, segments.size()),
+      config::shard_local_cfg().cloud_storage_recovery_download_concurrency(),
+      [this, &segments, &part, &results](size_t i) {
+          return ss::with_semaphore(
+            _download_units, 1, [this, &segments, &part, &results, i] {
+                const auto& s = segments[i];
+                vlog(
+                  _ctxlog.debug,
+                  "Starting download, base-offset: {}, term: {}, size: {}, "
+                  "fs prefix: {}, destination: {}",
+                  s.base_offset,
+                  s.segment_term,
+                  s.size_bytes,
+                  part.part_prefix,
+                  part.dest_prefix);
+                return download_segment_file(s, part)
+                  .then([this, &results, i](std::optional<stream_stats> r) {
+                      if (r.has_value()) {
+                          _probe.segment_downloaded(r->size_bytes);
+                      } else {
+                          _probe.segment_failed();
+                      }
+                      results[i] = std::move(r);
+                  })
+                  .handle_exception([this](const std::exception_ptr& e) {
+                      _probe.segment_failed();
+                      return ss::make_exception_future<>(e);
+                  });
+            });
+      });
+
+    std::vector<offset_range> dloffsets;
+    for (auto& r : results) {
+        if (!r.has_value()) {
+            continue;
+        }
+        for (const auto& [base, last] : r->gaps) {
+            part.ot_state->add_gap(base, last);
+        }
+        dloffsets.push_back(offset_range{
+          .min_offset = r->min_offset,
+          .max_offset = r->max_offset,
+        });
+    }
+    co_return dloffsets;
+}
+
 ss::future<std::optional<cloud_storage::stream_stats>>
 partition_downloader::download_segment_file(
   const segment_meta& segm, const download_part& part) {
@@ -684,7 +716,9 @@ partition_downloader::download_segment_file(
       part.part_prefix.string(),
       localpath);
 
-    offset_translator otl{segm.delta_offset, part.ot_state, _as};
+    // The gaps are returned in the stats and added to the state of the
+    // partition by the caller, in order.
+    offset_translator otl{segm.delta_offset, nullptr, _as};
 
     if (co_await ss::file_exists(localpath.string())) {
         vlog(
@@ -12,9 +12,11 @@
 
 #include "cloud_storage/offset_translation_layer.h"
 #include "cloud_storage/remote.h"
+#include "cluster/partition_recovery_probe.h"
 #include "model/metadata.h"
 #include "model/record.h"
 #include "storage/ntp_config.h"
+#include "ssx/semaphore.h"
 #include "storage/offset_translator_state.h"
 #include "utils/retry_chain_node.h"
 
@@ -23,6 +25,7 @@
 #include <seastar/core/sharded.hh>
 #include <seastar/core/shared_ptr.hh>
 
+#include <deque>
 #include <vector>
 
 namespace cluster {
@@ -100,13 +103,14 @@ private:
     ss::gate _gate;
     retry_chain_node _root;
     ss::abort_source _as;
+    /// Downloads of all the partitions of the shard being recovered
+    ssx::semaphore _download_units;
+    partition_recovery_probe _probe;
 };
 
 /// Topic downloader is used to download topic segments from S3 (or compatible
 /// storage) during topic re-creation
 class partition_downloader {
-    static constexpr size_t max_concurrency = 1;
-
 public:
     partition_downloader(
       const storage::ntp_config& ntpc,
@@ -116,6 +120,8 @@ public:
       cloud_storage_clients::bucket_name bucket,
       ss::gate& gate_root,
       retry_chain_node& parent,
+      ssx::semaphore& download_units,
+      partition_recovery_probe& probe,
       storage::opt_abort_source_t as);
 
     partition_downloader(const partition_downloader&) = delete;
@@ -177,6 +183,16 @@ private:
       std::vector<partition_downloader::offset_range> dloffsets,
       partition_downloader::download_part& dlpart);
 
+    /// Download the segments to their local files. Up to
+    /// `cloud_storage_recovery_download_concurrency` segments of the
+    /// partition are downloaded at once, within the units shared by the
+    /// partitions of the shard, so that one segment is written to disk while
+    /// the next ones are downloaded. The gaps of the segments are added to
+    /// the offset translator state of \p part in offset order once they are
+    /// all downloaded.
+    ss::future<std::vector<offset_range>> download_segments(
+      const std::deque<segment_meta>& segments, download_part& part);
+
     /// Download segment file to the target location
     ///
     /// The downloaded file will have a custom suffix
@@ -223,6 +239,8 @@ private:
     ss::gate& _gate;
     retry_chain_node _rtcnode;
     retry_chain_logger _ctxlog;
+    ssx::semaphore& _download_units;
+    partition_recovery_probe& _probe;
     storage::opt_abort_source_t _as;
 };
 
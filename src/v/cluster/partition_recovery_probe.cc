@@ -0,0 +1,61 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "cluster/partition_recovery_probe.h"
+
+#include "config/configuration.h"
+#include "prometheus/prometheus_sanitize.h"
+
+#include <seastar/core/metrics.hh>
+
+namespace cloud_storage {
+
+partition_recovery_probe::partition_recovery_probe() {
+    namespace sm = ss::metrics;
+
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("cloud_storage:partition_recovery"),
+      {
+        sm::make_gauge(
+          "partitions_in_progress",
+          [this] { return _partitions_in_progress; },
+          sm::description("Number of partitions being recovered.")),
+        sm::make_counter(
+          "partitions_recovered",
+          [this] { return _partitions_recovered; },
+          sm::description("Total number of partitions recovered.")),
+        sm::make_gauge(
+          "segments_pending",
+          [this] { return _segments_pending; },
+          sm::description(
+            "Number of segments scheduled for download and not yet "
+            "downloaded.")),
+        sm::make_counter(
+          "segments_downloaded",
+          [this] { return _segments_downloaded; },
+          sm::description("Total number of segments downloaded.")),
+        sm::make_counter(
+          "segment_download_failures",
+          [this] { return _segment_download_failures; },
+          sm::description("Total number of segments failed to download.")),
+        sm::make_counter(
+          "downloaded_bytes",
+          [this] { return _downloaded_bytes; },
+          sm::description(
+            "Total number of bytes written to the local logs of the "
+            "recovered partitions.")),
+      });
+}
+
+} // namespace cloud_storage
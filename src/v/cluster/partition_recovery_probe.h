@@ -0,0 +1,52 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#pragma once
+
+#include "metrics/metrics.h"
+
+#include <seastar/core/metrics_registration.hh>
+
+#include <cstdint>
+
+namespace cloud_storage {
+
+/// Progress of the partitions of a shard being recovered from cloud storage
+class partition_recovery_probe {
+public:
+    partition_recovery_probe();
+
+    void partition_started() { ++_partitions_in_progress; }
+    void partition_stopped() { --_partitions_in_progress; }
+    void partition_recovered() { ++_partitions_recovered; }
+
+    void segments_scheduled(size_t n) { _segments_pending += n; }
+    void segment_downloaded(uint64_t size_bytes) {
+        --_segments_pending;
+        ++_segments_downloaded;
+        _downloaded_bytes += size_bytes;
+    }
+    void segment_failed() {
+        --_segments_pending;
+        ++_segment_download_failures;
+    }
+
+private:
+    int64_t _partitions_in_progress{0};
+    uint64_t _partitions_recovered{0};
+    int64_t _segments_pending{0};
+    uint64_t _segments_downloaded{0};
+    uint64_t _segment_download_failures{0};
+    uint64_t _downloaded_bytes{0};
+
+    metrics::internal_metric_groups _metrics;
+};
+
+} // namespace cloud_storage
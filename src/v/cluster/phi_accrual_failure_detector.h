@@ -0,0 +1,120 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "rpc/types.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <optional>
+#include <vector>
+
+namespace cluster {
+
+/**
+ * Phi accrual failure detector (Hayashibara et al.). Instead of a binary
+ * alive/dead verdict after a fixed timeout, it keeps a window of the
+ * intervals between the heartbeats of a peer and expresses the suspicion
+ * that the peer failed as phi = -log10(P(next heartbeat arrives later than
+ * now)), assuming normally distributed intervals. phi of 1 means a 10% chance
+ * of a false suspicion, phi of 2 a 1% chance and so on.
+ *
+ * The detector adapts to the actual heartbeat cadence of the peer, which for
+ * node status depends on both the probing interval and the raft heartbeats.
+ */
+class phi_accrual_failure_detector {
+public:
+    using clock_type = rpc::clock_type;
+
+    static constexpr size_t default_window_size = 100;
+
+    /// min_stddev keeps the detector from becoming over sensitive when the
+    /// heartbeats arrive at a very regular cadence
+    explicit phi_accrual_failure_detector(
+      std::chrono::milliseconds min_stddev,
+      size_t window_size = default_window_size)
+      : _min_stddev(static_cast<double>(min_stddev.count()))
+      , _window_size(std::max<size_t>(window_size, 1)) {
+        _intervals.reserve(_window_size);
+    }
+
+    void heartbeat(clock_type::time_point at) {
+        if (_last_heartbeat && at > *_last_heartbeat) {
+            add_interval(
+              static_cast<double>(
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                  at - *_last_heartbeat)
+                  .count()));
+        }
+        if (!_last_heartbeat || at > *_last_heartbeat) {
+            _last_heartbeat = at;
+        }
+    }
+
+    /// Suspicion level of the peer, 0 until at least one interval between
+    /// heartbeats was observed
+    double phi(clock_type::time_point now) const {
+        if (_intervals.empty() || now <= *_last_heartbeat) {
+            return 0;
+        }
+        const auto elapsed = static_cast<double>(
+          std::chrono::duration_cast<std::chrono::milliseconds>(
+            now - *_last_heartbeat)
+            .count());
+        const auto n = static_cast<double>(_intervals.size());
+        const double mean = _sum / n;
+        const double variance = std::max(
+          0.0, _sum_of_squares / n - mean * mean);
+        const double stddev = std::max(std::sqrt(variance), _min_stddev);
+
+        // logistic approximation of the normal cumulative distribution
+        // function, see Bowling et al. "A logistic approximation to the
+        // cumulative normal distribution"
+        const double y = (elapsed - mean) / stddev;
+        const double e = std::exp(-y * (1.5976 + 0.070566 * y * y));
+        if (elapsed > mean) {
+            return -std::log10(e / (1.0 + e));
+        }
+        return -std::log10(1.0 - 1.0 / (1.0 + e));
+    }
+
+    std::optional<clock_type::time_point> last_heartbeat() const {
+        return _last_heartbeat;
+    }
+
+private:
+    void add_interval(double interval) {
+        if (_intervals.size() < _window_size) {
+            _intervals.push_back(interval);
+        } else {
+            auto& oldest = _intervals[_next];
+            _sum -= oldest;
+            _sum_of_squares -= oldest * oldest;
+            oldest = interval;
+            _next = (_next + 1) % _window_size;
+        }
+        _sum += interval;
+        _sum_of_squares += interval * interval;
+    }
+
+    double _min_stddev;
+    size_t _window_size;
+    // ring buffer of the last intervals, in milliseconds
+    std::vector<double> _intervals;
+    size_t _next{0};
+    double _sum{0};
+    double _sum_of_squares{0};
+    std::optional<clock_type::time_point> _last_heartbeat;
+};
+
+} // namespace cluster
@@ -21,9 +21,11 @@ namespace cluster {
 
 producer_state_manager::producer_state_manager(
   config::binding<uint64_t> max_producer_ids,
-  std::chrono::milliseconds producer_expiration_ms)
+  std::chrono::milliseconds producer_expiration_ms,
+  config::binding<size_t> max_spilled_bytes)
   : _producer_expiration_ms(producer_expiration_ms)
-  , _max_ids(std::move(max_producer_ids)) {
+  , _max_ids(std::move(max_producer_ids))
+  , _max_spilled_bytes(std::move(max_spilled_bytes)) {
     setup_metrics();
 }
 
@@ -36,7 +38,11 @@ ss::future<> producer_state_manager::start() {
 
 ss::future<> producer_state_manager::stop() {
     _reaper.cancel();
-    return _gate.close();
+    return _gate.close().then([this] {
+        _spilled.clear();
+        _spill_order.clear();
+        _spilled_bytes = 0;
+    });
 }
 
 void producer_state_manager::setup_metrics() {
@@ -54,7 +60,20 @@ void producer_state_manager::setup_metrics() {
        sm::make_counter(
          "evicted_producers",
          [this] { return _eviction_counter; },
-         sm::description("Number of evicted producers so far."))});
+         sm::description("Number of evicted producers so far.")),
+       sm::make_gauge(
+         "spilled_producers",
+         [this] { return _spilled.size(); },
+         sm::description("Number of evicted producers whose state is kept.")),
+       sm::make_gauge(
+         "spilled_producers_bytes",
+         [this] { return _spilled_bytes; },
+         sm::description("Memory used by the state of evicted producers.")),
+       sm::make_counter(
+         "rehydrated_producers",
+         [this] { return _rehydrated_counter; },
+         sm::description(
+           "Number of evicted producers restored from their kept state."))});
 }
 
 void producer_state_manager::register_producer(producer_state& state) {
@@ -81,8 +100,91 @@ void producer_state_manager::link(producer_state& state) {
 
 bool producer_state_manager::can_evict_producer(
   const producer_state& state) const {
-    return _num_producers > _max_ids()
-           || state.ms_since_last_update() > _producer_expiration_ms;
+    return _num_producers > _max_ids() || is_expired(state);
+}
+
+bool producer_state_manager::is_expired(const producer_state& state) const {
+    return state.ms_since_last_update() > _producer_expiration_ms;
+}
+
+std::optional<producer_state_snapshot> producer_state_manager::take_spilled(
+  raft::group_id group, model::producer_identity pid) {
+    auto it = _spilled.find(spill_key{.group = group, .pid = pid});
+    if (it == _spilled.end()) {
+        return std::nullopt;
+    }
+    auto state = std::move(it->second.state);
+    erase_spilled(it);
+    ++_rehydrated_counter;
+    vlog(clusterlog.debug, "Rehydrating producer {} of group {}", pid, group);
+    return state;
+}
+
+void producer_state_manager::drop_spilled(raft::group_id group) {
+    const spill_key first{
+      .group = group,
+      .pid = model::producer_identity(
+        std::numeric_limits<int64_t>::min(),
+        std::numeric_limits<int16_t>::min())};
+    auto it = _spilled.lower_bound(first);
+    while (it != _spilled.end() && it->first.group == group) {
+        it = erase_spilled(it);
+    }
+}
+
+void producer_state_manager::spill(const producer_state& state) {
+    auto snapshot = state.snapshot(kafka::offset::min());
+    if (snapshot._finished_requests.empty()) {
+        // nothing to resume from
+        return;
+    }
+    const auto bytes = sizeof(spill_key) + sizeof(spilled_producer)
+                       + sizeof(uint64_t)
+                       + snapshot._finished_requests.capacity()
+                           * sizeof(producer_state_snapshot::finished_request);
+    if (bytes > _max_spilled_bytes()) {
+        return;
+    }
+    const spill_key key{.group = state._group, .pid = state._id};
+    if (auto it = _spilled.find(key); it != _spilled.end()) {
+        erase_spilled(it);
+    }
+    const auto order = _next_spill_order++;
+    _spilled.emplace(
+      key,
+      spilled_producer{
+        .state = std::move(snapshot),
+        .last_update = state._last_updated_ts,
+        .order = order,
+        .bytes = bytes});
+    _spill_order.emplace(order, key);
+    _spilled_bytes += bytes;
+    // make room by dropping the producers spilled longest ago
+    while (_spilled_bytes > _max_spilled_bytes()) {
+        erase_spilled(_spilled.find(_spill_order.begin()->second));
+    }
+}
+
+producer_state_manager::spilled_t::iterator
+producer_state_manager::erase_spilled(spilled_t::iterator it) {
+    _spill_order.erase(it->second.order);
+    _spilled_bytes -= it->second.bytes;
+    return _spilled.erase(it);
+}
+
+void producer_state_manager::evict_spilled_producers() {
+    // producers are spilled in lru order so the ones spilled first are the
+    // ones idle for longest
+    const auto now = ss::lowres_system_clock::now();
+    while (!_spill_order.empty()) {
+        auto it = _spilled.find(_spill_order.begin()->second);
+        if (
+          now - it->second.last_update <= _producer_expiration_ms
+          && _spilled_bytes <= _max_spilled_bytes()) {
+            break;
+        }
+        erase_spilled(it);
+    }
 }
 
 void producer_state_manager::evict_excess_producers() {
@@ -105,6 +207,9 @@ void producer_state_manager::do_evict_excess_producers() {
         auto it_copy = it;
         ++it;
         auto& state = *it_copy;
+        if (_max_spilled_bytes() > 0 && !is_expired(state)) {
+            spill(state);
+        }
         // Here eviction does not need to check if an operation is
         // currently in progress on the producer at this point. That
         // is because the producer unlinks itself from this list
@@ -115,6 +220,7 @@ void producer_state_manager::do_evict_excess_producers() {
         --_num_producers;
         ++_eviction_counter;
     }
+    evict_spilled_producers();
 }
 
 }; // namespace cluster
@@ -17,6 +17,8 @@
 
 #include <seastar/core/sharded.hh>
 
+#include <absl/container/btree_map.h>
+
 namespace cluster {
 
 class producer_state_manager
@@ -24,7 +26,8 @@ class producer_state_manager
 public:
     explicit producer_state_manager(
       config::binding<uint64_t> max_producer_ids,
-      std::chrono::milliseconds producer_expiration_ms);
+      std::chrono::milliseconds producer_expiration_ms,
+      config::binding<size_t> max_spilled_bytes);
 
     ss::future<> start();
     ss::future<> stop();
@@ -36,13 +39,40 @@ public:
     // temporary relink already accounted producer
     void link(producer_state&);
 
+    // Returns the state of a producer spilled when evicted for exceeding
+    // max_concurrent_producer_ids, forgetting it. The state is used to
+    // rehydrate the producer when it becomes active again.
+    std::optional<producer_state_snapshot>
+      take_spilled(raft::group_id, model::producer_identity);
+    // Forgets the spilled producers of a raft group, once the group resets
+    // its producers.
+    void drop_spilled(raft::group_id);
+
 private:
+    struct spill_key {
+        raft::group_id group;
+        model::producer_identity pid;
+        auto operator<=>(const spill_key&) const = default;
+    };
+    struct spilled_producer {
+        producer_state_snapshot state;
+        ss::lowres_system_clock::time_point last_update;
+        uint64_t order;
+        size_t bytes;
+    };
+    using spilled_t = absl::btree_map<spill_key, spilled_producer>;
+
     static constexpr std::chrono::seconds period{5};
     void setup_metrics();
     void evict_excess_producers();
     void do_evict_excess_producers();
 
     bool can_evict_producer(const producer_state&) const;
+    bool is_expired(const producer_state&) const;
+
+    void spill(const producer_state&);
+    spilled_t::iterator erase_spilled(spilled_t::iterator);
+    void evict_spilled_producers();
 
     size_t _num_producers = 0;
     size_t _eviction_counter = 0;
@@ -57,6 +87,14 @@ private:
     // is the responsibility of the producers themselves.
     // Check producer_state::run_func()
     intrusive_list<producer_state, &producer_state::_hook> _lru_producers;
+    // compact state of idle producers evicted while under the memory limit
+    // of max_spilled_bytes, ordered by key and by eviction order.
+    config::binding<size_t> _max_spilled_bytes;
+    spilled_t _spilled;
+    absl::btree_map<uint64_t, spill_key> _spill_order;
+    uint64_t _next_spill_order = 0;
+    size_t _spilled_bytes = 0;
+    size_t _rehydrated_counter = 0;
     ss::timer<ss::steady_clock_type> _reaper;
     ss::gate _gate;
     metrics::internal_metric_groups _metrics;
@@ -0,0 +1,81 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "cluster/reconciliation_scheduler.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/semaphore.hh>
+
+namespace cluster {
+
+ss::future<reconciliation_scheduler::units>
+reconciliation_scheduler::acquire(priority p) {
+    if (_broken) {
+        throw ss::broken_semaphore();
+    }
+    // waiters of the same or a higher priority go first
+    bool queued_ahead = false;
+    for (size_t i = 0; i <= static_cast<size_t>(p); ++i) {
+        queued_ahead |= !_waiters[i].empty();
+    }
+    if (_running < _capacity && !queued_ahead) {
+        ++_running;
+        co_return units(this);
+    }
+
+    auto& queue = _waiters[static_cast<size_t>(p)];
+    queue.push_back(waiter{.wait = _wait_latency.auto_measure()});
+    auto granted = queue.back().granted.get_future();
+    // the slot is accounted for in _running by grant_waiters()
+    co_await std::move(granted);
+    co_return units(this);
+}
+
+void reconciliation_scheduler::set_capacity(size_t capacity) {
+    _capacity = capacity;
+    grant_waiters();
+}
+
+void reconciliation_scheduler::broken() {
+    _broken = true;
+    for (auto& queue : _waiters) {
+        while (!queue.empty()) {
+            queue.front().wait->cancel();
+            queue.front().granted.set_exception(ss::broken_semaphore());
+            queue.pop_front();
+        }
+    }
+}
+
+size_t reconciliation_scheduler::waiting() const {
+    size_t ret = 0;
+    for (const auto& queue : _waiters) {
+        ret += queue.size();
+    }
+    return ret;
+}
+
+void reconciliation_scheduler::release() {
+    --_running;
+    grant_waiters();
+}
+
+void reconciliation_scheduler::grant_waiters() {
+    for (auto& queue : _waiters) {
+        while (_running < _capacity && !queue.empty()) {
+            ++_running;
+            // destroying the measurement records the time spent waiting
+            queue.front().granted.set_value();
+            queue.pop_front();
+        }
+    }
+}
+
+} // namespace cluster
@@ -0,0 +1,103 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "base/seastarx.h"
+#include "utils/log_hist.h"
+
+#include <seastar/core/chunked_fifo.hh>
+#include <seastar/core/future.hh>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace cluster {
+
+/**
+ * Limits the number of NTPs that the controller backend of a shard
+ * reconciles at the same time, like a semaphore, but grants the slots to the
+ * NTPs with a higher priority first. Within a priority the slots are granted
+ * in the order they were requested.
+ *
+ * The scheduler starts with no capacity, so that reconciliation is blocked
+ * until the backend is ready.
+ */
+class reconciliation_scheduler {
+public:
+    enum class priority : uint8_t {
+        // partitions that clients are waiting for
+        high = 0,
+        normal = 1,
+    };
+
+    using hist_t = log_hist_internal;
+
+    /// A slot to reconcile an NTP, released on destruction
+    class units {
+    public:
+        units() = default;
+        explicit units(reconciliation_scheduler* s)
+          : _scheduler(s) {}
+        units(units&& o) noexcept
+          : _scheduler(std::exchange(o._scheduler, nullptr)) {}
+        units& operator=(units&& o) noexcept {
+            if (this != &o) {
+                release();
+                _scheduler = std::exchange(o._scheduler, nullptr);
+            }
+            return *this;
+        }
+        units(const units&) = delete;
+        units& operator=(const units&) = delete;
+        ~units() { release(); }
+
+    private:
+        void release() {
+            if (_scheduler) {
+                std::exchange(_scheduler, nullptr)->release();
+            }
+        }
+
+        reconciliation_scheduler* _scheduler{nullptr};
+    };
+
+    /// Waits for a slot, throws ss::broken_semaphore after broken()
+    ss::future<units> acquire(priority);
+
+    /// Sets the number of NTPs reconciled at the same time
+    void set_capacity(size_t);
+
+    /// Fails the pending and future acquire() calls
+    void broken();
+
+    size_t running() const { return _running; }
+    size_t waiting() const;
+    const hist_t& wait_latency() const { return _wait_latency; }
+
+private:
+    struct waiter {
+        ss::promise<> granted;
+        std::unique_ptr<hist_t::measurement> wait;
+    };
+
+    void release();
+    void grant_waiters();
+
+    size_t _capacity{0};
+    size_t _running{0};
+    bool _broken{false};
+    std::array<ss::chunked_fifo<waiter>, 2> _waiters;
+    hist_t _wait_latency;
+};
+
+} // namespace cluster
@@ -25,11 +25,47 @@
 
 #include <seastar/core/coroutine.hh>
 
+#include <absl/container/flat_hash_map.h>
+
 #include <algorithm>
 
 namespace cluster {
 using namespace std::chrono_literals;
 
+namespace {
+
+ss::future<std::vector<tx_errc>> write_tx_markers_on_shard(
+  cluster::partition_manager& mgr,
+  std::vector<model::ntp> ntps,
+  model::producer_identity pid,
+  model::tx_seq tx_seq,
+  model::timeout_clock::duration timeout,
+  bool commit) {
+    std::vector<ss::future<tx_errc>> fs;
+    fs.reserve(ntps.size());
+    for (const auto& ntp : ntps) {
+        auto partition = mgr.get(ntp);
+        if (!partition) {
+            fs.push_back(
+              ss::make_ready_future<tx_errc>(tx_errc::partition_not_found));
+            continue;
+        }
+        auto stm = partition->rm_stm();
+        if (!stm) {
+            vlog(txlog.warn, "can't get tx stm of the {}' partition", ntp);
+            fs.push_back(
+              ss::make_ready_future<tx_errc>(tx_errc::stm_not_found));
+            continue;
+        }
+        fs.push_back(
+          commit ? stm->commit_tx(pid, tx_seq, timeout)
+                 : stm->abort_tx(pid, tx_seq, timeout));
+    }
+    co_return co_await ss::when_all_succeed(fs.begin(), fs.end());
+}
+
+} // namespace
+
 rm_partition_frontend::rm_partition_frontend(
   ss::smp_service_group ssg,
   ss::sharded<cluster::partition_manager>& partition_manager,
@@ -543,4 +579,170 @@ ss::future<abort_tx_reply> rm_partition_frontend::do_abort_tx(
       });
 }
 
+ss::future<std::vector<tx_errc>> rm_partition_frontend::write_tx_markers(
+  std::vector<model::ntp> ntps,
+  model::producer_identity pid,
+  model::tx_seq tx_seq,
+  model::timeout_clock::duration timeout,
+  bool commit) {
+    std::vector<tx_errc> ecs(ntps.size(), tx_errc::none);
+    // partitions of the transaction by leader, as indexes into ntps
+    absl::flat_hash_map<model::node_id, std::vector<size_t>> leaders;
+    for (size_t i = 0; i < ntps.size(); ++i) {
+        const auto& ntp = ntps[i];
+        auto nt = model::topic_namespace(ntp.ns, ntp.tp.topic);
+        if (!_metadata_cache.local().contains(nt, ntp.tp.partition)) {
+            ecs[i] = tx_errc::partition_not_exists;
+        } else if (_metadata_cache.local().is_disabled(nt, ntp.tp.partition)) {
+            ecs[i] = tx_errc::partition_disabled;
+        } else if (auto leader = _leaders.local().get_leader(ntp); !leader) {
+            vlog(txlog.warn, "can't find a leader for {} pid:{}", ntp, pid);
+            ecs[i] = tx_errc::leader_not_found;
+        } else {
+            leaders[*leader].push_back(i);
+        }
+    }
+
+    std::vector<ss::future<>> fs;
+    fs.reserve(leaders.size());
+    for (auto& entry : leaders) {
+        const auto leader = entry.first;
+        const auto& indexes = entry.second;
+        std::vector<model::ntp> leader_ntps;
+        leader_ntps.reserve(indexes.size());
+        for (auto i : indexes) {
+            leader_ntps.push_back(ntps[i]);
+        }
+        auto f = leader == _controller->self()
+                   ? tx_markers_locally(
+                     std::move(leader_ntps), pid, tx_seq, timeout, commit)
+                   : dispatch_tx_markers(
+                     leader,
+                     std::move(leader_ntps),
+                     pid,
+                     tx_seq,
+                     timeout,
+                     commit);
+        fs.push_back(std::move(f).then(
+          [&ecs, &indexes](std::vector<tx_errc> results) {
+              for (size_t i = 0; i < indexes.size(); ++i) {
+                  ecs[indexes[i]] = i < results.size() ? results[i]
+                                                       : tx_errc::timeout;
+              }
+          }));
+    }
+    co_await ss::when_all_succeed(fs.begin(), fs.end());
+    co_return ecs;
+}
+
+ss::future<std::vector<tx_errc>> rm_partition_frontend::dispatch_tx_markers(
+  model::node_id leader,
+  std::vector<model::ntp> ntps,
+  model::producer_identity pid,
+  model::tx_seq tx_seq,
+  model::timeout_clock::duration timeout,
+  bool commit) {
+    vlog(
+      txlog.trace,
+      "dispatching name:tx_markers, ntps:{}, pid:{}, tx_seq:{}, commit:{}, "
+      "to:{}",
+      ntps.size(),
+      pid,
+      tx_seq,
+      commit,
+      leader);
+    auto r = co_await _connection_cache.local()
+               .with_node_client<cluster::tx_gateway_client_protocol>(
+                 _controller->self(),
+                 ss::this_shard_id(),
+                 leader,
+                 timeout,
+                 [&ntps, pid, tx_seq, timeout, commit](
+                   tx_gateway_client_protocol cp) {
+                     return cp.tx_markers(
+                       tx_markers_request{ntps, pid, tx_seq, timeout, commit},
+                       rpc::client_opts(model::timeout_clock::now() + timeout));
+                 })
+               .then(&rpc::get_ctx_data<tx_markers_reply>);
+    if (r.has_value()) {
+        co_return std::move(r.value().ecs);
+    }
+    if (r.error() != rpc::errc::method_not_found) {
+        vlog(txlog.warn, "got error {} on remote tx markers", r.error());
+        co_return std::vector<tx_errc>(ntps.size(), tx_errc::timeout);
+    }
+
+    // the leader predates batched markers, write them one by one
+    std::vector<ss::future<tx_errc>> fs;
+    fs.reserve(ntps.size());
+    for (auto& ntp : ntps) {
+        if (commit) {
+            fs.push_back(
+              dispatch_commit_tx(leader, std::move(ntp), pid, tx_seq, timeout)
+                .then([](commit_tx_reply reply) { return reply.ec; }));
+        } else {
+            fs.push_back(
+              dispatch_abort_tx(leader, std::move(ntp), pid, tx_seq, timeout)
+                .then([](abort_tx_reply reply) { return reply.ec; }));
+        }
+    }
+    co_return co_await ss::when_all_succeed(fs.begin(), fs.end());
+}
+
+ss::future<std::vector<tx_errc>> rm_partition_frontend::tx_markers_locally(
+  std::vector<model::ntp> ntps,
+  model::producer_identity pid,
+  model::tx_seq tx_seq,
+  model::timeout_clock::duration timeout,
+  bool commit) {
+    vlog(
+      txlog.trace,
+      "processing name:tx_markers, ntps:{}, pid:{}, tx_seq:{}, commit:{}",
+      ntps.size(),
+      pid,
+      tx_seq,
+      commit);
+    std::vector<tx_errc> ecs(ntps.size(), tx_errc::none);
+    // partitions by shard, as indexes into ntps
+    absl::flat_hash_map<ss::shard_id, std::vector<size_t>> shards;
+    for (size_t i = 0; i < ntps.size(); ++i) {
+        if (!is_leader_of(ntps[i])) {
+            ecs[i] = tx_errc::leader_not_found;
+        } else if (auto shard = _shard_table.local().shard_for(ntps[i])) {
+            shards[*shard].push_back(i);
+        } else {
+            ecs[i] = tx_errc::shard_not_found;
+        }
+    }
+
+    std::vector<ss::future<>> fs;
+    fs.reserve(shards.size());
+    for (auto& entry : shards) {
+        const auto shard = entry.first;
+        const auto& indexes = entry.second;
+        std::vector<model::ntp> shard_ntps;
+        shard_ntps.reserve(indexes.size());
+        for (auto i : indexes) {
+            shard_ntps.push_back(ntps[i]);
+        }
+        fs.push_back(
+          _partition_manager
+            .invoke_on(
+              shard,
+              _ssg,
+              [ntps = std::move(shard_ntps), pid, tx_seq, timeout, commit](
+                cluster::partition_manager& mgr) mutable {
+                  return write_tx_markers_on_shard(
+                    mgr, std::move(ntps), pid, tx_seq, timeout, commit);
+              })
+            .then([&ecs, &indexes](std::vector<tx_errc> results) {
+                for (size_t i = 0; i < indexes.size(); ++i) {
+                    ecs[indexes[i]] = results[i];
+                }
+            }));
+    }
+    co_await ss::when_all_succeed(fs.begin(), fs.end());
+    co_return ecs;
+}
+
 } // namespace cluster
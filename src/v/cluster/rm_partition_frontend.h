@@ -49,6 +49,17 @@ public:
       model::producer_identity,
       model::tx_seq,
       model::timeout_clock::duration);
+    /**
+     * Writes the commit (or abort) markers of a transaction to all of its
+     * partitions, with a single request per leader node and a single hop per
+     * leader shard. The results are in the order of the partitions.
+     */
+    ss::future<std::vector<tx_errc>> write_tx_markers(
+      std::vector<model::ntp>,
+      model::producer_identity,
+      model::tx_seq,
+      model::timeout_clock::duration,
+      bool commit);
     ss::future<> stop() {
         _as.request_abort();
         return ss::make_ready_future<>();
@@ -120,6 +131,19 @@ private:
       model::producer_identity,
       model::tx_seq,
       model::timeout_clock::duration);
+    ss::future<std::vector<tx_errc>> dispatch_tx_markers(
+      model::node_id,
+      std::vector<model::ntp>,
+      model::producer_identity,
+      model::tx_seq,
+      model::timeout_clock::duration,
+      bool commit);
+    ss::future<std::vector<tx_errc>> tx_markers_locally(
+      std::vector<model::ntp>,
+      model::producer_identity,
+      model::tx_seq,
+      model::timeout_clock::duration,
+      bool commit);
 
     friend tx_gateway;
 };
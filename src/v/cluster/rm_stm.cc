@@ -24,6 +24,7 @@
 #include "raft/persisted_stm.h"
 #include "raft/state_machine_base.h"
 #include "raft/types.h"
+#include "resource_mgmt/memory_accounting.h"
 #include "ssx/future-util.h"
 #include "storage/parser_utils.h"
 #include "storage/record_batch_builder.h"
@@ -207,12 +208,14 @@ rm_stm::rm_stm(
   ss::sharded<features::feature_table>& feature_table,
   ss::sharded<producer_state_manager>& producer_state_manager)
   : raft::persisted_stm<>(rm_stm_snapshot, logger, c)
+  , _tx_root_tracker(resources::memory_accounting::local().create_tracker(
+      resources::mem_subsystem::transactions, c->ntp().path()))
   , _tx_locks(
       mt::
         map<absl::flat_hash_map, model::producer_id, ss::lw_shared_ptr<mutex>>(
-          _tx_root_tracker.create_child("tx-locks")))
-  , _log_state(_tx_root_tracker)
-  , _mem_state(_tx_root_tracker)
+          _tx_root_tracker->create_child("tx-locks")))
+  , _log_state(*_tx_root_tracker)
+  , _mem_state(*_tx_root_tracker)
   , _sync_timeout(config::shard_local_cfg().rm_sync_timeout_ms.value())
   , _tx_timeout_delay(config::shard_local_cfg().tx_timeout_delay_ms.value())
   , _abort_interval_ms(config::shard_local_cfg()
@@ -232,7 +235,7 @@ rm_stm::rm_stm(
   , _producer_state_manager(producer_state_manager)
   , _producers(
       mt::map<absl::btree_map, model::producer_identity, cluster::producer_ptr>(
-        _tx_root_tracker.create_child("producers"))) {
+        _tx_root_tracker->create_child("producers"))) {
     vassert(
       _feature_table.local().is_active(features::feature::transaction_ga),
       "unexpected state for transactions support. skipped a few "
@@ -286,13 +289,18 @@ producer_ptr rm_stm::maybe_create_producer(model::producer_identity pid) {
     if (it != _producers.end()) {
         return it->second;
     }
-    auto result = _producers.emplace(
-      pid,
-      ss::make_lw_shared<producer_state>(
-        _producer_state_manager.local(), pid, _raft->group(), [pid, this] {
-            cleanup_producer_state(pid);
-        }));
-    ;
+    auto& manager = _producer_state_manager.local();
+    auto cleanup = [pid, this] { cleanup_producer_state(pid); };
+    producer_ptr producer;
+    if (auto spilled = manager.take_spilled(_raft->group(), pid)) {
+        // the producer was evicted while idle, resume from its sequences
+        producer = ss::make_lw_shared<producer_state>(
+          manager, std::move(cleanup), std::move(*spilled));
+    } else {
+        producer = ss::make_lw_shared<producer_state>(
+          manager, pid, _raft->group(), std::move(cleanup));
+    }
+    auto result = _producers.emplace(pid, std::move(producer));
     return result.first->second;
 }
 
@@ -322,6 +330,7 @@ ss::future<> rm_stm::reset_producers() {
           return producer->shutdown_input().discard_result();
       });
     _producers.clear();
+    _producer_state_manager.local().drop_spilled(_raft->group());
 }
 
 ss::future<checked<model::term_id, tx_errc>> rm_stm::begin_tx(
@@ -1361,7 +1370,7 @@ ss::future<bool> rm_stm::sync(model::timeout_clock::duration timeout) {
     auto ready = co_await persisted_stm::sync(timeout);
     if (ready) {
         if (_mem_state.term != _insync_term) {
-            _mem_state = mem_state{_tx_root_tracker};
+            _mem_state = mem_state{*_tx_root_tracker};
             _mem_state.term = _insync_term;
         }
     }
@@ -2247,7 +2256,7 @@ ss::future<> rm_stm::apply_raft_snapshot(const iobuf&) {
       "Resetting all state, reason: log eviction, offset: {}",
       _raft->start_offset());
     _log_state.reset();
-    _mem_state = mem_state{_tx_root_tracker};
+    _mem_state = mem_state{*_tx_root_tracker};
     co_await reset_producers();
     set_next(_raft->start_offset());
     co_return;
@@ -2316,7 +2325,7 @@ void rm_stm::setup_metrics() {
           labels),
         sm::make_gauge(
           "tx_mem_tracker_consumption_bytes",
-          [this] { return _tx_root_tracker.consumption(); },
+          [this] { return _tx_root_tracker->consumption(); },
           sm::description("Total memory bytes in use by tx subsystem."),
           labels),
       },
@@ -2330,9 +2339,9 @@ ss::future<> rm_stm::maybe_log_tx_stats() {
     }
     _ctx_log.debug(
       "tx root mem_tracker aggregate consumption: {}",
-      human::bytes(static_cast<double>(_tx_root_tracker.consumption())));
+      human::bytes(static_cast<double>(_tx_root_tracker->consumption())));
     _ctx_log.debug(
-      "tx mem tracker breakdown: {}", _tx_root_tracker.pretty_print_json());
+      "tx mem tracker breakdown: {}", _tx_root_tracker->pretty_print_json());
     auto units = co_await _state_lock.hold_read_lock();
     _ctx_log.debug(
       "tx memory snapshot stats: {{mem_state: {}, log_state: "
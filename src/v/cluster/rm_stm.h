@@ -397,7 +397,7 @@ private:
      */
     ss::future<model::offset> bootstrap_committed_offset();
 
-    util::mem_tracker _tx_root_tracker{"tx-mem-root"};
+    ss::shared_ptr<util::mem_tracker> _tx_root_tracker;
     // The state of this state machine maybe change via two paths
     //
     //   - by reading the already replicated commands from raft and
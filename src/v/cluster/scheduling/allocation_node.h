@@ -125,6 +125,9 @@ public:
         return _allocated_partitions == allocation_capacity{0};
     }
     bool is_full(const model::ntp&) const;
+    // true if the replicas of the ntp are allocated regardless of the
+    // capacity of the node
+    bool is_capacity_exempt(const model::ntp&) const;
     ss::shard_id allocate(partition_allocation_domain);
 
 private:
@@ -0,0 +1,178 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "cluster/scheduling/allocation_node_columns.h"
+
+#include "cluster/errc.h"
+#include "cluster/members_table.h"
+#include "random/generators.h"
+
+namespace cluster {
+
+allocation_node_columns::allocation_node_columns(
+  const allocation_state& state,
+  partition_allocation_domain domain,
+  const members_table* members)
+  : _state(state)
+  , _domain(domain)
+  , _members(members)
+  , _version(state.version()) {
+    rebuild();
+}
+
+void allocation_node_columns::rebuild() {
+    const auto& nodes = _state.allocation_nodes();
+    _version = _state.version();
+
+    _ids.clear();
+    _max_capacity.clear();
+    _allocated.clear();
+    _final.clear();
+    _active.clear();
+    _rack.clear();
+    _index.clear();
+    _rack_index.clear();
+
+    _ids.reserve(nodes.size());
+    _max_capacity.resize(nodes.size());
+    _allocated.resize(nodes.size());
+    _final.resize(nodes.size());
+    _active.resize(nodes.size());
+    _rack.resize(nodes.size(), no_rack);
+
+    // allocation nodes are ordered by id, so are the columns
+    for (const auto& [id, node] : nodes) {
+        const size_t idx = _ids.size();
+        _ids.push_back(id);
+        _index.emplace(id, idx);
+        read_node(idx, *node);
+        if (_members) {
+            if (auto rack = _members->get_node_rack_id(id); rack) {
+                auto [it, _] = _rack_index.try_emplace(
+                  *rack, static_cast<int32_t>(_rack_index.size()));
+                _rack[idx] = it->second;
+            }
+        }
+    }
+    _excluded.assign(_ids.size(), 0);
+    _rack_frequency.assign(_rack_index.size(), 0);
+}
+
+void allocation_node_columns::read_node(
+  size_t idx, const allocation_node& node) {
+    _max_capacity[idx] = node.max_capacity();
+    _allocated[idx] = node.allocated_partitions();
+    _final[idx] = _domain == partition_allocation_domains::common
+                    ? node.final_partitions()
+                    : node.domain_final_partitions(_domain);
+    _active[idx] = node.is_active();
+}
+
+void allocation_node_columns::refresh(model::node_id id) {
+    // a single allocation since the last update, otherwise the columns are
+    // rebuilt on the next choice
+    if (_state.version() != _version + 1) {
+        return;
+    }
+    auto idx_it = _index.find(id);
+    auto node_it = _state.allocation_nodes().find(id);
+    if (
+      idx_it == _index.end() || node_it == _state.allocation_nodes().end()) {
+        return;
+    }
+    read_node(idx_it->second, *node_it->second);
+    _version = _state.version();
+}
+
+uint64_t allocation_node_columns::capacity_score(size_t idx) const {
+    // mirrors max_final_capacity(), 0 for fully allocated node and max_score
+    // for the node with maximum capacity available
+    const uint64_t max_capacity = _max_capacity[idx];
+    if (max_capacity == 0) {
+        return 0;
+    }
+    const uint64_t final_capacity = max_capacity
+                                    - std::min<uint64_t>(
+                                      max_capacity, _final[idx]);
+    return (soft_constraint::max_score * final_capacity) / max_capacity;
+}
+
+result<model::node_id> allocation_node_columns::choose_node(
+  const model::ntp& ntp, const std::vector<model::broker_shard>& replicas) {
+    if (_state.version() != _version) {
+        rebuild();
+    }
+    if (_ids.empty()) {
+        return errc::no_eligible_allocation_nodes;
+    }
+
+    // capacity exemption only depends on the ntp and the cluster config
+    const bool capacity_exempt
+      = _state.allocation_nodes().begin()->second->is_capacity_exempt(ntp);
+
+    for (const auto& r : replicas) {
+        if (auto it = _index.find(r.node_id); it != _index.end()) {
+            _excluded[it->second] = 1;
+            if (_rack[it->second] != no_rack) {
+                ++_rack_frequency[_rack[it->second]];
+            }
+        } else if (_members) {
+            // replica on a node unknown to the allocator still counts
+            if (auto rack = _members->get_node_rack_id(r.node_id); rack) {
+                if (auto rit = _rack_index.find(*rack);
+                    rit != _rack_index.end()) {
+                    ++_rack_frequency[rit->second];
+                }
+            }
+        }
+    }
+
+    const uint64_t constraints_count = _members ? 2 : 1;
+    uint64_t best_score = 0;
+    _best_fits.clear();
+    for (size_t i = 0; i < _ids.size(); ++i) {
+        if (
+          _excluded[i] || !_active[i]
+          || (!capacity_exempt && _allocated[i] >= _max_capacity[i])) {
+            continue;
+        }
+
+        uint64_t score = capacity_score(i);
+        if (_members && _rack[i] != no_rack) {
+            score += soft_constraint::max_score
+                     / (_rack_frequency[_rack[i]] + 1);
+        }
+        // normalized the same way as the soft constraints level
+        score = static_cast<uint32_t>(score) / constraints_count;
+
+        if (score >= best_score) {
+            if (score > best_score) {
+                best_score = score;
+                _best_fits.clear();
+            }
+            _best_fits.push_back(_ids[i]);
+        }
+    }
+
+    for (const auto& r : replicas) {
+        if (auto it = _index.find(r.node_id); it != _index.end()) {
+            _excluded[it->second] = 0;
+        }
+    }
+    std::fill(_rack_frequency.begin(), _rack_frequency.end(), 0);
+
+    if (_best_fits.empty()) {
+        return errc::no_eligible_allocation_nodes;
+    }
+    return random_generators::random_choice(_best_fits);
+}
+
+} // namespace cluster
@@ -0,0 +1,85 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "base/outcome.h"
+#include "cluster/scheduling/allocation_state.h"
+#include "cluster/scheduling/types.h"
+#include "model/fundamental.h"
+#include "model/metadata.h"
+
+#include <absl/container/flat_hash_map.h>
+
+#include <vector>
+
+namespace cluster {
+
+class members_table;
+
+/**
+ * A columnar copy of the allocation nodes used to allocate a batch of
+ * partitions with the default allocation constraints, i.e. distinct nodes,
+ * not fully allocated and active nodes, the least allocated node and,
+ * optionally, distinct racks.
+ *
+ * Instead of building type erased evaluators for every replica and looking
+ * up every node in the allocation state, the candidates are scored in a single
+ * pass over flat vectors of node properties. The choice is the same as the one
+ * of the default constraints, ties are broken randomly.
+ *
+ * The columns follow the allocation state version: a replica allocated in
+ * the meantime is applied with refresh(), any other change of the state
+ * rebuilds the columns on the next choose_node().
+ */
+class allocation_node_columns {
+public:
+    /// members are used to look up the node racks, nullptr if rack awareness
+    /// is disabled
+    allocation_node_columns(
+      const allocation_state&,
+      partition_allocation_domain,
+      const members_table* members);
+
+    result<model::node_id> choose_node(
+      const model::ntp&, const std::vector<model::broker_shard>& replicas);
+
+    /// Updates the columns of the node after allocating a replica on it
+    void refresh(model::node_id);
+
+private:
+    static constexpr int32_t no_rack = -1;
+
+    void rebuild();
+    void read_node(size_t idx, const allocation_node&);
+    uint64_t capacity_score(size_t idx) const;
+
+    const allocation_state& _state;
+    partition_allocation_domain _domain;
+    const members_table* _members;
+    uint64_t _version;
+
+    std::vector<model::node_id> _ids;
+    std::vector<uint32_t> _max_capacity;
+    std::vector<uint32_t> _allocated;
+    std::vector<uint32_t> _final;
+    std::vector<uint8_t> _active;
+    std::vector<int32_t> _rack;
+    absl::flat_hash_map<model::node_id, size_t> _index;
+    absl::flat_hash_map<model::rack_id, int32_t> _rack_index;
+
+    // scratch space reused across calls
+    std::vector<uint8_t> _excluded;
+    std::vector<uint32_t> _rack_frequency;
+    std::vector<model::node_id> _best_fits;
+};
+
+} // namespace cluster
@@ -47,12 +47,14 @@ bool allocation_state::validate_shard(
 raft::group_id allocation_state::next_group_id() { return ++_highest_group; }
 
 void allocation_state::register_node(allocation_state::node_ptr n) {
+    ++_version;
     const auto id = n->_id;
     _nodes.emplace(id, std::move(n));
 }
 
 void allocation_state::register_node(
   const model::broker& broker, allocation_node::state state) {
+    ++_version;
     auto node = std::make_unique<allocation_node>(
       broker.id(),
       broker.properties().cores,
@@ -71,6 +73,7 @@ void allocation_state::register_node(
 void allocation_state::update_allocation_nodes(
   const std::vector<model::broker>& brokers) {
     verify_shard();
+    ++_version;
     // deletions
     for (auto& [id, node] : _nodes) {
         auto it = std::find_if(
@@ -105,6 +108,7 @@ void allocation_state::update_allocation_nodes(
 }
 
 void allocation_state::upsert_allocation_node(const model::broker& broker) {
+    ++_version;
     auto it = _nodes.find(broker.id());
 
     if (it == _nodes.end()) {
@@ -126,6 +130,7 @@ void allocation_state::upsert_allocation_node(const model::broker& broker) {
 }
 
 void allocation_state::remove_allocation_node(model::node_id id) {
+    ++_version;
     auto it = std::find_if(
       _nodes.begin(), _nodes.end(), [id](const auto& node) {
           return node.first == id;
@@ -136,6 +141,7 @@ void allocation_state::remove_allocation_node(model::node_id id) {
 
 void allocation_state::decommission_node(model::node_id id) {
     verify_shard();
+    ++_version;
     auto it = _nodes.find(id);
     if (it == _nodes.end()) {
         throw std::invalid_argument(
@@ -147,6 +153,7 @@ void allocation_state::decommission_node(model::node_id id) {
 
 void allocation_state::recommission_node(model::node_id id) {
     verify_shard();
+    ++_version;
     auto it = _nodes.find(id);
     if (it == _nodes.end()) {
         throw std::invalid_argument(
@@ -169,6 +176,7 @@ void allocation_state::add_allocation(
   const model::broker_shard& replica,
   const partition_allocation_domain domain) {
     verify_shard();
+    ++_version;
     if (auto it = _nodes.find(replica.node_id); it != _nodes.end()) {
         it->second->allocate_on(replica.shard, domain);
     }
@@ -178,6 +186,7 @@ void allocation_state::remove_allocation(
   const model::broker_shard& replica,
   const partition_allocation_domain domain) {
     verify_shard();
+    ++_version;
     if (auto it = _nodes.find(replica.node_id); it != _nodes.end()) {
         it->second->deallocate_on(replica.shard, domain);
     }
@@ -186,6 +195,7 @@ void allocation_state::remove_allocation(
 uint32_t allocation_state::allocate(
   model::node_id id, const partition_allocation_domain domain) {
     verify_shard();
+    ++_version;
     auto it = _nodes.find(id);
     vassert(
       it != _nodes.end(), "allocated node with id {} have to be present", id);
@@ -196,6 +206,7 @@ void allocation_state::add_final_count(
   const model::broker_shard& replica,
   const partition_allocation_domain domain) {
     verify_shard();
+    ++_version;
     if (auto it = _nodes.find(replica.node_id); it != _nodes.end()) {
         ++it->second->_final_partitions;
         ++it->second->_final_domain_partitions[domain];
@@ -206,6 +217,7 @@ void allocation_state::remove_final_count(
   const model::broker_shard& replica,
   const partition_allocation_domain domain) {
     verify_shard();
+    ++_version;
     if (auto it = _nodes.find(replica.node_id); it != _nodes.end()) {
         --it->second->_final_partitions;
         --it->second->_final_domain_partitions[domain];
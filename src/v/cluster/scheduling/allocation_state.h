@@ -70,6 +70,9 @@ public:
 
     bool validate_shard(model::node_id node, uint32_t shard) const;
 
+    // Incremented on every change of the nodes or of their allocations
+    uint64_t version() const { return _version; }
+
     // Raft group id
     raft::group_id next_group_id();
     raft::group_id last_group_id() const { return _highest_group; }
@@ -90,6 +93,7 @@ private:
 
     raft::group_id _highest_group{0};
     underlying_t _nodes;
+    uint64_t _version{0};
     expression_in_debug_mode(oncore _verify_shard;)
 };
 } // namespace cluster
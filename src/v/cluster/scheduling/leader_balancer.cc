@@ -18,6 +18,7 @@
 #include "cluster/members_table.h"
 #include "cluster/partition_leaders_table.h"
 #include "cluster/scheduling/leader_balancer_greedy.h"
+#include "cluster/scheduling/leader_balancer_heap.h"
 #include "cluster/scheduling/leader_balancer_random.h"
 #include "cluster/scheduling/leader_balancer_strategy.h"
 #include "cluster/scheduling/leader_balancer_types.h"
@@ -429,6 +430,11 @@ ss::future<ss::stop_iteration> leader_balancer::balance() {
         strategy = std::make_unique<greedy_balanced_shards>(
           std::move(index), muted_nodes());
         break;
+    case model::leader_balancer_mode::heap_balanced_shards:
+        vlog(clusterlog.debug, "using heap_balanced_shards");
+        strategy = std::make_unique<heap_balanced_shards>(
+          std::move(index), muted_nodes());
+        break;
     default:
         vlog(clusterlog.error, "unexpected mode value: {}", mode);
         co_return ss::stop_iteration::no;
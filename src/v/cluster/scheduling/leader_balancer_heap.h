@@ -0,0 +1,190 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "base/vassert.h"
+#include "cluster/scheduling/leader_balancer_strategy.h"
+#include "cluster/scheduling/leader_balancer_types.h"
+#include "model/metadata.h"
+
+#include <absl/container/btree_set.h>
+#include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
+
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
+
+/*
+ * Moves leaders from the most loaded core to the least loaded core, like
+ * greedy_balanced_shards, but without rebuilding and sorting the load of all
+ * cores on every step.
+ *
+ * The leader counts of the cores are kept ordered by load and updated in
+ * O(log n) when a movement is applied. A movement is searched for on the
+ * cores in descending order of load, and the search on a core stops at the
+ * first group that can be moved to one of the least loaded cores. After a
+ * rolling restart most groups of the most loaded core have such a replica, so
+ * a step usually costs a few lookups instead of a scan of all groups.
+ */
+namespace cluster {
+
+class heap_balanced_shards final : public leader_balancer_strategy {
+public:
+    heap_balanced_shards(
+      index_type cores, absl::flat_hash_set<model::node_id> muted_nodes)
+      : _index(std::move(cores))
+      , _muted_nodes(std::move(muted_nodes)) {
+        size_t num_groups = 0;
+        for (const auto& [shard, groups] : _index) {
+            _load.emplace(shard, groups.size());
+            _by_load.emplace(groups.size(), shard);
+            num_groups += groups.size();
+        }
+        _target_load = _index.empty() ? 0.0
+                                      : static_cast<double>(num_groups)
+                                          / static_cast<double>(_index.size());
+        for (const auto& [shard, load] : _load) {
+            _error += pow(static_cast<double>(load) - _target_load, 2);
+        }
+    }
+
+    double error() const final { return _error; }
+
+    /*
+     * Muted nodes are treated as if they have no available capacity: leaders
+     * are not moved to them, and leaders on them are not touched in case the
+     * mute is temporary.
+     */
+    std::optional<reassignment>
+    find_movement(const leader_balancer_types::muted_groups_t& skip) final {
+        for (auto from_it = _by_load.rbegin(); from_it != _by_load.rend();
+             ++from_it) {
+            const auto& [from_load, from] = *from_it;
+            if (_muted_nodes.contains(from.node_id)) {
+                continue;
+            }
+            const size_t min_load = lowest_unmuted_load();
+            if (from_load < min_load + 2) {
+                // Moving a leader from this or any less loaded core doesn't
+                // reduce the error.
+                return std::nullopt;
+            }
+
+            auto best = find_movement_from(from, from_load, min_load, skip);
+            if (best) {
+                return best;
+            }
+        }
+        return std::nullopt;
+    }
+
+    void apply_movement(const reassignment& r) final {
+        auto replicas = std::move(_index[r.from][r.group]);
+        _index[r.from].erase(r.group);
+        _index[r.to].try_emplace(r.group, std::move(replicas));
+
+        auto from_load = update_load(r.from, -1);
+        auto to_load = update_load(r.to, 1);
+        _error -= pow(static_cast<double>(from_load + 1) - _target_load, 2);
+        _error -= pow(static_cast<double>(to_load - 1) - _target_load, 2);
+        _error += pow(static_cast<double>(from_load) - _target_load, 2);
+        _error += pow(static_cast<double>(to_load) - _target_load, 2);
+    }
+
+    std::vector<shard_load> stats() const final {
+        std::vector<shard_load> ret;
+        ret.reserve(_by_load.size());
+        for (const auto& [load, shard] : _by_load) {
+            ret.push_back({shard, load});
+        }
+        return ret;
+    }
+
+private:
+    /*
+     * Find the movement of a group led by `from` to its least loaded replica.
+     * Returns as soon as a replica on a core with `min_load` is found, since
+     * no movement from `from` can do better.
+     */
+    std::optional<reassignment> find_movement_from(
+      const model::broker_shard& from,
+      size_t from_load,
+      size_t min_load,
+      const leader_balancer_types::muted_groups_t& skip) const {
+        auto groups_it = _index.find(from);
+        if (groups_it == _index.end()) {
+            return std::nullopt;
+        }
+
+        size_t best_load = std::numeric_limits<size_t>::max();
+        std::optional<reassignment> best;
+        for (const auto& [group, replicas] : groups_it->second) {
+            if (skip.contains(static_cast<uint64_t>(group))) {
+                continue;
+            }
+            for (const auto& to : replicas) {
+                if (to == from || _muted_nodes.contains(to.node_id)) {
+                    continue;
+                }
+                auto load_it = _load.find(to);
+                if (load_it == _load.end()) {
+                    continue;
+                }
+                if (load_it->second < best_load) {
+                    best_load = load_it->second;
+                    best = reassignment(group, from, to);
+                    if (best_load == min_load) {
+                        return best;
+                    }
+                }
+            }
+        }
+
+        if (best_load + 2 <= from_load) {
+            return best;
+        }
+        return std::nullopt;
+    }
+
+    size_t lowest_unmuted_load() const {
+        for (const auto& [load, shard] : _by_load) {
+            if (!_muted_nodes.contains(shard.node_id)) {
+                return load;
+            }
+        }
+        return 0;
+    }
+
+    /// Returns the new load of the shard
+    size_t update_load(const model::broker_shard& shard, int delta) {
+        auto& load = _load[shard];
+        _by_load.erase({load, shard});
+        vassert(
+          delta >= 0 || load > 0, "Negative leader count for shard {}", shard);
+        load = delta >= 0 ? load + 1 : load - 1;
+        _by_load.emplace(load, shard);
+        return load;
+    }
+
+    index_type _index;
+    absl::flat_hash_set<model::node_id> _muted_nodes;
+    absl::flat_hash_map<model::broker_shard, size_t> _load;
+    // (load, shard) pairs ordered by load, used as an indexed heap of both
+    // the most and the least loaded cores.
+    absl::btree_set<std::pair<size_t, model::broker_shard>> _by_load;
+    double _target_load{0};
+    double _error{0};
+};
+
+} // namespace cluster
@@ -81,7 +81,8 @@ allocation_constraints partition_allocator::default_constraints(
 result<allocated_partition> partition_allocator::allocate_new_partition(
   model::topic_namespace nt,
   partition_constraints p_constraints,
-  const partition_allocation_domain domain) {
+  const partition_allocation_domain domain,
+  allocation_node_columns* columns) {
     vlog(
       clusterlog.trace,
       "allocating new partition with constraints: {}",
@@ -94,12 +95,23 @@ result<allocated_partition> partition_allocator::allocate_new_partition(
         return errc::topic_invalid_replication_factor;
     }
 
-    auto effective_constraints = default_constraints(domain);
-    effective_constraints.add(p_constraints.constraints);
-
     model::ntp ntp{
       std::move(nt.ns), std::move(nt.tp), p_constraints.partition_id};
     allocated_partition ret{std::move(ntp), {}, domain, *_state};
+    if (columns) {
+        for (auto r = 0; r < replicas_to_allocate; ++r) {
+            auto node = columns->choose_node(ret._ntp, ret._replicas);
+            if (!node) {
+                return node.error();
+            }
+            ret.add_replica(node.value(), std::nullopt);
+            columns->refresh(node.value());
+        }
+        return ret;
+    }
+
+    auto effective_constraints = default_constraints(domain);
+    effective_constraints.add(p_constraints.constraints);
     for (auto r = 0; r < replicas_to_allocate; ++r) {
         auto replica = do_allocate_replica(
           ret, std::nullopt, effective_constraints);
@@ -281,11 +293,32 @@ partition_allocator::allocate(allocation_request request) {
     intermediate_allocation assignments(
       *_state, request.partitions.size(), request.domain);
 
+    // Partitions without additional constraints are placed with the default
+    // ones, the columns evaluate them for the whole batch without the
+    // per-replica evaluators.
+    std::optional<allocation_node_columns> columns;
+    const bool default_only = std::all_of(
+      request.partitions.begin(),
+      request.partitions.end(),
+      [](const partition_constraints& p) {
+          return p.constraints.hard_constraints.empty()
+                 && p.constraints.soft_constraints.empty();
+      });
+    if (default_only) {
+        columns.emplace(
+          *_state,
+          request.domain,
+          _enable_rack_awareness() ? &_members.local() : nullptr);
+    }
+
     const auto& nt = request._nt;
     for (auto& p_constraints : request.partitions) {
         auto const partition_id = p_constraints.partition_id;
         auto allocated = allocate_new_partition(
-          nt, std::move(p_constraints), request.domain);
+          nt,
+          std::move(p_constraints),
+          request.domain,
+          columns ? &*columns : nullptr);
         if (!allocated) {
             co_return allocated.error();
         }
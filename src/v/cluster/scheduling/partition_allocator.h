@@ -14,6 +14,7 @@
 #include "base/vlog.h"
 #include "cluster/logger.h"
 #include "cluster/scheduling/allocation_node.h"
+#include "cluster/scheduling/allocation_node_columns.h"
 #include "cluster/scheduling/allocation_state.h"
 #include "cluster/scheduling/allocation_strategy.h"
 #include "cluster/scheduling/types.h"
@@ -180,10 +181,13 @@ private:
     std::error_code
     check_cluster_limits(allocation_request const& request) const;
 
+    /// columns, if set, are used to choose the replica nodes instead of the
+    /// default constraints
     result<allocated_partition> allocate_new_partition(
       model::topic_namespace nt,
       partition_constraints,
-      partition_allocation_domain);
+      partition_allocation_domain,
+      allocation_node_columns* columns = nullptr);
 
     result<reallocation_step> do_allocate_replica(
       allocated_partition&,
@@ -39,6 +39,10 @@ void diskcheck::validate_options(const diskcheck_opts& opts) {
         throw diskcheck_option_out_of_range(
           "IO Queue depth (parallelism) out of range, min is 1, max 256");
     }
+    if (opts.mixed_read_percent && *opts.mixed_read_percent > 100) {
+        throw diskcheck_option_out_of_range(
+          "Mixed read percentage out of range, max is 100");
+    }
 }
 
 diskcheck::diskcheck(ss::sharded<node::local_monitor>& nlm)
@@ -80,21 +84,35 @@ ss::future<std::vector<self_test_result>> diskcheck::run(diskcheck_opts opts) {
         co_return std::vector<self_test_result>();
     }
     auto g = _gate.hold();
+    co_await prepare(opts);
+    co_return co_await run_prepared(std::move(opts));
+}
+
+ss::future<> diskcheck::prepare(const diskcheck_opts& opts) {
     co_await ss::futurize_invoke(validate_options, opts);
     co_await verify_remaining_space(opts.data_size);
+    if (std::filesystem::exists(opts.dir)) {
+        /// Ensure no leftover large files in the event there was a
+        /// crash mid run and cleanup didn't get a chance to occur
+        std::filesystem::remove_all(opts.dir);
+    }
+    std::filesystem::create_directory(opts.dir);
+}
+
+ss::future<std::vector<self_test_result>>
+diskcheck::run_prepared(diskcheck_opts opts) {
+    if (_gate.is_closed()) {
+        vlog(clusterlog.debug, "diskcheck - gate already closed");
+        co_return std::vector<self_test_result>();
+    }
+    auto g = _gate.hold();
     vlog(
       clusterlog.info,
       "Starting redpanda self-test disk benchmark, with options: {}",
       opts);
     _cancelled = false;
-    _opts = opts;
+    _opts = std::move(opts);
     _last_pos = 0;
-    if (std::filesystem::exists(_opts.dir)) {
-        /// Ensure no leftover large files in the event there was a
-        /// crash mid run and cleanup didn't get a chance to occur
-        std::filesystem::remove_all(_opts.dir);
-    }
-    std::filesystem::create_directory(_opts.dir);
     const auto fname = ssx::sformat(
       "{}/rp-self-test-{}-{}",
       _opts.dir.string(),
@@ -138,29 +156,36 @@ diskcheck::initialize_benchmark(ss::sstring fname) {
     co_return std::vector<self_test_result>{};
 }
 
-ss::future<std::vector<self_test_result>>
-diskcheck::run_configured_benchmarks(ss::file& file) {
-    std::vector<self_test_result> r;
-    auto write_metrics = co_await do_run_benchmark<read_or_write::write>(file);
-    auto result = write_metrics.to_st_result();
+self_test_result
+diskcheck::make_result(const metrics& m, std::string_view info) const {
+    auto result = m.to_st_result();
     result.name = _opts.name;
-    result.info = "write run";
+    result.info = _opts.all_shards
+                    ? ssx::sformat("{} (shard {})", info, ss::this_shard_id())
+                    : ss::sstring(info);
     result.test_type = "disk";
     if (_cancelled) {
         result.warning = "Run was manually cancelled";
     }
-    r.push_back(std::move(result));
+    return result;
+}
+
+ss::future<std::vector<self_test_result>>
+diskcheck::run_configured_benchmarks(ss::file& file) {
+    std::vector<self_test_result> r;
+    auto write_metrics = co_await do_run_benchmark<read_or_write::write>(file);
+    r.push_back(make_result(write_metrics, "write run"));
     if (!_opts.skip_read) {
         auto read_metrics = co_await do_run_benchmark<read_or_write::read>(
           file);
-        auto result = read_metrics.to_st_result();
-        result.name = _opts.name;
-        result.info = "read run";
-        result.test_type = "disk";
-        if (_cancelled) {
-            result.warning = "Run was manually cancelled";
-        }
-        r.push_back(std::move(result));
+        r.push_back(make_result(read_metrics, "read run"));
+    }
+    if (_opts.mixed_read_percent) {
+        auto mixed_metrics = co_await do_run_benchmark<read_or_write::mixed>(
+          file);
+        r.push_back(make_result(
+          mixed_metrics,
+          ssx::sformat("mixed run ({}% reads)", *_opts.mixed_read_percent)));
     }
     co_return r;
 }
@@ -203,16 +228,39 @@ ss::future<> diskcheck::run_benchmark_fiber(
         iov.push_back(iovec{buf.get(), len});
     }
 
+    /// Writes since the last flush of this fiber
+    uint32_t unflushed = 0;
+    auto write = [this, &iov, &file, &unflushed] {
+        auto f = file.dma_write(get_pos(), iov, &_intent);
+        if (
+          _opts.fdatasync_interval == 0
+          || ++unflushed < _opts.fdatasync_interval) {
+            return f;
+        }
+        /// Like the segment appender, the flush is part of the latency of
+        /// the write that triggers it
+        unflushed = 0;
+        return f.then(
+          [&file](size_t n) { return file.flush().then([n] { return n; }); });
+    };
+
     auto stop = start + _opts.duration;
     while (stop > ss::lowres_clock::now() && !_cancelled) {
         if (unlikely(_as.abort_requested())) {
             throw diskcheck_aborted_exception();
         }
-        co_await m.measure([this, &iov, &file] {
+        co_await m.measure([&] {
             if constexpr (mode == read_or_write::write) {
-                return file.dma_write(get_pos(), iov, &_intent);
-            } else {
+                return write();
+            } else if constexpr (mode == read_or_write::read) {
                 return file.dma_read(get_pos(), iov, &_intent);
+            } else {
+                if (
+                  random_generators::get_int<uint16_t>(0, 99)
+                  < *_opts.mixed_read_percent) {
+                    return file.dma_read(get_pos(), iov, &_intent);
+                }
+                return write();
             }
         });
     }
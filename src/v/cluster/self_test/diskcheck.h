@@ -85,6 +85,15 @@ public:
     /// will run for at least the total run time desired.
     ss::future<std::vector<self_test_result>> run(diskcheck_opts);
 
+    /// Validates the options and prepares the benchmark directory
+    ///
+    /// To run the benchmark on many shards at once, prepare once and then
+    /// call \run_prepared on every shard
+    ss::future<> prepare(const diskcheck_opts&);
+
+    /// Run the benchmark within a directory already prepared by \prepare
+    ss::future<std::vector<self_test_result>> run_prepared(diskcheck_opts);
+
     /// Signal to stop all work as soon as possible
     ///
     /// Immediately returns, waiter can expect to wait on the results to be
@@ -92,7 +101,7 @@ public:
     void cancel();
 
 private:
-    enum class read_or_write { read, write };
+    enum class read_or_write { read, write, mixed };
 
     ss::future<std::vector<self_test_result>> initialize_benchmark(ss::sstring);
     ss::future<std::vector<self_test_result>>
@@ -109,6 +118,8 @@ private:
 
     uint64_t get_pos();
 
+    self_test_result make_result(const metrics&, std::string_view info) const;
+
 private:
     /// To ensure test doesn't attempt to take all available disk space
     ss::sharded<node::local_monitor>& _nlm;
@@ -68,6 +68,18 @@ public:
 
     size_t get_number_of_timeouts() const { return _number_of_timeouts; }
 
+    std::vector<self_test_latency_bucket> latency_histogram() const {
+        auto hist = _hist.seastar_histogram_logform();
+        std::vector<self_test_latency_bucket> buckets;
+        buckets.reserve(hist.buckets.size());
+        for (const auto& b : hist.buckets) {
+            buckets.push_back(self_test_latency_bucket{
+              .upper_bound = static_cast<uint64_t>(b.upper_bound),
+              .count = b.count});
+        }
+        return buckets;
+    }
+
     self_test_result to_st_result() const {
         return self_test_result{
           .p50 = (double)_hist.get_value_at(50.0),
@@ -79,7 +91,8 @@ public:
           .bps = throughput_bytes_sec(),
           .timeouts = (uint32_t)_number_of_timeouts,
           .duration = std::chrono::duration_cast<std::chrono::milliseconds>(
-            _total_time)};
+            _total_time),
+          .latency_histogram = latency_histogram()};
     }
 
 private:
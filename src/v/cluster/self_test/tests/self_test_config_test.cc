@@ -43,6 +43,14 @@ BOOST_AUTO_TEST_CASE(test_diskcheck_validation) {
         cluster::diskcheck_opts{.parallelism = 266}),
       cft::diskcheck_option_out_of_range);
 
+    BOOST_CHECK_THROW(
+      cft::diskcheck::validate_options(
+        cluster::diskcheck_opts{.mixed_read_percent = 101}),
+      cft::diskcheck_option_out_of_range);
+    BOOST_CHECK_NO_THROW(
+      cft::diskcheck::validate_options(cluster::diskcheck_opts{
+        .fdatasync_interval = 8, .mixed_read_percent = 70}));
+
     BOOST_CHECK_NO_THROW(
       cft::diskcheck::validate_options(cluster::diskcheck_opts{
         .skip_write = true,
@@ -31,11 +31,12 @@ self_test_backend::self_test_backend(
   ss::scheduling_group sg)
   : _self(self)
   , _st_sg(sg)
-  , _disk_test(nlm)
+  , _nlm(nlm)
   , _network_test(self, connections) {}
 
 ss::future<> self_test_backend::start() {
-    co_await _disk_test.start();
+    co_await _disk_test.start(std::ref(_nlm));
+    co_await _disk_test.invoke_on_all(&self_test::diskcheck::start);
     co_await _network_test.start();
 }
 
@@ -47,6 +48,23 @@ ss::future<> self_test_backend::stop() {
     co_await std::move(f);
 }
 
+ss::future<std::vector<self_test_result>>
+self_test_backend::run_disk_test(diskcheck_opts dto) {
+    if (!dto.all_shards) {
+        co_return co_await _disk_test.local().run(std::move(dto));
+    }
+    /// Every shard writes its own file within the same directory, the way
+    /// partitions spread appends across shards
+    co_await _disk_test.local().prepare(dto);
+    co_return co_await _disk_test.map_reduce0(
+      [dto](self_test::diskcheck& dc) { return dc.run_prepared(dto); },
+      std::vector<self_test_result>{},
+      [](std::vector<self_test_result> acc, std::vector<self_test_result> r) {
+          std::move(r.begin(), r.end(), std::back_inserter(acc));
+          return acc;
+      });
+}
+
 ss::future<std::vector<self_test_result>> self_test_backend::do_start_test(
   std::vector<diskcheck_opts> dtos, std::vector<netcheck_opts> ntos) {
     auto gate_holder = _gate.hold();
@@ -55,8 +73,7 @@ ss::future<std::vector<self_test_result>> self_test_backend::do_start_test(
         try {
             dto.sg = _st_sg;
             if (!_cancelling) {
-                auto dtr = co_await _disk_test.run(dto).then(
-                  [](auto result) { return result; });
+                auto dtr = co_await run_disk_test(dto);
                 std::copy(dtr.begin(), dtr.end(), std::back_inserter(results));
             } else {
                 results.push_back(self_test_result{
@@ -146,7 +163,7 @@ get_status_response self_test_backend::start_test(start_test_request req) {
 ss::future<get_status_response> self_test_backend::stop_test() {
     auto gate_holder = _gate.hold();
     _cancelling = true;
-    _disk_test.cancel();
+    co_await _disk_test.invoke_on_all(&self_test::diskcheck::cancel);
     _network_test.cancel();
     try {
         /// When lock is released, the 'then' block above will set the _prev_run
@@ -19,6 +19,7 @@
 #include "utils/uuid.h"
 
 #include <seastar/core/scheduling.hh>
+#include <seastar/core/sharded.hh>
 #include <seastar/core/smp.hh>
 
 namespace cluster {
@@ -73,6 +74,8 @@ public:
     ss::future<netcheck_response> netcheck(model::node_id, iobuf&&);
 
 private:
+    ss::future<std::vector<self_test_result>> run_disk_test(diskcheck_opts);
+
     ss::future<std::vector<self_test_result>> do_start_test(
       std::vector<diskcheck_opts> dtos, std::vector<netcheck_opts> ntos);
 
@@ -93,7 +96,9 @@ private:
     ss::scheduling_group _st_sg;
     bool _cancelling{false};
     mutex _lock{"self_test"};
-    self_test::diskcheck _disk_test;
+    ss::sharded<node::local_monitor>& _nlm;
+    /// Disk benchmarks may run on every shard at once
+    ss::sharded<self_test::diskcheck> _disk_test;
     self_test::netcheck _network_test;
 };
 } // namespace cluster
@@ -36,6 +36,13 @@ public:
     ss::future<netcheck_response>
     netcheck(netcheck_request, rpc::streaming_context&) final;
 
+    /// netcheck floods the peers with large requests by design, keep it from
+    /// taking the memory of the server from the other services
+    std::optional<rpc::admission_limits> get_admission_limits() const final {
+        return rpc::admission_limits{
+          .memory_share = 0.1, .max_concurrency = 64};
+    }
+
 private:
     ss::sharded<self_test_backend>& _self_test_backend;
 };
@@ -33,7 +33,7 @@ std::ostream& operator<<(std::ostream& o, self_test_status sts);
 
 struct diskcheck_opts
   : serde::
-      envelope<diskcheck_opts, serde::version<0>, serde::compat_version<0>> {
+      envelope<diskcheck_opts, serde::version<1>, serde::compat_version<0>> {
     /// Descriptive name given to test run
     ss::sstring name{"512K sequential r/w disk test"};
     /// Where files this benchmark will read/write to exist
@@ -52,6 +52,14 @@ struct diskcheck_opts
     ss::lowres_clock::duration duration{std::chrono::milliseconds(5000)};
     /// Amount of fibers to run per shard
     uint16_t parallelism{10};
+    /// Flush the file every this many writes of a fiber, like the segment
+    /// appender does, 0 to never flush explicitly
+    uint32_t fdatasync_interval{0};
+    /// Percentage of reads of an additional run mixing reads and writes, no
+    /// mixed run if unset
+    std::optional<uint16_t> mixed_read_percent;
+    /// Run the benchmark concurrently on every shard, one file per shard
+    bool all_shards{false};
     /// Scheduling group that the benchmark will operate under
     ss::scheduling_group sg;
 
@@ -88,6 +96,15 @@ struct diskcheck_opts
         if (obj.HasMember("parallelism")) {
             opts.parallelism = obj["parallelism"].GetUint();
         }
+        if (obj.HasMember("fdatasync_interval")) {
+            opts.fdatasync_interval = obj["fdatasync_interval"].GetUint();
+        }
+        if (obj.HasMember("mixed_read_percent")) {
+            opts.mixed_read_percent = obj["mixed_read_percent"].GetUint();
+        }
+        if (obj.HasMember("all_shards")) {
+            opts.all_shards = obj["all_shards"].GetBool();
+        }
         return opts;
     }
 
@@ -100,7 +117,10 @@ struct diskcheck_opts
           data_size,
           request_size,
           duration,
-          parallelism);
+          parallelism,
+          fdatasync_interval,
+          mixed_read_percent,
+          all_shards);
     }
 
     friend std::ostream&
@@ -108,7 +128,8 @@ struct diskcheck_opts
         fmt::print(
           o,
           "{{name: {} dsync: {} skip_write: {} skip_read: {} data_size: {} "
-          "request_size: {} duration: {} parallelism: {}}}",
+          "request_size: {} duration: {} parallelism: {} fdatasync_interval: "
+          "{} mixed_read_percent: {} all_shards: {}}}",
           opts.name,
           opts.dsync,
           opts.skip_write,
@@ -116,7 +137,10 @@ struct diskcheck_opts
           opts.data_size,
           opts.request_size,
           opts.duration,
-          opts.parallelism);
+          opts.parallelism,
+          opts.fdatasync_interval,
+          opts.mixed_read_percent ? *opts.mixed_read_percent : -1,
+          opts.all_shards);
         return o;
     }
 };
@@ -182,9 +206,29 @@ struct netcheck_opts
     }
 };
 
+/// Cumulative count of the latencies up to upper_bound microseconds
+struct self_test_latency_bucket
+  : serde::envelope<
+      self_test_latency_bucket,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    uint64_t upper_bound{0};
+    uint64_t count{0};
+
+    friend bool
+    operator==(const self_test_latency_bucket&, const self_test_latency_bucket&)
+      = default;
+
+    friend std::ostream&
+    operator<<(std::ostream& o, const self_test_latency_bucket& b) {
+        fmt::print(o, "{{upper_bound: {} count: {}}}", b.upper_bound, b.count);
+        return o;
+    }
+};
+
 struct self_test_result
   : serde::
-      envelope<self_test_result, serde::version<0>, serde::compat_version<0>> {
+      envelope<self_test_result, serde::version<1>, serde::compat_version<0>> {
     double p50{0};
     double p90{0};
     double p99{0};
@@ -200,6 +244,8 @@ struct self_test_result
     ss::lowres_clock::duration duration{};
     std::optional<ss::sstring> warning;
     std::optional<ss::sstring> error;
+    /// Latency distribution of the run, empty for older brokers
+    std::vector<self_test_latency_bucket> latency_histogram;
 
     friend std::ostream&
     operator<<(std::ostream& o, const self_test_result& r) {
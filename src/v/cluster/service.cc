@@ -524,6 +524,15 @@ void clear_partition_sizes(node_health_report& report) {
 
 ss::future<get_node_health_reply>
 service::do_collect_node_health_report(get_node_health_request req) {
+    if (req.accepts_delta && req.filter == node_report_filter{}) {
+        auto res = co_await _hm_frontend.local().collect_node_health_delta(
+          req.acked_revision);
+        if (res.has_error()) {
+            co_return get_node_health_reply{
+              .error = map_health_monitor_error_code(res.error())};
+        }
+        co_return std::move(res.value());
+    }
     auto res = co_await _hm_frontend.local().collect_node_health(
       std::move(req.filter));
     if (res.has_error()) {
@@ -709,6 +718,22 @@ ss::future<cloud_storage_usage_reply> service::cloud_storage_usage(
 
 ss::future<cloud_storage_usage_reply>
 service::do_cloud_storage_usage(cloud_storage_usage_request req) {
+    if (req.local_leaders) {
+        co_return co_await _partition_manager.map_reduce0(
+          [](const partition_manager& pm) {
+              const auto& usage = pm.cloud_storage_usage();
+              return cloud_storage_usage_reply{
+                .total_size_bytes = usage.total_bytes(),
+                .leader_partitions = usage.leader_partitions()};
+          },
+          cloud_storage_usage_reply{},
+          [](cloud_storage_usage_reply acc, cloud_storage_usage_reply r) {
+              acc.total_size_bytes += r.total_size_bytes;
+              acc.leader_partitions += r.leader_partitions;
+              return acc;
+          });
+    }
+
     struct res_type {
         uint64_t total_size{0};
         std::vector<model::ntp> missing_partitions;
@@ -855,4 +880,9 @@ service::delete_topics(delete_topics_request req, rpc::streaming_context&) {
     co_return delete_topics_reply{.results = std::move(result)};
 }
 
+rpc::compression_policy service::reply_compression() const {
+    return rpc::compression_policy::from_threshold(
+      config::shard_local_cfg().rpc_controller_compression_bytes());
+}
+
 } // namespace cluster
@@ -13,18 +13,131 @@
 
 #include "cluster/cluster_utils.h"
 #include "cluster/logger.h"
+#include "cluster/partition.h"
+#include "cluster/partition_manager.h"
+#include "config/configuration.h"
 #include "config/node_config.h"
+#include "serde/serde.h"
+#include "storage/api.h"
+#include "storage/kvstore.h"
+
+#include <seastar/coroutine/maybe_yield.hh>
+
+#include <algorithm>
 
 namespace cluster {
 
+namespace {
+
+/// Number of replicas moved between shards on each load balancing round
+constexpr size_t max_load_moves_per_round = 8;
+
+/// Number of rounds a moved replica is not moved again for
+constexpr int moved_replica_cooldown_rounds = 5;
+
+struct persisted_overrides
+  : serde::envelope<
+      persisted_overrides,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    shard_placement_overrides_t overrides;
+
+    auto serde_fields() { return std::tie(overrides); }
+};
+
+bytes overrides_kvstore_key() {
+    return iobuf_to_bytes(
+      serde::to_iobuf(ss::sstring("shard_placement_overrides")));
+}
+
+} // namespace
+
+chunked_vector<shard_load_move> plan_shard_load_moves(
+  const chunked_vector<partition_shard_load>& partitions,
+  size_t shard_count,
+  double imbalance,
+  size_t max_moves) {
+    chunked_vector<shard_load_move> moves;
+    if (shard_count < 2) {
+        return moves;
+    }
+
+    std::vector<double> shard_loads(shard_count, 0);
+    std::vector<std::vector<size_t>> movable(shard_count);
+    double total = 0;
+    for (size_t i = 0; i < partitions.size(); ++i) {
+        const auto& p = partitions[i];
+        if (p.shard >= shard_count) {
+            continue;
+        }
+        shard_loads[p.shard] += p.load;
+        total += p.load;
+        if (p.movable && p.load > 0) {
+            movable[p.shard].push_back(i);
+        }
+    }
+    if (total <= 0) {
+        return moves;
+    }
+    const double mean = total / static_cast<double>(shard_count);
+
+    std::vector<bool> moved(partitions.size(), false);
+    while (moves.size() < max_moves) {
+        auto [cold_it, hot_it] = std::minmax_element(
+          shard_loads.begin(), shard_loads.end());
+        if (*hot_it <= mean * (1 + imbalance)) {
+            break;
+        }
+        const auto hot = static_cast<ss::shard_id>(
+          std::distance(shard_loads.begin(), hot_it));
+        const auto cold = static_cast<ss::shard_id>(
+          std::distance(shard_loads.begin(), cold_it));
+
+        // The busiest replica that leaves the destination at most as busy as
+        // the source.
+        const double max_load = (*hot_it - *cold_it) / 2;
+        std::optional<size_t> best;
+        for (auto idx : movable[hot]) {
+            const auto load = partitions[idx].load;
+            if (
+              !moved[idx] && load <= max_load
+              && (!best || load > partitions[*best].load)) {
+                best = idx;
+            }
+        }
+        if (!best) {
+            break;
+        }
+
+        moved[*best] = true;
+        shard_loads[hot] -= partitions[*best].load;
+        shard_loads[cold] += partitions[*best].load;
+        moves.push_back(shard_load_move{
+          .ntp = partitions[*best].ntp,
+          .from = hot,
+          .to = cold,
+        });
+    }
+    return moves;
+}
+
 shard_balancer::shard_balancer(
   ss::sharded<topic_table>& topics,
   ss::sharded<shard_placement_table>& spt,
-  ss::sharded<controller_backend>& cb)
+  ss::sharded<controller_backend>& cb,
+  ss::sharded<partition_manager>& pm,
+  ss::sharded<storage::api>& storage)
   : _topics(topics)
   , _shard_placement(spt)
   , _controller_backend(cb)
+  , _partition_manager(pm)
+  , _storage(storage)
   , _self(*config::node().node_id())
+  , _balance_on_load(config::shard_local_cfg().core_balancing_on_load.bind())
+  , _balance_on_load_interval(
+      config::shard_local_cfg().core_balancing_on_load_interval_ms.bind())
+  , _imbalance_percent(
+      config::shard_local_cfg().core_balancing_on_load_imbalance_percent.bind())
   , _work_queue([](auto ex) {
       if (!ssx::is_shutdown_exception(ex)) {
           vlog(clusterlog.error, "shard balancer exception: {}", ex);
@@ -39,8 +152,26 @@ ss::future<> shard_balancer::start() {
 
     auto tt_version = _topics.local().topics_map_revision();
 
+    // Bring the overrides up to date with the topic_table, as the replicas
+    // could be recreated or moved while this node was down.
+    load_overrides();
+    std::vector<model::ntp> overridden;
+    overridden.reserve(_overrides.size());
+    for (const auto& [ntp, _] : _overrides) {
+        overridden.push_back(ntp);
+    }
+    for (const auto& ntp : overridden) {
+        std::optional<shard_placement_target> target;
+        if (auto view = _topics.local().get_replicas_view(ntp)) {
+            target = placement_target_on_node(*view, _self);
+        }
+        apply_override(ntp, target);
+        co_await ss::coroutine::maybe_yield();
+    }
+    co_await maybe_persist_overrides();
+
     co_await _shard_placement.invoke_on_all([this](shard_placement_table& spt) {
-        return spt.initialize(_topics.local(), _self);
+        return spt.initialize(_topics.local(), _self, _overrides);
     });
 
     // we shouldn't be receiving any controller updates at this point, so no
@@ -65,6 +196,8 @@ ss::future<> shard_balancer::start() {
               });
           });
       });
+
+    schedule_load_balancing();
 }
 
 ss::future<> shard_balancer::stop() {
@@ -88,6 +221,8 @@ ss::future<> shard_balancer::process_delta(const topic_table::delta& delta) {
     auto maybe_replicas_view = _topics.local().get_replicas_view(ntp);
     if (!maybe_replicas_view) {
         if (delta.type == topic_table_delta_type::removed) {
+            apply_override(ntp, std::nullopt);
+            co_await maybe_persist_overrides();
             co_await _shard_placement.local().set_target(
               ntp,
               std::nullopt,
@@ -99,7 +234,10 @@ ss::future<> shard_balancer::process_delta(const topic_table::delta& delta) {
     auto replicas_view = maybe_replicas_view.value();
 
     // Has value if the partition is expected to exist on this node.
-    auto target = placement_target_on_node(replicas_view, _self);
+    auto target = apply_override(
+      ntp, placement_target_on_node(replicas_view, _self));
+    // the override must be persisted before the replica starts moving
+    co_await maybe_persist_overrides();
 
     auto shard_rev = model::shard_revision_id{
       replicas_view.last_cmd_revision()};
@@ -115,4 +253,200 @@ ss::future<> shard_balancer::process_delta(const topic_table::delta& delta) {
       ntp, target, shard_rev, shard_callback);
 }
 
+std::optional<shard_placement_target> shard_balancer::apply_override(
+  const model::ntp& ntp, std::optional<shard_placement_target> target) {
+    auto it = _overrides.find(ntp);
+    if (it == _overrides.end()) {
+        return target;
+    }
+    auto& o = it->second;
+    if (!target || target->log_revision != o.log_revision) {
+        // the replica was removed from this node or recreated
+        vlog(clusterlog.debug, "[{}] dropping shard override: {}", ntp, o);
+        _overrides.erase(it);
+        _overrides_dirty = true;
+        return target;
+    }
+    if (target->shard != o.assigned) {
+        // Moved in topic_table, e.g. through the admin API, follow the move.
+        // The override is kept because the replica might still be on the
+        // overridden shard when this node restarts.
+        o.source = o.target;
+        o.target = target->shard;
+        o.assigned = target->shard;
+        _overrides_dirty = true;
+        vlog(clusterlog.debug, "[{}] updated shard override: {}", ntp, o);
+    }
+    target->shard = o.target;
+    return target;
+}
+
+void shard_balancer::load_overrides() {
+    auto buf = _storage.local().kvs().get(
+      storage::kvstore::key_space::controller, overrides_kvstore_key());
+    if (buf) {
+        _overrides = std::move(
+          serde::from_iobuf<persisted_overrides>(std::move(*buf)).overrides);
+        vlog(
+          clusterlog.info,
+          "loaded {} shard placement overrides",
+          _overrides.size());
+    }
+}
+
+ss::future<> shard_balancer::maybe_persist_overrides() {
+    if (!_overrides_dirty) {
+        co_return;
+    }
+    // kvstore is shard-local, the overrides are always kept on shard 0
+    _overrides_dirty = false;
+    co_await _storage.local().kvs().put(
+      storage::kvstore::key_space::controller,
+      overrides_kvstore_key(),
+      serde::to_iobuf(persisted_overrides{.overrides = _overrides}));
+}
+
+void shard_balancer::schedule_load_balancing() {
+    // moving partitions for the load can wait behind the reconciliation of
+    // the assignments
+    _work_queue.submit_delayed(
+      _balance_on_load_interval(),
+      ssx::work_options{.priority = ssx::work_priority::background},
+      [this] {
+          return balance_on_load().finally(
+            [this] { schedule_load_balancing(); });
+      });
+}
+
+ss::future<> shard_balancer::balance_on_load() {
+    if (!_balance_on_load() || ss::smp::count < 2) {
+        _load_samples.clear();
+        _last_measured_at = {};
+        co_return;
+    }
+
+    auto loads = co_await measure_load();
+    auto moves = plan_shard_load_moves(
+      loads,
+      ss::smp::count,
+      static_cast<double>(_imbalance_percent()) / 100,
+      max_load_moves_per_round);
+
+    auto shard_callback =
+      [this](const model::ntp& ntp, model::shard_revision_id shard_rev) {
+          _controller_backend.local().notify_reconciliation(ntp, shard_rev);
+      };
+
+    for (const auto& move : moves) {
+        // re-check, the table could change while measuring
+        auto current = _shard_placement.local().get_target(move.ntp);
+        auto replicas_view = _topics.local().get_replicas_view(move.ntp);
+        if (!current || current->shard != move.from || !replicas_view) {
+            continue;
+        }
+        auto assigned = placement_target_on_node(*replicas_view, _self);
+        if (!assigned || assigned->log_revision != current->log_revision) {
+            continue;
+        }
+
+        _overrides[move.ntp] = shard_placement_override{
+          .log_revision = current->log_revision,
+          .source = move.from,
+          .target = move.to,
+          .assigned = assigned->shard,
+        };
+        _overrides_dirty = true;
+        co_await maybe_persist_overrides();
+
+        _moved_at[move.ntp] = clock_t::now();
+        vlog(
+          clusterlog.info,
+          "[{}] moving from shard {} to shard {} to balance load",
+          move.ntp,
+          move.from,
+          move.to);
+        co_await _shard_placement.local().set_target(
+          move.ntp,
+          shard_placement_target(current->log_revision, move.to),
+          model::shard_revision_id{replicas_view->last_cmd_revision()},
+          shard_callback);
+    }
+}
+
+ss::future<chunked_vector<partition_shard_load>>
+shard_balancer::measure_load() {
+    struct bytes_sample {
+        model::ntp ntp;
+        model::revision_id log_revision;
+        uint64_t bytes;
+    };
+
+    const auto now = clock_t::now();
+    const double elapsed_s
+      = _last_measured_at == clock_t::time_point{}
+          ? 0
+          : std::chrono::duration<double>(now - _last_measured_at).count();
+    _last_measured_at = now;
+
+    const auto cooldown = moved_replica_cooldown_rounds
+                          * _balance_on_load_interval();
+    absl::erase_if(_moved_at, [now, cooldown](const auto& kv) {
+        return kv.second + cooldown <= now;
+    });
+
+    chunked_vector<partition_shard_load> ret;
+    absl::node_hash_map<model::ntp, load_sample> samples;
+    for (ss::shard_id shard = 0; shard < ss::smp::count; ++shard) {
+        auto shard_samples = co_await _partition_manager.invoke_on(
+          shard, [](partition_manager& pm) {
+              chunked_vector<bytes_sample> ret;
+              for (const auto& [ntp, p] : pm.partitions()) {
+                  ret.push_back(bytes_sample{
+                    .ntp = ntp,
+                    .log_revision = p->get_log_revision_id(),
+                    .bytes = p->probe().bytes_produced()
+                             + p->probe().bytes_fetched(),
+                  });
+              }
+              return ret;
+          });
+
+        for (auto& s : shard_samples) {
+            load_sample next{
+              .shard = shard, .log_revision = s.log_revision, .bytes = s.bytes};
+            if (auto prev = _load_samples.find(s.ntp);
+                prev != _load_samples.end()
+                && prev->second.log_revision == s.log_revision) {
+                // the counters restart when the replica moves, then the
+                // previous rate is kept until the next measurement
+                next.rate = prev->second.rate;
+                if (
+                  prev->second.shard == shard && prev->second.bytes <= s.bytes
+                  && elapsed_s > 0) {
+                    const double current = static_cast<double>(
+                                             s.bytes - prev->second.bytes)
+                                           / elapsed_s;
+                    // smooth the rate to not react to short bursts
+                    next.rate = (next.rate + current) / 2;
+                }
+            }
+
+            auto target = _shard_placement.local().get_target(s.ntp);
+            const bool movable = target && target->shard == shard
+                                 && target->log_revision == s.log_revision
+                                 && !_moved_at.contains(s.ntp);
+            ret.push_back(partition_shard_load{
+              .ntp = s.ntp,
+              .shard = shard,
+              .load = next.rate,
+              .movable = movable,
+            });
+            samples.insert_or_assign(std::move(s.ntp), next);
+        }
+        co_await ss::coroutine::maybe_yield();
+    }
+    _load_samples = std::move(samples);
+    co_return ret;
+}
+
 } // namespace cluster
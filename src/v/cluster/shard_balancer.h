@@ -13,17 +13,53 @@
 
 #include "cluster/controller_backend.h"
 #include "cluster/shard_placement_table.h"
+#include "config/property.h"
+#include "container/fragmented_vector.h"
 #include "ssx/work_queue.h"
+#include "storage/fwd.h"
+
+#include <seastar/core/lowres_clock.hh>
+
+#include <absl/container/node_hash_map.h>
 
 namespace cluster {
 
+/// Load of a partition replica hosted on this node, in bytes per second.
+struct partition_shard_load {
+    model::ntp ntp;
+    ss::shard_id shard;
+    double load;
+    // false if the replica can't move, e.g. because it is moving already
+    bool movable;
+};
+
+struct shard_load_move {
+    model::ntp ntp;
+    ss::shard_id from;
+    ss::shard_id to;
+};
+
+/// Plans at most max_moves moves of replicas from the busiest to the least
+/// busy shards while the load of the busiest shard exceeds the average load by
+/// more than imbalance (e.g. 0.25 for 25%). A move never makes its destination
+/// busier than its source, so that the same replicas don't bounce between
+/// shards on the next rounds.
+chunked_vector<shard_load_move> plan_shard_load_moves(
+  const chunked_vector<partition_shard_load>&,
+  size_t shard_count,
+  double imbalance,
+  size_t max_moves);
+
 /// shard_balancer runs on shard 0 of each node and manages assignments of
 /// partitions hosted on this node to shards. It does this by modifying
 /// shard_placement_table and notifying controller_backend of these modification
 /// so that it can perform necessary reconciling actions.
 ///
-/// Currently shard_balancer simply uses assignments from topic_table, but in
-/// the future it will calculate them on its own.
+/// By default shard_balancer simply uses assignments from topic_table. With
+/// core_balancing_on_load it periodically measures the produce and fetch
+/// throughput of the replicas hosted on this node and moves replicas from the
+/// busiest shards to the least busy ones. The shards it chooses are kept in
+/// the kvstore, so that they survive restarts.
 class shard_balancer {
 public:
     // single instance
@@ -32,7 +68,9 @@ public:
     shard_balancer(
       ss::sharded<topic_table>&,
       ss::sharded<shard_placement_table>&,
-      ss::sharded<controller_backend>&);
+      ss::sharded<controller_backend>&,
+      ss::sharded<partition_manager>&,
+      ss::sharded<storage::api>&);
 
     ss::future<> start();
     ss::future<> stop();
@@ -40,12 +78,48 @@ public:
 private:
     ss::future<> process_delta(const topic_table::delta&);
 
+    /// Adjusts the target computed from topic_table with the override of the
+    /// ntp, if any, and drops overrides of replicas that were recreated or
+    /// removed from this node.
+    std::optional<shard_placement_target> apply_override(
+      const model::ntp&, std::optional<shard_placement_target>);
+
+    void load_overrides();
+    ss::future<> maybe_persist_overrides();
+
+    void schedule_load_balancing();
+    ss::future<> balance_on_load();
+    ss::future<chunked_vector<partition_shard_load>> measure_load();
+
+    using clock_t = ss::lowres_clock;
+
+    struct load_sample {
+        ss::shard_id shard;
+        model::revision_id log_revision;
+        uint64_t bytes;
+        double rate{0};
+    };
+
 private:
     ss::sharded<topic_table>& _topics;
     ss::sharded<shard_placement_table>& _shard_placement;
     ss::sharded<controller_backend>& _controller_backend;
+    ss::sharded<partition_manager>& _partition_manager;
+    ss::sharded<storage::api>& _storage;
     model::node_id _self;
 
+    config::binding<bool> _balance_on_load;
+    config::binding<std::chrono::milliseconds> _balance_on_load_interval;
+    config::binding<unsigned> _imbalance_percent;
+
+    shard_placement_overrides_t _overrides;
+    bool _overrides_dirty{false};
+
+    absl::node_hash_map<model::ntp, load_sample> _load_samples;
+    clock_t::time_point _last_measured_at;
+    // replicas are not moved again within a few rounds after a move
+    absl::node_hash_map<model::ntp, clock_t::time_point> _moved_at;
+
     cluster::notification_id_type _topic_table_notify_handle;
     ssx::work_queue _work_queue;
 };
@@ -31,6 +31,17 @@ operator<<(std::ostream& o, shard_placement_table::hosted_status s) {
     __builtin_unreachable();
 }
 
+std::ostream& operator<<(std::ostream& o, const shard_placement_override& po) {
+    fmt::print(
+      o,
+      "{{log_revision: {} source: {} target: {} assigned: {}}}",
+      po.log_revision,
+      po.source,
+      po.target,
+      po.assigned);
+    return o;
+}
+
 std::ostream& operator<<(
   std::ostream& o, const shard_placement_table::shard_local_state& ls) {
     fmt::print(
@@ -53,7 +64,9 @@ operator<<(std::ostream& o, const shard_placement_table::placement_state& gs) {
 }
 
 ss::future<> shard_placement_table::initialize(
-  const topic_table& topics, model::node_id self) {
+  const topic_table& topics,
+  model::node_id self,
+  const shard_placement_overrides_t& overrides) {
     // We expect topic_table to remain unchanged throughout the loop because the
     // method is supposed to be called after local controller replay is finished
     // but before we start getting new controller updates from the leader.
@@ -83,10 +96,6 @@ ss::future<> shard_placement_table::initialize(
               auto shard_rev = model::shard_revision_id{
                 replicas_view.last_cmd_revision()};
 
-              if (ss::this_shard_id() == assignment_shard_id) {
-                  _ntp2target.emplace(ntp, target.value());
-              }
-
               // We add an initial hosted marker for the partition on the shard
               // from the original replica set (even in the case of cross-shard
               // move). The reason for this is that if there is an ongoing
@@ -99,6 +108,21 @@ ss::future<> shard_placement_table::initialize(
               auto orig_shard = find_shard_on_node(
                 replicas_view.orig_replicas(), self);
 
+              // The override is treated as a cross-shard move from the shard
+              // that was hosting the partition when it was set, as we can't be
+              // sure if the move was finished before the previous shutdown.
+              if (auto o_it = overrides.find(ntp); o_it != overrides.end()) {
+                  const auto& o = o_it->second;
+                  if (o.log_revision == target->log_revision) {
+                      orig_shard = o.source;
+                      target->shard = o.target;
+                  }
+              }
+
+              if (ss::this_shard_id() == assignment_shard_id) {
+                  _ntp2target.emplace(ntp, target.value());
+              }
+
               if (ss::this_shard_id() == target->shard) {
                   vlog(
                     clusterlog.info,
@@ -252,6 +276,19 @@ shard_placement_table::state_on_this_shard(const model::ntp& ntp) const {
     return std::nullopt;
 }
 
+std::optional<shard_placement_target>
+shard_placement_table::get_target(const model::ntp& ntp) const {
+    vassert(
+      ss::this_shard_id() == assignment_shard_id,
+      "method can only be invoked on shard {}",
+      assignment_shard_id);
+    auto it = _ntp2target.find(ntp);
+    if (it != _ntp2target.end()) {
+        return it->second;
+    }
+    return std::nullopt;
+}
+
 ss::future<std::error_code> shard_placement_table::prepare_create(
   const model::ntp& ntp, model::revision_id expected_log_rev) {
     auto state_it = _states.find(ntp);
@@ -13,6 +13,7 @@
 
 #include "base/seastarx.h"
 #include "cluster/types.h"
+#include "serde/envelope.h"
 #include "utils/mutex.h"
 
 #include <seastar/core/sharded.hh>
@@ -21,6 +22,36 @@
 
 namespace cluster {
 
+/// Shard of a partition replica on this node chosen by shard_balancer instead
+/// of the shard assigned in topic_table.
+struct shard_placement_override
+  : serde::envelope<
+      shard_placement_override,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    model::revision_id log_revision;
+    /// Shard that hosted the partition when the override was set
+    ss::shard_id source;
+    /// Shard that hosts the partition
+    ss::shard_id target;
+    /// Shard of the partition in topic_table when the override was set
+    ss::shard_id assigned;
+
+    friend bool
+    operator==(const shard_placement_override&, const shard_placement_override&)
+      = default;
+
+    friend std::ostream&
+    operator<<(std::ostream&, const shard_placement_override&);
+
+    auto serde_fields() {
+        return std::tie(log_revision, source, target, assigned);
+    }
+};
+
+using shard_placement_overrides_t
+  = absl::node_hash_map<model::ntp, shard_placement_override>;
+
 /// Node-local data structure tracking ntp -> shard mapping for partition
 /// replicas hosted by this node. Both target state and current shard-local
 /// state for each ntp are tracked. Target state is supposed to be modified by
@@ -113,8 +144,12 @@ public:
         std::optional<ss::shard_id> _next;
     };
 
-    // must be called on each shard
-    ss::future<> initialize(const topic_table&, model::node_id self);
+    // must be called on each shard, overrides take precedence over the shards
+    // assigned in topic_table
+    ss::future<> initialize(
+      const topic_table&,
+      model::node_id self,
+      const shard_placement_overrides_t& overrides);
 
     using shard_callback_t
       = std::function<void(const model::ntp&, model::shard_revision_id)>;
@@ -131,6 +166,9 @@ public:
 
     std::optional<placement_state> state_on_this_shard(const model::ntp&) const;
 
+    /// Must be called only on assignment_shard_id.
+    std::optional<shard_placement_target> get_target(const model::ntp&) const;
+
     // partition lifecycle methods
 
     ss::future<std::error_code>
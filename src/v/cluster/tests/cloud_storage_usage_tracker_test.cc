@@ -0,0 +1,84 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "cluster/cloud_storage_usage_tracker.h"
+#include "model/namespace.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace cluster;
+
+namespace {
+model::ntp make_ntp(std::string_view topic, int32_t partition) {
+    return model::ntp(
+      model::kafka_namespace,
+      model::topic(topic),
+      model::partition_id(partition));
+}
+
+uint64_t topic_bytes(
+  const cloud_storage_usage_tracker& tracker, std::string_view topic) {
+    auto it = tracker.bytes_by_topic().find(
+      model::topic_namespace(model::kafka_namespace, model::topic(topic)));
+    return it == tracker.bytes_by_topic().end() ? 0 : it->second;
+}
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(test_only_leaders_are_accounted) {
+    cloud_storage_usage_tracker tracker;
+    tracker.add(make_ntp("a", 0), 100, true);
+    tracker.add(make_ntp("a", 1), 200, false);
+    tracker.add(make_ntp("b", 0), 50, true);
+
+    BOOST_REQUIRE_EQUAL(tracker.total_bytes(), 150);
+    BOOST_REQUIRE_EQUAL(tracker.leader_partitions(), 2);
+    BOOST_REQUIRE_EQUAL(topic_bytes(tracker, "a"), 100);
+    BOOST_REQUIRE_EQUAL(topic_bytes(tracker, "b"), 50);
+
+    // follower size changes don't affect the totals until it becomes leader
+    tracker.update_size(make_ntp("a", 1), 300);
+    BOOST_REQUIRE_EQUAL(tracker.total_bytes(), 150);
+    tracker.update_leadership(make_ntp("a", 1), true);
+    BOOST_REQUIRE_EQUAL(tracker.total_bytes(), 450);
+    BOOST_REQUIRE_EQUAL(tracker.leader_partitions(), 3);
+    BOOST_REQUIRE_EQUAL(topic_bytes(tracker, "a"), 400);
+
+    tracker.update_leadership(make_ntp("a", 0), false);
+    BOOST_REQUIRE_EQUAL(tracker.total_bytes(), 350);
+    BOOST_REQUIRE_EQUAL(tracker.leader_partitions(), 2);
+    BOOST_REQUIRE_EQUAL(topic_bytes(tracker, "a"), 300);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_size_updates_and_removal) {
+    cloud_storage_usage_tracker tracker;
+    tracker.add(make_ntp("a", 0), 100, true);
+    tracker.update_size(make_ntp("a", 0), 40);
+    BOOST_REQUIRE_EQUAL(tracker.total_bytes(), 40);
+    BOOST_REQUIRE_EQUAL(topic_bytes(tracker, "a"), 40);
+
+    // updates of unknown partitions are ignored
+    tracker.update_size(make_ntp("c", 0), 1000);
+    tracker.update_leadership(make_ntp("c", 0), true);
+    BOOST_REQUIRE_EQUAL(tracker.total_bytes(), 40);
+    BOOST_REQUIRE_EQUAL(tracker.leader_partitions(), 1);
+
+    // adding a partition again replaces its previous usage
+    tracker.add(make_ntp("a", 0), 10, true);
+    BOOST_REQUIRE_EQUAL(tracker.total_bytes(), 10);
+    BOOST_REQUIRE_EQUAL(tracker.leader_partitions(), 1);
+
+    tracker.remove(make_ntp("a", 0));
+    BOOST_REQUIRE_EQUAL(tracker.total_bytes(), 0);
+    BOOST_REQUIRE_EQUAL(tracker.leader_partitions(), 0);
+    BOOST_REQUIRE(tracker.bytes_by_topic().empty());
+}
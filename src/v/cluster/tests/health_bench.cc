@@ -7,12 +7,15 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "base/units.h"
 #include "base/vassert.h"
 #include "cluster/health_monitor_backend.h"
 #include "cluster/health_monitor_types.h"
+#include "cluster/health_report_delta.h"
 #include "cluster/tests/health_monitor_test_utils.h"
 #include "model/namespace.h"
 #include "random/generators.h"
+#include "serde/serde.h"
 
 #include <seastar/testing/perf_tests.hh>
 
@@ -100,6 +103,72 @@ struct health_bench : health_report_accessor {
         auto res = aggr_fn(reports);
         perf_tests::stop_measuring_time();
     }
+
+    ~health_bench() {
+        if (reply_bytes.has_value()) {
+            fmt::print("node health reply: {} bytes\n", *reply_bytes);
+        }
+    }
+
+    /**
+     * @brief Encode, serialize and apply the report of a node hosting 100k
+     * partitions of which 1% changed since the previous report, either as a
+     * delta or as a full report.
+     */
+    void bench_delta(bool use_delta) {
+        constexpr int topic_count = 100;
+        constexpr int parts_per_topic = 1000;
+        constexpr int changed_every = 100;
+
+        node_health_report report;
+        report.id = model::node_id(0);
+        for (int topic = 0; topic < topic_count; topic++) {
+            partition_statuses_t partitions;
+            for (int pid = 0; pid < parts_per_topic; pid++) {
+                partitions.push_back(partition_status{
+                  .id{pid},
+                  .term{1},
+                  .leader_id = model::node_id(0),
+                  .revision_id{topic},
+                  .size_bytes = random_generators::get_int<size_t>(1_GiB),
+                });
+            }
+            report.topics.emplace_back(
+              model::topic_namespace{
+                model::kafka_namespace,
+                model::topic(fmt::format("topic_{}", topic))},
+              std::move(partitions));
+        }
+
+        // a full report is sent on every request when no deltas are allowed
+        health_report_delta_encoder encoder(use_delta ? 1 : 0);
+        auto first = encoder.encode(report, std::nullopt);
+        auto base = std::move(*first.report);
+
+        int n = 0;
+        for (auto& t : report.topics) {
+            for (auto& p : t.partitions) {
+                if (n++ % changed_every == 0) {
+                    p.size_bytes += 1;
+                }
+            }
+        }
+
+        perf_tests::start_measuring_time();
+        auto reply = encoder.encode(std::move(report), first.report_revision);
+        auto buf = serde::to_iobuf(std::move(reply));
+        reply_bytes = buf.size_bytes();
+        auto decoded = serde::from_iobuf<get_node_health_reply>(std::move(buf));
+        if (decoded.is_delta) {
+            apply_health_report_delta(
+              base, std::move(*decoded.report), decoded.removed_partitions);
+        } else {
+            base = std::move(*decoded.report);
+        }
+        perf_tests::stop_measuring_time();
+    }
+
+    std::optional<size_t> reply_bytes;
 };
 
 PERF_TEST_F(health_bench, original) {
@@ -112,4 +181,8 @@ PERF_TEST_F(health_bench, original_unlimited) {
 
 PERF_TEST_F(health_bench, current) { bench(aggregate); }
 
+PERF_TEST_F(health_bench, full_node_report) { bench_delta(false); }
+
+PERF_TEST_F(health_bench, delta_node_report) { bench_delta(true); }
+
 } // namespace cluster
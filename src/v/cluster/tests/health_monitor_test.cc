@@ -364,6 +364,33 @@ FIXTURE_TEST(test_alive_status, cluster_test_fixture) {
     }).get();
 }
 
+FIXTURE_TEST(test_cached_nodes_status, cluster_test_fixture) {
+    auto n1 = create_node_application(model::node_id{0});
+    create_node_application(model::node_id{1});
+    create_node_application(model::node_id{2});
+
+    wait_for_all_members(3s).get();
+
+    // node status is eventually cached on every shard
+    tests::cooperative_spin_wait_with_timeout(10s, [&n1] {
+        return n1->controller->get_health_monitor()
+          .local()
+          .refresh_info()
+          .then([&n1] {
+              return n1->controller->get_health_monitor().map_reduce0(
+                [](const cluster::health_monitor_frontend& fe) {
+                    auto states = fe.get_cached_nodes_status();
+                    return states && states->size() == 3;
+                },
+                true,
+                std::logical_and<>());
+          });
+    }).get();
+
+    auto alive = n1->metadata_cache.local().alive_nodes().get();
+    BOOST_REQUIRE_EQUAL(alive.size(), 3);
+}
+
 // tests below are non-rp-fixture unit tests but we don't want to add another
 // binary just for that
 
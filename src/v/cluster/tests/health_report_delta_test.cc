@@ -0,0 +1,157 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "cluster/health_report_delta.h"
+#include "model/namespace.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+#include <boost/test/unit_test.hpp>
+
+#include <map>
+
+using namespace cluster;
+
+namespace {
+
+model::topic_namespace make_tp_ns(int topic) {
+    return {model::kafka_namespace, model::topic(fmt::format("t_{}", topic))};
+}
+
+/// A report of `topics` topics with `partitions` partitions led by node 1
+node_health_report make_report(int topics, int partitions) {
+    node_health_report report;
+    report.id = model::node_id(1);
+    for (int t = 0; t < topics; ++t) {
+        partition_statuses_t statuses;
+        for (int p = 0; p < partitions; ++p) {
+            statuses.push_back(partition_status{
+              .id = model::partition_id(p),
+              .term = model::term_id(1),
+              .leader_id = model::node_id(1),
+              .size_bytes = 1024,
+            });
+        }
+        report.topics.emplace_back(make_tp_ns(t), std::move(statuses));
+    }
+    return report;
+}
+
+partition_status& find_partition(node_health_report& report, int t, int p) {
+    for (auto& topic : report.topics) {
+        if (topic.tp_ns != make_tp_ns(t)) {
+            continue;
+        }
+        for (auto& status : topic.partitions) {
+            if (status.id == model::partition_id(p)) {
+                return status;
+            }
+        }
+    }
+    throw std::runtime_error("partition not found");
+}
+
+/// The partition statuses of the report regardless of their order
+std::map<model::ntp, partition_status>
+partitions_of(const node_health_report& report) {
+    std::map<model::ntp, partition_status> ret;
+    for (const auto& t : report.topics) {
+        for (const auto& p : t.partitions) {
+            ret.emplace(model::ntp(t.tp_ns.ns, t.tp_ns.tp, p.id), p);
+        }
+    }
+    return ret;
+}
+
+size_t partition_count(const node_health_report& report) {
+    size_t ret = 0;
+    for (const auto& t : report.topics) {
+        ret += t.partitions.size();
+    }
+    return ret;
+}
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(test_delta_carries_changed_partitions) {
+    health_report_delta_encoder encoder;
+
+    auto first = encoder.encode(make_report(2, 10), std::nullopt);
+    BOOST_REQUIRE(!first.is_delta);
+    BOOST_REQUIRE(first.report_revision.has_value());
+    BOOST_REQUIRE_EQUAL(partition_count(*first.report), 20);
+    auto base = *first.report;
+
+    auto current = make_report(2, 10);
+    find_partition(current, 0, 3).leader_id = model::node_id(2);
+    find_partition(current, 1, 5).size_bytes = 4096;
+    find_partition(current, 1, 7).under_replicated_replicas = 1;
+    auto reply = encoder.encode(current, first.report_revision);
+    BOOST_REQUIRE(reply.is_delta);
+    BOOST_REQUIRE(reply.report_revision != first.report_revision);
+    BOOST_REQUIRE_EQUAL(partition_count(*reply.report), 3);
+    BOOST_REQUIRE(reply.removed_partitions.empty());
+
+    apply_health_report_delta(
+      base, std::move(*reply.report), reply.removed_partitions);
+    BOOST_REQUIRE(partitions_of(base) == partitions_of(current));
+
+    // nothing changed
+    reply = encoder.encode(current, reply.report_revision);
+    BOOST_REQUIRE(reply.is_delta);
+    BOOST_REQUIRE_EQUAL(partition_count(*reply.report), 0);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_delta_with_added_and_removed_partitions) {
+    health_report_delta_encoder encoder;
+    auto first = encoder.encode(make_report(2, 10), std::nullopt);
+    auto base = *first.report;
+
+    // topic 1 is removed, topic 2 is added and topic 0 loses a partition
+    auto all = make_report(3, 10);
+    auto current = make_report(0, 0);
+    current.topics.push_back(std::move(all.topics[0]));
+    current.topics.push_back(std::move(all.topics[2]));
+    current.topics[0].partitions.pop_back();
+
+    auto reply = encoder.encode(current, first.report_revision);
+    BOOST_REQUIRE(reply.is_delta);
+    BOOST_REQUIRE_EQUAL(partition_count(*reply.report), 10);
+    BOOST_REQUIRE_EQUAL(reply.removed_partitions.size(), 11);
+
+    apply_health_report_delta(
+      base, std::move(*reply.report), reply.removed_partitions);
+    BOOST_REQUIRE(partitions_of(base) == partitions_of(current));
+    BOOST_REQUIRE_EQUAL(base.topics.size(), 2);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_full_report_on_resync) {
+    health_report_delta_encoder encoder(2);
+    auto reply = encoder.encode(make_report(1, 10), std::nullopt);
+    BOOST_REQUIRE(!reply.is_delta);
+
+    // unknown revision, e.g. the previous reply was lost
+    auto stale = reply.report_revision;
+    reply = encoder.encode(make_report(1, 10), stale);
+    BOOST_REQUIRE(reply.is_delta);
+    reply = encoder.encode(make_report(1, 10), stale);
+    BOOST_REQUIRE(!reply.is_delta);
+    BOOST_REQUIRE_EQUAL(partition_count(*reply.report), 10);
+
+    // periodic full report
+    reply = encoder.encode(make_report(1, 10), reply.report_revision);
+    BOOST_REQUIRE(reply.is_delta);
+    reply = encoder.encode(make_report(1, 10), reply.report_revision);
+    BOOST_REQUIRE(reply.is_delta);
+    reply = encoder.encode(make_report(1, 10), reply.report_revision);
+    BOOST_REQUIRE(!reply.is_delta);
+    BOOST_REQUIRE_EQUAL(partition_count(*reply.report), 10);
+}
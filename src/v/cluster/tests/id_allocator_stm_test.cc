@@ -39,9 +39,9 @@ using namespace std::chrono_literals;
 ss::logger idstmlog{"idstm-test"};
 
 struct id_allocator_stm_fixture : simple_raft_fixture {
-    void create_stm_and_start_raft() {
+    void create_stm_and_start_raft(int16_t batch_size = 1) {
         // set configuration parameters
-        test_local_cfg.get("id_allocator_batch_size").set_value(int16_t(1));
+        test_local_cfg.get("id_allocator_batch_size").set_value(batch_size);
         test_local_cfg.get("id_allocator_log_capacity").set_value(int16_t(2));
         create_raft();
         raft::state_machine_manager_builder stm_m_builder;
@@ -131,3 +131,27 @@ FIXTURE_TEST(stm_reset_batch_test, id_allocator_stm_fixture) {
     last_id = allocate_n(last_id, 1);
     BOOST_REQUIRE_EQUAL(last_id, 102);
 }
+
+FIXTURE_TEST(stm_allocate_ids_test, id_allocator_stm_fixture) {
+    create_stm_and_start_raft(10);
+    wait_for_confirmed_leader();
+
+    auto first = _stm->allocate_ids(4, 1s).get();
+    BOOST_REQUIRE_EQUAL(raft::errc::success, first.raft_status);
+    BOOST_REQUIRE_EQUAL(first.count, 4);
+
+    // the range never spans more than what is left of the batch
+    auto second = _stm->allocate_ids(10, 1s).get();
+    BOOST_REQUIRE_EQUAL(raft::errc::success, second.raft_status);
+    BOOST_REQUIRE_EQUAL(second.id, first.id + 4);
+    BOOST_REQUIRE_EQUAL(second.count, 6);
+
+    auto third = _stm->allocate_ids(3, 1s).get();
+    BOOST_REQUIRE_EQUAL(raft::errc::success, third.raft_status);
+    BOOST_REQUIRE_GE(third.id, second.id + second.count);
+    BOOST_REQUIRE_EQUAL(third.count, 3);
+
+    auto single = _stm->allocate_id(1s).get();
+    BOOST_REQUIRE_EQUAL(single.id, third.id + 3);
+    BOOST_REQUIRE_EQUAL(single.count, 1);
+}
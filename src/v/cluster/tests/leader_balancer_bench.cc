@@ -10,6 +10,7 @@
  */
 #include "cluster/scheduling/leader_balancer_constraints.h"
 #include "cluster/scheduling/leader_balancer_greedy.h"
+#include "cluster/scheduling/leader_balancer_heap.h"
 #include "cluster/scheduling/leader_balancer_random.h"
 #include "cluster/scheduling/leader_balancer_types.h"
 #include "leader_balancer_test_utils.h"
@@ -171,8 +172,75 @@ void balancer_bench(bool measure_all) {
     perf_tests::stop_measuring_time();
 }
 
+/*
+ * A balanced cluster after a restart of node 0: the leadership of all the
+ * groups it led moved to another replica.
+ */
+cluster::leader_balancer_strategy::index_type make_restarted_cluster_index() {
+    std::vector<model::broker_shard> shards;
+    for (auto n = 0; n < node_count; n++) {
+        for (auto s = 0U; s < shards_per_node; s++) {
+            shards.push_back(model::broker_shard{model::node_id(n), s});
+        }
+    }
+
+    cluster::leader_balancer_strategy::index_type index;
+    for (const auto& shard : shards) {
+        index[shard];
+    }
+    size_t replica = 0;
+    raft::group_id::type group = 0;
+    for (const auto& shard : shards) {
+        for (auto g = 0; g < groups_per_shard; g++) {
+            std::vector<model::broker_shard> group_replicas{shard};
+            while (group_replicas.size() != replicas) {
+                const auto& candidate = shards[replica++ % shards.size()];
+                if (candidate.node_id != shard.node_id) {
+                    group_replicas.push_back(candidate);
+                }
+            }
+            auto leader = shard.node_id == model::node_id(0)
+                            ? group_replicas[1]
+                            : shard;
+            index[leader][raft::group_id(group++)] = std::move(group_replicas);
+        }
+    }
+    return index;
+}
+
+/*
+ * Measures the time a strategy takes to rebalance leadership after a rolling
+ * restart of a node, applying its movements until it finds no more.
+ */
+template<typename strategy_t>
+void rebalance_bench() {
+    auto index = make_restarted_cluster_index();
+
+    perf_tests::start_measuring_time();
+    strategy_t strategy(std::move(index), {});
+    size_t movements = 0;
+    while (auto movement = strategy.find_movement({})) {
+        strategy.apply_movement(*movement);
+        ++movements;
+    }
+    perf_tests::stop_measuring_time();
+
+    vassert(
+      movements >= shards_per_node * groups_per_shard * 9 / 10,
+      "too few movements: {}",
+      movements);
+    perf_tests::do_not_optimize(movements);
+}
+
 } // namespace
 
+PERF_TEST(lb, greedy_rebalance_after_restart) {
+    rebalance_bench<cluster::greedy_balanced_shards>();
+}
+PERF_TEST(lb, heap_rebalance_after_restart) {
+    rebalance_bench<cluster::heap_balanced_shards>();
+}
+
 PERF_TEST(lb, even_shard_load_movement) { balancer_bench(false); }
 PERF_TEST(lb, even_shard_load_all) { balancer_bench(true); }
 
@@ -15,6 +15,7 @@
 
 #include "absl/container/flat_hash_map.h"
 #include "cluster/scheduling/leader_balancer_greedy.h"
+#include "cluster/scheduling/leader_balancer_heap.h"
 #include "leader_balancer_test_utils.h"
 #include "model/metadata.h"
 
@@ -361,3 +362,69 @@ BOOST_AUTO_TEST_CASE(greedy_skip) {
     cluster::leader_balancer_types::muted_groups_t skip{5, 6};
     BOOST_REQUIRE(no_movement(spec, {0}, skip));
 }
+
+/**
+ * @brief Apply the movements of a strategy until it finds no more, check
+ * that each was valid and return the final leader counts per node.
+ */
+template<typename strategy_t>
+static std::vector<size_t>
+balance_to_completion(index_type index, strategy_t& strategy) {
+    while (auto movement = strategy.find_movement({})) {
+        check_valid(index, *movement);
+        auto replicas = index[movement->from][movement->group];
+        index[movement->from].erase(movement->group);
+        index[movement->to][movement->group] = std::move(replicas);
+        strategy.apply_movement(*movement);
+    }
+    std::vector<size_t> loads(index.size());
+    for (const auto& [shard, groups] : index) {
+        loads[shard.node_id()] = groups.size();
+    }
+    return loads;
+}
+
+BOOST_AUTO_TEST_CASE(heap_balances_like_greedy) {
+    const cluster_spec spec = {
+      {{1, 2, 3, 4, 5, 6, 7}, {-1}},
+      {{8}, {-1}},
+      {{}, {-1}},
+      {{}, {1, 2, 3}},
+    };
+
+    auto [index, greedy] = from_spec(spec);
+    auto greedy_loads = balance_to_completion(index, greedy);
+
+    cluster::heap_balanced_shards heap(index, {});
+    BOOST_REQUIRE_GT(heap.error(), 0);
+    auto heap_loads = balance_to_completion(index, heap);
+
+    BOOST_REQUIRE(heap_loads == (std::vector<size_t>{2, 2, 2, 2}));
+    BOOST_REQUIRE(heap_loads == greedy_loads);
+    BOOST_REQUIRE_LT(heap.error(), 0.000001);
+}
+
+BOOST_AUTO_TEST_CASE(heap_obeys_muted_nodes_and_groups) {
+    auto [index, _] = from_spec({
+      {{1, 2, 3, 4}, {-1}},
+      {{}, {-1}},
+      {{}, {-1}},
+    });
+
+    // node 2 is muted, so the leaders can only go to node 1
+    cluster::heap_balanced_shards heap(index, {model::node_id(2)});
+    auto loads = balance_to_completion(index, heap);
+    BOOST_REQUIRE(loads == (std::vector<size_t>{2, 2, 0}));
+
+    // with all groups but one skipped only that one can move
+    cluster::heap_balanced_shards skipping(index, {});
+    cluster::leader_balancer_types::muted_groups_t skip;
+    skip.add(uint64_t(1));
+    skip.add(uint64_t(2));
+    skip.add(uint64_t(3));
+    auto movement = skipping.find_movement(skip);
+    BOOST_REQUIRE(movement);
+    BOOST_REQUIRE_EQUAL(movement->group, raft::group_id(4));
+    skipping.apply_movement(*movement);
+    BOOST_REQUIRE(!skipping.find_movement(skip));
+}
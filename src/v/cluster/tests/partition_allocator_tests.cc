@@ -525,6 +525,33 @@ FIXTURE_TEST(rack_aware_assignment_2, partition_allocator_fixture) {
     BOOST_REQUIRE(racks.contains("rack-b"));
 }
 
+FIXTURE_TEST(rack_aware_batch_allocation, partition_allocator_fixture) {
+    std::map<model::node_id, model::rack_id> racks;
+    for (int id = 0; id < 6; ++id) {
+        auto rack = model::rack_id(fmt::format("rack-{}", id % 3));
+        register_node(id, 2, rack);
+        racks.emplace(model::node_id(id), std::move(rack));
+    }
+
+    // all partitions of the request are placed in a single batch
+    auto units
+      = allocator.allocate(make_allocation_request(100, 3)).get().value();
+    BOOST_REQUIRE_EQUAL(units->get_assignments().size(), 100);
+    for (const auto& group : units->get_assignments()) {
+        std::set<model::rack_id> group_racks;
+        for (const auto& bs : group.replicas) {
+            group_racks.insert(racks.at(bs.node_id));
+        }
+        BOOST_REQUIRE_EQUAL(group_racks.size(), 3);
+    }
+
+    // replicas are spread evenly between the nodes of each rack
+    for (const auto& [id, node] : allocator.state().allocation_nodes()) {
+        BOOST_REQUIRE_GE(node->allocated_partitions()(), 49);
+        BOOST_REQUIRE_LE(node->allocated_partitions()(), 51);
+    }
+}
+
 FIXTURE_TEST(even_distribution_pri_allocation, partition_allocator_fixture) {
     // allocate some regular partitions in the cluster but leave space
     register_node(0, 2);
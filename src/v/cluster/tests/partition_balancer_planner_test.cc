@@ -912,3 +912,31 @@ FIXTURE_TEST(balancing_modes, partition_balancer_planner_fixture) {
     BOOST_REQUIRE_EQUAL(plan_data.cancellations.size(), 0);
     BOOST_REQUIRE_EQUAL(plan_data.failed_actions_count, 0);
 }
+
+FIXTURE_TEST(test_ntps_on_node_index, partition_balancer_planner_fixture) {
+    allocator_register_nodes(3);
+    create_topic("topic-1", 4, 3);
+    allocator_register_nodes(1);
+
+    const auto& state = workers.state.local();
+    for (int i = 0; i < 3; ++i) {
+        BOOST_REQUIRE_EQUAL(state.ntps_on_node(n(i)).size(), 4);
+    }
+    BOOST_REQUIRE(state.ntps_on_node(n(3)).empty());
+
+    // The index follows the target replica set of a move and of its
+    // cancellation.
+    model::ntp ntp(test_ns, model::topic("topic-1"), model::partition_id(0));
+    move_partition_replicas(ntp, {n(1), n(2), n(3)});
+    BOOST_REQUIRE(!state.ntps_on_node(n(0)).contains(ntp));
+    BOOST_REQUIRE(state.ntps_on_node(n(3)).contains(ntp));
+
+    cancel_partition_move(ntp);
+    BOOST_REQUIRE(state.ntps_on_node(n(0)).contains(ntp));
+    BOOST_REQUIRE(!state.ntps_on_node(n(3)).contains(ntp));
+
+    delete_topic(model::topic("topic-1"));
+    for (int i = 0; i < 4; ++i) {
+        BOOST_REQUIRE(state.ntps_on_node(n(i)).empty());
+    }
+}
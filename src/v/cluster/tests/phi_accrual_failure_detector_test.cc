@@ -0,0 +1,89 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "cluster/phi_accrual_failure_detector.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace cluster;
+using namespace std::chrono_literals;
+
+namespace {
+phi_accrual_failure_detector make_detector(
+  phi_accrual_failure_detector::clock_type::time_point start,
+  std::chrono::milliseconds interval,
+  int heartbeats) {
+    phi_accrual_failure_detector detector(10ms);
+    for (int i = 0; i < heartbeats; ++i) {
+        detector.heartbeat(start + i * interval);
+    }
+    return detector;
+}
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(test_no_suspicion_without_history) {
+    const auto now = phi_accrual_failure_detector::clock_type::now();
+    phi_accrual_failure_detector detector(10ms);
+    BOOST_REQUIRE_EQUAL(detector.phi(now + 1h), 0);
+    BOOST_REQUIRE(!detector.last_heartbeat());
+
+    // a single heartbeat doesn't give an interval yet
+    detector.heartbeat(now);
+    BOOST_REQUIRE_EQUAL(detector.phi(now + 1h), 0);
+    BOOST_REQUIRE(detector.last_heartbeat() == now);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_suspicion_grows_with_silence) {
+    const auto start = phi_accrual_failure_detector::clock_type::now();
+    auto detector = make_detector(start, 100ms, 20);
+    const auto last = *detector.last_heartbeat();
+
+    const auto on_time = detector.phi(last + 100ms);
+    const auto late = detector.phi(last + 150ms);
+    const auto very_late = detector.phi(last + 300ms);
+    BOOST_REQUIRE_LT(on_time, 1.0);
+    BOOST_REQUIRE_LT(on_time, late);
+    BOOST_REQUIRE_LT(late, very_late);
+    BOOST_REQUIRE_GT(very_late, 3.0);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_adapts_to_heartbeat_cadence) {
+    const auto start = phi_accrual_failure_detector::clock_type::now();
+    auto fast = make_detector(start, 100ms, 20);
+    auto slow = make_detector(start, 1s, 20);
+
+    // the same silence is suspicious only for the peer that usually replies
+    // more often
+    BOOST_REQUIRE_GT(fast.phi(*fast.last_heartbeat() + 500ms), 3.0);
+    BOOST_REQUIRE_LT(slow.phi(*slow.last_heartbeat() + 500ms), 1.0);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_window_forgets_old_intervals) {
+    const auto start = phi_accrual_failure_detector::clock_type::now();
+    phi_accrual_failure_detector detector(10ms, 10);
+    auto at = start;
+    for (int i = 0; i < 10; ++i) {
+        at += 1s;
+        detector.heartbeat(at);
+    }
+    // cadence changes, the second series replaces the whole window
+    for (int i = 0; i < 20; ++i) {
+        at += 100ms;
+        detector.heartbeat(at);
+    }
+    BOOST_REQUIRE_GT(detector.phi(at + 500ms), 3.0);
+
+    // out of order heartbeats are ignored
+    detector.heartbeat(start);
+    BOOST_REQUIRE(detector.last_heartbeat() == at);
+}
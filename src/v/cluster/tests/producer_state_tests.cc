@@ -9,6 +9,7 @@
  * by the Apache License, Version 2.0
  */
 
+#include "base/units.h"
 #include "cluster/producer_state.h"
 #include "cluster/producer_state_manager.h"
 #include "config/mock_property.h"
@@ -44,11 +45,14 @@ struct test_fixture {
         }).get();
         config::shard_local_cfg().disable_metrics.set_value(true);
         _max_producers.start(default_max_producers).get();
+        _max_spilled_bytes.start(size_t(0)).get();
         _psm
           .start(
             ss::sharded_parameter(
               [this] { return _max_producers.local().bind(); }),
-            default_producer_expiration)
+            default_producer_expiration,
+            ss::sharded_parameter(
+              [this] { return _max_spilled_bytes.local().bind(); }))
           .get();
         _psm.invoke_on_all(&cluster::producer_state_manager::start).get();
         check_producers(0);
@@ -57,6 +61,7 @@ struct test_fixture {
     ~test_fixture() {
         _max_producers.stop().get();
         _psm.stop().get();
+        _max_spilled_bytes.stop().get();
     }
 
     cluster::producer_ptr
@@ -84,6 +89,7 @@ struct test_fixture {
 
     long _counter = 0;
     ss::sharded<config::mock_property<uint64_t>> _max_producers;
+    ss::sharded<config::mock_property<size_t>> _max_spilled_bytes;
     ss::sharded<cluster::producer_state_manager> _psm;
 };
 
@@ -174,7 +180,9 @@ FIXTURE_TEST(test_eviction_expired_pids, test_fixture) {
     psm
       .start(
         ss::sharded_parameter([this] { return _max_producers.local().bind(); }),
-        100ms)
+        100ms,
+        ss::sharded_parameter(
+          [this] { return _max_spilled_bytes.local().bind(); }))
       .get();
     psm.invoke_on_all(&cluster::producer_state_manager::start).get();
     auto deferred = ss::defer([&] { psm.stop().get(); });
@@ -197,3 +205,73 @@ FIXTURE_TEST(test_eviction_expired_pids, test_fixture) {
       10s, [&] { return evicted_so_far == total_producers; });
     clean(producers);
 }
+
+FIXTURE_TEST(test_evicted_producers_are_spilled, test_fixture) {
+    _max_spilled_bytes.local().update(1_MiB);
+    int evicted_so_far = 0;
+    std::vector<cluster::producer_ptr> producers;
+    const size_t extra_producers = 5;
+    for (int i = 0; i < default_max_producers + extra_producers; i++) {
+        auto producer = new_producer([&] { evicted_so_far++; });
+        producer->update(
+          model::batch_identity{
+            .pid = producer->_id, .first_seq = 0, .last_seq = 9},
+          kafka::offset(i));
+        producers.push_back(std::move(producer));
+    }
+
+    RPTEST_REQUIRE_EVENTUALLY(
+      10s, [&] { return evicted_so_far == extra_producers; });
+    BOOST_REQUIRE_EQUAL(manager()._spilled.size(), extra_producers);
+
+    // the evicted producers resume from their last sequence
+    for (int i = 0; i < extra_producers; i++) {
+        auto& evicted = *producers[i];
+        auto state = manager().take_spilled(evicted._group, evicted._id);
+        BOOST_REQUIRE(state.has_value());
+        BOOST_REQUIRE_EQUAL(state->_finished_requests.size(), 1);
+        BOOST_REQUIRE_EQUAL(state->_finished_requests[0]._last_sequence, 9);
+        BOOST_REQUIRE_EQUAL(
+          state->_finished_requests[0]._last_offset, kafka::offset(i));
+        cluster::producer_state rehydrated(manager(), [] {}, std::move(*state));
+        BOOST_REQUIRE_EQUAL(rehydrated.last_sequence_number(), 9);
+        BOOST_REQUIRE(!manager().take_spilled(evicted._group, evicted._id));
+    }
+    BOOST_REQUIRE_EQUAL(manager()._spilled_bytes, 0);
+
+    clean(producers);
+}
+
+FIXTURE_TEST(test_spilled_producers_memory_limit, test_fixture) {
+    _max_spilled_bytes.local().update(1_MiB);
+    int evicted_so_far = 0;
+    std::vector<cluster::producer_ptr> producers;
+    const size_t extra_producers = 5;
+    for (int i = 0; i < default_max_producers + extra_producers; i++) {
+        auto producer = new_producer([&] { evicted_so_far++; });
+        producer->update(
+          model::batch_identity{
+            .pid = producer->_id, .first_seq = 0, .last_seq = 0},
+          kafka::offset(i));
+        producers.push_back(std::move(producer));
+    }
+    RPTEST_REQUIRE_EVENTUALLY(
+      10s, [&] { return evicted_so_far == extra_producers; });
+    BOOST_REQUIRE_EQUAL(manager()._spilled.size(), extra_producers);
+
+    // lowering the limit drops the producers spilled first
+    const auto entry_bytes = manager()._spilled_bytes / extra_producers;
+    _max_spilled_bytes.local().update(entry_bytes * 2);
+    RPTEST_REQUIRE_EVENTUALLY(
+      10s, [&] { return manager()._spilled.size() == 2; });
+    BOOST_REQUIRE(
+      !manager().take_spilled(producers[0]->_group, producers[0]->_id));
+    BOOST_REQUIRE(
+      manager().take_spilled(producers[4]->_group, producers[4]->_id));
+
+    // resetting the producers of a group forgets its spilled producers
+    manager().drop_spilled(producers[3]->_group);
+    BOOST_REQUIRE_EQUAL(manager()._spilled.size(), 0);
+
+    clean(producers);
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "cluster/reconciliation_scheduler.h"
+
+#include <seastar/core/semaphore.hh>
+#include <seastar/testing/thread_test_case.hh>
+#include <seastar/util/later.hh>
+
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+using namespace cluster;
+using priority = reconciliation_scheduler::priority;
+
+SEASTAR_THREAD_TEST_CASE(test_blocked_until_capacity_is_set) {
+    reconciliation_scheduler scheduler;
+    auto f = scheduler.acquire(priority::normal);
+    ss::yield().get();
+    BOOST_REQUIRE(!f.available());
+    BOOST_REQUIRE_EQUAL(scheduler.waiting(), 1);
+
+    scheduler.set_capacity(1);
+    auto units = f.get();
+    BOOST_REQUIRE_EQUAL(scheduler.running(), 1);
+    BOOST_REQUIRE_EQUAL(scheduler.waiting(), 0);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_high_priority_goes_first) {
+    reconciliation_scheduler scheduler;
+    scheduler.set_capacity(1);
+    auto first = scheduler.acquire(priority::normal).get();
+
+    std::vector<int> order;
+    auto normal = scheduler.acquire(priority::normal).then(
+      [&order](reconciliation_scheduler::units u) {
+          order.push_back(0);
+          return u;
+      });
+    auto high = scheduler.acquire(priority::high).then(
+      [&order](reconciliation_scheduler::units u) {
+          order.push_back(1);
+          return u;
+      });
+    ss::yield().get();
+    BOOST_REQUIRE_EQUAL(scheduler.waiting(), 2);
+
+    // releasing the slot grants it to the high priority waiter
+    { auto released = std::move(first); }
+    auto high_units = std::move(high).get();
+    BOOST_REQUIRE_EQUAL(order.size(), 1);
+    BOOST_REQUIRE_EQUAL(order[0], 1);
+
+    { auto released = std::move(high_units); }
+    auto normal_units = std::move(normal).get();
+    BOOST_REQUIRE_EQUAL(order.size(), 2);
+    BOOST_REQUIRE_EQUAL(scheduler.running(), 1);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_broken_fails_waiters) {
+    reconciliation_scheduler scheduler;
+    auto f = scheduler.acquire(priority::high);
+    scheduler.broken();
+    BOOST_REQUIRE_THROW(f.get(), ss::broken_semaphore);
+    BOOST_REQUIRE_THROW(
+      scheduler.acquire(priority::high).get(), ss::broken_semaphore);
+}
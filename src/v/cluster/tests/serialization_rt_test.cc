@@ -798,6 +798,18 @@ SEASTAR_THREAD_TEST_CASE(serde_reflection_roundtrip) {
       tests::random_named_int<model::revision_id>());
     roundtrip_test(cluster::update_leadership_request_v2(std::move(l_revs)));
 
+    fragmented_vector<cluster::topic_leaders> topic_leaders;
+    auto& topic = topic_leaders.emplace_back();
+    topic.tp_ns = model::random_topic_namespace();
+    topic.partitions.push_back(cluster::partition_leader_revision{
+      .id = tests::random_named_int<model::partition_id>(),
+      .term = tests::random_named_int<model::term_id>(),
+      .leader_id = tests::random_named_int<model::node_id>(),
+      .revision = tests::random_named_int<model::revision_id>(),
+    });
+    roundtrip_test(
+      cluster::update_leadership_request_v2(std::move(topic_leaders)));
+
     roundtrip_test(cluster::update_leadership_reply());
 
     roundtrip_test(cluster::get_leadership_request());
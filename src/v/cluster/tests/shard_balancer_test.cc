@@ -0,0 +1,117 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "cluster/shard_balancer.h"
+#include "model/namespace.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace cluster;
+
+namespace {
+
+model::ntp make_ntp(int partition) {
+    return {
+      model::kafka_namespace,
+      model::topic("t"),
+      model::partition_id(partition)};
+}
+
+void add(
+  chunked_vector<partition_shard_load>& loads,
+  ss::shard_id shard,
+  double load,
+  bool movable = true) {
+    loads.push_back(partition_shard_load{
+      .ntp = make_ntp(static_cast<int>(loads.size())),
+      .shard = shard,
+      .load = load,
+      .movable = movable,
+    });
+}
+
+std::vector<double>
+loads_after(const chunked_vector<partition_shard_load>& loads, size_t shards) {
+    auto moves = plan_shard_load_moves(loads, shards, 0.25, 100);
+    std::vector<double> ret(shards, 0);
+    for (const auto& p : loads) {
+        auto shard = p.shard;
+        for (const auto& m : moves) {
+            if (m.ntp == p.ntp) {
+                BOOST_REQUIRE_EQUAL(m.from, p.shard);
+                shard = m.to;
+            }
+        }
+        ret[shard] += p.load;
+    }
+    return ret;
+}
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(test_hot_partitions_are_spread) {
+    chunked_vector<partition_shard_load> loads;
+    // two hot partitions and some cold ones on shard 0
+    add(loads, 0, 100);
+    add(loads, 0, 100);
+    for (int i = 0; i < 10; ++i) {
+        add(loads, 0, 1);
+        add(loads, 1, 1);
+        add(loads, 2, 1);
+    }
+
+    auto after = loads_after(loads, 3);
+    auto [min, max] = std::minmax_element(after.begin(), after.end());
+    BOOST_REQUIRE_LE(*max, 110);
+    BOOST_REQUIRE_GE(*min, 10);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_no_moves_within_threshold) {
+    chunked_vector<partition_shard_load> loads;
+    add(loads, 0, 12);
+    add(loads, 1, 10);
+    add(loads, 2, 9);
+    BOOST_REQUIRE(plan_shard_load_moves(loads, 3, 0.25, 100).empty());
+
+    // no load measured yet
+    chunked_vector<partition_shard_load> idle;
+    add(idle, 0, 0);
+    add(idle, 0, 0);
+    BOOST_REQUIRE(plan_shard_load_moves(idle, 2, 0.25, 100).empty());
+}
+
+SEASTAR_THREAD_TEST_CASE(test_moves_dont_overshoot) {
+    chunked_vector<partition_shard_load> loads;
+    // moving the single partition would just swap the busy shard
+    add(loads, 0, 100);
+    BOOST_REQUIRE(plan_shard_load_moves(loads, 2, 0.25, 100).empty());
+
+    // a replica that can't move is left in place
+    chunked_vector<partition_shard_load> pinned;
+    add(pinned, 0, 50, false);
+    add(pinned, 0, 50, false);
+    BOOST_REQUIRE(plan_shard_load_moves(pinned, 2, 0.25, 100).empty());
+}
+
+SEASTAR_THREAD_TEST_CASE(test_moves_are_limited) {
+    chunked_vector<partition_shard_load> loads;
+    for (int i = 0; i < 100; ++i) {
+        add(loads, 0, 1);
+    }
+    auto moves = plan_shard_load_moves(loads, 4, 0.25, 8);
+    BOOST_REQUIRE_EQUAL(moves.size(), 8);
+    for (const auto& m : moves) {
+        BOOST_REQUIRE_EQUAL(m.from, 0);
+        BOOST_REQUIRE_NE(m.to, 0);
+    }
+}
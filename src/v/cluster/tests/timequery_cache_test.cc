@@ -0,0 +1,77 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+#include "cluster/timequery_cache.h"
+#include "test_utils/test.h"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+storage::timequery_config
+make_query(int64_t ts, int64_t max_offset = 1000) {
+    return {
+      model::timestamp(ts),
+      model::offset(max_offset),
+      ss::default_priority_class(),
+      model::record_batch_type::raft_data};
+}
+
+const cluster::timequery_cache::log_state state{
+  .term = model::term_id(1),
+  .local_start = model::offset(10),
+  .cloud_start = model::offset(0),
+};
+
+} // namespace
+
+struct fixture : public seastar_test {};
+
+TEST_F(fixture, test_cached_results) {
+    cluster::timequery_cache cache;
+    EXPECT_FALSE(cache.get(make_query(100), state).has_value());
+
+    cache.put(
+      make_query(100),
+      state,
+      storage::timequery_result(model::offset(42), model::timestamp(105)));
+    auto hit = cache.get(make_query(100), state);
+    ASSERT_TRUE(hit.has_value());
+    EXPECT_EQ(hit->offset, model::offset(42));
+    EXPECT_EQ(hit->time, model::timestamp(105));
+
+    // other timestamps and results beyond the queried offset are missed
+    EXPECT_FALSE(cache.get(make_query(101), state).has_value());
+    EXPECT_FALSE(cache.get(make_query(100, 20), state).has_value());
+}
+
+TEST_F(fixture, test_invalidation) {
+    cluster::timequery_cache cache;
+    cache.put(
+      make_query(100),
+      state,
+      storage::timequery_result(model::offset(42), model::timestamp(105)));
+
+    auto truncated = state;
+    truncated.local_start = model::offset(50);
+    EXPECT_FALSE(cache.get(make_query(100), truncated).has_value());
+    EXPECT_EQ(cache.size(), 0);
+}
+
+TEST_F(fixture, test_bounded_size) {
+    cluster::timequery_cache cache;
+    for (size_t i = 0; i <= cluster::timequery_cache::max_entries; ++i) {
+        cache.put(
+          make_query(i),
+          state,
+          storage::timequery_result(model::offset(i), model::timestamp(i)));
+    }
+    EXPECT_EQ(cache.size(), cluster::timequery_cache::max_entries);
+    EXPECT_FALSE(cache.get(make_query(0), state).has_value());
+    EXPECT_TRUE(cache.get(make_query(1), state).has_value());
+}
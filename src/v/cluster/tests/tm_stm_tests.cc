@@ -27,6 +27,7 @@
 #include "test_utils/async.h"
 
 #include <seastar/core/sstring.hh>
+#include <seastar/testing/thread_test_case.hh>
 #include <seastar/util/defer.hh>
 
 #include <cstdint>
@@ -198,3 +199,47 @@ FIXTURE_TEST(test_tm_stm_re_tx, tm_stm_test_fixture) {
     BOOST_REQUIRE_EQUAL(tx7.status, tx_status::ready);
     BOOST_REQUIRE_EQUAL(tx7.partitions.size(), 0);
 }
+
+SEASTAR_THREAD_TEST_CASE(test_tm_stm_cache_compacts_finished_txes) {
+    cluster::tm_stm_cache cache;
+
+    tm_transaction tx;
+    tx.id = kafka::transactional_id("app-id-1");
+    tx.pid = model::producer_identity{1, 0};
+    tx.last_pid = model::producer_identity{1, 1};
+    tx.tx_seq = model::tx_seq(5);
+    tx.etag = model::term_id(3);
+    tx.status = tx_status::ongoing;
+    tx.timeout_ms = std::chrono::milliseconds(100);
+    tx.last_update_ts = ss::lowres_system_clock::now();
+    tx.partitions.push_back(tm_transaction::tx_partition{
+      .ntp = model::ntp("kafka", "topic", 0), .etag = model::term_id(3)});
+
+    cache.set_log(tx);
+    auto ongoing_memory = cache.tx_cache_memory();
+    BOOST_REQUIRE_GT(ongoing_memory, 0);
+    BOOST_REQUIRE_EQUAL(cache.find_log(tx.id)->partitions.size(), 1);
+
+    // a finished tx is kept in the compact form
+    tx.status = tx_status::ready;
+    tx.partitions.clear();
+    cache.set_log(tx);
+    BOOST_REQUIRE_LT(cache.tx_cache_memory(), ongoing_memory);
+    BOOST_REQUIRE_EQUAL(cache.tx_cache_size(), 1);
+
+    auto found = cache.find_log(tx.id);
+    BOOST_REQUIRE(found.has_value());
+    BOOST_REQUIRE_EQUAL(found->id, tx.id);
+    BOOST_REQUIRE_EQUAL(found->pid, tx.pid);
+    BOOST_REQUIRE_EQUAL(found->last_pid, tx.last_pid);
+    BOOST_REQUIRE_EQUAL(found->tx_seq, tx.tx_seq);
+    BOOST_REQUIRE_EQUAL(found->etag, tx.etag);
+    BOOST_REQUIRE_EQUAL(found->status, tx_status::ready);
+    BOOST_REQUIRE_EQUAL(found->timeout_ms, tx.timeout_ms);
+    BOOST_REQUIRE(found->last_update_ts == tx.last_update_ts);
+    BOOST_REQUIRE_EQUAL(cache.oldest_tx()->id, tx.id);
+
+    cache.erase_log(tx.id);
+    BOOST_REQUIRE_EQUAL(cache.tx_cache_memory(), 0);
+    BOOST_REQUIRE_EQUAL(cache.tx_cache_size(), 0);
+}
@@ -0,0 +1,34 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "cluster/partition_probe.h"
+#include "model/metadata.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+SEASTAR_THREAD_TEST_CASE(test_topic_rollups_are_shared_per_topic) {
+    model::topic_namespace a(model::ns("kafka"), model::topic("a"));
+    model::topic_namespace b(model::ns("kafka"), model::topic("b"));
+
+    auto a1 = cluster::topic_rollup_probe::get(a);
+    auto a2 = cluster::topic_rollup_probe::get(a);
+    auto b1 = cluster::topic_rollup_probe::get(b);
+    BOOST_REQUIRE_EQUAL(a1.get(), a2.get());
+    BOOST_REQUIRE_NE(a1.get(), b1.get());
+
+    // The rollup goes away with the last partition holding it
+    a1 = nullptr;
+    BOOST_REQUIRE_EQUAL(cluster::topic_rollup_probe::get(a).get(), a2.get());
+    a2 = nullptr;
+    b1 = nullptr;
+    auto b2 = cluster::topic_rollup_probe::get(b);
+    BOOST_REQUIRE_EQUAL(b2.use_count(), 1);
+}
@@ -548,3 +548,56 @@ FIXTURE_TEST(test_topic_table_iterator_invalidation, topic_table_fixture) {
     add_random_topic(); // invalidates iterator
     BOOST_REQUIRE_THROW((void)it->first, iterator_stability_violation);
 }
+
+FIXTURE_TEST(test_topics_snapshot_sharing, topic_table_fixture) {
+    create_topics();
+    auto& topics = table.local();
+
+    auto snap_1 = topics.get_topics_snapshot();
+    BOOST_REQUIRE_EQUAL(snap_1->topics().size(), 3);
+    // no changes, same snapshot
+    BOOST_REQUIRE(topics.get_topics_snapshot() == snap_1);
+
+    topics
+      .apply(
+        cluster::delete_topic_cmd(
+          make_tp_ns("test_tp_3"), make_tp_ns("test_tp_3")),
+        model::offset(1))
+      .get();
+    auto snap_2 = topics.get_topics_snapshot();
+    BOOST_REQUIRE(snap_2 != snap_1);
+    BOOST_REQUIRE(snap_2->find(make_tp_ns("test_tp_3")) == nullptr);
+    BOOST_REQUIRE(snap_1->find(make_tp_ns("test_tp_3")) != nullptr);
+    // unchanged topics are shared
+    BOOST_REQUIRE(
+      snap_2->find(make_tp_ns("test_tp_1"))
+      == snap_1->find(make_tp_ns("test_tp_1")));
+    BOOST_REQUIRE(
+      snap_2->find(make_tp_ns("test_tp_2"))
+      == snap_1->find(make_tp_ns("test_tp_2")));
+
+    cluster::incremental_topic_updates update;
+    update.record_key_schema_id_validation.op
+      = cluster::incremental_update_operation::set;
+    update.record_key_schema_id_validation.value.emplace(true);
+    auto ec = topics
+                .apply(
+                  cluster::update_topic_properties_cmd{
+                    make_tp_ns("test_tp_1"), update},
+                  model::offset{2})
+                .get();
+    BOOST_REQUIRE_EQUAL(ec, cluster::errc::success);
+
+    auto snap_3 = topics.get_topics_snapshot();
+    const auto* tp_1 = snap_3->find(make_tp_ns("test_tp_1"));
+    BOOST_REQUIRE(tp_1 != snap_2->find(make_tp_ns("test_tp_1")));
+    BOOST_REQUIRE(tp_1->get_configuration()
+                    .properties.record_key_schema_id_validation.has_value());
+    // the previous snapshot still has the previous configuration
+    BOOST_REQUIRE(!snap_2->find(make_tp_ns("test_tp_1"))
+                     ->get_configuration()
+                     .properties.record_key_schema_id_validation.has_value());
+    BOOST_REQUIRE(
+      snap_3->find(make_tp_ns("test_tp_2"))
+      == snap_1->find(make_tp_ns("test_tp_2")));
+}
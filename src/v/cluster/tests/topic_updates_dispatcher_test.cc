@@ -135,6 +135,41 @@ FIXTURE_TEST(
       max_cluster_capacity() - 3);
 }
 
+FIXTURE_TEST(
+  test_dispatching_bulk_delete, topic_table_updates_dispatcher_fixture) {
+    create_topics();
+    auto make_deletion = [](const char* tp) {
+        return cluster::topic_lifecycle_transition{
+          .topic = {.nt = make_tp_ns(tp)},
+          .mode = cluster::topic_lifecycle_transition_mode::oneshot_delete};
+    };
+
+    // nothing is deleted if one of the topics doesn't exist
+    cluster::bulk_topic_lifecycle_transition_cmd_data invalid;
+    invalid.transitions.push_back(make_deletion("test_tp_2"));
+    invalid.transitions.push_back(make_deletion("not_exists"));
+    auto res = dispatcher
+                 .apply_update(serde_serialize_cmd(
+                   cluster::bulk_topic_lifecycle_transition_cmd{
+                     0, std::move(invalid)}))
+                 .get();
+    BOOST_REQUIRE_EQUAL(res, cluster::errc::topic_not_exists);
+    BOOST_REQUIRE_EQUAL(table.local().all_topics_metadata().size(), 3);
+
+    cluster::bulk_topic_lifecycle_transition_cmd_data data;
+    data.transitions.push_back(make_deletion("test_tp_2"));
+    data.transitions.push_back(make_deletion("test_tp_3"));
+    dispatch_command(
+      cluster::bulk_topic_lifecycle_transition_cmd{0, std::move(data)});
+
+    auto& md = table.local().all_topics_metadata();
+    BOOST_REQUIRE_EQUAL(md.size(), 1);
+    BOOST_REQUIRE_EQUAL(md.contains(make_tp_ns("test_tp_1")), true);
+    BOOST_REQUIRE_EQUAL(
+      current_cluster_capacity(allocator.local().state().allocation_nodes()),
+      max_cluster_capacity() - 3);
+}
+
 FIXTURE_TEST(
   test_dispatching_conflicts, topic_table_updates_dispatcher_fixture) {
     create_topics();
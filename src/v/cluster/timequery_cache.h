@@ -0,0 +1,102 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "model/fundamental.h"
+#include "model/record_batch_types.h"
+#include "model/timestamp.h"
+#include "storage/types.h"
+
+#include <algorithm>
+#include <deque>
+#include <optional>
+
+namespace cluster {
+
+/**
+ * Results of the recent timequeries of a partition.
+ *
+ * A timequery searches the segment indices and then scans the batches that
+ * follow the index entry it lands on, and for timestamps of tiered data it
+ * may have to hydrate segments. Its result is the first batch with a
+ * timestamp not below the one queried, so appends to the log do not change
+ * it: the results are kept here and answer the same queries, e.g. of every
+ * group reset to the same time, until the log is truncated or one of its
+ * start offsets moves.
+ */
+class timequery_cache {
+public:
+    static constexpr size_t max_entries = 32;
+
+    /// The state of the log the cached results are valid for.
+    struct log_state {
+        model::term_id term;
+        model::offset local_start;
+        model::offset cloud_start;
+
+        bool operator==(const log_state&) const = default;
+    };
+
+    std::optional<storage::timequery_result>
+    get(const storage::timequery_config& cfg, const log_state& state) {
+        maybe_invalidate(state);
+        auto it = find(cfg);
+        if (it == _entries.end() || it->result.offset > cfg.max_offset) {
+            return std::nullopt;
+        }
+        return it->result;
+    }
+
+    void put(
+      const storage::timequery_config& cfg,
+      const log_state& state,
+      storage::timequery_result result) {
+        maybe_invalidate(state);
+        auto it = find(cfg);
+        if (it != _entries.end()) {
+            it->result = result;
+            return;
+        }
+        _entries.push_back(entry{
+          .time = cfg.time, .type_filter = cfg.type_filter, .result = result});
+        if (_entries.size() > max_entries) {
+            _entries.pop_front();
+        }
+    }
+
+    size_t size() const { return _entries.size(); }
+
+private:
+    struct entry {
+        model::timestamp time;
+        std::optional<model::record_batch_type> type_filter;
+        storage::timequery_result result;
+    };
+
+    void maybe_invalidate(const log_state& state) {
+        if (state != _state) {
+            _entries.clear();
+            _state = state;
+        }
+    }
+
+    std::deque<entry>::iterator find(const storage::timequery_config& cfg) {
+        return std::find_if(
+          _entries.begin(), _entries.end(), [&cfg](const entry& e) {
+              return e.time == cfg.time && e.type_filter == cfg.type_filter;
+          });
+    }
+
+    log_state _state;
+    std::deque<entry> _entries;
+};
+
+} // namespace cluster
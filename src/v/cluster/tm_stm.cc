@@ -989,6 +989,8 @@ ss::future<tm_stm::get_txs_result> tm_stm::get_all_transactions() {
 
 size_t tm_stm::tx_cache_size() const { return _cache->tx_cache_size(); }
 
+size_t tm_stm::tx_cache_memory() const { return _cache->tx_cache_memory(); }
+
 std::optional<tm_transaction> tm_stm::oldest_tx() const {
     return _cache->oldest_tx();
 }
@@ -361,6 +361,8 @@ public:
 
     size_t tx_cache_size() const;
 
+    size_t tx_cache_memory() const;
+
     std::optional<tm_transaction> oldest_tx() const;
     ss::future<iobuf> take_snapshot(model::offset) final { co_return iobuf{}; }
 
@@ -36,6 +36,57 @@ std::ostream& operator<<(std::ostream& o, const tm_transaction& tx) {
              << ", tx_seq=" << tx.tx_seq << "}";
 }
 
+void tm_stm_cache::tx_wrapper::set(const tm_transaction& tx) {
+    const bool finished = tx.status == tm_transaction::tx_status::ready
+                          && tx.partitions.empty() && tx.groups.empty()
+                          && !tx.transferring;
+    if (!finished) {
+        full = std::make_unique<tm_transaction>(tx);
+        return;
+    }
+    full.reset();
+    compact = compact_tx{
+      .pid = tx.pid,
+      .last_pid = tx.last_pid,
+      .tx_seq = tx.tx_seq,
+      .etag = tx.etag,
+      .timeout_ms = tx.timeout_ms,
+      .last_update_ts = tx.last_update_ts,
+    };
+}
+
+tm_transaction tm_stm_cache::tx_wrapper::get() const {
+    if (full) {
+        return *full;
+    }
+    tm_transaction tx;
+    tx.id = *id;
+    tx.pid = compact.pid;
+    tx.last_pid = compact.last_pid;
+    tx.tx_seq = compact.tx_seq;
+    tx.etag = compact.etag;
+    tx.status = tm_transaction::tx_status::ready;
+    tx.timeout_ms = compact.timeout_ms;
+    tx.last_update_ts = compact.last_update_ts;
+    return tx;
+}
+
+size_t tm_stm_cache::tx_wrapper::memory_usage() const {
+    size_t ret = sizeof(kafka::transactional_id) + sizeof(tx_wrapper)
+                 + (*id)().size();
+    if (!full) {
+        return ret;
+    }
+    ret += sizeof(tm_transaction) + (*id)().size();
+    for (const auto& p : full->partitions) {
+        ret += sizeof(p) + p.ntp.ns().size() + p.ntp.tp.topic().size();
+    }
+    for (const auto& g : full->groups) {
+        ret += sizeof(g) + g.group_id().size();
+    }
+    return ret;
+}
+
 std::optional<tm_transaction>
 tm_stm_cache::find(model::term_id term, kafka::transactional_id tx_id) {
     vlog(txlog.trace, "[tx_id={}] looking for tx with term: {}", tx_id, term);
@@ -79,25 +130,22 @@ tm_stm_cache::find(model::term_id term, kafka::transactional_id tx_id) {
         return std::nullopt;
     }
 
-    if (log_it->second.tx.etag != term) {
+    auto tx = log_it->second.get();
+    if (tx.etag != term) {
         vlog(
           txlog.trace,
           "[tx_id={}] looking for tx with etag: {}: found a tx with etag: {} "
           "pid: {} tx_seq: {} (wrong etag)",
           tx_id,
           term,
-          log_it->second.tx.etag,
-          log_it->second.tx.pid,
-          log_it->second.tx.tx_seq);
+          tx.etag,
+          tx.pid,
+          tx.tx_seq);
         return std::nullopt;
     }
     vlog(
-      txlog.trace,
-      "[tx_id={}] found tx with etag: {} - {}",
-      tx_id,
-      term,
-      log_it->second.tx);
-    return log_it->second.tx;
+      txlog.trace, "[tx_id={}] found tx with etag: {} - {}", tx_id, term, tx);
+    return tx;
 }
 
 std::optional<tm_transaction>
@@ -124,7 +172,7 @@ tm_stm_cache::find_log(kafka::transactional_id tx_id) {
     if (tx_it == _log_txes.end()) {
         return std::nullopt;
     }
-    return tx_it->second.tx;
+    return tx_it->second.get();
 }
 
 void tm_stm_cache::set_log(tm_transaction tx) {
@@ -136,10 +184,15 @@ void tm_stm_cache::set_log(tm_transaction tx) {
       tx.pid,
       tx.tx_seq);
 
-    auto [tx_it, inserted] = _log_txes.try_emplace(tx.id, tx);
-    if (!inserted) {
-        tx_it->second.tx = tx;
+    auto [tx_it, inserted] = _log_txes.try_emplace(tx.id);
+    auto& wrapper = tx_it->second;
+    if (inserted) {
+        wrapper.id = &tx_it->first;
+    } else {
+        _log_memory -= wrapper.memory_usage();
     }
+    wrapper.set(tx);
+    _log_memory += wrapper.memory_usage();
 
     if (tx_it->second._hook.is_linked()) {
         tx_it->second._hook.unlink();
@@ -158,7 +211,7 @@ void tm_stm_cache::erase_log(kafka::transactional_id tx_id) {
     if (tx_it == _log_txes.end()) {
         return;
     }
-    auto& tx = tx_it->second.tx;
+    auto tx = tx_it->second.get();
     vlog(
       txlog.trace,
       "[tx_id= {}] erasing tx with etag: {} pid: {} tx_seq: {} from log",
@@ -166,13 +219,14 @@ void tm_stm_cache::erase_log(kafka::transactional_id tx_id) {
       tx.etag,
       tx.pid,
       tx.tx_seq);
+    _log_memory -= tx_it->second.memory_usage();
     _log_txes.erase(tx_it);
 }
 
 fragmented_vector<tm_transaction> tm_stm_cache::get_log_transactions() {
     fragmented_vector<tm_transaction> txes;
     for (auto& entry : _log_txes) {
-        txes.push_back(entry.second.tx);
+        txes.push_back(entry.second.get());
     }
     return txes;
 }
@@ -209,6 +263,7 @@ void tm_stm_cache::clear_mem() {
 void tm_stm_cache::clear_log() {
     vlog(txlog.trace, "clearing log");
     _log_txes.clear();
+    _log_memory = 0;
 }
 
 void tm_stm_cache::erase_mem(kafka::transactional_id tx_id) {
@@ -245,7 +300,7 @@ fragmented_vector<tm_transaction> tm_stm_cache::get_all_transactions() {
             for (const auto& [id, tx] : _log_txes) {
                 auto tx_it = entry_it->second.txes.find(id);
                 if (tx_it == entry_it->second.txes.end()) {
-                    ans.push_back(tx.tx);
+                    ans.push_back(tx.get());
                 }
             }
             return ans;
@@ -288,7 +343,7 @@ std::optional<tm_transaction> tm_stm_cache::oldest_tx() const {
         return std::nullopt;
     }
 
-    return lru_txes.front().tx;
+    return lru_txes.front().get();
 }
 
 size_t tm_stm_cache::tx_cache_size() const { return lru_txes.size(); }
@@ -216,7 +216,7 @@ public:
     filter_all_txid_by_tx(Func&& func) {
         absl::btree_set<kafka::transactional_id> ids;
         for (auto& [id, entry] : _log_txes) {
-            if (func(entry.tx)) {
+            if (func(entry.get())) {
                 ids.insert(id);
             }
         }
@@ -243,14 +243,34 @@ public:
 
     size_t tx_cache_size() const;
 
-private:
-    struct tx_wrapper {
-        tx_wrapper() = default;
+    // estimated memory used by the transactions known from the log, the
+    // finished ones are counted in their compact form
+    size_t tx_cache_memory() const { return _log_memory; }
 
-        tx_wrapper(const tm_transaction& tx)
-          : tx(tx) {}
+private:
+    // Finished transactions (ready, without partitions and groups) don't need
+    // most of tm_transaction, so they are kept in this compact form and are
+    // materialized on access. Most of the transactional ids of a coordinator
+    // are usually in this state until they expire.
+    struct compact_tx {
+        model::producer_identity pid;
+        model::producer_identity last_pid;
+        model::tx_seq tx_seq;
+        model::term_id etag;
+        std::chrono::milliseconds timeout_ms;
+        ss::lowres_system_clock::time_point last_update_ts;
+    };
 
-        tm_transaction tx;
+    struct tx_wrapper {
+        void set(const tm_transaction&);
+        tm_transaction get() const;
+        size_t memory_usage() const;
+
+        // key of the entry in _log_txes
+        const kafka::transactional_id* id{nullptr};
+        // set unless the transaction is finished
+        std::unique_ptr<tm_transaction> full;
+        compact_tx compact;
         intrusive_list_hook _hook;
     };
 
@@ -266,6 +286,7 @@ private:
     // last tx per each term
     absl::node_hash_map<model::term_id, tm_stm_cache_entry> _state;
     absl::node_hash_map<kafka::transactional_id, tx_wrapper> _log_txes;
+    size_t _log_memory{0};
     // when a node is a leader _mem_term contains its term to let find_mem
     // fetch txes without specifying it
     std::optional<model::term_id> _mem_term;
@@ -18,6 +18,7 @@
 #include "cluster/topics_frontend.h"
 #include "cluster/types.h"
 
+#include <seastar/core/loop.hh>
 #include <seastar/http/request.hh>
 #include <seastar/util/defer.hh>
 
@@ -26,6 +27,7 @@
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/algorithm/string/split.hpp>
 #include <boost/outcome/try.hpp>
+#include <boost/range/irange.hpp>
 #include <boost/uuid/random_generator.hpp>
 #include <boost/uuid/uuid_io.hpp>
 
@@ -241,27 +243,37 @@ static ss::future<std::vector<remote_segment_path>> collect_manifest_paths(
                          as, cfg.operation_timeout_ms, cfg.backoff_ms),
                        fmt::format("{}0000000/", hex_ch),
                        [&](auto& rtc, auto& prefix) {
+                           auto first = paths.size();
                            return remote
-                             .list_objects(
+                             .list_objects_paged(
                                cfg.bucket,
                                *rtc,
+                               [&](cloud_storage_clients::client::
+                                     list_bucket_result page) {
+                                   for (auto& item : page.contents) {
+                                       vlog(
+                                         cst_log.trace,
+                                         "adding path {} for {}",
+                                         item.key,
+                                         prefix);
+                                       paths.emplace_back(
+                                         std::move(item.key));
+                                   }
+                                   return ss::make_ready_future<
+                                     ss::stop_iteration>(
+                                     ss::stop_iteration::no);
+                               },
                                cloud_storage_clients::object_key{prefix})
-                             .then([&](auto meta) {
-                                 if (meta.has_error()) {
+                             .then([&, first](auto res) {
+                                 if (res.has_error()) {
                                      vlog(
                                        cst_log.error,
                                        "Failed to list meta items: {}",
-                                       meta.error());
-                                     return;
-                                 }
-
-                                 for (auto&& item : meta.value().contents) {
-                                     vlog(
-                                       cst_log.trace,
-                                       "adding path {} for {}",
-                                       item.key,
-                                       prefix);
-                                     paths.emplace_back(item.key);
+                                       res.error());
+                                     // drop the pages of the failed listing
+                                     paths.erase(
+                                       std::next(paths.begin(), first),
+                                       paths.end());
                                  }
                              });
                        });
@@ -438,9 +450,7 @@ topic_recovery_service::filter_existing_topics(
         topic_index[topic.ns].insert(topic.tp);
     }
 
-    std::vector<topic_manifest> manifests;
-    manifests.reserve(items.size());
-
+    std::vector<ss::sstring> paths;
     std::optional<std::regex> requested_pattern = std::nullopt;
     if (request.topic_names_pattern().has_value()) {
         requested_pattern.emplace(
@@ -483,9 +493,29 @@ topic_recovery_service::filter_existing_topics(
             continue;
         }
 
-        if (auto download_r = co_await download_manifest(path);
-            download_r.has_value()) {
-            manifests.push_back(std::move(download_r.value()));
+        paths.push_back(path);
+    }
+
+    // The manifests are small, fetching them one by one would make the
+    // recovery of many topics dominated by the round trips.
+    std::vector<std::optional<topic_manifest>> downloaded(paths.size());
+    co_await ss::max_concurrent_for_each(
+      boost::irange<size_t>(0, paths.size()),
+      config::shard_local_cfg().cloud_storage_recovery_download_concurrency(),
+      [this, &paths, &downloaded](size_t i) {
+          return download_manifest(paths[i]).then(
+            [&downloaded, i](auto download_r) {
+                if (download_r.has_value()) {
+                    downloaded[i] = std::move(download_r.value());
+                }
+            });
+      });
+
+    std::vector<topic_manifest> manifests;
+    manifests.reserve(paths.size());
+    for (auto& m : downloaded) {
+        if (m.has_value()) {
+            manifests.push_back(std::move(m.value()));
         }
     }
     co_return manifests;
@@ -1332,6 +1332,11 @@ ss::future<> topic_table::apply_snapshot(
     }
 
     // 3. notify delta waiters
+
+    // not every change of topic metadata made by the snapshot generates a
+    // delta, so topics snapshots can't share anything with the new state
+    _topics_snapshot = nullptr;
+    _topics_changed_since_snapshot.clear();
     notify_waiters();
 
     _last_applied_revision_id = snap_revision;
@@ -1352,6 +1357,8 @@ void topic_table::reset_partitions_to_force_reconfigure(
 }
 
 void topic_table::notify_waiters() {
+    ++_version;
+
     /// If by invocation of this method there are no waiters, notify
     /// function_ptrs stored in \ref notifications, without consuming all
     /// pending_deltas for when a subsequent waiter does arrive
@@ -1367,6 +1374,16 @@ void topic_table::notify_waiters() {
 
     delta_range_t changes{starting_iter, _pending_deltas.cend()};
 
+    if (_topics_snapshot) {
+        for (const auto& d : changes) {
+            model::topic_namespace_view tp_ns{d.ntp};
+            if (!_topics_changed_since_snapshot.contains(tp_ns)) {
+                _topics_changed_since_snapshot.emplace(
+                  d.ntp.ns, d.ntp.tp.topic);
+            }
+        }
+    }
+
     if (!changes.empty()) {
         for (auto& cb : _notifications) {
             cb.second(changes);
@@ -1396,6 +1413,34 @@ void topic_table::notify_waiters() {
     }
 }
 
+ss::lw_shared_ptr<const topic_table::topics_snapshot>
+topic_table::get_topics_snapshot() const {
+    if (_topics_snapshot && _topics_snapshot->version() == _version) {
+        return _topics_snapshot;
+    }
+
+    topics_snapshot::topics_t topics;
+    topics.reserve(_topics.size());
+    for (const auto& [tp_ns, md_item] : _topics) {
+        if (
+          _topics_snapshot
+          && !_topics_changed_since_snapshot.contains(tp_ns)) {
+            const auto& prev = _topics_snapshot->topics();
+            if (auto it = prev.find(tp_ns); it != prev.end()) {
+                topics.emplace(tp_ns, it->second);
+                continue;
+            }
+        }
+        topics.emplace(
+          tp_ns, ss::make_lw_shared<topic_metadata>(md_item.metadata));
+    }
+
+    _topics_changed_since_snapshot.clear();
+    _topics_snapshot = ss::make_lw_shared<topics_snapshot>(
+      _version, std::move(topics));
+    return _topics_snapshot;
+}
+
 ss::future<fragmented_vector<topic_table::delta>>
 topic_table::wait_for_changes(ss::abort_source& as) {
     using ret_t = fragmented_vector<topic_table::delta>;
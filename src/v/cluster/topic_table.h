@@ -21,7 +21,10 @@
 #include "utils/expiring_promise.h"
 #include "utils/stable_iterator_adaptor.h"
 
+#include <seastar/core/shared_ptr.hh>
+
 #include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
 #include <absl/container/node_hash_map.h>
 
 #include <span>
@@ -254,6 +257,43 @@ public:
       model::topic_namespace_hash,
       model::topic_namespace_eq>;
 
+    /**
+     * Immutable view of the topics map at a version of the table. Readers can
+     * hold it across scheduling points instead of iterating the table and
+     * checking that it wasn't modified concurrently.
+     *
+     * Topics which didn't change between two versions share their metadata
+     * in the snapshots of both versions, so a new snapshot only copies the
+     * metadata of the topics changed since the previous one.
+     */
+    class topics_snapshot {
+    public:
+        using topics_t = absl::node_hash_map<
+          model::topic_namespace,
+          ss::lw_shared_ptr<const topic_metadata>,
+          model::topic_namespace_hash,
+          model::topic_namespace_eq>;
+
+        topics_snapshot(uint64_t version, topics_t topics)
+          : _version(version)
+          , _topics(std::move(topics)) {}
+
+        /// Version of the topic table that the snapshot was taken at
+        uint64_t version() const { return _version; }
+
+        const topics_t& topics() const { return _topics; }
+
+        /// Metadata of the topic, nullptr if it doesn't exist
+        const topic_metadata* find(model::topic_namespace_view tp) const {
+            auto it = _topics.find(tp);
+            return it == _topics.end() ? nullptr : it->second.get();
+        }
+
+    private:
+        uint64_t _version;
+        topics_t _topics;
+    };
+
     using lifecycle_markers_t = absl::node_hash_map<
       nt_revision,
       nt_lifecycle_marker,
@@ -461,6 +501,13 @@ public:
     }
     void check_topics_map_stable(model::revision_id) const;
 
+    // bumped every time the applied changes are published to the waiters,
+    // lets caches of derived state tell whether the table has changed since
+    uint64_t version() const { return _version; }
+
+    /// Snapshot of the topics at the current version, see topics_snapshot
+    ss::lw_shared_ptr<const topics_snapshot> get_topics_snapshot() const;
+
     /// Checks if it has given partition
     bool contains(model::topic_namespace_view, model::partition_id) const;
     /// Checks if it has given topic
@@ -685,6 +732,16 @@ private:
     // map. Unlike other revisions this does not correspond to the command
     // revision that updated the map.
     model::revision_id _topics_map_revision{0};
+    uint64_t _version{0};
+
+    // last snapshot taken, and the topics changed since then. snapshots are
+    // built lazily by readers, hence mutable.
+    mutable ss::lw_shared_ptr<const topics_snapshot> _topics_snapshot;
+    mutable absl::flat_hash_set<
+      model::topic_namespace,
+      model::topic_namespace_hash,
+      model::topic_namespace_eq>
+      _topics_changed_since_snapshot;
 
     fragmented_vector<delta> _pending_deltas;
     std::vector<std::unique_ptr<waiter>> _waiters;
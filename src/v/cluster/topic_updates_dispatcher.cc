@@ -23,6 +23,7 @@
 
 #include <seastar/coroutine/maybe_yield.hh>
 
+#include <absl/container/flat_hash_set.h>
 #include <absl/container/node_hash_map.h>
 #include <fmt/ranges.h>
 
@@ -471,6 +472,39 @@ ss::future<std::error_code> topic_updates_dispatcher::apply(
     co_return co_await dispatch_updates_to_cores(std::move(cmd), base_offset);
 }
 
+ss::future<std::error_code> topic_updates_dispatcher::apply(
+  bulk_topic_lifecycle_transition_cmd cmd, model::offset base_offset) {
+    // validate all the transitions first so that either all of them are
+    // applied or none
+    absl::flat_hash_set<model::topic_namespace_view> topics;
+    topics.reserve(cmd.value.transitions.size());
+    for (const auto& transition : cmd.value.transitions) {
+        if (
+          transition.mode != topic_lifecycle_transition_mode::oneshot_delete
+          && transition.mode != topic_lifecycle_transition_mode::pending_gc) {
+            co_return errc::invalid_request;
+        }
+        if (!topics.emplace(transition.topic.nt).second) {
+            co_return errc::invalid_request;
+        }
+        if (!_topic_table.local().contains(transition.topic.nt)) {
+            co_return errc::topic_not_exists;
+        }
+    }
+    for (auto& transition : cmd.value.transitions) {
+        auto ec = co_await do_topic_delete(std::move(transition), base_offset);
+        if (ec) {
+            vlog(
+              clusterlog.error,
+              "Failed to apply bulk topic deletion at offset {}: {}",
+              base_offset,
+              ec);
+            co_return ec;
+        }
+    }
+    co_return errc::success;
+}
+
 topic_updates_dispatcher::in_progress_map
 topic_updates_dispatcher::collect_in_progress(
   const model::topic_namespace& tp_ns,
@@ -75,7 +75,8 @@ public:
       force_partition_reconfiguration_cmd,
       update_partition_replicas_cmd,
       set_topic_partitions_disabled_cmd,
-      bulk_force_reconfiguration_cmd>();
+      bulk_force_reconfiguration_cmd,
+      bulk_topic_lifecycle_transition_cmd>();
 
     bool is_batch_applicable(const model::record_batch& batch) const {
         return batch.header().type
@@ -112,6 +113,8 @@ private:
       apply(set_topic_partitions_disabled_cmd, model::offset);
     ss::future<std::error_code>
       apply(bulk_force_reconfiguration_cmd, model::offset);
+    ss::future<std::error_code>
+      apply(bulk_topic_lifecycle_transition_cmd, model::offset);
 
     using ntp_leader = std::pair<model::ntp, model::node_id>;
 
@@ -49,6 +49,8 @@
 #include <seastar/core/smp.hh>
 #include <seastar/coroutine/maybe_yield.hh>
 
+#include <absl/container/flat_hash_set.h>
+
 #include <algorithm>
 #include <iterator>
 #include <memory>
@@ -594,19 +596,29 @@ ss::future<std::vector<topic_result>> topics_frontend::delete_topics(
   model::timeout_clock::time_point timeout) {
     vlog(clusterlog.info, "Delete topics {}", topics);
 
-    std::vector<ss::future<topic_result>> futures;
-    futures.reserve(topics.size());
+    ss::future<std::vector<topic_result>> f
+      = ss::make_ready_future<std::vector<topic_result>>();
+    if (
+      topics.size() > 1
+      && _features.local().is_active(
+        features::feature::bulk_topic_lifecycle_transitions)) {
+        f = delete_topics_in_bulk(std::move(topics), timeout);
+    } else {
+        std::vector<ss::future<topic_result>> futures;
+        futures.reserve(topics.size());
 
-    std::transform(
-      std::begin(topics),
-      std::end(topics),
-      std::back_inserter(futures),
-      [this, timeout](model::topic_namespace& tp_ns) {
-          return do_delete_topic(std::move(tp_ns), timeout);
-      });
+        std::transform(
+          std::begin(topics),
+          std::end(topics),
+          std::back_inserter(futures),
+          [this, timeout](model::topic_namespace& tp_ns) {
+              return do_delete_topic(std::move(tp_ns), timeout);
+          });
+        f = ss::when_all_succeed(futures.begin(), futures.end());
+    }
 
-    return ss::when_all_succeed(futures.begin(), futures.end())
-      .then([this, timeout](std::vector<topic_result> results) {
+    return std::move(f).then(
+      [this, timeout](std::vector<topic_result> results) {
           if (needs_linearizable_barrier(results)) {
               return stm_linearizable_barrier(timeout).then(
                 [results = std::move(results)](result<model::offset>) mutable {
@@ -618,13 +630,74 @@ ss::future<std::vector<topic_result>> topics_frontend::delete_topics(
       });
 }
 
-ss::future<topic_result> topics_frontend::do_delete_topic(
-  model::topic_namespace tp_ns, model::timeout_clock::time_point timeout) {
-    // Look up config
+ss::future<std::vector<topic_result>> topics_frontend::delete_topics_in_bulk(
+  std::vector<model::topic_namespace> topics,
+  model::timeout_clock::time_point timeout) {
+    std::vector<topic_result> results;
+    results.reserve(topics.size());
+    absl::flat_hash_set<model::topic_namespace> unique_topics;
+    std::vector<bulk_topic_lifecycle_transition_cmd_data> commands;
+    for (auto& tp_ns : topics) {
+        auto transition = make_deletion_transition(tp_ns);
+        if (!transition) {
+            results.emplace_back(
+              std::move(tp_ns), map_errc(transition.error()));
+            continue;
+        }
+        if (!unique_topics.insert(tp_ns).second) {
+            // deleted by the first occurrence
+            results.emplace_back(std::move(tp_ns), errc::topic_not_exists);
+            continue;
+        }
+        if (
+          commands.empty()
+          || commands.back().transitions.size()
+               >= max_topics_per_bulk_deletion) {
+            commands.emplace_back();
+        }
+        if (
+          transition.value().mode
+          == topic_lifecycle_transition_mode::pending_gc) {
+            vlog(
+              clusterlog.info, "Created deletion marker for topic {}", tp_ns);
+        } else {
+            vlog(clusterlog.info, "Deleting topic {}", tp_ns);
+        }
+        commands.back().transitions.push_back(std::move(transition.value()));
+    }
+
+    for (auto& data : commands) {
+        std::vector<model::topic_namespace> batch_topics;
+        batch_topics.reserve(data.transitions.size());
+        for (const auto& transition : data.transitions) {
+            batch_topics.push_back(transition.topic.nt);
+        }
+        auto ec = errc::success;
+        try {
+            ec = map_errc(co_await replicate_and_wait(
+              _stm,
+              _as,
+              bulk_topic_lifecycle_transition_cmd{0, std::move(data)},
+              timeout));
+        } catch (...) {
+            vlog(
+              clusterlog.warn,
+              "Unable to delete topics - {}",
+              std::current_exception());
+            ec = errc::replication_error;
+        }
+        for (auto& tp_ns : batch_topics) {
+            results.emplace_back(std::move(tp_ns), ec);
+        }
+    }
+    co_return results;
+}
+
+result<topic_lifecycle_transition> topics_frontend::make_deletion_transition(
+  const model::topic_namespace& tp_ns) const {
     auto topic_meta_opt = _topics.local().get_topic_metadata_ref(tp_ns);
     if (!topic_meta_opt.has_value()) {
-        topic_result result(std::move(tp_ns), errc::topic_not_exists);
-        return ss::make_ready_future<topic_result>(result);
+        return errc::topic_not_exists;
     }
     // Before deleting a topic we need to make sure there are no transforms
     // hooked up to it first.
@@ -635,11 +708,33 @@ ss::future<topic_result> topics_frontend::do_delete_topic(
     auto source_transforms = _plugin_table.find_by_input_topic(tp_ns);
     auto sink_transforms = _plugin_table.find_by_output_topic(tp_ns);
     if (!source_transforms.empty() || !sink_transforms.empty()) {
-        topic_result result(std::move(tp_ns), errc::source_topic_still_in_use);
-        return ss::make_ready_future<topic_result>(result);
+        return errc::source_topic_still_in_use;
     }
     auto& topic_meta = topic_meta_opt.value().get();
 
+    // Default to traditional deletion, without tombstones
+    // Use tombstones for tiered storage topics that require remote erase
+    topic_lifecycle_transition_mode mode
+      = topic_meta.get_configuration().properties.requires_remote_erase()
+          ? topic_lifecycle_transition_mode::pending_gc
+          : topic_lifecycle_transition_mode::oneshot_delete;
+
+    auto remote_revision = topic_meta.get_remote_revision().value_or(
+      model::initial_revision_id{topic_meta.get_revision()});
+
+    return topic_lifecycle_transition{
+      .topic = {.nt = tp_ns, .initial_revision_id = remote_revision},
+      .mode = mode};
+}
+
+ss::future<topic_result> topics_frontend::do_delete_topic(
+  model::topic_namespace tp_ns, model::timeout_clock::time_point timeout) {
+    auto transition = make_deletion_transition(tp_ns);
+    if (!transition) {
+        topic_result result(std::move(tp_ns), map_errc(transition.error()));
+        return ss::make_ready_future<topic_result>(result);
+    }
+
     // Lifecycle marker driven deletion is added alongside the v2 manifest
     // format in Redpanda 23.2.  Before that, we write legacy one-shot
     // deletion records.
@@ -676,26 +771,14 @@ ss::future<topic_result> topics_frontend::do_delete_topic(
             });
     }
 
-    // Default to traditional deletion, without tombstones
-    // Use tombstones for tiered storage topics that require remote erase
-    topic_lifecycle_transition_mode mode
-      = topic_meta.get_configuration().properties.requires_remote_erase()
-          ? topic_lifecycle_transition_mode::pending_gc
-          : topic_lifecycle_transition_mode::oneshot_delete;
-
+    const auto mode = transition.value().mode;
     if (mode == topic_lifecycle_transition_mode::oneshot_delete) {
         vlog(clusterlog.info, "Deleting topic {}", tp_ns);
     } else if (mode == topic_lifecycle_transition_mode::pending_gc) {
         vlog(clusterlog.info, "Created deletion marker for topic {}", tp_ns);
     }
 
-    auto remote_revision = topic_meta.get_remote_revision().value_or(
-      model::initial_revision_id{topic_meta.get_revision()});
-
-    topic_lifecycle_transition_cmd cmd(
-      tp_ns,
-      {.topic = {.nt = tp_ns, .initial_revision_id = remote_revision},
-       .mode = mode});
+    topic_lifecycle_transition_cmd cmd(tp_ns, std::move(transition.value()));
 
     return replicate_and_wait(_stm, _as, std::move(cmd), timeout)
       .then_wrapped(
@@ -931,59 +1014,49 @@ ss::future<std::error_code> topics_frontend::force_update_partition_replicas(
 ss::future<result<fragmented_vector<ntp_with_majority_loss>>>
 topics_frontend::partitions_with_lost_majority(
   std::vector<model::node_id> dead_nodes) {
-    try {
-        fragmented_vector<ntp_with_majority_loss> result;
-        const auto& topics = _topics.local();
-        for (auto it = topics.topics_iterator_begin();
-             it != topics.topics_iterator_end();
-             ++it) {
-            const auto& tn = it->first;
-            const auto& assignments = (it->second).get_assignments();
-            const auto topic_revision = it->second.get_revision();
-            for (const auto& assignment : assignments) {
-                const auto& current = assignment.replicas;
-                auto remaining = subtract_replica_sets_by_node_id(
-                  current, dead_nodes);
-                auto lost_majority = remaining.size()
-                                     < (current.size() / 2) + 1;
-                if (!lost_majority) {
-                    continue;
-                }
-                model::ntp ntp(tn.ns, tn.tp, assignment.id);
-                if (topics.updates_in_progress().contains(ntp)) {
-                    // force reconfiguration does not support in progress
-                    // moves. this check can be relaxed once the limitation
-                    // is fixed.
-                    vlog(
-                      clusterlog.debug,
-                      "{} lost majority but skipping as an update is in "
-                      "progress.",
-                      ntp);
-                    continue;
-                }
-                result.emplace_back(
-                  std::move(ntp),
-                  topic_revision,
-                  assignment.replicas,
-                  dead_nodes);
-                co_await ss::coroutine::maybe_yield();
-                it.check();
+    fragmented_vector<ntp_with_majority_loss> result;
+    const auto& topics = _topics.local();
+    // the snapshot is stable across the yields below, the plan is validated
+    // against the current state of the table once it is complete
+    auto snapshot = topics.get_topics_snapshot();
+    for (const auto& [tn, md] : snapshot->topics()) {
+        const auto topic_revision = md->get_revision();
+        for (const auto& assignment : md->get_assignments()) {
+            const auto& current = assignment.replicas;
+            auto remaining = subtract_replica_sets_by_node_id(
+              current, dead_nodes);
+            auto lost_majority = remaining.size() < (current.size() / 2) + 1;
+            if (!lost_majority) {
+                continue;
             }
+            model::ntp ntp(tn.ns, tn.tp, assignment.id);
+            if (topics.updates_in_progress().contains(ntp)) {
+                // force reconfiguration does not support in progress
+                // moves. this check can be relaxed once the limitation
+                // is fixed.
+                vlog(
+                  clusterlog.debug,
+                  "{} lost majority but skipping as an update is in "
+                  "progress.",
+                  ntp);
+                continue;
+            }
+            result.emplace_back(
+              std::move(ntp), topic_revision, assignment.replicas, dead_nodes);
+            co_await ss::coroutine::maybe_yield();
         }
-        auto validation_err
-          = _topics.local().validate_force_reconfigurable_partitions(result);
-        if (validation_err) {
-            co_return errc::concurrent_modification_error;
-        }
-        co_return result;
-    } catch (const topic_table::concurrent_modification_error& e) {
-        // state changed while generating the plan, force caller to retry;
+    }
+    auto validation_err = topics.validate_force_reconfigurable_partitions(
+      result);
+    if (validation_err) {
+        // state changed while generating the plan, force caller to retry
         vlog(
           clusterlog.info,
           "Topic table state changed when generating force move plan: {}",
-          e.what());
+          validation_err.message());
+        co_return errc::concurrent_modification_error;
     }
-    co_return errc::concurrent_modification_error;
+    co_return result;
 }
 
 ss::future<std::error_code>
@@ -208,6 +208,15 @@ private:
     ss::future<topic_result>
       do_delete_topic(model::topic_namespace, model::timeout_clock::time_point);
 
+    /// Deletes the topics with one replicated command per
+    /// max_topics_per_bulk_deletion topics
+    ss::future<std::vector<topic_result>> delete_topics_in_bulk(
+      std::vector<model::topic_namespace>, model::timeout_clock::time_point);
+    static constexpr size_t max_topics_per_bulk_deletion = 1000;
+
+    result<topic_lifecycle_transition>
+    make_deletion_transition(const model::topic_namespace&) const;
+
     ss::future<std::vector<topic_result>> dispatch_create_to_leader(
       model::node_id,
       topic_configuration_vector,
@@ -87,6 +87,20 @@ tx_gateway::abort_tx(abort_tx_request request, rpc::streaming_context&) {
       request.ntp, request.pid, request.tx_seq, request.timeout);
 }
 
+ss::future<tx_markers_reply>
+tx_gateway::tx_markers(tx_markers_request request, rpc::streaming_context&) {
+    return _rm_partition_frontend.local()
+      .tx_markers_locally(
+        std::move(request.ntps),
+        request.pid,
+        request.tx_seq,
+        request.timeout,
+        request.commit)
+      .then([](std::vector<tx_errc> ecs) {
+          return tx_markers_reply(std::move(ecs));
+      });
+}
+
 ss::future<begin_group_tx_reply> tx_gateway::begin_group_tx(
   begin_group_tx_request request, rpc::streaming_context&) {
     return _rm_group_proxy->begin_group_tx_locally(std::move(request));
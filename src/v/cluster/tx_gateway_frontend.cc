@@ -319,7 +319,10 @@ tx_gateway_frontend::tx_gateway_frontend(
   , _transactional_id_expiration(
       config::shard_local_cfg().transactional_id_expiration_ms.value())
   , _transactions_enabled(config::shard_local_cfg().enable_transactions.value())
-  , _max_transactions_per_coordinator(max_transactions_per_coordinator) {
+  , _max_transactions_per_coordinator(max_transactions_per_coordinator)
+  , _max_transactions_memory_per_coordinator(
+      config::shard_local_cfg()
+        .max_transactions_memory_per_coordinator.bind()) {
     /**
      * do not start expriry timer when transactions are disabled
      */
@@ -1105,6 +1108,16 @@ bool is_valid_producer(
 
 } // namespace
 
+bool tx_gateway_frontend::is_tx_cache_over_capacity(const tm_stm& stm) const {
+    if (stm.tx_cache_size() > _max_transactions_per_coordinator()) {
+        return true;
+    }
+    auto max_memory = _max_transactions_memory_per_coordinator();
+    // keep at least one session, like the count based limit does
+    return max_memory.has_value() && stm.tx_cache_size() > 1
+           && stm.tx_cache_memory() > max_memory.value();
+}
+
 ss::future<cluster::init_tm_tx_reply> tx_gateway_frontend::limit_init_tm_tx(
   ss::shared_ptr<tm_stm> stm,
   kafka::transactional_id tx_id,
@@ -1133,7 +1146,7 @@ ss::future<cluster::init_tm_tx_reply> tx_gateway_frontend::limit_init_tm_tx(
     }
     units.return_all();
 
-    if (stm->tx_cache_size() > _max_transactions_per_coordinator()) {
+    if (is_tx_cache_over_capacity(*stm)) {
         // lock is sloppy and doesn't guarantee that tx_cache_size
         // never exceeds _max_transactions_per_coordinator. init_tm_tx
         // request may pass limit_init_tm_tx but not yet increase
@@ -1145,7 +1158,7 @@ ss::future<cluster::init_tm_tx_reply> tx_gateway_frontend::limit_init_tm_tx(
 
         // similar to double-checked locking pattern
         // it protects concurrent access to oldest_tx
-        while (stm->tx_cache_size() > _max_transactions_per_coordinator()) {
+        while (is_tx_cache_over_capacity(*stm)) {
             auto old_tx_opt = stm->oldest_tx();
             if (!old_tx_opt) {
                 vlog(
@@ -1160,10 +1173,12 @@ ss::future<cluster::init_tm_tx_reply> tx_gateway_frontend::limit_init_tm_tx(
             auto old_tx = old_tx_opt.value();
             vlog(
               txlog.info,
-              "tx cache size ({}) is beyond capacity ({}); expiring oldest tx "
-              "(tx.id={})",
+              "tx cache size ({}, {} bytes) is beyond capacity ({}, {} "
+              "bytes); expiring oldest tx (tx.id={})",
               stm->tx_cache_size(),
+              stm->tx_cache_memory(),
               _max_transactions_per_coordinator(),
+              _max_transactions_memory_per_coordinator(),
               old_tx.id);
             auto tx_units = co_await stm->lock_tx(old_tx.id, "init_tm_tx");
 
@@ -2291,12 +2306,13 @@ tx_gateway_frontend::recommit_tm_tx(
             gfs.push_back(_rm_group_proxy->commit_group_tx(
               group.group_id, tx.pid, tx.tx_seq, timeout));
         }
-        std::vector<ss::future<commit_tx_reply>> cfs;
-        cfs.reserve(tx.partitions.size());
-        for (auto rm : tx.partitions) {
-            cfs.push_back(_rm_partition_frontend.local().commit_tx(
-              rm.ntp, tx.pid, tx.tx_seq, timeout));
+        std::vector<model::ntp> ntps;
+        ntps.reserve(tx.partitions.size());
+        for (const auto& rm : tx.partitions) {
+            ntps.push_back(rm.ntp);
         }
+        auto cf = _rm_partition_frontend.local().write_tx_markers(
+          std::move(ntps), tx.pid, tx.tx_seq, timeout, true);
         auto ok = true;
         auto failed = false;
         auto rejected = false;
@@ -2331,9 +2347,9 @@ tx_gateway_frontend::recommit_tm_tx(
             }
             ok = ok && (r.ec == tx_errc::none);
         }
-        auto crs = co_await when_all_succeed(cfs.begin(), cfs.end());
-        for (const auto& r : crs) {
-            if (r.ec == tx_errc::request_rejected) {
+        auto crs = co_await std::move(cf);
+        for (auto ec : crs) {
+            if (ec == tx_errc::request_rejected) {
                 rejected = true;
                 vlog(
                   txlog.warn,
@@ -2345,7 +2361,7 @@ tx_gateway_frontend::recommit_tm_tx(
                   tx.tx_seq,
                   tx.status,
                   expected_term);
-            } else if (r.ec != tx_errc::none) {
+            } else if (ec != tx_errc::none) {
                 failed = true;
                 vlog(
                   txlog.trace,
@@ -2357,9 +2373,9 @@ tx_gateway_frontend::recommit_tm_tx(
                   tx.tx_seq,
                   tx.status,
                   expected_term,
-                  r.ec);
+                  ec);
             }
-            ok = ok && (r.ec == tx_errc::none);
+            ok = ok && (ec == tx_errc::none);
         }
         if (ok) {
             done = true;
@@ -2421,25 +2437,26 @@ tx_gateway_frontend::reabort_tm_tx(
     auto delay_ms = _metadata_dissemination_retry_delay_ms;
     auto done = false;
     while (0 < retries--) {
-        std::vector<ss::future<abort_tx_reply>> pfs;
-        pfs.reserve(tx.partitions.size());
-        for (auto rm : tx.partitions) {
-            pfs.push_back(_rm_partition_frontend.local().abort_tx(
-              rm.ntp, tx.pid, tx.tx_seq, timeout));
+        std::vector<model::ntp> ntps;
+        ntps.reserve(tx.partitions.size());
+        for (const auto& rm : tx.partitions) {
+            ntps.push_back(rm.ntp);
         }
+        auto pf = _rm_partition_frontend.local().write_tx_markers(
+          std::move(ntps), tx.pid, tx.tx_seq, timeout, false);
         std::vector<ss::future<abort_group_tx_reply>> gfs;
         gfs.reserve(tx.groups.size());
         for (auto group : tx.groups) {
             gfs.push_back(_rm_group_proxy->abort_group_tx(
               group.group_id, tx.pid, tx.tx_seq, timeout));
         }
-        auto prs = co_await when_all_succeed(pfs.begin(), pfs.end());
+        auto prs = co_await std::move(pf);
         auto grs = co_await when_all_succeed(gfs.begin(), gfs.end());
         auto ok = true;
         auto failed = false;
         auto rejected = false;
-        for (const auto& r : prs) {
-            if (r.ec == tx_errc::request_rejected) {
+        for (auto ec : prs) {
+            if (ec == tx_errc::request_rejected) {
                 rejected = true;
                 vlog(
                   txlog.warn,
@@ -2451,7 +2468,7 @@ tx_gateway_frontend::reabort_tm_tx(
                   tx.tx_seq,
                   tx.status,
                   expected_term);
-            } else if (r.ec != tx_errc::none) {
+            } else if (ec != tx_errc::none) {
                 failed = true;
                 vlog(
                   txlog.info,
@@ -2463,9 +2480,9 @@ tx_gateway_frontend::reabort_tm_tx(
                   tx.tx_seq,
                   tx.status,
                   expected_term,
-                  r.ec);
+                  ec);
             }
-            ok = ok && (r.ec == tx_errc::none);
+            ok = ok && (ec == tx_errc::none);
         }
         for (const auto& r : grs) {
             if (r.ec == tx_errc::request_rejected) {
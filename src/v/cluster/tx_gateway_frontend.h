@@ -101,6 +101,11 @@ private:
     std::chrono::milliseconds _transactional_id_expiration;
     bool _transactions_enabled;
     config::binding<uint64_t> _max_transactions_per_coordinator;
+    config::binding<std::optional<size_t>>
+      _max_transactions_memory_per_coordinator;
+
+    // true if the coordinator keeps more sessions than it is allowed to
+    bool is_tx_cache_over_capacity(const tm_stm&) const;
 
     // Transaction GA includes: KIP_447, KIP-360, fix for compaction tx_group*
     // records, perf fix#1(Do not writing preparing state on disk in tm_stn),
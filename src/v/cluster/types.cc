@@ -985,6 +985,23 @@ std::ostream& operator<<(std::ostream& o, const abort_tx_reply& r) {
     return o;
 }
 
+std::ostream& operator<<(std::ostream& o, const tx_markers_request& r) {
+    fmt::print(
+      o,
+      "{{ntps {} pid {} tx_seq {} timeout {} commit {}}}",
+      r.ntps,
+      r.pid,
+      r.tx_seq,
+      r.timeout,
+      r.commit);
+    return o;
+}
+
+std::ostream& operator<<(std::ostream& o, const tx_markers_reply& r) {
+    fmt::print(o, "{{ecs {}}}", r.ecs);
+    return o;
+}
+
 std::ostream& operator<<(std::ostream& o, const begin_group_tx_request& r) {
     fmt::print(
       o,
@@ -1280,6 +1297,20 @@ std::ostream& operator<<(std::ostream& o, const ntp_with_majority_loss& entry) {
     return o;
 }
 
+bulk_topic_lifecycle_transition_cmd_data&
+bulk_topic_lifecycle_transition_cmd_data::operator=(
+  const bulk_topic_lifecycle_transition_cmd_data& other) {
+    if (this != &other) {
+        transitions = other.transitions.copy();
+    }
+    return *this;
+}
+
+bulk_topic_lifecycle_transition_cmd_data::
+  bulk_topic_lifecycle_transition_cmd_data(
+    const bulk_topic_lifecycle_transition_cmd_data& other)
+  : transitions(other.transitions.copy()) {}
+
 bulk_force_reconfiguration_cmd_data&
 bulk_force_reconfiguration_cmd_data::operator=(
   const bulk_force_reconfiguration_cmd_data& other) {
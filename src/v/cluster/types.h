@@ -70,14 +70,18 @@ using replicas_t = std::vector<model::broker_shard>;
 struct allocate_id_request
   : serde::envelope<
       allocate_id_request,
-      serde::version<0>,
+      serde::version<1>,
       serde::compat_version<0>> {
     model::timeout_clock::duration timeout;
+    // number of consecutive ids requested, the reply may carry less
+    int64_t count{1};
 
     allocate_id_request() noexcept = default;
 
-    explicit allocate_id_request(model::timeout_clock::duration timeout)
-      : timeout(timeout) {}
+    explicit allocate_id_request(
+      model::timeout_clock::duration timeout, int64_t count = 1)
+      : timeout(timeout)
+      , count(count) {}
 
     friend bool
     operator==(const allocate_id_request&, const allocate_id_request&)
@@ -85,35 +89,42 @@ struct allocate_id_request
 
     friend std::ostream&
     operator<<(std::ostream& o, const allocate_id_request& req) {
-        fmt::print(o, "timeout: {}", req.timeout.count());
+        fmt::print(
+          o, "timeout: {}, count: {}", req.timeout.count(), req.count);
         return o;
     }
 
-    auto serde_fields() { return std::tie(timeout); }
+    auto serde_fields() { return std::tie(timeout, count); }
 };
 
 struct allocate_id_reply
   : serde::
-      envelope<allocate_id_reply, serde::version<0>, serde::compat_version<0>> {
+      envelope<allocate_id_reply, serde::version<1>, serde::compat_version<0>> {
+    // first of the allocated ids
     int64_t id;
     errc ec;
+    // number of consecutive ids allocated starting from id, replies of the
+    // older versions always carry a single id
+    int64_t count{1};
 
     allocate_id_reply() noexcept = default;
 
-    allocate_id_reply(int64_t id, errc ec)
+    allocate_id_reply(int64_t id, errc ec, int64_t count = 1)
       : id(id)
-      , ec(ec) {}
+      , ec(ec)
+      , count(count) {}
 
     friend bool operator==(const allocate_id_reply&, const allocate_id_reply&)
       = default;
 
     friend std::ostream&
     operator<<(std::ostream& o, const allocate_id_reply& rep) {
-        fmt::print(o, "id: {}, ec: {}", rep.id, rep.ec);
+        fmt::print(
+          o, "id: {}, ec: {}, count: {}", rep.id, rep.ec, rep.count);
         return o;
     }
 
-    auto serde_fields() { return std::tie(id, ec); }
+    auto serde_fields() { return std::tie(id, ec, count); }
 };
 
 struct reset_id_allocator_request
@@ -764,6 +775,63 @@ struct abort_tx_reply
     friend std::ostream& operator<<(std::ostream& o, const abort_tx_reply& r);
 };
 
+/// Commit or abort markers of a transaction for all the partitions of the
+/// transaction led by a node, written with a single request.
+struct tx_markers_request
+  : serde::envelope<
+      tx_markers_request,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    std::vector<model::ntp> ntps;
+    model::producer_identity pid;
+    model::tx_seq tx_seq;
+    model::timeout_clock::duration timeout{};
+    bool commit{false};
+
+    tx_markers_request() noexcept = default;
+
+    tx_markers_request(
+      std::vector<model::ntp> ntps,
+      model::producer_identity pid,
+      model::tx_seq tx_seq,
+      model::timeout_clock::duration timeout,
+      bool commit)
+      : ntps(std::move(ntps))
+      , pid(pid)
+      , tx_seq(tx_seq)
+      , timeout(timeout)
+      , commit(commit) {}
+
+    friend bool operator==(const tx_markers_request&, const tx_markers_request&)
+      = default;
+
+    auto serde_fields() {
+        return std::tie(ntps, pid, tx_seq, timeout, commit);
+    }
+
+    friend std::ostream&
+    operator<<(std::ostream& o, const tx_markers_request& r);
+};
+
+struct tx_markers_reply
+  : serde::
+      envelope<tx_markers_reply, serde::version<0>, serde::compat_version<0>> {
+    // results of the request partitions, in request order
+    std::vector<tx_errc> ecs;
+
+    tx_markers_reply() noexcept = default;
+
+    explicit tx_markers_reply(std::vector<tx_errc> ecs)
+      : ecs(std::move(ecs)) {}
+
+    friend bool operator==(const tx_markers_reply&, const tx_markers_reply&)
+      = default;
+
+    auto serde_fields() { return std::tie(ecs); }
+
+    friend std::ostream& operator<<(std::ostream& o, const tx_markers_reply& r);
+};
+
 struct begin_group_tx_request
   : serde::envelope<
       begin_group_tx_request,
@@ -2176,6 +2244,31 @@ struct topic_lifecycle_transition
     auto serde_fields() { return std::tie(topic, mode); }
 };
 
+struct bulk_topic_lifecycle_transition_cmd_data
+  : serde::envelope<
+      bulk_topic_lifecycle_transition_cmd_data,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    using rpc_adl_exempt = std::true_type;
+
+    bulk_topic_lifecycle_transition_cmd_data() = default;
+    ~bulk_topic_lifecycle_transition_cmd_data() noexcept = default;
+    bulk_topic_lifecycle_transition_cmd_data(
+      bulk_topic_lifecycle_transition_cmd_data&&)
+      = default;
+    bulk_topic_lifecycle_transition_cmd_data(
+      const bulk_topic_lifecycle_transition_cmd_data&);
+    bulk_topic_lifecycle_transition_cmd_data&
+    operator=(bulk_topic_lifecycle_transition_cmd_data&&)
+      = default;
+    bulk_topic_lifecycle_transition_cmd_data&
+    operator=(const bulk_topic_lifecycle_transition_cmd_data&);
+
+    fragmented_vector<topic_lifecycle_transition> transitions;
+
+    auto serde_fields() { return std::tie(transitions); }
+};
+
 using topic_configuration_assignment
   = configuration_with_assignment<topic_configuration>;
 
@@ -3839,23 +3932,28 @@ struct cancel_partition_movements_reply
 struct cloud_storage_usage_request
   : serde::envelope<
       cloud_storage_usage_request,
-      serde::version<0>,
+      serde::version<1>,
       serde::compat_version<0>> {
     using rpc_adl_exempt = std::true_type;
 
     std::vector<model::ntp> partitions;
 
+    // When set, the partitions list is ignored and the reply carries the
+    // usage of all partitions led by the node, taken from the incrementally
+    // maintained counters.
+    bool local_leaders{false};
+
     friend bool operator==(
       const cloud_storage_usage_request&, const cloud_storage_usage_request&)
       = default;
 
-    auto serde_fields() { return std::tie(partitions); }
+    auto serde_fields() { return std::tie(partitions, local_leaders); }
 };
 
 struct cloud_storage_usage_reply
   : serde::envelope<
       cloud_storage_usage_reply,
-      serde::version<0>,
+      serde::version<1>,
       serde::compat_version<0>> {
     using rpc_adl_exempt = std::true_type;
 
@@ -3867,12 +3965,17 @@ struct cloud_storage_usage_reply
     // the request can be retried only for the 'missing_partitions'.
     std::vector<model::ntp> missing_partitions;
 
+    // Number of partitions accounted in total_size_bytes, only set in replies
+    // to local_leaders requests
+    uint64_t leader_partitions{0};
+
     friend bool operator==(
       const cloud_storage_usage_reply&, const cloud_storage_usage_reply&)
       = default;
 
     auto serde_fields() {
-        return std::tie(total_size_bytes, missing_partitions);
+        return std::tie(
+          total_size_bytes, missing_partitions, leader_partitions);
     }
 };
 
@@ -35,11 +35,13 @@ struct compat_check<cluster::allocate_id_request> {
     static void to_json(
       cluster::allocate_id_request obj, json::Writer<json::StringBuffer>& wr) {
         json_write(timeout);
+        json_write(count);
     }
 
     static cluster::allocate_id_request from_json(json::Value& rd) {
         cluster::allocate_id_request obj{};
         json_read(timeout);
+        json_read(count);
         return obj;
     }
 
@@ -68,12 +70,14 @@ struct compat_check<cluster::allocate_id_reply> {
       cluster::allocate_id_reply obj, json::Writer<json::StringBuffer>& wr) {
         json_write(id);
         json_write(ec);
+        json_write(count);
     }
 
     static cluster::allocate_id_reply from_json(json::Value& rd) {
         cluster::allocate_id_reply obj;
         json_read(id);
         json_read(ec);
+        json_read(count);
         return obj;
     }
 
@@ -29,7 +29,8 @@ template<>
 struct instance_generator<cluster::allocate_id_request> {
     static cluster::allocate_id_request random() {
         return cluster::allocate_id_request{
-          tests::random_duration<model::timeout_clock::duration>()};
+          tests::random_duration<model::timeout_clock::duration>(),
+          random_generators::get_int<int64_t>(1, 10000)};
     }
 
     static std::vector<cluster::allocate_id_request> limits() {
@@ -37,6 +38,8 @@ struct instance_generator<cluster::allocate_id_request> {
           cluster::allocate_id_request{model::timeout_clock::duration(0)},
           cluster::allocate_id_request{min_duration()},
           cluster::allocate_id_request{max_duration()},
+          cluster::allocate_id_request{
+            max_duration(), std::numeric_limits<int64_t>::max()},
         };
     }
 };
@@ -56,7 +59,8 @@ struct instance_generator<cluster::allocate_id_reply> {
           errc_min, errc_max);
         return {
           random_generators::get_int<int64_t>(int64_min, int64_max),
-          cluster::errc(errc_rand)};
+          cluster::errc(errc_rand),
+          random_generators::get_int<int64_t>(1, 10000)};
     }
 
     static std::vector<cluster::allocate_id_reply> limits() {
@@ -40,11 +40,13 @@ struct compat_check<cluster::update_leadership_request_v2> {
       cluster::update_leadership_request_v2 obj,
       json::Writer<json::StringBuffer>& wr) {
         json_write(leaders);
+        json_write(topics);
     }
 
     static cluster::update_leadership_request_v2 from_json(json::Value& rd) {
         cluster::update_leadership_request_v2 obj;
         json_read(leaders);
+        json_read(topics);
         return obj;
     }
 
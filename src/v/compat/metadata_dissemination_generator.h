@@ -32,7 +32,18 @@ struct instance_generator<cluster::update_leadership_request_v2> {
           tests::random_named_int<model::node_id>(),
           tests::random_named_int<model::revision_id>());
 
-        return cluster::update_leadership_request_v2(std::move(values));
+        fragmented_vector<cluster::topic_leaders> topics;
+        auto& topic = topics.emplace_back();
+        topic.tp_ns = model::random_topic_namespace();
+        topic.partitions.push_back(cluster::partition_leader_revision{
+          .id = tests::random_named_int<model::partition_id>(),
+          .term = tests::random_named_int<model::term_id>(),
+          .leader_id = tests::random_named_int<model::node_id>(),
+          .revision = tests::random_named_int<model::revision_id>(),
+        });
+
+        return cluster::update_leadership_request_v2(
+          std::move(values), std::move(topics));
     }
 
     static std::vector<cluster::update_leadership_request_v2> limits() {
@@ -56,4 +56,42 @@ read_value(json::Value const& rd, cluster::ntp_leader_revision& obj) {
     read_member(rd, "revision_id", obj.revision);
 }
 
+inline void rjson_serialize(
+  json::Writer<json::StringBuffer>& w,
+  const cluster::partition_leader_revision& v) {
+    w.StartObject();
+    w.Key("id");
+    rjson_serialize(w, v.id);
+    w.Key("term");
+    rjson_serialize(w, v.term);
+    w.Key("leader_id");
+    rjson_serialize(w, v.leader_id);
+    w.Key("revision_id");
+    rjson_serialize(w, v.revision);
+    w.EndObject();
+}
+
+inline void
+read_value(json::Value const& rd, cluster::partition_leader_revision& obj) {
+    read_member(rd, "id", obj.id);
+    read_member(rd, "term", obj.term);
+    read_member(rd, "leader_id", obj.leader_id);
+    read_member(rd, "revision_id", obj.revision);
+}
+
+inline void rjson_serialize(
+  json::Writer<json::StringBuffer>& w, const cluster::topic_leaders& v) {
+    w.StartObject();
+    w.Key("tp_ns");
+    rjson_serialize(w, v.tp_ns);
+    w.Key("partitions");
+    rjson_serialize(w, v.partitions);
+    w.EndObject();
+}
+
+inline void read_value(json::Value const& rd, cluster::topic_leaders& obj) {
+    read_member(rd, "tp_ns", obj.tp_ns);
+    read_member(rd, "partitions", obj.partitions);
+}
+
 } // namespace json
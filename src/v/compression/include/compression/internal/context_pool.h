@@ -0,0 +1,88 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace compression::internal {
+
+/*
+ * A bounded pool of the contexts of a codec, meant to be thread local.
+ *
+ * A context holds the state of a codec (e.g. 256KiB of deflate state), which
+ * is costly to allocate and initialize for every batch. A lease takes a
+ * context from the pool for one compression or decompression and puts it
+ * back when it goes out of scope. The codec resets the context when it uses
+ * it, so a context is reusable even after a failure.
+ *
+ * The codecs are synchronous, a thread uses one context of a kind at a time,
+ * at most `max_idle` contexts are kept to bound the memory it holds on to.
+ */
+template<typename Ptr, size_t max_idle = 2>
+class context_pool {
+public:
+    class lease {
+    public:
+        lease(context_pool& pool, Ptr ctx, bool fresh)
+          : _pool(&pool)
+          , _ctx(std::move(ctx))
+          , _fresh(fresh) {}
+        lease(const lease&) = delete;
+        lease& operator=(const lease&) = delete;
+        lease(lease&& o) noexcept
+          : _pool(o._pool)
+          , _ctx(std::move(o._ctx))
+          , _fresh(o._fresh) {}
+        lease& operator=(lease&&) = delete;
+        ~lease() {
+            if (_ctx) {
+                _pool->release(std::move(_ctx));
+            }
+        }
+
+        auto* get() const { return _ctx.get(); }
+        auto* operator->() const { return _ctx.get(); }
+        // true when the context was created for this lease
+        bool fresh() const { return _fresh; }
+
+    private:
+        context_pool* _pool;
+        Ptr _ctx;
+        bool _fresh;
+    };
+
+    /// Takes an idle context, or makes one with \p make if there is none.
+    template<typename Make>
+    lease acquire(Make&& make) {
+        if (_idle.empty()) {
+            return lease(*this, make(), true);
+        }
+        auto ctx = std::move(_idle.back());
+        _idle.pop_back();
+        return lease(*this, std::move(ctx), false);
+    }
+
+    size_t idle() const { return _idle.size(); }
+
+private:
+    void release(Ptr ctx) {
+        if (_idle.size() < max_idle) {
+            _idle.push_back(std::move(ctx));
+        }
+    }
+
+    std::vector<Ptr> _idle;
+};
+
+} // namespace compression::internal
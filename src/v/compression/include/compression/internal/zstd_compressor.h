@@ -11,18 +11,31 @@
 
 #pragma once
 #include "bytes/iobuf.h"
+#include "compression/internal/context_pool.h"
 #include "compression/stream_zstd.h"
+
+#include <memory>
+
 namespace compression::internal {
 
 struct zstd_compressor {
     static iobuf compress(const iobuf& b) {
-        stream_zstd fn;
-        return fn.compress(b);
+        auto fn = contexts().acquire(
+          [] { return std::make_unique<stream_zstd>(); });
+        return fn->compress(b);
     }
     static iobuf uncompress(const iobuf& b) {
+        // decompression uses the workspace of the thread, see
+        // stream_zstd::init_workspace
         stream_zstd fn;
         return fn.uncompress(b);
     }
+
+private:
+    static context_pool<std::unique_ptr<stream_zstd>>& contexts() {
+        static thread_local context_pool<std::unique_ptr<stream_zstd>> pool;
+        return pool;
+    }
 };
 
 } // namespace compression::internal
@@ -17,6 +17,9 @@
 #include <zstd.h>
 
 namespace compression {
+
+class zstd_dictionary;
+
 class stream_zstd {
 public:
     using zstd_compress_ctx = std::unique_ptr<
@@ -29,11 +32,20 @@ public:
     iobuf compress(iobuf&& b) { return do_compress(b); }
     iobuf uncompress(iobuf&& b) { return do_uncompress(b); }
 
+    // Compresses with a dictionary, its id is written in the frame and the
+    // frame can only be decompressed with the same dictionary.
+    iobuf compress(const iobuf& b, const zstd_dictionary& dict) {
+        return do_compress(b, &dict);
+    }
+    iobuf uncompress(const iobuf& b, const zstd_dictionary& dict) {
+        return do_uncompress(b, &dict);
+    }
+
     static void init_workspace(size_t);
 
 private:
-    iobuf do_compress(const iobuf&);
-    iobuf do_uncompress(const iobuf&);
+    iobuf do_compress(const iobuf&, const zstd_dictionary* = nullptr);
+    iobuf do_uncompress(const iobuf&, const zstd_dictionary* = nullptr);
 
     void reset_compressor();
     zstd_compress_ctx& compressor();
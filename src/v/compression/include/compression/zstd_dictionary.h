@@ -0,0 +1,154 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "base/units.h"
+#include "bytes/bytes.h"
+#include "bytes/iobuf.h"
+#include "static_deleter_fn.h"
+
+#include <seastar/core/shared_ptr.hh>
+#include <seastar/core/sstring.hh>
+
+#include <absl/container/flat_hash_map.h>
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <random>
+#include <vector>
+#include <zstd.h>
+
+namespace compression {
+
+/**
+ * A zstd dictionary, digested once for compression and decompression.
+ *
+ * Small messages compress poorly on their own: there is not enough data in a
+ * batch for zstd to learn its redundancy. A dictionary trained on samples of
+ * a topic primes the compressor with the content common to its messages.
+ *
+ * The id of the dictionary is written in the header of the frames compressed
+ * with it, it is the version of the dictionary: the frames say which
+ * dictionary decompresses them, see frame_dictionary_id.
+ */
+class zstd_dictionary {
+public:
+    static constexpr int default_compression_level = 3;
+
+    /// Loads a dictionary from its content, as trained by
+    /// zstd_dictionary_trainer. Throws if it is not a zstd dictionary.
+    explicit zstd_dictionary(
+      bytes content, int compression_level = default_compression_level);
+
+    uint32_t id() const { return _id; }
+    /// What to persist to load the dictionary again.
+    const bytes& content() const { return _content; }
+
+    const ZSTD_CDict* cdict() const { return _cdict.get(); }
+    const ZSTD_DDict* ddict() const { return _ddict.get(); }
+
+    /// The id of the dictionary the frame at the start of \p frame was
+    /// compressed with, none if it was compressed without one.
+    static std::optional<uint32_t> frame_dictionary_id(const iobuf& frame);
+
+private:
+    bytes _content;
+    uint32_t _id;
+    std::unique_ptr<
+      ZSTD_CDict,
+      static_sized_deleter_fn<ZSTD_CDict, &ZSTD_freeCDict>>
+      _cdict;
+    std::unique_ptr<
+      ZSTD_DDict,
+      static_sized_deleter_fn<ZSTD_DDict, &ZSTD_freeDDict>>
+      _ddict;
+};
+
+/**
+ * Samples the payloads of a topic to train a dictionary on them.
+ *
+ * The samples are a uniform reservoir over every payload added, of bounded
+ * count and size, so that sampling every batch of a busy topic costs a
+ * bounded amount of memory. Training scans all the samples and is CPU
+ * intensive (milliseconds per MiB of samples), it is meant to run rarely, on
+ * a background scheduling group.
+ */
+class zstd_dictionary_trainer {
+public:
+    static constexpr size_t default_max_samples = 1024;
+    static constexpr size_t default_max_sample_size = 4_KiB;
+    static constexpr size_t default_dictionary_size = 16_KiB;
+    // zstd fails to train on fewer samples
+    static constexpr size_t min_samples = 16;
+
+    explicit zstd_dictionary_trainer(
+      size_t max_samples = default_max_samples,
+      size_t max_sample_size = default_max_sample_size);
+
+    /// Offers a payload to the reservoir, the payloads larger than the max
+    /// sample size are truncated.
+    void add_sample(const iobuf&);
+
+    size_t sample_count() const { return _samples.size(); }
+    /// The number of payloads offered since the last reset.
+    uint64_t seen() const { return _seen; }
+    bool can_train() const { return _samples.size() >= min_samples; }
+
+    /// Trains a dictionary of at most \p dictionary_size bytes on the
+    /// samples. Throws if there are too few samples or they have nothing in
+    /// common.
+    zstd_dictionary train(
+      size_t dictionary_size = default_dictionary_size,
+      int compression_level = zstd_dictionary::default_compression_level)
+      const;
+
+    void reset();
+
+private:
+    size_t _max_samples;
+    size_t _max_sample_size;
+    uint64_t _seen{0};
+    std::vector<bytes> _samples;
+    std::minstd_rand _rng;
+};
+
+/**
+ * The dictionaries known to a shard, by topic and by id.
+ *
+ * A topic compresses with its latest dictionary, the frames compressed with
+ * the previous versions are still decompressed by id as long as the
+ * dictionaries are kept.
+ */
+class zstd_dictionary_registry {
+public:
+    using dictionary_ptr = ss::lw_shared_ptr<const zstd_dictionary>;
+
+    /// Makes \p dict the latest dictionary of \p topic.
+    void add(const ss::sstring& topic, dictionary_ptr dict);
+
+    /// The dictionary to compress the batches of \p topic with, null if it
+    /// has none.
+    dictionary_ptr latest(const ss::sstring& topic) const;
+
+    /// The dictionary of id \p id, null if it is unknown.
+    dictionary_ptr find(uint32_t id) const;
+
+    /// Forgets the dictionaries of \p topic, e.g. once it is deleted.
+    void remove(const ss::sstring& topic);
+
+private:
+    absl::flat_hash_map<ss::sstring, std::vector<dictionary_ptr>> _by_topic;
+    absl::flat_hash_map<uint32_t, dictionary_ptr> _by_id;
+};
+
+} // namespace compression
@@ -11,11 +11,13 @@
 
 #include "base/vassert.h"
 #include "bytes/bytes.h"
+#include "compression/internal/context_pool.h"
 
 #include <seastar/core/temporary_buffer.hh>
 
 #include <fmt/core.h>
 
+#include <memory>
 #include <zlib.h>
 
 namespace compression::internal {
@@ -49,7 +51,12 @@ public:
       = delete;
 
     void reset() {
-        vassert(!_init, "Double initialized gzip decompression codec");
+        if (_init) {
+            // keeps the allocated state and the parameters
+            throw_if_zstream_error(
+              "gzip compress deflateReset error: {}", deflateReset(&_stream));
+            return;
+        }
         _stream = default_zstream();
         throw_if_zstream_error(
           "gzip compress deflateInit2 error: {}",
@@ -76,9 +83,7 @@ private:
 };
 class gzip_decompression_codec {
 public:
-    gzip_decompression_codec(const iobuf& input) noexcept
-      : _input(input)
-      , _input_chunk(input.begin()) {}
+    gzip_decompression_codec() noexcept = default;
     gzip_decompression_codec(const gzip_decompression_codec&) = delete;
     gzip_decompression_codec& operator=(const gzip_decompression_codec&)
       = delete;
@@ -86,17 +91,26 @@ public:
     gzip_decompression_codec& operator=(gzip_decompression_codec&&) noexcept
       = delete;
 
-    void reset() {
-        vassert(!_init, "Double initialized gzip decompression codec");
-        _stream = default_zstream();
+    void reset(const iobuf& input) {
+        _input = &input;
+        _input_chunk = input.begin();
+        if (_init) {
+            throw_if_zstream_error(
+              "gzip error with inflateReset:{}", inflateReset(&_stream));
+        } else {
+            _stream = default_zstream();
+        }
         // zlib is not const-correct
         // NOLINTNEXTLINE
         _stream.next_in = (unsigned char*)(_input_chunk->get());
         _stream.avail_in = _input_chunk->size();
-        throw_if_zstream_error(
-          "gzip error with inflateInit2:{}", inflateInit2(&_stream, 15 + 32));
-        // marking init must happen before gzip header
-        _init = true;
+        if (!_init) {
+            throw_if_zstream_error(
+              "gzip error with inflateInit2:{}",
+              inflateInit2(&_stream, 15 + 32));
+            // marking init must happen before gzip header
+            _init = true;
+        }
 
         // last
         throw_if_zstream_error(
@@ -118,19 +132,25 @@ public:
 private:
     bool _init{false};
 
-    const iobuf& _input;
+    const iobuf* _input{nullptr};
     iobuf::const_iterator _input_chunk;
 
     gz_header _hdr; // needed for gzip
     z_stream _stream;
 };
 
+static thread_local context_pool<std::unique_ptr<gzip_compression_codec>>
+  compression_codecs;
+static thread_local context_pool<std::unique_ptr<gzip_decompression_codec>>
+  decompression_codecs;
+
 iobuf gzip_compressor::compress(const iobuf& b) {
     const size_t max_chunk_size = details::io_allocation_size::max_chunk_size;
 
-    gzip_compression_codec def;
-    def.reset();
-    z_stream& strm = def.stream();
+    auto def = compression_codecs.acquire(
+      [] { return std::make_unique<gzip_compression_codec>(); });
+    def->reset();
+    z_stream& strm = def->stream();
 
     const size_t output_size_estimate = deflateBound(&strm, b.size_bytes());
     size_t output_chunk_size = std::min(max_chunk_size, output_size_estimate);
@@ -180,7 +200,7 @@ iobuf gzip_decompression_codec::inflate_to_iobuf() {
 
     // Rough guess at compression ratio to guess initial chunk size for
     // small buffers.
-    size_t chunk_size = std::min(max_chunk_size, _input.size_bytes() * 3);
+    size_t chunk_size = std::min(max_chunk_size, _input->size_bytes() * 3);
 
     int code = 0;
     iobuf output;
@@ -201,9 +221,9 @@ iobuf gzip_decompression_codec::inflate_to_iobuf() {
         default: /*do nothing*/;
         }
 
-        while (_stream.avail_in == 0 && _input_chunk != _input.end()) {
+        while (_stream.avail_in == 0 && _input_chunk != _input->end()) {
             _input_chunk++;
-            if (_input_chunk != _input.end()) {
+            if (_input_chunk != _input->end()) {
                 _stream.next_in = const_cast<unsigned char*>(
                   reinterpret_cast<const unsigned char*>(_input_chunk->get()));
                 _stream.avail_in = _input_chunk->size();
@@ -223,9 +243,10 @@ iobuf gzip_decompression_codec::inflate_to_iobuf() {
 }
 
 iobuf gzip_compressor::uncompress(const iobuf& b) {
-    auto codec = gzip_decompression_codec(b);
-    codec.reset();
-    return codec.inflate_to_iobuf();
+    auto codec = decompression_codecs.acquire(
+      [] { return std::make_unique<gzip_decompression_codec>(); });
+    codec->reset(b);
+    return codec->inflate_to_iobuf();
 }
 
 } // namespace compression::internal
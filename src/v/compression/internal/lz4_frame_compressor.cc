@@ -12,6 +12,7 @@
 #include "base/units.h"
 #include "base/vassert.h"
 #include "bytes/bytes.h"
+#include "compression/internal/context_pool.h"
 #include "static_deleter_fn.h"
 
 #include <seastar/core/temporary_buffer.hh>
@@ -65,8 +66,13 @@ static lz4_decompression_ctx make_decompression_context() {
     return lz4_decompression_ctx(c);
 }
 
+static thread_local context_pool<lz4_compression_ctx> compression_contexts;
+static thread_local context_pool<lz4_decompression_ctx>
+  decompression_contexts;
+
 iobuf lz4_frame_compressor::compress(const iobuf& b) {
-    auto ctx_ptr = make_compression_context();
+    // LZ4F_compressBegin resets a reused context
+    auto ctx_ptr = compression_contexts.acquire(make_compression_context);
     LZ4F_compressionContext_t ctx = ctx_ptr.get();
     /* Required by Kafka */
     LZ4F_preferences_t prefs;
@@ -175,8 +181,13 @@ iobuf lz4_frame_compressor::uncompress(iobuf const& input) {
     size_t read_this_chunk{0};
     size_t read_total{0};
 
-    auto ctx_ptr = make_decompression_context();
+    auto ctx_ptr = decompression_contexts.acquire(
+      make_decompression_context);
     LZ4F_decompressionContext_t ctx = ctx_ptr.get();
+    if (!ctx_ptr.fresh()) {
+        // the previous frame may have failed half way
+        LZ4F_resetDecompressionContext(ctx);
+    }
 
     // Prior to main loop, optionally consume header to learn total size
     LZ4F_errorCode_t code = 0;
@@ -15,6 +15,7 @@
 #include "base/vlog.h"
 #include "bytes/bytes.h"
 #include "bytes/details/io_allocation_size.h"
+#include "compression/zstd_dictionary.h"
 
 #include <seastar/core/aligned_buffer.hh>
 
@@ -58,6 +59,13 @@ void stream_zstd::init_workspace(size_t size) {
 }
 
 void stream_zstd::reset_compressor() {
+    if (_compress) {
+        // keeps the workspace of the context, and drops the parameters and
+        // dictionary of the previous frame
+        throw_if_error(
+          ZSTD_CCtx_reset(_compress.get(), ZSTD_reset_session_and_parameters));
+        return;
+    }
     _compress.reset(ZSTD_createCCtx());
     if (!_compress) {
         throw std::bad_alloc{};
@@ -85,9 +93,12 @@ ZSTD_DCtx* stream_zstd::decompressor() {
     return ctx;
 }
 
-iobuf stream_zstd::do_compress(const iobuf& x) {
+iobuf stream_zstd::do_compress(const iobuf& x, const zstd_dictionary* dict) {
     reset_compressor();
     ZSTD_CCtx* ctx = compressor().get();
+    if (dict) {
+        throw_if_error(ZSTD_CCtx_refCDict(ctx, dict->cdict()));
+    }
     // NOTE: always enable content size. **decompression** depends on this
     throw_if_error(ZSTD_CCtx_setPledgedSrcSize(ctx, x.size_bytes()));
 
@@ -194,12 +205,16 @@ size_t decompression_step(const iobuf& x) {
     return std::min(64_KiB, ret);
 }
 
-iobuf stream_zstd::do_uncompress(const iobuf& x) {
+iobuf stream_zstd::do_uncompress(
+  const iobuf& x, const zstd_dictionary* dict) {
     if (unlikely(x.empty())) {
         throw std::runtime_error(
           "Asked to stream_zstd::uncompress empty buffer");
     }
     ZSTD_DCtx* dctx = decompressor();
+    if (dict) {
+        throw_if_error(ZSTD_DCtx_refDDict(dctx, dict->ddict()));
+    }
     iobuf ret;
     ss::temporary_buffer<char>& obuf = d_buffer;
     ZSTD_outBuffer out = {
@@ -12,6 +12,9 @@
 #include "compression/async_stream_zstd.h"
 #include "compression/internal/gzip_compressor.h"
 #include "compression/internal/lz4_frame_compressor.h"
+#include "compression/internal/snappy_java_compressor.h"
+#include "compression/internal/zstd_compressor.h"
+#include "compression/snappy_standard_compressor.h"
 #include "compression/stream_zstd.h"
 #include "random/generators.h"
 
@@ -144,6 +147,70 @@ PERF_TEST(gzip_10mb, uncompress) {
       10 << 20);
 }
 
+PERF_TEST(snappy_java_1mb, compress) {
+    return compress_fn_test(
+      compression::internal::snappy_java_compressor::compress, 1 << 20);
+}
+
+PERF_TEST(snappy_java_1mb, uncompress) {
+    return uncompress_fn_test(
+      compression::internal::snappy_java_compressor::compress,
+      compression::internal::snappy_java_compressor::uncompress,
+      1 << 20);
+}
+
+PERF_TEST(snappy_standard_1mb, compress) {
+    return compress_fn_test(
+      compression::snappy_standard_compressor::compress, 1 << 20);
+}
+
+PERF_TEST(snappy_standard_1mb, uncompress) {
+    return uncompress_fn_test(
+      compression::snappy_standard_compressor::compress,
+      compression::snappy_standard_compressor::uncompress,
+      1 << 20);
+}
+
+PERF_TEST(zstd_1mb, compress) {
+    return compress_fn_test(
+      compression::internal::zstd_compressor::compress, 1 << 20);
+}
+
+PERF_TEST(zstd_1mb, uncompress) {
+    return uncompress_fn_test(
+      compression::internal::zstd_compressor::compress,
+      compression::internal::zstd_compressor::uncompress,
+      1 << 20);
+}
+
+// small batches, where setting up the context of the codec dominates
+PERF_TEST(lz4_4kb, compress) {
+    return compress_fn_test(
+      compression::internal::lz4_frame_compressor::compress, 4 << 10);
+}
+
+PERF_TEST(gzip_4kb, compress) {
+    return compress_fn_test(
+      compression::internal::gzip_compressor::compress, 4 << 10);
+}
+
+PERF_TEST(gzip_4kb, uncompress) {
+    return uncompress_fn_test(
+      compression::internal::gzip_compressor::compress,
+      compression::internal::gzip_compressor::uncompress,
+      4 << 10);
+}
+
+PERF_TEST(snappy_java_4kb, compress) {
+    return compress_fn_test(
+      compression::internal::snappy_java_compressor::compress, 4 << 10);
+}
+
+PERF_TEST(zstd_4kb, compress) {
+    return compress_fn_test(
+      compression::internal::zstd_compressor::compress, 4 << 10);
+}
+
 struct async_stream_zstd {};
 PERF_TEST_C(async_stream_zstd, 1mb_compress) {
     co_await async_compress_test(1 << 20);
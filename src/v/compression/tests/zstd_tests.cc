@@ -10,12 +10,14 @@
 #include "base/units.h"
 #include "base/vassert.h"
 #include "compression/async_stream_zstd.h"
+#include "compression/compression.h"
 #include "compression/internal/gzip_compressor.h"
 #include "compression/internal/lz4_frame_compressor.h"
 #include "compression/internal/snappy_java_compressor.h"
 #include "compression/internal/zstd_compressor.h"
 #include "compression/snappy_standard_compressor.h"
 #include "compression/stream_zstd.h"
+#include "compression/zstd_dictionary.h"
 #include "random/generators.h"
 
 #include <seastar/testing/thread_test_case.hh>
@@ -186,3 +188,112 @@ SEASTAR_THREAD_TEST_CASE(gzip_test) {
     using fn = compression::internal::gzip_compressor;
     roundtrip_compression(fn::compress, fn::uncompress);
 }
+
+SEASTAR_THREAD_TEST_CASE(pooled_contexts_survive_failures) {
+    // the codecs reuse their contexts, a failure leaves nothing behind for
+    // the next batch
+    for (auto t :
+         {compression::type::gzip,
+          compression::type::lz4,
+          compression::type::zstd}) {
+        for (size_t i : {0_KiB, 1_KiB, 300_KiB}) {
+            auto buf = gen(i);
+            auto cbuf = compression::compressor::compress(buf, t);
+            iobuf garbage;
+            garbage.append(cbuf.share(0, cbuf.size_bytes() / 2));
+            garbage.append(gen(64));
+            BOOST_CHECK_THROW(
+              compression::compressor::uncompress(gen(128), t),
+              std::exception);
+            try {
+                compression::compressor::uncompress(garbage, t);
+            } catch (const std::exception&) {
+            }
+            BOOST_CHECK_EQUAL(
+              compression::compressor::uncompress(cbuf, t), buf);
+            BOOST_CHECK_EQUAL(
+              compression::compressor::uncompress(
+                compression::compressor::compress(buf, t), t),
+              buf);
+        }
+    }
+}
+
+static iobuf small_json_message(int i) {
+    iobuf buf;
+    buf.append(fmt::format(
+      R"({{"user_id": {}, "event": "page_view", "session": "{}", )"
+      R"("path": "/products/{}", "referrer": "https://example.com/"}})",
+      i,
+      random_generators::gen_alphanum_string(12),
+      i % 97));
+    return buf;
+}
+
+SEASTAR_THREAD_TEST_CASE(zstd_dictionary_roundtrip) {
+    compression::zstd_dictionary_trainer trainer;
+    BOOST_REQUIRE(!trainer.can_train());
+    BOOST_REQUIRE_THROW(trainer.train(), std::invalid_argument);
+    for (int i = 0; i < 5000; ++i) {
+        trainer.add_sample(small_json_message(i));
+    }
+    BOOST_REQUIRE_EQUAL(trainer.seen(), 5000);
+    BOOST_REQUIRE_EQUAL(
+      trainer.sample_count(),
+      compression::zstd_dictionary_trainer::default_max_samples);
+    auto dict = trainer.train();
+    BOOST_REQUIRE_NE(dict.id(), 0);
+
+    compression::stream_zstd fn;
+    size_t plain_size = 0;
+    size_t dict_size = 0;
+    for (int i = 0; i < 100; ++i) {
+        auto msg = small_json_message(i);
+        auto plain = fn.compress(msg);
+        auto with_dict = fn.compress(msg, dict);
+        plain_size += plain.size_bytes();
+        dict_size += with_dict.size_bytes();
+
+        BOOST_REQUIRE(
+          !compression::zstd_dictionary::frame_dictionary_id(plain));
+        BOOST_REQUIRE_EQUAL(
+          compression::zstd_dictionary::frame_dictionary_id(with_dict),
+          dict.id());
+        BOOST_REQUIRE_EQUAL(fn.uncompress(with_dict, dict), msg);
+        BOOST_REQUIRE_THROW(fn.uncompress(with_dict), std::runtime_error);
+    }
+    BOOST_REQUIRE_LT(dict_size, plain_size);
+
+    // a persisted dictionary decompresses the frames of the original
+    compression::zstd_dictionary loaded(dict.content());
+    BOOST_REQUIRE_EQUAL(loaded.id(), dict.id());
+    auto msg = small_json_message(7);
+    BOOST_REQUIRE_EQUAL(fn.uncompress(fn.compress(msg, dict), loaded), msg);
+
+    BOOST_REQUIRE_THROW(
+      compression::zstd_dictionary(bytes("not a dictionary")),
+      std::invalid_argument);
+}
+
+SEASTAR_THREAD_TEST_CASE(zstd_dictionary_registry_versions) {
+    compression::zstd_dictionary_trainer trainer;
+    for (int i = 0; i < 500; ++i) {
+        trainer.add_sample(small_json_message(i));
+    }
+    auto v1 = ss::make_lw_shared<const compression::zstd_dictionary>(
+      trainer.train());
+    auto v2 = ss::make_lw_shared<const compression::zstd_dictionary>(
+      trainer.train(8_KiB));
+
+    compression::zstd_dictionary_registry registry;
+    BOOST_REQUIRE(!registry.latest("events"));
+    registry.add("events", v1);
+    registry.add("events", v2);
+    BOOST_REQUIRE_EQUAL(registry.latest("events"), v2);
+    BOOST_REQUIRE_EQUAL(registry.find(v1->id()), v1);
+    BOOST_REQUIRE_EQUAL(registry.find(v2->id()), v2);
+
+    registry.remove("events");
+    BOOST_REQUIRE(!registry.latest("events"));
+    BOOST_REQUIRE(!registry.find(v1->id()));
+}
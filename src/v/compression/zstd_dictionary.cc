@@ -0,0 +1,161 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "compression/zstd_dictionary.h"
+
+#include "base/likely.h"
+
+#include <fmt/format.h>
+
+#include <array>
+#include <stdexcept>
+#include <zdict.h>
+#include <zstd.h>
+#include <zstd_errors.h>
+
+namespace compression {
+
+zstd_dictionary::zstd_dictionary(bytes content, int compression_level)
+  : _content(std::move(content))
+  , _id(ZDICT_getDictID(_content.data(), _content.size())) {
+    if (_id == 0) {
+        throw std::invalid_argument(fmt::format(
+          "Not a zstd dictionary ({} bytes)", _content.size()));
+    }
+    _cdict.reset(
+      ZSTD_createCDict(_content.data(), _content.size(), compression_level));
+    _ddict.reset(ZSTD_createDDict(_content.data(), _content.size()));
+    if (!_cdict || !_ddict) {
+        throw std::bad_alloc{};
+    }
+}
+
+std::optional<uint32_t>
+zstd_dictionary::frame_dictionary_id(const iobuf& frame) {
+    std::array<char, ZSTD_FRAMEHEADERSIZE_MAX> header{};
+    const auto size = std::min(header.size(), frame.size_bytes());
+    auto consumer = iobuf::iterator_consumer(frame.cbegin(), frame.cend());
+    consumer.consume_to(size, header.data());
+    auto id = ZSTD_getDictID_fromFrame(header.data(), size);
+    if (id == 0) {
+        return std::nullopt;
+    }
+    return id;
+}
+
+zstd_dictionary_trainer::zstd_dictionary_trainer(
+  size_t max_samples, size_t max_sample_size)
+  : _max_samples(max_samples)
+  , _max_sample_size(max_sample_size) {
+    _samples.reserve(_max_samples);
+}
+
+void zstd_dictionary_trainer::add_sample(const iobuf& payload) {
+    ++_seen;
+    size_t slot = _samples.size();
+    if (_samples.size() == _max_samples) {
+        // keeps each of the payloads seen with the same probability
+        slot = std::uniform_int_distribution<uint64_t>(0, _seen - 1)(_rng);
+        if (slot >= _max_samples) {
+            return;
+        }
+    }
+    bytes sample(
+      bytes::initialized_later{},
+      std::min(payload.size_bytes(), _max_sample_size));
+    auto consumer = iobuf::iterator_consumer(payload.cbegin(), payload.cend());
+    consumer.consume_to(sample.size(), sample.data());
+    if (slot == _samples.size()) {
+        _samples.push_back(std::move(sample));
+    } else {
+        _samples[slot] = std::move(sample);
+    }
+}
+
+zstd_dictionary zstd_dictionary_trainer::train(
+  size_t dictionary_size, int compression_level) const {
+    if (!can_train()) {
+        throw std::invalid_argument(fmt::format(
+          "Cannot train a zstd dictionary on {} samples, {} are needed",
+          _samples.size(),
+          min_samples));
+    }
+    // zdict takes the samples concatenated
+    size_t total = 0;
+    std::vector<size_t> sizes;
+    sizes.reserve(_samples.size());
+    for (const auto& s : _samples) {
+        sizes.push_back(s.size());
+        total += s.size();
+    }
+    bytes concatenated(bytes::initialized_later{}, total);
+    size_t pos = 0;
+    for (const auto& s : _samples) {
+        std::copy_n(s.data(), s.size(), concatenated.data() + pos);
+        pos += s.size();
+    }
+
+    bytes dict(bytes::initialized_later{}, dictionary_size);
+    auto size = ZDICT_trainFromBuffer(
+      dict.data(),
+      dict.size(),
+      concatenated.data(),
+      sizes.data(),
+      static_cast<unsigned>(sizes.size()));
+    if (unlikely(ZDICT_isError(size))) {
+        throw std::runtime_error(fmt::format(
+          "Failed to train a zstd dictionary on {} samples: {}",
+          _samples.size(),
+          ZDICT_getErrorName(size)));
+    }
+    dict.resize(size);
+    return zstd_dictionary(std::move(dict), compression_level);
+}
+
+void zstd_dictionary_trainer::reset() {
+    _samples.clear();
+    _seen = 0;
+}
+
+void zstd_dictionary_registry::add(
+  const ss::sstring& topic, dictionary_ptr dict) {
+    _by_id.insert_or_assign(dict->id(), dict);
+    _by_topic[topic].push_back(std::move(dict));
+}
+
+zstd_dictionary_registry::dictionary_ptr
+zstd_dictionary_registry::latest(const ss::sstring& topic) const {
+    auto it = _by_topic.find(topic);
+    if (it == _by_topic.end() || it->second.empty()) {
+        return nullptr;
+    }
+    return it->second.back();
+}
+
+zstd_dictionary_registry::dictionary_ptr
+zstd_dictionary_registry::find(uint32_t id) const {
+    auto it = _by_id.find(id);
+    if (it == _by_id.end()) {
+        return nullptr;
+    }
+    return it->second;
+}
+
+void zstd_dictionary_registry::remove(const ss::sstring& topic) {
+    auto it = _by_topic.find(topic);
+    if (it == _by_topic.end()) {
+        return;
+    }
+    for (const auto& dict : it->second) {
+        _by_id.erase(dict->id());
+    }
+    _by_topic.erase(it);
+}
+
+} // namespace compression
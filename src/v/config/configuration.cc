@@ -12,6 +12,7 @@
 #include "base/units.h"
 #include "config/base_property.h"
 #include "config/bounded_property.h"
+#include "config/hot_path.h"
 #include "config/node_config.h"
 #include "config/validators.h"
 #include "model/metadata.h"
@@ -154,12 +155,71 @@ configuration::configuration()
       {.example = "8"},
       32,
       {.min = 8})
+  , rpc_client_traffic_class_connections(
+      *this,
+      "rpc_client_traffic_class_connections",
+      "Use separate connections to each peer for latency sensitive control "
+      "requests, such as raft heartbeats and votes, and for bulk transfers, "
+      "such as snapshots sent to recovering replicas, so that they don't "
+      "queue behind the replication traffic.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
+  , rpc_write_coalescing_max_delay_us(
+      *this,
+      "rpc_write_coalescing_max_delay_us",
+      "Maximum time, in microseconds, the replies and requests written to a "
+      "connection are held back to be sent together in a single system call. "
+      "They are only held back while they arrive faster than this, for at "
+      "most about twice the interval between their arrivals. 0 sends each "
+      "write as soon as no other write is pending. Applies to new "
+      "connections.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0,
+      {.min = 0, .max = 10000})
   , rpc_server_compress_replies(
       *this,
       "rpc_server_compress_replies",
       "Enable compression for internal rpc server replies",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       false)
+  , rpc_controller_compression_bytes(
+      *this,
+      "rpc_controller_compression_bytes",
+      "Controller service replies, e.g. node and cluster health reports, of "
+      "at least this many bytes are compressed with zstd on the wire. 0 "
+      "compresses all of them, an empty value disables compression.",
+      {.needs_restart = needs_restart::no,
+       .example = "4096",
+       .visibility = visibility::tunable},
+      std::nullopt)
+  , rpc_data_transforms_compression_bytes(
+      *this,
+      "rpc_data_transforms_compression_bytes",
+      "Data transforms service requests and replies, e.g. produce requests "
+      "and Wasm binaries, of at least this many bytes are compressed with "
+      "zstd on the wire. 0 compresses all of them, an empty value disables "
+      "compression.",
+      {.needs_restart = needs_restart::no,
+       .example = "4096",
+       .visibility = visibility::tunable},
+      std::nullopt)
+  , dns_cache_ttl_ms(
+      *this,
+      "dns_cache_ttl_ms",
+      "How long a resolved address of the outgoing connections, e.g. to "
+      "other brokers and to cloud storage, is reused before it is resolved "
+      "again. Past it, the address is still used for as long again while it "
+      "is resolved in the background. 0 disables the cache.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      30s)
+  , dns_cache_negative_ttl_ms(
+      *this,
+      "dns_cache_negative_ttl_ms",
+      "How long a failure to resolve the address of an outgoing connection "
+      "is reused before the address is resolved again. 0 disables negative "
+      "caching.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      1s)
   , enable_coproc(*this, "enable_coproc")
   , coproc_max_inflight_bytes(*this, "coproc_max_inflight_bytes")
   , coproc_max_ingest_bytes(*this, "coproc_max_ingest_bytes")
@@ -217,6 +277,61 @@ configuration::configuration()
       "the time it takes for a single record to be transformed.",
       {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
       3s)
+  , data_transforms_standby_engines(
+      *this,
+      "data_transforms_standby_engines",
+      "Keep a started spare virtual machine for each data transform on each "
+      "core, which takes over when the running one fails so that the "
+      "transform resumes without waiting for a new one to start. Each spare "
+      "uses data_transforms_per_function_memory_limit of the "
+      "data_transforms_per_core_memory_reservation.",
+      {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
+      false)
+  , data_transforms_huge_page_memory(
+      *this,
+      "data_transforms_huge_page_memory",
+      "Back the memory of Data Transform WebAssembly Virtual Machines with "
+      "huge pages, to make fewer TLB misses when running the transforms. "
+      "The memory given to each Virtual Machine is rounded up to a multiple "
+      "of 2MiB, which may lower how many functions fit in "
+      "data_transforms_per_core_memory_reservation.",
+      {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
+      false)
+  , data_transforms_compilation_cache_enabled(
+      *this,
+      "data_transforms_compilation_cache_enabled",
+      "Cache the native code compiled from Data Transform WebAssembly "
+      "modules in the data directory, so that a node deploying a transform "
+      "it has run before loads the compiled code instead of compiling the "
+      "module again.",
+      {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
+      false)
+  , data_transforms_parallel_engines(
+      *this,
+      "data_transforms_parallel_engines",
+      "The number of virtual machines, each on a different core, that "
+      "transform the batches of a partition at the same time. The transformed "
+      "batches are written in the order they were read, but each virtual "
+      "machine sees only some of the records of the partition, so only use "
+      "more than one for transforms that keep no state between records. "
+      "Applies to transforms on partitions that start after the change.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      1,
+      {.min = 1, .max = 64})
+  , data_transforms_per_core_buffer_memory(
+      *this,
+      "data_transforms_per_core_buffer_memory",
+      "The amount of memory on each core for buffering records between "
+      "reading, transforming and writing them. It's shared between the data "
+      "transforms on the core, the ones that read the most get the largest "
+      "share.",
+      {
+        .needs_restart = needs_restart::no,
+        .example = std::to_string(32_MiB),
+        .visibility = visibility::tunable,
+      },
+      16_MiB,
+      {.min = 1_MiB})
   , data_transforms_binary_max_size(
       *this,
       "data_transforms_binary_max_size",
@@ -365,6 +480,25 @@ configuration::configuration()
       "enables raft optimization of heartbeats",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       true)
+  , raft_enable_leader_lease(
+      *this,
+      "raft_enable_leader_lease",
+      "Enables leader leases. A leader whose heartbeats were acknowledged by "
+      "a majority within half of the election timeout answers linearizable "
+      "barriers from its local state instead of a round of heartbeats. "
+      "Followers then also refuse votes to any node while they still hear "
+      "from the leader. Must be enabled on all nodes.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
+  , raft_enable_follower_catchup_from_cloud(
+      *this,
+      "raft_enable_follower_catchup_from_cloud",
+      "Recover followers of partitions with data in cloud storage that fell "
+      "behind by more than the initial local retention target the same way as "
+      "new replicas: starting from that target, the older data being read from "
+      "cloud storage, instead of replicating the whole log from the leader.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
   , raft_recovery_concurrency_per_shard(
       *this,
       "raft_recovery_concurrency_per_shard",
@@ -461,6 +595,17 @@ configuration::configuration()
       "Quota manager GC frequency in milliseconds",
       {.visibility = visibility::tunable},
       std::chrono::milliseconds(30000))
+  , kafka_client_quota_exchange_period(
+      *this,
+      "kafka_client_quota_exchange_period_ms",
+      "Period, in milliseconds, at which the shards exchange the throughput "
+      "rates of the clients they track, so that the produce and fetch quotas "
+      "of a client are enforced on the node-wide rate rather than on the rate "
+      "seen by each shard. Shorter periods make the enforcement more accurate "
+      "at the cost of more cross-shard traffic. If unset, every shard enforces "
+      "the quotas on its own rates.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      std::nullopt)
   , target_quota_byte_rate(
       *this,
       "target_quota_byte_rate",
@@ -557,6 +702,15 @@ configuration::configuration()
       "How often the system should check for expired group offsets.",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       10min)
+  , group_consumer_lag_refresh_ms(
+      *this,
+      "group_consumer_lag_refresh_ms",
+      "How often the lag of the consumer groups coordinated by a broker is "
+      "computed from their committed offsets and the high watermarks of the "
+      "partitions replicated on the broker. The lag is published per group "
+      "and through the admin API. Lag tracking is disabled if null.",
+      {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
+      std::nullopt)
   , legacy_group_offset_retention_enabled(
       *this,
       "legacy_group_offset_retention_enabled",
@@ -565,6 +719,14 @@ configuration::configuration()
       "set this option to true.",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       false)
+  , group_coalesce_offset_commits(
+      *this,
+      "group_coalesce_offset_commits",
+      "Replicate the offset commits that groups coordinated by the same "
+      "partition store at the same time with a single replication request, "
+      "instead of one request per offset commit.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
   , metadata_dissemination_interval_ms(
       *this,
       "metadata_dissemination_interval_ms",
@@ -632,6 +794,14 @@ configuration::configuration()
         model::fetch_read_strategy::polling,
         model::fetch_read_strategy::non_polling,
       })
+  , fetch_coalesce_cross_shard_reads(
+      *this,
+      "fetch_coalesce_cross_shard_reads",
+      "Batch the reads of concurrent fetch requests from the same remote shard "
+      "into one cross shard call per reactor tick, and pass their results "
+      "back by sharing the remote buffers rather than copying them",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
   , alter_topic_cfg_timeout_ms(
       *this,
       "alter_topic_cfg_timeout_ms",
@@ -773,6 +943,15 @@ configuration::configuration()
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       std::numeric_limits<uint64_t>::max(),
       {.min = 1})
+  , max_spilled_producer_state_bytes(
+      *this,
+      "max_spilled_producer_state_bytes",
+      "Memory per shard for the compact state of idle producers evicted "
+      "because max_concurrent_producer_ids was passed. A producer whose state "
+      "is kept resumes its sequence where it left off instead of having its "
+      "batches rejected. 0 disables keeping the state of evicted producers.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0)
   , max_transactions_per_coordinator(
       *this,
       "max_transactions_per_coordinator",
@@ -784,6 +963,16 @@ configuration::configuration()
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       std::numeric_limits<uint64_t>::max(),
       {.min = 1})
+  , max_transactions_memory_per_coordinator(
+      *this,
+      "max_transactions_memory_per_coordinator",
+      "Max memory (in bytes) a transaction coordinator partition may use for "
+      "the metadata of the txn sessions (producers). When the threshold is "
+      "passed Redpanda terminates old sessions, like when the number of "
+      "sessions passes max_transactions_per_coordinator. Finished sessions "
+      "are kept in a compact form. Unlimited if not set.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      std::nullopt)
   , enable_idempotence(
       *this,
       "enable_idempotence",
@@ -829,6 +1018,42 @@ configuration::configuration()
       "Use sliding window compaction.",
       {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
       true)
+  , min_cleanable_dirty_ratio(
+      *this,
+      "min_cleanable_dirty_ratio",
+      "Minimum ratio of dirty bytes to total bytes in the closed segments of a "
+      "compacted log before sliding window compaction runs on it. Dirty bytes "
+      "are those written since the last compaction of the log, which may "
+      "shadow keys in older segments. A value of 0 compacts a log whenever it "
+      "has segments to compact.",
+      {.needs_restart = needs_restart::no,
+       .example = "0.2",
+       .visibility = visibility::tunable},
+      0.0,
+      {.min = 0.0, .max = 1.0})
+  , log_compaction_use_key_filters(
+      *this,
+      "log_compaction_use_key_filters",
+      "Persist a filter of the keys of each segment deduplicated by sliding "
+      "window compaction, and skip deduplicating segments whose filter shares "
+      "no keys with the compaction key map. Requires "
+      "`log_compaction_use_sliding_window`.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
+  , log_compaction_key_hash(
+      *this,
+      "log_compaction_key_hash",
+      "Hash function sliding window compaction identifies keys by. `sha256` "
+      "can't be made to collide by crafted keys. `xxh3` is several times "
+      "cheaper to compute, but a producer able to craft colliding keys could "
+      "make compaction remove records of other keys, so it should only be "
+      "used when all producers are trusted. Key filters built with one hash "
+      "function are ignored by the other.",
+      {.needs_restart = needs_restart::yes,
+       .example = "xxh3",
+       .visibility = visibility::tunable},
+      model::compaction_key_hash::sha256,
+      {model::compaction_key_hash::sha256, model::compaction_key_hash::xxh3})
   , retention_bytes(
       *this,
       "retention_bytes",
@@ -952,6 +1177,18 @@ configuration::configuration()
       "Max size of requests cached for replication",
       {.visibility = visibility::tunable},
       1_MiB)
+  , raft_replicate_batch_latency_target(
+      *this,
+      "raft_replicate_batch_latency_target",
+      "Target latency of replicating requests cached for replication. When "
+      "set, a busy partition holds back flushing the cache to build larger "
+      "batches for as long as the expected replication latency stays within "
+      "the target, while a quiet partition flushes immediately. When empty "
+      "the cache is flushed as soon as possible.",
+      {.needs_restart = needs_restart::no,
+       .example = "5",
+       .visibility = visibility::tunable},
+      std::nullopt)
   , raft_learner_recovery_rate(
       *this,
       "raft_learner_recovery_rate",
@@ -978,6 +1215,43 @@ configuration::configuration()
       "one follower",
       {.visibility = visibility::tunable},
       16)
+  , raft_max_inflight_append_bytes_per_follower(
+      *this,
+      "raft_max_inflight_append_bytes_per_follower",
+      "Maximum number of bytes of append entries requests sent by leader to "
+      "one follower and not yet replied to. Together with "
+      "`raft_max_concurrent_append_requests_per_follower` this bounds the "
+      "replication window of a follower. An empty value leaves the window "
+      "bounded by the number of requests only.",
+      {.example = "16777216", .visibility = visibility::tunable},
+      std::nullopt)
+  , raft_append_entries_compression_bytes(
+      *this,
+      "raft_append_entries_compression_bytes",
+      "Append entries requests sent to followers of at least this many bytes "
+      "are compressed with zstd on the wire. Trades CPU on both ends for "
+      "inter-node bandwidth, useful when producers do not compress. An empty "
+      "value disables compression.",
+      {.needs_restart = needs_restart::no,
+       .example = "4096",
+       .visibility = visibility::tunable},
+      std::nullopt)
+  , raft_enable_independent_stm_apply(
+      *this,
+      "raft_enable_independent_stm_apply",
+      "Apply committed batches to each state machine of a partition in a "
+      "separate fiber, so that a slow state machine, e.g. archival metadata "
+      "processing a large manifest update, does not delay the others.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
+  , raft_coalesce_follower_flushes(
+      *this,
+      "raft_coalesce_follower_flushes",
+      "Flush the logs that followers on a shard appended to together, in "
+      "shard-wide flush epochs, instead of flushing each raft group as soon "
+      "as it appends.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
   , write_caching(
       *this,
       "write_caching",
@@ -1023,6 +1297,20 @@ configuration::configuration()
       "Free memory limit that will be kept by batch cache background reclaimer",
       {.visibility = visibility::tunable},
       64_MiB)
+  , batch_cache_eviction_policy(
+      *this,
+      "batch_cache_eviction_policy",
+      "Policy used to select batch cache ranges to release when memory is "
+      "reclaimed. `lru` releases the least recently used ranges first. "
+      "`s3_fifo` admits new ranges to a small probationary queue so that data "
+      "read only once (e.g. a consumer catching up from the start of a topic) "
+      "is released before frequently read data.",
+      {.needs_restart = needs_restart::yes,
+       .example = "s3_fifo",
+       .visibility = visibility::tunable},
+      model::batch_cache_eviction_policy::lru,
+      {model::batch_cache_eviction_policy::lru,
+       model::batch_cache_eviction_policy::s3_fifo})
   , auto_create_topics_enabled(
       *this,
       "auto_create_topics_enabled",
@@ -1041,6 +1329,16 @@ configuration::configuration()
       "Key-value store flush interval (ms)",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       std::chrono::milliseconds(10))
+  , kvstore_flush_bytes(
+      *this,
+      "kvstore_flush_bytes",
+      "Key-value store pending bytes that trigger a flush before "
+      "`kvstore_flush_interval` has elapsed. A value of 0 flushes on the "
+      "interval only.",
+      {.needs_restart = needs_restart::no,
+       .example = "1048576",
+       .visibility = visibility::tunable},
+      512_KiB)
   , kvstore_max_segment_size(
       *this,
       "kvstore_max_segment_size",
@@ -1053,6 +1351,32 @@ configuration::configuration()
       "Fail-safe maximum throttle delay on kafka requests",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       30'000ms)
+  , kafka_connection_out_of_order_requests(
+      *this,
+      "kafka_connection_out_of_order_requests",
+      "Maximum number of Fetch, ListOffsets, OffsetFetch and Metadata requests "
+      "of a connection that are handled concurrently with the requests "
+      "following them, rather than blocking the connection until they "
+      "complete. Responses are still sent in request order. Applies to new "
+      "connections; 0 disables out of order handling.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0)
+  , kafka_request_tracing_enabled(
+      *this,
+      "kafka_request_tracing_enabled",
+      "Trace the stages of every Kafka request: quota throttling, queueing, "
+      "handling, replication and the response write. The stages feed "
+      "per-stage latency histograms and the slowest requests can be "
+      "inspected through the admin API.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
+  , kafka_request_tracing_slow_threshold_ms(
+      *this,
+      "kafka_request_tracing_slow_threshold_ms",
+      "Traced Kafka requests taking longer than this are kept, per shard, "
+      "for inspection through the admin API.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      500ms)
   , kafka_max_bytes_per_fetch(
       *this,
       "kafka_max_bytes_per_fetch",
@@ -1060,6 +1384,27 @@ configuration::configuration()
       "bytes limits is higher",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       64_MiB)
+  , kafka_fetch_response_cache_bytes(
+      *this,
+      "kafka_fetch_response_cache_bytes",
+      "Size of the per-shard cache of encoded fetch response data. Fetches "
+      "for the same range of a partition, e.g. from many consumer groups "
+      "tailing it, share the cached data instead of each reading and "
+      "encoding it. A value of 0 disables the cache.",
+      {.needs_restart = needs_restart::no,
+       .example = "33554432",
+       .visibility = visibility::tunable},
+      0)
+  , kafka_metadata_response_cache_enabled(
+      *this,
+      "kafka_metadata_response_cache_enabled",
+      "Keep the encoded responses to metadata requests for all topics in a "
+      "per-shard cache. Later requests share the cached response for as long "
+      "as the topics, their leaders and the brokers in the cluster stay the "
+      "same. Only requests that are not subject to authorization are served "
+      "from the cache.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
   , raft_io_timeout_ms(
       *this,
       "raft_io_timeout_ms",
@@ -1128,6 +1473,29 @@ configuration::configuration()
        .example = "1",
        .visibility = visibility::tunable},
       10)
+  , storage_read_readahead_max_count(
+      *this,
+      "storage_read_readahead_max_count",
+      "Maximum number of reads a log reader may issue ahead of its position "
+      "when read-ahead adapts to its access pattern. The read-ahead of a "
+      "reader grows towards this limit while it reads sequentially and "
+      "shrinks when read-ahead data goes unused. A value of 0 disables "
+      "adaptive read-ahead, and readers always issue "
+      "`storage_read_readahead_count` reads ahead.",
+      {.needs_restart = needs_restart::no,
+       .example = "32",
+       .visibility = visibility::tunable},
+      0)
+  , storage_read_readahead_memory(
+      *this,
+      "storage_read_readahead_memory",
+      "Per shard memory that log readers with adaptive read-ahead may reserve "
+      "for read buffers. A reader that can't reserve memory for its maximum "
+      "read-ahead falls back to `storage_read_readahead_count`.",
+      {.needs_restart = needs_restart::no,
+       .example = "67108864",
+       .visibility = visibility::tunable},
+      64_MiB)
   , segment_fallocation_step(
       *this,
       "segment_fallocation_step",
@@ -1137,6 +1505,58 @@ configuration::configuration()
        .visibility = visibility::tunable},
       32_MiB,
       storage::segment_appender::validate_fallocation_step)
+  , storage_segment_recycle_bytes(
+      *this,
+      "storage_segment_recycle_bytes",
+      "Per-shard limit on the size of retired segment files kept for reuse by "
+      "new segments instead of being removed. Reused files keep their disk "
+      "extents, so rolling a segment does not allocate new space. Zero "
+      "disables recycling. Requires a filesystem that supports zeroing a "
+      "range in place (XFS, ext4).",
+      {.needs_restart = needs_restart::no,
+       .example = "1073741824",
+       .visibility = visibility::tunable},
+      0)
+  , segment_deletion_bytes_per_sec(
+      *this,
+      "segment_deletion_bytes_per_sec",
+      "Per-shard rate at which removed segment files are released to the "
+      "filesystem in the background. Large files are truncated in steps of "
+      "segment_deletion_truncate_step before being unlinked, so that freeing "
+      "their extents does not stall other I/O. Zero deletes files inline.",
+      {.needs_restart = needs_restart::no,
+       .example = "268435456",
+       .visibility = visibility::tunable},
+      0)
+  , segment_deletion_truncate_step(
+      *this,
+      "segment_deletion_truncate_step",
+      "Step by which large segment files are truncated before being unlinked "
+      "when segment_deletion_bytes_per_sec is set. Smaller files are unlinked "
+      "inline.",
+      {.needs_restart = needs_restart::no,
+       .example = "67108864",
+       .visibility = visibility::tunable},
+      64_MiB)
+  , storage_hot_tier_bytes(
+      *this,
+      "storage_hot_tier_bytes",
+      "When `cold_data_directory` is set, bytes of the newest data of each "
+      "partition kept in the data directory. Older sealed segments are moved "
+      "to the cold directory in the background. Compacted topics are not "
+      "moved.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::user},
+      1_GiB)
+  , storage_latency_sample_interval(
+      *this,
+      "storage_latency_sample_interval",
+      "One in this many appends, flushes and disk reads of each partition is "
+      "timed for the storage latency histograms. Zero disables the "
+      "histograms.",
+      {.needs_restart = needs_restart::yes,
+       .example = "64",
+       .visibility = visibility::tunable},
+      16)
   , storage_target_replay_bytes(
       *this,
       "storage_target_replay_bytes",
@@ -1157,6 +1577,17 @@ configuration::configuration()
        .visibility = visibility::tunable},
       1024,
       {.min = 128})
+  , storage_max_concurrent_replay_bytes(
+      *this,
+      "storage_max_concurrent_replay_bytes",
+      "Maximum number of bytes of segment data that each shard checksums "
+      "concurrently while recovering logs at startup. Segments of a partition "
+      "that need recovery are replayed in parallel within this budget.",
+      {.needs_restart = needs_restart::no,
+       .example = "536870912",
+       .visibility = visibility::tunable},
+      256_MiB,
+      {.min = 1_MiB})
   , storage_compaction_index_memory(
       *this,
       "storage_compaction_index_memory",
@@ -1167,6 +1598,14 @@ configuration::configuration()
        .visibility = visibility::tunable},
       128_MiB,
       {.min = 16_MiB, .max = 100_GiB})
+  , storage_decompression_cache_size(
+      *this,
+      "storage_decompression_cache_size",
+      "Memory per shard for the most recently decompressed batches, shared by "
+      "schema id validation, the compaction index and data transforms so a "
+      "produced batch is decompressed once. 0 disables the cache.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0)
   , storage_compaction_key_map_memory(
       *this,
       "storage_compaction_key_map_memory",
@@ -1191,6 +1630,25 @@ configuration::configuration()
        .visibility = visibility::tunable},
       12.0,
       {.min = 1.0, .max = 100.0})
+  , storage_compression_offload_bytes(
+      *this,
+      "storage_compression_offload_bytes",
+      "Batches of at least this many bytes are compressed and decompressed "
+      "by storage, e.g. during compaction, on a worker thread instead of the "
+      "reactor, so that they do not stall it. An empty value keeps all of "
+      "them on the reactor.",
+      {.needs_restart = needs_restart::no,
+       .example = "1048576",
+       .visibility = visibility::tunable},
+      1_MiB)
+  , storage_compression_offload_max_in_flight(
+      *this,
+      "storage_compression_offload_max_in_flight",
+      "Maximum number of batches of the node (de)compressed on the worker "
+      "thread at once, the others wait for their turn.",
+      {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
+      4,
+      {.min = 1, .max = 128})
   , max_compacted_log_segment_size(
       *this,
       "max_compacted_log_segment_size",
@@ -1231,6 +1689,74 @@ configuration::configuration()
        .visibility = visibility::tunable},
       2,
       {.min = 1})
+  , storage_disk_usage_cache_ms(
+      *this,
+      "storage_disk_usage_cache_ms",
+      "How long the disk usage report of a partition is reused while the "
+      "size and segments of its log are unchanged. Reports of unchanged logs "
+      "are otherwise recomputed by visiting each of their segments.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      5s)
+  , storage_page_cache_enabled(
+      *this,
+      "storage_page_cache_enabled",
+      "Experimental: serve segment reads from a per-shard page cache. "
+      "Recently appended data is kept resident, and misses are read through a "
+      "shared I/O scheduler that bounds the number of open segment files.",
+      {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
+      false)
+  , storage_page_cache_size(
+      *this,
+      "storage_page_cache_size",
+      "Per-shard capacity in bytes of the page cache used when "
+      "`storage_page_cache_enabled` is true.",
+      {.needs_restart = needs_restart::yes,
+       .example = "268435456",
+       .visibility = visibility::tunable},
+      128_MiB,
+      {.min = 1_MiB, .max = 100_GiB})
+  , storage_page_cache_max_open_files(
+      *this,
+      "storage_page_cache_max_open_files",
+      "Per-shard limit on the number of segment files held open by the page "
+      "cache I/O scheduler when `storage_page_cache_enabled` is true.",
+      {.needs_restart = needs_restart::yes,
+       .example = "1000",
+       .visibility = visibility::tunable},
+      1000,
+      {.min = 1})
+  , storage_packed_index_enabled(
+      *this,
+      "storage_packed_index_enabled",
+      "Keep the in-memory offset index of closed segments in a compact "
+      "delta-FOR encoding. This reduces memory use at high segment counts at "
+      "the cost of decoding a block of index entries on each lookup.",
+      {.needs_restart = needs_restart::no,
+       .example = "true",
+       .visibility = visibility::tunable},
+      false)
+  , storage_reader_handle_cache_size(
+      *this,
+      "storage_reader_handle_cache_size",
+      "Per-shard limit on the number of idle segment file handles kept open "
+      "for reuse by later reads. Segment files are opened on demand, and the "
+      "least recently used idle handles are closed once the limit is "
+      "exceeded. A value of 0 closes handles as soon as they are idle.",
+      {.needs_restart = needs_restart::no,
+       .example = "1000",
+       .visibility = visibility::tunable},
+      1000)
+  , storage_flush_coalesce_window_ms(
+      *this,
+      "storage_flush_coalesce_window_ms",
+      "Time for which a shard collects log flush requests before issuing them "
+      "together. Flushes of the same segment requested within the window are "
+      "served by a single fsync. A value of 0 flushes each request as it "
+      "arrives.",
+      {.needs_restart = needs_restart::no,
+       .example = "1",
+       .visibility = visibility::tunable},
+      0ms)
   , tx_registry_log_capacity(*this, "tx_registry_log_capacity")
   , id_allocator_log_capacity(
       *this,
@@ -1247,6 +1773,16 @@ configuration::configuration()
       "touching the log until the batch is exhausted.",
       {.visibility = visibility::tunable},
       1000)
+  , id_allocator_shard_lease_size(
+      *this,
+      "id_allocator_shard_lease_size",
+      "Number of producer ids each shard leases from the id allocator in "
+      "advance, so that most id allocations are served without leaving the "
+      "shard. The lease is refilled in the background once a quarter of it "
+      "is left. 0 allocates every id through the id allocator.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      100,
+      {.min = 0})
   , enable_sasl(
       *this,
       "enable_sasl",
@@ -1330,6 +1866,16 @@ configuration::configuration()
       "Interval between iterations of controller backend housekeeping loop",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       1s)
+  , controller_backend_reconciliation_concurrency(
+      *this,
+      "controller_backend_reconciliation_concurrency",
+      "Maximum number of partitions that the controller backend of a shard "
+      "reconciles at the same time. Partitions that clients are waiting for "
+      "(leaderless, led by this node, or gaining a replica on this node) are "
+      "reconciled first.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      1024,
+      {.min = 1})
   , node_management_operation_timeout_ms(
       *this,
       "node_management_operation_timeout_ms",
@@ -1349,6 +1895,39 @@ configuration::configuration()
       "limit applies to compressed batch size",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       1_MiB)
+  , kafka_produce_batch_passthrough(
+      *this,
+      "kafka_produce_batch_passthrough",
+      "Accept produced record batches after validating their header, CRC and "
+      "record count, without parsing each record, and share their buffers "
+      "with the partition's shard rather than copying them",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
+  , kafka_recompress_uncompressed_batches(
+      *this,
+      "kafka_recompress_uncompressed_batches",
+      "Compress on the leader the uncompressed batches produced to the topics "
+      "whose `compression.type` is a codec rather than `producer`, before "
+      "they are replicated and stored",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
+  , kafka_recompression_cpu_budget_percent(
+      *this,
+      "kafka_recompression_cpu_budget_percent",
+      "Share of the time of a shard that it may spend compressing produced "
+      "batches, see `kafka_recompress_uncompressed_batches`. Once it is spent "
+      "the batches are stored as produced until the next second",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      10,
+      {.min = 1, .max = 100})
+  , kafka_compression_advisor_interval_ms(
+      *this,
+      "kafka_compression_advisor_interval_ms",
+      "How often the compression codecs are measured on samples of the "
+      "batches produced to each topic, to recommend a compression.type "
+      "through the admin API. The advisor is disabled if null.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      std::nullopt)
   , kafka_nodelete_topics(
       *this,
       "kafka_nodelete_topics",
@@ -1707,6 +2286,73 @@ configuration::configuration()
       "Log segment upload timeout (ms)",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       30s)
+  , cloud_storage_multipart_upload_part_size(
+      *this,
+      "cloud_storage_multipart_upload_part_size",
+      "Size of the parts of multipart segment uploads. Segments larger than a "
+      "part are uploaded as parts sent in parallel, each retried on its own. "
+      "The parts being sent are buffered in memory. S3 requires parts of at "
+      "least 5 MiB. 0 uploads every segment with a single request.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0,
+      {.min = 0, .max = 5_GiB})
+  , cloud_storage_multipart_upload_parallelism(
+      *this,
+      "cloud_storage_multipart_upload_parallelism",
+      "Maximum number of parts of a multipart segment upload sent at once.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      4,
+      {.min = 1, .max = 64})
+  , cloud_storage_upload_from_batch_cache(
+      *this,
+      "cloud_storage_upload_from_batch_cache",
+      "Upload segments from the batch cache when all of their batches are "
+      "still cached, instead of reading them back from disk.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      true)
+  , cloud_storage_segment_packing_max_bytes(
+      *this,
+      "cloud_storage_segment_packing_max_bytes",
+      "Segments smaller than this are uploaded packed together with the "
+      "small segments of other partitions of the shard into a shared object, "
+      "which readers fetch the segment from by byte range. This cuts the "
+      "number of PUT requests of partitions with low throughput. 0 disables "
+      "packing.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0)
+  , cloud_storage_segment_packing_object_size(
+      *this,
+      "cloud_storage_segment_packing_object_size",
+      "Size at which an object of packed segments is uploaded.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      64_MiB,
+      {.min = 1_MiB, .max = 5_GiB})
+  , cloud_storage_segment_packing_delay_ms(
+      *this,
+      "cloud_storage_segment_packing_delay_ms",
+      "Longest time a segment waits for other segments to be packed with "
+      "before its object is uploaded.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      1s)
+  , cloud_storage_hedged_read_percentile(
+      *this,
+      "cloud_storage_hedged_read_percentile",
+      "Percentile of the time to first byte of object storage GET requests "
+      "after which a duplicate request is issued and the first response is "
+      "used. Zero disables hedging.",
+      {.needs_restart = needs_restart::no,
+       .example = "99.0",
+       .visibility = visibility::tunable},
+      0.0,
+      {.min = 0.0, .max = 100.0})
+  , cloud_storage_hedged_read_budget_ratio(
+      *this,
+      "cloud_storage_hedged_read_budget_ratio",
+      "Largest number of hedged GET requests as a fraction of the GET "
+      "requests sent to object storage.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0.05,
+      {.min = 0.0, .max = 1.0})
   , cloud_storage_manifest_upload_timeout_ms(
       *this,
       "cloud_storage_manifest_upload_timeout_ms",
@@ -1725,6 +2371,15 @@ configuration::configuration()
       "Max https connection idle time (ms)",
       {.visibility = visibility::tunable},
       5s)
+  , cloud_storage_client_pool_warm_connections(
+      *this,
+      "cloud_storage_client_pool_warm_connections",
+      "Number of idle connections to cloud storage which every shard keeps "
+      "open. Such connections are reopened before they reach "
+      "cloud_storage_max_connection_idle_time_ms, so that requests sent "
+      "after a period of inactivity don't have to wait for new connections",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0)
   , cloud_storage_segment_max_upload_interval_sec(
       *this,
       "cloud_storage_segment_max_upload_interval_sec",
@@ -1832,6 +2487,22 @@ configuration::configuration()
       "performance",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       true)
+  , cloud_storage_segment_merging_server_side(
+      *this,
+      "cloud_storage_segment_merging_server_side",
+      "Merge adjacent segments with server-side copies of their objects, "
+      "even if the segments are still in the local log. Otherwise such "
+      "segments are read locally and uploaded again",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
+  , cloud_storage_upload_segment_index_v2(
+      *this,
+      "cloud_storage_upload_segment_index_v2",
+      "Upload the indexes of the segments in the block-structured v2 format "
+      "which can be read one block at a time. Versions which don't support "
+      "the format can't use the uploaded indexes",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
   , cloud_storage_enable_scrubbing(
       *this,
       "cloud_storage_enable_scrubbing",
@@ -1857,6 +2528,14 @@ configuration::configuration()
       "Jitter applied to the cloud storage scrubbing interval.",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       10min)
+  , cloud_storage_scrubbing_max_requests_per_sec(
+      *this,
+      "cloud_storage_scrubbing_max_requests_per_sec",
+      "Maximum number of requests per second sent to cloud storage by the "
+      "scrubbers of all partitions of a shard",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      20,
+      {.min = 1})
   , cloud_storage_disable_upload_loop_for_tests(
       *this,
       "cloud_storage_disable_upload_loop_for_tests",
@@ -1907,6 +2586,15 @@ configuration::configuration()
       "Retention in bytes for topics created during automated recovery",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       1_GiB)
+  , cloud_storage_recovery_download_concurrency(
+      *this,
+      "cloud_storage_recovery_download_concurrency",
+      "Maximum number of objects downloaded at once by the partitions of a "
+      "shard being recovered from cloud storage, and of topic manifests "
+      "fetched at once by the topic recovery",
+      {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
+      8,
+      {.min = 1})
   , cloud_storage_segment_size_target(
       *this,
       "cloud_storage_segment_size_target",
@@ -2313,6 +3001,34 @@ configuration::configuration()
       "elapsed",
       {.visibility = visibility::tunable},
       5s)
+  , cloud_storage_cache_walk_interval_ms(
+      *this,
+      "cloud_storage_cache_walk_interval",
+      "Minimum time between full walks of the tiered storage cache directory "
+      "by trims. In between, trims evict the least recently accessed files of "
+      "an in-memory index of the cache, and the walk reconciles the index "
+      "with the content of the directory. 0 walks the directory on every "
+      "trim.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      1h)
+  , cloud_storage_hot_tier_max_bytes(
+      *this,
+      "cloud_storage_hot_tier_max_bytes",
+      "Maximum memory per shard of the in-memory tier above the tiered "
+      "storage cache. Chunks and segment indexes read repeatedly are kept in "
+      "memory and served without file I/O. The memory is taken from the "
+      "tiered storage memory of the shard. 0 disables the tier.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0)
+  , cloud_storage_decoded_batch_cache_max_bytes(
+      *this,
+      "cloud_storage_decoded_batch_cache_max_bytes",
+      "Maximum memory per remote segment of the batches its readers parsed. "
+      "Readers starting at offsets other readers of the segment already "
+      "parsed are served from memory instead of parsing the segment again. "
+      "0 disables the cache.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0)
   , cloud_storage_max_segment_readers_per_shard(
       *this,
       "cloud_storage_max_segment_readers_per_shard",
@@ -2406,6 +3122,25 @@ configuration::configuration()
       "Number of chunks to prefetch ahead of every downloaded chunk",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       0)
+  , cloud_storage_chunk_hydration_parallelism(
+      *this,
+      "cloud_storage_chunk_hydration_parallelism",
+      "Number of ranged GETs a downloaded chunk and its prefetched chunks "
+      "are split into and downloaded with concurrently. A single GET is "
+      "capped at the throughput of one HTTP stream, splitting a prefetch "
+      "lets it download at several times that rate.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      1)
+  , cloud_storage_chunk_prefetch_max(
+      *this,
+      "cloud_storage_chunk_prefetch_max",
+      "Maximum number of chunks prefetched ahead of a reader consuming a "
+      "segment sequentially. The prefetch depth follows the ratio of the "
+      "download latency of a chunk to the time the reader takes to consume "
+      "one, and the index of the next segment is hydrated once the reader "
+      "moves on to a new segment. 0 disables the sequential prefetch.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0)
   , superusers(
       *this,
       "superusers",
@@ -2554,6 +3289,30 @@ configuration::configuration()
       "default this value is calculated automaticaly",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       std::nullopt)
+  , core_balancing_on_load(
+      *this,
+      "core_balancing_on_load",
+      "If true, Redpanda moves partitions between the cores of a node by their "
+      "produce and fetch throughput, instead of keeping the cores assigned by "
+      "the controller",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
+  , core_balancing_on_load_interval_ms(
+      *this,
+      "core_balancing_on_load_interval_ms",
+      "Interval at which the load of the cores of a node is measured and "
+      "rebalanced when core_balancing_on_load is enabled",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      1min)
+  , core_balancing_on_load_imbalance_percent(
+      *this,
+      "core_balancing_on_load_imbalance_percent",
+      "Partitions are moved between cores of a node only when the load of the "
+      "busiest core exceeds the average load of the cores by more than this "
+      "percentage",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      25,
+      {.min = 1, .max = 1000})
   , enable_leader_balancer(
       *this,
       "enable_leader_balancer",
@@ -2572,6 +3331,7 @@ configuration::configuration()
       {
         model::leader_balancer_mode::greedy_balanced_shards,
         model::leader_balancer_mode::random_hill_climbing,
+        model::leader_balancer_mode::heap_balanced_shards,
       })
   , leader_balancer_idle_timeout(
       *this,
@@ -2674,6 +3434,17 @@ configuration::configuration()
        .needs_restart = needs_restart::no,
        .visibility = visibility::tunable},
       true)
+  , sampled_memory_profile_rate(
+      *this,
+      "memory_sampling_rate_bytes",
+      "When `memory_enable_memory_sampling` is true, allocations are sampled "
+      "on average once every this many bytes allocated. Lower values give "
+      "more precise profiles at a higher CPU and memory overhead.",
+      {.needs_restart = needs_restart::no,
+       .example = "1000003",
+       .visibility = visibility::tunable},
+      3000037,
+      {.min = 4096})
   , enable_metrics_reporter(
       *this,
       "enable_metrics_reporter",
@@ -2711,6 +3482,16 @@ configuration::configuration()
       "Enables rack-aware replica assignment",
       {.needs_restart = needs_restart::no, .visibility = visibility::user},
       false)
+  , follower_fetch_max_lag_offsets(
+      *this,
+      "follower_fetch_max_lag_offsets",
+      "When set, consumers are steered to the replica in their rack that "
+      "lags its leader by at most this many offsets and answered its leader "
+      "most recently, and fetch from the leader when every replica in their "
+      "rack lags further behind. When unset, any replica in the rack of the "
+      "consumer that has the fetched offset is picked.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      std::nullopt)
   , node_status_interval(
       *this,
       "node_status_interval",
@@ -2871,6 +3652,15 @@ configuration::configuration()
       "and node-wide throughput limit control",
       {.needs_restart = needs_restart::no, .visibility = visibility::user},
       {"produce", "fetch"})
+  , kafka_produce_admission_control(
+      *this,
+      "kafka_produce_admission_control",
+      "When a produce request crosses a throughput quota while the broker is "
+      "short of request memory, enforce its throttle delay before its body "
+      "is read rather than requesting it from the client, so that the "
+      "broker doesn't queue for memory and parse data it throttles anyway.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
   , kafka_throughput_control(
       *this,
       "kafka_throughput_control",
@@ -2932,6 +3722,21 @@ configuration::configuration()
       "Per-shard capacity of the cache for validating schema IDs.",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       128)
+  , kafka_schema_id_validation_negative_cache_ttl_ms(
+      *this,
+      "kafka_schema_id_validation_negative_cache_ttl_ms",
+      "How long a schema ID that failed server-side validation is rejected "
+      "without syncing the schema registry again. Zero disables it.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      1s)
+  , schema_registry_read_replica_capacity(
+      *this,
+      "schema_registry_read_replica_capacity",
+      "Per-shard capacity of the schema registry caches of schemas by ID and "
+      "of subject versions, that save a cross-shard lookup. Zero disables "
+      "them.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      1000)
   , pp_sr_smp_max_non_local_requests(
       *this,
       "pp_sr_smp_max_non_local_requests",
@@ -2988,6 +3793,22 @@ configuration::configuration()
       {.needs_restart = needs_restart::no, .visibility = visibility::user},
       100ms,
       {.min = 1ms})
+  , reactor_stall_attribution_enabled(
+      *this,
+      "reactor_stall_attribution_enabled",
+      "Takes over the reports of the reactor stall detector to count the "
+      "stalls and histogram their duration per scheduling group. The stalls "
+      "are still logged, with the scheduling group they happened in",
+      {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
+      false)
+  , lock_contention_tracking_enabled(
+      *this,
+      "lock_contention_tracking_enabled",
+      "Enables the tracking of the time spent waiting for and holding the "
+      "locks that are instrumented with a lock class, exported as metrics per "
+      "lock class",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
   , oidc_discovery_url(
       *this,
       "oidc_discovery_url",
@@ -3054,8 +3875,15 @@ configuration::error_map_t configuration::load(const YAML::Node& root_node) {
     return config_store::read_yaml(root_node["redpanda"], std::move(ignore));
 }
 
+namespace {
+struct shard_local_state {
+    configuration cfg;
+    hot_path_watcher hot_path{cfg};
+};
+} // namespace
+
 configuration& shard_local_cfg() {
-    static thread_local configuration cfg;
-    return cfg;
+    static thread_local shard_local_state state;
+    return state.cfg;
 }
 } // namespace config
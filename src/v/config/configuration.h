@@ -62,7 +62,13 @@ struct configuration final : public config_store {
     bounded_property<std::optional<int>> rpc_server_tcp_recv_buf;
     bounded_property<std::optional<int>> rpc_server_tcp_send_buf;
     bounded_property<int> rpc_client_connections_per_peer;
+    property<bool> rpc_client_traffic_class_connections;
+    bounded_property<uint32_t> rpc_write_coalescing_max_delay_us;
     property<bool> rpc_server_compress_replies;
+    property<std::optional<size_t>> rpc_controller_compression_bytes;
+    property<std::optional<size_t>> rpc_data_transforms_compression_bytes;
+    property<std::chrono::milliseconds> dns_cache_ttl_ms;
+    property<std::chrono::milliseconds> dns_cache_negative_ttl_ms;
     // Coproc
     deprecated_property enable_coproc;
     deprecated_property coproc_max_inflight_bytes;
@@ -76,6 +82,11 @@ struct configuration final : public config_store {
     bounded_property<size_t> data_transforms_per_core_memory_reservation;
     bounded_property<size_t> data_transforms_per_function_memory_limit;
     property<std::chrono::milliseconds> data_transforms_runtime_limit_ms;
+    property<bool> data_transforms_standby_engines;
+    property<bool> data_transforms_huge_page_memory;
+    property<bool> data_transforms_compilation_cache_enabled;
+    bounded_property<size_t> data_transforms_parallel_engines;
+    bounded_property<size_t> data_transforms_per_core_buffer_memory;
     bounded_property<size_t> data_transforms_binary_max_size;
     bounded_property<size_t> data_transforms_logging_buffer_capacity_bytes;
     property<std::chrono::milliseconds>
@@ -103,6 +114,8 @@ struct configuration final : public config_store {
     bounded_property<std::optional<size_t>> raft_max_recovery_memory;
     bounded_property<size_t> raft_recovery_default_read_size;
     property<bool> raft_enable_lw_heartbeat;
+    property<bool> raft_enable_leader_lease;
+    property<bool> raft_enable_follower_catchup_from_cloud;
     bounded_property<size_t> raft_recovery_concurrency_per_shard;
     property<std::optional<size_t>> raft_replica_max_pending_flush_bytes;
     property<std::chrono::milliseconds> raft_flush_timer_interval_ms;
@@ -117,6 +130,8 @@ struct configuration final : public config_store {
     bounded_property<int16_t> default_num_windows;
     bounded_property<std::chrono::milliseconds> default_window_sec;
     property<std::chrono::milliseconds> quota_manager_gc_sec;
+    property<std::optional<std::chrono::milliseconds>>
+      kafka_client_quota_exchange_period;
     bounded_property<uint32_t> target_quota_byte_rate;
     property<std::optional<uint32_t>> target_fetch_quota_byte_rate;
     bounded_property<std::optional<uint32_t>> kafka_admin_topic_api_rate;
@@ -130,7 +145,10 @@ struct configuration final : public config_store {
     property<std::chrono::milliseconds> group_new_member_join_timeout;
     property<std::optional<std::chrono::seconds>> group_offset_retention_sec;
     property<std::chrono::milliseconds> group_offset_retention_check_ms;
+    property<std::optional<std::chrono::milliseconds>>
+      group_consumer_lag_refresh_ms;
     property<bool> legacy_group_offset_retention_enabled;
+    property<bool> group_coalesce_offset_commits;
     property<std::chrono::milliseconds> metadata_dissemination_interval_ms;
     property<std::chrono::milliseconds> metadata_dissemination_retry_delay_ms;
     property<int16_t> metadata_dissemination_retries;
@@ -144,6 +162,7 @@ struct configuration final : public config_store {
     deprecated_property rm_violation_recovery_policy;
     property<std::chrono::milliseconds> fetch_reads_debounce_timeout;
     enum_property<model::fetch_read_strategy> fetch_read_strategy;
+    property<bool> fetch_coalesce_cross_shard_reads;
     property<std::chrono::milliseconds> alter_topic_cfg_timeout_ms;
     property<model::cleanup_policy_bitflags> log_cleanup_policy;
     enum_property<model::timestamp_type> log_message_timestamp_type;
@@ -163,7 +182,9 @@ struct configuration final : public config_store {
     // same as transactional.id.expiration.ms in kafka
     property<std::chrono::milliseconds> transactional_id_expiration_ms;
     bounded_property<uint64_t> max_concurrent_producer_ids;
+    property<size_t> max_spilled_producer_state_bytes;
     bounded_property<uint64_t> max_transactions_per_coordinator;
+    property<std::optional<size_t>> max_transactions_memory_per_coordinator;
     property<bool> enable_idempotence;
     property<bool> enable_transactions;
     property<uint32_t> abort_index_segment_size;
@@ -172,6 +193,9 @@ struct configuration final : public config_store {
     property<std::chrono::milliseconds> log_compaction_interval_ms;
     property<bool> log_disable_housekeeping_for_tests;
     property<bool> log_compaction_use_sliding_window;
+    bounded_property<double, numeric_bounds> min_cleanable_dirty_ratio;
+    property<bool> log_compaction_use_key_filters;
+    enum_property<model::compaction_key_hash> log_compaction_key_hash;
     // same as retention.size in kafka - TODO: size not implemented
     property<std::optional<size_t>> retention_bytes;
     property<int32_t> group_topic_partitions;
@@ -197,10 +221,16 @@ struct configuration final : public config_store {
     property<std::chrono::milliseconds> replicate_append_timeout_ms;
     property<std::chrono::milliseconds> recovery_append_timeout_ms;
     property<size_t> raft_replicate_batch_window_size;
+    property<std::optional<std::chrono::milliseconds>>
+      raft_replicate_batch_latency_target;
     property<size_t> raft_learner_recovery_rate;
     property<bool> raft_recovery_throttle_disable_dynamic_mode;
     property<std::optional<uint32_t>> raft_smp_max_non_local_requests;
     property<uint32_t> raft_max_concurrent_append_requests_per_follower;
+    property<std::optional<size_t>> raft_max_inflight_append_bytes_per_follower;
+    property<std::optional<size_t>> raft_append_entries_compression_bytes;
+    property<bool> raft_enable_independent_stm_apply;
+    property<bool> raft_coalesce_follower_flushes;
     enum_property<model::write_caching_mode> write_caching;
 
     property<size_t> reclaim_min_size;
@@ -208,12 +238,20 @@ struct configuration final : public config_store {
     property<std::chrono::milliseconds> reclaim_growth_window;
     property<std::chrono::milliseconds> reclaim_stable_window;
     property<size_t> reclaim_batch_cache_min_free;
+    enum_property<model::batch_cache_eviction_policy>
+      batch_cache_eviction_policy;
     property<bool> auto_create_topics_enabled;
     property<bool> enable_pid_file;
     property<std::chrono::milliseconds> kvstore_flush_interval;
+    property<size_t> kvstore_flush_bytes;
     property<size_t> kvstore_max_segment_size;
     property<std::chrono::milliseconds> max_kafka_throttle_delay_ms;
+    property<uint32_t> kafka_connection_out_of_order_requests;
+    property<bool> kafka_request_tracing_enabled;
+    property<std::chrono::milliseconds> kafka_request_tracing_slow_threshold_ms;
     property<size_t> kafka_max_bytes_per_fetch;
+    property<size_t> kafka_fetch_response_cache_bytes;
+    property<bool> kafka_metadata_response_cache_enabled;
     property<std::chrono::milliseconds> raft_io_timeout_ms;
     property<std::chrono::milliseconds> join_retry_timeout_ms;
     property<std::chrono::milliseconds> raft_timeout_now_timeout_ms;
@@ -225,22 +263,41 @@ struct configuration final : public config_store {
     bounded_property<size_t> append_chunk_size;
     property<size_t> storage_read_buffer_size;
     property<int16_t> storage_read_readahead_count;
+    property<int16_t> storage_read_readahead_max_count;
+    property<size_t> storage_read_readahead_memory;
     property<size_t> segment_fallocation_step;
+    property<size_t> storage_segment_recycle_bytes;
+    property<size_t> segment_deletion_bytes_per_sec;
+    property<size_t> segment_deletion_truncate_step;
+    property<size_t> storage_hot_tier_bytes;
+    property<uint32_t> storage_latency_sample_interval;
     bounded_property<uint64_t> storage_target_replay_bytes;
     bounded_property<uint64_t> storage_max_concurrent_replay;
+    bounded_property<size_t> storage_max_concurrent_replay_bytes;
     bounded_property<uint64_t> storage_compaction_index_memory;
+    property<size_t> storage_decompression_cache_size;
     bounded_property<uint64_t> storage_compaction_key_map_memory;
     bounded_property<double, numeric_bounds>
       storage_compaction_key_map_memory_limit_percent;
+    property<std::optional<size_t>> storage_compression_offload_bytes;
+    bounded_property<size_t> storage_compression_offload_max_in_flight;
     property<size_t> max_compacted_log_segment_size;
     property<std::optional<std::chrono::seconds>>
       storage_ignore_timestamps_in_future_sec;
     property<bool> storage_ignore_cstore_hints;
     bounded_property<int16_t> storage_reserve_min_segments;
+    property<std::chrono::milliseconds> storage_disk_usage_cache_ms;
+    property<bool> storage_page_cache_enabled;
+    bounded_property<size_t> storage_page_cache_size;
+    bounded_property<size_t> storage_page_cache_max_open_files;
+    property<bool> storage_packed_index_enabled;
+    property<size_t> storage_reader_handle_cache_size;
+    property<std::chrono::milliseconds> storage_flush_coalesce_window_ms;
 
     deprecated_property tx_registry_log_capacity;
     property<int16_t> id_allocator_log_capacity;
     property<int16_t> id_allocator_batch_size;
+    bounded_property<int16_t> id_allocator_shard_lease_size;
     property<bool> enable_sasl;
     property<std::vector<ss::sstring>> sasl_mechanisms;
     property<ss::sstring> sasl_kerberos_config;
@@ -255,9 +312,15 @@ struct configuration final : public config_store {
     property<bool> kafka_enable_partition_reassignment;
     property<std::chrono::milliseconds>
       controller_backend_housekeeping_interval_ms;
+    bounded_property<size_t> controller_backend_reconciliation_concurrency;
     property<std::chrono::milliseconds> node_management_operation_timeout_ms;
     property<uint32_t> kafka_request_max_bytes;
     property<uint32_t> kafka_batch_max_bytes;
+    property<bool> kafka_produce_batch_passthrough;
+    property<bool> kafka_recompress_uncompressed_batches;
+    bounded_property<uint32_t> kafka_recompression_cpu_budget_percent;
+    property<std::optional<std::chrono::milliseconds>>
+      kafka_compression_advisor_interval_ms;
     property<std::vector<ss::sstring>> kafka_nodelete_topics;
     property<std::vector<ss::sstring>> kafka_noproduce_topics;
 
@@ -317,12 +380,23 @@ struct configuration final : public config_store {
     property<std::optional<ss::sstring>> cloud_storage_trust_file;
     property<std::chrono::milliseconds> cloud_storage_initial_backoff_ms;
     property<std::chrono::milliseconds> cloud_storage_segment_upload_timeout_ms;
+    bounded_property<size_t> cloud_storage_multipart_upload_part_size;
+    bounded_property<uint16_t> cloud_storage_multipart_upload_parallelism;
+    property<bool> cloud_storage_upload_from_batch_cache;
+    property<size_t> cloud_storage_segment_packing_max_bytes;
+    bounded_property<size_t> cloud_storage_segment_packing_object_size;
+    property<std::chrono::milliseconds> cloud_storage_segment_packing_delay_ms;
+    bounded_property<double, numeric_bounds>
+      cloud_storage_hedged_read_percentile;
+    bounded_property<double, numeric_bounds>
+      cloud_storage_hedged_read_budget_ratio;
     property<std::chrono::milliseconds>
       cloud_storage_manifest_upload_timeout_ms;
     property<std::chrono::milliseconds>
       cloud_storage_garbage_collect_timeout_ms;
     property<std::chrono::milliseconds>
       cloud_storage_max_connection_idle_time_ms;
+    property<size_t> cloud_storage_client_pool_warm_connections;
     property<std::optional<std::chrono::seconds>>
       cloud_storage_segment_max_upload_interval_sec;
     property<std::optional<std::chrono::seconds>>
@@ -343,11 +417,14 @@ struct configuration final : public config_store {
     property<double> cloud_storage_idle_threshold_rps;
     property<int32_t> cloud_storage_background_jobs_quota;
     property<bool> cloud_storage_enable_segment_merging;
+    property<bool> cloud_storage_segment_merging_server_side;
+    property<bool> cloud_storage_upload_segment_index_v2;
     property<bool> cloud_storage_enable_scrubbing;
     property<std::chrono::milliseconds> cloud_storage_partial_scrub_interval_ms;
     property<std::chrono::milliseconds> cloud_storage_full_scrub_interval_ms;
     property<std::chrono::milliseconds>
       cloud_storage_scrubbing_interval_jitter_ms;
+    bounded_property<size_t> cloud_storage_scrubbing_max_requests_per_sec;
     property<bool> cloud_storage_disable_upload_loop_for_tests;
     property<bool> cloud_storage_disable_read_replica_loop_for_tests;
     property<bool> disable_cluster_recovery_loop_for_tests;
@@ -355,6 +432,7 @@ struct configuration final : public config_store {
     property<size_t> cloud_storage_max_segments_pending_deletion_per_partition;
     property<bool> cloud_storage_enable_compacted_topic_reupload;
     property<size_t> cloud_storage_recovery_temporary_retention_bytes_default;
+    bounded_property<size_t> cloud_storage_recovery_download_concurrency;
     property<std::optional<size_t>> cloud_storage_segment_size_target;
     property<std::optional<size_t>> cloud_storage_segment_size_min;
     property<std::optional<size_t>> cloud_storage_max_throughput_per_shard;
@@ -418,6 +496,9 @@ struct configuration final : public config_store {
       cloud_storage_cache_size_percent;
     property<uint32_t> cloud_storage_cache_max_objects;
     property<std::chrono::milliseconds> cloud_storage_cache_check_interval_ms;
+    property<std::chrono::milliseconds> cloud_storage_cache_walk_interval_ms;
+    property<size_t> cloud_storage_hot_tier_max_bytes;
+    property<size_t> cloud_storage_decoded_batch_cache_max_bytes;
     property<std::optional<uint32_t>>
       cloud_storage_max_segment_readers_per_shard;
     property<std::optional<uint32_t>>
@@ -433,6 +514,8 @@ struct configuration final : public config_store {
     enum_property<model::cloud_storage_chunk_eviction_strategy>
       cloud_storage_chunk_eviction_strategy;
     property<uint16_t> cloud_storage_chunk_prefetch;
+    property<uint16_t> cloud_storage_chunk_hydration_parallelism;
+    property<uint16_t> cloud_storage_chunk_prefetch_max;
 
     one_or_many_property<ss::sstring> superusers;
 
@@ -464,6 +547,9 @@ struct configuration final : public config_store {
     property<size_t> partition_autobalancing_concurrent_moves;
     property<double> partition_autobalancing_tick_moves_drop_threshold;
     property<std::optional<size_t>> partition_autobalancing_min_size_threshold;
+    property<bool> core_balancing_on_load;
+    property<std::chrono::milliseconds> core_balancing_on_load_interval_ms;
+    bounded_property<unsigned> core_balancing_on_load_imbalance_percent;
 
     property<bool> enable_leader_balancer;
     enum_property<model::leader_balancer_mode> leader_balancer_mode;
@@ -485,6 +571,7 @@ struct configuration final : public config_store {
     // memory related settings
     property<bool> memory_abort_on_alloc_failure;
     property<bool> sampled_memory_profile;
+    bounded_property<size_t> sampled_memory_profile_rate;
 
     // metrics reporter
     property<bool> enable_metrics_reporter;
@@ -496,6 +583,7 @@ struct configuration final : public config_store {
 
     // enables rack aware replica assignment
     property<bool> enable_rack_awareness;
+    property<std::optional<int64_t>> follower_fetch_max_lag_offsets;
 
     property<std::chrono::milliseconds> node_status_interval;
     property<std::chrono::milliseconds> node_status_reconnect_max_backoff_ms;
@@ -530,6 +618,7 @@ struct configuration final : public config_store {
     property<double> kafka_quota_balancer_min_shard_throughput_ratio;
     bounded_property<int64_t> kafka_quota_balancer_min_shard_throughput_bps;
     property<std::vector<ss::sstring>> kafka_throughput_controlled_api_keys;
+    property<bool> kafka_produce_admission_control;
     property<std::vector<throughput_control_group>> kafka_throughput_control;
 
     bounded_property<int64_t> node_isolation_heartbeat_timeout;
@@ -543,6 +632,9 @@ struct configuration final : public config_store {
     enum_property<pandaproxy::schema_registry::schema_id_validation_mode>
       enable_schema_id_validation;
     config::property<size_t> kafka_schema_id_validation_cache_capacity;
+    property<std::chrono::milliseconds>
+      kafka_schema_id_validation_negative_cache_ttl_ms;
+    config::property<size_t> schema_registry_read_replica_capacity;
 
     property<std::optional<uint32_t>> pp_sr_smp_max_non_local_requests;
     bounded_property<size_t> max_in_flight_schema_registry_requests_per_shard;
@@ -553,6 +645,8 @@ struct configuration final : public config_store {
     // debug controls
     property<bool> cpu_profiler_enabled;
     bounded_property<std::chrono::milliseconds> cpu_profiler_sample_period_ms;
+    property<bool> reactor_stall_attribution_enabled;
+    property<bool> lock_contention_tracking_enabled;
 
     // oidc authentication
     property<ss::sstring> oidc_discovery_url;
@@ -368,7 +368,8 @@ struct convert<model::leader_balancer_mode> {
 
     static constexpr auto acceptable_values = std::to_array(
       {model::leader_balancer_mode_to_string(type::random_hill_climbing),
-       model::leader_balancer_mode_to_string(type::greedy_balanced_shards)});
+       model::leader_balancer_mode_to_string(type::greedy_balanced_shards),
+       model::leader_balancer_mode_to_string(type::heap_balanced_shards)});
 
     static Node encode(const type& rhs) { return Node(fmt::format("{}", rhs)); }
 
@@ -389,7 +390,11 @@ struct convert<model::leader_balancer_mode> {
                 .match(
                   model::leader_balancer_mode_to_string(
                     type::greedy_balanced_shards),
-                  type::greedy_balanced_shards);
+                  type::greedy_balanced_shards)
+                .match(
+                  model::leader_balancer_mode_to_string(
+                    type::heap_balanced_shards),
+                  type::heap_balanced_shards);
 
         return true;
     }
@@ -440,6 +445,54 @@ struct convert<model::cloud_storage_chunk_eviction_strategy> {
     }
 };
 
+template<>
+struct convert<model::batch_cache_eviction_policy> {
+    using type = model::batch_cache_eviction_policy;
+
+    static constexpr auto acceptable_values = std::to_array({"lru", "s3_fifo"});
+
+    static Node encode(const type& rhs) { return Node(fmt::format("{}", rhs)); }
+
+    static bool decode(const Node& node, type& rhs) {
+        auto value = node.as<std::string>();
+
+        if (
+          std::find(acceptable_values.begin(), acceptable_values.end(), value)
+          == acceptable_values.end()) {
+            return false;
+        }
+
+        rhs = string_switch<type>(std::string_view{value})
+                .match("lru", model::batch_cache_eviction_policy::lru)
+                .match("s3_fifo", model::batch_cache_eviction_policy::s3_fifo);
+        return true;
+    }
+};
+
+template<>
+struct convert<model::compaction_key_hash> {
+    using type = model::compaction_key_hash;
+
+    static constexpr auto acceptable_values = std::to_array({"sha256", "xxh3"});
+
+    static Node encode(const type& rhs) { return Node(fmt::format("{}", rhs)); }
+
+    static bool decode(const Node& node, type& rhs) {
+        auto value = node.as<std::string>();
+
+        if (
+          std::find(acceptable_values.begin(), acceptable_values.end(), value)
+          == acceptable_values.end()) {
+            return false;
+        }
+
+        rhs = string_switch<type>(std::string_view{value})
+                .match("sha256", model::compaction_key_hash::sha256)
+                .match("xxh3", model::compaction_key_hash::xxh3);
+        return true;
+    }
+};
+
 template<>
 struct convert<pandaproxy::schema_registry::subject_name_strategy> {
     using type = pandaproxy::schema_registry::subject_name_strategy;
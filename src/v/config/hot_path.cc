@@ -0,0 +1,66 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "config/hot_path.h"
+
+#include "config/configuration.h"
+
+namespace config {
+
+namespace detail {
+constinit thread_local hot_path_snapshot hot_path{};
+} // namespace detail
+
+hot_path_watcher::hot_path_watcher(configuration& cfg)
+  : _kafka_produce_batch_passthrough(
+    watch(cfg.kafka_produce_batch_passthrough))
+  , _log_message_timestamp_alert_before_ms(
+      watch(cfg.log_message_timestamp_alert_before_ms))
+  , _log_message_timestamp_alert_after_ms(
+      watch(cfg.log_message_timestamp_alert_after_ms))
+  , _fetch_max_bytes(watch(cfg.fetch_max_bytes))
+  , _kafka_max_bytes_per_fetch(watch(cfg.kafka_max_bytes_per_fetch))
+  , _kafka_memory_batch_size_estimate_for_fetch(
+      watch(cfg.kafka_memory_batch_size_estimate_for_fetch))
+  , _fetch_reads_debounce_timeout(watch(cfg.fetch_reads_debounce_timeout))
+  , _fetch_read_strategy(watch(cfg.fetch_read_strategy))
+  , _fetch_coalesce_cross_shard_reads(
+      watch(cfg.fetch_coalesce_cross_shard_reads))
+  , _enable_rack_awareness(watch(cfg.enable_rack_awareness)) {
+    refresh();
+}
+
+template<typename T>
+binding<T> hot_path_watcher::watch(property<T>& p) {
+    auto b = p.bind();
+    b.watch([this] { refresh(); });
+    return b;
+}
+
+void hot_path_watcher::refresh() {
+    detail::hot_path = hot_path_snapshot{
+      .kafka_produce_batch_passthrough = _kafka_produce_batch_passthrough(),
+      .log_message_timestamp_alert_before_ms
+      = _log_message_timestamp_alert_before_ms(),
+      .log_message_timestamp_alert_after_ms
+      = _log_message_timestamp_alert_after_ms(),
+      .fetch_max_bytes = _fetch_max_bytes(),
+      .kafka_max_bytes_per_fetch = _kafka_max_bytes_per_fetch(),
+      .kafka_memory_batch_size_estimate_for_fetch
+      = _kafka_memory_batch_size_estimate_for_fetch(),
+      .fetch_reads_debounce_timeout = _fetch_reads_debounce_timeout(),
+      .fetch_read_strategy = _fetch_read_strategy(),
+      .fetch_coalesce_cross_shard_reads = _fetch_coalesce_cross_shard_reads(),
+      .enable_rack_awareness = _enable_rack_awareness(),
+    };
+}
+
+} // namespace config
@@ -0,0 +1,93 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "config/property.h"
+#include "model/metadata.h"
+
+#include <chrono>
+#include <cstddef>
+#include <optional>
+
+namespace config {
+
+struct configuration;
+
+/**
+ * The values of the properties that are read for every produce and fetch
+ * request, or for every partition of one.
+ *
+ * The shard keeps a snapshot of them in thread local storage that is
+ * replaced as a whole when one of the properties changes. Reading the
+ * snapshot is a plain load, without the initialization check of
+ * shard_local_cfg() or the indirection of a binding.
+ *
+ * The snapshot is taken when the shard local configuration is created.
+ * Until then it holds the values below, which are not the defaults of the
+ * properties.
+ */
+struct hot_path_snapshot {
+    bool kafka_produce_batch_passthrough{false};
+    std::optional<std::chrono::milliseconds>
+      log_message_timestamp_alert_before_ms;
+    std::chrono::milliseconds log_message_timestamp_alert_after_ms{0};
+    size_t fetch_max_bytes{0};
+    size_t kafka_max_bytes_per_fetch{0};
+    size_t kafka_memory_batch_size_estimate_for_fetch{0};
+    std::chrono::milliseconds fetch_reads_debounce_timeout{0};
+    model::fetch_read_strategy fetch_read_strategy{
+      model::fetch_read_strategy::polling};
+    bool fetch_coalesce_cross_shard_reads{false};
+    bool enable_rack_awareness{false};
+};
+
+namespace detail {
+// Constant initialized so that accessing it doesn't go through a thread
+// local initialization wrapper.
+extern constinit thread_local hot_path_snapshot hot_path;
+} // namespace detail
+
+/// The snapshot of the shard local configuration for hot paths.
+inline const hot_path_snapshot& hot_path() { return detail::hot_path; }
+
+/**
+ * Takes a new snapshot for hot_path() every time one of its properties
+ * changes in the configuration it watches.
+ */
+class hot_path_watcher {
+public:
+    explicit hot_path_watcher(configuration&);
+    hot_path_watcher(const hot_path_watcher&) = delete;
+    hot_path_watcher& operator=(const hot_path_watcher&) = delete;
+    hot_path_watcher(hot_path_watcher&&) = delete;
+    hot_path_watcher& operator=(hot_path_watcher&&) = delete;
+    ~hot_path_watcher() = default;
+
+private:
+    template<typename T>
+    binding<T> watch(property<T>&);
+    void refresh();
+
+    binding<bool> _kafka_produce_batch_passthrough;
+    binding<std::optional<std::chrono::milliseconds>>
+      _log_message_timestamp_alert_before_ms;
+    binding<std::chrono::milliseconds> _log_message_timestamp_alert_after_ms;
+    binding<size_t> _fetch_max_bytes;
+    binding<size_t> _kafka_max_bytes_per_fetch;
+    binding<size_t> _kafka_memory_batch_size_estimate_for_fetch;
+    binding<std::chrono::milliseconds> _fetch_reads_debounce_timeout;
+    binding<model::fetch_read_strategy> _fetch_read_strategy;
+    binding<bool> _fetch_coalesce_cross_shard_reads;
+    binding<bool> _enable_rack_awareness;
+};
+
+} // namespace config
@@ -137,6 +137,14 @@ node_config::node_config() noexcept
       "`cloud_storage_enabled` is present",
       {.visibility = visibility::user},
       std::nullopt)
+  , cold_data_directory(
+      *this,
+      "cold_data_directory",
+      "Directory on slower local storage to which sealed log segments are "
+      "moved once they fall outside the newest `storage_hot_tier_bytes` of "
+      "their partition. Segments stay readable from either directory.",
+      {.visibility = visibility::user},
+      std::nullopt)
   , enable_central_config(*this, "enable_central_config")
   , crash_loop_limit(
       *this,
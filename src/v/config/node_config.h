@@ -62,6 +62,9 @@ public:
     // Shadow indexing/S3 cache location
     property<std::optional<ss::sstring>> cloud_storage_cache_directory;
 
+    // Slower local directory that sealed segments are migrated to
+    property<std::optional<ss::sstring>> cold_data_directory;
+
     deprecated_property enable_central_config;
 
     property<std::optional<uint32_t>> crash_loop_limit;
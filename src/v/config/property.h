@@ -645,6 +645,12 @@ consteval std::string_view property_type_name() {
         return "string";
     } else if constexpr (std::is_same_v<type, model::write_caching_mode>) {
         return "string";
+    } else if constexpr (std::is_same_v<
+                           type,
+                           model::batch_cache_eviction_policy>) {
+        return "string";
+    } else if constexpr (std::is_same_v<type, model::compaction_key_hash>) {
+        return "string";
     } else {
         static_assert(
           utils::unsupported_type<T>::value, "Type name not defined");
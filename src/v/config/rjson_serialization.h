@@ -86,6 +86,13 @@ void rjson_serialize(
   json::Writer<json::StringBuffer>& w,
   const model::cloud_storage_chunk_eviction_strategy& v);
 
+void rjson_serialize(
+  json::Writer<json::StringBuffer>& w,
+  const model::batch_cache_eviction_policy& v);
+
+void rjson_serialize(
+  json::Writer<json::StringBuffer>& w, const model::compaction_key_hash& v);
+
 void rjson_serialize(
   json::Writer<json::StringBuffer>& w,
   const pandaproxy::schema_registry::subject_name_strategy& v);
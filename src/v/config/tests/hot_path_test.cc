@@ -0,0 +1,37 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "config/configuration.h"
+#include "config/hot_path.h"
+#include "test_utils/scoped_config.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+SEASTAR_THREAD_TEST_CASE(test_hot_path_snapshot_follows_config) {
+    auto& cfg = config::shard_local_cfg();
+    BOOST_REQUIRE_EQUAL(
+      config::hot_path().fetch_max_bytes, cfg.fetch_max_bytes());
+    BOOST_REQUIRE_EQUAL(
+      config::hot_path().kafka_produce_batch_passthrough,
+      cfg.kafka_produce_batch_passthrough());
+
+    {
+        scoped_config scoped;
+        scoped.get("fetch_max_bytes").set_value(size_t(1234));
+        scoped.get("kafka_produce_batch_passthrough")
+          .set_value(!cfg.kafka_produce_batch_passthrough.default_value());
+        BOOST_REQUIRE_EQUAL(config::hot_path().fetch_max_bytes, 1234);
+        BOOST_REQUIRE_EQUAL(
+          config::hot_path().kafka_produce_batch_passthrough,
+          !cfg.kafka_produce_batch_passthrough.default_value());
+    }
+
+    BOOST_REQUIRE_EQUAL(
+      config::hot_path().fetch_max_bytes, cfg.fetch_max_bytes.default_value());
+}
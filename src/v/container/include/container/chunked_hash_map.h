@@ -0,0 +1,507 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "base/vassert.h"
+#include "container/fragmented_vector.h"
+
+#include <absl/hash/hash.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/**
+ * Chunked hash map is an unordered associative container with open
+ * addressing whose storage, like the one of fragmented_vector, never needs a
+ * large contiguous allocation, so it suits maps growing to millions of
+ * elements where a flat hash map reallocates (and moves) its whole table at
+ * once and a node hash map allocates every element on its own.
+ *
+ * The elements live in segments of `segment_size_bytes`, every segment is a
+ * small open addressing table with linear probing. The top bits of the hash
+ * of a key select its segment through a directory (extendible hashing), the
+ * low bits select its slot in the segment. When a segment is full it is split
+ * in two on the next bit of the hash, so the map rehashes incrementally: an
+ * insert moves at most the elements of one segment, never the whole map. The
+ * directory holds a pointer per segment, or more when segments of different
+ * depths coexist.
+ *
+ * Erasing an element shifts the following elements of its probe sequence
+ * back, there are no tombstones. Segments are not merged back, the memory of
+ * the map is only returned by clear().
+ *
+ * NOTE:
+ * - any insert or erase invalidates the iterators and the references to the
+ *   elements, like a rehash of a flat hash map does.
+ * - the hash must be a good 64 bit hash, e.g. absl::Hash: more than a segment
+ *   of keys sharing the same hash cannot be split and abort the process.
+ */
+template<
+  typename KeyT,
+  typename ValueT,
+  typename Hash = absl::Hash<KeyT>,
+  typename KeyEqual = std::equal_to<KeyT>,
+  size_t segment_size_bytes = 16384>
+class chunked_hash_map {
+public:
+    using value_type = std::pair<const KeyT, ValueT>;
+    using key_type = KeyT;
+    using mapped_type = ValueT;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+
+private:
+    struct slot {
+        // full hash of the key, spares hashing the keys again on a split
+        uint64_t hash{0};
+        std::optional<value_type> value;
+    };
+
+    static constexpr size_t slots_per_segment = std::max<size_t>(
+      8, std::bit_floor(segment_size_bytes / sizeof(slot)));
+    static constexpr size_t slot_mask = slots_per_segment - 1;
+    // segments are split when they are 7/8 full, probes stay short and there
+    // is always an empty slot to end them
+    static constexpr size_t max_segment_size = slots_per_segment
+                                               - slots_per_segment / 8;
+
+    struct segment {
+        segment(size_t i, uint8_t d)
+          : index(i)
+          , depth(d) {}
+
+        std::array<slot, slots_per_segment> slots;
+        size_t size{0};
+        // position of the segment in chunked_hash_map::_segments
+        size_t index;
+        // number of top bits of the hash shared by all the keys of the segment
+        uint8_t depth;
+    };
+
+    template<bool Const>
+    class iter {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type =
+          typename std::conditional_t<Const, const value_type, value_type>;
+
+        using difference_type = std::ptrdiff_t;
+        using pointer = value_type*;
+        using reference = value_type&;
+
+        iter() = default;
+
+        /**
+         * Conversion operator allowing iterator to be converted to
+         * const_iterator, as required by the general iterator contract.
+         */
+        operator iter<true>() const { // NOLINT(hicpp-explicit-conversions)
+            return iter<true>(_container, _segment, _slot);
+        }
+
+        reference operator*() const { return *current().value; }
+
+        pointer operator->() const { return &*current().value; }
+
+        iter& operator++() {
+            ++_slot;
+            skip_to_next_present();
+            return *this;
+        }
+
+        iter operator++(int) {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        bool operator==(const iter& o) const {
+            return std::tie(_container, _segment, _slot)
+                   == std::tie(o._container, o._segment, o._slot);
+        };
+
+    private:
+        friend class chunked_hash_map;
+        template<bool>
+        friend class iter;
+
+        using parent_t = std::
+          conditional_t<Const, const chunked_hash_map, chunked_hash_map>;
+
+        iter(parent_t* map, size_t segment_index, size_t slot_index)
+          : _container(map)
+          , _segment(segment_index)
+          , _slot(slot_index) {}
+
+        slot& current() const {
+            return _container->_segments[_segment]->slots[_slot];
+        }
+
+        void skip_to_next_present() {
+            const auto& segments = _container->_segments;
+            while (_segment < segments.size()) {
+                const auto& slots = segments[_segment]->slots;
+                while (_slot < slots_per_segment && !slots[_slot].value) {
+                    ++_slot;
+                }
+                if (_slot < slots_per_segment) {
+                    return;
+                }
+                ++_segment;
+                _slot = 0;
+            }
+        }
+
+        parent_t* _container{nullptr};
+        size_t _segment{0};
+        size_t _slot{0};
+    };
+
+public:
+    using iterator = iter<false>;
+    using const_iterator = iter<true>;
+
+    chunked_hash_map() noexcept = default;
+    chunked_hash_map& operator=(chunked_hash_map&& other) noexcept {
+        if (this != &other) {
+            _directory = std::move(other._directory);
+            _segments = std::move(other._segments);
+            _size = std::exchange(other._size, 0);
+            _depth = std::exchange(other._depth, 0);
+        }
+        return *this;
+    }
+
+    chunked_hash_map(chunked_hash_map&& other) noexcept {
+        *this = std::move(other);
+    }
+    chunked_hash_map(const chunked_hash_map&) = delete;
+    chunked_hash_map& operator=(const chunked_hash_map&) = delete;
+    ~chunked_hash_map() noexcept = default;
+
+    /**
+     * Return number of elements in the map
+     */
+    size_t size() const { return _size; }
+
+    /**
+     * Returns true when map has no elements
+     */
+    bool empty() const { return _size == 0; }
+
+    /**
+     * Returns the number of slots allocated for the elements
+     */
+    size_t capacity() const { return _segments.size() * slots_per_segment; }
+
+    iterator begin() { return first_present<false>(this); }
+    iterator end() { return iterator(this, _segments.size(), 0); }
+
+    const_iterator begin() const { return first_present<true>(this); }
+    const_iterator end() const {
+        return const_iterator(this, _segments.size(), 0);
+    }
+
+    /**
+     * Returns iterator to an element with requested key or `end()` if the
+     * element is not present in the map
+     */
+    iterator find(const KeyT& key) {
+        const auto h = hash_of(key);
+        if (auto* s = segment_for(h)) {
+            if (auto i = find_slot(*s, h, key)) {
+                return iterator(this, s->index, *i);
+            }
+        }
+        return end();
+    }
+
+    /**
+     * Returns iterator to an element with requested key or `end()` if the
+     * element is not present in the map
+     */
+    const_iterator find(const KeyT& key) const {
+        const auto h = hash_of(key);
+        if (auto* s = segment_for(h)) {
+            if (auto i = find_slot(*s, h, key)) {
+                return const_iterator(this, s->index, *i);
+            }
+        }
+        return end();
+    }
+
+    /**
+     * Determines if element comparing equal to given key exists in a map.
+     */
+    bool contains(const KeyT& key) const { return find(key) != end(); }
+
+    /**
+     * Returns an element comparing equal to given key. If an element for the
+     * given key is not present the default element will be constructed.
+     */
+    mapped_type& operator[](const KeyT& key) {
+        return try_emplace(key).first->second;
+    }
+
+    /**
+     * Constructs element for given key in place.
+     *
+     * Returns a pair containing an iterator to the element (either existing or
+     * newly created one) and a boolean indicating if element was inserted.
+     *
+     * Element constructor is not invoked if an element already exists in the
+     * map.
+     */
+    template<typename K, typename... Args>
+    std::pair<iterator, bool> try_emplace(K&& key, Args&&... args) {
+        const auto h = hash_of(key);
+        auto [s, i, inserted] = insert_slot(h, key);
+        if (inserted) {
+            s->slots[i].value.emplace(
+              std::piecewise_construct,
+              std::forward_as_tuple(std::forward<K>(key)),
+              std::forward_as_tuple(std::forward<Args>(args)...));
+            s->slots[i].hash = h;
+            ++s->size;
+            ++_size;
+        }
+        return {iterator(this, s->index, i), inserted};
+    }
+
+    template<typename K, typename... Args>
+    std::pair<iterator, bool> emplace(K&& key, Args&&... args) {
+        return try_emplace(std::forward<K>(key), std::forward<Args>(args)...);
+    }
+
+    std::pair<iterator, bool> insert(value_type v) {
+        return try_emplace(v.first, std::move(v.second));
+    }
+
+    /**
+     * Removes the element with given key from the map, returns the number of
+     * removed elements.
+     */
+    size_t erase(const KeyT& key) {
+        const auto h = hash_of(key);
+        if (auto* s = segment_for(h)) {
+            if (auto i = find_slot(*s, h, key)) {
+                erase_slot(*s, *i);
+                return 1;
+            }
+        }
+        return 0;
+    }
+
+    /**
+     * Removes the element pointed by given iterator from the map.
+     */
+    void erase(const_iterator it) {
+        erase_slot(*_segments[it._segment], it._slot);
+    }
+
+    /**
+     * Removes all the elements for which the predicate returns true, returns
+     * the number of removed elements.
+     */
+    template<typename Pred>
+    size_t erase_if(Pred pred) {
+        const auto size_before = _size;
+        for (auto& s : _segments) {
+            for (size_t i = 0; i < slots_per_segment;) {
+                auto& sl = s->slots[i];
+                if (sl.value && pred(std::as_const(*sl.value))) {
+                    // an element of the probe sequence moves to the slot,
+                    // it must be tested too
+                    erase_slot(*s, i);
+                } else {
+                    ++i;
+                }
+            }
+        }
+        return size_before - _size;
+    }
+
+    /**
+     * Removes all the elements and releases the memory of the map.
+     */
+    void clear() {
+        _directory.clear();
+        _segments.clear();
+        _depth = 0;
+        _size = 0;
+    }
+
+private:
+    // the hash of a key is mixed (murmur3 finalizer) so that hashes that are
+    // poorly distributed, e.g. std::hash of integers, use all of the segments
+    uint64_t hash_of(const KeyT& key) const {
+        auto h = static_cast<uint64_t>(_hash(key));
+        h ^= h >> 33U;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33U;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33U;
+        return h;
+    }
+
+    size_t directory_index(uint64_t h) const {
+        return _depth == 0 ? 0 : h >> (64U - _depth);
+    }
+
+    segment* segment_for(uint64_t h) const {
+        if (_directory.empty()) {
+            return nullptr;
+        }
+        return _directory[directory_index(h)];
+    }
+
+    std::optional<size_t>
+    find_slot(const segment& s, uint64_t h, const KeyT& key) const {
+        for (size_t i = h & slot_mask;; i = (i + 1) & slot_mask) {
+            const auto& sl = s.slots[i];
+            if (!sl.value) {
+                return std::nullopt;
+            }
+            if (sl.hash == h && _eq(sl.value->first, key)) {
+                return i;
+            }
+        }
+    }
+
+    /**
+     * Returns the slot of the key, or the empty slot where it is to be
+     * inserted when it is not present, splitting its segment when it is full.
+     */
+    std::tuple<segment*, size_t, bool>
+    insert_slot(uint64_t h, const KeyT& key) {
+        if (_directory.empty()) {
+            _segments.push_back(std::make_unique<segment>(0, 0));
+            _directory.push_back(_segments.back().get());
+        }
+        auto* s = segment_for(h);
+        if (auto i = find_slot(*s, h, key)) {
+            return {s, *i, false};
+        }
+        while (s->size >= max_segment_size) {
+            split(h);
+            s = segment_for(h);
+        }
+        return {s, free_slot(*s, h), true};
+    }
+
+    static size_t free_slot(const segment& s, uint64_t h) {
+        auto i = h & slot_mask;
+        while (s.slots[i].value) {
+            i = (i + 1) & slot_mask;
+        }
+        return i;
+    }
+
+    /**
+     * Splits the segment of hash `h` in two on the next bit of the hashes of
+     * its keys, doubling the directory when the segment is as deep as it.
+     */
+    void split(uint64_t h) {
+        auto& s = *segment_for(h);
+        vassert(
+          s.depth < 64,
+          "chunked_hash_map segment of {} elements with the same hash",
+          s.size);
+        if (s.depth == _depth) {
+            grow_directory();
+        }
+        const auto depth = static_cast<uint8_t>(s.depth + 1);
+        const auto index = s.index;
+        auto low = std::make_unique<segment>(index, depth);
+        auto high = std::make_unique<segment>(_segments.size(), depth);
+        const uint64_t high_bit = uint64_t{1} << (64U - depth);
+        for (auto& sl : s.slots) {
+            if (!sl.value) {
+                continue;
+            }
+            auto& dst = (sl.hash & high_bit) ? *high : *low;
+            auto& dst_slot = dst.slots[free_slot(dst, sl.hash)];
+            dst_slot.hash = sl.hash;
+            dst_slot.value.emplace(std::move(*sl.value));
+            ++dst.size;
+        }
+        // the segment has 2^(_depth - s.depth) consecutive directory entries,
+        // the first half now point to the low segment, the second to the high
+        const size_t span = size_t{1} << (_depth - s.depth);
+        const size_t first = directory_index(h) & ~(span - 1);
+        for (size_t i = 0; i < span; ++i) {
+            _directory[first + i] = i < span / 2 ? low.get() : high.get();
+        }
+        _segments[index] = std::move(low);
+        _segments.push_back(std::move(high));
+    }
+
+    void grow_directory() {
+        directory_t grown;
+        grown.reserve(_directory.size() * 2);
+        for (auto* s : _directory) {
+            grown.push_back(s);
+            grown.push_back(s);
+        }
+        _directory = std::move(grown);
+        ++_depth;
+    }
+
+    /**
+     * Empties a slot, moving back the elements that follow it in their probe
+     * sequence so that lookups never stop at an empty slot before the key.
+     */
+    void erase_slot(segment& s, size_t hole) {
+        s.slots[hole].value.reset();
+        for (size_t i = (hole + 1) & slot_mask; s.slots[i].value;
+             i = (i + 1) & slot_mask) {
+            const auto home = s.slots[i].hash & slot_mask;
+            // the element may move to the hole if the hole is between its
+            // home slot and its slot
+            if (((i - home) & slot_mask) >= ((i - hole) & slot_mask)) {
+                s.slots[hole].hash = s.slots[i].hash;
+                s.slots[hole].value.emplace(std::move(*s.slots[i].value));
+                s.slots[i].value.reset();
+                hole = i;
+            }
+        }
+        --s.size;
+        --_size;
+    }
+
+    template<bool Const, typename Map>
+    static iter<Const> first_present(Map* map) {
+        iter<Const> it(map, 0, 0);
+        it.skip_to_next_present();
+        return it;
+    }
+
+    using directory_t = chunked_vector<segment*>;
+
+    // 2^_depth entries, indexed with the top _depth bits of the hash
+    directory_t _directory;
+    chunked_vector<std::unique_ptr<segment>> _segments;
+    size_t _size{0};
+    uint8_t _depth{0};
+    [[no_unique_address]] Hash _hash;
+    [[no_unique_address]] KeyEqual _eq;
+};
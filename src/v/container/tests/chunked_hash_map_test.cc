@@ -0,0 +1,197 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "container/chunked_hash_map.h"
+#include "random/generators.h"
+
+#include <absl/container/flat_hash_map.h>
+#include <fmt/core.h>
+#include <gtest/gtest.h>
+
+#include <string>
+
+using int_hash_map = chunked_hash_map<uint64_t, std::string>;
+
+static_assert(std::forward_iterator<int_hash_map::iterator>);
+static_assert(std::forward_iterator<int_hash_map::const_iterator>);
+static_assert(std::copy_constructible<int_hash_map::iterator>);
+static_assert(std::copy_constructible<int_hash_map::const_iterator>);
+
+namespace {
+
+// few distinct hashes, many keys share the slots of a segment and the
+// segments split unevenly
+struct weak_hash {
+    size_t operator()(uint64_t k) const { return k % 1024; }
+};
+
+template<typename Map>
+struct verifier {
+    template<typename Func>
+    auto mutate(Func f) {
+        f(expected);
+        return f(under_test);
+    }
+
+    testing::AssertionResult is_valid() const {
+        if (under_test.size() != expected.size()) {
+            return testing::AssertionFailure() << fmt::format(
+                     "Expected size {} is different than current size {}",
+                     expected.size(),
+                     under_test.size());
+        }
+        size_t iterated = 0;
+        for (const auto& [k, v] : under_test) {
+            ++iterated;
+            auto it = expected.find(k);
+            if (it == expected.end() || it->second != v) {
+                return testing::AssertionFailure()
+                       << fmt::format("Unexpected element {}:{}", k, v);
+            }
+        }
+        if (iterated != expected.size()) {
+            return testing::AssertionFailure() << fmt::format(
+                     "Iterated over {} elements, expected {}",
+                     iterated,
+                     expected.size());
+        }
+        for (const auto& [k, v] : expected) {
+            auto it = under_test.find(k);
+            if (it == under_test.end() || it->second != v) {
+                return testing::AssertionFailure()
+                       << fmt::format("Missing element {}:{}", k, v);
+            }
+        }
+        return testing::AssertionSuccess();
+    }
+
+    Map under_test;
+    absl::flat_hash_map<uint64_t, std::string> expected;
+};
+
+template<typename Map>
+void random_operations() {
+    verifier<Map> v;
+    static constexpr uint64_t key_set_cardinality = 50000;
+    for (int i = 0; i < 200000; ++i) {
+        auto k = random_generators::get_int<uint64_t>(key_set_cardinality);
+        if (random_generators::get_int(0, 2) < 2) {
+            auto value = random_generators::gen_alphanum_string(8);
+            v.mutate([k, &value](auto& m) { m[k] = value; });
+        } else {
+            auto erased = v.under_test.erase(k);
+            EXPECT_EQ(erased, v.expected.erase(k));
+        }
+    }
+    EXPECT_TRUE(v.is_valid());
+}
+
+} // namespace
+
+TEST(ChunkedHashMap, Emplace) {
+    verifier<int_hash_map> v;
+
+    EXPECT_EQ(v.under_test.begin(), v.under_test.end());
+
+    auto [it, success] = v.mutate([](auto& m) { return m.emplace(1, "a"); });
+    EXPECT_TRUE(success);
+
+    EXPECT_EQ(it, v.under_test.begin());
+    EXPECT_EQ(it->first, 1);
+    EXPECT_EQ(it->second, "a");
+
+    auto [new_it, not_success] = v.mutate(
+      [](auto& m) { return m.emplace(1, "b"); });
+    EXPECT_FALSE(not_success);
+    EXPECT_EQ(new_it->first, 1);
+    EXPECT_EQ(new_it->second, "a");
+
+    EXPECT_TRUE(v.under_test.contains(1));
+    EXPECT_FALSE(v.under_test.contains(2));
+    EXPECT_TRUE(v.is_valid());
+}
+
+TEST(ChunkedHashMap, EmplaceErase) {
+    verifier<int_hash_map> v;
+    v.mutate([](auto& m) { return m.erase(0); });
+
+    for (uint64_t k : {1, 3, 8, 10, 15}) {
+        v.mutate([k](auto& m) { m[k] = fmt::format("{}", k); });
+    }
+
+    v.mutate([](auto& m) { return m.erase(8); });
+    v.mutate([](auto& m) { return m.erase(6); });
+    v.mutate([](auto& m) { return m.erase(3); });
+
+    v.mutate([](auto& m) {
+        auto it = m.find(10);
+        m.erase(it);
+    });
+
+    EXPECT_TRUE(v.is_valid());
+}
+
+TEST(ChunkedHashMap, SplitsSegments) {
+    verifier<int_hash_map> v;
+    for (uint64_t k = 0; k < 100000; ++k) {
+        v.mutate([k](auto& m) { m.emplace(k, fmt::format("{}", k)); });
+    }
+    EXPECT_TRUE(v.is_valid());
+    // a full segment splits in halves, the slots stay well used
+    EXPECT_GE(v.under_test.size() * 3, v.under_test.capacity());
+
+    v.under_test.clear();
+    v.expected.clear();
+    EXPECT_EQ(v.under_test.capacity(), 0);
+    EXPECT_TRUE(v.is_valid());
+}
+
+TEST(ChunkedHashMap, EraseIf) {
+    verifier<int_hash_map> v;
+    for (uint64_t k = 0; k < 20000; ++k) {
+        v.mutate([k](auto& m) { m.emplace(k, fmt::format("{}", k)); });
+    }
+    auto erased = v.under_test.erase_if(
+      [](const auto& kv) { return kv.first % 3 == 0; });
+    auto expected_erased = absl::erase_if(
+      v.expected, [](const auto& kv) { return kv.first % 3 == 0; });
+    EXPECT_EQ(erased, expected_erased);
+    EXPECT_TRUE(v.is_valid());
+}
+
+TEST(ChunkedHashMap, Move) {
+    int_hash_map m;
+    for (uint64_t k = 0; k < 1000; ++k) {
+        m[k] = fmt::format("{}", k);
+    }
+    int_hash_map moved(std::move(m));
+    EXPECT_EQ(moved.size(), 1000);
+    // NOLINTNEXTLINE(bugprone-use-after-move)
+    EXPECT_TRUE(m.empty());
+    EXPECT_EQ(m.begin(), m.end());
+
+    m = std::move(moved);
+    EXPECT_EQ(m.size(), 1000);
+    EXPECT_EQ(m.find(999)->second, "999");
+}
+
+TEST(ChunkedHashMap, RandomOperations) { random_operations<int_hash_map>(); }
+
+TEST(ChunkedHashMap, RandomOperationsWeakHash) {
+    random_operations<chunked_hash_map<uint64_t, std::string, weak_hash>>();
+}
+
+TEST(ChunkedHashMap, RandomOperationsSmallSegments) {
+    random_operations<chunked_hash_map<
+      uint64_t,
+      std::string,
+      absl::Hash<uint64_t>,
+      std::equal_to<uint64_t>,
+      256>>();
+}
@@ -103,6 +103,12 @@ std::string_view to_string_view(feature f) {
         return "node_local_core_assignment";
     case feature::role_based_access_control:
         return "role_base_access_control";
+    case feature::cloud_storage_segment_packing:
+        return "cloud_storage_segment_packing";
+    case feature::compact_leadership_updates:
+        return "compact_leadership_updates";
+    case feature::bulk_topic_lifecycle_transitions:
+        return "bulk_topic_lifecycle_transitions";
 
     /*
      * testing features
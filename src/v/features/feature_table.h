@@ -76,6 +76,9 @@ enum class feature : std::uint64_t {
     compaction_placeholder_batch = 1ULL << 42U,
     node_local_core_assignment = 1ULL << 43U,
     role_based_access_control = 1ULL << 44U,
+    cloud_storage_segment_packing = 1ULL << 45U,
+    compact_leadership_updates = 1ULL << 46U,
+    bulk_topic_lifecycle_transitions = 1ULL << 47U,
 
     // Dummy features for testing only
     test_alpha = 1ULL << 61U,
@@ -384,6 +387,24 @@ constexpr static std::array feature_schema{
     "role_based_access_control",
     feature::role_based_access_control,
     feature_spec::available_policy::always,
+    feature_spec::prepare_policy::always}},
+  feature_spec{
+    cluster::cluster_version{12},
+    "cloud_storage_segment_packing",
+    feature::cloud_storage_segment_packing,
+    feature_spec::available_policy::always,
+    feature_spec::prepare_policy::always},
+  feature_spec{
+    cluster::cluster_version{12},
+    "compact_leadership_updates",
+    feature::compact_leadership_updates,
+    feature_spec::available_policy::always,
+    feature_spec::prepare_policy::always},
+  feature_spec{
+    cluster::cluster_version{12},
+    "bulk_topic_lifecycle_transitions",
+    feature::bulk_topic_lifecycle_transitions,
+    feature_spec::available_policy::always,
     feature_spec::prepare_policy::always}};
 
 std::string_view to_string_view(feature);
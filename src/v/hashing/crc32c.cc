@@ -0,0 +1,44 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "hashing/crc32c.h"
+
+#include <cstring>
+
+namespace crc {
+
+void fragment_crc32c::extend(const char* data, size_t size) {
+    if (size >= coalesce_below) {
+        flush();
+        _crc.extend(data, size);
+        return;
+    }
+    if (_staged + size > _staging.size()) {
+        flush();
+    }
+    std::memcpy(_staging.data() + _staged, data, size);
+    _staged += size;
+}
+
+void fragment_crc32c::flush() {
+    if (_staged > 0) {
+        _crc.extend(_staging.data(), _staged);
+        _staged = 0;
+    }
+}
+
+} // namespace crc
+
+void crc_extend_iobuf(crc::crc32c& crc, const iobuf& buf) {
+    crc::fragment_crc32c fragments(crc);
+    for (const auto& frag : buf) {
+        fragments.extend(frag.get(), frag.size());
+    }
+    fragments.flush();
+}
@@ -14,6 +14,8 @@
 
 #include <crc32c/crc32c.h>
 
+#include <array>
+#include <cstddef>
 #include <type_traits>
 
 namespace crc {
@@ -41,13 +43,41 @@ private:
     uint32_t _crc = 0;
 };
 
+/**
+ * Extends a crc32c with the fragments of a buffer, coalescing short ones.
+ *
+ * The hardware crc32c kernel interleaves several independent streams over
+ * long inputs and folds them together at the end, but each call pays a fixed
+ * setup cost and inputs shorter than a few hundred bytes are processed one
+ * word at a time. Iobufs built off the wire are often made of many small
+ * fragments, so short fragments are copied into a staging buffer and checked
+ * together. Long fragments are passed through as they are.
+ *
+ * The caller must call flush() before reading the crc value.
+ */
+class fragment_crc32c {
+public:
+    explicit fragment_crc32c(crc32c& crc) noexcept
+      : _crc(crc) {}
+    fragment_crc32c(const fragment_crc32c&) = delete;
+    fragment_crc32c& operator=(const fragment_crc32c&) = delete;
+    fragment_crc32c(fragment_crc32c&&) = delete;
+    fragment_crc32c& operator=(fragment_crc32c&&) = delete;
+    ~fragment_crc32c() noexcept = default;
+
+    void extend(const char* data, size_t size);
+    void flush();
+
+private:
+    static constexpr size_t staging_size = 4096;
+    static constexpr size_t coalesce_below = 512;
+
+    crc32c& _crc;
+    size_t _staged{0};
+    std::array<char, staging_size> _staging;
+};
+
 } // namespace crc
 
-inline void crc_extend_iobuf(crc::crc32c& crc, const iobuf& buf) {
-    auto in = iobuf::iterator_consumer(buf.cbegin(), buf.cend());
-    (void)in.consume(buf.size_bytes(), [&crc](const char* src, size_t sz) {
-        // NOLINTNEXTLINE
-        crc.extend(reinterpret_cast<const uint8_t*>(src), sz);
-        return ss::stop_iteration::no;
-    });
-}
+/// Extends \p crc with the bytes of \p buf.
+void crc_extend_iobuf(crc::crc32c& crc, const iobuf& buf);
@@ -13,6 +13,7 @@
 
 #include "base/seastarx.h"
 
+#include <array>
 #include <cstdint>
 #include <cstring>
 #include <functional>
@@ -33,6 +34,17 @@ inline uint32_t xxhash_32(const char* data, const size_t& length) {
     return XXH32(data, length, 0);
 }
 
+/// The 128-bit xxh3 hash of \p data in its canonical (big endian) byte order.
+inline std::array<char, 16>
+xxhash3_128(const char* data, size_t length, uint64_t seed = 0) {
+    XXH128_canonical_t canonical;
+    XXH128_canonicalFromHash(
+      &canonical, XXH3_128bits_withSeed(data, length, seed));
+    std::array<char, 16> ret;
+    std::memcpy(ret.data(), canonical.digest, ret.size());
+    return ret;
+}
+
 class incremental_xxhash64 {
 public:
     explicit incremental_xxhash64(uint64_t seed = 0) {
@@ -0,0 +1,63 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#define BOOST_TEST_MODULE crc32c
+#include "bytes/iobuf.h"
+#include "hashing/crc32c.h"
+#include "random/generators.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+static uint32_t contiguous_crc(const ss::sstring& data) {
+    crc::crc32c crc;
+    crc.extend(data.data(), data.size());
+    return crc.value();
+}
+
+BOOST_AUTO_TEST_CASE(fragmented_iobuf_matches_contiguous) {
+    // mix of fragment sizes on either side of the coalescing threshold and
+    // runs of short fragments that overflow the staging buffer
+    const std::vector<size_t> sizes = {
+      1, 7, 511, 512, 513, 3, 4096, 100, 100, 4000, 9000, 0, 17, 65};
+    for (size_t rounds = 0; rounds < 200; ++rounds) {
+        iobuf buf;
+        ss::sstring expected;
+        for (size_t i = 0; i < sizes.size(); ++i) {
+            auto len = sizes[(i + rounds) % sizes.size()]
+                       + random_generators::get_int<size_t>(0, rounds);
+            auto part = random_generators::gen_alphanum_string(len);
+            iobuf fragment;
+            fragment.append(part.data(), part.size());
+            buf.append_fragments(std::move(fragment));
+            expected += part;
+        }
+        BOOST_REQUIRE_EQUAL(buf.size_bytes(), expected.size());
+
+        crc::crc32c crc;
+        crc_extend_iobuf(crc, buf);
+        BOOST_REQUIRE_EQUAL(crc.value(), contiguous_crc(expected));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(fragment_crc32c_extends_existing_value) {
+    auto head = random_generators::gen_alphanum_string(33);
+    auto tail = random_generators::gen_alphanum_string(77);
+
+    crc::crc32c crc;
+    crc.extend(head.data(), head.size());
+    crc::fragment_crc32c fragments(crc);
+    for (auto c : tail) {
+        fragments.extend(&c, 1);
+    }
+    fragments.flush();
+
+    BOOST_REQUIRE_EQUAL(crc.value(), contiguous_crc(head + tail));
+}
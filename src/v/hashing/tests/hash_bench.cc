@@ -8,6 +8,7 @@
 // by the Apache License, Version 2.0
 
 #include "hashing/crc32c.h"
+#include "hashing/secure.h"
 #include "hashing/xx.h"
 #include "model/fundamental.h"
 #include "model/ktp.h"
@@ -127,6 +128,26 @@ PERF_TEST(header_hash, xx32_fn) {
       [](auto& buffer) { return xxhash_32(buffer.data(), buffer.size()); });
 }
 
+PERF_TEST(header_hash, xx64_fn) {
+    return header_body(
+      [](auto& buffer) { return xxhash_64(buffer.data(), buffer.size()); });
+}
+
+// the key hash functions of sliding window compaction
+PERF_TEST(header_hash, xxh3_128_fn) {
+    return header_body(
+      [](auto& buffer) { return xxhash3_128(buffer.data(), buffer.size()); });
+}
+
+PERF_TEST(header_hash, sha256_fn) {
+    // reused like compaction reuses it, to leave out the gnutls setup
+    hash_sha256 h;
+    return header_body([&h](auto& buffer) {
+        h.update(std::string_view(buffer.data(), buffer.size()));
+        return h.reset();
+    });
+}
+
 using model::ktp;
 using model::ktp_with_hash;
 using model::ntp;
@@ -65,3 +65,19 @@ BOOST_AUTO_TEST_CASE(overload_resolution) {
     named_str s("test_str");
     test_incremental_hash(s, s());
 }
+
+BOOST_AUTO_TEST_CASE(xxhash3_128_canonical) {
+    const std::string_view data = "compaction key";
+    const auto hash = XXH3_128bits(data.data(), data.size());
+    const auto canonical = xxhash3_128(data.data(), data.size());
+
+    // big endian, high half first
+    uint64_t high = 0;
+    for (int i = 0; i < 8; ++i) {
+        high = (high << 8) | static_cast<uint8_t>(canonical[i]);
+    }
+    BOOST_CHECK_EQUAL(high, hash.high64);
+
+    BOOST_CHECK(canonical == xxhash3_128(data.data(), data.size()));
+    BOOST_CHECK(canonical != xxhash3_128(data.data(), data.size(), 1));
+}
@@ -189,6 +189,28 @@ ss::future<reconnect_result_t> client::get_connected(
                          : reconnect_result_t::timed_out;
 }
 
+bool client::is_warm(ss::lowres_clock::duration max_age) const {
+    return is_valid() && _last_response != ss::lowres_clock::time_point::min()
+           && ss::lowres_clock::now() - _last_response < max_age;
+}
+
+ss::future<reconnect_result_t> client::warm_up(
+  ss::lowres_clock::duration max_age, ss::lowres_clock::duration timeout) {
+    if (is_warm(max_age)) {
+        co_return reconnect_result_t::connected;
+    }
+    prefix_logger ctxlog(http_log, "[warm-up]");
+    if (is_valid()) {
+        vlog(ctxlog.debug, "replacing idle connection");
+        shutdown();
+    }
+    auto res = co_await get_connected(timeout, ctxlog);
+    if (res == reconnect_result_t::connected) {
+        _last_response = ss::lowres_clock::now();
+    }
+    co_return res;
+}
+
 ss::future<> client::stop() {
     co_await _connect_gate.close();
     // Can safely stop base_transport
@@ -93,6 +93,18 @@ public:
     ss::future<reconnect_result_t>
     get_connected(ss::lowres_clock::duration timeout, prefix_logger ctxlog);
 
+    /// Return true if the connection is open and the last response was
+    /// received less than 'max_age' ago
+    bool is_warm(ss::lowres_clock::duration max_age) const;
+
+    /// Reopen the connection unless it's warm (see 'is_warm')
+    ///
+    /// This allows the connection to be replaced before the server closes
+    /// it as idle, so that the next request doesn't have to wait for the
+    /// handshake.
+    ss::future<reconnect_result_t> warm_up(
+      ss::lowres_clock::duration max_age, ss::lowres_clock::duration timeout);
+
     void fail_outstanding_futures() noexcept override;
 
     // Response state machine
@@ -260,7 +272,7 @@ private:
     const ss::abort_source* _as;
     ss::shared_ptr<http::client_probe> _probe;
     // Stores point in time when the last response was received
-    // from the server.
+    // from the server or when the connection was warmed up.
     ss::lowres_clock::time_point _last_response{
       ss::lowres_clock::time_point::min()};
     ss::lowres_clock::duration _max_idle_time;
@@ -11,6 +11,7 @@
 #pragma once
 
 #include "container/intrusive_list_helpers.h"
+#include "io/cache.h"
 
 #include <seastar/core/temporary_buffer.hh>
 
@@ -81,6 +82,12 @@ public:
     // NOLINTNEXTLINE(*-non-private-member-variables-in-classes)
     intrusive_list_hook io_queue_hook;
 
+    /**
+     * Cache hook for page cache membership.
+     */
+    // NOLINTNEXTLINE(*-non-private-member-variables-in-classes)
+    cache_hook page_cache_hook;
+
 private:
     static constexpr auto num_page_flags
       = static_cast<std::underlying_type_t<flags>>(flags::num_flags);
@@ -0,0 +1,52 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "io/page_cache.h"
+
+namespace experimental::io {
+
+bool page_cache::evict::operator()(page& page) noexcept {
+    /*
+     * pages are inserted into the cache after their I/O completes, but a page
+     * may be resubmitted while it is resident. those pages are pinned.
+     */
+    if (
+      page.test_flag(page::flags::read) || page.test_flag(page::flags::write)
+      || page.test_flag(page::flags::queued)) {
+        return false;
+    }
+    /*
+     * outstanding shares of the buffer (e.g. a reader holding a view into the
+     * page) keep the memory alive until they are released.
+     */
+    page.data() = {};
+    return true;
+}
+
+size_t page_cache::cost::operator()(const page& page) noexcept {
+    return page.size();
+}
+
+page_cache::page_cache(config config) noexcept
+  : cache_(config) {}
+
+void page_cache::insert(page& page) noexcept { cache_.insert(page); }
+
+void page_cache::remove(const page& page) noexcept { cache_.remove(page); }
+
+bool page_cache::ghost_queue_contains(const page& page) const noexcept {
+    return cache_.ghost_queue_contains(page);
+}
+
+struct page_cache::cache_type::stat page_cache::stat() const noexcept {
+    return cache_.stat();
+}
+
+} // namespace experimental::io
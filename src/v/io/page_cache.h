@@ -0,0 +1,72 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "io/cache.h"
+#include "io/page.h"
+
+namespace experimental::io {
+
+/**
+ * A cache of pages using the s3-fifo eviction algorithm.
+ *
+ * A single page cache is shared by all pagers on a core, and its capacity is
+ * expressed in bytes. Evicting a page releases its data buffer, but the page
+ * object remains owned by its pager. This is what allows a subsequent miss on
+ * the same page to be recognized as a hit on the ghost queue.
+ *
+ * Only pages that are resident and have no queued or inflight I/O should be
+ * inserted into the cache.
+ */
+class page_cache {
+    struct evict {
+        bool operator()(page&) noexcept;
+    };
+
+    struct cost {
+        size_t operator()(const page&) noexcept;
+    };
+
+    using cache_type = cache<page, &page::page_cache_hook, evict, cost>;
+
+public:
+    using config = cache_type::config;
+
+    /**
+     * Construct a page cache with the given \p config.
+     */
+    explicit page_cache(config config) noexcept;
+
+    /**
+     * Insert \p page into the cache.
+     */
+    void insert(page& page) noexcept;
+
+    /**
+     * Remove \p page from the cache.
+     */
+    void remove(const page& page) noexcept;
+
+    /**
+     * Returns true if \p page is on the ghost queue.
+     */
+    [[nodiscard]] bool ghost_queue_contains(const page& page) const noexcept;
+
+    /**
+     * Return the current cache statistics.
+     */
+    [[nodiscard]] struct cache_type::stat stat() const noexcept;
+
+private:
+    cache_type cache_;
+};
+
+} // namespace experimental::io
@@ -0,0 +1,205 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "io/pager.h"
+
+#include "base/vassert.h"
+#include "base/vlog.h"
+#include "io/logger.h"
+#include "io/page_cache.h"
+
+#include <seastar/core/align.hh>
+#include <seastar/core/coroutine.hh>
+
+#include <cstring>
+
+namespace experimental::io {
+
+namespace {
+seastar::temporary_buffer<char> make_page_buffer() {
+    return seastar::temporary_buffer<char>::aligned(
+      pager::page_size, pager::page_size);
+}
+} // namespace
+
+pager::pager(
+  std::filesystem::path path,
+  persistence* storage,
+  page_cache* cache,
+  scheduler* scheduler)
+  : cache_(cache)
+  , scheduler_(scheduler)
+  , queue_(storage, std::move(path), [this](page& page) noexcept {
+      complete(page);
+  }) {
+    scheduler_->add_queue(&queue_);
+}
+
+pager::~pager() noexcept {
+    vassert(closed_, "Pager for {} destroyed without closing", queue_.path());
+}
+
+seastar::future<> pager::close() noexcept {
+    vlog(log.debug, "Closing pager for {}", queue_.path());
+    /*
+     * readers may be waiting on reads dispatched through the scheduler queue,
+     * so the queue is only removed after all readers have exited.
+     */
+    co_await gate_.close();
+    co_await scheduler::remove_queue(&queue_);
+    while (pages_.begin() != pages_.end()) {
+        erase(pages_.begin());
+    }
+    closed_ = true;
+}
+
+seastar::future<std::vector<seastar::temporary_buffer<char>>>
+pager::read(uint64_t offset, size_t size) {
+    auto holder = gate_.hold();
+    std::vector<seastar::temporary_buffer<char>> ret;
+    while (size > 0) {
+        const auto page_offset = seastar::align_down<uint64_t>(
+          offset, page_size);
+        auto page = co_await get_page(page_offset);
+        const auto page_pos = offset - page_offset;
+        const auto len = std::min<size_t>(size, page_size - page_pos);
+        ret.push_back(page->data().share(page_pos, len));
+        offset += len;
+        size -= len;
+    }
+    co_return ret;
+}
+
+seastar::future<seastar::lw_shared_ptr<page>>
+pager::get_page(uint64_t offset) {
+    bool missed = false;
+    while (true) {
+        auto it = pages_.find(offset);
+        if (it == pages_.end()) {
+            auto page = seastar::make_lw_shared<io::page>(
+              offset, make_page_buffer());
+            auto res = pages_.insert(page);
+            vassert(res.second, "Unexpected page overlap at {}", offset);
+            missed = true;
+            submit_read(*page);
+            co_await cond_.wait(
+              [&page] { return !page->test_flag(page::flags::read); });
+            /*
+             * the page may have been dropped while the read was in flight
+             * (e.g. truncation or racing population), so look it up again.
+             */
+            continue;
+        }
+
+        auto page = *it;
+        if (page->test_flag(page::flags::read)) {
+            co_await cond_.wait(
+              [&page] { return !page->test_flag(page::flags::read); });
+            continue;
+        }
+
+        if (page->data().empty()) {
+            /*
+             * the page was evicted. reuse the page object so that the state
+             * of its cache hook is preserved for ghost queue admission.
+             */
+            if (cache_->ghost_queue_contains(*page)) {
+                ++stats_.ghost_hits;
+            }
+            page->data() = make_page_buffer();
+            missed = true;
+            submit_read(*page);
+            co_await cond_.wait(
+              [&page] { return !page->test_flag(page::flags::read); });
+            continue;
+        }
+
+        if (missed) {
+            ++stats_.misses;
+        } else {
+            ++stats_.hits;
+        }
+        page->page_cache_hook.touch();
+        co_return page;
+    }
+}
+
+void pager::populate(uint64_t offset, const char* data, size_t size) noexcept {
+    while (size > 0) {
+        const auto page_offset = seastar::align_down<uint64_t>(
+          offset, page_size);
+        const auto page_pos = offset - page_offset;
+        const auto len = std::min<size_t>(size, page_size - page_pos);
+
+        auto it = pages_.find(page_offset);
+        if (it == pages_.end()) {
+            /*
+             * without the prefix of the page we can't construct it, so leave
+             * it to be read from the backing file on demand.
+             */
+            if (page_pos == 0) {
+                auto page = seastar::make_lw_shared<io::page>(
+                  page_offset, make_page_buffer());
+                std::memcpy(page->data().get_write(), data, len);
+                auto res = pages_.insert(page);
+                vassert(
+                  res.second, "Unexpected page overlap at {}", page_offset);
+                cache_->insert(*page);
+            }
+        } else if ((*it)->test_flag(page::flags::read)) {
+            /*
+             * the inflight read may complete with stale data. drop the page
+             * and let waiters retry against a fresh page.
+             */
+            erase(it);
+        } else if (!(*it)->data().empty()) {
+            std::memcpy((*it)->data().get_write() + page_pos, data, len);
+        }
+
+        offset += len;
+        data += len;
+        size -= len;
+    }
+}
+
+void pager::truncate(uint64_t size) noexcept {
+    const auto limit = seastar::align_up<uint64_t>(size, page_size);
+    std::vector<uint64_t> offsets;
+    for (auto it = pages_.begin(); it != pages_.end(); ++it) {
+        if ((*it)->offset() >= limit) {
+            offsets.push_back((*it)->offset());
+        }
+    }
+    for (auto offset : offsets) {
+        erase(pages_.find(offset));
+    }
+}
+
+const pager::stats& pager::get_stats() const noexcept { return stats_; }
+
+void pager::submit_read(page& page) noexcept {
+    scheduler_->submit_read(&queue_, &page);
+}
+
+void pager::complete(page& page) noexcept {
+    page.clear_flag(page::flags::read);
+    auto it = pages_.find(page.offset());
+    if (it != pages_.end() && (*it).get() == &page) {
+        cache_->insert(page);
+    }
+    cond_.broadcast();
+}
+
+void pager::erase(page_set::const_iterator it) noexcept {
+    cache_->remove(**it);
+    pages_.erase(it);
+}
+
+} // namespace experimental::io
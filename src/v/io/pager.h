@@ -0,0 +1,135 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "io/page_set.h"
+#include "io/scheduler.h"
+
+#include <seastar/core/condition-variable.hh>
+#include <seastar/core/gate.hh>
+#include <seastar/core/temporary_buffer.hh>
+
+#include <filesystem>
+#include <vector>
+
+namespace experimental::io {
+
+class page_cache;
+class persistence;
+
+/**
+ * Cached view of a single file.
+ *
+ * A pager serves reads for a file from a shared page cache. On a miss the page
+ * is read from the backing file through the scheduler, which also bounds the
+ * number of open file handles across all pagers on a core. Resident pages are
+ * inserted into the page cache, and may be evicted at any time they are not
+ * pinned by I/O.
+ *
+ * The owner of the file may also populate the pager with data it has written
+ * to the file through some other path (see `populate`). This keeps recently
+ * written, and most likely to be read, pages resident without requiring them
+ * to be read back from disk.
+ *
+ * A pager must be closed before it is destroyed.
+ */
+class pager {
+public:
+    /// Fixed page size used by all pagers.
+    static constexpr size_t page_size = 4096;
+
+    /**
+     * Construct a pager for the file at \p path.
+     *
+     * The pager's scheduler queue is registered with \p scheduler, and
+     * resident pages are tracked by \p cache. Both must outlive the pager.
+     */
+    pager(
+      std::filesystem::path path,
+      persistence* storage,
+      page_cache* cache,
+      scheduler* scheduler);
+
+    pager(const pager&) = delete;
+    pager& operator=(const pager&) = delete;
+    pager(pager&&) noexcept = delete;
+    pager& operator=(pager&&) noexcept = delete;
+    ~pager() noexcept;
+
+    /**
+     * Wait for pending reads and release all resources.
+     */
+    seastar::future<> close() noexcept;
+
+    /**
+     * Read \p size bytes starting at \p offset.
+     *
+     * The returned buffers are shares of the underlying pages, and are
+     * contiguous in the order returned. The caller is responsible for not
+     * reading beyond the durable size of the backing file.
+     */
+    seastar::future<std::vector<seastar::temporary_buffer<char>>>
+    read(uint64_t offset, size_t size);
+
+    /**
+     * Copy \p size bytes of \p data into cached pages at \p offset.
+     *
+     * The data is expected to also have been, or be in the process of being,
+     * written to the backing file at the same offset. Pages that are not
+     * resident are only created if the write covers the start of the page;
+     * other pages are left to be read from disk on demand.
+     */
+    void populate(uint64_t offset, const char* data, size_t size) noexcept;
+
+    /**
+     * Drop cached pages that lie entirely beyond \p size.
+     */
+    void truncate(uint64_t size) noexcept;
+
+    /**
+     * Pager statistics.
+     */
+    struct stats {
+        /// Pages found resident when read.
+        size_t hits{0};
+        /// Pages that needed to be read from the backing file.
+        size_t misses{0};
+        /// Misses on pages that were still on the ghost queue.
+        size_t ghost_hits{0};
+    };
+
+    /**
+     * Return the pager statistics.
+     */
+    [[nodiscard]] const stats& get_stats() const noexcept;
+
+private:
+    seastar::future<seastar::lw_shared_ptr<page>> get_page(uint64_t offset);
+    void submit_read(page&) noexcept;
+    void complete(page&) noexcept;
+    void erase(page_set::const_iterator) noexcept;
+
+    page_cache* cache_;
+    scheduler* scheduler_;
+    scheduler::queue queue_;
+    page_set pages_;
+    stats stats_;
+
+    /*
+     * readers waiting on a page to be read wait on this condition variable,
+     * which is broadcast on each read completion.
+     */
+    seastar::condition_variable cond_;
+    seastar::gate gate_;
+    bool closed_{false};
+};
+
+} // namespace experimental::io
@@ -0,0 +1,176 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "io/page_cache.h"
+#include "io/pager.h"
+#include "io/scheduler.h"
+#include "io/tests/common.h"
+#include "test_utils/test.h"
+
+#include <seastar/core/when_all.hh>
+
+#include <gtest/gtest.h>
+
+namespace io = experimental::io;
+
+namespace {
+std::string
+flatten(const std::vector<seastar::temporary_buffer<char>>& buffers) {
+    std::string ret;
+    for (const auto& buf : buffers) {
+        ret.append(buf.get(), buf.size());
+    }
+    return ret;
+}
+} // namespace
+
+class PagerTest : public StorageTest {
+public:
+    static constexpr auto page_size = io::pager::page_size;
+    static constexpr size_t num_pages = 8;
+
+    void SetUp() override {
+        StorageTest::SetUp();
+        data_ = make_random_data(num_pages * page_size, page_size).get();
+        auto file = storage()->create(path_).get();
+        file->dma_write(0, data_.get(), data_.size()).get();
+        file->close().get();
+    }
+
+    std::unique_ptr<io::pager> make_pager(size_t cache_pages) {
+        cache_ = std::make_unique<io::page_cache>(io::page_cache::config{
+          .cache_size = cache_pages * page_size, .small_size = page_size});
+        return std::make_unique<io::pager>(
+          path_, storage(), cache_.get(), &scheduler_);
+    }
+
+    [[nodiscard]] std::string expected(size_t offset, size_t size) const {
+        return {data_.get() + offset, size};
+    }
+
+    io::page_cache* cache() { return cache_.get(); }
+
+private:
+    [[nodiscard]] bool disk_persistence() const override { return false; }
+
+    std::filesystem::path path_{"pager_test_file"};
+    seastar::temporary_buffer<char> data_;
+    io::scheduler scheduler_{10};
+    std::unique_ptr<io::page_cache> cache_;
+};
+
+TEST_F(PagerTest, Read) {
+    auto pager = make_pager(num_pages * 2);
+
+    // unaligned read spanning multiple pages
+    auto res = pager->read(100, 3 * page_size).get();
+    EXPECT_EQ(flatten(res), expected(100, 3 * page_size));
+    EXPECT_EQ(pager->get_stats().misses, 4);
+    EXPECT_EQ(pager->get_stats().hits, 0);
+
+    // second read is served from memory
+    res = pager->read(100, 3 * page_size).get();
+    EXPECT_EQ(flatten(res), expected(100, 3 * page_size));
+    EXPECT_EQ(pager->get_stats().misses, 4);
+    EXPECT_EQ(pager->get_stats().hits, 4);
+
+    pager->close().get();
+}
+
+TEST_F(PagerTest, ConcurrentReadsSamePage) {
+    auto pager = make_pager(num_pages * 2);
+
+    auto f0 = pager->read(0, 10);
+    auto f1 = pager->read(20, 10);
+    auto [r0, r1] = seastar::when_all_succeed(std::move(f0), std::move(f1))
+                      .get();
+    EXPECT_EQ(flatten(r0), expected(0, 10));
+    EXPECT_EQ(flatten(r1), expected(20, 10));
+    EXPECT_EQ(pager->get_stats().misses, 1);
+
+    pager->close().get();
+}
+
+TEST_F(PagerTest, Eviction) {
+    auto pager = make_pager(2);
+
+    // scan exceeds the cache capacity
+    for (size_t i = 0; i < num_pages; ++i) {
+        auto res = pager->read(i * page_size, page_size).get();
+        EXPECT_EQ(flatten(res), expected(i * page_size, page_size));
+    }
+    EXPECT_EQ(pager->get_stats().misses, num_pages);
+    auto stat = cache()->stat();
+    EXPECT_LE(stat.small_queue_size + stat.main_queue_size, 3 * page_size);
+
+    // the first page was evicted and has to be read again
+    auto res = pager->read(0, page_size).get();
+    EXPECT_EQ(flatten(res), expected(0, page_size));
+    EXPECT_EQ(pager->get_stats().misses, num_pages + 1);
+
+    pager->close().get();
+}
+
+TEST_F(PagerTest, Populate) {
+    auto pager = make_pager(num_pages * 2);
+
+    // data beyond the end of the file is only available from memory
+    std::string tail(page_size + 100, 'x');
+    pager->populate(num_pages * page_size, tail.data(), tail.size());
+
+    auto res = pager->read(num_pages * page_size, tail.size()).get();
+    EXPECT_EQ(flatten(res), tail);
+    EXPECT_EQ(pager->get_stats().misses, 0);
+
+    // appending to a resident page extends it in place
+    std::string more(50, 'y');
+    pager->populate(
+      num_pages * page_size + tail.size(), more.data(), more.size());
+    res = pager->read(num_pages * page_size, tail.size() + more.size()).get();
+    EXPECT_EQ(flatten(res), tail + more);
+    EXPECT_EQ(pager->get_stats().misses, 0);
+
+    pager->close().get();
+}
+
+TEST_F(PagerTest, PopulateUnalignedMissingPage) {
+    auto pager = make_pager(num_pages * 2);
+
+    // the page isn't resident and the write doesn't cover its start
+    std::string data(10, 'x');
+    pager->populate(page_size + 10, data.data(), data.size());
+
+    // so it's read from the backing file
+    auto res = pager->read(page_size, 10).get();
+    EXPECT_EQ(flatten(res), expected(page_size, 10));
+    EXPECT_EQ(pager->get_stats().misses, 1);
+
+    pager->close().get();
+}
+
+TEST_F(PagerTest, Truncate) {
+    auto pager = make_pager(num_pages * 2);
+
+    // cached contents that differ from the backing file
+    std::string data(2 * page_size, 'x');
+    pager->populate(0, data.data(), data.size());
+    auto res = pager->read(0, data.size()).get();
+    EXPECT_EQ(flatten(res), data);
+
+    // the first page is kept, the second is dropped
+    pager->truncate(10);
+    res = pager->read(0, data.size()).get();
+    EXPECT_EQ(
+      flatten(res),
+      data.substr(0, page_size) + expected(page_size, page_size));
+    EXPECT_EQ(pager->get_stats().misses, 1);
+
+    pager->close().get();
+}
@@ -118,36 +118,77 @@ ss::future<> client::stop() noexcept {
 
 ss::future<> client::update_metadata(wait_or_start::tag) {
     return ss::try_with_gate(_gate, [this]() {
-        vlog(kclog.debug, "{}updating metadata", *this);
-        return _brokers.any()
-          .then([this](shared_broker_t broker) {
-              return broker->dispatch(metadata_request{.list_all_topics = true})
-                .then([this](metadata_response res) {
-                    // Create new seeds from the returned set of brokers if
-                    // they're not empty
-                    if (!res.data.brokers.empty()) {
-                        std::vector<net::unresolved_address> seeds;
-                        seeds.reserve(res.data.brokers.size());
-                        for (const auto& b : res.data.brokers) {
-                            seeds.emplace_back(b.host, b.port);
-                        }
-                        std::swap(_seeds, seeds);
-                    }
-
-                    return apply(std::move(res));
-                })
-                .finally(
-                  [this]() { vlog(kclog.trace, "{}updated metadata", *this); });
-          })
+        // Topics that became stale while a request was in flight are waited
+        // for by the same callers, update them before returning.
+        return ss::repeat([this]() {
+                   return do_update_metadata().then([this]() {
+                       return _full_metadata_refresh || !_stale_topics.empty()
+                                ? ss::stop_iteration::no
+                                : ss::stop_iteration::yes;
+                   });
+               })
           .handle_exception_type(
             [this](const broker_error&) { return connect(); });
     });
 }
 
-ss::future<> client::apply(metadata_response res) {
+ss::future<> client::do_update_metadata() {
+    const bool all_topics = std::exchange(_full_metadata_refresh, false);
+    auto stale = std::exchange(_stale_topics, {});
+    metadata_request req;
+    if (all_topics) {
+        vlog(kclog.debug, "{}updating metadata", *this);
+        req.list_all_topics = true;
+    } else {
+        vlog(
+          kclog.debug,
+          "{}updating metadata of {} topics",
+          *this,
+          stale.size());
+        auto& topics = req.data.topics.emplace();
+        topics.reserve(stale.size());
+        for (auto& t : stale) {
+            topics.push_back(metadata_request_topic{t});
+        }
+        req.data.allow_auto_topic_creation = false;
+    }
+    return _brokers.any().then(
+      [this, all_topics, req{std::move(req)}](shared_broker_t broker) mutable {
+          return broker->dispatch(std::move(req))
+            .then([this, all_topics](metadata_response res) {
+                // Create new seeds from the returned set of brokers if
+                // they're not empty
+                if (!res.data.brokers.empty()) {
+                    std::vector<net::unresolved_address> seeds;
+                    seeds.reserve(res.data.brokers.size());
+                    for (const auto& b : res.data.brokers) {
+                        seeds.emplace_back(b.host, b.port);
+                    }
+                    std::swap(_seeds, seeds);
+                }
+
+                return apply(std::move(res), all_topics);
+            })
+            .finally(
+              [this]() { vlog(kclog.trace, "{}updated metadata", *this); });
+      });
+}
+
+ss::future<> client::refresh_topics(std::vector<model::topic> topics) {
+    for (auto& t : topics) {
+        _stale_topics.insert(std::move(t));
+    }
+    return _wait_or_start_update_metadata();
+}
+
+ss::future<> client::apply(metadata_response res, bool all_topics) {
     try {
         co_await _brokers.apply(std::move(res.data.brokers));
-        co_await _topic_cache.apply(std::move(res.data.topics));
+        if (all_topics) {
+            co_await _topic_cache.apply(std::move(res.data.topics));
+        } else {
+            co_await _topic_cache.merge(std::move(res.data.topics));
+        }
         _controller = res.data.controller_id;
     } catch (const std::exception& ex) {
         vlog(kclog.debug, "{}Failed to apply metadata request: {}", *this, ex);
@@ -171,9 +212,9 @@ ss::future<> client::mitigate_error(std::exception_ptr ex) {
                   return _wait_or_start_update_metadata();
               } else {
                   vlog(kclog.debug, "{}broker_error: {}", *this, ex);
-                  return _brokers.erase(ex.node_id).then([this]() {
-                      return _wait_or_start_update_metadata();
-                  });
+                  // The leaders of any topic may have moved off the broker
+                  return _brokers.erase(ex.node_id).then(
+                    [this]() { return update_metadata(); });
               }
           } catch (const consumer_error& ex) {
               switch (ex.error) {
@@ -190,7 +231,7 @@ ss::future<> client::mitigate_error(std::exception_ptr ex) {
               case error_code::not_leader_for_partition:
               case error_code::leader_not_available: {
                   vlog(kclog.debug, "{}partition_error: {}", *this, ex);
-                  return _wait_or_start_update_metadata();
+                  return refresh_topics({ex.tp.topic});
               }
               default:
                   vlog(kclog.warn, "{}partition_error: {}", *this, ex);
@@ -200,7 +241,7 @@ ss::future<> client::mitigate_error(std::exception_ptr ex) {
               switch (ex.error) {
               case error_code::unknown_topic_or_partition:
                   vlog(kclog.debug, "{}topic_error: {}", *this, ex);
-                  return _wait_or_start_update_metadata();
+                  return refresh_topics({ex.topic});
               default:
                   vlog(kclog.warn, "{}topic_error: {}", *this, ex);
                   return ss::make_exception_future(ex);
@@ -210,7 +251,7 @@ ss::future<> client::mitigate_error(std::exception_ptr ex) {
           } catch (const std::system_error& ex) {
               if (net::is_reconnect_error(ex)) {
                   vlog(kclog.debug, "{}system_error: {}", *this, ex);
-                  return _wait_or_start_update_metadata();
+                  return update_metadata();
               } else {
                   vlog(kclog.warn, "{}system_error: {}", *this, ex);
                   return ss::make_exception_future(ex);
@@ -238,13 +279,20 @@ ss::future<produce_response::partition> client::produce_record_batch(
 }
 
 ss::future<produce_response> client::produce_records(
-  model::topic topic, std::vector<record_essence> records) {
+  model::topic topic,
+  std::vector<record_essence> records,
+  sticky_partition sticky) {
     absl::node_hash_map<model::partition_id, storage::record_batch_builder>
       partition_builders;
+    std::optional<model::partition_id> sticky_p_id;
 
     // Assign records to batches per topic_partition
     for (auto& record : records) {
         auto p_id = record.partition_id;
+        const bool keyless = !p_id && !record.key;
+        if (keyless && sticky_p_id) {
+            p_id = sticky_p_id;
+        }
         if (!p_id) {
             p_id = co_await gated_retry_with_mitigation([&, this]() {
                        return _topic_cache.partition_for(topic, record);
@@ -253,6 +301,9 @@ ss::future<produce_response> client::produce_records(
                 // partition
                 return model::partition_id{0};
             });
+            if (keyless && sticky) {
+                sticky_p_id = p_id;
+            }
         }
         auto it = partition_builders.find(*p_id);
         if (it == partition_builders.end()) {
@@ -544,18 +595,19 @@ ss::future<kafka::fetch_response> client::consumer_fetch(
                 max_bytes);
           })
           .then([this](kafka::fetch_response res) {
-              bool has_error = std::any_of(
-                res.data.topics.begin(),
-                res.data.topics.end(),
-                [](auto const& topics) {
-                    return std::any_of(
-                      topics.partitions.begin(),
-                      topics.partitions.end(),
-                      [](const auto& p) {
-                          return p.error_code != error_code::none;
-                      });
-                });
-              return (has_error ? _wait_or_start_update_metadata() : ss::now())
+              std::vector<model::topic> stale;
+              for (auto const& t : res.data.topics) {
+                  if (std::any_of(
+                        t.partitions.begin(),
+                        t.partitions.end(),
+                        [](const auto& p) {
+                            return p.error_code != error_code::none;
+                        })) {
+                      stale.push_back(t.name);
+                  }
+              }
+              return (stale.empty() ? ss::now()
+                                    : refresh_topics(std::move(stale)))
                 .then(
                   [res{std::move(res)}]() mutable { return std::move(res); });
           });
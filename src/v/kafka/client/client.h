@@ -31,6 +31,7 @@
 #include "utils/retry.h"
 
 #include <seastar/core/condition-variable.hh>
+#include <seastar/util/bool_class.hh>
 
 #include <absl/container/flat_hash_map.h>
 #include <absl/container/flat_hash_set.h>
@@ -116,8 +117,18 @@ public:
     ss::future<produce_response::partition> produce_record_batch(
       model::topic_partition tp, model::record_batch&& batch);
 
-    ss::future<produce_response>
-    produce_records(model::topic topic, std::vector<record_essence> batch);
+    using sticky_partition = ss::bool_class<struct sticky_partition_tag>;
+
+    /// \brief Produce the records, building one batch per partition.
+    ///
+    /// With sticky_partition::yes all records without a key or a partition
+    /// go to the partition picked for the first of them, so that they end up
+    /// in a single large batch, which also compresses better, instead of
+    /// being spread in small batches over all partitions.
+    ss::future<produce_response> produce_records(
+      model::topic topic,
+      std::vector<record_essence> batch,
+      sticky_partition sticky = sticky_partition::no);
 
     ss::future<list_offsets_response> list_offsets(model::topic_partition tp);
 
@@ -162,7 +173,11 @@ public:
       std::optional<std::chrono::milliseconds> timeout,
       std::optional<int32_t> max_bytes);
 
-    ss::future<> update_metadata() { return _wait_or_start_update_metadata(); }
+    /// \brief Update the metadata of all topics
+    ss::future<> update_metadata() {
+        _full_metadata_refresh = true;
+        return _wait_or_start_update_metadata();
+    }
 
     ss::future<bool> is_connected() const {
         return _brokers.empty().then(std::logical_not<>());
@@ -185,12 +200,26 @@ private:
     /// Uses round-robin load-balancing strategy.
     ss::future<> update_metadata(wait_or_start::tag);
 
+    /// \brief Dispatch a single metadata request, for all topics if a full
+    /// refresh is pending, otherwise for the stale topics only.
+    ss::future<> do_update_metadata();
+
+    /// \brief Update the metadata of the given topics
+    ///
+    /// The topics are added to those of the pending update, or of the next
+    /// one if an update is in flight, so that concurrent triggers share a
+    /// request. Without topics, only the brokers and controller are updated.
+    ss::future<> refresh_topics(std::vector<model::topic> topics);
+
     /// \brief Handle errors by performing an action that may fix the cause of
     /// the error
     ss::future<> mitigate_error(std::exception_ptr ex);
 
     /// \brief Apply metadata update
-    ss::future<> apply(metadata_response res);
+    ///
+    /// The topics of the response replace the cache if it lists all of them,
+    /// otherwise they are merged into it.
+    ss::future<> apply(metadata_response res, bool all_topics = true);
 
     /// \brief Log the client ID if it exists, otherwise don't log
     friend std::ostream& operator<<(std::ostream& os, client const& c) {
@@ -212,6 +241,10 @@ private:
     model::node_id _controller{unknown_node_id};
     /// \brief Update metadata, or wait for an existing one.
     wait_or_start _wait_or_start_update_metadata;
+    /// \brief Whether the next metadata update lists all topics.
+    bool _full_metadata_refresh{false};
+    /// \brief Topics to update with the next metadata update.
+    absl::flat_hash_set<model::topic> _stale_topics;
     /// \brief Batching producer.
     producer _producer;
     /// \brief Consumers
@@ -137,6 +137,13 @@ configuration::configuration()
       "Interval (in milliseconds) for consumer heartbeats",
       {},
       500ms)
+  , consumer_prefetch(
+      *this,
+      "consumer_prefetch",
+      "Fetch the next response in the background once a consumer fetch "
+      "returns, so that it's ready for the next consumer fetch",
+      {},
+      true)
   , sasl_mechanism(
       *this,
       "sasl_mechanism",
@@ -43,6 +43,7 @@ struct configuration final : public config::config_store {
     config::property<std::chrono::milliseconds> consumer_session_timeout;
     config::property<std::chrono::milliseconds> consumer_rebalance_timeout;
     config::property<std::chrono::milliseconds> consumer_heartbeat_interval;
+    config::property<bool> consumer_prefetch;
 
     config::property<ss::sstring> sasl_mechanism;
     config::property<ss::sstring> scram_username;
@@ -130,6 +130,7 @@ void consumer::start() {
 
 ss::future<> consumer::stop() {
     vlog(kclog.info, "Consumer: {}: stop", *this);
+    discard_prefetch();
     // Clear the timer callbacks as they may hold a shared_from_this().
     _heartbeat_timer.cancel();
     _heartbeat_timer.set_callback([]() {});
@@ -154,6 +155,7 @@ ss::future<> consumer::initialize() {
 
 ss::future<> consumer::join() {
     _heartbeat_timer.cancel();
+    discard_prefetch();
     auto req_builder = [me{shared_from_this()}]() {
         const auto& cfg = me->_config;
         join_group_request req{};
@@ -314,6 +316,7 @@ ss::future<> consumer::sync() {
                     _member_id = no_member;
                     return join();
                 case error_code::none:
+                    discard_prefetch();
                     _assignment = _plan->decode(res.data.assignment);
                     return ss::now();
                 default:
@@ -409,26 +412,90 @@ consumer::offset_commit(std::vector<offset_commit_request_topic> topics) {
     co_return co_await req_res(std::move(req_builder));
 }
 
-ss::future<fetch_response>
+ss::future<consumer::broker_res_t>
 consumer::dispatch_fetch(broker_reqs_t::value_type br) {
     auto& [broker, req] = br;
     vlog(kclog.trace, "Consumer: {}, fetch_req: {}", *this, req);
-    auto res = co_await broker->dispatch(std::move(req));
+    fetch_response res;
+    try {
+        res = co_await broker->dispatch(std::move(req));
+    } catch (...) {
+        // The broker may or may not have the offsets that the fetch sent
+        _fetch_sessions[broker].reset();
+        throw;
+    }
     vlog(kclog.trace, "Consumer: {}, fetch_res: {}", *this, res);
 
     if (res.data.error_code != error_code::none) {
+        if (
+          res.data.error_code == error_code::fetch_session_id_not_found
+          || res.data.error_code == error_code::invalid_fetch_session_epoch) {
+            // The next fetch establishes a new session
+            _fetch_sessions[broker].reset();
+        }
         throw broker_error(broker->id(), res.data.error_code);
     }
 
-    _fetch_sessions[broker].apply(res);
-    co_return res;
+    co_return broker_res_t{std::move(broker), std::move(res)};
+}
+
+fetch_response consumer::apply_fetch(fetch_results_t results) {
+    fetch_response res{
+      .data = {
+        .throttle_time_ms{},
+        .error_code = error_code::none,
+        .session_id = kafka::invalid_fetch_session_id}};
+    for (auto& [broker, b_res] : results) {
+        _fetch_sessions[broker].apply(b_res);
+        res = detail::reduce_fetch_response(std::move(res), std::move(b_res));
+    }
+    return res;
+}
+
+void consumer::discard_prefetch() {
+    if (!_prefetch) {
+        return;
+    }
+    auto prefetch = std::move(*_prefetch);
+    _prefetch.reset();
+    ssx::background = std::move(prefetch).discard_result().handle_exception(
+      [](const std::exception_ptr&) {});
+    // The brokers have moved on to the epoch after the prefetch
+    for (auto& [broker, session] : _fetch_sessions) {
+        session.reset();
+    }
 }
 
 ss::future<fetch_response> consumer::fetch(
   std::chrono::milliseconds timeout, std::optional<int32_t> max_bytes) {
     refresh_inactivity_timer();
+    fetch_results_t results;
+    if (_prefetch) {
+        // A prefetched response was requested with the timeout and max_bytes
+        // of the previous fetch
+        auto prefetch = std::move(*_prefetch);
+        _prefetch.reset();
+        results = co_await std::move(prefetch);
+    } else {
+        results = co_await do_fetch(timeout, max_bytes);
+    }
+    auto res = apply_fetch(std::move(results));
+    if (_config.consumer_prefetch()) {
+        _prefetch = ss::try_with_gate(_gate, [this, timeout, max_bytes] {
+            return do_fetch(timeout, max_bytes);
+        });
+    }
+    co_return res;
+}
+
+ss::future<consumer::fetch_results_t> consumer::do_fetch(
+  std::chrono::milliseconds timeout, std::optional<int32_t> max_bytes) {
     // Split requests by broker
     broker_reqs_t broker_reqs;
+    absl::node_hash_map<
+      shared_broker_t,
+      absl::flat_hash_set<model::topic_partition>>
+      broker_tps;
     for (auto const& [t, ps] : _assignment) {
         for (const auto& p : ps) {
             auto tp = model::topic_partition{t, p};
@@ -452,6 +519,14 @@ ss::future<fetch_response> consumer::fetch(
                               .session_epoch = session.epoch(),
                             }})
                           .first->second;
+            broker_tps[broker].insert(tp);
+
+            // The broker fetches the partitions of an incremental fetch that
+            // aren't listed from where they were
+            if (!session.needs_fetch(tp)) {
+                continue;
+            }
+            session.sent(tp);
 
             if (req.data.topics.empty() || req.data.topics.back().name != t) {
                 req.data.topics.push_back(fetch_request::topic{.name{t}});
@@ -465,6 +540,10 @@ ss::future<fetch_response> consumer::fetch(
                   _config.consumer_request_max_bytes)});
         }
     }
+    for (auto& [broker, req] : broker_reqs) {
+        req.data.forgotten = _fetch_sessions[broker].forget_except(
+          broker_tps[broker]);
+    }
 
     co_return co_await ss::map_reduce(
       std::make_move_iterator(broker_reqs.begin()),
@@ -472,10 +551,11 @@ ss::future<fetch_response> consumer::fetch(
       [this](broker_reqs_t::value_type br) {
           return dispatch_fetch(std::move(br));
       },
-      fetch_response{
-        .data
-        = {.throttle_time_ms{}, .error_code = error_code::none, .session_id = kafka::invalid_fetch_session_id}},
-      detail::reduce_fetch_response);
+      fetch_results_t{},
+      [](fetch_results_t acc, broker_res_t res) {
+          acc.push_back(std::move(res));
+          return acc;
+      });
 }
 
 template<typename request_factory>
@@ -37,6 +37,8 @@ namespace kafka::client {
 class consumer final : public ss::enable_lw_shared_from_this<consumer> {
     using assignment_t = assignment;
     using broker_reqs_t = absl::node_hash_map<shared_broker_t, fetch_request>;
+    using broker_res_t = std::pair<shared_broker_t, fetch_response>;
+    using fetch_results_t = std::vector<broker_res_t>;
 
 public:
     /// \brief Construct a consumer
@@ -99,7 +101,13 @@ private:
 
     ss::future<describe_groups_response> describe_group();
 
-    ss::future<fetch_response> dispatch_fetch(broker_reqs_t::value_type br);
+    ss::future<fetch_results_t> do_fetch(
+      std::chrono::milliseconds timeout, std::optional<int32_t> max_bytes);
+    ss::future<broker_res_t> dispatch_fetch(broker_reqs_t::value_type br);
+    /// \brief Advance the fetch sessions past the responses, and merge them.
+    fetch_response apply_fetch(fetch_results_t results);
+    /// \brief Drop the prefetched response, the sessions don't include it.
+    void discard_prefetch();
 
     template<typename RequestFactory>
     ss::future<
@@ -171,6 +179,9 @@ private:
     std::unique_ptr<assignment_plan> _plan{};
     assignment_t _assignment{};
     absl::node_hash_map<shared_broker_t, fetch_session> _fetch_sessions;
+    // The fetch that follows the last one returned, not yet applied to the
+    // fetch sessions
+    std::optional<ss::future<fetch_results_t>> _prefetch;
     ss::noncopyable_function<void(const kafka::member_id&)> _on_stopped;
     ss::noncopyable_function<ss::future<>(std::exception_ptr)>
       _external_mitigate;
@@ -14,6 +14,7 @@
 
 #include <fmt/ostream.h>
 
+#include <algorithm>
 #include <iostream>
 
 namespace kafka::client {
@@ -30,6 +31,45 @@ model::offset fetch_session::offset(model::topic_partition_view tpv) const {
     return part_it->second;
 }
 
+void fetch_session::reset() {
+    _id = invalid_fetch_session_id;
+    _epoch = initial_fetch_session_epoch;
+    _sent.clear();
+}
+
+bool fetch_session::needs_fetch(model::topic_partition_view tpv) const {
+    if (_id == invalid_fetch_session_id) {
+        return true;
+    }
+    auto it = _sent.find(model::topic_partition(tpv));
+    return it == _sent.end() || it->second != offset(tpv);
+}
+
+void fetch_session::sent(model::topic_partition_view tpv) {
+    _sent.insert_or_assign(model::topic_partition(tpv), offset(tpv));
+}
+
+std::vector<forgotten_topic> fetch_session::forget_except(
+  const absl::flat_hash_set<model::topic_partition>& tps) {
+    std::vector<forgotten_topic> res;
+    for (auto it = _sent.begin(); it != _sent.end();) {
+        if (tps.contains(it->first)) {
+            ++it;
+            continue;
+        }
+        const auto& [topic, p_id] = it->first;
+        auto t_it = std::find_if(res.begin(), res.end(), [&topic](auto& t) {
+            return t.name == topic;
+        });
+        if (t_it == res.end()) {
+            t_it = res.insert(res.end(), forgotten_topic{.name = topic});
+        }
+        t_it->forgotten_partition_indexes.push_back(p_id());
+        _sent.erase(it++);
+    }
+    return res;
+}
+
 bool fetch_session::apply(fetch_response& res) {
     if (_id == invalid_fetch_session_id) {
         _id = fetch_session_id{res.data.session_id};
@@ -15,17 +15,24 @@
 #include "kafka/types.h"
 #include "model/fundamental.h"
 
+#include <absl/container/flat_hash_set.h>
 #include <absl/container/node_hash_map.h>
 
 #include <iosfwd>
 
 namespace kafka {
 struct fetch_response;
+struct forgotten_topic;
 }
 
 namespace kafka::client {
 
 /// \brief Maintain state for consumer group fetch session.
+///
+/// Once the broker has established the session, a fetch is incremental: it
+/// only lists the partitions whose fetch offset changed since they were last
+/// sent, the broker keeps fetching the others from where they were, and
+/// forgets the partitions that are no longer fetched from it.
 class fetch_session {
 public:
     fetch_session() = default;
@@ -36,10 +43,20 @@ public:
     ~fetch_session() = default;
 
     void reset_offsets() { _offsets.clear(); }
+    /// \brief Start a new session, with a full fetch.
+    void reset();
     kafka::fetch_session_id id() const { return _id; }
     void id(kafka::fetch_session_id id) { _id = id; }
     kafka::fetch_session_epoch epoch() const { return _epoch; }
     model::offset offset(model::topic_partition_view tpv) const;
+    /// \brief Whether the partition must be listed in the next fetch.
+    bool needs_fetch(model::topic_partition_view tpv) const;
+    /// \brief Record that the partition is listed in the next fetch.
+    void sent(model::topic_partition_view tpv);
+    /// \brief Drop the partitions that were sent but aren't in tps, and
+    /// return them to be forgotten by the broker.
+    std::vector<forgotten_topic>
+    forget_except(const absl::flat_hash_set<model::topic_partition>& tps);
     bool apply(fetch_response& res);
     std::vector<kafka::offset_commit_request_topic>
     make_offset_commit_request() const;
@@ -53,6 +70,8 @@ private:
       model::topic,
       absl::node_hash_map<model::partition_id, model::offset>>
       _offsets;
+    // The fetch offsets the broker has for the session
+    absl::node_hash_map<model::topic_partition, model::offset> _sent;
 };
 
 } // namespace kafka::client
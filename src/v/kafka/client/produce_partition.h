@@ -26,6 +26,11 @@
 namespace kafka::client {
 
 /// \brief Batch multiple client requests, flush them based on size or time.
+///
+/// A batch is sent once it reaches the size thresholds, or once its first
+/// record has lingered for produce_batch_delay, whichever comes first. One
+/// batch is in flight at a time, the next one accumulates meanwhile and is
+/// sent as soon as the response arrives if it is due by then.
 class produce_partition {
 public:
     using response = produce_batcher::partition_response;
@@ -40,6 +45,9 @@ public:
       , _consumer{std::move(c)} {}
 
     ss::future<response> produce(model::record_batch&& batch) {
+        if (_record_count == 0) {
+            _first_record_at = ss::timer<>::clock::now();
+        }
         _record_count += batch.record_count();
         _size_bytes += batch.size_bytes();
         auto fut = _batcher.produce(std::move(batch));
@@ -100,22 +108,21 @@ private:
 
     /// \brief Arms the timer that starts the consumer
     ///
-    /// Will arm the timer only if the consumer can run and then sets the timer
-    /// delay depending on whether or not size thresholds have been met
+    /// Will arm the timer only if the consumer can run. The timer fires nearly
+    /// immediately if the size thresholds have been met, otherwise when the
+    /// first record of the batch has waited for the produce batch delay. More
+    /// records don't push that deadline back, so a steady stream of small
+    /// requests can't hold the batch back.
     void arm_consumer() {
         if (!consumer_can_run()) {
             return;
         }
 
-        std::chrono::milliseconds rearm_timer_delay{0};
-        // If the threshold is met, then use a delay of 0 so the timer fires
-        // nearly immediately after this call.  Otherwise use the produce
-        // batch delay when arming the timer.
-        if (!threshold_met()) {
-            rearm_timer_delay = _config.produce_batch_delay();
+        if (threshold_met()) {
+            _timer.rearm(ss::timer<>::clock::now());
+        } else if (!_timer.armed()) {
+            _timer.arm(_first_record_at + _config.produce_batch_delay());
         }
-        _timer.cancel();
-        _timer.arm(rearm_timer_delay);
     }
 
     /// \brief Validates that the size threshold has been met to trigger produce
@@ -139,6 +146,7 @@ private:
     consumer _consumer;
     int32_t _record_count{};
     int32_t _size_bytes{};
+    ss::timer<>::clock::time_point _first_record_at;
     bool _in_flight{};
     ss::gate _gate;
     std::optional<ss::promise<>> _await_in_flight;
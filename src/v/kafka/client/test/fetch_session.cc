@@ -156,3 +156,39 @@ SEASTAR_THREAD_TEST_CASE(test_fetch_session_make_offset_commit_request_all) {
       partition.committed_leader_epoch, kafka::invalid_leader_epoch);
     BOOST_REQUIRE_EQUAL(partition.committed_offset, ctx.expected_offset - 1);
 }
+
+SEASTAR_THREAD_TEST_CASE(test_fetch_session_incremental) {
+    context ctx;
+    kc::fetch_session s;
+    const model::topic_partition other{ctx.tp.topic, model::partition_id{3}};
+
+    // Everything is listed until the session is established
+    BOOST_REQUIRE(s.needs_fetch(ctx.tp));
+    s.sent(ctx.tp);
+    BOOST_REQUIRE(s.needs_fetch(ctx.tp));
+    s.sent(other);
+
+    // Only the partitions whose offset moved are listed afterwards
+    BOOST_REQUIRE(ctx.apply_fetch_response(s, 8));
+    BOOST_REQUIRE(s.needs_fetch(ctx.tp));
+    BOOST_REQUIRE(!s.needs_fetch(other));
+    s.sent(ctx.tp);
+    BOOST_REQUIRE(!s.needs_fetch(ctx.tp));
+
+    // A partition that isn't fetched anymore is forgotten, once
+    auto forgotten = s.forget_except({ctx.tp});
+    BOOST_REQUIRE_EQUAL(forgotten.size(), 1);
+    BOOST_REQUIRE_EQUAL(forgotten[0].name, other.topic);
+    BOOST_REQUIRE_EQUAL(forgotten[0].forgotten_partition_indexes.size(), 1);
+    BOOST_REQUIRE_EQUAL(
+      forgotten[0].forgotten_partition_indexes[0], other.partition());
+    BOOST_REQUIRE(s.forget_except({ctx.tp}).empty());
+    BOOST_REQUIRE(s.needs_fetch(other));
+
+    // A new session lists everything again, from the same offsets
+    s.reset();
+    BOOST_REQUIRE_EQUAL(s.id(), kafka::invalid_fetch_session_id);
+    BOOST_REQUIRE_EQUAL(s.epoch(), kafka::initial_fetch_session_epoch);
+    BOOST_REQUIRE(s.needs_fetch(ctx.tp));
+    BOOST_REQUIRE_EQUAL(s.offset(ctx.tp), ctx.expected_offset);
+}
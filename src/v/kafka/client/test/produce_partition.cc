@@ -9,6 +9,7 @@
 
 #include "kafka/client/produce_partition.h"
 
+#include "base/units.h"
 #include "kafka/client/brokers.h"
 #include "kafka/client/configuration.h"
 #include "kafka/client/test/utils.h"
@@ -18,6 +19,7 @@
 #include "model/record.h"
 #include "test_utils/async.h"
 
+#include <seastar/core/sleep.hh>
 #include <seastar/testing/thread_test_case.hh>
 
 #include <boost/test/tools/old/interface.hpp>
@@ -75,3 +77,39 @@ SEASTAR_THREAD_TEST_CASE(test_produce_partition_record_count) {
     BOOST_REQUIRE_EQUAL(c_res2.base_offset, model::offset{3});
     producer.stop().get();
 }
+
+SEASTAR_THREAD_TEST_CASE(test_produce_partition_linger) {
+    std::vector<model::record_batch> consumed_batches;
+    auto consumer = [&consumed_batches](model::record_batch&& batch) {
+        consumed_batches.push_back(std::move(batch));
+    };
+
+    auto cfg = kc::configuration{};
+    // large
+    cfg.produce_batch_size_bytes.set_value(1_MiB);
+    cfg.produce_batch_record_count.set_value(1000);
+    // configuration under test
+    cfg.produce_batch_delay.set_value(50ms);
+
+    kc::produce_partition producer(cfg, consumer);
+
+    // A steady stream of records doesn't delay the batch past the linger of
+    // its first record
+    std::vector<ss::future<kc::produce_partition::response>> responses;
+    for (int i = 0; i < 40 && consumed_batches.empty(); ++i) {
+        responses.push_back(producer.produce(make_batch(model::offset(i), 1)));
+        ss::sleep(10ms).get();
+    }
+    BOOST_REQUIRE_EQUAL(consumed_batches.size(), 1);
+    BOOST_REQUIRE_LT(consumed_batches[0].record_count(), 40);
+
+    producer.handle_response(kafka::produce_response::partition{
+      .partition_index{model::partition_id{42}},
+      .error_code = kafka::error_code::none,
+      .base_offset{model::offset{0}}});
+    producer.stop().get();
+    BOOST_REQUIRE_EQUAL(consumed_batches.size(), 1);
+    for (auto& r : responses) {
+        BOOST_REQUIRE_EQUAL(r.get0().error_code, kafka::error_code::none);
+    }
+}
@@ -0,0 +1,83 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "kafka/client/topic_cache.h"
+
+#include "kafka/client/exceptions.h"
+#include "kafka/protocol/errors.h"
+#include "kafka/protocol/metadata.h"
+#include "model/fundamental.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+namespace k = kafka;
+namespace kc = k::client;
+
+namespace {
+
+k::metadata_response::topic make_topic(
+  model::topic name,
+  std::vector<model::node_id> leaders,
+  k::error_code ec = k::error_code::none) {
+    k::metadata_response::topic t{.error_code = ec, .name = std::move(name)};
+    for (size_t i = 0; i < leaders.size(); ++i) {
+        t.partitions.push_back(k::metadata_response::partition{
+          .partition_index = model::partition_id(i), .leader_id = leaders[i]});
+    }
+    return t;
+}
+
+small_fragment_vector<k::metadata_response::topic>
+topics(std::vector<k::metadata_response::topic> ts) {
+    small_fragment_vector<k::metadata_response::topic> res;
+    for (auto& t : ts) {
+        res.push_back(std::move(t));
+    }
+    return res;
+}
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(test_topic_cache_merge) {
+    const model::topic a{"a"};
+    const model::topic b{"b"};
+    const model::topic c{"c"};
+    const model::node_id n0{0};
+    const model::node_id n1{1};
+
+    kc::topic_cache cache;
+    cache.apply(topics({make_topic(a, {n0, n0}), make_topic(b, {n0})})).get();
+
+    auto leader = [&cache](const model::topic& t, int p) {
+        return cache.leader({t, model::partition_id(p)}).get();
+    };
+
+    // Only the topics of the response change
+    cache.merge(topics({make_topic(a, {n0, n1}), make_topic(c, {n1})})).get();
+    BOOST_REQUIRE_EQUAL(leader(a, 0), n0);
+    BOOST_REQUIRE_EQUAL(leader(a, 1), n1);
+    BOOST_REQUIRE_EQUAL(leader(b, 0), n0);
+    BOOST_REQUIRE_EQUAL(leader(c, 0), n1);
+
+    // A topic with an error keeps its metadata, an unknown one is removed
+    cache
+      .merge(topics(
+        {make_topic(a, {}, k::error_code::leader_not_available),
+         make_topic(b, {}, k::error_code::unknown_topic_or_partition)}))
+      .get();
+    BOOST_REQUIRE_EQUAL(leader(a, 1), n1);
+    BOOST_REQUIRE(!cache.contains(b));
+    BOOST_REQUIRE_THROW(leader(b, 0), kc::partition_error);
+
+    // A full apply replaces the cache
+    cache.apply(topics({make_topic(b, {n1})})).get();
+    BOOST_REQUIRE(!cache.contains(a));
+    BOOST_REQUIRE(!cache.contains(c));
+    BOOST_REQUIRE_EQUAL(leader(b, 0), n1);
+}
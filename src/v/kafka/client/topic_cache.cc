@@ -44,6 +44,43 @@ topic_cache::apply(small_fragment_vector<metadata_response::topic>&& topics) {
     return ss::now();
 }
 
+ss::future<>
+topic_cache::merge(small_fragment_vector<metadata_response::topic>&& topics) {
+    for (const auto& t : topics) {
+        if (t.error_code == error_code::unknown_topic_or_partition) {
+            _topics.erase(t.name);
+            continue;
+        }
+        if (t.error_code != error_code::none) {
+            continue;
+        }
+        // Keep the partitioner of a topic whose partition count is unchanged
+        auto it = _topics.find(t.name);
+        if (
+          it == _topics.end()
+          || it->second.partitions.size() != t.partitions.size()) {
+            const auto initial_partition_id = model::partition_id{
+              random_generators::get_int<model::partition_id::type>(
+                t.partitions.size())};
+            it = _topics
+                   .insert_or_assign(
+                     t.name,
+                     topic_data{
+                       .partitioner_func = default_partitioner(
+                         initial_partition_id)})
+                   .first;
+        }
+        auto& parts = it->second.partitions;
+        parts.clear();
+        parts.reserve(t.partitions.size());
+        for (auto const& p : t.partitions) {
+            parts.emplace(
+              p.partition_index, partition_data{.leader = p.leader_id});
+        }
+    }
+    return ss::now();
+}
+
 ss::future<model::node_id>
 topic_cache::leader(model::topic_partition tp) const {
     if (auto topic_it = _topics.find(tp.topic); topic_it != _topics.end()) {
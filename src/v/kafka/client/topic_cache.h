@@ -50,6 +50,17 @@ public:
     ss::future<>
     apply(small_fragment_vector<metadata_response::topic>&& topics);
 
+    /// \brief Apply the metadata of some of the topics, leaving the others
+    /// as they are.
+    ///
+    /// A topic that is reported unknown is removed, one that reports another
+    /// error keeps its previous metadata.
+    ss::future<>
+    merge(small_fragment_vector<metadata_response::topic>&& topics);
+
+    /// \brief Whether the topic is in the cache
+    bool contains(model::topic_view tv) const { return _topics.contains(tv); }
+
     /// \brief Obtain the leader for the given topic-partition
     ss::future<model::node_id> leader(model::topic_partition tp) const;
 
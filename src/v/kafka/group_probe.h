@@ -90,6 +90,16 @@ private:
     metrics::public_metric_groups _public_metrics;
 };
 
+/// Lag of a group over the partitions it committed offsets for.
+struct group_consumer_lag {
+    // sum and maximum of the lag of the partitions whose high watermark is
+    // known on this broker
+    int64_t total{0};
+    int64_t max{0};
+    // partitions not replicated on this broker
+    size_t unknown_partitions{0};
+};
+
 template<typename KeyType, typename ValType>
 class group_probe {
     using member_map = absl::node_hash_map<kafka::member_id, member_ptr>;
@@ -101,10 +111,12 @@ public:
     explicit group_probe(
       member_map& members,
       static_member_map& static_members,
-      offsets_map& offsets) noexcept
+      offsets_map& offsets,
+      const group_consumer_lag& lag) noexcept
       : _members(members)
       , _static_members(static_members)
-      , _offsets(offsets) {}
+      , _offsets(offsets)
+      , _lag(lag) {}
 
     group_probe(const group_probe&) = delete;
     group_probe& operator=(const group_probe&) = delete;
@@ -123,27 +135,47 @@ public:
 
         std::vector<sm::label_instance> labels{group_label(group_id())};
 
-        _public_metrics.add_group(
-          prometheus_sanitize::metrics_name("kafka:consumer:group"),
-          {sm::make_gauge(
-             "consumers",
-             [this] { return _members.size(); },
-             sm::description("Number of consumers in a group"),
-             labels)
-             .aggregate({sm::shard_label}),
+        std::vector<sm::metric_definition> defs{
+          sm::make_gauge(
+            "consumers",
+            [this] { return _members.size(); },
+            sm::description("Number of consumers in a group"),
+            labels)
+            .aggregate({sm::shard_label}),
+
+          sm::make_gauge(
+            "topics",
+            [this] { return _offsets.size(); },
+            sm::description("Number of topics in a group"),
+            labels)
+            .aggregate({sm::shard_label})};
+
+        if (config::shard_local_cfg().group_consumer_lag_refresh_ms()) {
+            defs.push_back(
+              sm::make_gauge(
+                "lag_sum",
+                [this] { return _lag.total; },
+                sm::description("Sum of the lag of the partitions of a group"),
+                labels)
+                .aggregate({sm::shard_label}));
+            defs.push_back(
+              sm::make_gauge(
+                "lag_max",
+                [this] { return _lag.max; },
+                sm::description("Maximum lag of the partitions of a group"),
+                labels)
+                .aggregate({sm::shard_label}));
+        }
 
-           sm::make_gauge(
-             "topics",
-             [this] { return _offsets.size(); },
-             sm::description("Number of topics in a group"),
-             labels)
-             .aggregate({sm::shard_label})});
+        _public_metrics.add_group(
+          prometheus_sanitize::metrics_name("kafka:consumer:group"), defs);
     }
 
 private:
     member_map& _members;
     static_member_map& _static_members;
     offsets_map& _offsets;
+    const group_consumer_lag& _lag;
     metrics::public_metric_groups _public_metrics;
 };
 
@@ -59,6 +59,25 @@ public:
           {},
           {sm::shard_label});
 
+        _metrics.add_group(
+          prometheus_sanitize::metrics_name("kafka:produce"),
+          {
+            sm::make_counter(
+              "local_partition_writes",
+              [this] { return _produce_local_partitions; },
+              sm::description(
+                "Number of produced partitions owned by the shard serving "
+                "the connection")),
+            sm::make_counter(
+              "remote_partition_writes",
+              [this] { return _produce_remote_partitions; },
+              sm::description(
+                "Number of produced partitions dispatched to another shard "
+                "than the one serving the connection")),
+          },
+          {},
+          {sm::shard_label});
+
         auto add_plan_and_execute_metric =
           [this, &labels](const std::string& fetch_label, hist_t& hist) {
               auto fetch_labels = labels;
@@ -111,6 +130,14 @@ public:
         return _produce_latency.auto_measure();
     }
 
+    void record_produce_partition(bool local) {
+        if (local) {
+            ++_produce_local_partitions;
+        } else {
+            ++_produce_remote_partitions;
+        }
+    }
+
     void record_fetch_latency(std::chrono::microseconds micros) {
         _fetch_latency.record(micros.count());
     }
@@ -129,6 +156,8 @@ private:
     hist_t _fetch_latency;
     hist_t _fetch_plan_and_execute_latency;
     hist_t _fetch_plan_and_execute_latency_empty;
+    uint64_t _produce_local_partitions{0};
+    uint64_t _produce_remote_partitions{0};
     metrics::internal_metric_groups _metrics;
     metrics::public_metric_groups _public_metrics;
 };
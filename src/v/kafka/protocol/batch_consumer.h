@@ -84,9 +84,18 @@ public:
 
 private:
     void write_batch(model::record_batch&& batch) {
-        protocol::writer_serialize_batch(_wr, std::move(batch));
+        // large payloads are shared into the response rather than copied;
+        // small ones are still packed together to keep the fragment count of
+        // the response, and so the number of iovecs sent, low
+        if (batch.data().size_bytes() >= share_records_min_bytes) {
+            protocol::writer_serialize_batch_shared(_wr, std::move(batch));
+        } else {
+            protocol::writer_serialize_batch(_wr, std::move(batch));
+        }
     }
 
+    static constexpr size_t share_records_min_bytes = 4096;
+
 private:
     iobuf _buf;
     protocol::encoder _wr;
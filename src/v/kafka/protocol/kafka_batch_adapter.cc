@@ -112,11 +112,12 @@ void kafka_batch_adapter::verify_crc(int32_t expected_crc, iobuf_parser in) {
     in.skip(checksum_data_offset_start);
 
     // 2. consume & checksum the CRC
-    in.consume(in.bytes_left(), [&crc](const char* src, size_t n) {
-        // NOLINTNEXTLINE
-        crc.extend(reinterpret_cast<const uint8_t*>(src), n);
+    crc::fragment_crc32c fragments(crc);
+    in.consume(in.bytes_left(), [&fragments](const char* src, size_t n) {
+        fragments.extend(src, n);
         return ss::stop_iteration::no;
     });
+    fragments.flush();
 
     // the crc is calculated over the bytes we receive as a uint32_t, but the
     // crc arrives off the wire as a signed 32-bit value.
@@ -133,7 +134,63 @@ void kafka_batch_adapter::verify_crc(int32_t expected_crc, iobuf_parser in) {
     }
 }
 
-iobuf kafka_batch_adapter::adapt(iobuf&& kbatch) {
+namespace {
+// the smallest encoding of a record is a single byte for each of its length,
+// attributes, timestamp delta, offset delta, key length, value length and
+// header count
+constexpr size_t min_record_size_bytes = 7;
+
+bool valid_records(
+  const model::record_batch& batch,
+  kafka_batch_adapter::record_validation validation) {
+    using record_validation = kafka_batch_adapter::record_validation;
+    // compressed records are validated when they are decompressed
+    if (batch.compressed()) {
+        return true;
+    }
+    switch (validation) {
+    case record_validation::full:
+        try {
+            batch.for_each_record([](model::record r) { (void)r; });
+        } catch (const std::exception& e) {
+            vlog(klog.error, "Parsing uncompressed records: {}", e.what());
+            return false;
+        }
+        return true;
+    case record_validation::record_count: {
+        const auto& hdr = batch.header();
+        if (unlikely(
+              hdr.record_count <= 0
+              || hdr.last_offset_delta != hdr.record_count - 1
+              || static_cast<size_t>(hdr.record_count) * min_record_size_bytes
+                   > batch.data().size_bytes())) {
+            vlog(
+              klog.error,
+              "Invalid uncompressed batch of {} records, last offset delta {} "
+              "and {} bytes of records",
+              hdr.record_count,
+              hdr.last_offset_delta,
+              batch.data().size_bytes());
+            return false;
+        }
+        return true;
+    }
+    case record_validation::deferred:
+        return true;
+    }
+    __builtin_unreachable();
+}
+} // namespace
+
+bool kafka_batch_adapter::validate_records(record_validation validation) {
+    if (_validation_deferred && batch && !valid_records(*batch, validation)) {
+        batch.reset();
+    }
+    _validation_deferred = false;
+    return batch.has_value();
+}
+
+iobuf kafka_batch_adapter::adapt(iobuf&& kbatch, record_validation validation) {
     // The batch size given in the kafka header does not include the offset
     // preceeding the length field nor the size of the length field itself.
     constexpr size_t kafka_length_diff
@@ -180,19 +237,15 @@ iobuf kafka_batch_adapter::adapt(iobuf&& kbatch) {
       header, std::move(records), model::record_batch::tag_ctor_ng{});
 
     /**
-     * Perform some type of validation on the uncompressed input. In this case
-     * we make sure that the records can be materialized but we avoid
-     * re-encoding them using the lazy-record optimization.
+     * Perform some type of validation on the uncompressed input. In the full
+     * validation we make sure that the records can be materialized but we
+     * avoid re-encoding them using the lazy-record optimization.
      */
-    if (!new_batch.compressed()) {
-        try {
-            new_batch.for_each_record([](model::record r) { (void)r; });
-        } catch (const std::exception& e) {
-            vlog(klog.error, "Parsing uncompressed records: {}", e.what());
-            return remainder;
-        }
+    if (!valid_records(new_batch, validation)) {
+        return remainder;
     }
 
+    _validation_deferred = validation == record_validation::deferred;
     batch = std::move(new_batch);
     return remainder;
 }
@@ -274,9 +327,9 @@ void kafka_batch_adapter::convert_message_set(
 }
 
 void kafka_batch_adapter::adapt_with_version(
-  iobuf kbatch, api_version version) {
+  iobuf kbatch, api_version version, record_validation validation) {
     if (version >= api_version(3)) {
-        adapt(std::move(kbatch));
+        adapt(std::move(kbatch), validation);
         return;
     }
 
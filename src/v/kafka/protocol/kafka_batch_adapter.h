@@ -60,7 +60,18 @@ constexpr size_t kafka_header_size = sizeof(int64_t) + // base offset
  */
 class kafka_batch_adapter {
 public:
-    iobuf adapt(iobuf&&);
+    /// How the records of an uncompressed batch are validated.
+    enum class record_validation {
+        /// every record is parsed
+        full,
+        /// only the record count is checked against the last offset delta
+        /// and the size of the records
+        record_count,
+        /// validation is left to a later call to validate_records()
+        deferred,
+    };
+
+    iobuf adapt(iobuf&&, record_validation = record_validation::full);
 
     bool v2_format;
     bool valid_crc;
@@ -68,12 +79,21 @@ public:
 
     std::optional<model::record_batch> batch;
 
-    void adapt_with_version(iobuf, api_version);
+    void adapt_with_version(
+      iobuf, api_version, record_validation = record_validation::full);
+
+    /**
+     * Validate the records of a batch whose validation was deferred, and
+     * reset the batch if they are invalid. Returns whether there is a batch.
+     */
+    bool validate_records(record_validation);
 
 private:
     void verify_crc(int32_t, iobuf_parser);
     model::record_batch_header read_header(iobuf_parser&);
     void convert_message_set(storage::record_batch_builder&, iobuf, bool);
+
+    bool _validation_deferred{false};
 };
 
 /*
@@ -82,10 +102,15 @@ private:
  * types.
  */
 struct produce_request_record_data {
+    /// The records are validated by the produce handler, see
+    /// kafka_batch_adapter::validate_records().
     explicit produce_request_record_data(
       std::optional<iobuf>&& data, api_version version) {
         if (data) {
-            adapter.adapt_with_version(std::move(*data), version);
+            adapter.adapt_with_version(
+              std::move(*data),
+              version,
+              kafka_batch_adapter::record_validation::deferred);
         }
     }
 
@@ -223,3 +223,42 @@ SEASTAR_THREAD_TEST_CASE(batch_reader_record_batch_reader_impl_fail_magic) {
           return e.error == kafka::error_code::corrupt_message;
       });
 }
+
+SEASTAR_THREAD_TEST_CASE(shared_serialization_matches_copied) {
+    auto batches = model::test::make_random_batches(base_offset, many_batches);
+
+    iobuf copied;
+    iobuf shared;
+    kafka::protocol::encoder copied_wr(copied);
+    kafka::protocol::encoder shared_wr(shared);
+    for (auto& b : batches) {
+        kafka::protocol::writer_serialize_batch(copied_wr, b.copy());
+        kafka::protocol::writer_serialize_batch_shared(shared_wr, b.share());
+    }
+
+    BOOST_REQUIRE_EQUAL(copied, shared);
+}
+
+SEASTAR_THREAD_TEST_CASE(adapter_deferred_record_validation) {
+    using record_validation = kafka::kafka_batch_adapter::record_validation;
+    for (auto validation :
+         {record_validation::full, record_validation::record_count}) {
+        model::record_batch_reader::data_t input;
+        input.push_back(model::test::make_random_batch(base_offset, 10, false));
+        auto serialized = model::make_memory_record_batch_reader(
+                            std::move(input))
+                            .consume(
+                              kafka::kafka_batch_serializer{},
+                              model::no_timeout)
+                            .get();
+
+        kafka::kafka_batch_adapter kba;
+        auto remainder = kba.adapt(
+          std::move(serialized.data), record_validation::deferred);
+        BOOST_REQUIRE(remainder.empty());
+        BOOST_REQUIRE(kba.valid_crc);
+        BOOST_REQUIRE(kba.batch);
+        BOOST_REQUIRE(kba.validate_records(validation));
+        BOOST_REQUIRE_EQUAL(kba.batch->record_count(), 10);
+    }
+}
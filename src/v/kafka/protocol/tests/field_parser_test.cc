@@ -226,3 +226,68 @@ SEASTAR_THREAD_TEST_CASE(serde_flex_types) {
         BOOST_CHECK_EQUAL(iobuf_to_bytes(*result), iobuf_to_bytes(copy));
     }
 }
+
+SEASTAR_THREAD_TEST_CASE(borrowed_string_views) {
+    const ss::sstring short_str = "topic";
+    const ss::sstring long_str(256, 'x');
+
+    iobuf encoded;
+    kafka::protocol::encoder writer(encoded);
+    writer.write(short_str);
+    writer.write_flex(long_str);
+    writer.write(std::optional<ss::sstring>());
+    writer.write_flex(std::optional<ss::sstring>(short_str));
+
+    /// Split the buffer into small fragments so that some of the strings
+    /// span several of them
+    iobuf fragmented;
+    iobuf_const_parser parser(encoded);
+    while (parser.bytes_left() > 0) {
+        auto n = std::min<size_t>(parser.bytes_left(), 7);
+        auto b = parser.read_bytes(n);
+        fragmented.append(ss::temporary_buffer<char>(
+          reinterpret_cast<const char*>(b.data()), b.size()));
+    }
+    BOOST_REQUIRE_GT(std::distance(fragmented.begin(), fragmented.end()), 1);
+
+    kafka::protocol::decoder reader(std::move(fragmented));
+    BOOST_CHECK_EQUAL(reader.read_string_view(), short_str);
+    BOOST_CHECK_EQUAL(reader.read_flex_string_view(), long_str);
+    BOOST_CHECK(!reader.read_nullable_string_view());
+    auto v = reader.read_nullable_flex_string_view();
+    BOOST_REQUIRE(v.has_value());
+    BOOST_CHECK_EQUAL(*v, short_str);
+    BOOST_CHECK_EQUAL(reader.bytes_left(), 0);
+}
+
+SEASTAR_THREAD_TEST_CASE(record_sets_are_shared) {
+    auto large = random_generators::gen_alphanum_string(64 * 1024);
+    auto small = random_generators::gen_alphanum_string(100);
+    iobuf records;
+    records.append(ss::temporary_buffer<char>(large.data(), large.size()));
+    iobuf small_buf;
+    small_buf.append(small.data(), small.size());
+    records.append_fragments(std::move(small_buf));
+    const auto* large_data = records.begin()->get();
+    auto expected = records.copy();
+
+    iobuf out;
+    kafka::protocol::encoder writer(out);
+    writer.write(int32_t(1));
+    writer.write(std::optional<kafka::batch_reader>(
+      kafka::batch_reader(std::move(records))));
+    writer.write(int32_t(2));
+
+    /// The large fragment is referenced rather than copied ...
+    BOOST_REQUIRE(std::any_of(out.begin(), out.end(), [=](const auto& f) {
+        return f.get() == large_data;
+    }));
+
+    /// ... and the encoding is the one of the plain bytes
+    kafka::protocol::decoder reader(std::move(out));
+    BOOST_CHECK_EQUAL(reader.read_int32(), 1);
+    auto decoded = reader.read_fragmented_nullable_bytes();
+    BOOST_REQUIRE(decoded.has_value());
+    BOOST_CHECK_EQUAL(*decoded, expected);
+    BOOST_CHECK_EQUAL(reader.read_int32(), 2);
+}
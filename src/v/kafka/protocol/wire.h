@@ -25,7 +25,10 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <forward_list>
 #include <optional>
+#include <string_view>
 #include <type_traits>
 
 namespace seastar {
@@ -133,6 +136,49 @@ public:
         return {apply_control_validation(do_read_flex_string(n))};
     }
 
+    /*
+     * Borrowed variants of the string decoders, for callers that only inspect
+     * the strings they decode. The views point into the buffer being decoded,
+     * or into storage of the decoder for the strings that span its fragments,
+     * and are valid for the lifetime of the decoder, i.e. of the request it
+     * decodes.
+     */
+    std::string_view read_string_view() {
+        return do_read_string_view(read_int16());
+    }
+
+    std::string_view read_string_view_with_control_check() {
+        auto v = read_string_view();
+        validate_no_control(v);
+        return v;
+    }
+
+    std::string_view read_flex_string_view() {
+        return do_read_flex_string_view(read_unsigned_varint());
+    }
+
+    std::string_view read_flex_string_view_with_control_check() {
+        auto v = read_flex_string_view();
+        validate_no_control(v);
+        return v;
+    }
+
+    std::optional<std::string_view> read_nullable_string_view() {
+        auto n = read_int16();
+        if (n < 0) {
+            return std::nullopt;
+        }
+        return do_read_string_view(n);
+    }
+
+    std::optional<std::string_view> read_nullable_flex_string_view() {
+        auto n = read_unsigned_varint();
+        if (n == 0) {
+            return std::nullopt;
+        }
+        return do_read_flex_string_view(n);
+    }
+
     uuid read_uuid() {
         return uuid(_parser.consume_type<uuid::underlying_t>());
     }
@@ -297,6 +343,49 @@ private:
         return _parser.read_string(n - 1);
     }
 
+    std::string_view do_read_string_view(int16_t n) {
+        if (unlikely(n < 0)) {
+            throw std::out_of_range("Asked to read a negative byte string");
+        }
+        return borrow_string(n);
+    }
+
+    std::string_view do_read_flex_string_view(uint32_t n) {
+        if (unlikely(n == 0)) {
+            throw std::out_of_range("Asked to read a 0 byte flex string");
+        }
+        return borrow_string(n - 1);
+    }
+
+    std::string_view borrow_string(size_t n) {
+        if (unlikely(n > bytes_left())) {
+            throw std::out_of_range(fmt::format(
+              "Asked to read a string of {} bytes with {} bytes left",
+              n,
+              bytes_left()));
+        }
+        std::string_view view;
+        char* out = nullptr;
+        size_t copied = 0;
+        _parser.consume(n, [&](const char* src, size_t len) {
+            if (out == nullptr) {
+                if (len == n) {
+                    // within a fragment, no copy needed
+                    view = std::string_view(src, len);
+                    return ss::stop_iteration::no;
+                }
+                auto& spilled = _spilled_strings.emplace_front(
+                  ss::sstring::initialized_later{}, n);
+                out = spilled.data();
+                view = std::string_view(spilled);
+            }
+            std::copy_n(src, len, out + copied);
+            copied += len;
+            return ss::stop_iteration::no;
+        });
+        return view;
+    }
+
     template<
       template<typename...> typename Container = std::vector,
       typename ElementParser,
@@ -320,6 +409,8 @@ private:
     }
 
     iobuf_parser _parser;
+    // strings decoded as views that span fragments of the buffer
+    std::forward_list<ss::sstring> _spilled_strings;
 };
 
 ss::future<std::optional<size_t>> parse_size(ss::input_stream<char>&);
@@ -342,6 +433,7 @@ concept SizedContainer = requires(C c, const C cc) {
 
 class encoder;
 void writer_serialize_batch(encoder& w, model::record_batch&& batch);
+void writer_serialize_batch_shared(encoder& w, model::record_batch&& batch);
 
 class encoder {
     template<typename ExplicitIntegerType, typename IntegerType>
@@ -465,6 +557,13 @@ public:
 
     uint32_t write(const model::topic& topic) { return write(topic()); }
 
+    /// Appends data that is encoded already.
+    uint32_t write_encoded(iobuf&& data) {
+        auto size = data.size_bytes();
+        _out->append(std::move(data));
+        return size;
+    }
+
     uint32_t write(std::optional<iobuf>&& data) {
         if (!data) {
             return serialize_int<int32_t>(-1);
@@ -489,28 +588,30 @@ public:
         if (!rdr) {
             return write(std::optional<iobuf>());
         }
-        return write(std::move(*rdr).release());
+        auto records = std::move(*rdr).release();
+        auto size = serialize_int<int32_t>(records.size_bytes())
+                    + records.size_bytes();
+        append_records(std::move(records));
+        return size;
     }
 
     uint32_t write(std::optional<batch_reader>& rdr) {
-        if (!rdr) {
-            return write(std::optional<iobuf>());
-        }
-        return write(std::move(*rdr).release());
+        return write(std::move(rdr));
     }
 
     uint32_t write_flex(std::optional<batch_reader>&& rdr) {
         if (!rdr) {
             return write_flex(std::optional<iobuf>());
         }
-        return write_flex(std::move(*rdr).release());
+        auto records = std::move(*rdr).release();
+        auto size = write_unsigned_varint(records.size_bytes() + 1)
+                    + records.size_bytes();
+        append_records(std::move(records));
+        return size;
     }
 
     uint32_t write_flex(std::optional<batch_reader>& rdr) {
-        if (!rdr) {
-            return write_flex(std::optional<iobuf>());
-        }
-        return write_flex(std::move(*rdr).release());
+        return write_flex(std::move(rdr));
     }
 
     // write bytes directly to output without a length prefix
@@ -520,6 +621,14 @@ public:
         return size;
     }
 
+    // write the fragments of f to output as they are, sharing rather than
+    // copying them, without a length prefix
+    uint32_t write_direct_fragments(iobuf&& f) {
+        auto size = f.size_bytes();
+        _out->append_fragments(std::move(f));
+        return size;
+    }
+
     template<typename T, typename Tag>
     uint32_t write(const named_type<T, Tag>& t) {
         return write(t());
@@ -670,10 +779,47 @@ public:
     }
 
 private:
+    /*
+     * Record sets of fetch responses are read in large fragments, which
+     * iobuf::append(iobuf) mostly copies into the fragments of the response.
+     * Fragments of at least min_shared_fragment_size bytes are referenced as
+     * they are instead, so that the response is sent as a scattered message
+     * of its fields and the record data. Smaller ones are copied, which
+     * bounds the number of fragments of the response.
+     */
+    static constexpr size_t min_shared_fragment_size = 16 * 1024;
+
+    void append_records(iobuf&& records) {
+        bool shared_tail = false;
+        for (auto& frag : records) {
+            if (frag.size() >= min_shared_fragment_size) {
+                _out->append(std::make_unique<iobuf::fragment>(frag.share()));
+                shared_tail = true;
+                continue;
+            }
+            if (shared_tail) {
+                append_field_fragment();
+                shared_tail = false;
+            }
+            _out->append(frag.get(), frag.size());
+        }
+        if (shared_tail) {
+            append_field_fragment();
+        }
+    }
+
+    // the fields following a shared fragment go into a small buffer of their
+    // own rather than into one sized after the shared fragment
+    void append_field_fragment() {
+        _out->append(std::make_unique<iobuf::fragment>(
+          ::details::io_allocation_size::default_chunk_size));
+    }
+
     iobuf* _out;
 };
 
-inline void writer_serialize_batch(encoder& w, model::record_batch&& batch) {
+inline void
+writer_serialize_batch_header(encoder& w, const model::record_batch& batch) {
     /*
      * calculate batch size expected by kafka client.
      *
@@ -708,7 +854,29 @@ inline void writer_serialize_batch(encoder& w, model::record_batch&& batch) {
     w.write(int16_t(batch.header().producer_epoch));
     w.write(int32_t(batch.header().base_sequence));
     w.write(int32_t(batch.record_count()));
+}
+
+inline void writer_serialize_batch(encoder& w, model::record_batch&& batch) {
+    writer_serialize_batch_header(w, batch);
     w.write_direct(std::move(batch).release_data());
 }
 
+/*
+ * Same encoding as writer_serialize_batch, but the records are shared into
+ * the output rather than copied. iobuf::append(iobuf) linearizes fragments
+ * that are no larger than the last allocation, which for fetch responses
+ * means copying most of the record payloads read from disk a second time.
+ *
+ * The header is encoded into its own buffer first: encoding it straight
+ * after a shared fragment would size the new fragment after the shared one.
+ */
+inline void
+writer_serialize_batch_shared(encoder& w, model::record_batch&& batch) {
+    iobuf header;
+    encoder hw(header);
+    writer_serialize_batch_header(hw, batch);
+    w.write_direct_fragments(std::move(header));
+    w.write_direct_fragments(std::move(batch).release_data());
+}
+
 } // namespace kafka::protocol
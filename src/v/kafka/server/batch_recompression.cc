@@ -0,0 +1,76 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "kafka/server/batch_recompression.h"
+
+#include "config/configuration.h"
+#include "storage/parser_utils.h"
+
+#include <seastar/core/coroutine.hh>
+
+namespace kafka {
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+static thread_local recompression_budget local_budget;
+
+bool recompression_budget::has_budget(
+  uint32_t percent, clock_type::time_point now) {
+    if (now - _window_start >= window) {
+        _window_start = now;
+        _spent = clock_type::duration{0};
+    }
+    return _spent < std::chrono::duration_cast<clock_type::duration>(window)
+                      * percent / 100;
+}
+
+std::optional<model::compression> recompression_codec(
+  const model::record_batch_header& hdr,
+  model::compression topic_compression) {
+    if (!config::shard_local_cfg().kafka_recompress_uncompressed_batches()) {
+        return std::nullopt;
+    }
+    switch (topic_compression) {
+    case model::compression::none:
+    case model::compression::producer:
+        return std::nullopt;
+    case model::compression::gzip:
+    case model::compression::snappy:
+    case model::compression::lz4:
+    case model::compression::zstd:
+        break;
+    }
+    // control batches are never compressed by kafka clients either
+    if (
+      hdr.attrs.compression() != model::compression::none
+      || hdr.attrs.is_control() || hdr.record_count == 0) {
+        return std::nullopt;
+    }
+    return topic_compression;
+}
+
+ss::future<model::record_batch_reader>
+maybe_recompress(model::record_batch_reader reader, model::compression codec) {
+    const auto now = recompression_budget::clock_type::now();
+    if (!local_budget.has_budget(
+          config::shard_local_cfg().kafka_recompression_cpu_budget_percent(),
+          now)) {
+        co_return reader;
+    }
+    auto batches = co_await model::consume_reader_to_memory(
+      std::move(reader), model::no_timeout);
+    model::record_batch_reader::data_t compressed;
+    for (auto& batch : batches) {
+        compressed.push_back(
+          co_await storage::internal::compress_batch(codec, std::move(batch)));
+    }
+    local_budget.spend(recompression_budget::clock_type::now() - now);
+    co_return model::make_memory_record_batch_reader(std::move(compressed));
+}
+
+} // namespace kafka
@@ -0,0 +1,57 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "model/compression.h"
+#include "model/record.h"
+#include "model/record_batch_reader.h"
+
+#include <seastar/core/future.hh>
+
+#include <chrono>
+
+namespace kafka {
+
+/*
+ * Compression on the leader of the uncompressed batches produced to a topic
+ * whose compression.type is a codec, so that they are replicated, stored and
+ * uploaded compressed (see kafka_recompress_uncompressed_batches).
+ *
+ * Compressing takes the CPU the producers did not spend: every shard spends
+ * at most kafka_recompression_cpu_budget_percent of each second on it, the
+ * batches produced once the budget is spent are stored as produced. Large
+ * batches are compressed off the reactor, see storage::compression_offload.
+ */
+
+/// The codec to compress the batch with, none if it is stored as produced.
+std::optional<model::compression> recompression_codec(
+  const model::record_batch_header&, model::compression topic_compression);
+
+/// Compresses the batches of the reader with \p codec if the shard has the
+/// budget for it.
+ss::future<model::record_batch_reader>
+  maybe_recompress(model::record_batch_reader, model::compression codec);
+
+/// The budget of compression time of a shard, over windows of a second.
+class recompression_budget {
+public:
+    using clock_type = std::chrono::steady_clock;
+    static constexpr auto window = std::chrono::seconds(1);
+
+    bool has_budget(uint32_t percent, clock_type::time_point now);
+    void spend(clock_type::duration d) { _spent += d; }
+
+private:
+    clock_type::time_point _window_start;
+    clock_type::duration _spent{0};
+};
+
+} // namespace kafka
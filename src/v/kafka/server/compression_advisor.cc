@@ -0,0 +1,218 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "kafka/server/compression_advisor.h"
+
+#include "base/vlog.h"
+#include "compression/compression.h"
+#include "kafka/server/logger.h"
+#include "random/generators.h"
+#include "ssx/future-util.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/coroutine/maybe_yield.hh>
+
+#include <algorithm>
+
+namespace kafka {
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local compression_advisor* compression_advisor::_local_instance
+  = nullptr;
+
+double compression_advisor::codec_measure::ratio() const {
+    if (compressed_bytes == 0) {
+        return 0;
+    }
+    return static_cast<double>(uncompressed_bytes)
+           / static_cast<double>(compressed_bytes);
+}
+
+compression_advisor::codec_measure&
+compression_advisor::codec_measure::operator+=(const codec_measure& o) {
+    uncompressed_bytes += o.uncompressed_bytes;
+    compressed_bytes += o.compressed_bytes;
+    compress_time += o.compress_time;
+    decompress_time += o.decompress_time;
+    return *this;
+}
+
+compression_advisor::codec_measure
+compression_advisor::measure(const iobuf& payload, model::compression codec) {
+    codec_measure m{.codec = codec, .uncompressed_bytes = payload.size_bytes()};
+    auto start = clock_type::now();
+    auto compressed = compression::compressor::compress(payload, codec);
+    auto compressed_at = clock_type::now();
+    compression::compressor::uncompress(compressed, codec);
+    m.compress_time = compressed_at - start;
+    m.decompress_time = clock_type::now() - compressed_at;
+    m.compressed_bytes = compressed.size_bytes();
+    return m;
+}
+
+model::compression
+compression_advisor::recommend(const std::vector<codec_measure>& measures) {
+    auto cost = [](const codec_measure& m) {
+        // a codec can take no measurable time on small samples
+        return std::max(
+          m.compress_time + m.decompress_time, clock_type::duration{1});
+    };
+    std::optional<clock_type::duration> cheapest;
+    for (const auto& m : measures) {
+        if (m.uncompressed_bytes > 0) {
+            cheapest = cheapest ? std::min(*cheapest, cost(m)) : cost(m);
+        }
+    }
+    if (!cheapest) {
+        return model::compression::none;
+    }
+    const codec_measure* best = nullptr;
+    for (const auto& m : measures) {
+        if (
+          m.uncompressed_bytes == 0
+          || static_cast<double>(cost(m).count())
+               > max_cost_factor * static_cast<double>(cheapest->count())) {
+            continue;
+        }
+        if (best == nullptr || m.ratio() > best->ratio()) {
+            best = &m;
+        }
+    }
+    if (best == nullptr || best->ratio() < min_ratio) {
+        return model::compression::none;
+    }
+    return best->codec;
+}
+
+compression_advisor::compression_advisor(
+  config::binding<std::optional<std::chrono::milliseconds>> interval,
+  ss::scheduling_group sg)
+  : _interval(std::move(interval))
+  , _sg(sg) {
+    _timer.set_callback([this] {
+        ssx::spawn_with_gate(_gate, [this] {
+            return evaluate().finally([this] {
+                if (!_gate.is_closed()) {
+                    arm_timer();
+                }
+            });
+        });
+    });
+    _interval.watch([this] {
+        _timer.cancel();
+        if (!_interval()) {
+            _samples.clear();
+        }
+        arm_timer();
+    });
+}
+
+ss::future<> compression_advisor::start() {
+    _local_instance = this;
+    arm_timer();
+    return ss::now();
+}
+
+ss::future<> compression_advisor::stop() {
+    _local_instance = nullptr;
+    _timer.cancel();
+    co_await _gate.close();
+}
+
+void compression_advisor::arm_timer() {
+    if (const auto interval = _interval(); interval && !_timer.armed()) {
+        _timer.arm(*interval);
+    }
+}
+
+void compression_advisor::maybe_sample(
+  const model::topic& topic, const model::record_batch& batch) {
+    if (!_interval() || ++_produced % sample_every != 0) {
+        return;
+    }
+    if (
+      batch.header().type != model::record_batch_type::raft_data
+      || batch.header().attrs.is_control()
+      || batch.size_bytes() > static_cast<int32_t>(max_sample_bytes)) {
+        return;
+    }
+    auto it = _samples.find(topic);
+    if (it == _samples.end()) {
+        if (_samples.size() >= max_topics) {
+            return;
+        }
+        it = _samples.emplace(topic, topic_samples{}).first;
+    }
+    auto& ts = it->second;
+    ++ts.seen;
+    size_t slot = ts.samples.size();
+    if (slot == max_samples_per_topic) {
+        // keeps each of the batches seen with the same probability
+        slot = random_generators::get_int<size_t>(0, ts.seen - 1);
+        if (slot >= max_samples_per_topic) {
+            return;
+        }
+    }
+    sample s{
+      .payload = batch.data().copy(),
+      .compression = batch.header().attrs.compression()};
+    if (slot == ts.samples.size()) {
+        ts.samples.push_back(std::move(s));
+    } else {
+        ts.samples[slot] = std::move(s);
+    }
+}
+
+ss::future<> compression_advisor::evaluate() {
+    auto holder = _gate.hold();
+    co_await ss::with_scheduling_group(_sg, [this] { return do_evaluate(); });
+}
+
+ss::future<> compression_advisor::do_evaluate() {
+    auto samples = std::exchange(_samples, {});
+    for (auto& [topic, ts] : samples) {
+        topic_advice advice;
+        for (auto c : codecs) {
+            advice.measures.push_back(codec_measure{.codec = c});
+        }
+        for (auto& s : ts.samples) {
+            iobuf payload;
+            if (s.compression == model::compression::none) {
+                payload = std::move(s.payload);
+            } else {
+                try {
+                    payload = compression::compressor::uncompress(
+                      s.payload, s.compression);
+                } catch (const std::exception& e) {
+                    vlog(
+                      klog.debug,
+                      "Skipping a sample of {} that failed to decompress: {}",
+                      topic,
+                      e.what());
+                    continue;
+                }
+                co_await ss::coroutine::maybe_yield();
+            }
+            if (payload.size_bytes() > max_sample_bytes) {
+                // the measures are per byte, a prefix of the records will do
+                payload.trim_back(payload.size_bytes() - max_sample_bytes);
+            }
+            ++advice.samples;
+            for (auto& m : advice.measures) {
+                m += measure(payload, m.codec);
+                co_await ss::coroutine::maybe_yield();
+            }
+        }
+        if (advice.samples > 0) {
+            _advice.insert_or_assign(topic, std::move(advice));
+        }
+    }
+}
+
+} // namespace kafka
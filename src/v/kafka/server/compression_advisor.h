@@ -0,0 +1,138 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "base/seastarx.h"
+#include "base/units.h"
+#include "bytes/iobuf.h"
+#include "config/property.h"
+#include "model/compression.h"
+#include "model/fundamental.h"
+#include "model/record.h"
+
+#include <seastar/core/gate.hh>
+#include <seastar/core/scheduling.hh>
+#include <seastar/core/timer.hh>
+
+#include <absl/container/flat_hash_map.h>
+
+#include <array>
+#include <chrono>
+#include <optional>
+#include <vector>
+
+namespace kafka {
+
+/*
+ * Advises on the compression.type of topics from the data produced to them.
+ *
+ * Every shard samples the record payloads of a fraction of the batches
+ * produced through it and, every kafka_compression_advisor_interval_ms,
+ * compresses and decompresses the samples with each codec in a background
+ * scheduling group to measure the ratio and the CPU cost of the codecs. The
+ * admin API sums up the measures of the shards and recommends a codec.
+ *
+ * The codecs are measured at the levels they are used with, the compression
+ * level of a topic is not configurable.
+ */
+class compression_advisor {
+public:
+    using clock_type = std::chrono::steady_clock;
+
+    static constexpr std::array codecs{
+      model::compression::gzip,
+      model::compression::snappy,
+      model::compression::lz4,
+      model::compression::zstd};
+
+    // one in sample_every produced batches is sampled
+    static constexpr uint32_t sample_every = 100;
+    static constexpr size_t max_samples_per_topic = 16;
+    // larger batches are not sampled and the records of a compressed batch
+    // are measured up to this size, compressing more at once takes too long
+    // for a background task that does not yield while compressing
+    static constexpr size_t max_sample_bytes = 256_KiB;
+    static constexpr size_t max_topics = 128;
+
+    /// The cost of a codec on the samples of a topic. Measures of the same
+    /// codec add up, across evaluations or shards.
+    struct codec_measure {
+        model::compression codec;
+        size_t uncompressed_bytes{0};
+        size_t compressed_bytes{0};
+        clock_type::duration compress_time{0};
+        clock_type::duration decompress_time{0};
+
+        double ratio() const;
+        codec_measure& operator+=(const codec_measure&);
+    };
+
+    struct topic_advice {
+        size_t samples{0};
+        std::vector<codec_measure> measures;
+    };
+
+    /// Compresses \p payload with \p codec and decompresses it back.
+    static codec_measure measure(const iobuf& payload, model::compression);
+
+    /// The codec with the best ratio among those that cost at most
+    /// max_cost_factor times the cheapest one, none if none of them
+    /// compresses by min_ratio.
+    static model::compression recommend(const std::vector<codec_measure>&);
+    static constexpr double max_cost_factor = 4.0;
+    static constexpr double min_ratio = 1.1;
+
+    compression_advisor(
+      config::binding<std::optional<std::chrono::milliseconds>> interval,
+      ss::scheduling_group);
+
+    ss::future<> start();
+    ss::future<> stop();
+
+    /// The instance of this shard, null when the service is not running.
+    static compression_advisor* local() { return _local_instance; }
+
+    /// Samples \p batch, produced to \p topic, if it is its turn.
+    void maybe_sample(const model::topic&, const model::record_batch&);
+
+    /// Measures the codecs on the samples taken since the last evaluation.
+    ss::future<> evaluate();
+
+    const absl::flat_hash_map<model::topic, topic_advice>& advice() const {
+        return _advice;
+    }
+
+private:
+    struct sample {
+        iobuf payload;
+        model::compression compression;
+    };
+    struct topic_samples {
+        size_t seen{0};
+        std::vector<sample> samples;
+    };
+
+    ss::future<> do_evaluate();
+    void arm_timer();
+
+    config::binding<std::optional<std::chrono::milliseconds>> _interval;
+    ss::scheduling_group _sg;
+    uint32_t _produced{0};
+    absl::flat_hash_map<model::topic, topic_samples> _samples;
+    absl::flat_hash_map<model::topic, topic_advice> _advice;
+    ss::timer<> _timer;
+    ss::gate _gate;
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    static thread_local compression_advisor* _local_instance;
+};
+
+} // namespace kafka
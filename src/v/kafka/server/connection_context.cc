@@ -22,6 +22,9 @@
 #include "kafka/sasl_probe.h"
 #include "kafka/server/handlers/fetch.h"
 #include "kafka/server/handlers/handler_interface.h"
+#include "kafka/server/handlers/list_offsets.h"
+#include "kafka/server/handlers/metadata.h"
+#include "kafka/server/handlers/offset_fetch.h"
 #include "kafka/server/handlers/produce.h"
 #include "kafka/server/logger.h"
 #include "kafka/server/protocol_utils.h"
@@ -43,10 +46,12 @@
 #include <seastar/core/with_timeout.hh>
 #include <seastar/coroutine/as_future.hh>
 
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
 #include <exception>
 #include <memory>
+#include <numeric>
 
 using namespace std::chrono_literals;
 
@@ -106,7 +111,12 @@ connection_context::connection_context(
   , _mtls_state(std::move(mtls_state))
   , _max_request_size(std::move(max_request_size))
   , _kafka_throughput_controlled_api_keys(
-      std::move(kafka_throughput_controlled_api_keys)) {}
+      std::move(kafka_throughput_controlled_api_keys))
+  , _produce_admission_control(
+      config::shard_local_cfg().kafka_produce_admission_control.bind())
+  , _out_of_order_requests(
+      config::shard_local_cfg().kafka_connection_out_of_order_requests(),
+      "k/out-of-order-requests") {}
 
 connection_context::~connection_context() noexcept = default;
 
@@ -146,10 +156,42 @@ ss::future<> connection_context::stop() {
     co_await _as.stop();
 
     if (conn) {
+        log_produce_affinity();
         vlog(klog.trace, "stopped connection context for {}", conn->addr);
     }
 }
 
+void connection_context::record_produce_shard(ss::shard_id shard) {
+    if (_produce_shards.empty()) {
+        _produce_shards.resize(ss::smp::count);
+    }
+    ++_produce_shards[shard];
+}
+
+void connection_context::log_produce_affinity() const {
+    auto it = std::max_element(_produce_shards.begin(), _produce_shards.end());
+    if (it == _produce_shards.end()) {
+        return;
+    }
+    const auto target = ss::shard_id(it - _produce_shards.begin());
+    const auto total = std::accumulate(
+      _produce_shards.begin(), _produce_shards.end(), uint64_t(0));
+    // connections are assigned to shards when accepted and can not follow
+    // the partitions they write to, so only report the ones that would
+    // have avoided most of their cross core dispatches
+    if (target == ss::this_shard_id() || *it * 2 <= total) {
+        return;
+    }
+    vlog(
+      klog.debug,
+      "connection {} on shard {} produced {} of {} partitions to shard {}",
+      conn->addr,
+      ss::this_shard_id(),
+      *it,
+      total,
+      target);
+}
+
 template<typename T>
 security::auth_result connection_context::authorized(
   security::acl_operation operation, const T& name, authz_quiet quiet) {
@@ -336,6 +378,18 @@ ss::future<> connection_context::process_one_request() {
         co_return;
     }
     _server.handler_probe(h->key).add_bytes_received(sz.value());
+    /*
+     * A client that got this far past the tls handshake and, with sasl, past
+     * the authentication is remembered by the server, so that its connections
+     * take priority over the ones of unknown clients during connection storms.
+     */
+    if (
+      !_known_client
+      && (!sasl()
+          || sasl()->state() == security::sasl_server::sasl_state::complete)) {
+        _known_client = true;
+        _server.remember_client(conn->addr.addr());
+    }
     /**
      * An entry point for the MPX serverless extensions. If the first request
      * for a given connection has a special client_id then MPX extensions are
@@ -520,8 +574,36 @@ connection_context::record_tp_and_calculate_throttle(
     return delay_t{.request = delay_request, .enforce = delay_enforce};
 }
 
+connection_context::admission connection_context::admit_request(
+  const request_header& hdr, const size_t request_size, const delay_t delay) {
+    if (delay.request == delay_t::clock::duration::zero()) {
+        return admission::admit;
+    }
+    if (hdr.key != produce_api::key || !_produce_admission_control()) {
+        return admission::push_back;
+    }
+    // with memory to spare the request is cheaper to handle now than to hold
+    // on to, and the client backs off on its own
+    const auto estimate = request_memory_estimate(hdr.key, request_size);
+    if (
+      !_server.memory().waiters()
+      && _server.memory().available_units() >= static_cast<ssize_t>(estimate)) {
+        return admission::push_back;
+    }
+    vlog(
+      klog.debug,
+      "[{}:{}] delaying produce of {} bytes by {} on admission, memory "
+      "available: {}",
+      _client_addr,
+      client_port(),
+      request_size,
+      delay.request,
+      _server.memory().available_units());
+    return admission::delay;
+}
+
 ss::future<session_resources> connection_context::throttle_request(
-  const request_header& hdr, size_t request_size) {
+  const request_header& hdr, size_t request_size, request_trace* trace) {
     // note that when throttling is first determined, the request is
     // allowed to pass through, and only subsequent requests are
     // delayed. this is a similar strategy used by kafka 2.0: the
@@ -530,7 +612,12 @@ ss::future<session_resources> connection_context::throttle_request(
     // applied to subsequent messages allow backpressure to take
     // affect.
 
-    const delay_t delay = record_tp_and_calculate_throttle(hdr, request_size);
+    delay_t delay = record_tp_and_calculate_throttle(hdr, request_size);
+    if (admit_request(hdr, request_size, delay) == admission::delay) {
+        // the throttling is over by the time the client gets the response
+        delay.enforce = std::max(delay.enforce, delay.request);
+        delay.request = delay_t::clock::duration::zero();
+    }
     request_data r_data = request_data{
       .request_key = hdr.key,
       .client_id = ss::sstring{hdr.client_id.value_or("")}};
@@ -542,7 +629,10 @@ ss::future<session_resources> connection_context::throttle_request(
     }
     auto track = track_latency(hdr.key);
     return fut
-      .then([this, key = hdr.key, request_size] {
+      .then([this, key = hdr.key, request_size, trace] {
+          if (trace) {
+              trace->end_stage(request_stage::throttle);
+          }
           return reserve_request_units(key, request_size);
       })
       .then([this,
@@ -558,7 +648,11 @@ ss::future<session_resources> connection_context::throttle_request(
              mem_units = std::move(units),
              track,
              tracker = std::move(tracker),
-             &h_probe](ssx::semaphore_units qd_units) mutable {
+             &h_probe,
+             trace](ssx::semaphore_units qd_units) mutable {
+                if (trace) {
+                    trace->end_stage(request_stage::queue);
+                }
                 session_resources r{
                   .backpressure_delay = delay,
                   .memlocks = std::move(mem_units),
@@ -574,17 +668,22 @@ ss::future<session_resources> connection_context::throttle_request(
       });
 }
 
-ss::future<ssx::semaphore_units>
-connection_context::reserve_request_units(api_key key, size_t size) {
+size_t connection_context::request_memory_estimate(api_key key, size_t size) {
     // Defer to the handler for the request type for the memory estimate, but
     // if the request isn't found, use the default estimate (although in that
     // case the request is likely for an API we don't support or malformed, so
     // it is likely to fail shortly anyway).
     auto handler = handler_for_key(key);
-    auto mem_estimate = handler ? (*handler)->memory_estimate(size, *this)
-                                : default_memory_estimate(size);
+    return handler ? (*handler)->memory_estimate(size, *this)
+                   : default_memory_estimate(size);
+}
+
+ss::future<ssx::semaphore_units>
+connection_context::reserve_request_units(api_key key, size_t size) {
+    auto mem_estimate = request_memory_estimate(key, size);
     if (unlikely(mem_estimate >= (size_t)std::numeric_limits<int32_t>::max())) {
         // TODO: Create error response using the specific API?
+        auto handler = handler_for_key(key);
         throw std::runtime_error(fmt::format(
           "request too large > 1GB (size: {}, estimate: {}, API: {})",
           size,
@@ -600,7 +699,10 @@ connection_context::reserve_request_units(api_key key, size_t size) {
 
 ss::future<>
 connection_context::dispatch_method_once(request_header hdr, size_t size) {
-    auto sres_in = co_await throttle_request(hdr, size);
+    auto trace = _server.request_traces().start(
+      hdr.key, hdr.correlation, hdr.client_id);
+    auto sres_in = co_await throttle_request(hdr, size, trace.get());
+    sres_in.trace = std::move(trace);
     if (abort_requested()) {
         // protect against shutdown behavior
         co_return;
@@ -629,9 +731,13 @@ connection_context::dispatch_method_once(request_header hdr, size_t size) {
         // _server._cntrl etc might not be alive
         co_return;
     }
+    if (sres->trace) {
+        sres->trace->end_stage(request_stage::read);
+    }
     auto self = shared_from_this();
     auto rctx = request_context(
       self, std::move(hdr), std::move(buf), sres->backpressure_delay);
+    rctx.set_trace(sres->trace.get());
 
     /**
      * Not virtualized connection, simply forward to protocol state for request
@@ -673,6 +779,16 @@ ss::future<> connection_context::virtual_connection_state::process_request(
       });
 }
 
+/*
+ * Requests that neither change the state of the connection nor are relied on
+ * by the requests following them, so that the connection may move on to the
+ * next request while they are handled.
+ */
+static bool is_reorderable(api_key key) {
+    return key == fetch_api::key || key == list_offsets_api::key
+           || key == offset_fetch_api::key || key == metadata_api::key;
+}
+
 ss::future<> connection_context::client_protocol_state::process_request(
   ss::lw_shared_ptr<connection_context> connection_ctx,
   request_context rctx,
@@ -697,11 +813,37 @@ ss::future<> connection_context::client_protocol_state::process_request(
      * stream at best and at worst some odd behavior.
      */
     const auto correlation = rctx.header().correlation;
+    const auto key = rctx.header().key;
     const sequence_id seq = _seq_idx;
     _seq_idx = _seq_idx + sequence_id(1);
     auto res = kafka::process_request(
       std::move(rctx), connection_ctx->server().smp_group(), *sres);
 
+    if (is_reorderable(key)) {
+        auto units = ss::try_get_units(
+          connection_ctx->_out_of_order_requests, 1);
+        if (units) {
+            ssx::spawn_with_gate(
+              connection_ctx->_server.conn_gate(),
+              [this,
+               res = std::move(res),
+               sres,
+               seq,
+               correlation,
+               units = std::move(*units),
+               cctx = connection_ctx]() mutable {
+                  return handle_out_of_order(
+                    std::move(cctx),
+                    std::move(res),
+                    sres,
+                    seq,
+                    correlation,
+                    std::move(units));
+              });
+            co_return;
+        }
+    }
+
     /*
      * first stage processed in a foreground.
      *
@@ -728,6 +870,9 @@ ss::future<> connection_context::client_protocol_state::process_request(
         sres->tracker->mark_errored();
         co_return;
     }
+    if (sres->trace) {
+        sres->trace->end_stage(request_stage::dispatch);
+    }
 
     /**
      * second stage processed in background.
@@ -745,6 +890,24 @@ ss::future<> connection_context::client_protocol_state::process_request(
       });
 }
 
+ss::future<> connection_context::client_protocol_state::handle_out_of_order(
+  ss::lw_shared_ptr<connection_context> connection_ctx,
+  process_result_stages stages,
+  ss::lw_shared_ptr<session_resources> sres,
+  sequence_id seq,
+  correlation_id correlation,
+  ssx::semaphore_units) {
+    // the handlers of these requests are single staged: they are dispatched
+    // once their response is ready, and a failure fails the response too
+    ssx::background = std::move(stages.dispatched);
+    co_await handle_response(
+      std::move(connection_ctx),
+      std::move(stages.response),
+      std::move(sres),
+      seq,
+      correlation);
+}
+
 ss::future<> connection_context::client_protocol_state::handle_response(
   ss::lw_shared_ptr<connection_context> connection_ctx,
   ss::future<response_ptr> f,
@@ -754,6 +917,9 @@ ss::future<> connection_context::client_protocol_state::handle_response(
     std::exception_ptr e;
     try {
         auto r = co_await std::move(f);
+        if (sres->trace) {
+            sres->trace->end_stage(request_stage::handle);
+        }
         r->set_correlation(correlation);
         response_and_resources randr{std::move(r), sres};
         _responses.insert({seq, std::move(randr)});
@@ -844,9 +1010,18 @@ ss::future<> connection_context::client_protocol_state::maybe_process_responses(
         }
         connection_ctx->_server.handler_probe(request_key)
           .add_bytes_sent(response_size);
+        auto* trace = resp_and_res.resources->trace.get();
+        if (trace) {
+            trace->end_stage(request_stage::order);
+        }
         try {
             return connection_ctx->conn->write(std::move(msg))
-              .then([] {
+              .then([trace,
+                     &tracer = connection_ctx->_server.request_traces()] {
+                  if (trace) {
+                      trace->end_stage(request_stage::write);
+                      tracer.finish(*trace);
+                  }
                   return ss::make_ready_future<ss::stop_iteration>(
                     ss::stop_iteration::no);
               })
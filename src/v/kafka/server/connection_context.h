@@ -14,6 +14,7 @@
 #include "kafka/server/fwd.h"
 #include "kafka/server/handlers/handler_probe.h"
 #include "kafka/server/logger.h"
+#include "kafka/server/request_trace.h"
 #include "kafka/types.h"
 #include "net/server.h"
 #include "security/acl.h"
@@ -119,6 +120,8 @@ struct session_resources {
     std::unique_ptr<handler_probe::hist_t::measurement> handler_latency;
     std::unique_ptr<request_tracker> tracker;
     request_data request_data;
+    // set if kafka_request_tracing_enabled
+    std::unique_ptr<request_trace> trace;
 };
 
 class connection_context final
@@ -171,6 +174,12 @@ public:
     }
 
     bool tls_enabled() const { return conn->tls_enabled(); }
+    bool authorization_enabled() const { return _enable_authorizer; }
+
+    /// Records that the connection produced to a partition owned by \p shard.
+    /// A connection whose writes mostly go to one other shard is reported
+    /// when it closes.
+    void record_produce_shard(ss::shard_id shard);
 
 private:
     template<typename T>
@@ -195,6 +204,7 @@ private:
     // Reserve units from memory from the memory semaphore in proportion
     // to the number of bytes the request procesisng is expected to
     // take.
+    size_t request_memory_estimate(api_key key, size_t size);
     ss::future<ssx::semaphore_units>
     reserve_request_units(api_key key, size_t size);
 
@@ -218,6 +228,19 @@ private:
     delay_t record_tp_and_calculate_throttle(
       const request_header& hdr, size_t request_size);
 
+    /// How a request is admitted once its throttle delay is known.
+    /// \p admit: the request is not throttled.
+    /// \p push_back: the delay is requested from the client via throttle_ms,
+    /// as in Kafka 2.0 compliant behaviour.
+    /// \p delay: the delay is enforced before the memory of the request is
+    /// reserved and its body read, see `kafka_produce_admission_control`.
+    enum class admission { admit, push_back, delay };
+
+    /// Decide from the header and size of a request, before its body is
+    /// read, how a request throttled by \p delay is admitted.
+    admission
+    admit_request(const request_header& hdr, size_t request_size, delay_t);
+
     // Apply backpressure sequence, where the request processing may be
     // delayed for various reasons, including throttling but also because
     // too few server resources are available to accomodate the request
@@ -226,12 +249,14 @@ private:
     // the associated resouces have been obtained and are tracked by the
     // contained session_resources object.
     ss::future<session_resources>
-    throttle_request(const request_header&, size_t sz);
+    throttle_request(const request_header&, size_t sz, request_trace*);
 
     ss::future<> do_process(request_context);
 
     ss::future<> handle_auth_v0(size_t);
 
+    void log_produce_affinity() const;
+
 private:
     /**
      * Bundles together a response and its associated resources.
@@ -354,6 +379,19 @@ private:
           sequence_id,
           correlation_id);
 
+        /**
+         * Handles a request that the connection does not wait for, see
+         * kafka_connection_out_of_order_requests. The response is sent in
+         * order by handle_response.
+         */
+        ss::future<> handle_out_of_order(
+          ss::lw_shared_ptr<connection_context>,
+          process_result_stages,
+          ss::lw_shared_ptr<session_resources>,
+          sequence_id,
+          correlation_id,
+          ssx::semaphore_units);
+
         sequence_id _next_response;
         sequence_id _seq_idx;
         map_t _responses;
@@ -429,10 +467,17 @@ private:
     config::binding<uint32_t> _max_request_size;
     config::conversion_binding<std::vector<bool>, std::vector<ss::sstring>>
       _kafka_throughput_controlled_api_keys;
+    config::binding<bool> _produce_admission_control;
+    // bounds the requests handled concurrently with the ones following them
+    ssx::semaphore _out_of_order_requests;
     std::unique_ptr<snc_quota_context> _snc_quota_context;
     ss::promise<> _wait_input_shutdown;
+    // produced partitions per owning shard, sized on the first produce
+    std::vector<uint64_t> _produce_shards;
 
     bool _is_virtualized_connection = false;
+    // whether the client was remembered as a known client of the server
+    bool _known_client = false;
 };
 
 } // namespace kafka
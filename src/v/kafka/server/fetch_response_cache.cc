@@ -0,0 +1,115 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "kafka/server/fetch_response_cache.h"
+
+#include "config/configuration.h"
+
+namespace kafka {
+
+namespace {
+fetch_response_cache::read_data share(fetch_response_cache::read_data& d) {
+    return {
+      .data = d.data.share(0, d.data.size_bytes()),
+      .record_count = d.record_count,
+      .last_offset = d.last_offset,
+      .first_tx_batch_offset = d.first_tx_batch_offset,
+      .aborted_transactions = d.aborted_transactions,
+    };
+}
+} // namespace
+
+bool fetch_response_cache::enabled() const {
+    return config::shard_local_cfg().kafka_fetch_response_cache_bytes() > 0;
+}
+
+bool fetch_response_cache::entry::answers(
+  log_generation gen, const read_bounds& bounds) const {
+    if (gen != generation || bounds.max_offset != max_offset) {
+        return false;
+    }
+    if (complete()) {
+        // a read with a larger budget would have stopped at max_offset too
+        return bounds.max_bytes >= max_bytes;
+    }
+    return bounds.max_bytes == max_bytes
+           && bounds.strict_max_bytes == strict_max_bytes;
+}
+
+std::optional<fetch_response_cache::read_data> fetch_response_cache::get(
+  const model::ntp& ntp, log_generation gen, const read_bounds& bounds) {
+    auto it = _entries.find(
+      key{ntp, bounds.start_offset, bounds.isolation_level});
+    if (it == _entries.end()) {
+        ++_misses;
+        return std::nullopt;
+    }
+    auto& e = it->second;
+    if (e.generation != gen) {
+        // the log was truncated or recreated since
+        erase(it);
+        ++_misses;
+        return std::nullopt;
+    }
+    if (!e.answers(gen, bounds)) {
+        ++_misses;
+        return std::nullopt;
+    }
+    ++_hits;
+    e.hook.unlink();
+    _lru.push_back(e);
+    return share(e.result);
+}
+
+void fetch_response_cache::put(
+  const model::ntp& ntp,
+  log_generation gen,
+  const read_bounds& bounds,
+  read_data result) {
+    const auto capacity
+      = config::shard_local_cfg().kafka_fetch_response_cache_bytes();
+    const auto size = result.data.size_bytes();
+    if (size == 0 || size > capacity) {
+        evict(capacity);
+        return;
+    }
+    auto [it, inserted] = _entries.try_emplace(
+      key{ntp, bounds.start_offset, bounds.isolation_level});
+    auto& e = it->second;
+    if (!inserted) {
+        // a newer read of the range, e.g. after the high watermark moved
+        _size_bytes -= e.result.data.size_bytes();
+        e.hook.unlink();
+    }
+    e.map_key = &it->first;
+    e.generation = gen;
+    e.max_offset = bounds.max_offset;
+    e.max_bytes = bounds.max_bytes;
+    e.strict_max_bytes = bounds.strict_max_bytes;
+    e.result = std::move(result);
+    _size_bytes += size;
+    _lru.push_back(e);
+    evict(capacity);
+}
+
+void fetch_response_cache::erase(map_t::iterator it) {
+    _size_bytes -= it->second.result.data.size_bytes();
+    _entries.erase(it);
+}
+
+void fetch_response_cache::evict(size_t capacity) {
+    while (_size_bytes > capacity && !_lru.empty()) {
+        auto& e = _lru.front();
+        _lru.pop_front();
+        erase(_entries.find(*e.map_key));
+    }
+}
+
+} // namespace kafka
@@ -0,0 +1,148 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "bytes/iobuf.h"
+#include "container/intrusive_list_helpers.h"
+#include "model/fundamental.h"
+#include "model/metadata.h"
+#include "model/record.h"
+
+#include <absl/container/node_hash_map.h>
+#include <absl/hash/hash.h>
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace kafka {
+
+/**
+ * Shard-local cache of encoded fetch response data.
+ *
+ * Many consumer groups tailing the same partition issue fetches for the same
+ * range of the log, and each of them reads the batches and encodes them into
+ * a response of its own. With `kafka_fetch_response_cache_bytes` set, the
+ * encoded data of a read is kept here, keyed by partition, start offset and
+ * isolation level, and later fetches for the same range share its buffers
+ * rather than reading it again.
+ *
+ * The contents of a log range change only when the log is truncated or the
+ * partition is recreated, so entries remember the log generation they were
+ * read from and are dropped when it no longer matches.
+ */
+class fetch_response_cache {
+public:
+    /// Identifies a version of a partition log. Reads of the same range of
+    /// the same generation return the same batches.
+    struct log_generation {
+        model::revision_id revision;
+        size_t truncations{0};
+
+        bool operator==(const log_generation&) const = default;
+    };
+
+    /// Parameters of a read that determine its result.
+    struct read_bounds {
+        model::offset start_offset;
+        model::offset max_offset;
+        model::isolation_level isolation_level;
+        size_t max_bytes{0};
+        bool strict_max_bytes{false};
+    };
+
+    /// The encoded result of a read.
+    struct read_data {
+        iobuf data;
+        uint32_t record_count{0};
+        model::offset last_offset;
+        std::optional<model::offset> first_tx_batch_offset;
+        std::vector<model::tx_range> aborted_transactions;
+    };
+
+    fetch_response_cache() = default;
+    fetch_response_cache(fetch_response_cache&&) = delete;
+    fetch_response_cache& operator=(fetch_response_cache&&) = delete;
+    fetch_response_cache(const fetch_response_cache&) = delete;
+    fetch_response_cache& operator=(const fetch_response_cache&) = delete;
+    ~fetch_response_cache() noexcept = default;
+
+    bool enabled() const;
+
+    /**
+     * Returns the data of a cached read of \p ntp that a read with \p bounds
+     * of generation \p gen would return, sharing its buffers.
+     */
+    std::optional<read_data>
+    get(const model::ntp& ntp, log_generation gen, const read_bounds& bounds);
+
+    /// Cache the result of a read with \p bounds of generation \p gen.
+    void put(
+      const model::ntp& ntp,
+      log_generation gen,
+      const read_bounds& bounds,
+      read_data result);
+
+    size_t size_bytes() const { return _size_bytes; }
+    uint64_t hits() const { return _hits; }
+    uint64_t misses() const { return _misses; }
+
+private:
+    struct key {
+        model::ntp ntp;
+        model::offset start_offset;
+        model::isolation_level isolation_level;
+
+        bool operator==(const key&) const = default;
+
+        template<typename H>
+        friend H AbslHashValue(H h, const key& k) {
+            return H::combine(
+              std::move(h),
+              std::hash<model::ntp>()(k.ntp),
+              k.start_offset(),
+              k.isolation_level);
+        }
+    };
+
+    struct entry {
+        const key* map_key{nullptr};
+        log_generation generation;
+        model::offset max_offset;
+        size_t max_bytes{0};
+        bool strict_max_bytes{false};
+        read_data result;
+        intrusive_list_hook hook;
+
+        // whether the read stopped at max_offset rather than at max_bytes
+        bool complete() const { return result.last_offset >= max_offset; }
+        bool answers(log_generation, const read_bounds&) const;
+    };
+
+    using map_t = absl::node_hash_map<key, entry>;
+
+    void erase(map_t::iterator);
+    void evict(size_t capacity);
+
+    map_t _entries;
+    intrusive_list<entry, &entry::hook> _lru;
+    size_t _size_bytes{0};
+    uint64_t _hits{0};
+    uint64_t _misses{0};
+};
+
+/// Returns the shard-local fetch response cache.
+inline fetch_response_cache& fetch_responses() {
+    static thread_local fetch_response_cache cache;
+    return cache;
+}
+
+} // namespace kafka
@@ -9,6 +9,7 @@
  * by the Apache License, Version 2.0
  */
 #pragma once
+#include "container/intrusive_list_helpers.h"
 #include "kafka/protocol/errors.h"
 #include "kafka/types.h"
 #include "model/fundamental.h"
@@ -227,6 +228,8 @@ private:
     model::timeout_clock::time_point _last_used;
     fetch_session_epoch _epoch;
     bool _locked;
+    // position in the cache's least recently used order
+    intrusive_list_hook _lru_hook;
 };
 
 using fetch_session_ptr = ss::lw_shared_ptr<fetch_session>;
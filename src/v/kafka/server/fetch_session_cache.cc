@@ -7,6 +7,7 @@
 #include "model/fundamental.h"
 #include "model/timeout_clock.h"
 #include "prometheus/prometheus_sanitize.h"
+#include "resource_mgmt/memory_accounting.h"
 
 #include <seastar/core/metrics.hh>
 
@@ -52,11 +53,14 @@ void update_fetch_session(fetch_session& session, const fetch_request& req) {
 }
 
 fetch_session_cache::fetch_session_cache(
-  std::chrono::milliseconds eviction_timeout)
-  : _min_session_id(max_sessions_per_core() * seastar::this_shard_id())
+  std::chrono::milliseconds eviction_timeout, size_t max_mem_usage)
+  : _max_mem_usage(max_mem_usage)
+  , _min_session_id(max_sessions_per_core() * seastar::this_shard_id())
   , _max_session_id(max_sessions_per_core() + _min_session_id - 1)
   , _last_session_id(_min_session_id)
-  , _session_eviction_duration(eviction_timeout) {
+  , _session_eviction_duration(eviction_timeout)
+  , _mem_tracker(resources::memory_accounting::local().create_tracker(
+      resources::mem_subsystem::fetch_sessions, "fetch_session_cache")) {
     register_metrics();
     _session_eviction_timer.set_callback([this] {
         gc_sessions();
@@ -78,8 +82,7 @@ fetch_session_cache::maybe_get_session(const fetch_request& req) {
         if (session_id != invalid_fetch_session_id) {
             if (auto it = _sessions.find(session_id); it != _sessions.end()) {
                 vlog(klog.debug, "removing fetch session {}", session_id);
-                _sessions_mem_usage -= it->second->mem_usage();
-                _sessions.erase(it);
+                erase(it);
             }
         }
         if (epoch == final_fetch_session_epoch) {
@@ -98,6 +101,13 @@ fetch_session_cache::maybe_get_session(const fetch_request& req) {
         auto new_session = ss::make_lw_shared<fetch_session>(*new_id);
         // initialize fetch session partitions
         update_fetch_session(*new_session, req);
+        if (!make_room(new_session->mem_usage())) {
+            vlog(
+              klog.debug,
+              "not enough memory for a fetch session of {} partitions",
+              new_session->partitions().size());
+            return fetch_session_ctx();
+        }
 
         auto [it, success] = _sessions.emplace(*new_id, std::move(new_session));
         vassert(
@@ -107,7 +117,12 @@ fetch_session_cache::maybe_get_session(const fetch_request& req) {
 
         vlog(klog.debug, "fetch session created: {}", *new_id);
         _sessions_mem_usage += it->second->mem_usage();
-        return fetch_session_ctx(it->second, true);
+        update_tracked_memory();
+        _lru.push_back(*it->second);
+        fetch_session_ctx ctx(it->second, true);
+        // account for the growth of the sessions map
+        make_room(0);
+        return ctx;
     }
     auto it = _sessions.find(session_id);
     if (it == _sessions.end()) {
@@ -127,6 +142,8 @@ fetch_session_cache::maybe_get_session(const fetch_request& req) {
     }
     _sessions_mem_usage -= session->mem_usage();
     update_fetch_session(*session, req);
+    _sessions_mem_usage += session->mem_usage();
+    update_tracked_memory();
     if (session->empty()) {
         vlog(
           klog.info,
@@ -135,20 +152,23 @@ fetch_session_cache::maybe_get_session(const fetch_request& req) {
           session->epoch(),
           epoch);
 
-        _sessions.erase(session_id);
+        erase(it);
         return fetch_session_ctx();
     }
 
     session->advance_epoch();
-    _sessions_mem_usage += session->mem_usage();
-    return fetch_session_ctx(session, false);
+    session->_lru_hook.unlink();
+    _lru.push_back(*session);
+    // the session is locked by its context, so only other sessions are
+    // evicted if it grew over the limit
+    fetch_session_ctx ctx(session, false);
+    make_room(0);
+    return ctx;
 }
 
 // we split whole range from 1 to max int32_t betewen all shards
 std::optional<fetch_session_id> fetch_session_cache::new_session_id() {
-    if (unlikely(
-          mem_usage() > max_mem_usage
-          || _sessions.size() > max_sessions_per_core())) {
+    if (unlikely(_sessions.size() > max_sessions_per_core())) {
         return std::nullopt;
     }
 
@@ -164,19 +184,52 @@ std::optional<fetch_session_id> fetch_session_cache::new_session_id() {
 
 void fetch_session_cache::gc_sessions() {
     auto now = model::timeout_clock::now();
-    for (auto it = _sessions.cbegin(); it != _sessions.cend();) {
-        // session is in use or was used recently skip
-        if (
-          it->second->is_locked()
-          || now - it->second->_last_used < _session_eviction_duration) {
-            // do nothing
-            ++it;
-        } else {
-            vlog(klog.debug, "evicting session {}", it->second->id());
-            _sessions_mem_usage -= it->second->mem_usage();
-            _sessions.erase(it++);
+    for (auto it = _lru.begin(); it != _lru.end();) {
+        auto& session = *it++;
+        // the sessions that follow were used even more recently
+        if (now - session._last_used < _session_eviction_duration) {
+            break;
+        }
+        // session is in use, skip
+        if (session.is_locked()) {
+            continue;
+        }
+        vlog(klog.debug, "evicting session {}", session.id());
+        erase(_sessions.find(session.id()));
+    }
+}
+
+bool fetch_session_cache::make_room(size_t bytes) {
+    if (bytes > _max_mem_usage) {
+        return false;
+    }
+    for (auto it = _lru.begin();
+         mem_usage() + bytes > _max_mem_usage && it != _lru.end();) {
+        auto& session = *it++;
+        if (session.is_locked()) {
+            continue;
         }
+        vlog(
+          klog.debug,
+          "evicting session {} to stay within {} bytes",
+          session.id(),
+          _max_mem_usage);
+        ++_evictions;
+        erase(_sessions.find(session.id()));
     }
+    return mem_usage() + bytes <= _max_mem_usage;
+}
+
+void fetch_session_cache::erase(underlying_t::iterator it) {
+    _sessions_mem_usage -= it->second->mem_usage();
+    it->second->_lru_hook.unlink();
+    _sessions.erase(it);
+    update_tracked_memory();
+}
+
+void fetch_session_cache::update_tracked_memory() {
+    _mem_tracker->deallocate(_mem_tracker->consumption());
+    _mem_tracker->allocate(static_cast<int64_t>(mem_usage()));
 }
 
 void fetch_session_cache::register_metrics() {
@@ -194,7 +247,13 @@ void fetch_session_cache::register_metrics() {
        sm::make_gauge(
          "sessions_count",
          [this] { return _sessions.size(); },
-         sm::description("Total number of fetch sessions"))});
+         sm::description("Total number of fetch sessions")),
+       sm::make_counter(
+         "evicted_sessions",
+         [this] { return _evictions; },
+         sm::description(
+           "Number of fetch sessions evicted to stay within the cache memory "
+           "limit"))});
 }
 
 } // namespace kafka
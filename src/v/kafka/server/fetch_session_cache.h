@@ -14,6 +14,7 @@
 #include "kafka/server/fetch_session.h"
 #include "kafka/types.h"
 #include "metrics/metrics.h"
+#include "utils/tracking_allocator.h"
 
 #include <seastar/core/metrics_registration.hh>
 #include <seastar/core/smp.hh>
@@ -31,21 +32,32 @@ struct fetch_request;
  * for the node (non overlapping ranges of ids are assigned to each core).
  *
  * The cache evicts not used sessions after configurable period of inactivity.
- * Fetch session cache will stop adding new sessions after its max memory usage
- * is reached.
+ * Its memory usage is bounded in bytes: when adding or growing a session would
+ * exceed the limit, the least recently used sessions that are not in use are
+ * evicted to make room. A new session is not created if there is not enough
+ * room even then.
  **/
 class fetch_session_cache {
 public:
-    explicit fetch_session_cache(std::chrono::milliseconds);
+    static constexpr size_t default_max_mem_usage = 10_MiB;
+
+    explicit fetch_session_cache(
+      std::chrono::milliseconds, size_t max_mem_usage = default_max_mem_usage);
     fetch_session_ctx maybe_get_session(const fetch_request& req);
     size_t size() const { return _sessions.size(); }
 
+    size_t mem_usage() const {
+        using debug = absl::container_internal::hashtable_debug_internal::
+          HashtableDebugAccess<underlying_t>;
+        return debug::AllocatedByteSize(_sessions) + _sessions_mem_usage;
+    }
+
+    uint64_t evictions() const { return _evictions; }
+
 private:
     using underlying_t
       = absl::flat_hash_map<fetch_session_id, fetch_session_ptr>;
 
-    static constexpr size_t max_mem_usage = 10_MiB;
-
     // used to split range of possible session ids to limit memory size we use
     // max_mem_used, this is theoretical limit, the actual number of session
     // held in a cache on single core is limitted by the memory usage.
@@ -57,16 +69,19 @@ private:
 
     std::optional<fetch_session_id> new_session_id();
     void gc_sessions();
-
-    size_t mem_usage() const {
-        using debug = absl::container_internal::hashtable_debug_internal::
-          HashtableDebugAccess<underlying_t>;
-        return debug::AllocatedByteSize(_sessions) + _sessions_mem_usage;
-    }
+    /// Evicts idle sessions until \p bytes more fit in the memory limit,
+    /// returns false if they do not.
+    bool make_room(size_t bytes);
+    void erase(underlying_t::iterator);
+    /// Reports the current mem_usage() to the memory tracker.
+    void update_tracked_memory();
 
     void register_metrics();
 
     underlying_t _sessions;
+    // sessions ordered by the time they were last used
+    intrusive_list<fetch_session, &fetch_session::_lru_hook> _lru;
+    const size_t _max_mem_usage;
     const fetch_session_id _min_session_id;
     const fetch_session_id _max_session_id;
     fetch_session_id _last_session_id;
@@ -76,6 +91,8 @@ private:
     std::chrono::milliseconds _session_eviction_duration;
 
     size_t _sessions_mem_usage = 0;
+    uint64_t _evictions = 0;
+    ss::shared_ptr<util::mem_tracker> _mem_tracker;
 
     metrics::internal_metric_groups _metrics;
 };
@@ -14,12 +14,14 @@
 namespace kafka {
 
 // sorted
+class compression_advisor;
 class connection_context;
 class coordinator_ntp_mapper;
 class fetch_session_cache;
 class group_manager;
 class group_router;
 class partition_proxy;
+struct process_result_stages;
 class quota_manager;
 class request_context;
 class response;
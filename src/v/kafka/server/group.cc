@@ -25,6 +25,7 @@
 #include "kafka/server/group_metadata.h"
 #include "kafka/server/logger.h"
 #include "kafka/server/member.h"
+#include "kafka/server/offset_commit_batcher.h"
 #include "kafka/types.h"
 #include "model/fundamental.h"
 #include "model/namespace.h"
@@ -66,7 +67,7 @@ group::group(
   , _conf(conf)
   , _catchup_lock(std::move(catchup_lock))
   , _partition(std::move(partition))
-  , _probe(_members, _static_members, _offsets)
+  , _probe(_members, _static_members, _offsets, _consumer_lag)
   , _ctxlog(klog, *this)
   , _ctx_txlog(cluster::txlog, *this)
   , _md_serializer(std::move(serializer))
@@ -109,7 +110,7 @@ group::group(
   , _conf(conf)
   , _catchup_lock(std::move(catchup_lock))
   , _partition(std::move(partition))
-  , _probe(_members, _static_members, _offsets)
+  , _probe(_members, _static_members, _offsets, _consumer_lag)
   , _ctxlog(klog, *this)
   , _ctx_txlog(cluster::txlog, *this)
   , _md_serializer(std::move(serializer))
@@ -2287,12 +2288,16 @@ group::offset_commit_stages group::store_offsets(offset_commit_request&& r) {
     }
 
     auto batch = std::move(builder).build();
-    auto reader = model::make_memory_record_batch_reader(std::move(batch));
-
-    auto replicate_stages = _partition->raft()->replicate_in_stages(
-      _term,
-      std::move(reader),
-      raft::replicate_options(raft::consistency_level::quorum_ack));
+    auto replicate_stages = [this, &batch] {
+        if (config::shard_local_cfg().group_coalesce_offset_commits()) {
+            return offset_commit_batching().replicate(
+              _partition, _term, std::move(batch));
+        }
+        return _partition->raft()->replicate_in_stages(
+          _term,
+          model::make_memory_record_batch_reader(std::move(batch)),
+          raft::replicate_options(raft::consistency_level::quorum_ack));
+    }();
 
     auto f = replicate_stages.replicate_finished.then(
       [this, req = std::move(r), commits = std::move(offset_commits)](
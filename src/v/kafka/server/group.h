@@ -177,18 +177,21 @@ public:
 
     struct offset_metadata_with_probe {
         offset_metadata metadata;
-        group_offset_probe probe;
+        // only allocated with group metrics enabled, groups committing
+        // offsets of many partitions would otherwise pay for an unused probe
+        // per partition
+        std::unique_ptr<group_offset_probe> probe;
 
         offset_metadata_with_probe(
           offset_metadata _metadata,
           const kafka::group_id& group_id,
           const model::topic_partition& tp,
           enable_group_metrics enable_metrics)
-          : metadata(std::move(_metadata))
-          , probe(metadata.offset) {
+          : metadata(std::move(_metadata)) {
             if (enable_metrics) {
-                probe.setup_metrics(group_id, tp);
-                probe.setup_public_metrics(group_id, tp);
+                probe = std::make_unique<group_offset_probe>(metadata.offset);
+                probe->setup_metrics(group_id, tp);
+                probe->setup_public_metrics(group_id, tp);
             }
         }
     };
@@ -524,6 +527,10 @@ public:
 
     const auto& offsets() const { return _offsets; }
 
+    /// Lag of the group as of the last refresh by the group manager.
+    const group_consumer_lag& consumer_lag() const { return _consumer_lag; }
+    void set_consumer_lag(group_consumer_lag lag) { _consumer_lag = lag; }
+
     void complete_offset_commit(
       const model::topic_partition& tp, const offset_metadata& md);
 
@@ -575,6 +582,8 @@ public:
         }
     }
 
+    void reserve_offsets(size_t n) { _offsets.reserve(_offsets.size() + n); }
+
     bool try_upsert_offset(model::topic_partition tp, offset_metadata md) {
         if (auto o_it = _offsets.find(tp); o_it != _offsets.end()) {
             if (o_it->second->metadata.log_offset < md.log_offset) {
@@ -916,6 +925,7 @@ private:
       model::topic_partition,
       std::unique_ptr<offset_metadata_with_probe>>
       _offsets;
+    group_consumer_lag _consumer_lag;
     group_probe<
       model::topic_partition,
       std::unique_ptr<offset_metadata_with_probe>>
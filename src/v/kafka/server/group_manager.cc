@@ -29,6 +29,7 @@
 #include "kafka/server/group_recovery_consumer.h"
 #include "kafka/server/logger.h"
 #include "model/fundamental.h"
+#include "model/ktp.h"
 #include "model/namespace.h"
 #include "model/record.h"
 #include "raft/errc.h"
@@ -42,6 +43,9 @@
 #include <seastar/util/defer.hh>
 #include <seastar/util/later.hh>
 
+#include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
+
 #include <system_error>
 
 using cluster::cloud_metadata::group_offsets;
@@ -140,6 +144,23 @@ ss::future<> group_manager::start() {
         }
     });
 
+    /*
+     * periodically refresh the lag of the groups, with a single hop to each
+     * shard to read the high watermarks of the partitions replicated on it.
+     */
+    if (const auto refresh = _conf.group_consumer_lag_refresh_ms(); refresh) {
+        _lag_timer.set_callback([this, refresh = *refresh] {
+            ssx::spawn_with_gate(_gate, [this, refresh] {
+                return update_consumer_lag().finally([this, refresh] {
+                    if (!_gate.is_closed()) {
+                        _lag_timer.arm(refresh);
+                    }
+                });
+            });
+        });
+        _lag_timer.arm(*refresh);
+    }
+
     return ss::make_ready_future<>();
 }
 /*
@@ -231,6 +252,66 @@ std::optional<std::chrono::seconds> group_manager::offset_retention_enabled() {
     return config::shard_local_cfg().group_offset_retention_sec().value();
 }
 
+ss::future<> group_manager::update_consumer_lag() {
+    using high_watermarks
+      = absl::flat_hash_map<model::topic_partition, model::offset>;
+
+    absl::flat_hash_set<model::topic_partition> tps;
+    for (const auto& group : _groups) {
+        for (const auto& offset : group.second->offsets()) {
+            tps.insert(offset.first);
+        }
+    }
+    if (tps.empty()) {
+        co_return;
+    }
+
+    // the partitions led by other brokers are usually replicated on this one
+    // as well, with a high watermark trailing the leader's by a heartbeat.
+    auto hwms = co_await _pm.map_reduce0(
+      [&tps](cluster::partition_manager& pm) {
+          high_watermarks found;
+          for (const auto& tp : tps) {
+              if (auto p = pm.get(model::ktp(tp.topic, tp.partition)); p) {
+                  found.emplace(tp, p->high_watermark());
+              }
+          }
+          return found;
+      },
+      high_watermarks{},
+      [](high_watermarks acc, high_watermarks shard) {
+          acc.merge(std::move(shard));
+          return acc;
+      });
+
+    for (auto& group : _groups) {
+        group_consumer_lag lag;
+        for (const auto& offset : group.second->offsets()) {
+            auto it = hwms.find(offset.first);
+            if (it == hwms.end()) {
+                ++lag.unknown_partitions;
+                continue;
+            }
+            const auto committed = offset.second->metadata.offset;
+            const auto partition_lag = std::max<int64_t>(
+              it->second() - std::max<int64_t>(committed(), 0), 0);
+            lag.total += partition_lag;
+            lag.max = std::max(lag.max, partition_lag);
+        }
+        group.second->set_consumer_lag(lag);
+    }
+}
+
+std::vector<std::pair<group_id, group_consumer_lag>>
+group_manager::consumer_lag() const {
+    std::vector<std::pair<group_id, group_consumer_lag>> lags;
+    lags.reserve(_groups.size());
+    for (const auto& group : _groups) {
+        lags.emplace_back(group.first, group.second->consumer_lag());
+    }
+    return lags;
+}
+
 ss::future<> group_manager::handle_offset_expiration() {
     constexpr int max_concurrent_expirations = 10;
 
@@ -393,6 +474,7 @@ ss::future<> group_manager::stop() {
     }
 
     _timer.cancel();
+    _lag_timer.cancel();
 
     return _gate.close().then([this]() {
         /**
@@ -930,21 +1012,32 @@ ss::future<> group_manager::do_recover_group(
             group->reschedule_all_member_heartbeats();
         }
 
-        for (auto& [tp, meta] : group_stm.offsets()) {
+        const bool has_offsets = !group_stm.offsets().empty();
+        /*
+         * the offsets are moved out of the recovered state rather than copied,
+         * and recovering the offsets of groups consuming many partitions must
+         * not stall the reactor
+         */
+        auto& offsets = group_stm.offsets();
+        group->reserve_offsets(offsets.size());
+        while (!offsets.empty()) {
+            auto node = offsets.extract(offsets.begin());
+            auto& meta = node.mapped();
             const auto expiry_timestamp
               = meta.metadata.expiry_timestamp == model::timestamp(-1)
                   ? std::optional<model::timestamp>(std::nullopt)
                   : meta.metadata.expiry_timestamp;
             group->try_upsert_offset(
-              tp,
+              std::move(node.key()),
               group::offset_metadata{
                 .log_offset = meta.log_offset,
                 .offset = meta.metadata.offset,
-                .metadata = meta.metadata.metadata,
+                .metadata = std::move(meta.metadata.metadata),
                 .commit_timestamp = meta.metadata.commit_timestamp,
                 .expiry_timestamp = expiry_timestamp,
                 .non_reclaimable = meta.metadata.non_reclaimable,
               });
+            co_await ss::maybe_yield();
         }
 
         for (const auto& [_, tx] : group_stm.prepared_txs()) {
@@ -961,7 +1054,7 @@ ss::future<> group_manager::do_recover_group(
         }
 
         if (group_stm.is_removed()) {
-            if (group_stm.offsets().size() > 0) {
+            if (has_offsets) {
                 klog.warn(
                   "Unexpected active group unload {} while loading {}",
                   group_id,
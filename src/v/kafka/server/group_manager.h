@@ -180,6 +180,10 @@ public:
 
     ss::future<> reload_groups();
 
+    // Returns the lag of the groups managed on this shard as of the last
+    // refresh, see `group_consumer_lag_refresh_ms`.
+    std::vector<std::pair<group_id, group_consumer_lag>> consumer_lag() const;
+
     // Returns the groups being managed by the attached partition of the given
     // NTP, returning an error if the partition is not serving groups on this
     // shard (e.g. not leader, still loading groups, etc).
@@ -214,6 +218,9 @@ private:
     ss::future<> do_detach_partition(model::ntp);
 
     struct attached_partition {
+        static inline const lock_class catchup_lock_class{
+          "group_catchup_lock"};
+
         bool loading;
         ssx::semaphore sem{1, "k/group-mgr"};
         ss::abort_source as;
@@ -224,7 +231,8 @@ private:
         explicit attached_partition(ss::lw_shared_ptr<cluster::partition> p)
           : loading(true)
           , partition(std::move(p)) {
-            catchup_lock = ss::make_lw_shared<ssx::rwlock>();
+            catchup_lock = ss::make_lw_shared<ssx::rwlock>(
+              catchup_lock_class);
         }
     };
 
@@ -289,6 +297,9 @@ private:
     ss::timer<> _timer;
     ss::future<> handle_offset_expiration();
     ss::future<size_t> delete_expired_offsets(group_ptr, std::chrono::seconds);
+
+    ss::timer<> _lag_timer;
+    ss::future<> update_consumer_lag();
     ss::sharded<raft::group_manager>& _gm;
     ss::sharded<cluster::partition_manager>& _pm;
     ss::sharded<cluster::topic_table>& _topic_table;
@@ -124,6 +124,9 @@ public:
     offsets() const {
         return _offsets;
     }
+    absl::node_hash_map<model::topic_partition, logged_metadata>& offsets() {
+        return _offsets;
+    }
 
     const absl::node_hash_map<model::producer_id, model::producer_epoch>&
     fences() const {
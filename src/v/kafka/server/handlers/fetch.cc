@@ -10,14 +10,17 @@
 #include "kafka/server/handlers/fetch.h"
 
 #include "base/likely.h"
+#include "bytes/foreign_iobuf.h"
 #include "cluster/metadata_cache.h"
 #include "cluster/partition_manager.h"
 #include "cluster/shard_table.h"
 #include "config/configuration.h"
+#include "config/hot_path.h"
 #include "kafka/latency_probe.h"
 #include "kafka/protocol/batch_consumer.h"
 #include "kafka/protocol/errors.h"
 #include "kafka/protocol/fetch.h"
+#include "kafka/server/fetch_response_cache.h"
 #include "kafka/server/fetch_session.h"
 #include "kafka/server/fwd.h"
 #include "kafka/server/handlers/details/leader_epoch.h"
@@ -33,6 +36,7 @@
 #include "net/connection.h"
 #include "random/generators.h"
 #include "resource_mgmt/io_priority.h"
+#include "ssx/future-util.h"
 #include "ssx/semaphore.h"
 #include "storage/parser_utils.h"
 #include "utils/to_string.h"
@@ -44,6 +48,7 @@
 #include <seastar/core/thread.hh>
 #include <seastar/core/when_any.hh>
 #include <seastar/core/with_scheduling_group.hh>
+#include <seastar/util/later.hh>
 #include <seastar/util/log.hh>
 
 #include <boost/range/irange.hpp>
@@ -77,7 +82,8 @@ static ss::future<read_result> read_from_partition(
   kafka::partition_proxy part,
   fetch_config config,
   bool foreign_read,
-  std::optional<model::timeout_clock::time_point> deadline) {
+  std::optional<model::timeout_clock::time_point> deadline,
+  std::optional<fetch_response_cache::log_generation> generation) {
     auto lso = part.last_stable_offset();
     if (unlikely(!lso)) {
         co_return read_result(lso.error());
@@ -91,63 +97,99 @@ static ss::future<read_result> read_from_partition(
         co_return read_result(start_o, hw, lso.value());
     }
 
-    storage::log_reader_config reader_config(
-      config.start_offset,
-      config.max_offset,
-      0,
-      config.max_bytes,
-      kafka_read_priority(),
-      std::nullopt,
-      std::nullopt,
-      config.abort_source.has_value()
-        ? config.abort_source.value().get().local()
-        : storage::opt_abort_source_t{},
-      config.client_address);
-
-    reader_config.strict_max_bytes = config.strict_max_bytes;
-    auto rdr = co_await part.make_reader(reader_config);
-    std::exception_ptr e;
+    const fetch_response_cache::read_bounds bounds{
+      .start_offset = config.start_offset,
+      .max_offset = config.max_offset,
+      .isolation_level = config.isolation_level,
+      .max_bytes = config.max_bytes,
+      .strict_max_bytes = config.strict_max_bytes,
+    };
     std::unique_ptr<iobuf> data;
+    uint32_t record_count = 0;
     std::vector<cluster::rm_stm::tx_range> aborted_transactions;
-    try {
-        auto result = co_await rdr.reader.consume(
-          kafka_batch_serializer(), deadline ? *deadline : model::no_timeout);
-        data = std::make_unique<iobuf>(std::move(result.data));
-        part.probe().add_records_fetched(result.record_count);
-        part.probe().add_bytes_fetched(data->size_bytes());
-        if (!part.is_leader() && config.read_from_follower) {
-            part.probe().add_bytes_fetched_from_follower(data->size_bytes());
-        }
+    std::optional<fetch_response_cache::read_data> cached;
+    if (generation) {
+        cached = fetch_responses().get(part.ntp(), *generation, bounds);
+    }
+    if (cached) {
+        // another fetch already read and encoded this range
+        data = std::make_unique<iobuf>(std::move(cached->data));
+        record_count = cached->record_count;
+        aborted_transactions = std::move(cached->aborted_transactions);
+    } else {
+        storage::log_reader_config reader_config(
+          config.start_offset,
+          config.max_offset,
+          0,
+          config.max_bytes,
+          kafka_read_priority(),
+          std::nullopt,
+          std::nullopt,
+          config.abort_source.has_value()
+            ? config.abort_source.value().get().local()
+            : storage::opt_abort_source_t{},
+          config.client_address);
+
+        reader_config.strict_max_bytes = config.strict_max_bytes;
+        reader_config.client_id = config.client_id;
+        auto rdr = co_await part.make_reader(reader_config);
+        std::exception_ptr e;
+        try {
+            auto result = co_await rdr.reader.consume(
+              kafka_batch_serializer(),
+              deadline ? *deadline : model::no_timeout);
+            data = std::make_unique<iobuf>(std::move(result.data));
+            record_count = result.record_count;
+
+            if (result.first_tx_batch_offset && result.record_count > 0) {
+                // Reader should live at least until this point to hold on to
+                // the segment locks so that prefix truncation doesn't happen.
+                aborted_transactions = co_await part.aborted_transactions(
+                  result.first_tx_batch_offset.value(),
+                  result.last_offset,
+                  std::move(rdr.ot_state));
+
+                // Check that the underlying data did not get truncated while
+                // consuming. If so, it's possible the search for aborted
+                // transactions missed out on transactions that correspond to
+                // the read batches.
+                auto start_o = part.start_offset();
+                if (config.start_offset < start_o) {
+                    co_return read_result(
+                      error_code::offset_out_of_range,
+                      start_o,
+                      part.high_watermark());
+                }
+            }
 
-        if (result.first_tx_batch_offset && result.record_count > 0) {
-            // Reader should live at least until this point to hold on to the
-            // segment locks so that prefix truncation doesn't happen.
-            aborted_transactions = co_await part.aborted_transactions(
-              result.first_tx_batch_offset.value(),
-              result.last_offset,
-              std::move(rdr.ot_state));
-
-            // Check that the underlying data did not get truncated while
-            // consuming. If so, it's possible the search for aborted
-            // transactions missed out on transactions that correspond to the
-            // read batches.
-            auto start_o = part.start_offset();
-            if (config.start_offset < start_o) {
-                co_return read_result(
-                  error_code::offset_out_of_range,
-                  start_o,
-                  part.high_watermark());
+            if (generation) {
+                fetch_responses().put(
+                  part.ntp(),
+                  *generation,
+                  bounds,
+                  {
+                    .data = data->share(0, data->size_bytes()),
+                    .record_count = result.record_count,
+                    .last_offset = result.last_offset,
+                    .first_tx_batch_offset = result.first_tx_batch_offset,
+                    .aborted_transactions = aborted_transactions,
+                  });
             }
+        } catch (...) {
+            e = std::current_exception();
         }
 
-    } catch (...) {
-        e = std::current_exception();
-    }
+        co_await std::move(rdr.reader).release()->finally();
 
-    co_await std::move(rdr.reader).release()->finally();
+        if (e) {
+            std::rethrow_exception(e);
+        }
+    }
 
-    if (e) {
-        std::rethrow_exception(e);
+    part.probe().add_records_fetched(record_count);
+    part.probe().add_bytes_fetched(data->size_bytes());
+    if (!part.is_leader() && config.read_from_follower) {
+        part.probe().add_bytes_fetched_from_follower(data->size_bytes());
     }
 
     if (foreign_read) {
@@ -193,6 +235,15 @@ void read_result::memory_units_t::adopt(memory_units_t&& o) {
     fetch.adopt(std::move(o.fetch));
 }
 
+iobuf read_result::share_data() && {
+    if (!std::holds_alternative<foreign_data_t>(data)) {
+        return std::move(*this).release_data();
+    }
+    auto& foreign = std::get<foreign_data_t>(data);
+    const iobuf& buf = *foreign;
+    return share_foreign_iobuf(buf, std::move(foreign));
+}
+
 /**
  * Consume proper amounts of units from memory semaphores and return them as
  * semaphore_units. Fetch semaphore units returned are the indication of
@@ -214,7 +265,7 @@ static read_result::memory_units_t reserve_memory_units(
     const size_t memory_kafka_now = memory_sem.current();
     const size_t memory_fetch = memory_fetch_sem.current();
     const size_t batch_size_estimate
-      = config::shard_local_cfg().kafka_memory_batch_size_estimate_for_fetch();
+      = config::hot_path().kafka_memory_batch_size_estimate_for_fetch;
 
     if (obligatory_batch_read) {
         // cap what we want at what we have, but no further down than a single
@@ -345,7 +396,7 @@ static ss::future<read_result> do_read_from_ntp(
           kafka_partition->high_watermark());
     }
     if (
-      config::shard_local_cfg().enable_rack_awareness.value()
+      config::hot_path().enable_rack_awareness
       && ntp_config.cfg.consumer_rack_id && kafka_partition->is_leader()) {
         auto p_info_res = kafka_partition->get_partition_info();
         if (p_info_res.has_error()) {
@@ -376,8 +427,21 @@ static ss::future<read_result> do_read_from_ntp(
               preferred_replica);
         }
     }
+    std::optional<fetch_response_cache::log_generation> generation;
+    if (fetch_responses().enabled()) {
+        if (auto p = cluster_pm.get(ntp_config.ktp()); p) {
+            generation = fetch_response_cache::log_generation{
+              .revision = p->get_log_revision_id(),
+              .truncations = p->log()->get_log_truncation_counter(),
+            };
+        }
+    }
     read_result result = co_await read_from_partition(
-      std::move(*kafka_partition), ntp_config.cfg, foreign_read, deadline);
+      std::move(*kafka_partition),
+      ntp_config.cfg,
+      foreign_read,
+      deadline,
+      generation);
 
     adjust_memory_units(
       memory_sem, memory_fetch_sem, memory_units, result.data_size_bytes());
@@ -438,6 +502,9 @@ static void fill_fetch_responses(
           0, std::min({results.size(), responses.size()}));
     }
 
+    const bool share_foreign_data
+      = config::hot_path().fetch_coalesce_cross_shard_reads;
+
     // Used to aggregate semaphore_units from results.
     std::optional<read_result::memory_units_t> total_memory_units;
 
@@ -512,7 +579,9 @@ static void fill_fetch_responses(
                   });
                 resp.aborted = std::move(aborted);
             }
-            resp.records = batch_reader(std::move(res).release_data());
+            resp.records = batch_reader(
+              share_foreign_data ? std::move(res).share_data()
+                                 : std::move(res).release_data());
         } else {
             // TODO: add probe to measure how much of read data is discarded
             resp.records = batch_reader();
@@ -543,7 +612,7 @@ static ss::future<std::vector<read_result>> fetch_ntps_in_parallel(
     // bytes_left comes from the fetch plan and also accounts for the max_bytes
     // field in the fetch request
     const size_t max_bytes_per_fetch = std::min<size_t>(
-      config::shard_local_cfg().kafka_max_bytes_per_fetch(), bytes_left);
+      config::hot_path().kafka_max_bytes_per_fetch, bytes_left);
     if (total_max_bytes > max_bytes_per_fetch) {
         auto per_partition = max_bytes_per_fetch / ntp_fetch_configs.size();
         vlog(
@@ -608,6 +677,158 @@ bool shard_fetch::empty() const {
     return requests.empty();
 }
 
+namespace {
+/**
+ * Per-shard queue of the reads that the fetch requests coordinated on this
+ * shard issue to other shards.
+ *
+ * Each read pass of a fetch request reads its partitions with one cross shard
+ * call per shard holding any of them. With many small concurrent fetches the
+ * cost of these calls dominates that of the reads. When
+ * `fetch_coalesce_cross_shard_reads` is enabled, the reads queued for a shard
+ * within a reactor tick are sent to it in a single call, which returns all
+ * their results.
+ */
+class shard_fetch_dispatcher {
+public:
+    shard_fetch_dispatcher()
+      : _queues(ss::smp::count) {}
+
+    /**
+     * Read \p configs on \p shard on behalf of \p octx, which must stay
+     * alive until the returned future resolves.
+     */
+    ss::future<std::vector<read_result>> dispatch(
+      ss::shard_id shard,
+      op_context& octx,
+      std::vector<ntp_fetch_config> configs) {
+        auto& queue = _queues[shard];
+        auto& read = queue.emplace_back(
+          pending_read{.octx = &octx, .configs = std::move(configs)});
+        auto f = read.result.get_future();
+        if (queue.size() == 1) {
+            ssx::background = send(shard);
+        }
+        return f;
+    }
+
+private:
+    struct pending_read {
+        op_context* octx{nullptr};
+        std::vector<ntp_fetch_config> configs;
+        ss::promise<std::vector<read_result>> result;
+    };
+
+    /// The outcome of a single read, passed back to the coordinator shard.
+    struct read_outcome {
+        std::vector<read_result> results;
+        std::exception_ptr error;
+    };
+
+    ss::future<> send(ss::shard_id shard) {
+        // let the fetches being executed in this tick join the call
+        co_await ss::yield();
+        auto batch = std::exchange(_queues[shard], {});
+        auto& front = *batch.front().octx;
+        try {
+            // the batch is accessed on the remote shard only to read the
+            // configs and the shard local services of each request
+            auto outcomes = co_await front.rctx.partition_manager().invoke_on(
+              shard, front.ssg, [&batch](cluster::partition_manager& mgr) {
+                  return read_batch(mgr, batch);
+              });
+            for (size_t i = 0; i < batch.size(); ++i) {
+                if (outcomes[i].error) {
+                    batch[i].result.set_exception(outcomes[i].error);
+                } else {
+                    batch[i].result.set_value(std::move(outcomes[i].results));
+                }
+            }
+        } catch (...) {
+            auto e = std::current_exception();
+            for (auto& read : batch) {
+                read.result.set_exception(e);
+            }
+        }
+    }
+
+    static ss::future<std::vector<read_outcome>> read_batch(
+      cluster::partition_manager& mgr, std::vector<pending_read>& batch) {
+        std::vector<read_outcome> outcomes(batch.size());
+        co_await ss::parallel_for_each(
+          boost::irange<size_t>(0, batch.size()),
+          [&mgr, &batch, &outcomes](size_t i) {
+              return read(mgr, batch[i]).then([&outcomes, i](read_outcome o) {
+                  outcomes[i] = std::move(o);
+              });
+          });
+        co_return outcomes;
+    }
+
+    static ss::future<read_outcome>
+    read(cluster::partition_manager& mgr, pending_read& pending) {
+        auto& octx = *pending.octx;
+        read_outcome outcome;
+        try {
+            outcome.results = co_await fetch_ntps_in_parallel(
+              mgr,
+              octx.rctx.server().local().get_replica_selector(),
+              std::move(pending.configs),
+              true,
+              octx.deadline,
+              octx.bytes_left,
+              octx.rctx.server().local().memory(),
+              octx.rctx.server().local().memory_fetch_sem());
+        } catch (...) {
+            outcome.error = std::current_exception();
+        }
+        co_return outcome;
+    }
+
+    std::vector<std::vector<pending_read>> _queues;
+};
+
+shard_fetch_dispatcher& shard_fetch_dispatch() {
+    static thread_local shard_fetch_dispatcher dispatcher;
+    return dispatcher;
+}
+} // namespace
+
+/**
+ * Reads \p configs on \p shard, through the shard fetch dispatcher when the
+ * reads of concurrent fetches are coalesced.
+ */
+static ss::future<std::vector<read_result>> read_from_shard(
+  ss::shard_id shard,
+  op_context& octx,
+  std::vector<ntp_fetch_config> configs) {
+    const bool foreign_read = shard != ss::this_shard_id();
+    if (
+      foreign_read && config::hot_path().fetch_coalesce_cross_shard_reads) {
+        return shard_fetch_dispatch().dispatch(shard, octx, std::move(configs));
+    }
+
+    // dispatch to remote core
+    return octx.rctx.partition_manager().invoke_on(
+      shard,
+      octx.ssg,
+      [foreign_read, configs = std::move(configs), &octx](
+        cluster::partition_manager& mgr) mutable {
+          // &octx is captured only to immediately use its accessors here so
+          // that there is a list of all objects accessed next to `invoke_on`.
+          // This is meant to help avoiding unintended cross shard access
+          return fetch_ntps_in_parallel(
+            mgr,
+            octx.rctx.server().local().get_replica_selector(),
+            std::move(configs),
+            foreign_read,
+            octx.deadline,
+            octx.bytes_left,
+            octx.rctx.server().local().memory(),
+            octx.rctx.server().local().memory_fetch_sem());
+      });
+}
+
 /**
  * Top-level handler for fetching from single shard. The result is
  * unwrapped and any errors from the storage sub-system are translated
@@ -626,28 +847,7 @@ handle_shard_fetch(ss::shard_id shard, op_context& octx, shard_fetch fetch) {
         return ss::now();
     }
 
-    const bool foreign_read = shard != ss::this_shard_id();
-
-    // dispatch to remote core
-    return octx.rctx.partition_manager()
-      .invoke_on(
-        shard,
-        octx.ssg,
-        [foreign_read, configs = std::move(fetch.requests), &octx](
-          cluster::partition_manager& mgr) mutable {
-            // &octx is captured only to immediately use its accessors here so
-            // that there is a list of all objects accessed next to `invoke_on`.
-            // This is meant to help avoiding unintended cross shard access
-            return fetch_ntps_in_parallel(
-              mgr,
-              octx.rctx.server().local().get_replica_selector(),
-              std::move(configs),
-              foreign_read,
-              octx.deadline,
-              octx.bytes_left,
-              octx.rctx.server().local().memory(),
-              octx.rctx.server().local().memory_fetch_sem());
-        })
+    return read_from_shard(shard, octx, std::move(fetch.requests))
       .then([responses = std::move(fetch.responses),
              start_time = fetch.start_time,
              &octx](std::vector<read_result> results) mutable {
@@ -747,9 +947,14 @@ private:
     // every request in `_ctx.requests`. Its used to register waiters with
     // `consensus->visible_offset_monitor()`.
     std::vector<model::offset> _last_visible_indexes;
+    // The last stable offset observed for every read_committed request in
+    // `_ctx.requests`, so that its waiter only wakes the worker once the
+    // stable offset advances too.
+    std::vector<model::offset> _last_stable_offsets;
 
     struct query_results {
         std::vector<model::offset> last_visible_indexes;
+        std::vector<model::offset> last_stable_offsets;
         // Indicates if any `read_result` in `results` has an error.
         bool has_error;
         std::vector<read_result> results;
@@ -770,6 +975,7 @@ private:
         // are produced to without acks=all. The `last_visible_index` more
         // closely corresponds to the Kafka high watermark as well.
         std::vector<model::offset> last_visible_indexes(requests.size());
+        std::vector<model::offset> last_stable_offsets(requests.size());
         std::vector<std::tuple<size_t, model::partition_id>> errored_partitions;
         size_t total_size{0};
         bool has_error{false};
@@ -787,6 +993,13 @@ private:
                 continue;
             }
             last_visible_indexes[i] = consensus->last_visible_index();
+            if (waits_for_stable_offset(req)) {
+                auto lso = make_partition_proxy(req.ktp(), _ctx.mgr)
+                             ->last_stable_offset();
+                if (lso) {
+                    last_stable_offsets[i] = lso.value();
+                }
+            }
         }
 
         // A read_result needs to be returned for every partition. Hence,
@@ -819,12 +1032,63 @@ private:
 
         co_return query_results{
           .last_visible_indexes = std::move(last_visible_indexes),
+          .last_stable_offsets = std::move(last_stable_offsets),
           .has_error = has_error,
           .results = std::move(results),
           .total_size = total_size,
         };
     }
 
+    static bool waits_for_stable_offset(const ntp_fetch_config& req) {
+        return req.cfg.isolation_level == model::isolation_level::read_committed
+               && config::shard_local_cfg().enable_transactions();
+    }
+
+    /**
+     * Waits until the partition of `_ctx.requests[i]` has data the request
+     * has not read yet: its last visible offset advanced and, for a
+     * read_committed request, so did its last stable offset. While a
+     * transaction holds the stable offset back, appends to the partition do
+     * not wake the worker. The stable offset may also advance a little after
+     * the data that unblocks it becomes visible, so it is re-checked at the
+     * debounce interval while the request waits on it.
+     */
+    ss::future<> wait_for_new_data(size_t i) {
+        const auto& req = _ctx.requests[i];
+        auto offset = model::next_offset(_last_visible_indexes[i]);
+        auto timeout = model::no_timeout;
+        for (;;) {
+            auto part = _ctx.mgr.get(req.ktp());
+            if (!part || !part->raft()) {
+                // the re-query reports the partition as moved
+                co_return;
+            }
+            auto waiter = part->raft()->visible_offset_monitor().wait(
+              offset, timeout, _as);
+            part = nullptr;
+            try {
+                co_await std::move(waiter);
+            } catch (const ss::timed_out_error&) {
+                // check the stable offset again
+            }
+            if (!waits_for_stable_offset(req)) {
+                co_return;
+            }
+            part = _ctx.mgr.get(req.ktp());
+            if (!part || !part->raft()) {
+                co_return;
+            }
+            auto lso = make_partition_proxy(req.ktp(), _ctx.mgr)
+                         ->last_stable_offset();
+            if (!lso || lso.value() > _last_stable_offsets[i]) {
+                co_return;
+            }
+            offset = model::next_offset(part->raft()->last_visible_index());
+            timeout = model::timeout_clock::now()
+                      + config::hot_path().fetch_reads_debounce_timeout;
+        }
+    }
+
     // Registers a `visible_offset_monitor` waiter for every index in
     // `request_indexes`
     //
@@ -846,21 +1110,17 @@ private:
                 return {i};
             }
 
-            auto offset = model::next_offset(_last_visible_indexes[i]);
-            auto waiter = consensus->visible_offset_monitor()
-                            .wait(offset, model::no_timeout, _as)
-                            // All exceptions are ignored here as this is only
-                            // used to signal the worker that another attempt to
-                            // read the partition should be made.
-                            .handle_exception([](const std::exception_ptr&) {});
-
-            ssx::spawn_with_gate(
-              _waiter_gate, [this, w = std::move(waiter), i]() mutable {
-                  return w.finally([this, i] {
+            ssx::spawn_with_gate(_waiter_gate, [this, i] {
+                // All exceptions are ignored here as this is only used to
+                // signal the worker that another attempt to read the
+                // partition should be made.
+                return wait_for_new_data(i)
+                  .handle_exception([](const std::exception_ptr&) {})
+                  .finally([this, i] {
                       _request_indexes.push_back(i);
                       _completed_waiter_count.signal();
                   });
-              });
+            });
         }
 
         return {};
@@ -901,6 +1161,8 @@ private:
 
                 _last_visible_indexes = std::move(
                   q_results.last_visible_indexes);
+                _last_stable_offsets = std::move(
+                  q_results.last_stable_offsets);
             } else {
                 // Override the older results of the partitions with the newly
                 // queried results.
@@ -913,6 +1175,8 @@ private:
 
                     _last_visible_indexes[r_i]
                       = q_results.last_visible_indexes[i];
+                    _last_stable_offsets[r_i]
+                      = q_results.last_stable_offsets[i];
                 }
             }
 
@@ -947,6 +1211,10 @@ private:
             }
 
             co_await _completed_waiter_count.wait();
+            // Let the waiters woken by the same round of offset updates,
+            // e.g. of a produce request to several partitions of this shard,
+            // join this re-query rather than each starting another one.
+            co_await ss::yield();
 
             if (_as.abort_requested()) {
                 co_return worker_result{
@@ -1339,6 +1607,10 @@ class simple_fetch_planner final : public fetch_planner::impl {
                                     : std::nullopt,
               .abort_source = octx.rctx.abort_source(),
               .client_address = model::client_address_t{client_address},
+              .client_id = octx.rctx.header().client_id.has_value()
+                             ? std::make_optional<ss::sstring>(
+                               *octx.rctx.header().client_id)
+                             : std::nullopt,
             };
 
             plan.fetches_per_shard[*shard].push_back({tp, config}, &(*resp_it));
@@ -1398,7 +1670,7 @@ static ss::future<> fetch_topic_partitions(op_context& octx) {
     octx.reset_context();
     // debounce next read retry
     co_await ss::sleep(std::min(
-      config::shard_local_cfg().fetch_reads_debounce_timeout(),
+      config::hot_path().fetch_reads_debounce_timeout,
       octx.request.data.max_wait_ms));
 }
 
@@ -1407,11 +1679,17 @@ kafka::fetch_plan make_simple_fetch_plan(op_context& octx) {
     auto planner = make_fetch_planner<simple_fetch_planner>();
     return planner.create_plan(octx);
 }
+
+ss::future<> execute_simple_fetch_plan(op_context& octx, fetch_plan plan) {
+    fetch_plan_executor executor
+      = make_fetch_plan_executor<parallel_fetch_plan_executor>();
+    co_await executor.execute_plan(octx, std::move(plan));
+}
 } // namespace testing
 
 namespace {
 ss::future<> do_fetch(op_context& octx) {
-    switch (config::shard_local_cfg().fetch_read_strategy) {
+    switch (config::hot_path().fetch_read_strategy) {
     case model::fetch_read_strategy::polling: {
         // first fetch, do not wait
         co_await fetch_topic_partitions(octx).then([&octx] {
@@ -1496,7 +1774,7 @@ op_context::op_context(request_context&& ctx, ss::smp_service_group ssg)
      * kafka server itself.
      */
     bytes_left = std::min(
-      config::shard_local_cfg().fetch_max_bytes(),
+      config::hot_path().fetch_max_bytes,
       size_t(request.data.max_bytes));
     session_ctx = rctx.fetch_sessions().maybe_get_session(request);
     create_response_placeholders();
@@ -1615,17 +1893,19 @@ ss::future<response_ptr> op_context::send_response() && {
     final_response.data.session_id = response.data.session_id;
 
     /// Account for special internal topic bytes for usage
-    for (const auto& topic : response.data.topics) {
-        const bool bytes_to_exclude = std::find(
-                                        usage_excluded_topics.cbegin(),
-                                        usage_excluded_topics.cend(),
-                                        topic.name)
-                                      != usage_excluded_topics.cend();
-        if (bytes_to_exclude) {
-            for (const auto& part : topic.partitions) {
-                if (part.records) {
-                    final_response.internal_topic_bytes
-                      += part.records->size_bytes();
+    if (rctx.usage_mgr().enabled()) {
+        for (const auto& topic : response.data.topics) {
+            const bool bytes_to_exclude = std::find(
+                                            usage_excluded_topics.cbegin(),
+                                            usage_excluded_topics.cend(),
+                                            topic.name)
+                                          != usage_excluded_topics.cend();
+            if (bytes_to_exclude) {
+                for (const auto& part : topic.partitions) {
+                    if (part.records) {
+                        final_response.internal_topic_bytes
+                          += part.records->size_bytes();
+                    }
                 }
             }
         }
@@ -1789,6 +2069,65 @@ std::optional<model::node_id> rack_aware_replica_selector::select_replica(
     return random_generators::random_choice(rack_replicas).id;
 }
 
+latency_aware_replica_selector::latency_aware_replica_selector(
+  const cluster::metadata_cache& md_cache)
+  : _md_cache(md_cache)
+  , _rack_aware(md_cache)
+  , _max_lag(config::shard_local_cfg().follower_fetch_max_lag_offsets.bind()) {
+}
+
+std::optional<model::node_id> latency_aware_replica_selector::select_replica(
+  const consumer_info& c_info, const partition_info& p_info) const {
+    const auto max_lag = _max_lag();
+    if (!max_lag.has_value()) {
+        return _rack_aware.select_replica(c_info, p_info);
+    }
+    if (!c_info.rack_id.has_value()) {
+        return select_leader_replica{}.select_replica(c_info, p_info);
+    }
+    auto leader_it = std::find_if(
+      p_info.replicas.begin(), p_info.replicas.end(), [&p_info](const auto& r) {
+          return r.id == p_info.leader;
+      });
+    if (leader_it == p_info.replicas.end()) {
+        return std::nullopt;
+    }
+    const auto leader_hw = leader_it->high_watermark;
+
+    // prefer the replica answering its leader fastest, then the least lagging
+    auto rank = [leader_hw](const replica_info& r) {
+        return std::pair(
+          r.last_reply_age.value_or(std::chrono::milliseconds(0)),
+          leader_hw() - r.high_watermark());
+    };
+    const replica_info* best = nullptr;
+    for (const auto& replica : p_info.replicas) {
+        if (!replica.is_alive) {
+            continue;
+        }
+        auto const node_it = _md_cache.nodes().find(replica.id);
+        if (
+          node_it == _md_cache.nodes().end()
+          || node_it->second.state.get_maintenance_state()
+               == model::maintenance_state::active
+          || node_it->second.broker.rack() != c_info.rack_id) {
+            continue;
+        }
+        if (
+          replica.log_end_offset < c_info.fetch_offset
+          || rank(replica).second > *max_lag) {
+            continue;
+        }
+        if (best == nullptr || rank(replica) < rank(*best)) {
+            best = &replica;
+        }
+    }
+    if (best == nullptr) {
+        return std::nullopt;
+    }
+    return best->id;
+}
+
 std::ostream& operator<<(std::ostream& o, const consumer_info& ci) {
     fmt::print(o, "rack_id: {}, fetch_offset: {}", ci);
     return o;
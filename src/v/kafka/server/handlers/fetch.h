@@ -173,6 +173,7 @@ struct fetch_config {
     std::optional<std::reference_wrapper<ssx::sharded_abort_source>>
       abort_source;
     std::optional<model::client_address_t> client_address;
+    std::optional<ss::sstring> client_id;
 
     friend std::ostream& operator<<(std::ostream& o, const fetch_config& cfg) {
         fmt::print(
@@ -318,6 +319,13 @@ struct read_result {
           });
     }
 
+    /**
+     * Like release_data(), but data read on another shard is shared rather
+     * than copied. The buffers are released on their owner shard when the
+     * last of the returned fragments is destroyed.
+     */
+    iobuf share_data() &&;
+
     variant_t data;
     model::offset start_offset;
     model::offset high_watermark;
@@ -419,6 +427,14 @@ ss::future<read_result> read_from_ntp(
  */
 kafka::fetch_plan make_simple_fetch_plan(op_context& octx);
 
+/**
+ * Execute a single read pass of \p plan with the parallel fetch plan
+ * executor.
+ *
+ * Exposed for testing/benchmarking only.
+ */
+ss::future<> execute_simple_fetch_plan(op_context& octx, fetch_plan plan);
+
 read_result::memory_units_t reserve_memory_units(
   ssx::semaphore& memory_sem,
   ssx::semaphore& memory_fetch_sem,
@@ -12,6 +12,7 @@
 
 #include "cluster/metadata_cache.h"
 #include "cluster/types.h"
+#include "config/property.h"
 #include "kafka/types.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
@@ -59,4 +60,25 @@ private:
     const cluster::metadata_cache& _md_cache;
 };
 
+/**
+ * Picks, among the replicas in the rack of the consumer that lag the leader
+ * by at most `follower_fetch_max_lag_offsets`, the one that answered its
+ * leader most recently. A follower that is slow to answer replication is
+ * likely to be slow serving fetches as well. Without a suitable replica the
+ * consumer keeps fetching from the leader.
+ *
+ * Behaves as the rack aware selector when the lag bound is not set.
+ */
+class latency_aware_replica_selector : public replica_selector {
+public:
+    explicit latency_aware_replica_selector(const cluster::metadata_cache&);
+    std::optional<model::node_id>
+    select_replica(const consumer_info&, const partition_info&) const final;
+
+private:
+    const cluster::metadata_cache& _md_cache;
+    rack_aware_replica_selector _rack_aware;
+    config::binding<std::optional<int64_t>> _max_lag;
+};
+
 } // namespace kafka
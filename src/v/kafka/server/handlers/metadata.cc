@@ -22,6 +22,7 @@
 #include "kafka/server/handlers/details/leader_epoch.h"
 #include "kafka/server/handlers/details/security.h"
 #include "kafka/server/handlers/topics/topic_utils.h"
+#include "kafka/server/metadata_response_cache.h"
 #include "kafka/server/response.h"
 #include "kafka/types.h"
 #include "model/metadata.h"
@@ -507,6 +508,47 @@ static ss::future<metadata_response> fill_info_about_brokers_and_controller_id(
     co_return reply;
 }
 
+namespace {
+/**
+ * Returns the key of the cached responses to \p request, if the response can
+ * be shared with other connections. That is the case for requests for all
+ * topics when nothing in the response depends on the client's principal and
+ * no authorization is audited.
+ */
+std::optional<metadata_response_cache::key> response_cache_key(
+  request_context& ctx,
+  const metadata_request& request,
+  is_node_isolated_or_decommissioned isolated) {
+    if (
+      !config::shard_local_cfg().kafka_metadata_response_cache_enabled()
+      || !request.list_all_topics
+      || request.data.include_topic_authorized_operations
+      || request.data.include_cluster_authorized_operations
+      || ctx.authorization_enabled()
+      || config::shard_local_cfg().audit_enabled()) {
+        return std::nullopt;
+    }
+    // leaders of leaderless partitions are guessed anew by every request
+    if (ctx.metadata_cache().leaderless_partition_count() > 0) {
+        return std::nullopt;
+    }
+    return metadata_response_cache::key{
+      .version = ctx.header().version,
+      .listener = ctx.listener(),
+      .node_isolated = bool(isolated),
+      .recovery_mode = ctx.recovery_mode_enabled(),
+    };
+}
+
+metadata_response_cache::generation
+metadata_generation(const cluster::metadata_cache& md_cache) {
+    return {
+      .topics = md_cache.topics_version(),
+      .leaders = md_cache.leaders_version(),
+    };
+}
+} // namespace
+
 template<>
 ss::future<response_ptr> metadata_handler::handle(
   request_context ctx, [[maybe_unused]] ss::smp_service_group g) {
@@ -529,6 +571,16 @@ ss::future<response_ptr> metadata_handler::handle(
     request.decode(ctx.reader(), ctx.header().version);
     log_request(ctx.header(), request);
 
+    const auto cache_key = response_cache_key(
+      ctx, request, isolated_or_decommissioned);
+    const auto gen = metadata_generation(ctx.metadata_cache());
+    if (cache_key) {
+        auto cached = metadata_responses().get(*cache_key, gen, reply.data);
+        if (cached) {
+            co_return co_await ctx.respond(std::move(*cached));
+        }
+    }
+
     reply.data.topics = co_await get_topic_metadata(
       ctx, request, isolated_or_decommissioned);
 
@@ -540,6 +592,19 @@ ss::future<response_ptr> metadata_handler::handle(
           details::authorized_operations(ctx, security::default_cluster_name));
     }
 
+    if (cache_key && metadata_generation(ctx.metadata_cache()) == gen) {
+        auto body = encode_metadata_response_body(
+          reply.data, ctx.header().version);
+        metadata_responses().put(
+          *cache_key, gen, reply.data, body.share(0, body.size_bytes()));
+        co_return co_await ctx.respond(encoded_metadata_response{
+          .data = {
+            .throttle_time_ms = reply.data.throttle_time_ms,
+            .body = std::move(body),
+            .has_errors = reply.data.errored(),
+          }});
+    }
+
     co_return co_await ctx.respond(std::move(reply));
 }
 
@@ -16,8 +16,11 @@
 #include "cluster/partition_manager.h"
 #include "cluster/shard_table.h"
 #include "config/configuration.h"
+#include "config/hot_path.h"
 #include "kafka/protocol/errors.h"
 #include "kafka/protocol/kafka_batch_adapter.h"
+#include "kafka/server/batch_recompression.h"
+#include "kafka/server/compression_advisor.h"
 #include "kafka/server/replicated_partition.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
@@ -116,6 +119,20 @@ reader_from_lcore_batch(model::record_batch&& batch) {
     return model::make_foreign_memory_record_batch_reader(std::move(batch));
 }
 
+/*
+ * Like reader_from_lcore_batch, but the home core of the partition shares the
+ * buffers of the request rather than copying them. They are kept until the
+ * batch has been written, so the memory of this core is held for longer.
+ */
+static inline model::record_batch_reader
+shared_reader_from_lcore_batch(model::record_batch&& batch, ss::shard_id home) {
+    if (home == ss::this_shard_id()) {
+        return model::make_memory_record_batch_reader(std::move(batch));
+    }
+    return model::make_foreign_shared_memory_record_batch_reader(
+      std::move(batch));
+}
+
 static error_code map_produce_error_code(std::error_code ec) {
     if (ec.category() == raft::error_category()) {
         switch (static_cast<raft::errc>(ec.value())) {
@@ -233,8 +250,8 @@ static auto validate_batch_timestamps(
     // alert if first_timestamp is too far in the past
     // default value for threshold basically disables this check, so it's
     // wrapped in a if check
-    if (auto max_before = config::shard_local_cfg()
-                            .log_message_timestamp_alert_before_ms.value();
+    const auto& hot_cfg = config::hot_path();
+    if (auto max_before = hot_cfg.log_message_timestamp_alert_before_ms;
         unlikely(max_before)) {
         auto first_timepoint = model::duration_since_epoch(
           header.first_timestamp);
@@ -261,8 +278,7 @@ static auto validate_batch_timestamps(
 
     // alert if max_timestamp is too far in the future
     if (timestamp_type == model::timestamp_type::create_time) {
-        auto max_after = config::shard_local_cfg()
-                           .log_message_timestamp_alert_after_ms.value();
+        auto max_after = hot_cfg.log_message_timestamp_alert_after_ms;
         auto max_timepoint = model::duration_since_epoch(header.max_timestamp);
         if (
           broker_timepoint < max_timepoint
@@ -297,6 +313,17 @@ static auto validate_batch_timestamps(
 /**
  * \brief handle writing to a single topic partition.
  */
+static ss::future<pandaproxy::schema_registry::schema_id_validator::result>
+recompress_validated(
+  pandaproxy::schema_registry::schema_id_validator::result reader,
+  std::optional<model::compression> codec) {
+    if (!codec || reader.has_error()) {
+        co_return reader;
+    }
+    co_return co_await maybe_recompress(
+      std::move(reader).assume_value(), *codec);
+}
+
 static partition_produce_stages produce_topic_partition(
   produce_ctx& octx,
   produce_request::topic& topic,
@@ -316,6 +343,9 @@ static partition_produce_stages produce_topic_partition(
           .error_code = error_code::not_leader_for_partition});
     }
 
+    octx.rctx.connection()->record_produce_shard(*shard);
+    octx.rctx.probe().record_produce_partition(*shard == ss::this_shard_id());
+
     // steal the batch from the adapter
     auto batch = std::move(part.records->adapter.batch.value());
 
@@ -341,11 +371,21 @@ static partition_produce_stages produce_topic_partition(
           model::timestamp_type::append_time, new_timestamp.value());
     }
 
+    if (auto* advisor = compression_advisor::local()) {
+        advisor->maybe_sample(topic.name, batch);
+    }
+
     const auto& hdr = batch.header();
     auto bid = model::batch_identity::from(hdr);
+    auto recompression = recompression_codec(
+      hdr,
+      topic_cfg->properties.compression.value_or(
+        octx.rctx.metadata_cache().get_default_compression()));
     auto batch_size = batch.size_bytes();
     auto num_records = batch.record_count();
-    auto reader = reader_from_lcore_batch(std::move(batch));
+    auto reader = config::hot_path().kafka_produce_batch_passthrough
+                    ? shared_reader_from_lcore_batch(std::move(batch), *shard)
+                    : reader_from_lcore_batch(std::move(batch));
     auto validator
       = pandaproxy::schema_registry::maybe_make_schema_id_validator(
         octx.rctx.schema_registry(), topic.name, topic_cfg->properties);
@@ -368,6 +408,7 @@ static partition_produce_stages produce_topic_partition(
              bid,
              acks = octx.request.data.acks,
              batch_max_bytes,
+             recompression,
              timeout = octx.request.data.timeout_ms,
              source_shard = ss::this_shard_id()](
               cluster::partition_manager& mgr) mutable {
@@ -398,6 +439,10 @@ static partition_produce_stages produce_topic_partition(
                 auto probe = std::addressof(partition->probe());
                 return pandaproxy::schema_registry::maybe_validate_schema_id(
                          std::move(validator), std::move(reader), probe)
+                  .then([recompression](auto reader) {
+                      return recompress_validated(
+                        std::move(reader), recompression);
+                  })
                   .then([ntp{std::move(ntp)},
                          partition{std::move(partition)},
                          dispatch = std::move(dispatch),
@@ -460,6 +505,23 @@ static partition_produce_stages produce_topic_partition(
               }
               return p;
           });
+    if (auto* trace = octx.rctx.trace(); trace) {
+        auto dispatched_at
+          = ss::make_lw_shared<request_trace::clock::time_point>();
+        dispatch_f = dispatch_f.then([trace, start, dispatched_at] {
+            *dispatched_at = request_trace::clock::now();
+            trace->record_max(
+              request_stage::partition_dispatch, *dispatched_at - start);
+        });
+        f = f.then([trace, dispatched_at](produce_response::partition p) {
+            if (*dispatched_at != request_trace::clock::time_point{}) {
+                trace->record_max(
+                  request_stage::replicate,
+                  request_trace::clock::now() - *dispatched_at);
+            }
+            return p;
+        });
+    }
     return partition_produce_stages{
       .dispatched = std::move(dispatch_f),
       .produced = std::move(f),
@@ -573,6 +635,14 @@ produce_topic(produce_ctx& octx, produce_request::topic& topic) {
             continue;
         }
 
+        if (unlikely(!part.records->adapter.validate_records(
+              config::hot_path().kafka_produce_batch_passthrough
+                ? kafka_batch_adapter::record_validation::record_count
+                : kafka_batch_adapter::record_validation::full))) {
+            push_error_response(error_code::invalid_record);
+            continue;
+        }
+
         auto pr = produce_topic_partition(octx, topic, part);
         partitions_produced.push_back(std::move(pr.produced));
         partitions_dispatched.push_back(std::move(pr.dispatched));
@@ -637,19 +707,21 @@ produce_handler::handle(request_context ctx, ss::smp_service_group ssg) {
 
     // Account for special internal topic bytes for usage
     produce_response resp;
-    for (const auto& topic : request.data.topics) {
-        const bool bytes_to_exclude = std::find(
-                                        usage_excluded_topics.cbegin(),
-                                        usage_excluded_topics.cend(),
-                                        topic.name())
-                                      != usage_excluded_topics.cend();
-        if (bytes_to_exclude) {
-            for (const auto& part : topic.partitions) {
-                if (part.records) {
-                    const auto& records = part.records;
-                    if (records->adapter.batch) {
-                        resp.internal_topic_bytes
-                          += records->adapter.batch->size_bytes();
+    if (ctx.usage_mgr().enabled()) {
+        for (const auto& topic : request.data.topics) {
+            const bool bytes_to_exclude = std::find(
+                                            usage_excluded_topics.cbegin(),
+                                            usage_excluded_topics.cend(),
+                                            topic.name())
+                                          != usage_excluded_topics.cend();
+            if (bytes_to_exclude) {
+                for (const auto& part : topic.partitions) {
+                    if (part.records) {
+                        const auto& records = part.records;
+                        if (records->adapter.batch) {
+                            resp.internal_topic_bytes
+                              += records->adapter.batch->size_bytes();
+                        }
                     }
                 }
             }
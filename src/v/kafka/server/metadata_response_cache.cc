@@ -0,0 +1,75 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "kafka/server/metadata_response_cache.h"
+
+#include <absl/container/flat_hash_map.h>
+
+namespace kafka {
+
+std::optional<encoded_metadata_response> metadata_response_cache::get(
+  const key& k, generation gen, const metadata_response_data& reply) {
+    auto it = _entries.find(k);
+    if (it == _entries.end()) {
+        ++_misses;
+        return std::nullopt;
+    }
+    auto& e = it->second;
+    if (e.gen != gen) {
+        // the topics or their leaders changed since
+        _entries.erase(it);
+        ++_misses;
+        return std::nullopt;
+    }
+    if (
+      e.brokers != reply.brokers || e.cluster_id != reply.cluster_id
+      || e.controller_id != reply.controller_id) {
+        ++_misses;
+        return std::nullopt;
+    }
+    ++_hits;
+    return encoded_metadata_response{
+      .data = {
+        .throttle_time_ms = reply.throttle_time_ms,
+        .body = e.body.share(0, e.body.size_bytes()),
+        .has_errors = e.errored,
+      }};
+}
+
+void metadata_response_cache::put(
+  const key& k,
+  generation gen,
+  const metadata_response_data& reply,
+  iobuf body) {
+    // responses of other generations are never served again
+    absl::erase_if(
+      _entries, [gen](const auto& kv) { return kv.second.gen != gen; });
+    auto& e = _entries[k];
+    e.gen = gen;
+    e.brokers = reply.brokers;
+    e.cluster_id = reply.cluster_id;
+    e.controller_id = reply.controller_id;
+    e.errored = reply.errored();
+    e.body = std::move(body);
+}
+
+iobuf encode_metadata_response_body(
+  metadata_response_data& reply, api_version version) {
+    iobuf buf;
+    protocol::encoder writer(buf);
+    reply.encode(writer, version);
+    if (version >= api_version(3)) {
+        // the throttle time is the first field of the response
+        buf.trim_front(sizeof(int32_t));
+    }
+    return buf;
+}
+
+} // namespace kafka
@@ -0,0 +1,158 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "bytes/iobuf.h"
+#include "kafka/protocol/metadata.h"
+#include "kafka/protocol/types.h"
+#include "kafka/protocol/wire.h"
+
+#include <seastar/core/sstring.hh>
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/hash/hash.h>
+
+#include <chrono>
+#include <optional>
+
+namespace kafka {
+
+/**
+ * A metadata response with an encoded body, so that it can be sent with the
+ * throttle time of the request it answers.
+ */
+struct encoded_metadata_response {
+    using api_type = metadata_api;
+
+    struct response_data {
+        std::chrono::milliseconds throttle_time_ms{0};
+        iobuf body;
+        bool has_errors{false};
+
+        bool errored() const { return has_errors; }
+    };
+
+    response_data data;
+
+    void encode(protocol::encoder& writer, api_version version) {
+        if (version >= api_version(3)) {
+            writer.write(int32_t(data.throttle_time_ms.count()));
+        }
+        writer.write_encoded(std::move(data.body));
+    }
+};
+
+/**
+ * Shard-local cache of encoded metadata responses.
+ *
+ * A response to a request for the metadata of all topics lists every
+ * partition of the cluster, and building and encoding it is expensive with
+ * large numbers of partitions while every client of a large fleet refreshes
+ * its metadata periodically. With `kafka_metadata_response_cache_enabled` set,
+ * the encoded responses are kept here, keyed by the request version and the
+ * properties of the connection that determine their contents, and are shared
+ * by later requests until the topics or the partition leaders change.
+ *
+ * The brokers and the controller listed in a response depend on the health
+ * of the cluster rather than on the topic table, so they are computed by
+ * every request and a cached response is used only if they match.
+ */
+class metadata_response_cache {
+public:
+    struct key {
+        api_version version;
+        ss::sstring listener;
+        bool node_isolated{false};
+        bool recovery_mode{false};
+
+        bool operator==(const key&) const = default;
+
+        template<typename H>
+        friend H AbslHashValue(H h, const key& k) {
+            return H::combine(
+              std::move(h),
+              k.version(),
+              std::string_view(k.listener),
+              k.node_isolated,
+              k.recovery_mode);
+        }
+    };
+
+    /// Versions of the cluster metadata a response was built from.
+    struct generation {
+        uint64_t topics{0};
+        uint64_t leaders{0};
+
+        bool operator==(const generation&) const = default;
+    };
+
+    /**
+     * Returns a cached response of generation \p gen listing the same
+     * brokers, cluster id and controller as \p reply, sharing its buffers.
+     */
+    std::optional<encoded_metadata_response>
+    get(const key&, generation gen, const metadata_response_data& reply);
+
+    /// Cache the \p body of \p reply, built from generation \p gen.
+    void put(
+      const key&,
+      generation gen,
+      const metadata_response_data& reply,
+      iobuf body);
+
+    size_t size() const { return _entries.size(); }
+    uint64_t hits() const { return _hits; }
+    uint64_t misses() const { return _misses; }
+
+private:
+    struct entry {
+        generation gen;
+        decltype(metadata_response_data::brokers) brokers;
+        decltype(metadata_response_data::cluster_id) cluster_id;
+        decltype(metadata_response_data::controller_id) controller_id;
+        bool errored{false};
+        iobuf body;
+    };
+
+    absl::flat_hash_map<key, entry> _entries;
+    uint64_t _hits{0};
+    uint64_t _misses{0};
+};
+
+/// Returns the shard-local metadata response cache.
+inline metadata_response_cache& metadata_responses() {
+    static thread_local metadata_response_cache cache;
+    return cache;
+}
+
+/**
+ * Encodes \p reply and returns its body, i.e. the encoded response with the
+ * throttle time left out.
+ */
+iobuf encode_metadata_response_body(metadata_response_data&, api_version);
+
+} // namespace kafka
+
+template<>
+struct fmt::formatter<kafka::encoded_metadata_response> {
+    template<typename ParseContext>
+    constexpr auto parse(ParseContext& ctx) -> decltype(ctx.begin()) {
+        return ctx.begin();
+    }
+
+    template<typename FormatContext>
+    auto format(
+      const kafka::encoded_metadata_response& v, FormatContext& ctx) const
+      -> decltype(ctx.out()) {
+        return fmt::format_to(
+          ctx.out(), "{{encoded: {} bytes}}", v.data.body.size_bytes());
+    }
+};
@@ -0,0 +1,126 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "kafka/server/offset_commit_batcher.h"
+
+#include "base/vlog.h"
+#include "cluster/partition.h"
+#include "kafka/server/logger.h"
+#include "model/record_batch_reader.h"
+#include "ssx/future-util.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/coroutine/as_future.hh>
+#include <seastar/util/later.hh>
+
+#include <algorithm>
+
+namespace kafka {
+
+raft::replicate_stages offset_commit_batcher::replicate(
+  ss::lw_shared_ptr<cluster::partition> partition,
+  model::term_id term,
+  model::record_batch batch) {
+    const auto group = partition->group();
+    auto [it, inserted] = _queues.try_emplace(group);
+    if (inserted) {
+        it->second.partition = std::move(partition);
+    }
+    auto& commit = it->second.commits.emplace_back(
+      pending_commit{.term = term, .batch = std::move(batch)});
+    raft::replicate_stages stages(
+      commit.enqueued.get_future(), commit.finished.get_future());
+    if (inserted) {
+        ssx::background = send(group);
+    }
+    return stages;
+}
+
+ss::future<> offset_commit_batcher::send(raft::group_id group) {
+    // let the groups storing offsets in this tick join the request
+    co_await ss::yield();
+    auto node = _queues.extract(group);
+    auto& q = node.mapped();
+    // commits of a stale term must fail on their own
+    auto begin = q.commits.begin();
+    while (begin != q.commits.end()) {
+        auto end = std::find_if(
+          begin, q.commits.end(), [term = begin->term](const auto& c) {
+              return c.term != term;
+          });
+        ssx::background = replicate_commits(
+          q.partition,
+          std::vector<pending_commit>(
+            std::make_move_iterator(begin), std::make_move_iterator(end)));
+        begin = end;
+    }
+}
+
+ss::future<> offset_commit_batcher::replicate_commits(
+  ss::lw_shared_ptr<cluster::partition> partition,
+  std::vector<pending_commit> commits) {
+    vlog(
+      klog.trace,
+      "Replicating {} offset commits to {}",
+      commits.size(),
+      partition->ntp());
+
+    // the batches are appended in order, so the last offset of a commit is
+    // the one of the request less the records of the commits following it
+    std::vector<int64_t> records_after(commits.size(), 0);
+    for (size_t i = commits.size() - 1; i > 0; --i) {
+        records_after[i - 1] = records_after[i]
+                               + commits[i].batch.record_count();
+    }
+    model::record_batch_reader::data_t batches;
+    for (auto& c : commits) {
+        batches.push_back(std::move(c.batch));
+    }
+
+    auto stages = partition->raft()->replicate_in_stages(
+      commits.front().term,
+      model::make_memory_record_batch_reader(std::move(batches)),
+      raft::replicate_options(raft::consistency_level::quorum_ack));
+
+    auto enqueued = co_await ss::coroutine::as_future(
+      std::move(stages.request_enqueued));
+    if (enqueued.failed()) {
+        auto e = enqueued.get_exception();
+        for (auto& c : commits) {
+            c.enqueued.set_exception(e);
+        }
+    } else {
+        for (auto& c : commits) {
+            c.enqueued.set_value();
+        }
+    }
+
+    auto finished = co_await ss::coroutine::as_future(
+      std::move(stages.replicate_finished));
+    if (finished.failed()) {
+        auto e = finished.get_exception();
+        for (auto& c : commits) {
+            c.finished.set_exception(e);
+        }
+        co_return;
+    }
+    auto r = finished.get();
+    for (size_t i = 0; i < commits.size(); ++i) {
+        if (r.has_error()) {
+            commits[i].finished.set_value(r.error());
+        } else {
+            commits[i].finished.set_value(raft::replicate_result{
+              .last_offset = model::offset(
+                r.value().last_offset() - records_after[i])});
+        }
+    }
+}
+
+} // namespace kafka
@@ -0,0 +1,77 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "base/outcome.h"
+#include "cluster/fwd.h"
+#include "model/fundamental.h"
+#include "model/record.h"
+#include "raft/types.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/shared_ptr.hh>
+
+#include <absl/container/flat_hash_map.h>
+
+#include <vector>
+
+namespace kafka {
+
+/**
+ * Coalesces the offset commits of the groups coordinated by a partition.
+ *
+ * Every offset commit is a batch of its own on the coordinator partition,
+ * and with thousands of consumers committing every second the replication
+ * requests of the commits dominate the coordinator. With
+ * `group_coalesce_offset_commits` set, the commits that groups store in the
+ * same reactor tick are collected per partition and replicated with a
+ * single request. Every commit keeps its own batch and its own result, so
+ * replication order and per-request acknowledgements are preserved.
+ */
+class offset_commit_batcher {
+public:
+    /**
+     * Replicate \p batch on \p partition in \p term together with the other
+     * commits to the partition stored in this tick. The last offset of the
+     * result is the one of \p batch.
+     */
+    raft::replicate_stages replicate(
+      ss::lw_shared_ptr<cluster::partition> partition,
+      model::term_id term,
+      model::record_batch batch);
+
+private:
+    struct pending_commit {
+        model::term_id term;
+        model::record_batch batch;
+        ss::promise<> enqueued;
+        ss::promise<result<raft::replicate_result>> finished;
+    };
+
+    struct queue {
+        ss::lw_shared_ptr<cluster::partition> partition;
+        std::vector<pending_commit> commits;
+    };
+
+    ss::future<> send(raft::group_id);
+    ss::future<> replicate_commits(
+      ss::lw_shared_ptr<cluster::partition>, std::vector<pending_commit>);
+
+    absl::flat_hash_map<raft::group_id, queue> _queues;
+};
+
+/// Returns the shard-local offset commit batcher.
+inline offset_commit_batcher& offset_commit_batching() {
+    static thread_local offset_commit_batcher batcher;
+    return batcher;
+}
+
+} // namespace kafka
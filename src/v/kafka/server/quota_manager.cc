@@ -12,9 +12,13 @@
 #include "base/vlog.h"
 #include "config/configuration.h"
 #include "kafka/server/logger.h"
+#include "ssx/future-util.h"
+
+#include <seastar/core/coroutine.hh>
 
 #include <fmt/chrono.h>
 
+#include <algorithm>
 #include <chrono>
 
 using namespace std::chrono_literals;
@@ -37,25 +41,99 @@ quota_manager::quota_manager()
   , _target_fetch_tp_rate_per_client_group(
       config::shard_local_cfg().kafka_client_group_fetch_byte_rate_quota.bind())
   , _gc_freq(config::shard_local_cfg().quota_manager_gc_sec())
-  , _max_delay(config::shard_local_cfg().max_kafka_throttle_delay_ms.bind()) {
+  , _max_delay(config::shard_local_cfg().max_kafka_throttle_delay_ms.bind())
+  , _exchange_period(
+      config::shard_local_cfg().kafka_client_quota_exchange_period.bind()) {
     _gc_timer.set_callback([this] {
         auto full_window = _default_num_windows() * _default_window_width();
         gc(full_window);
     });
+    _exchange_timer.set_callback([this] {
+        ssx::spawn_with_gate(_gate, [this] {
+            return exchange_rates().finally([this] {
+                if (!_gate.is_closed()) {
+                    arm_exchange();
+                }
+            });
+        });
+    });
+    _exchange_period.watch([this] { arm_exchange(); });
 }
 
-quota_manager::~quota_manager() { _gc_timer.cancel(); }
+quota_manager::~quota_manager() {
+    _gc_timer.cancel();
+    _exchange_timer.cancel();
+}
 
 ss::future<> quota_manager::stop() {
     _gc_timer.cancel();
-    return ss::make_ready_future<>();
+    _exchange_timer.cancel();
+    return _gate.close();
 }
 
 ss::future<> quota_manager::start() {
     _gc_timer.arm_periodic(_gc_freq);
+    arm_exchange();
     return ss::make_ready_future<>();
 }
 
+void quota_manager::arm_exchange() {
+    if (ss::this_shard_id() != quota_manager_shard || _gate.is_closed()) {
+        return;
+    }
+    _exchange_timer.cancel();
+    if (_exchange_period()) {
+        _exchange_timer.arm(*_exchange_period());
+    }
+}
+
+ss::future<> quota_manager::exchange_rates() {
+    auto now = clock::now();
+    auto totals = co_await container().map_reduce0(
+      [now](quota_manager& qm) { return qm.collect_rates(now); },
+      client_rates_t{},
+      [](client_rates_t acc, const client_rates_t& rates) {
+          for (const auto& [id, r] : rates) {
+              auto& total = acc[id];
+              total.produce += r.produce;
+              total.fetch += r.fetch;
+          }
+          return acc;
+      });
+    co_await container().invoke_on_all(
+      [&totals](quota_manager& qm) { qm.apply_rates(totals); });
+}
+
+quota_manager::client_rates_t
+quota_manager::collect_rates(clock::time_point now) {
+    client_rates_t rates;
+    rates.reserve(_client_quotas.size());
+    for (auto& [id, q] : _client_quotas) {
+        q.exchanged = {
+          .produce = q.tp_produce_rate.measure(now),
+          .fetch = q.tp_fetch_rate.measure(now),
+        };
+        rates.emplace(id, q.exchanged);
+    }
+    return rates;
+}
+
+void quota_manager::apply_rates(const client_rates_t& totals) {
+    // clients this shard has not seen since the rates were collected are
+    // left out until the next exchange
+    for (auto& [id, q] : _client_quotas) {
+        auto it = totals.find(id);
+        if (it == totals.end()) {
+            q.elsewhere = {};
+            continue;
+        }
+        q.elsewhere = {
+          .produce = std::max(0., it->second.produce - q.exchanged.produce),
+          .fetch = std::max(0., it->second.fetch - q.exchanged.fetch),
+        };
+    }
+}
+
 quota_manager::client_quotas_t::iterator
 quota_manager::maybe_add_and_retrieve_quota(
   const std::optional<std::string_view>& quota_id,
@@ -211,8 +289,12 @@ std::chrono::milliseconds quota_manager::throttle(
   std::optional<std::string_view> quota_id,
   uint32_t target_rate,
   const clock::time_point& now,
-  rate_tracker& rate_tracker) {
+  rate_tracker& rate_tracker,
+  double rate_elsewhere) {
     auto rate = rate_tracker.measure(now);
+    if (_exchange_period()) {
+        rate += rate_elsewhere;
+    }
     auto delay_ms = calculate_delay(
       rate, target_rate, rate_tracker.window_size());
 
@@ -244,7 +326,11 @@ throttle_delay quota_manager::record_produce_tp_and_throttle(
     it->second.tp_produce_rate.record(bytes, now);
     auto target_tp_rate = get_client_target_produce_tp_rate(quota_id);
     auto delay_ms = throttle(
-      quota_id, target_tp_rate, now, it->second.tp_produce_rate);
+      quota_id,
+      target_tp_rate,
+      now,
+      it->second.tp_produce_rate,
+      it->second.elsewhere.produce);
     auto prev = it->second.delay;
     it->second.delay = delay_ms;
     throttle_delay res{};
@@ -275,7 +361,11 @@ throttle_delay quota_manager::throttle_fetch_tp(
     auto it = maybe_add_and_retrieve_quota(quota_id, now);
     it->second.tp_fetch_rate.maybe_advance_current(now);
     auto delay_ms = throttle(
-      quota_id, *target_tp_rate, now, it->second.tp_fetch_rate);
+      quota_id,
+      *target_tp_rate,
+      now,
+      it->second.tp_fetch_rate,
+      it->second.elsewhere.fetch);
     throttle_delay res{};
     res.enforce = true;
     res.duration = delay_ms;
@@ -17,6 +17,7 @@
 #include "resource_mgmt/rate.h"
 
 #include <seastar/core/future.hh>
+#include <seastar/core/gate.hh>
 #include <seastar/core/lowres_clock.hh>
 #include <seastar/core/sharded.hh>
 #include <seastar/core/sstring.hh>
@@ -46,9 +47,12 @@ static constexpr ss::shard_id quota_manager_shard = 0;
 //      - splitting out rates separately for produce and fetch
 //      - accounting per user vs per client (these are separate in kafka)
 //
-//   - it may eventually be beneficial to periodically reduce stats across
-//   shards or track stats globally to produce a more accurate per-node
-//   representation of a statistic (e.g. bandwidth).
+// throughput rates are tracked per shard, so that recording and throttling a
+// request never touch another shard. with kafka_client_quota_exchange_period_ms
+// set, the home shard periodically sums up the rates of every client across
+// the shards and hands each shard the rate the client has elsewhere, which is
+// added to the local rate when throttling. the period bounds the staleness of
+// the node-wide rate and hence the accuracy of the enforcement.
 //
 class quota_manager : public ss::peering_sharded_service<quota_manager> {
 public:
@@ -116,21 +120,31 @@ private:
       std::optional<std::string_view> client_id,
       uint32_t target_rate,
       const clock::time_point& now,
-      rate_tracker& rate_tracker);
+      rate_tracker& rate_tracker,
+      double rate_elsewhere);
 
     // Accounting for quota on per-client and per-client-group basis
     // last_seen: used for gc keepalive
     // delay: last calculated delay
     // tp_rate: throughput tracking
     // pm_rate: partition mutation quota tracking - only on home shard
+    // elsewhere: throughput on the other shards as of the last exchange
+    // exchanged: throughput on this shard as of the last exchange
+    struct client_rates {
+        double produce{0};
+        double fetch{0};
+    };
     struct client_quota {
         clock::time_point last_seen;
         clock::duration delay;
         rate_tracker tp_produce_rate;
         rate_tracker tp_fetch_rate;
         std::optional<token_bucket_rate_tracker> pm_rate;
+        client_rates elsewhere{};
+        client_rates exchanged{};
     };
     using client_quotas_t = absl::flat_hash_map<ss::sstring, client_quota>;
+    using client_rates_t = absl::flat_hash_map<ss::sstring, client_rates>;
 
 private:
     // erase inactive tracked quotas. windows are considered inactive if they
@@ -144,6 +158,12 @@ private:
     std::optional<int64_t> get_client_target_fetch_tp_rate(
       const std::optional<std::string_view>& quota_id);
 
+    // exchange of the throughput rates across shards, driven by the home shard
+    void arm_exchange();
+    ss::future<> exchange_rates();
+    client_rates_t collect_rates(clock::time_point now);
+    void apply_rates(const client_rates_t& totals);
+
 private:
     config::binding<int16_t> _default_num_windows;
     config::binding<std::chrono::milliseconds> _default_window_width;
@@ -161,6 +181,10 @@ private:
     ss::timer<> _gc_timer;
     clock::duration _gc_freq;
     config::binding<std::chrono::milliseconds> _max_delay;
+
+    config::binding<std::optional<std::chrono::milliseconds>> _exchange_period;
+    ss::timer<> _exchange_timer;
+    ss::gate _gate;
 };
 
 } // namespace kafka
@@ -561,6 +561,9 @@ result<partition_info> replicated_partition::get_partition_info() const {
           .log_end_offset = model::next_offset(
             clamped_translate(follower_metric.dirty_log_index)),
           .is_alive = follower_metric.is_live,
+          .last_reply_age
+          = std::chrono::duration_cast<std::chrono::milliseconds>(
+            raft::clock_type::now() - follower_metric.last_heartbeat),
         });
     }
 
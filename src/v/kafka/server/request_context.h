@@ -117,6 +117,10 @@ public:
     protocol::decoder& reader() { return _reader; }
 
     latency_probe& probe() { return _conn->server().latency_probe(); }
+
+    /// The trace of the request, if kafka_request_tracing_enabled is set.
+    request_trace* trace() const { return _trace; }
+    void set_trace(request_trace* trace) { _trace = trace; }
     sasl_probe& sasl_probe() { return _conn->server().sasl_probe(); }
 
     // used to reach for server_probe::produce_bad_timestamp
@@ -164,6 +168,10 @@ public:
         return _conn->server().recovery_mode_enabled();
     }
 
+    bool authorization_enabled() const {
+        return _conn->authorization_enabled();
+    }
+
     cluster::tx_gateway_frontend& tx_gateway_frontend() const {
         return _conn->server().tx_gateway_frontend();
     }
@@ -251,7 +259,9 @@ public:
 
         auto resp = std::make_unique<response>(is_flexible);
         r.encode(resp->writer(), version);
-        update_usage_stats(r, resp->buf().size_bytes());
+        if (usage_mgr().enabled()) {
+            update_usage_stats(r, resp->buf().size_bytes());
+        }
         return ss::make_ready_future<response_ptr>(std::move(resp));
     }
 
@@ -485,6 +495,7 @@ private:
     request_header _header;
     protocol::decoder _reader;
     ss::lowres_clock::duration _throttle_delay;
+    request_trace* _trace{nullptr};
     bool _audit_successful{true};
     bool _request_contains_audit_topic{false};
 };
@@ -0,0 +1,107 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "kafka/server/request_trace.h"
+
+#include "config/configuration.h"
+#include "prometheus/prometheus_sanitize.h"
+
+#include <seastar/core/metrics.hh>
+
+namespace kafka {
+
+std::string_view to_string_view(request_stage stage) {
+    switch (stage) {
+    case request_stage::throttle:
+        return "throttle";
+    case request_stage::queue:
+        return "queue";
+    case request_stage::read:
+        return "read";
+    case request_stage::dispatch:
+        return "dispatch";
+    case request_stage::handle:
+        return "handle";
+    case request_stage::partition_dispatch:
+        return "partition_dispatch";
+    case request_stage::replicate:
+        return "replicate";
+    case request_stage::order:
+        return "order";
+    case request_stage::write:
+        return "write";
+    }
+    return "unknown";
+}
+
+request_tracer::request_tracer()
+  : _enabled(config::shard_local_cfg().kafka_request_tracing_enabled.bind())
+  , _slow_threshold(config::shard_local_cfg()
+                       .kafka_request_tracing_slow_threshold_ms.bind()) {}
+
+void request_tracer::setup_metrics() {
+    namespace sm = ss::metrics;
+
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+
+    std::vector<sm::impl::metric_definition_impl> defs;
+    defs.reserve(num_request_stages);
+    for (size_t i = 0; i < num_request_stages; ++i) {
+        const auto stage = static_cast<request_stage>(i);
+        defs.push_back(sm::make_histogram(
+          "stage_latency_us",
+          sm::description("Latency of the stages of traced requests"),
+          {sm::label("latency_metric")("microseconds"),
+           sm::label("stage")(ss::sstring(to_string_view(stage)))},
+          [this, i] {
+              return _stage_latency[i].internal_histogram_logform();
+          }));
+    }
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("kafka:request_trace"),
+      defs,
+      {},
+      {sm::shard_label});
+}
+
+std::unique_ptr<request_trace> request_tracer::start(
+  api_key key,
+  correlation_id correlation,
+  std::optional<std::string_view> client_id) {
+    if (!_enabled()) {
+        return nullptr;
+    }
+    return std::make_unique<request_trace>(
+      key, correlation, ss::sstring(client_id.value_or("")));
+}
+
+void request_tracer::finish(const request_trace& trace) {
+    const auto& durations = trace.durations();
+    for (size_t i = 0; i < num_request_stages; ++i) {
+        if (durations[i] == request_trace::clock::duration::zero()) {
+            // a stage the request did not go through
+            continue;
+        }
+        _stage_latency[i].record(
+          std::chrono::duration_cast<std::chrono::microseconds>(durations[i])
+            .count());
+    }
+    if (trace.elapsed() < _slow_threshold()) {
+        return;
+    }
+    _slow_requests.push_back(trace);
+    if (_slow_requests.size() > max_slow_requests) {
+        _slow_requests.pop_front();
+    }
+}
+
+} // namespace kafka
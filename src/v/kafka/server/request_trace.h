@@ -0,0 +1,147 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "config/property.h"
+#include "kafka/protocol/types.h"
+#include "metrics/metrics.h"
+#include "utils/log_hist.h"
+
+#include <seastar/core/sstring.hh>
+
+#include <array>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace kafka {
+
+/// Stages of the handling of a request, in the order they happen.
+enum class request_stage : uint8_t {
+    // client and shard quota throttling
+    throttle = 0,
+    // waiting for memory and request queue units
+    queue,
+    // reading the request body off the connection
+    read,
+    // first stage of the handler
+    dispatch,
+    // second stage of the handler, until the response is ready
+    handle,
+    // produce: hop to the shard of the slowest partition and enqueueing its
+    // append, nested in the handler stages
+    partition_dispatch,
+    // produce: replication and flush of the slowest partition, nested in the
+    // handler stages
+    replicate,
+    // waiting for the responses to earlier requests of the connection
+    order,
+    // writing the response to the connection
+    write,
+};
+
+inline constexpr size_t num_request_stages
+  = static_cast<size_t>(request_stage::write) + 1;
+
+std::string_view to_string_view(request_stage);
+
+/**
+ * Timestamps the stages of a single request. The stages of the connection
+ * are ended in order with end_stage(), and those measured by the handlers
+ * with record_max().
+ */
+class request_trace {
+public:
+    using clock = std::chrono::steady_clock;
+    using durations_t = std::array<clock::duration, num_request_stages>;
+
+    request_trace(api_key key, correlation_id correlation, ss::sstring client)
+      : _key(key)
+      , _correlation(correlation)
+      , _client_id(std::move(client)) {}
+
+    /// Ends \p stage, which began when the previous stage ended.
+    void end_stage(request_stage stage) {
+        const auto now = clock::now();
+        duration(stage) += now - _last;
+        _last = now;
+    }
+
+    /// Records \p d for \p stage if it is the longest so far.
+    void record_max(request_stage stage, clock::duration d) {
+        duration(stage) = std::max(duration(stage), d);
+    }
+
+    api_key key() const { return _key; }
+    correlation_id correlation() const { return _correlation; }
+    const ss::sstring& client_id() const { return _client_id; }
+    std::chrono::system_clock::time_point started_at() const {
+        return _started_at;
+    }
+    clock::duration elapsed() const { return _last - _started; }
+    const durations_t& durations() const { return _durations; }
+
+private:
+    clock::duration& duration(request_stage stage) {
+        return _durations[static_cast<size_t>(stage)];
+    }
+
+    api_key _key;
+    correlation_id _correlation;
+    ss::sstring _client_id;
+    std::chrono::system_clock::time_point _started_at{
+      std::chrono::system_clock::now()};
+    clock::time_point _started{clock::now()};
+    clock::time_point _last{_started};
+    durations_t _durations{};
+};
+
+/**
+ * Shard-local collector of request traces.
+ *
+ * With `kafka_request_tracing_enabled` set, every request is traced and the
+ * durations of its stages feed per-stage histograms. The most recent requests
+ * slower than `kafka_request_tracing_slow_threshold_ms` are kept so that the
+ * stages of slow requests can be inspected through the admin API.
+ */
+class request_tracer {
+public:
+    static constexpr size_t max_slow_requests = 32;
+
+    request_tracer();
+
+    void setup_metrics();
+
+    /// Returns a trace for a request, if tracing is enabled.
+    std::unique_ptr<request_trace> start(
+      api_key, correlation_id, std::optional<std::string_view> client_id);
+
+    /// Records a request once its response is written.
+    void finish(const request_trace&);
+
+    std::vector<request_trace> slow_requests() const {
+        return {_slow_requests.begin(), _slow_requests.end()};
+    }
+
+private:
+    using hist_t = log_hist_internal;
+
+    config::binding<bool> _enabled;
+    config::binding<std::chrono::milliseconds> _slow_threshold;
+    std::array<hist_t, num_request_stages> _stage_latency;
+    std::deque<request_trace> _slow_requests;
+    metrics::internal_metric_groups _metrics;
+};
+
+} // namespace kafka
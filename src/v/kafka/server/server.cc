@@ -171,7 +171,8 @@ server::server(
   , _sasl_probe(std::make_unique<class sasl_probe>())
   , _thread_worker(tw)
   , _replica_selector(
-      std::make_unique<rack_aware_replica_selector>(_metadata_cache.local()))
+      std::make_unique<latency_aware_replica_selector>(
+        _metadata_cache.local()))
   , _schema_registry(sr) {
     vlog(
       klog.debug,
@@ -183,6 +184,7 @@ server::server(
     setup_metrics();
     _probe->setup_metrics();
     _probe->setup_public_metrics();
+    _request_tracer.setup_metrics();
 
     _sasl_probe->setup_metrics(cfg->local().name);
 }
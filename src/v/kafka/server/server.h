@@ -24,6 +24,7 @@
 #include "kafka/server/handlers/fetch/replica_selector.h"
 #include "kafka/server/handlers/handler_probe.h"
 #include "kafka/server/queue_depth_monitor.h"
+#include "kafka/server/request_trace.h"
 #include "metrics/metrics.h"
 #include "net/server.h"
 #include "pandaproxy/schema_registry/fwd.h"
@@ -174,6 +175,8 @@ public:
 
     sasl_probe& sasl_probe() { return *_sasl_probe; }
 
+    request_tracer& request_traces() { return _request_tracer; }
+
     ssx::singleton_thread_worker& thread_worker() { return _thread_worker; }
 
     const std::unique_ptr<pandaproxy::schema_registry::api>& schema_registry() {
@@ -243,6 +246,7 @@ private:
     metrics::internal_metric_groups _metrics;
     std::unique_ptr<class latency_probe> _probe;
     std::unique_ptr<class sasl_probe> _sasl_probe;
+    request_tracer _request_tracer;
     ssx::singleton_thread_worker& _thread_worker;
     std::unique_ptr<replica_selector> _replica_selector;
     const std::unique_ptr<pandaproxy::schema_registry::api>& _schema_registry;
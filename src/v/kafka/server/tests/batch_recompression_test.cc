@@ -0,0 +1,77 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "config/configuration.h"
+#include "kafka/server/batch_recompression.h"
+#include "model/compression.h"
+#include "model/record.h"
+
+#include <seastar/util/defer.hh>
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+model::record_batch_header make_header(model::compression c) {
+    model::record_batch_header hdr;
+    hdr.record_count = 10;
+    hdr.attrs |= c;
+    return hdr;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(recompresses_uncompressed_batches_of_codec_topics) {
+    const auto uncompressed = make_header(model::compression::none);
+    BOOST_REQUIRE(!kafka::recompression_codec(
+      uncompressed, model::compression::zstd));
+
+    config::shard_local_cfg().kafka_recompress_uncompressed_batches.set_value(
+      true);
+    auto reset = ss::defer([] {
+        config::shard_local_cfg()
+          .kafka_recompress_uncompressed_batches.reset();
+    });
+
+    BOOST_REQUIRE_EQUAL(
+      kafka::recompression_codec(uncompressed, model::compression::zstd),
+      model::compression::zstd);
+    BOOST_REQUIRE_EQUAL(
+      kafka::recompression_codec(uncompressed, model::compression::lz4),
+      model::compression::lz4);
+    BOOST_REQUIRE(!kafka::recompression_codec(
+      uncompressed, model::compression::producer));
+    BOOST_REQUIRE(
+      !kafka::recompression_codec(uncompressed, model::compression::none));
+
+    // batches compressed by the producer are stored as they are
+    BOOST_REQUIRE(!kafka::recompression_codec(
+      make_header(model::compression::gzip), model::compression::zstd));
+
+    auto control = uncompressed;
+    control.attrs.set_control_type();
+    BOOST_REQUIRE(
+      !kafka::recompression_codec(control, model::compression::zstd));
+}
+
+BOOST_AUTO_TEST_CASE(recompression_budget_is_per_window) {
+    kafka::recompression_budget budget;
+    auto now = kafka::recompression_budget::clock_type::now();
+    BOOST_REQUIRE(budget.has_budget(10, now));
+    budget.spend(50ms);
+    BOOST_REQUIRE(budget.has_budget(10, now));
+    budget.spend(50ms);
+    BOOST_REQUIRE(!budget.has_budget(10, now + 500ms));
+    BOOST_REQUIRE(budget.has_budget(20, now + 500ms));
+    // the budget is back in the next window
+    BOOST_REQUIRE(budget.has_budget(10, now + 1s));
+}
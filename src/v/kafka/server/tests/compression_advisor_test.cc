@@ -0,0 +1,85 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "bytes/iobuf.h"
+#include "kafka/server/compression_advisor.h"
+#include "model/compression.h"
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+using namespace std::chrono_literals;
+using advisor = kafka::compression_advisor;
+
+namespace {
+
+advisor::codec_measure make_measure(
+  model::compression c,
+  size_t compressed,
+  std::chrono::microseconds compress,
+  std::chrono::microseconds decompress = 0us) {
+    return advisor::codec_measure{
+      .codec = c,
+      .uncompressed_bytes = 1000,
+      .compressed_bytes = compressed,
+      .compress_time = compress,
+      .decompress_time = decompress};
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(measures_codecs_on_a_payload) {
+    iobuf payload;
+    for (int i = 0; i < 1000; ++i) {
+        payload.append(std::string_view("{\"key\": \"value\", \"n\": 42}"));
+    }
+    for (auto c : advisor::codecs) {
+        auto m = advisor::measure(payload, c);
+        BOOST_REQUIRE_EQUAL(m.codec, c);
+        BOOST_REQUIRE_EQUAL(m.uncompressed_bytes, payload.size_bytes());
+        BOOST_REQUIRE_GT(m.compressed_bytes, 0);
+        BOOST_REQUIRE_GT(m.ratio(), advisor::min_ratio);
+    }
+
+    auto sum = advisor::measure(payload, model::compression::zstd);
+    const auto one = sum;
+    sum += one;
+    BOOST_REQUIRE_EQUAL(sum.uncompressed_bytes, 2 * one.uncompressed_bytes);
+    BOOST_REQUIRE_EQUAL(sum.compressed_bytes, 2 * one.compressed_bytes);
+    BOOST_REQUIRE_EQUAL(sum.ratio(), one.ratio());
+}
+
+BOOST_AUTO_TEST_CASE(recommends_the_best_ratio_at_a_reasonable_cost) {
+    BOOST_REQUIRE_EQUAL(advisor::recommend({}), model::compression::none);
+
+    std::vector<advisor::codec_measure> measures{
+      make_measure(model::compression::gzip, 300, 100us, 20us),
+      make_measure(model::compression::snappy, 550, 10us, 5us),
+      make_measure(model::compression::lz4, 500, 10us, 2us),
+      make_measure(model::compression::zstd, 330, 35us, 5us)};
+    // gzip compresses best but costs ten times lz4
+    BOOST_REQUIRE_EQUAL(
+      advisor::recommend(measures), model::compression::zstd);
+
+    measures[3].compress_time = 80us;
+    BOOST_REQUIRE_EQUAL(advisor::recommend(measures), model::compression::lz4);
+
+    // a codec that was not measured does not count
+    measures[1].uncompressed_bytes = 0;
+    measures[1].compress_time = 1us;
+    BOOST_REQUIRE_EQUAL(advisor::recommend(measures), model::compression::lz4);
+}
+
+BOOST_AUTO_TEST_CASE(recommends_none_for_incompressible_data) {
+    std::vector<advisor::codec_measure> measures{
+      make_measure(model::compression::lz4, 990, 10us),
+      make_measure(model::compression::zstd, 950, 20us)};
+    BOOST_REQUIRE_EQUAL(
+      advisor::recommend(measures), model::compression::none);
+}
@@ -8,6 +8,7 @@
  * the Business Source License, use of this software will be governed
  * by the Apache License, Version 2.0
  */
+#include "config/configuration.h"
 #include "kafka/client/types.h"
 #include "kafka/protocol/fetch.h"
 #include "kafka/protocol/schemata/fetch_request.h"
@@ -23,6 +24,8 @@
 #include "redpanda/tests/fixture.h"
 #include "test_utils/fixture.h"
 
+#include <seastar/core/loop.hh>
+#include <seastar/core/smp.hh>
 #include <seastar/core/sstring.hh>
 #include <seastar/testing/perf_tests.hh>
 #include <seastar/testing/thread_test_case.hh>
@@ -91,6 +94,84 @@ struct fetch_plan_fixture : redpanda_thread_fixture {
 
         BOOST_TEST_CHECKPOINT("HERE");
     }
+
+    static constexpr size_t concurrent_fetch_count = 64;
+    static constexpr size_t partitions_per_fetch = 8;
+
+    kafka::fetch_request make_sessionless_fetch(size_t first_partition) {
+        kafka::fetch_topic ft;
+        ft.name = t;
+        for (size_t i = 0; i < partitions_per_fetch; ++i) {
+            kafka::fetch_partition fp;
+            fp.partition_index = model::partition_id(
+              (first_partition + i) % total_partition_count);
+            fp.fetch_offset = model::offset(0);
+            fp.current_leader_epoch = kafka::leader_epoch(-1);
+            fp.log_start_offset = model::offset(-1);
+            fp.max_bytes = 1_MiB;
+            ft.fetch_partitions.push_back(std::move(fp));
+        }
+
+        kafka::fetch_request_data frq_data;
+        frq_data.replica_id = kafka::client::consumer_replica_id;
+        frq_data.max_wait_ms = 0ms;
+        frq_data.min_bytes = 1;
+        frq_data.max_bytes = 52428800;
+        frq_data.isolation_level = model::isolation_level::read_uncommitted;
+        frq_data.session_id = kafka::invalid_fetch_session_id;
+        frq_data.session_epoch = kafka::final_fetch_session_epoch;
+        frq_data.topics.push_back(std::move(ft));
+        return kafka::fetch_request{std::move(frq_data)};
+    }
+
+    /**
+     * Runs read passes of many small concurrent fetch requests, each of which
+     * reads partitions from several shards.
+     */
+    size_t concurrent_fetches(bool coalesce) {
+        ss::smp::invoke_on_all([coalesce] {
+            auto& cfg = config::shard_local_cfg();
+            cfg.fetch_coalesce_cross_shard_reads.set_value(coalesce);
+        }).get();
+
+        std::vector<std::unique_ptr<kafka::op_context>> octxs;
+        for (size_t i = 0; i < concurrent_fetch_count; ++i) {
+            const auto first_partition = i * partitions_per_fetch;
+            for (size_t p = 0; p < partitions_per_fetch; ++p) {
+                auto p_id = model::partition_id(
+                  (first_partition + p) % total_partition_count);
+                wait_for_leader(model::ntp(model::kafka_namespace, t, p_id))
+                  .get();
+            }
+            kafka::request_header header{
+              .key = kafka::fetch_handler::api::key,
+              .version = kafka::fetch_handler::max_supported};
+            octxs.push_back(std::make_unique<kafka::op_context>(
+              make_request_context(
+                make_sessionless_fetch(first_partition), header),
+              ss::default_smp_service_group()));
+        }
+
+        constexpr size_t iters = 1000;
+
+        perf_tests::start_measuring_time();
+        for (size_t i = 0; i < iters; i++) {
+            ss::parallel_for_each(
+              octxs,
+              [](std::unique_ptr<kafka::op_context>& octx) {
+                  octx->reset_context();
+                  return kafka::testing::execute_simple_fetch_plan(
+                    *octx, kafka::testing::make_simple_fetch_plan(*octx));
+              })
+              .get();
+        }
+        perf_tests::stop_measuring_time();
+
+        ss::smp::invoke_on_all([] {
+            config::shard_local_cfg().fetch_coalesce_cross_shard_reads.reset();
+        }).get();
+        return concurrent_fetch_count * iters;
+    }
 };
 
 PERF_TEST_F(fetch_plan_fixture, test_fetch_plan) {
@@ -215,3 +296,11 @@ PERF_TEST_F(fetch_plan_fixture, test_fetch_plan) {
     // }
     return (size_t)(session_partition_count * iters);
 }
+
+PERF_TEST_F(fetch_plan_fixture, test_concurrent_fetches) {
+    return concurrent_fetches(false);
+}
+
+PERF_TEST_F(fetch_plan_fixture, test_coalesced_concurrent_fetches) {
+    return concurrent_fetches(true);
+}
@@ -0,0 +1,145 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "base/units.h"
+#include "bytes/iobuf.h"
+#include "config/configuration.h"
+#include "kafka/server/fetch_response_cache.h"
+#include "model/fundamental.h"
+#include "model/namespace.h"
+
+#include <seastar/util/defer.hh>
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+namespace {
+
+using cache_t = kafka::fetch_response_cache;
+
+const model::ntp test_ntp(
+  model::kafka_namespace, model::topic("t"), model::partition_id(0));
+
+cache_t::read_data make_data(size_t size, model::offset last) {
+    iobuf data;
+    data.append(ss::sstring(size, 'x').data(), size);
+    return {.data = std::move(data), .record_count = 10, .last_offset = last};
+}
+
+cache_t::read_bounds make_bounds(model::offset max_offset, size_t max_bytes) {
+    return {
+      .start_offset = model::offset(0),
+      .max_offset = max_offset,
+      .isolation_level = model::isolation_level::read_uncommitted,
+      .max_bytes = max_bytes,
+    };
+}
+
+auto set_capacity(size_t bytes) {
+    config::shard_local_cfg().kafka_fetch_response_cache_bytes.set_value(bytes);
+    return ss::defer([] {
+        config::shard_local_cfg().kafka_fetch_response_cache_bytes.reset();
+    });
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(fetch_response_cache_shares_reads) {
+    auto reset = set_capacity(1_MiB);
+    cache_t cache;
+    const cache_t::log_generation gen{.revision = model::revision_id(1)};
+
+    // a read that stopped at the high watermark
+    cache.put(
+      test_ntp,
+      gen,
+      make_bounds(model::offset(9), 16_KiB),
+      make_data(4_KiB, model::offset(9)));
+    BOOST_REQUIRE_EQUAL(cache.size_bytes(), 4_KiB);
+
+    auto hit = cache.get(test_ntp, gen, make_bounds(model::offset(9), 32_KiB));
+    BOOST_REQUIRE(hit.has_value());
+    BOOST_REQUIRE_EQUAL(hit->data.size_bytes(), 4_KiB);
+    BOOST_REQUIRE_EQUAL(hit->record_count, 10);
+
+    // a smaller budget may return less data
+    BOOST_REQUIRE(
+      !cache.get(test_ntp, gen, make_bounds(model::offset(9), 8_KiB)));
+    // the high watermark moved
+    BOOST_REQUIRE(
+      !cache.get(test_ntp, gen, make_bounds(model::offset(19), 16_KiB)));
+    BOOST_REQUIRE_EQUAL(cache.hits(), 1);
+    BOOST_REQUIRE_EQUAL(cache.misses(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(fetch_response_cache_bounded_by_bytes) {
+    auto reset = set_capacity(4_KiB);
+    cache_t cache;
+    const cache_t::log_generation gen{.revision = model::revision_id(1)};
+
+    // a read that stopped at max_bytes only answers the same budget
+    cache.put(
+      test_ntp,
+      gen,
+      make_bounds(model::offset(99), 2_KiB),
+      make_data(2_KiB, model::offset(9)));
+    BOOST_REQUIRE(
+      cache.get(test_ntp, gen, make_bounds(model::offset(99), 2_KiB)));
+    BOOST_REQUIRE(
+      !cache.get(test_ntp, gen, make_bounds(model::offset(99), 4_KiB)));
+
+    // larger than the whole cache
+    auto other = model::ntp(
+      model::kafka_namespace, model::topic("t"), model::partition_id(1));
+    cache.put(
+      other,
+      gen,
+      make_bounds(model::offset(99), 8_KiB),
+      make_data(8_KiB, model::offset(99)));
+    BOOST_REQUIRE_EQUAL(cache.size_bytes(), 2_KiB);
+
+    // evicts the least recently used entry
+    cache.put(
+      other,
+      gen,
+      make_bounds(model::offset(99), 3_KiB),
+      make_data(3_KiB, model::offset(99)));
+    BOOST_REQUIRE_EQUAL(cache.size_bytes(), 3_KiB);
+    BOOST_REQUIRE(
+      !cache.get(test_ntp, gen, make_bounds(model::offset(99), 2_KiB)));
+}
+
+BOOST_AUTO_TEST_CASE(fetch_response_cache_invalidated_by_truncation) {
+    auto reset = set_capacity(1_MiB);
+    cache_t cache;
+    const cache_t::log_generation gen{.revision = model::revision_id(1)};
+
+    cache.put(
+      test_ntp,
+      gen,
+      make_bounds(model::offset(9), 16_KiB),
+      make_data(4_KiB, model::offset(9)));
+
+    const cache_t::log_generation truncated{
+      .revision = model::revision_id(1), .truncations = 1};
+    BOOST_REQUIRE(
+      !cache.get(test_ntp, truncated, make_bounds(model::offset(9), 16_KiB)));
+    BOOST_REQUIRE_EQUAL(cache.size_bytes(), 0);
+
+    // nothing is cached while the cache is disabled
+    config::shard_local_cfg().kafka_fetch_response_cache_bytes.set_value(
+      size_t(0));
+    BOOST_REQUIRE(!cache.enabled());
+    cache.put(
+      test_ntp,
+      gen,
+      make_bounds(model::offset(9), 16_KiB),
+      make_data(4_KiB, model::offset(9)));
+    BOOST_REQUIRE_EQUAL(cache.size_bytes(), 0);
+}
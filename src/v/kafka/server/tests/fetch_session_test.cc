@@ -225,3 +225,46 @@ FIXTURE_TEST(test_session_operations, fixture) {
         BOOST_REQUIRE(cache.size() == 0);
     }
 }
+
+FIXTURE_TEST(test_session_cache_memory_limit, fixture) {
+    auto make_full_fetch = [](int partitions) {
+        kafka::fetch_request req;
+        req.data.session_epoch = kafka::initial_fetch_session_epoch;
+        req.data.session_id = kafka::invalid_fetch_session_id;
+        req.data.topics = {
+          make_fetch_request_topic(model::topic("test"), partitions)};
+        return req;
+    };
+
+    constexpr size_t limit = 16_KiB;
+    kafka::fetch_session_cache cache(120s, limit);
+
+    // a session in use is never evicted
+    auto in_use = cache.maybe_get_session(make_full_fetch(3));
+    BOOST_REQUIRE(!in_use.is_sessionless());
+
+    kafka::fetch_session_id last_id;
+    for (int i = 0; i < 100; ++i) {
+        auto ctx = cache.maybe_get_session(make_full_fetch(3));
+        BOOST_REQUIRE(!ctx.is_sessionless());
+        last_id = ctx.session()->id();
+        BOOST_REQUIRE_LE(cache.mem_usage(), limit);
+    }
+    BOOST_REQUIRE_GT(cache.evictions(), 0);
+    BOOST_REQUIRE_LT(cache.size(), 101);
+
+    auto incremental = [&cache](kafka::fetch_session_id id) {
+        kafka::fetch_request req;
+        req.data.session_id = id;
+        req.data.session_epoch = kafka::fetch_session_epoch(1);
+        return cache.maybe_get_session(req);
+    };
+    BOOST_REQUIRE(!incremental(in_use.session()->id()).has_error());
+    // the most recently created session is kept
+    BOOST_REQUIRE(!incremental(last_id).has_error());
+
+    // a session that does not fit even in an empty cache is not created
+    auto too_large = cache.maybe_get_session(make_full_fetch(1000));
+    BOOST_REQUIRE(too_large.is_sessionless());
+    BOOST_REQUIRE_LE(cache.mem_usage(), limit);
+}
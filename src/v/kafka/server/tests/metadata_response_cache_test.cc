@@ -0,0 +1,132 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "bytes/iobuf.h"
+#include "kafka/protocol/metadata.h"
+#include "kafka/protocol/wire.h"
+#include "kafka/server/metadata_response_cache.h"
+#include "model/fundamental.h"
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <chrono>
+
+namespace {
+
+using cache_t = kafka::metadata_response_cache;
+
+kafka::metadata_response_data make_reply() {
+    kafka::metadata_response_data reply;
+    reply.brokers.push_back(kafka::metadata_response_broker{
+      .node_id = model::node_id(1), .host = "localhost", .port = 9092});
+    reply.cluster_id = "redpanda.test";
+    reply.controller_id = model::node_id(1);
+
+    kafka::metadata_response_topic topic;
+    topic.name = model::topic("t");
+    for (int i = 0; i < 3; ++i) {
+        kafka::metadata_response_partition p;
+        p.partition_index = model::partition_id(i);
+        p.leader_id = model::node_id(1);
+        p.replica_nodes = {model::node_id(1)};
+        p.isr_nodes = p.replica_nodes;
+        topic.partitions.push_back(std::move(p));
+    }
+    reply.topics.push_back(std::move(topic));
+    return reply;
+}
+
+iobuf encode(auto response, kafka::api_version version) {
+    iobuf buf;
+    kafka::protocol::encoder writer(buf);
+    response.encode(writer, version);
+    return buf;
+}
+
+const cache_t::key test_key{
+  .version = kafka::api_version(9), .listener = "kafka"};
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(encoded_metadata_response_matches_response) {
+    for (auto v : {0, 3, 7, 9}) {
+        const auto version = kafka::api_version(v);
+        auto reply = make_reply();
+        auto body = kafka::encode_metadata_response_body(reply, version);
+
+        kafka::metadata_response response{.data = make_reply()};
+        response.data.throttle_time_ms = std::chrono::milliseconds(100);
+        kafka::encoded_metadata_response encoded{
+          .data = {
+            .throttle_time_ms = std::chrono::milliseconds(100),
+            .body = std::move(body),
+          }};
+        BOOST_REQUIRE_EQUAL(
+          encode(std::move(encoded), version),
+          encode(std::move(response), version));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(metadata_response_cache_shares_responses) {
+    cache_t cache;
+    const cache_t::generation gen{.topics = 1, .leaders = 1};
+    auto reply = make_reply();
+    auto body = kafka::encode_metadata_response_body(reply, test_key.version);
+    cache.put(test_key, gen, reply, body.share(0, body.size_bytes()));
+
+    auto hit = cache.get(test_key, gen, make_reply());
+    BOOST_REQUIRE(hit.has_value());
+    BOOST_REQUIRE_EQUAL(hit->data.body, body);
+
+    // another request version
+    auto other_version = test_key;
+    other_version.version = kafka::api_version(8);
+    BOOST_REQUIRE(!cache.get(other_version, gen, make_reply()));
+
+    // the brokers of the cluster changed
+    auto other_brokers = make_reply();
+    other_brokers.controller_id = model::node_id(2);
+    BOOST_REQUIRE(!cache.get(test_key, gen, other_brokers));
+
+    BOOST_REQUIRE_EQUAL(cache.hits(), 1);
+    BOOST_REQUIRE_EQUAL(cache.misses(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(metadata_response_cache_invalidated_by_generation) {
+    cache_t cache;
+    const cache_t::generation gen{.topics = 1, .leaders = 1};
+    auto reply = make_reply();
+    cache.put(
+      test_key,
+      gen,
+      reply,
+      kafka::encode_metadata_response_body(reply, test_key.version));
+
+    // a leadership change
+    const cache_t::generation moved{.topics = 1, .leaders = 2};
+    BOOST_REQUIRE(!cache.get(test_key, moved, make_reply()));
+    BOOST_REQUIRE_EQUAL(cache.size(), 0);
+
+    // responses of older generations are dropped by newer ones
+    cache.put(
+      test_key,
+      gen,
+      reply,
+      kafka::encode_metadata_response_body(reply, test_key.version));
+    auto other_listener = test_key;
+    other_listener.listener = "internal";
+    cache.put(
+      other_listener,
+      moved,
+      reply,
+      kafka::encode_metadata_response_body(reply, test_key.version));
+    BOOST_REQUIRE_EQUAL(cache.size(), 1);
+    BOOST_REQUIRE(cache.get(other_listener, moved, make_reply()));
+}
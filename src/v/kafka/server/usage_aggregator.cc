@@ -11,6 +11,8 @@
 
 #include "kafka/server/usage_aggregator.h"
 
+#include <seastar/core/when_all.hh>
+
 using namespace std::chrono_literals;
 
 namespace kafka {
@@ -34,18 +36,21 @@ static ss::future<>
 persist_to_disk(storage::kvstore& kvstore, persisted_state s) {
     using kv_ks = storage::kvstore::key_space;
 
-    co_await kvstore.put(
-      kv_ks::usage,
-      key_to_bytes(period_key),
-      serde::to_iobuf(s.configured_period));
-    co_await kvstore.put(
-      kv_ks::usage,
-      key_to_bytes(max_duration_key),
-      serde::to_iobuf(s.configured_windows));
-    co_await kvstore.put(
-      kv_ks::usage,
-      key_to_bytes(buckets_key),
-      serde::to_iobuf(std::move(s.current_state)));
+    /// Issued together so that the kvstore flushes them in a single write
+    co_await ss::when_all_succeed(
+      kvstore.put(
+        kv_ks::usage,
+        key_to_bytes(period_key),
+        serde::to_iobuf(s.configured_period)),
+      kvstore.put(
+        kv_ks::usage,
+        key_to_bytes(max_duration_key),
+        serde::to_iobuf(s.configured_windows)),
+      kvstore.put(
+        kv_ks::usage,
+        key_to_bytes(buckets_key),
+        serde::to_iobuf(std::move(s.current_state))))
+      .discard_result();
 }
 
 static std::optional<persisted_state>
@@ -141,14 +146,7 @@ usage_aggregator<clock_type>::usage_aggregator(
         ssx::background
           = ssx::spawn_with_gate_then(
               _bg_write_gate,
-              [this] {
-                  return persist_to_disk(
-                    _kvstore,
-                    persisted_state{
-                      .configured_period = _usage_window_width_interval,
-                      .configured_windows = _usage_num_windows,
-                      .current_state = _buckets.copy()});
-              })
+              [this] { return persist(); })
               .then([this] {
                   if (!_gate.is_closed()) {
                       _persist_disk_timer.arm(_usage_disk_persistance_interval);
@@ -238,6 +236,7 @@ ss::future<> usage_aggregator<clock_type>::start() {
         const auto diff_secs = std::chrono::seconds(
           epoch_time_secs(now) % _usage_window_width_interval.count());
         _buckets[_current_window].reset(epoch_time_secs(now - diff_secs));
+        ++_changes;
     }
     rearm_window_timer();
     _persist_disk_timer.arm(_usage_disk_persistance_interval);
@@ -275,12 +274,7 @@ ss::future<> usage_aggregator<clock_type>::stop() {
         /// Prevent further calls to grab_data to succeed
         _m.broken();
         /// Write freshest buckets to disk
-        co_await persist_to_disk(
-          _kvstore,
-          persisted_state{
-            .configured_period = _usage_window_width_interval,
-            .configured_windows = _usage_num_windows,
-            .current_state = _buckets.copy()});
+        co_await persist();
     } catch (const std::exception& ex) {
         vlog(
           klog.debug,
@@ -290,6 +284,23 @@ ss::future<> usage_aggregator<clock_type>::stop() {
     co_await _gate.close();
 }
 
+template<typename clock_type>
+ss::future<> usage_aggregator<clock_type>::persist() {
+    /// The windows only change when they are closed or queried, persisting
+    /// them in between would rewrite the same state
+    if (_changes == _persisted_changes) {
+        co_return;
+    }
+    const auto changes = _changes;
+    co_await persist_to_disk(
+      _kvstore,
+      persisted_state{
+        .configured_period = _usage_window_width_interval,
+        .configured_windows = _usage_num_windows,
+        .current_state = _buckets.copy()});
+    _persisted_changes = changes;
+}
+
 /// Method to write response to correct bucket, the index to write should be
 /// \ref index, however if enough time has passed that window has been
 /// overwritten, therefore the data can be omitted
@@ -319,6 +330,7 @@ ss::future<> usage_aggregator<clock_type>::grab_data(size_t idx) {
             _buckets[idx].u += usage_data;
             _buckets[idx].u.bytes_cloud_storage
               = usage_data.bytes_cloud_storage;
+            ++_changes;
         }
     } catch (const std::exception& e) {
         vlog(
@@ -338,6 +350,7 @@ void usage_aggregator<clock_type>::close_window() {
     const auto now_ts = epoch_time_secs(now);
     auto& cur = _buckets[_current_window];
     cur.end = now_ts;
+    ++_changes;
     if ((cur.end - cur.begin) != interval) {
         const auto err_str = fmt::format(
           "Observed a bucket (with index {}) that begin ts {} and end "
@@ -405,6 +418,7 @@ void usage_aggregator<clock_type>::reset_state(
         }
     }
     _buckets = std::move(buckets);
+    ++_changes;
 }
 
 template class usage_aggregator<ss::lowres_clock>;
@@ -139,6 +139,7 @@ private:
     void rearm_window_timer();
     bool is_bucket_stale(size_t idx, uint64_t close_ts) const;
     ss::future<> grab_data(size_t);
+    ss::future<> persist();
 
 private:
     size_t _usage_num_windows;
@@ -154,6 +155,9 @@ private:
     ss::gate _gate;
     size_t _current_window{0};
     fragmented_vector<usage_window> _buckets;
+    /// Changes to the windows, the ones already persisted are not rewritten
+    uint64_t _changes{0};
+    uint64_t _persisted_changes{0};
     storage::kvstore& _kvstore;
 };
 } // namespace kafka
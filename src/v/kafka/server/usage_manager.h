@@ -74,6 +74,10 @@ public:
     /// Safely shuts down accounting fiber and deallocates it
     ss::future<> stop();
 
+    /// Whether usage is accounted for, request paths skip the accounting of
+    /// their bytes otherwise
+    bool enabled() const { return _usage_enabled(); }
+
     /// Adds bytes to current open window
     ///
     /// Should be called at the kafka layer to account for bytes sent via kafka
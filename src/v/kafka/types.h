@@ -23,6 +23,8 @@
 
 #include <seastar/core/sstring.hh>
 
+#include <chrono>
+#include <optional>
 #include <unordered_map>
 
 namespace kafka {
@@ -132,6 +134,8 @@ struct replica_info {
     model::offset high_watermark;
     model::offset log_end_offset;
     bool is_alive;
+    // time since the replica last answered its leader, unset for the leader
+    std::optional<std::chrono::milliseconds> last_reply_age;
 };
 
 struct partition_info {
@@ -509,6 +509,7 @@ inline std::ostream& operator<<(std::ostream& os, cloud_storage_backend csb) {
 enum class leader_balancer_mode : uint8_t {
     greedy_balanced_shards = 0,
     random_hill_climbing = 1,
+    heap_balanced_shards = 2,
 };
 
 constexpr const char*
@@ -518,6 +519,8 @@ leader_balancer_mode_to_string(leader_balancer_mode mode) {
         return "greedy_balanced_shards";
     case leader_balancer_mode::random_hill_climbing:
         return "random_hill_climbing";
+    case leader_balancer_mode::heap_balanced_shards:
+        return "heap_balanced_shards";
     default:
         throw std::invalid_argument("unknown leader_balancer_mode");
     }
@@ -544,6 +547,53 @@ operator<<(std::ostream& os, cloud_storage_chunk_eviction_strategy st) {
     }
 }
 
+/**
+ * Eviction policy used by the per-shard batch cache when reclaiming memory.
+ *
+ * lru: ranges are reclaimed in least-recently-used order.
+ * s3_fifo: new ranges are admitted to a small probationary queue and only
+ *   promoted to the main queue if they are accessed again, so that one-off
+ *   scans do not flush frequently read data.
+ */
+enum class batch_cache_eviction_policy : uint8_t {
+    lru = 0,
+    s3_fifo = 1,
+};
+
+inline std::ostream&
+operator<<(std::ostream& os, batch_cache_eviction_policy p) {
+    switch (p) {
+    case batch_cache_eviction_policy::lru:
+        return os << "lru";
+    case batch_cache_eviction_policy::s3_fifo:
+        return os << "s3_fifo";
+    }
+}
+
+/**
+ * Hash function compaction uses to identify keys in its key map and in the
+ * key filters of segments.
+ *
+ * sha256: keys are identified by a truncated sha256 digest, which can't be
+ *   made to collide on purpose.
+ * xxh3: keys are identified by their 128-bit xxh3 hash, which is several
+ *   times cheaper to compute but isn't collision resistant against crafted
+ *   keys.
+ */
+enum class compaction_key_hash : uint8_t {
+    sha256 = 0,
+    xxh3 = 1,
+};
+
+inline std::ostream& operator<<(std::ostream& os, compaction_key_hash h) {
+    switch (h) {
+    case compaction_key_hash::sha256:
+        return os << "sha256";
+    case compaction_key_hash::xxh3:
+        return os << "xxh3";
+    }
+}
+
 enum class fetch_read_strategy : uint8_t {
     polling = 0,
     non_polling = 1,
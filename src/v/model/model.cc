@@ -453,7 +453,11 @@ std::istream& operator>>(std::istream& i, leader_balancer_mode& lbt) {
             .match(
               leader_balancer_mode_to_string(
                 leader_balancer_mode::greedy_balanced_shards),
-              leader_balancer_mode::greedy_balanced_shards);
+              leader_balancer_mode::greedy_balanced_shards)
+            .match(
+              leader_balancer_mode_to_string(
+                leader_balancer_mode::heap_balanced_shards),
+              leader_balancer_mode::heap_balanced_shards);
     return i;
 }
 
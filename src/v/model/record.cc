@@ -11,8 +11,67 @@
 
 #include "model/record.h"
 
+#include "utils/object_pool.h"
+
 namespace model {
 
+namespace {
+
+// the buffers of at most so many headers are recycled, records with more
+// headers are rare
+constexpr size_t max_recycled_headers = 64;
+constexpr size_t max_recycled_buffers = 1024;
+
+using headers_cache_t = object_cache<
+  std::vector<record_header>,
+  max_recycled_buffers>;
+
+// records may outlive the cache when thread local objects are destroyed
+thread_local bool headers_cache_destroyed = false;
+
+struct headers_cache final : headers_cache_t {
+    headers_cache() = default;
+    headers_cache(const headers_cache&) = delete;
+    headers_cache& operator=(const headers_cache&) = delete;
+    headers_cache(headers_cache&&) = delete;
+    headers_cache& operator=(headers_cache&&) = delete;
+    ~headers_cache() { headers_cache_destroyed = true; }
+};
+
+headers_cache_t* local_headers_cache() {
+    if (headers_cache_destroyed) {
+        return nullptr;
+    }
+    static thread_local headers_cache cache;
+    return &cache;
+}
+
+} // namespace
+
+std::vector<record_header> make_record_headers(size_t count) {
+    std::vector<record_header> headers;
+    if (count == 0) {
+        return headers;
+    }
+    if (auto* cache = local_headers_cache()) {
+        if (auto recycled = cache->take_object()) {
+            headers = std::move(*recycled);
+        }
+    }
+    headers.reserve(count);
+    return headers;
+}
+
+void recycle_record_headers(std::vector<record_header>&& headers) noexcept {
+    if (headers.capacity() > max_recycled_headers) {
+        return;
+    }
+    if (auto* cache = local_headers_cache()) {
+        headers.clear();
+        cache->release_object(std::move(headers));
+    }
+}
+
 bool record_batch_iterator::has_next() const noexcept {
     return _index < _record_count;
 }
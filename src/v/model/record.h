@@ -116,6 +116,15 @@ private:
     iobuf _value;
 };
 
+/// Returns an empty vector for `count` record headers. Its buffer is the one
+/// of the headers of a record destroyed on this shard when there is one, so
+/// parsing the records of a batch doesn't allocate headers record after
+/// record.
+std::vector<record_header> make_record_headers(size_t count);
+
+/// Keeps the buffer of the headers of a record for make_record_headers
+void recycle_record_headers(std::vector<record_header>&&) noexcept;
+
 /// \brief
 // DefaultRecord(int sizeInBytes,
 //               byte attributes,
@@ -137,7 +146,11 @@ private:
 class record {
 public:
     record() = default;
-    ~record() noexcept = default;
+    ~record() noexcept {
+        if (_headers.capacity() > 0) {
+            recycle_record_headers(std::move(_headers));
+        }
+    }
     record(record&&) noexcept = default;
     record& operator=(record&&) noexcept = default;
     record(const record&) = delete;
@@ -230,8 +243,7 @@ public:
     std::vector<record_header>& headers() { return _headers; }
 
     record share() {
-        std::vector<record_header> copy;
-        copy.reserve(_headers.size());
+        auto copy = make_record_headers(_headers.size());
         for (auto& h : _headers) {
             copy.push_back(h.share());
         }
@@ -247,8 +259,7 @@ public:
           std::move(copy));
     }
     record copy() const {
-        std::vector<record_header> cp;
-        cp.reserve(_headers.size());
+        auto cp = make_record_headers(_headers.size());
         for (auto& h : _headers) {
             cp.push_back(h.copy());
         }
@@ -9,6 +9,7 @@
 
 #include "model/record_batch_reader.h"
 
+#include "bytes/foreign_iobuf.h"
 #include "container/fragmented_vector.h"
 #include "model/record.h"
 #include "model/record_batch_types.h"
@@ -135,6 +136,41 @@ record_batch_reader make_foreign_memory_record_batch_reader(record_batch b) {
     return make_foreign_memory_record_batch_reader(std::move(data));
 }
 
+record_batch_reader
+make_foreign_shared_memory_record_batch_reader(record_batch b) {
+    class reader final : public record_batch_reader::impl {
+    public:
+        explicit reader(record_batch b)
+          : _batch(
+            ss::make_foreign(std::make_unique<record_batch>(std::move(b)))) {}
+
+        bool is_end_of_stream() const final { return !_batch; }
+
+        void print(std::ostream& os) final {
+            fmt::print(os, "foreign shared memory reader");
+        }
+
+    protected:
+        ss::future<record_batch_reader::storage_t>
+        do_load_slice(timeout_clock::time_point) final {
+            auto header = _batch->header();
+            header.ctx.owner_shard = ss::this_shard_id();
+            const iobuf& records = _batch->data();
+            auto shared = share_foreign_iobuf(records, std::move(_batch));
+            data_t data;
+            data.emplace_back(
+              header, std::move(shared), record_batch::tag_ctor_ng{});
+            return ss::make_ready_future<record_batch_reader::storage_t>(
+              std::move(data));
+        }
+
+    private:
+        ss::foreign_ptr<std::unique_ptr<record_batch>> _batch;
+    };
+
+    return make_record_batch_reader<reader>(std::move(b));
+}
+
 record_batch_reader make_generating_record_batch_reader(
   ss::noncopyable_function<ss::future<record_batch_reader::data_t>()> gen) {
     class reader final : public record_batch_reader::impl {
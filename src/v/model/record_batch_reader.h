@@ -312,6 +312,15 @@ ss::future<record_batch_reader::data_t> transform_reader_to_memory(
 
 record_batch_reader make_foreign_memory_record_batch_reader(record_batch);
 
+/**
+ * Like make_foreign_memory_record_batch_reader, but the core that consumes
+ * the reader shares the records of the batch rather than copying them. The
+ * memory of the batch is released on the core that created the reader once
+ * the consumer has released the shared records.
+ */
+record_batch_reader
+  make_foreign_shared_memory_record_batch_reader(record_batch);
+
 record_batch_reader
   make_foreign_memory_record_batch_reader(record_batch_reader::data_t);
 
@@ -93,9 +93,9 @@ int32_t crc_record_batch(const record_batch& b) {
 template<typename Parser, typename ParserData>
 static std::vector<model::record_header>
 parse_record_headers(Parser& parser, ParserData parser_data) {
-    std::vector<model::record_header> headers;
     auto [header_count, _] = parser.read_varlong();
-    headers.reserve(header_count);
+    auto headers = model::make_record_headers(
+      static_cast<size_t>(header_count));
     for (int i = 0; i < header_count; ++i) {
         auto [key_length, kv] = parser.read_varlong();
         iobuf key;
@@ -119,9 +119,9 @@ static model::record do_parse_one_record_from_buffer(
   int32_t record_size,
   model::record_attributes::type attr,
   ParserData parser_data) {
-    auto [timestamp_delta, tv] = parser.read_varlong();
-    auto [offset_delta, ov] = parser.read_varlong();
-    auto [key_length, kv] = parser.read_varlong();
+    // the first varints of the record are decoded at once, see read_varlongs
+    auto [timestamp_delta, offset_delta, key_length]
+      = parser.template read_varlongs<3>();
     iobuf key;
     if (key_length > 0) {
         key = parser_data(parser, key_length);
@@ -106,3 +106,29 @@ SEASTAR_THREAD_TEST_CASE(extra_bytes_iterator) {
     BOOST_TEST(it.has_next());
     BOOST_REQUIRE_THROW(it.next(), std::out_of_range);
 }
+
+SEASTAR_THREAD_TEST_CASE(record_headers_are_recycled) {
+    auto headers = model::make_record_headers(2);
+    BOOST_REQUIRE(headers.empty());
+    BOOST_REQUIRE_GE(headers.capacity(), 2);
+    iobuf key;
+    key.append("k", 1);
+    headers.emplace_back(1, std::move(key), -1, iobuf{});
+    const auto* buffer = headers.data();
+    {
+        model::record r(
+          model::record_attributes{}, 0, 0, {}, {}, std::move(headers));
+    }
+    // the buffer of the destroyed record is reused
+    auto reused = model::make_record_headers(1);
+    BOOST_REQUIRE(reused.empty());
+    BOOST_REQUIRE_EQUAL(reused.data(), buffer);
+
+    // and records parsed from a batch don't lose their headers
+    auto b = model::test::make_random_batch(model::offset(0), 10, false);
+    auto expected = b.copy_records();
+    auto it = model::record_batch_iterator::create(b);
+    for (const auto& r : expected) {
+        BOOST_REQUIRE(it.next() == r);
+    }
+}
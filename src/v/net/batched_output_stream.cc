@@ -11,6 +11,8 @@
 
 #include "base/likely.h"
 #include "base/vassert.h"
+#include "config/configuration.h"
+#include "ssx/future-util.h"
 #include "ssx/semaphore.h"
 
 #include <seastar/core/future.hh>
@@ -21,15 +23,40 @@
 namespace net {
 
 batched_output_stream::batched_output_stream(
-  ss::output_stream<char> o, size_t cache)
+  ss::output_stream<char> o, size_t cache, batched_output_stream_stats* stats)
   : _out(std::move(o))
   , _cache_size(cache)
-  , _write_sem(std::make_unique<ssx::semaphore>(1, "net/batch-ostream")) {
+  , _write_sem(std::make_unique<ssx::semaphore>(1, "net/batch-ostream"))
+  , _stats(stats)
+  , _max_flush_delay(std::chrono::microseconds(
+      config::shard_local_cfg().rpc_write_coalescing_max_delay_us()))
+  , _flush_timer([this] { on_flush_deadline(); }) {
     // Size zero reserved for identifying default-initialized
     // instances in stop()
     vassert(_cache_size > 0, "Size must be > 0");
 }
 
+batched_output_stream::batched_output_stream(
+  batched_output_stream&& o) noexcept
+  : _out(std::move(o._out))
+  , _cache_size(o._cache_size)
+  , _write_sem(std::move(o._write_sem))
+  , _unflushed_bytes(o._unflushed_bytes)
+  , _closed(o._closed)
+  , _stats(o._stats)
+  , _unflushed_fragments(o._unflushed_fragments)
+  , _unflushed_messages(o._unflushed_messages)
+  , _max_flush_delay(o._max_flush_delay)
+  , _first_unflushed_at(o._first_unflushed_at)
+  , _last_arrival(o._last_arrival)
+  , _arrival_interval(o._arrival_interval)
+  , _flush_timer([this] { on_flush_deadline(); }) {
+    if (o._flush_timer.armed()) {
+        _flush_timer.arm(o._flush_timer.get_timeout());
+        o._flush_timer.cancel();
+    }
+}
+
 [[gnu::cold]] static ss::future<bool>
 already_closed_error(ss::scattered_message<char>& msg) {
     return ss::make_exception_future<bool>(
@@ -40,27 +67,93 @@ ss::future<bool> batched_output_stream::write(ss::scattered_message<char> msg) {
     if (unlikely(_closed)) {
         return already_closed_error(msg);
     }
+    record_arrival();
     return ss::with_semaphore(
       *_write_sem, 1, [this, v = std::move(msg)]() mutable {
           if (unlikely(_closed)) {
               return already_closed_error(v);
           }
           const size_t vbytes = v.size();
-          return _out.write(std::move(v)).then([this, vbytes] {
+          auto packet = std::move(v).release();
+          const size_t fragments = packet.nr_frags();
+          return _out.write(std::move(packet)).then([this, vbytes, fragments] {
+              if (_unflushed_messages == 0) {
+                  _first_unflushed_at = clock_type::now();
+              }
               _unflushed_bytes += vbytes;
+              _unflushed_fragments += fragments;
+              ++_unflushed_messages;
               if (
-                _write_sem->waiters() == 0 || _unflushed_bytes >= _cache_size) {
+                _unflushed_bytes >= _cache_size
+                || _unflushed_fragments >= max_unflushed_fragments
+                || (_write_sem->waiters() == 0 && !maybe_delay_flush())) {
                   return do_flush().then([] { return true; });
               }
               return ss::make_ready_future<bool>(false);
           });
       });
 }
+
+void batched_output_stream::record_arrival() {
+    if (_max_flush_delay == clock_type::duration::zero()) {
+        return;
+    }
+    const auto now = clock_type::now();
+    if (_last_arrival) {
+        const auto interval = now - *_last_arrival;
+        _arrival_interval = _arrival_interval
+                              ? (*_arrival_interval * 7 + interval) / 8
+                              : interval;
+    }
+    _last_arrival = now;
+}
+
+bool batched_output_stream::maybe_delay_flush() {
+    if (
+      !_arrival_interval || *_arrival_interval >= _max_flush_delay
+      || _closed) {
+        return false;
+    }
+    const auto deadline = _first_unflushed_at
+                          + std::min(_max_flush_delay, *_arrival_interval * 2);
+    if (clock_type::now() >= deadline) {
+        return false;
+    }
+    if (!_flush_timer.armed()) {
+        _flush_timer.arm(deadline);
+    }
+    return true;
+}
+
+void batched_output_stream::on_flush_deadline() {
+    auto f = ss::with_semaphore(*_write_sem, 1, [this] {
+        if (_closed || _unflushed_bytes == 0) {
+            // stop() flushes what is left
+            return ss::now();
+        }
+        if (_stats) {
+            ++_stats->delayed_flushes;
+        }
+        return do_flush();
+    });
+    ssx::background = std::move(f).handle_exception(
+      [](const std::exception_ptr&) {
+          // the stream is broken, the next write or flush fails as well
+      });
+}
+
 ss::future<> batched_output_stream::do_flush() {
     if (_unflushed_bytes == 0) {
         return ss::make_ready_future<>();
     }
+    _flush_timer.cancel();
+    if (_stats) {
+        _stats->messages += _unflushed_messages;
+        ++_stats->flushes;
+    }
     _unflushed_bytes = 0;
+    _unflushed_fragments = 0;
+    _unflushed_messages = 0;
     return _out.flush();
 }
 ss::future<> batched_output_stream::flush() {
@@ -71,6 +164,7 @@ ss::future<> batched_output_stream::stop() {
         return ss::make_ready_future<>();
     }
     _closed = true;
+    _flush_timer.cancel();
 
     if (_cache_size == 0) {
         // A default-initialized batched_output_stream has a default
@@ -12,12 +12,17 @@
 #pragma once
 
 #include "base/seastarx.h"
+#include "net/types.h"
 #include "ssx/semaphore.h"
 
 #include <seastar/core/iostream.hh>
+#include <seastar/core/timer.hh>
 
+#include <chrono>
+#include <climits>
 #include <cstddef>
 #include <memory>
+#include <optional>
 
 namespace net {
 
@@ -43,22 +48,28 @@ private:
  * flushes when multiple writes are in progress on the stream: a flush occurs
  * only when the last pending writer completes or when a configured amount of
  * unflushed bytes have accumulated.
+ *
+ * With rpc_write_coalescing_max_delay_us, the flush by the last writer is
+ * also held back while messages arrive faster than that delay, so that a
+ * stream of small messages, e.g. heartbeats, is sent with a single writev.
+ * The first unflushed message waits for at most twice the average interval
+ * between the arrivals, and never for longer than the configured delay.
+ * Holding back stops at the byte limit and at the number of fragments a
+ * single writev takes.
  */
 class batched_output_stream {
 public:
     static constexpr size_t default_max_unflushed_bytes = 1024 * 1024;
+    static constexpr size_t max_unflushed_fragments = IOV_MAX;
 
     batched_output_stream() = default;
     explicit batched_output_stream(
-      ss::output_stream<char>, size_t cache = default_max_unflushed_bytes);
+      ss::output_stream<char>,
+      size_t cache = default_max_unflushed_bytes,
+      batched_output_stream_stats* stats = nullptr);
     ~batched_output_stream() noexcept = default;
     // NOTE: explicitly defined for a gcc
-    batched_output_stream(batched_output_stream&& o) noexcept
-      : _out(std::move(o._out))
-      , _cache_size(o._cache_size)
-      , _write_sem(std::move(o._write_sem))
-      , _unflushed_bytes(o._unflushed_bytes)
-      , _closed(o._closed) {}
+    batched_output_stream(batched_output_stream&& o) noexcept;
     batched_output_stream& operator=(batched_output_stream&& o) noexcept {
         if (this != &o) {
             this->~batched_output_stream();
@@ -91,12 +102,28 @@ public:
     bool is_valid() const noexcept { return _cache_size != 0; }
 
 private:
+    using clock_type = ss::steady_clock_type;
+
     ss::future<> do_flush();
+    void record_arrival();
+    /// Arms the flush at the coalescing deadline, false if it is due now
+    bool maybe_delay_flush();
+    void on_flush_deadline();
 
     ss::output_stream<char> _out;
     size_t _cache_size{0};
     std::unique_ptr<ssx::semaphore> _write_sem;
     size_t _unflushed_bytes{0};
     bool _closed = false;
+
+    batched_output_stream_stats* _stats{nullptr};
+    size_t _unflushed_fragments{0};
+    size_t _unflushed_messages{0};
+    clock_type::duration _max_flush_delay{0};
+    clock_type::time_point _first_unflushed_at;
+    std::optional<clock_type::time_point> _last_arrival;
+    // exponentially weighted moving average of the interval between writes
+    std::optional<clock_type::duration> _arrival_interval;
+    ss::timer<clock_type> _flush_timer;
 };
 } // namespace net
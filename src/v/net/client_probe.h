@@ -12,6 +12,7 @@
 #pragma once
 #include "metrics/metrics.h"
 #include "model/metadata.h"
+#include "net/types.h"
 #include "net/unresolved_address.h"
 #include "rpc/logger.h"
 #include "rpc/types.h"
@@ -76,6 +77,8 @@ public:
 
     void waiting_for_available_memory() { ++_requests_blocked_memory; }
 
+    batched_output_stream_stats& write_stats() { return _write_stats; }
+
     void setup_metrics(
       metrics::internal_metric_groups& mgs,
       const std::optional<rpc::connection_cache_label>& label,
@@ -98,6 +101,7 @@ private:
     uint32_t _server_correlation_errors = 0;
     uint32_t _client_correlation_errors = 0;
     uint32_t _requests_blocked_memory = 0;
+    batched_output_stream_stats _write_stats;
     metrics::internal_metric_groups _metrics;
 
     friend std::ostream& operator<<(std::ostream& o, const client_probe& p);
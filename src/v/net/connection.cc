@@ -140,7 +140,10 @@ connection::connection(
   , _fd(std::move(f))
   , _local_addr(_fd.local_address())
   , _in(_fd.input())
-  , _out(_fd.output())
+  , _out(
+      _fd.output(),
+      batched_output_stream::default_max_unflushed_bytes,
+      &p.write_stats())
   , _probe(p)
   , _tls_enabled(tls_enabled) {
     if (in_max_buffer_size.has_value()) {
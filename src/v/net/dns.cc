@@ -10,7 +10,11 @@
  */
 #include "net/dns.h"
 
+#include "base/vlog.h"
+#include "config/configuration.h"
 #include "net/unresolved_address.h"
+#include "rpc/logger.h"
+#include "ssx/future-util.h"
 #include "utils/mutex.h"
 
 #include <seastar/core/coroutine.hh>
@@ -18,15 +22,136 @@
 
 namespace net {
 
-ss::future<ss::socket_address> resolve_dns(unresolved_address address) {
+namespace {
+
+ss::future<ss::net::inet_address>
+resolve_name(const ss::sstring& host, unresolved_address::inet_family family) {
     static thread_local ss::net::dns_resolver resolver;
     static thread_local mutex m{"resolve_dns"};
     // lock
     auto units = co_await m.get_units();
     // resolve
-    auto i_a = co_await resolver.resolve_name(address.host(), address.family());
+    co_return co_await resolver.resolve_name(host, family);
+}
+
+dns_cache& local_dns_cache() {
+    static thread_local dns_cache cache(
+      &resolve_name,
+      config::shard_local_cfg().dns_cache_ttl_ms.bind(),
+      config::shard_local_cfg().dns_cache_negative_ttl_ms.bind());
+    return cache;
+}
+
+} // namespace
+
+ss::future<ss::socket_address> resolve_dns(unresolved_address address) {
+    auto i_a = co_await resolve_name(address.host(), address.family());
 
     co_return ss::socket_address(i_a, address.port());
 };
 
+ss::future<ss::socket_address> resolve_dns_cached(unresolved_address address) {
+    return local_dns_cache().resolve(std::move(address));
+}
+
+dns_cache::dns_cache(
+  resolver r,
+  config::binding<std::chrono::milliseconds> ttl,
+  config::binding<std::chrono::milliseconds> negative_ttl)
+  : _resolve(std::move(r))
+  , _ttl(std::move(ttl))
+  , _negative_ttl(std::move(negative_ttl)) {}
+
+ss::future<> dns_cache::stop() { return _gate.close(); }
+
+ss::future<ss::socket_address> dns_cache::resolve(unresolved_address address) {
+    auto i_a = co_await lookup({address.host(), address.family()});
+
+    co_return ss::socket_address(i_a, address.port());
+}
+
+ss::future<ss::net::inet_address> dns_cache::lookup(key k) {
+    const auto ttl = _ttl();
+    if (ttl <= std::chrono::milliseconds::zero()) {
+        co_return co_await _resolve(k.first, k.second);
+    }
+    const auto now = clock_type::now();
+    if (auto it = _entries.find(k); it != _entries.end()) {
+        auto& e = it->second;
+        if (now < e.expires) {
+            if (e.address) {
+                co_return *e.address;
+            }
+            std::rethrow_exception(e.error);
+        }
+        if (e.address && now < e.expires + ttl) {
+            if (!e.refreshing && !_gate.is_closed()) {
+                e.refreshing = true;
+                ssx::spawn_with_gate(
+                  _gate, [this, k]() mutable { return refresh(std::move(k)); });
+            }
+            co_return *e.address;
+        }
+    }
+    co_return co_await resolve_and_store(std::move(k));
+}
+
+ss::future<ss::net::inet_address> dns_cache::resolve_and_store(key k) {
+    std::exception_ptr error;
+    std::optional<ss::net::inet_address> address;
+    try {
+        address = co_await _resolve(k.first, k.second);
+    } catch (...) {
+        error = std::current_exception();
+    }
+    if (address) {
+        store(
+          std::move(k),
+          {.address = address, .expires = clock_type::now() + _ttl()});
+        co_return *address;
+    }
+    if (_negative_ttl() > std::chrono::milliseconds::zero()) {
+        store(
+          std::move(k),
+          {.error = error, .expires = clock_type::now() + _negative_ttl()});
+    } else {
+        _entries.erase(k);
+    }
+    std::rethrow_exception(error);
+}
+
+ss::future<> dns_cache::refresh(key k) {
+    try {
+        auto address = co_await _resolve(k.first, k.second);
+        store(k, {.address = address, .expires = clock_type::now() + _ttl()});
+    } catch (...) {
+        // the stale address stays until it expires for good, the next lookup
+        // tries to refresh it again
+        vlog(
+          rpc::rpclog.debug,
+          "Failed to refresh the address of {}: {}",
+          k.first,
+          std::current_exception());
+        if (auto it = _entries.find(k); it != _entries.end()) {
+            it->second.refreshing = false;
+        }
+    }
+}
+
+void dns_cache::store(key k, entry e) {
+    if (_entries.size() >= max_entries && !_entries.contains(k)) {
+        const auto now = clock_type::now();
+        const auto ttl = _ttl();
+        absl::erase_if(_entries, [now, ttl](const auto& kv) {
+            const auto& cached = kv.second;
+            return cached.address ? cached.expires + ttl <= now
+                                  : cached.expires <= now;
+        });
+        if (_entries.size() >= max_entries) {
+            _entries.erase(_entries.begin());
+        }
+    }
+    _entries.insert_or_assign(std::move(k), std::move(e));
+}
+
 } // namespace net
@@ -9,8 +9,20 @@
  * by the Apache License, Version 2.0
  */
 #pragma once
+#include "config/property.h"
 #include "net/unresolved_address.h"
 
+#include <seastar/core/gate.hh>
+#include <seastar/core/lowres_clock.hh>
+#include <seastar/util/noncopyable_function.hh>
+
+#include <absl/container/flat_hash_map.h>
+
+#include <chrono>
+#include <exception>
+#include <optional>
+#include <utility>
+
 namespace net {
 
 /**
@@ -20,4 +32,65 @@ namespace net {
  */
 ss::future<ss::socket_address> resolve_dns(unresolved_address);
 
+/**
+ * Resolves addresses like resolve_dns, through the dns_cache of the shard.
+ * Meant for the outgoing connections that the shard makes again and again,
+ * e.g. the reconnects of rpc and cloud storage clients, so that they don't
+ * depend on the resolver every time.
+ */
+ss::future<ss::socket_address> resolve_dns_cached(unresolved_address);
+
+/**
+ * A shard local cache of resolved host names.
+ *
+ * The seastar resolver does not expose the ttl of the records, so the
+ * addresses are reused for a configured ttl instead. Past the ttl an address
+ * is still returned for as long again while a single background lookup
+ * refreshes it, so that a slow resolver only delays the callers once the
+ * address is very stale. A failed lookup is cached for the negative ttl, so
+ * that a storm of reconnects to an unresolvable host does not turn into a
+ * storm of lookups.
+ */
+class dns_cache {
+public:
+    using clock_type = ss::lowres_clock;
+    using resolver = ss::noncopyable_function<ss::future<ss::net::inet_address>(
+      const ss::sstring&, unresolved_address::inet_family)>;
+
+    static constexpr size_t max_entries = 1024;
+
+    dns_cache(
+      resolver,
+      config::binding<std::chrono::milliseconds> ttl,
+      config::binding<std::chrono::milliseconds> negative_ttl);
+
+    ss::future<ss::socket_address> resolve(unresolved_address);
+
+    ss::future<> stop();
+
+    size_t size() const { return _entries.size(); }
+
+private:
+    using key = std::pair<ss::sstring, unresolved_address::inet_family>;
+
+    struct entry {
+        std::optional<ss::net::inet_address> address;
+        // the error of the lookup when there is no address
+        std::exception_ptr error;
+        clock_type::time_point expires;
+        bool refreshing{false};
+    };
+
+    ss::future<ss::net::inet_address> lookup(key);
+    ss::future<ss::net::inet_address> resolve_and_store(key);
+    ss::future<> refresh(key);
+    void store(key, entry);
+
+    resolver _resolve;
+    config::binding<std::chrono::milliseconds> _ttl;
+    config::binding<std::chrono::milliseconds> _negative_ttl;
+    absl::flat_hash_map<key, entry> _entries;
+    ss::gate _gate;
+};
+
 } // namespace net
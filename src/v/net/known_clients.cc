@@ -0,0 +1,75 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "net/known_clients.h"
+
+#include "ssx/future-util.h"
+
+#include <algorithm>
+
+namespace net {
+
+known_clients::known_clients(size_t capacity, clock_type::duration ttl)
+  : _capacity(std::max<size_t>(capacity, 1))
+  , _ttl(ttl) {}
+
+ss::future<> known_clients::stop() { return _gate.close(); }
+
+void known_clients::remember(const ss::net::inet_address& addr) {
+    const auto now = clock_type::now();
+    auto it = _clients.find(inet_address_wrapper(addr));
+    // a client reconnecting all the time is remembered again only once half
+    // of its ttl passed, rather than broadcasting every one of its connections
+    if (it != _clients.end() && it->second - now > _ttl / 2) {
+        return;
+    }
+    const auto expires = now + _ttl;
+    ssx::spawn_with_gate(_gate, [this, addr, expires] {
+        return container().invoke_on_all(
+          [addr, expires](known_clients& local) {
+              local.insert(addr, expires);
+          });
+    });
+}
+
+bool known_clients::is_known(const ss::net::inet_address& addr) const {
+    auto it = _clients.find(inet_address_wrapper(addr));
+    return it != _clients.end() && it->second > clock_type::now();
+}
+
+void known_clients::insert(
+  inet_address_wrapper addr, clock_type::time_point expires) {
+    auto it = _clients.find(addr);
+    if (it != _clients.end()) {
+        it->second = std::max(it->second, expires);
+        return;
+    }
+    if (_clients.size() >= _capacity) {
+        evict(clock_type::now());
+    }
+    _clients.emplace(addr, expires);
+}
+
+void known_clients::evict(clock_type::time_point now) {
+    absl::erase_if(
+      _clients, [now](const auto& client) { return client.second <= now; });
+    if (_clients.size() < _capacity) {
+        return;
+    }
+    // all of them are live, make room by forgetting the one that expires first
+    auto oldest = std::min_element(
+      _clients.begin(), _clients.end(), [](const auto& a, const auto& b) {
+          return a.second < b.second;
+      });
+    _clients.erase(oldest);
+}
+
+} // namespace net
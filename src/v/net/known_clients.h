@@ -0,0 +1,68 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "base/seastarx.h"
+#include "net/inet_address_wrapper.h"
+
+#include <seastar/core/gate.hh>
+#include <seastar/core/lowres_clock.hh>
+#include <seastar/core/sharded.hh>
+#include <seastar/net/inet_address.hh>
+
+#include <absl/container/flat_hash_map.h>
+
+#include <chrono>
+
+namespace net {
+
+/**
+ * A sharded service remembering the addresses of the clients that recently
+ * authenticated with a server, so that the server can tell the connections of
+ * its known clients apart from unknown ones before it spends anything on the
+ * handshake of a connection, see server::accept_finish.
+ *
+ * A connection lands on any shard, so the addresses are remembered on all the
+ * shards. Every shard keeps at most `capacity` addresses, each for `ttl` after
+ * it was last remembered.
+ */
+class known_clients : public ss::peering_sharded_service<known_clients> {
+public:
+    using clock_type = ss::lowres_clock;
+
+    static constexpr size_t default_capacity = 16384;
+    static constexpr std::chrono::seconds default_ttl{3600};
+
+    explicit known_clients(
+      size_t capacity = default_capacity,
+      clock_type::duration ttl = default_ttl);
+
+    ss::future<> stop();
+
+    /// Remembers a client that authenticated, on all the shards
+    void remember(const ss::net::inet_address&);
+
+    bool is_known(const ss::net::inet_address&) const;
+
+    size_t size() const { return _clients.size(); }
+
+private:
+    void insert(inet_address_wrapper, clock_type::time_point expires);
+    void evict(clock_type::time_point now);
+
+    size_t _capacity;
+    clock_type::duration _ttl;
+    absl::flat_hash_map<inet_address_wrapper, clock_type::time_point> _clients;
+    ss::gate _gate;
+};
+
+} // namespace net
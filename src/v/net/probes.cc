@@ -115,6 +115,23 @@ void server_probe::setup_metrics(
           [this] { return _produce_bad_create_time; },
           sm::description("number of produce requests with timestamps too far "
                           "in the future or in the past")),
+        sm::make_counter(
+          "write_messages",
+          [this] { return _write_stats.messages; },
+          sm::description(ssx::sformat(
+            "{}: Number of messages written to the clients; divided by "
+            "write_flushes, the number of messages per system call",
+            proto))),
+        sm::make_counter(
+          "write_flushes",
+          [this] { return _write_stats.flushes; },
+          sm::description(ssx::sformat(
+            "{}: Number of flushes of the writes to the clients", proto))),
+        sm::make_counter(
+          "write_delayed_flushes",
+          [this] { return _write_stats.delayed_flushes; },
+          sm::description(ssx::sformat(
+            "{}: Number of flushes held back to coalesce writes", proto))),
       },
       {},
       {sm::shard_label});
@@ -294,6 +311,26 @@ void client_probe::setup_metrics(
                           " of insufficient memory"),
           labels)
           .aggregate(aggregate_labels),
+        sm::make_counter(
+          "write_messages",
+          [this] { return _write_stats.messages; },
+          sm::description("Number of requests written; divided by "
+                          "write_flushes, the number of requests per system "
+                          "call"),
+          labels)
+          .aggregate(aggregate_labels),
+        sm::make_counter(
+          "write_flushes",
+          [this] { return _write_stats.flushes; },
+          sm::description("Number of flushes of the written requests"),
+          labels)
+          .aggregate(aggregate_labels),
+        sm::make_counter(
+          "write_delayed_flushes",
+          [this] { return _write_stats.delayed_flushes; },
+          sm::description("Number of flushes held back to coalesce writes"),
+          labels)
+          .aggregate(aggregate_labels),
       });
 }
 
@@ -30,13 +30,17 @@
 #include <seastar/net/api.hh>
 #include <seastar/util/later.hh>
 
+#include <sys/socket.h>
+
 namespace net {
 
 server::server(server_configuration c, ss::logger& log)
   : cfg(std::move(c))
   , _log(log)
   , _memory{size_t{static_cast<size_t>(cfg.max_service_memory_per_core)}, "net/server-mem"}
-  , _probe(std::make_unique<server_probe>()) {
+  , _probe(std::make_unique<server_probe>())
+  , _rate_limited_connections(
+      cfg.max_rate_limited_connections, "net/rate-limited-conns") {
     vlog(
       _log.info, "Creating net::server for {} with config {}", cfg.name, cfg);
 }
@@ -79,7 +83,6 @@ void server::start() {
     }
     for (const auto& endpoint : cfg.addrs) {
         ss::server_socket ss;
-        bool tls_enabled = bool(endpoint.credentials);
         try {
             ss::listen_options lo;
             lo.reuse_address = true;
@@ -87,13 +90,7 @@ void server::start() {
             if (cfg.listen_backlog.has_value()) {
                 lo.listen_backlog = cfg.listen_backlog.value();
             }
-
-            if (!endpoint.credentials) {
-                ss = ss::engine().listen(endpoint.addr, lo);
-            } else {
-                ss = ss::tls::listen(
-                  endpoint.credentials, ss::engine().listen(endpoint.addr, lo));
-            }
+            ss = ss::engine().listen(endpoint.addr, lo);
         } catch (...) {
             throw std::runtime_error(fmt::format(
               "{} - Error attempting to listen on {}: {}",
@@ -102,7 +99,7 @@ void server::start() {
               std::current_exception()));
         }
         auto& b = _listeners.emplace_back(std::make_unique<listener>(
-          endpoint.name, std::move(ss), tls_enabled));
+          endpoint.name, std::move(ss), endpoint.credentials));
         listener& ref = *b;
         // background
         ssx::spawn_with_gate(
@@ -188,13 +185,18 @@ ss::future<> server::accept(listener& s) {
     return ss::repeat([this, &s]() mutable {
         return s.socket.accept().then_wrapped(
           [this, &s](ss::future<ss::accept_result> f_cs_sa) {
-              return accept_finish(s.name, std::move(f_cs_sa), s.tls_enabled);
+              return accept_finish(s, std::move(f_cs_sa));
           });
     });
 }
 
+/*
+ * The connection limits apply to the plain tcp connection, before it is
+ * wrapped in tls, so that a storm of connections the limits reject does not
+ * cost the shard a tls handshake, not even a tls session, for each of them.
+ */
 ss::future<ss::stop_iteration> server::accept_finish(
-  ss::sstring name, ss::future<ss::accept_result> f_cs_sa, bool tls_enabled) {
+  const listener& l, ss::future<ss::accept_result> f_cs_sa) {
     if (_as.abort_requested()) {
         f_cs_sa.ignore_ready_future();
         co_return ss::stop_iteration::yes;
@@ -223,10 +225,85 @@ ss::future<ss::stop_iteration> server::accept_finish(
               _log.info,
               "Connection limit reached, rejecting {}",
               ar.remote_address.addr());
+            reject(ar);
             co_return ss::stop_iteration::no;
         }
     }
 
+    if (_connection_rates) {
+        if (!cfg.known_clients) {
+            try {
+                co_await _connection_rates->maybe_wait(
+                  ar.remote_address.addr());
+            } catch (const std::exception& e) {
+                vlog(
+                  _log.trace,
+                  "Timeout while waiting free token for connection rate. "
+                  "addr:{}",
+                  ar.remote_address);
+                _probe->timeout_waiting_rate_limit();
+                reject(ar);
+                co_return ss::stop_iteration::no;
+            }
+        } else if (!cfg.known_clients->get().local().is_known(
+                     ar.remote_address.addr())) {
+            // unknown clients wait for the rate limit in the background, so
+            // that the connections of known clients queued behind them in
+            // the backlog don't
+            auto units = ss::try_get_units(_rate_limited_connections, 1);
+            if (!units) {
+                _probe->connection_rejected();
+                vlog(
+                  _log.debug,
+                  "Too many connections waiting for the connection rate, "
+                  "rejecting {}",
+                  ar.remote_address);
+                reject(ar);
+                co_return ss::stop_iteration::no;
+            }
+            ssx::spawn_with_gate(
+              _conn_gate,
+              [this,
+               &l,
+               ar = std::move(ar),
+               cq_units = std::move(cq_units),
+               units = std::move(*units)]() mutable {
+                  return accept_rate_limited(
+                    l, std::move(ar), std::move(cq_units), std::move(units));
+              });
+            co_return ss::stop_iteration::no;
+        }
+    }
+
+    _as.check();
+    co_await start_connection(l, std::move(ar), std::move(cq_units));
+    co_return ss::stop_iteration::no;
+}
+
+ss::future<> server::accept_rate_limited(
+  const listener& l,
+  ss::accept_result ar,
+  conn_quota::units cq_units,
+  ssx::semaphore_units) {
+    try {
+        co_await _connection_rates->maybe_wait(ar.remote_address.addr());
+    } catch (const std::exception&) {
+        vlog(
+          _log.trace,
+          "Timeout while waiting free token for connection rate. addr:{}",
+          ar.remote_address);
+        _probe->timeout_waiting_rate_limit();
+        reject(ar);
+        co_return;
+    }
+    if (_as.abort_requested()) {
+        co_return;
+    }
+    co_await start_connection(l, std::move(ar), std::move(cq_units));
+}
+
+ss::future<> server::start_connection(
+  const listener& l, ss::accept_result ar, conn_quota::units cq_units) {
     // Apply socket buffer size settings
     if (cfg.tcp_recv_buf.has_value()) {
         // Explicitly store in an int to decouple the
@@ -242,23 +319,26 @@ ss::future<ss::stop_iteration> server::accept_finish(
           SOL_SOCKET, SO_SNDBUF, &send_buf, sizeof(send_buf));
     }
 
-    if (_connection_rates) {
+    const bool tls_enabled = bool(l.credentials);
+    if (tls_enabled) {
+        // the handshake itself happens on the first read of the protocol
         try {
-            co_await _connection_rates->maybe_wait(ar.remote_address.addr());
-        } catch (const std::exception& e) {
+            ar.connection = co_await ss::tls::wrap_server(
+              l.credentials, std::move(ar.connection));
+        } catch (...) {
             vlog(
-              _log.trace,
-              "Timeout while waiting free token for connection rate. "
-              "addr:{}",
-              ar.remote_address);
-            _probe->timeout_waiting_rate_limit();
-            co_return ss::stop_iteration::no;
+              _log.warn,
+              "{} - Error setting up tls for {}: {}",
+              name(),
+              ar.remote_address,
+              std::current_exception());
+            co_return;
         }
     }
 
     auto conn = ss::make_lw_shared<net::connection>(
       _connections,
-      name,
+      l.name,
       std::move(ar.connection),
       ar.remote_address,
       *_probe,
@@ -269,14 +349,34 @@ ss::future<ss::stop_iteration> server::accept_finish(
       "{} - Incoming connection from {} on \"{}\"",
       this->name(),
       ar.remote_address,
-      name);
+      l.name);
 
-    _as.check();
     ssx::spawn_with_gate(
       _conn_gate, [this, conn, cq_units = std::move(cq_units)]() mutable {
           return apply_proto(conn, std::move(cq_units));
       });
-    co_return ss::stop_iteration::no;
+}
+
+/*
+ * Resets a connection the server does not take, rather than closing it
+ * gracefully, so that it neither lingers in TIME_WAIT on the server nor gets
+ * anything more from it.
+ */
+void server::reject(ss::accept_result& ar) {
+    const linger no_linger{.l_onoff = 1, .l_linger = 0};
+    try {
+        ar.connection.set_sockopt(
+          SOL_SOCKET, SO_LINGER, &no_linger, sizeof(no_linger));
+    } catch (...) {
+        // the connection is dropped either way
+    }
+    ar.connection = ss::connected_socket{};
+}
+
+void server::remember_client(const ss::net::inet_address& addr) {
+    if (cfg.known_clients) {
+        cfg.known_clients->get().local().remember(addr);
+    }
 }
 
 ss::future<> server::shutdown_input() {
@@ -377,7 +477,9 @@ std::ostream& operator<<(std::ostream& o, const server_configuration& c) {
       << ", listen_backlog:" << c.listen_backlog
       << ", tcp_recv_buf:" << c.tcp_recv_buf
       << ", tcp_send_buf:" << c.tcp_send_buf
-      << ", stream_recv_buf:" << c.stream_recv_buf;
+      << ", stream_recv_buf:" << c.stream_recv_buf
+      << ", known_clients:" << c.known_clients.has_value()
+      << ", max_rate_limited_connections:" << c.max_rate_limited_connections;
     return o << "}";
 }
 
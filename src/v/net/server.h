@@ -16,6 +16,7 @@
 #include "net/conn_quota.h"
 #include "net/connection.h"
 #include "net/connection_rate.h"
+#include "net/known_clients.h"
 #include "net/types.h"
 #include "ssx/semaphore.h"
 #include "utils/log_hist.h"
@@ -97,6 +98,14 @@ struct server_configuration {
 
     std::optional<std::reference_wrapper<ss::sharded<conn_quota>>> conn_quotas;
 
+    // with known clients, the connections of the clients that authenticated
+    // before skip the connection rate limit, while the connections of unknown
+    // clients wait for it off the accept loop, at most
+    // max_rate_limited_connections at a time and are dropped beyond that
+    std::optional<std::reference_wrapper<ss::sharded<known_clients>>>
+      known_clients;
+    size_t max_rate_limited_connections = 1024;
+
     explicit server_configuration(ss::sstring n)
       : name(std::move(n)) {}
 
@@ -146,21 +155,38 @@ public:
     ss::abort_source& abort_source() { return _as; }
     bool abort_requested() const { return _as.abort_requested(); }
 
+    /// Called by the protocol once the client of a connection authenticated,
+    /// so that its next connections take priority over unknown clients
+    void remember_client(const ss::net::inet_address&);
+
 private:
     struct listener {
         ss::sstring name;
         ss::server_socket socket;
-        bool tls_enabled;
-
-        listener(ss::sstring name, ss::server_socket socket, bool tls_enabled)
+        // the listener accepts plain tcp connections, the connections are
+        // wrapped in tls only once they passed the connection limits
+        ss::shared_ptr<ss::tls::server_credentials> credentials;
+
+        listener(
+          ss::sstring name,
+          ss::server_socket socket,
+          ss::shared_ptr<ss::tls::server_credentials> credentials)
           : name(std::move(name))
           , socket(std::move(socket))
-          , tls_enabled(tls_enabled) {}
+          , credentials(std::move(credentials)) {}
     };
 
     ss::future<> accept(listener&);
     ss::future<ss::stop_iteration>
-    accept_finish(ss::sstring, ss::future<ss::accept_result>, bool);
+    accept_finish(const listener&, ss::future<ss::accept_result>);
+    ss::future<> accept_rate_limited(
+      const listener&,
+      ss::accept_result,
+      conn_quota::units,
+      ssx::semaphore_units);
+    ss::future<> start_connection(
+      const listener&, ss::accept_result, conn_quota::units);
+    void reject(ss::accept_result&);
     void
     print_exceptional_future(ss::future<>, const char*, ss::socket_address);
     ss::future<>
@@ -182,6 +208,7 @@ private:
 
     std::optional<config_connection_rate_bindings> connection_rate_bindings;
     std::optional<connection_rate<>> _connection_rates;
+    ssx::semaphore _rate_limited_connections;
 };
 
 } // namespace net
@@ -13,6 +13,7 @@
 
 #include "base/seastarx.h"
 #include "metrics/metrics.h"
+#include "net/types.h"
 
 #include <seastar/core/metrics_registration.hh>
 
@@ -65,6 +66,8 @@ public:
     // log_message_timestamp_alert_after_ms and
     // log_message_timestamp_alert_before_ms
     void produce_bad_create_time() { _produce_bad_create_time++; }
+
+    batched_output_stream_stats& write_stats() { return _write_stats; }
     // for testing
     auto get_produce_bad_create_time() const {
         return _produce_bad_create_time;
@@ -92,6 +95,7 @@ private:
     uint32_t _declined_new_connections = 0;
     uint32_t _connections_wait_rate = 0;
     uint32_t _produce_bad_create_time = 0;
+    batched_output_stream_stats _write_stats;
     friend std::ostream& operator<<(std::ostream& o, const server_probe& p);
 };
 
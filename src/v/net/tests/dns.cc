@@ -12,10 +12,16 @@
 
 #include "net/unresolved_address.h"
 
+#include <seastar/core/sleep.hh>
 #include <seastar/testing/thread_test_case.hh>
 
 #include <boost/test/tools/old/interface.hpp>
 
+#include <chrono>
+#include <stdexcept>
+
+using namespace std::chrono_literals;
+
 SEASTAR_THREAD_TEST_CASE(dns_resolve) {
     net::unresolved_address ipv4_addr("127.0.0.1", 19092);
     auto ipv4 = net::resolve_dns(ipv4_addr).get();
@@ -33,3 +39,93 @@ SEASTAR_THREAD_TEST_CASE(dns_resolve) {
       ipv6.family(), static_cast<short>(ss::net::inet_address::family::INET6));
     BOOST_REQUIRE(ipv6.addr().is_ipv6());
 }
+
+namespace {
+
+struct fake_resolver {
+    ss::net::inet_address address{"10.0.0.1"};
+    bool fail{false};
+    size_t lookups{0};
+
+    net::dns_cache::resolver resolver() {
+        return [this](
+                 const ss::sstring&, net::unresolved_address::inet_family) {
+            ++lookups;
+            if (fail) {
+                return ss::make_exception_future<ss::net::inet_address>(
+                  std::runtime_error("resolver failure"));
+            }
+            return ss::make_ready_future<ss::net::inet_address>(address);
+        };
+    }
+};
+
+const net::unresolved_address host("broker.example", 33145);
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(dns_cache_reuses_and_refreshes) {
+    fake_resolver fake;
+    net::dns_cache cache(
+      fake.resolver(),
+      config::mock_binding<std::chrono::milliseconds>(200ms),
+      config::mock_binding<std::chrono::milliseconds>(100ms));
+
+    auto resolved = cache.resolve(host).get();
+    BOOST_REQUIRE(resolved.addr() == fake.address);
+    BOOST_REQUIRE_EQUAL(resolved.port(), host.port());
+    cache.resolve(host).get();
+    BOOST_REQUIRE_EQUAL(fake.lookups, 1);
+
+    // past the ttl the stale address is returned while it is refreshed
+    const ss::net::inet_address old_address = fake.address;
+    fake.address = ss::net::inet_address("10.0.0.2");
+    ss::sleep(250ms).get();
+    BOOST_REQUIRE(cache.resolve(host).get().addr() == old_address);
+    ss::sleep(20ms).get();
+    BOOST_REQUIRE_EQUAL(fake.lookups, 2);
+    BOOST_REQUIRE(cache.resolve(host).get().addr() == fake.address);
+
+    // far past the ttl the address is resolved again before returning
+    fake.address = ss::net::inet_address("10.0.0.3");
+    ss::sleep(500ms).get();
+    BOOST_REQUIRE(cache.resolve(host).get().addr() == fake.address);
+    BOOST_REQUIRE_EQUAL(fake.lookups, 3);
+
+    cache.stop().get();
+}
+
+SEASTAR_THREAD_TEST_CASE(dns_cache_caches_failures) {
+    fake_resolver fake;
+    fake.fail = true;
+    net::dns_cache cache(
+      fake.resolver(),
+      config::mock_binding<std::chrono::milliseconds>(10s),
+      config::mock_binding<std::chrono::milliseconds>(100ms));
+
+    BOOST_REQUIRE_THROW(cache.resolve(host).get(), std::runtime_error);
+    BOOST_REQUIRE_THROW(cache.resolve(host).get(), std::runtime_error);
+    BOOST_REQUIRE_EQUAL(fake.lookups, 1);
+
+    fake.fail = false;
+    ss::sleep(150ms).get();
+    BOOST_REQUIRE(cache.resolve(host).get().addr() == fake.address);
+    BOOST_REQUIRE_EQUAL(fake.lookups, 2);
+
+    cache.stop().get();
+}
+
+SEASTAR_THREAD_TEST_CASE(dns_cache_disabled) {
+    fake_resolver fake;
+    net::dns_cache cache(
+      fake.resolver(),
+      config::mock_binding<std::chrono::milliseconds>(0ms),
+      config::mock_binding<std::chrono::milliseconds>(0ms));
+
+    cache.resolve(host).get();
+    cache.resolve(host).get();
+    BOOST_REQUIRE_EQUAL(fake.lookups, 2);
+    BOOST_REQUIRE_EQUAL(cache.size(), 0);
+
+    cache.stop().get();
+}
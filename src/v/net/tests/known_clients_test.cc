@@ -0,0 +1,77 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "net/known_clients.h"
+#include "test_utils/async.h"
+
+#include <seastar/core/sharded.hh>
+#include <seastar/core/sleep.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+#include <chrono>
+#include <functional>
+
+using namespace std::chrono_literals;
+
+static ss::net::inet_address addr1("10.0.0.1");
+static ss::net::inet_address addr2("10.0.0.2");
+static ss::net::inet_address addr3("10.0.0.3");
+
+static ss::future<bool> known_on_all_shards(
+  ss::sharded<net::known_clients>& clients, ss::net::inet_address addr) {
+    return clients.map_reduce0(
+      [addr](const net::known_clients& local) { return local.is_known(addr); },
+      true,
+      std::logical_and<>());
+}
+
+SEASTAR_THREAD_TEST_CASE(test_remember_on_all_shards) {
+    ss::sharded<net::known_clients> clients;
+    clients.start().get();
+
+    BOOST_REQUIRE(!clients.local().is_known(addr1));
+    clients
+      .invoke_on(
+        ss::smp::count - 1,
+        [](net::known_clients& local) { local.remember(addr1); })
+      .get();
+    RPTEST_REQUIRE_EVENTUALLY(
+      5s, [&clients] { return known_on_all_shards(clients, addr1); });
+    BOOST_REQUIRE(!clients.local().is_known(addr2));
+
+    clients.stop().get();
+}
+
+SEASTAR_THREAD_TEST_CASE(test_capacity_and_expiry) {
+    ss::sharded<net::known_clients> clients;
+    clients.start(2, 2s).get();
+
+    clients.local().remember(addr1);
+    RPTEST_REQUIRE_EVENTUALLY(
+      5s, [&clients] { return known_on_all_shards(clients, addr1); });
+    // addr2 expires after addr1
+    ss::sleep(50ms).get();
+    clients.local().remember(addr2);
+    RPTEST_REQUIRE_EVENTUALLY(
+      5s, [&clients] { return known_on_all_shards(clients, addr2); });
+
+    // beyond the capacity the client that expires first is forgotten
+    clients.local().remember(addr3);
+    RPTEST_REQUIRE_EVENTUALLY(
+      5s, [&clients] { return known_on_all_shards(clients, addr3); });
+    BOOST_REQUIRE_EQUAL(clients.local().size(), 2);
+    BOOST_REQUIRE(!clients.local().is_known(addr1));
+    BOOST_REQUIRE(clients.local().is_known(addr2));
+
+    RPTEST_REQUIRE_EVENTUALLY(
+      10s, [&clients] { return !clients.local().is_known(addr3); });
+    BOOST_REQUIRE(!clients.local().is_known(addr2));
+
+    clients.stop().get();
+}
@@ -45,7 +45,8 @@ ss::future<> base_transport::do_connect(clock_type::time_point timeout) {
     try {
         base_transport::reset_state();
         reset_state();
-        auto resolved_address = co_await net::resolve_dns(server_address());
+        auto resolved_address = co_await net::resolve_dns_cached(
+          server_address());
         ss::connected_socket fd = co_await connect_with_timeout(
           resolved_address, timeout);
 
@@ -64,7 +65,10 @@ ss::future<> base_transport::do_connect(clock_type::time_point timeout) {
         // Never implicitly destroy a live output stream here: output streams
         // are only safe to destroy after/during stop()
         vassert(!_out.is_valid(), "destroyed output_stream without stopping");
-        _out = net::batched_output_stream(_fd->output());
+        _out = net::batched_output_stream(
+          _fd->output(),
+          net::batched_output_stream::default_max_unflushed_bytes,
+          &_probe->write_stats());
     } catch (...) {
         auto e = std::current_exception();
         _probe->connection_error(e);
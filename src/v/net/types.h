@@ -13,6 +13,8 @@
 #include <seastar/core/lowres_clock.hh>
 #include <seastar/util/bool_class.hh>
 
+#include <cstdint>
+
 namespace net {
 
 using metrics_disabled = seastar::bool_class<struct metrics_disabled_tag>;
@@ -20,6 +22,15 @@ using public_metrics_disabled
   = seastar::bool_class<struct public_metrics_disabled_tag>;
 using clock_type = seastar::lowres_clock;
 
+/// Counters of the messages written to the sockets and of the flushes, i.e.
+/// of the system calls, they took.
+struct batched_output_stream_stats {
+    uint64_t messages{0};
+    uint64_t flushes{0};
+    // flushes held back by write coalescing until its deadline
+    uint64_t delayed_flushes{0};
+};
+
 /**
  * Subclass this exception for exceptions related to authentication, so that
  * the `net` layer's error handling can use appropriate severity when
@@ -12,6 +12,7 @@
 #pragma once
 
 #include "base/seastarx.h"
+#include "base/units.h"
 #include "bytes/iobuf.h"
 #include "bytes/iobuf_parser.h"
 #include "json/stringbuffer.h"
@@ -99,6 +100,17 @@ public:
 
     bool operator()(
       ::json::Writer<::json::StringBuffer>& w, kafka::fetch_response&& res) {
+        return (*this)(w, std::move(res), [] {});
+    }
+
+    /// Serializes \p res, calling \p flush after each record, e.g. to move
+    /// what the writer holds elsewhere. The batches of \p res are released as
+    /// they are serialized.
+    template<typename Flush>
+    bool operator()(
+      ::json::Writer<::json::StringBuffer>& w,
+      kafka::fetch_response&& res,
+      Flush&& flush) {
         // Eager check for errors
         for (auto& v : res) {
             if (v.partition_response->error_code != kafka::error_code::none) {
@@ -129,7 +141,7 @@ public:
                       batch);
                 }
 
-                batch.for_each_record([&rjs, &w](model::record record) {
+                batch.for_each_record([&rjs, &w, &flush](model::record record) {
                     auto offset = record.offset_delta() + rjs.base_offset()();
                     if (!rjs(w, std::move(record))) {
                         throw serialize_error(
@@ -141,6 +153,7 @@ public:
                             rjs.tpv().topic(),
                             rjs.tpv().partition()));
                     }
+                    flush();
                 });
             }
         }
@@ -153,4 +166,23 @@ private:
     serialization_format _fmt;
 };
 
+/// Serializes \p res into an iobuf, without ever holding more than
+/// flush_bytes of the document contiguously.
+inline iobuf rjson_serialize_iobuf(
+  serialization_format fmt,
+  kafka::fetch_response&& res,
+  size_t flush_bytes = 32_KiB) {
+    ::json::StringBuffer buf;
+    ::json::Writer<::json::StringBuffer> w(buf);
+    iobuf out;
+    rjson_serialize_impl<kafka::fetch_response>{fmt}(
+      w, std::move(res), [&buf, &out, flush_bytes] {
+          if (buf.GetSize() >= flush_bytes) {
+              flush_to(buf, out);
+          }
+      });
+    flush_to(buf, out);
+    return out;
+}
+
 } // namespace pandaproxy::json
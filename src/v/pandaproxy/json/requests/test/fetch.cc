@@ -97,3 +97,25 @@ SEASTAR_THREAD_TEST_CASE(test_produce_fetch_one) {
 
     BOOST_REQUIRE_EQUAL(str_buf.GetString(), expected);
 }
+
+SEASTAR_THREAD_TEST_CASE(test_produce_fetch_iobuf) {
+    std::vector<model::topic_partition> tps = {
+      {model::topic{"topic1"}, model::partition_id{1}},
+      {model::topic{"topic2"}, model::partition_id{2}},
+    };
+    auto fmt = ppj::serialization_format::binary_v2;
+
+    ::json::StringBuffer str_buf;
+    ::json::Writer<::json::StringBuffer> w(str_buf);
+    ppj::rjson_serialize_fmt(fmt)(
+      w, make_fetch_response(tps, model::offset{42}, 10));
+    const ss::sstring expected(str_buf.GetString(), str_buf.GetSize());
+
+    // flushing after every record or only at the end gives the same document
+    for (size_t flush_bytes : {size_t{1}, size_t{32_KiB}}) {
+        auto buf = ppj::rjson_serialize_iobuf(
+          fmt, make_fetch_response(tps, model::offset{42}, 10), flush_bytes);
+        iobuf_parser p{std::move(buf)};
+        BOOST_REQUIRE_EQUAL(p.read_string(p.bytes_left()), expected);
+    }
+}
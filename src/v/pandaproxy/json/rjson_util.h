@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include "bytes/iobuf.h"
+#include "bytes/iostream.h"
 #include "json/json.h"
 #include "json/prettywriter.h"
 #include "json/reader.h"
@@ -20,7 +22,10 @@
 #include "pandaproxy/json/exceptions.h"
 #include "pandaproxy/json/types.h"
 
+#include <seastar/core/do_with.hh>
+#include <seastar/core/iostream.hh>
 #include <seastar/core/sstring.hh>
+#include <seastar/util/noncopyable_function.hh>
 
 #include <stdexcept>
 
@@ -59,6 +64,28 @@ inline rjson_serialize_fmt_impl rjson_serialize_fmt(serialization_format fmt) {
     return rjson_serialize_fmt_impl{fmt};
 }
 
+/// Moves what \p buf holds to the end of \p out. A writer keeps writing to
+/// \p buf afterwards, so a large document is serialized in fragments rather
+/// than one contiguous buffer.
+inline void flush_to(::json::StringBuffer& buf, iobuf& out) {
+    out.append(buf.GetString(), buf.GetSize());
+    buf.Clear();
+}
+
+/// A body writer for ss::http::reply::write_body that streams \p buf out.
+inline ss::noncopyable_function<ss::future<>(ss::output_stream<char>&&)>
+as_body_writer(iobuf&& buf) {
+    return [buf = std::move(buf)](ss::output_stream<char>&& os) mutable {
+        return ss::do_with(
+          std::move(buf),
+          std::move(os),
+          [](iobuf& buf, ss::output_stream<char>& os) {
+              return write_iobuf_to_output_stream(std::move(buf), os)
+                .finally([&os] { return os.close(); });
+          });
+    };
+}
+
 template<typename Handler>
 requires std::is_same_v<
   decltype(std::declval<Handler>().result),
@@ -85,5 +85,15 @@ configuration::configuration()
               msg = ss::sstring{"Client keep alive must be greater than 0"};
           }
           return msg;
-      }) {}
+      })
+  , shared_client(
+      *this,
+      "shared_client",
+      "Serve the requests of the users authenticated with HTTP Basic with the "
+      "proxy's own Kafka client, rather than with a client per user. The "
+      "users share its broker connections and metadata, and the brokers "
+      "authorize their requests as the principal of pandaproxy_client. Only "
+      "suitable when the users of the proxy are trusted",
+      {.needs_restart = config::needs_restart::yes},
+      false) {}
 } // namespace pandaproxy::rest
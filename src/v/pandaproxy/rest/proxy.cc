@@ -118,7 +118,8 @@ proxy::proxy(
   , _client_cache(client_cache)
   , _ctx{{{{}, _mem_sem, _inflight_sem, {}, smp_sg}, *this},
         {config::always_true(), config::shard_local_cfg().superusers.bind(), controller},
-        _config.pandaproxy_api.value()}
+        _config.pandaproxy_api.value(),
+        _config.shared_client()}
   , _server(
       "pandaproxy",
       "rest_proxy",
@@ -0,0 +1,313 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "base/seastarx.h"
+#include "config/property.h"
+#include "pandaproxy/schema_registry/store.h"
+#include "pandaproxy/schema_registry/types.h"
+
+#include <boost/multi_index/hashed_index.hpp>
+#include <boost/multi_index/identity.hpp>
+#include <boost/multi_index/indexed_by.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/ordered_index.hpp>
+#include <boost/multi_index/sequenced_index.hpp>
+#include <boost/multi_index_container.hpp>
+
+#include <optional>
+#include <tuple>
+#include <utility>
+
+namespace pandaproxy::schema_registry {
+
+///\brief A shard local MRU cache of the lookups that the sharded_store
+/// otherwise forwards to the shard that owns the schema or subject.
+///
+/// Schema definitions are cached by id, subject versions by the arguments of
+/// the lookup. A write invalidates the entries it affects on every shard
+/// before it completes, and bumps the generation so that a lookup that was in
+/// flight during the write doesn't fill the cache with what it read before.
+///
+/// The parsed schemas and the results of compatibility checks are cached too,
+/// on every shard. A parsed schema with references is dropped on any subject
+/// write, and a compatibility result only holds for the generation it was
+/// checked in, as both depend on the versions of other subjects.
+class read_replica {
+public:
+    using generation_t = uint64_t;
+
+    explicit read_replica(config::binding<size_t> cap)
+      : _capacity{std::move(cap)} {
+        _capacity.watch([this]() {
+            shrink_to_capacity(_schemas);
+            shrink_to_capacity(_versions);
+            shrink_to_capacity(_valid_schemas);
+            shrink_to_capacity(_compatible);
+        });
+    }
+
+    generation_t generation() const { return _generation; }
+
+    bool has_schema(schema_id id) const {
+        return _schemas.get<underlying_map>().contains(id);
+    }
+
+    std::optional<canonical_schema_definition> get_schema(schema_id id) {
+        auto& map = _schemas.get<underlying_map>();
+        auto it = map.find(id);
+        if (it == map.end()) {
+            return std::nullopt;
+        }
+        touch(_schemas, it);
+        return it->def;
+    }
+
+    void put_schema(
+      generation_t gen, schema_id id, const canonical_schema_definition& def) {
+        if (gen == _generation && _capacity() > 0) {
+            put(_schemas, schema_entry{id, def});
+        }
+    }
+
+    std::optional<subject_version_entry> get_subject_version(
+      const subject& sub,
+      std::optional<schema_version> version,
+      include_deleted inc_del) {
+        auto& map = _versions.get<underlying_map>();
+        auto it = map.find(version_entry::key_t{sub, version, bool(inc_del)});
+        if (it == map.end()) {
+            return std::nullopt;
+        }
+        touch(_versions, it);
+        return it->entry;
+    }
+
+    void put_subject_version(
+      generation_t gen,
+      subject sub,
+      std::optional<schema_version> version,
+      include_deleted inc_del,
+      const subject_version_entry& entry) {
+        if (gen == _generation && _capacity() > 0) {
+            put(
+              _versions,
+              version_entry{
+                {std::move(sub), version, bool(inc_del)},
+                {entry.version, entry.id, entry.deleted}});
+        }
+    }
+
+    std::optional<valid_schema> get_valid_schema(schema_id id) {
+        auto& map = _valid_schemas.get<underlying_map>();
+        auto it = map.find(id);
+        if (it == map.end()) {
+            return std::nullopt;
+        }
+        touch(_valid_schemas, it);
+        return it->schema;
+    }
+
+    void put_valid_schema(generation_t gen, schema_id id, valid_schema s) {
+        if (gen == _generation && _capacity() > 0) {
+            auto has_refs = s.visit(
+              [](const auto& def) { return !def.refs().empty(); });
+            put(_valid_schemas, valid_schema_entry{id, std::move(s), has_refs});
+        }
+    }
+
+    ///\brief Whether new_def is compatible with the schema id, as last
+    /// checked at the current generation.
+    std::optional<bool> get_compatible(
+      schema_id id,
+      compatibility_level level,
+      const canonical_schema_definition& new_def) {
+        auto& map = _compatible.get<underlying_map>();
+        auto it = map.find(compatible_entry::key_t{id, level, new_def.raw()});
+        if (
+          it == map.end() || it->gen != _generation
+          || it->new_def != new_def) {
+            return std::nullopt;
+        }
+        touch(_compatible, it);
+        return it->compatible;
+    }
+
+    void put_compatible(
+      generation_t gen,
+      schema_id id,
+      compatibility_level level,
+      const canonical_schema_definition& new_def,
+      bool compatible) {
+        if (gen == _generation && _capacity() > 0) {
+            // replaces the result of an earlier generation
+            _compatible.get<underlying_map>().erase(
+              compatible_entry::key_t{id, level, new_def.raw()});
+            put(
+              _compatible,
+              compatible_entry{id, level, new_def, gen, compatible});
+        }
+    }
+
+    void invalidate(schema_id id) {
+        ++_generation;
+        _schemas.get<underlying_map>().erase(id);
+        _valid_schemas.get<underlying_map>().erase(id);
+    }
+
+    void invalidate(const subject& sub) {
+        ++_generation;
+        auto& map = _versions.get<underlying_map>();
+        auto [b, e] = map.equal_range(sub, version_entry::subject_less{});
+        map.erase(b, e);
+        auto& list = _valid_schemas.get<underlying_list>();
+        for (auto it = list.begin(); it != list.end();) {
+            it = it->has_refs ? list.erase(it) : std::next(it);
+        }
+    }
+
+    size_t size() const {
+        return _schemas.size() + _versions.size() + _valid_schemas.size()
+               + _compatible.size();
+    }
+
+private:
+    struct schema_entry {
+        schema_id id;
+        canonical_schema_definition def;
+    };
+
+    struct version_entry {
+        using key_t = std::tuple<subject, std::optional<schema_version>, bool>;
+        key_t key;
+        subject_version_entry entry;
+
+        // Compare only the subject
+        struct subject_less {
+            using is_transparent = void;
+            bool operator()(const subject& lhs, const key_t& rhs) const {
+                return lhs < std::get<subject>(rhs);
+            }
+            bool operator()(const key_t& lhs, const subject& rhs) const {
+                return std::get<subject>(lhs) < rhs;
+            }
+        };
+    };
+
+    struct valid_schema_entry {
+        schema_id id;
+        valid_schema schema;
+        bool has_refs;
+    };
+
+    struct compatible_entry {
+        using key_t = std::tuple<
+          schema_id,
+          compatibility_level,
+          const canonical_schema_definition::raw_string&>;
+        schema_id id;
+        compatibility_level level;
+        canonical_schema_definition new_def;
+        generation_t gen;
+        bool compatible;
+
+        key_t key() const { return {id, level, new_def.raw()}; }
+
+        struct less {
+            using is_transparent = void;
+            bool operator()(
+              const compatible_entry& lhs, const compatible_entry& rhs) const {
+                return lhs.key() < rhs.key();
+            }
+            bool
+            operator()(const key_t& lhs, const compatible_entry& rhs) const {
+                return lhs < rhs.key();
+            }
+            bool
+            operator()(const compatible_entry& lhs, const key_t& rhs) const {
+                return lhs.key() < rhs;
+            }
+        };
+    };
+
+    struct underlying_list {};
+    struct underlying_map {};
+    using schemas_t = boost::multi_index::multi_index_container<
+      schema_entry,
+      boost::multi_index::indexed_by<
+        boost::multi_index::sequenced<boost::multi_index::tag<underlying_list>>,
+        boost::multi_index::hashed_unique<
+          boost::multi_index::tag<underlying_map>,
+          boost::multi_index::
+            member<schema_entry, schema_id, &schema_entry::id>,
+          std::hash<schema_id>>>>;
+    using versions_t = boost::multi_index::multi_index_container<
+      version_entry,
+      boost::multi_index::indexed_by<
+        boost::multi_index::sequenced<boost::multi_index::tag<underlying_list>>,
+        boost::multi_index::ordered_unique<
+          boost::multi_index::tag<underlying_map>,
+          boost::multi_index::
+            member<version_entry, version_entry::key_t, &version_entry::key>>>>;
+    using valid_schemas_t = boost::multi_index::multi_index_container<
+      valid_schema_entry,
+      boost::multi_index::indexed_by<
+        boost::multi_index::sequenced<boost::multi_index::tag<underlying_list>>,
+        boost::multi_index::hashed_unique<
+          boost::multi_index::tag<underlying_map>,
+          boost::multi_index::
+            member<valid_schema_entry, schema_id, &valid_schema_entry::id>,
+          std::hash<schema_id>>>>;
+    using compatible_t = boost::multi_index::multi_index_container<
+      compatible_entry,
+      boost::multi_index::indexed_by<
+        boost::multi_index::sequenced<boost::multi_index::tag<underlying_list>>,
+        boost::multi_index::ordered_unique<
+          boost::multi_index::tag<underlying_map>,
+          boost::multi_index::identity<compatible_entry>,
+          compatible_entry::less>>>;
+
+    template<typename Container, typename It>
+    static void touch(Container& c, It it) {
+        auto& list = c.template get<underlying_list>();
+        list.relocate(list.begin(), c.template project<underlying_list>(it));
+    }
+
+    template<typename Container, typename Entry>
+    void put(Container& c, Entry e) {
+        auto& list = c.template get<underlying_list>();
+        auto [it, inserted] = list.push_front(std::move(e));
+        if (inserted) {
+            shrink_to_capacity(c);
+        } else {
+            list.relocate(list.begin(), it);
+        }
+    }
+
+    // Truncate the cache from the back of the sequence
+    template<typename Container>
+    void shrink_to_capacity(Container& c) {
+        auto& list = c.template get<underlying_list>();
+        while (list.size() > _capacity()) {
+            list.pop_back();
+        }
+    }
+
+    schemas_t _schemas;
+    versions_t _versions;
+    valid_schemas_t _valid_schemas;
+    compatible_t _compatible;
+    generation_t _generation{0};
+    config::binding<size_t> _capacity;
+};
+
+} // namespace pandaproxy::schema_registry
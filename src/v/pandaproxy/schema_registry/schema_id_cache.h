@@ -16,6 +16,8 @@
 #include "pandaproxy/schema_registry/subject_name_strategy.h"
 #include "pandaproxy/schema_registry/types.h"
 
+#include <seastar/core/lowres_clock.hh>
+
 #include <boost/multi_index/indexed_by.hpp>
 #include <boost/multi_index/key.hpp>
 #include <boost/multi_index/member.hpp>
@@ -29,14 +31,22 @@
 namespace pandaproxy::schema_registry {
 
 ///\brief An MRU cache of valid schemas for a given topic.
+///
+/// Schemas found to be invalid are cached too, until they expire, so that a
+/// burst of records with an unknown schema doesn't sync the store for each of
+/// them.
 class schema_id_cache {
 public:
     enum class field : uint8_t { key, val };
     using offsets_t = std::optional<std::vector<int32_t>>;
+    using clock_type = ss::lowres_clock;
 
     explicit schema_id_cache(config::binding<size_t> cap)
       : _capacity{std::move(cap)} {
-        _capacity.watch([this]() { shrink_to_capacity(); });
+        _capacity.watch([this]() {
+            shrink_to_capacity(_cache);
+            shrink_to_capacity(_invalid);
+        });
     }
 
     bool has(
@@ -61,31 +71,66 @@ public:
       subject_name_strategy sns,
       schema_id s_id,
       offsets_t offsets) {
+        _invalid.get<underlying_map>().erase(
+          entry::view_t(topic, field, sns, s_id, offsets));
         auto& list = _cache.get<underlying_list>();
         auto [it, i] = list.emplace_front(
           topic, field, sns, s_id, std::move(offsets));
         if (i) {
-            shrink_to_capacity();
+            shrink_to_capacity(_cache);
         }
     }
 
-    size_t invalidate(model::topic_view topic) {
-        auto& map = _cache.get<underlying_map>();
-        auto [b, e] = map.equal_range(topic, entry::topic_less{});
-        auto count = std::distance(b, e);
-        map.erase(b, e);
-        return count;
+    bool is_invalid(
+      model::topic_view topic,
+      field field,
+      subject_name_strategy sns,
+      schema_id s_id,
+      offsets_t const& offsets) {
+        auto& map = _invalid.get<underlying_map>();
+        auto it = map.find(entry::view_t(topic, field, sns, s_id, offsets));
+        if (it == map.end()) {
+            return false;
+        }
+        if (it->expires_at <= clock_type::now()) {
+            map.erase(it);
+            return false;
+        }
+        return true;
     }
 
-private:
-    // Truncate the cache from the back of the sequence
-    void shrink_to_capacity() {
-        auto& list = _cache.get<underlying_list>();
-        if (list.size() > _capacity()) {
-            list.resize(_capacity());
+    void put_invalid(
+      model::topic_view topic,
+      field field,
+      subject_name_strategy sns,
+      schema_id s_id,
+      offsets_t offsets,
+      clock_type::time_point expires_at) {
+        auto& list = _invalid.get<underlying_list>();
+        auto [it, i] = list.emplace_front(
+          topic, field, sns, s_id, std::move(offsets));
+        list.modify(it, [expires_at](entry& e) { e.expires_at = expires_at; });
+        if (i) {
+            shrink_to_capacity(_invalid);
+        } else {
+            list.relocate(list.begin(), it);
         }
     }
 
+    size_t invalidate(model::topic_view topic) {
+        auto erase = [topic](underlying_t& c) {
+            auto& map = c.get<underlying_map>();
+            auto [b, e] = map.equal_range(topic, entry::topic_less{});
+            auto count = std::distance(b, e);
+            map.erase(b, e);
+            return count;
+        };
+        erase(_invalid);
+        return erase(_cache);
+    }
+
+private:
+
     struct entry {
         entry() = default;
         entry(
@@ -105,6 +150,7 @@ private:
         std::optional<std::vector<int32_t>> offsets;
         field f{};
         subject_name_strategy sns{};
+        clock_type::time_point expires_at{};
 
         using view_t = std::tuple<
           model::topic_view,
@@ -153,7 +199,17 @@ private:
           boost::multi_index::identity<entry>,
           entry::less>>>;
 
+    // Truncate the cache from the back of the sequence
+    void shrink_to_capacity(underlying_t& c) {
+        auto& list = c.get<underlying_list>();
+        if (list.size() > _capacity()) {
+            list.resize(_capacity());
+        }
+    }
+
     underlying_t _cache;
+    // Entries found invalid, until they expire
+    underlying_t _invalid;
     config::binding<size_t> _capacity;
 };
 
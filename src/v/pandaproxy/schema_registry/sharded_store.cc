@@ -12,6 +12,7 @@
 #include "pandaproxy/schema_registry/sharded_store.h"
 
 #include "base/vlog.h"
+#include "config/configuration.h"
 #include "hashing/jump_consistent_hash.h"
 #include "hashing/xx.h"
 #include "kafka/protocol/errors.h"
@@ -21,15 +22,18 @@
 #include "pandaproxy/schema_registry/errors.h"
 #include "pandaproxy/schema_registry/exceptions.h"
 #include "pandaproxy/schema_registry/protobuf.h"
+#include "pandaproxy/schema_registry/read_replica.h"
 #include "pandaproxy/schema_registry/store.h"
 #include "pandaproxy/schema_registry/types.h"
 
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/future.hh>
+#include <seastar/core/loop.hh>
 #include <seastar/core/smp.hh>
 #include <seastar/coroutine/exception.hh>
 
 #include <absl/algorithm/container.h>
+#include <boost/range/irange.hpp>
 #include <fmt/core.h>
 
 #include <functional>
@@ -59,6 +63,31 @@ bool check_compatible(const valid_schema& reader, const valid_schema& writer) {
     });
 }
 
+bool check_compatible(
+  compatibility_level compat,
+  const valid_schema& new_valid,
+  const valid_schema& old_valid) {
+    auto is_compat = true;
+    if (
+      compat == compatibility_level::backward
+      || compat == compatibility_level::backward_transitive
+      || compat == compatibility_level::full
+      || compat == compatibility_level::full_transitive) {
+        is_compat = is_compat && check_compatible(new_valid, old_valid);
+    }
+    if (
+      compat == compatibility_level::forward
+      || compat == compatibility_level::forward_transitive
+      || compat == compatibility_level::full
+      || compat == compatibility_level::full_transitive) {
+        is_compat = is_compat && check_compatible(old_valid, new_valid);
+    }
+    return is_compat;
+}
+
+// Below this many versions to check against, a check stays on its shard
+constexpr size_t parallel_compatibility_versions = 8;
+
 constexpr auto set_accumulator =
   [](store::schema_id_set acc, store::schema_id_set refs) {
       acc.insert(refs.begin(), refs.end());
@@ -69,10 +98,17 @@ constexpr auto set_accumulator =
 
 ss::future<> sharded_store::start(ss::smp_service_group sg) {
     _smp_opts = ss::smp_submit_to_options{sg};
-    return _store.start();
+    co_await _store.start();
+    co_await _replicas.start(ss::sharded_parameter([] {
+        return config::shard_local_cfg()
+          .schema_registry_read_replica_capacity.bind();
+    }));
 }
 
-ss::future<> sharded_store::stop() { return _store.stop(); }
+ss::future<> sharded_store::stop() {
+    co_await _replicas.stop();
+    co_await _store.stop();
+}
 
 ss::future<canonical_schema>
 sharded_store::make_canonical_schema(unparsed_schema schema) {
@@ -258,6 +294,9 @@ ss::future<bool> sharded_store::upsert(
 }
 
 ss::future<bool> sharded_store::has_schema(schema_id id) {
+    if (_replicas.local().has_schema(id)) {
+        co_return true;
+    }
     co_return co_await _store.invoke_on(
       shard_for(id), _smp_opts, [id](store& s) {
           return s.get_schema_definition(id).has_value();
@@ -299,10 +338,71 @@ ss::future<subject_schema> sharded_store::has_schema(canonical_schema schema) {
 
 ss::future<canonical_schema_definition>
 sharded_store::get_schema_definition(schema_id id) {
-    co_return co_await _store.invoke_on(
-      shard_for(id), _smp_opts, [id](store& s) {
-          return s.get_schema_definition(id).value();
+    auto shard = shard_for(id);
+    if (shard == ss::this_shard_id()) {
+        co_return _store.local().get_schema_definition(id).value();
+    }
+    auto& replica = _replicas.local();
+    if (auto def = replica.get_schema(id); def.has_value()) {
+        co_return std::move(def).value();
+    }
+    auto gen = replica.generation();
+    auto def = co_await _store.invoke_on(shard, _smp_opts, [id](store& s) {
+        return s.get_schema_definition(id).value();
+    });
+    replica.put_schema(gen, id, def);
+    co_return def;
+}
+
+ss::future<sharded_store::schema_definitions>
+sharded_store::get_schema_definitions(std::vector<schema_id> ids) {
+    absl::c_sort(ids);
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+
+    schema_definitions defs;
+    auto& replica = _replicas.local();
+    auto gen = replica.generation();
+    absl::flat_hash_map<ss::shard_id, std::vector<schema_id>> remote;
+    for (auto id : ids) {
+        auto shard = shard_for(id);
+        if (shard == ss::this_shard_id()) {
+            auto def = _store.local().get_schema_definition(id);
+            if (def.has_value()) {
+                defs.emplace(id, std::move(def).assume_value());
+            }
+        } else if (auto def = replica.get_schema(id); def.has_value()) {
+            defs.emplace(id, std::move(def).value());
+        } else {
+            remote[shard].push_back(id);
+        }
+    }
+
+    using found_t = std::vector<
+      std::pair<schema_id, canonical_schema_definition>>;
+    co_await ss::parallel_for_each(
+      remote, [this, &defs, &replica, gen](auto& shard_ids) {
+          return _store
+            .invoke_on(
+              shard_ids.first,
+              _smp_opts,
+              [ids{std::move(shard_ids.second)}](store& s) {
+                  found_t found;
+                  for (auto id : ids) {
+                      auto def = s.get_schema_definition(id);
+                      if (def.has_value()) {
+                          found.emplace_back(id, std::move(def).assume_value());
+                      }
+                  }
+                  return found;
+              })
+            .then([&defs, &replica, gen](found_t found) {
+                for (auto& [id, def] : found) {
+                    replica.put_schema(gen, id, def);
+                    defs.emplace(id, std::move(def));
+                }
+            });
       });
+    co_return defs;
 }
 
 ss::future<std::vector<subject_version>>
@@ -337,17 +437,8 @@ sharded_store::get_schema_subjects(schema_id id, include_deleted inc_del) {
 
 ss::future<subject_schema> sharded_store::get_subject_schema(
   subject sub, std::optional<schema_version> version, include_deleted inc_del) {
-    auto sub_shard{shard_for(sub)};
-    auto v_id = co_await _store.invoke_on(
-      sub_shard, _smp_opts, [sub, version, inc_del](store& s) {
-          return s.get_subject_version_id(sub, version, inc_del).value();
-      });
-
-    auto def = co_await _store.invoke_on(
-      shard_for(v_id.id), _smp_opts, [id{v_id.id}](store& s) {
-          return s.get_schema_definition(id).value();
-      });
-
+    auto v_id = co_await get_subject_version_id(sub, version, inc_del);
+    auto def = co_await get_schema_definition(v_id.id);
     co_return subject_schema{
       .schema = {sub, std::move(def)},
       .version = v_id.version,
@@ -437,10 +528,12 @@ ss::future<std::vector<schema_id>> sharded_store::referenced_by(
 ss::future<std::vector<schema_version>> sharded_store::delete_subject(
   seq_marker marker, subject sub, permanent_delete permanent) {
     auto sub_shard{shard_for(sub)};
-    co_return co_await _store.invoke_on(
-      sub_shard, _smp_opts, [marker, sub{std::move(sub)}, permanent](store& s) {
+    auto versions = co_await _store.invoke_on(
+      sub_shard, _smp_opts, [marker, sub, permanent](store& s) {
           return s.delete_subject(marker, sub, permanent).value();
       });
+    co_await invalidate_replicas(std::move(sub));
+    co_return versions;
 }
 
 ss::future<is_deleted> sharded_store::is_subject_deleted(subject sub) {
@@ -490,10 +583,12 @@ sharded_store::get_subject_version_written_at(subject sub, schema_version ver) {
 ss::future<bool> sharded_store::delete_subject_version(
   subject sub, schema_version ver, force force) {
     auto sub_shard{shard_for(sub)};
-    co_return co_await _store.invoke_on(
-      sub_shard, _smp_opts, [sub{std::move(sub)}, ver, force](store& s) {
+    auto deleted = co_await _store.invoke_on(
+      sub_shard, _smp_opts, [sub, ver, force](store& s) {
           return s.delete_subject_version(sub, ver, force).value();
       });
+    co_await invalidate_replicas(std::move(sub));
+    co_return deleted;
 }
 
 ss::future<compatibility_level> sharded_store::get_compatibility() {
@@ -541,19 +636,22 @@ sharded_store::clear_compatibility(seq_marker marker, subject sub) {
 ss::future<bool>
 sharded_store::upsert_schema(schema_id id, canonical_schema_definition def) {
     co_await maybe_update_max_schema_id(id);
-    co_return co_await _store.invoke_on(
+    auto inserted = co_await _store.invoke_on(
       shard_for(id), _smp_opts, [id, def{std::move(def)}](store& s) mutable {
           return s.upsert_schema(id, std::move(def));
       });
+    co_await invalidate_replicas(id);
+    co_return inserted;
 }
 
 ss::future<sharded_store::insert_subject_result>
 sharded_store::insert_subject(subject sub, schema_id id) {
     auto sub_shard{shard_for(sub)};
     auto [version, inserted] = co_await _store.invoke_on(
-      sub_shard, _smp_opts, [sub{std::move(sub)}, id](store& s) mutable {
+      sub_shard, _smp_opts, [sub, id](store& s) mutable {
           return s.insert_subject(sub, id);
       });
+    co_await invalidate_replicas(std::move(sub));
     co_return insert_subject_result{version, inserted};
 }
 
@@ -564,12 +662,46 @@ ss::future<bool> sharded_store::upsert_subject(
   schema_id id,
   is_deleted deleted) {
     auto sub_shard{shard_for(sub)};
-    co_return co_await _store.invoke_on(
+    auto inserted = co_await _store.invoke_on(
       sub_shard,
       _smp_opts,
-      [marker, sub{std::move(sub)}, version, id, deleted](store& s) mutable {
+      [marker, sub, version, id, deleted](store& s) mutable {
           return s.upsert_subject(marker, std::move(sub), version, id, deleted);
       });
+    co_await invalidate_replicas(std::move(sub));
+    co_return inserted;
+}
+
+ss::future<subject_version_entry> sharded_store::get_subject_version_id(
+  subject sub, std::optional<schema_version> version, include_deleted inc_del) {
+    auto sub_shard{shard_for(sub)};
+    if (sub_shard == ss::this_shard_id()) {
+        co_return _store.local()
+          .get_subject_version_id(sub, version, inc_del)
+          .value();
+    }
+    auto& replica = _replicas.local();
+    if (auto v_id = replica.get_subject_version(sub, version, inc_del);
+        v_id.has_value()) {
+        co_return std::move(v_id).value();
+    }
+    auto gen = replica.generation();
+    auto v_id = co_await _store.invoke_on(
+      sub_shard, _smp_opts, [sub, version, inc_del](store& s) {
+          return s.get_subject_version_id(sub, version, inc_del).value();
+      });
+    replica.put_subject_version(gen, std::move(sub), version, inc_del, v_id);
+    co_return v_id;
+}
+
+ss::future<> sharded_store::invalidate_replicas(schema_id id) {
+    return _replicas.invoke_on_all(
+      _smp_opts, [id](read_replica& r) { r.invalidate(id); });
+}
+
+ss::future<> sharded_store::invalidate_replicas(subject sub) {
+    return _replicas.invoke_on_all(
+      _smp_opts, [sub{std::move(sub)}](read_replica& r) { r.invalidate(sub); });
 }
 
 /// \brief Get the schema ID to be used for next insert
@@ -652,34 +784,77 @@ ss::future<bool> sharded_store::is_compatible(
         ver_it = versions.begin();
     }
 
-    auto new_valid = co_await make_valid_schema(new_schema);
-
-    auto is_compat = true;
-    for (; is_compat && ver_it != versions.end(); ++ver_it) {
-        if (ver_it->deleted) {
-            continue;
+    std::vector<schema_id> ids;
+    for (; ver_it != versions.end(); ++ver_it) {
+        if (!ver_it->deleted) {
+            ids.push_back(ver_it->id);
         }
+    }
+
+    if (ss::smp::count == 1 || ids.size() < parallel_compatibility_versions) {
+        co_return co_await is_compatible(compat, new_schema, std::move(ids));
+    }
 
-        auto old_schema = co_await get_subject_schema(
-          sub, ver_it->version, include_deleted::no);
-        auto old_valid = co_await make_valid_schema(old_schema.schema);
+    // Parsing and comparing large schemas is costly, spread the versions
+    // across the shards
+    std::vector<std::vector<schema_id>> shard_ids(ss::smp::count);
+    for (size_t i = 0; i < ids.size(); ++i) {
+        shard_ids[i % ss::smp::count].push_back(ids[i]);
+    }
+    co_return co_await ss::map_reduce(
+      boost::irange<ss::shard_id>(0, ss::smp::count),
+      [this, compat, &new_schema, &shard_ids](ss::shard_id shard) {
+          return ss::smp::submit_to(
+            shard,
+            _smp_opts,
+            [this,
+             compat,
+             new_schema,
+             ids{std::move(shard_ids[shard])}]() mutable {
+                return is_compatible(
+                  compat, std::move(new_schema), std::move(ids));
+            });
+      },
+      true,
+      std::logical_and<>{});
+}
 
-        if (
-          compat == compatibility_level::backward
-          || compat == compatibility_level::backward_transitive
-          || compat == compatibility_level::full
-          || compat == compatibility_level::full_transitive) {
-            is_compat = is_compat && check_compatible(new_valid, old_valid);
+ss::future<bool> sharded_store::is_compatible(
+  compatibility_level compat,
+  canonical_schema new_schema,
+  std::vector<schema_id> ids) {
+    auto& replica = _replicas.local();
+    std::optional<valid_schema> new_valid;
+    for (auto id : ids) {
+        auto is_compat = replica.get_compatible(id, compat, new_schema.def());
+        if (!is_compat.has_value()) {
+            auto gen = replica.generation();
+            if (!new_valid.has_value()) {
+                new_valid.emplace(co_await make_valid_schema(new_schema));
+            }
+            auto old_valid = co_await make_valid_schema(id, new_schema.sub());
+            is_compat = check_compatible(compat, *new_valid, old_valid);
+            replica.put_compatible(
+              gen, id, compat, new_schema.def(), *is_compat);
         }
-        if (
-          compat == compatibility_level::forward
-          || compat == compatibility_level::forward_transitive
-          || compat == compatibility_level::full
-          || compat == compatibility_level::full_transitive) {
-            is_compat = is_compat && check_compatible(old_valid, new_valid);
+        if (!*is_compat) {
+            co_return false;
         }
     }
-    co_return is_compat;
+    co_return true;
+}
+
+ss::future<valid_schema>
+sharded_store::make_valid_schema(schema_id id, subject sub) {
+    auto& replica = _replicas.local();
+    if (auto valid = replica.get_valid_schema(id); valid.has_value()) {
+        co_return std::move(valid).value();
+    }
+    auto gen = replica.generation();
+    auto def = co_await get_schema_definition(id);
+    auto valid = co_await make_valid_schema({std::move(sub), std::move(def)});
+    replica.put_valid_schema(gen, id, valid);
+    co_return valid;
 }
 
 ss::future<bool> sharded_store::has_version(
@@ -15,8 +15,11 @@
 
 #include <seastar/core/sharded.hh>
 
+#include <absl/container/flat_hash_map.h>
+
 namespace pandaproxy::schema_registry {
 
+class read_replica;
 class store;
 
 ///\brief Dispatch requests to shards based on a a hash of the
@@ -68,6 +71,13 @@ public:
     ///\brief Return a schema definition by id.
     ss::future<canonical_schema_definition> get_schema_definition(schema_id id);
 
+    using schema_definitions
+      = absl::flat_hash_map<schema_id, canonical_schema_definition>;
+    ///\brief Return the definitions of the schemas that exist among ids,
+    /// with one request to each of the shards that own the others.
+    ss::future<schema_definitions>
+    get_schema_definitions(std::vector<schema_id> ids);
+
     ///\brief Return a list of subject-versions for the shema id.
     ss::future<std::vector<subject_version>>
     get_schema_subject_versions(schema_id id);
@@ -166,12 +176,32 @@ private:
       schema_id id,
       is_deleted deleted);
 
+    ///\brief Check new_schema against the schema ids on this shard.
+    ss::future<bool> is_compatible(
+      compatibility_level compat,
+      canonical_schema new_schema,
+      std::vector<schema_id> ids);
+
+    ///\brief Parse the schema id, or return it from the read replica.
+    ss::future<valid_schema> make_valid_schema(schema_id id, subject sub);
+
+    ss::future<subject_version_entry> get_subject_version_id(
+      subject sub,
+      std::optional<schema_version> version,
+      include_deleted inc_del);
+
+    ///\brief Drop what the read replicas of every shard hold of the schema
+    /// or subject, once it is written.
+    ss::future<> invalidate_replicas(schema_id id);
+    ss::future<> invalidate_replicas(subject sub);
+
     ss::future<> maybe_update_max_schema_id(schema_id id);
 
     ss::future<schema_id> project_schema_id();
 
     ss::smp_submit_to_options _smp_opts;
     ss::sharded<store> _store;
+    ss::sharded<read_replica> _replicas;
 
     ///\brief Access must occur only on shard 0.
     schema_id _next_schema_id{1};
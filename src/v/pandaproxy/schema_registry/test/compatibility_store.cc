@@ -15,6 +15,7 @@
 #include <seastar/util/defer.hh>
 
 #include <boost/test/unit_test.hpp>
+#include <fmt/format.h>
 
 namespace pp = pandaproxy;
 namespace pps = pp::schema_registry;
@@ -86,3 +87,58 @@ SEASTAR_THREAD_TEST_CASE(test_avro_basic_backwards_store_compat) {
                       {sub, pps::canonical_schema_definition{schema3}})
                      .get());
 }
+
+SEASTAR_THREAD_TEST_CASE(test_avro_transitive_store_compat_many_versions) {
+    pps::sharded_store s;
+    s.start(ss::default_smp_service_group()).get();
+    auto stop_store = ss::defer([&s]() { s.stop().get(); });
+
+    pps::seq_marker dummy_marker;
+
+    // Each version adds a defaulted field
+    auto make_schema = [](int fields, bool defaulted) {
+        ss::sstring def{R"({"type":"record","name":"r","fields":[)"};
+        for (int i = 0; i < fields; ++i) {
+            def += fmt::format(
+              R"({}{{"name":"f{}","type":"int"{}}})",
+              i == 0 ? "" : ",",
+              i,
+              defaulted || i + 1 < fields ? R"(,"default":0)" : "");
+        }
+        def += "]}";
+        return pps::canonical_schema_definition{
+          std::move(def), pps::schema_type::avro};
+    };
+
+    s.set_compatibility(pps::compatibility_level::backward_transitive).get();
+    auto sub = pps::subject{"sub"};
+    constexpr int versions = 20;
+    for (int v = 1; v <= versions; ++v) {
+        s.upsert(
+           dummy_marker,
+           {sub, make_schema(v, true)},
+           pps::schema_id{v},
+           pps::schema_version{v},
+           pps::is_deleted::no)
+          .get();
+    }
+
+    // Checked against all the versions, twice to check the cached results
+    for (int i = 0; i < 2; ++i) {
+        BOOST_REQUIRE(s.is_compatible(
+                         pps::schema_version{versions},
+                         {sub, make_schema(versions + 1, true)})
+                        .get());
+        BOOST_REQUIRE(!s.is_compatible(
+                          pps::schema_version{versions},
+                          {sub, make_schema(versions + 1, false)})
+                         .get());
+    }
+
+    // The cached results are per compatibility level
+    s.set_compatibility(pps::compatibility_level::none).get();
+    BOOST_REQUIRE(s.is_compatible(
+                     pps::schema_version{versions},
+                     {sub, make_schema(versions + 1, false)})
+                    .get());
+}
@@ -112,3 +112,32 @@ BOOST_AUTO_TEST_CASE(test_schema_id_cache_invalidate) {
     BOOST_REQUIRE(c.has(tp3, key, record_name, s_id2, {}));
     BOOST_REQUIRE(c.has(tp3, key, topic_record_name, s_id3, {}));
 }
+
+BOOST_AUTO_TEST_CASE(test_schema_id_cache_invalid) {
+    using namespace std::chrono_literals;
+    using clock = pps::schema_id_cache::clock_type;
+    pps::schema_id_cache c{config::mock_binding(size_t(16))};
+
+    c.put_invalid(tp1, key, topic_name, s_id1, {}, clock::now() + 1h);
+    c.put_invalid(tp1, val, topic_name, s_id2, {{1}}, clock::now() + 1h);
+    c.put_invalid(tp2, key, topic_name, s_id1, {}, clock::now() - 1ms);
+
+    BOOST_REQUIRE(c.is_invalid(tp1, key, topic_name, s_id1, {}));
+    BOOST_REQUIRE(c.is_invalid(tp1, val, topic_name, s_id2, {{1}}));
+    BOOST_REQUIRE(!c.is_invalid(tp1, val, topic_name, s_id2, {{2}}));
+    BOOST_REQUIRE(!c.is_invalid(tp1, key, record_name, s_id1, {}));
+    // Expired
+    BOOST_REQUIRE(!c.is_invalid(tp2, key, topic_name, s_id1, {}));
+
+    // Invalid entries aren't valid ones
+    BOOST_REQUIRE(!c.has(tp1, key, topic_name, s_id1, {}));
+
+    // A valid entry replaces an invalid one
+    c.put(tp1, key, topic_name, s_id1, {});
+    BOOST_REQUIRE(c.has(tp1, key, topic_name, s_id1, {}));
+    BOOST_REQUIRE(!c.is_invalid(tp1, key, topic_name, s_id1, {}));
+
+    // Invalidating a topic drops its invalid entries too
+    BOOST_REQUIRE_EQUAL(c.invalidate(tp1), 1);
+    BOOST_REQUIRE(!c.is_invalid(tp1, val, topic_name, s_id2, {{1}}));
+}
@@ -15,10 +15,13 @@
 #include "pandaproxy/schema_registry/test/compatibility_protobuf.h"
 #include "pandaproxy/schema_registry/types.h"
 
+#include <seastar/core/smp.hh>
+#include <seastar/core/thread.hh>
 #include <seastar/testing/thread_test_case.hh>
 #include <seastar/util/defer.hh>
 
 #include <boost/test/unit_test.hpp>
+#include <fmt/format.h>
 
 namespace pp = pandaproxy;
 namespace pps = pp::schema_registry;
@@ -131,3 +134,62 @@ SEASTAR_THREAD_TEST_CASE(test_sharded_store_find_unordered) {
     BOOST_REQUIRE_EQUAL(res.id, pps::schema_id{1});
     BOOST_REQUIRE_EQUAL(res.version, ver1);
 }
+
+SEASTAR_THREAD_TEST_CASE(test_sharded_store_read_replicas) {
+    pps::sharded_store store;
+    store.start(ss::default_smp_service_group()).get();
+    auto stop_store = ss::defer([&store]() { store.stop().get(); });
+
+    const pps::subject sub{"replicated"};
+    auto upsert = [&store, &sub](
+                    pps::schema_id id,
+                    pps::schema_version ver,
+                    pps::is_deleted deleted) {
+        store
+          .upsert(
+            pps::seq_marker{
+              std::nullopt,
+              std::nullopt,
+              ver,
+              pps::seq_marker_key_type::schema},
+            pps::canonical_schema{
+              sub,
+              pps::canonical_schema_definition{
+                fmt::format(R"({{"type":"fixed","name":"f","size":{}}})", id()),
+                pps::schema_type::avro}},
+            id,
+            ver,
+            deleted)
+          .get();
+    };
+    // Read from every shard, so that the replicas of the shards that don't
+    // own the subject or the schema are filled, and read again from them.
+    auto require_latest = [&store, &sub](pps::schema_id id) {
+        ss::smp::invoke_on_all([&store, &sub, id] {
+            return ss::async([&store, &sub, id] {
+                for (int i = 0; i < 2; ++i) {
+                    auto res = store
+                                 .get_subject_schema(
+                                   sub, std::nullopt, pps::include_deleted::no)
+                                 .get();
+                    BOOST_REQUIRE_EQUAL(res.id, id);
+                    BOOST_REQUIRE(store.has_schema(id).get());
+                    BOOST_REQUIRE_EQUAL(
+                      store.get_schema_definition(id).get(),
+                      res.schema.def());
+                }
+            });
+        }).get();
+    };
+
+    upsert(pps::schema_id{1}, pps::schema_version{1}, pps::is_deleted::no);
+    require_latest(pps::schema_id{1});
+
+    // A new version is seen by all the shards once written
+    upsert(pps::schema_id{2}, pps::schema_version{2}, pps::is_deleted::no);
+    require_latest(pps::schema_id{2});
+
+    // So is the deletion of a version
+    upsert(pps::schema_id{2}, pps::schema_version{2}, pps::is_deleted::yes);
+    require_latest(pps::schema_id{1});
+}
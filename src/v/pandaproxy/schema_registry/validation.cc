@@ -32,7 +32,7 @@
 #include "pandaproxy/schema_registry/subject_name_strategy.h"
 #include "pandaproxy/schema_registry/types.h"
 #include "pandaproxy/schema_registry/validation_metrics.h"
-#include "storage/parser_utils.h"
+#include "storage/decompression_cache.h"
 #include "utils/vint.h"
 
 #include <seastar/core/future.hh>
@@ -40,9 +40,12 @@
 #include <seastar/core/sharded.hh>
 #include <seastar/core/sstring.hh>
 #include <seastar/coroutine/exception.hh>
+#include <seastar/coroutine/maybe_yield.hh>
 
 #include <absl/algorithm/container.h>
+#include <absl/container/flat_hash_set.h>
 
+#include <deque>
 #include <iterator>
 #include <optional>
 #include <stdexcept>
@@ -232,22 +235,26 @@ public:
             co_return true;
         }
 
+        if (is_invalid(topic, field, sns, id, std::nullopt)) {
+            co_return false;
+        }
+
         // Determine the schema type
-        std::optional<canonical_schema_definition> schema;
-        try {
-            schema.emplace(co_await _api->_store->get_schema_definition(id));
-        } catch (const exception& ex) {
+        auto schema_it = _schemas.find(id);
+        if (schema_it == _schemas.end()) {
             vlog(
               plog.debug,
               "validating: topic: {}, field: {}, schema not found: {}",
               topic(),
               to_string_view(field),
-              ex.message());
+              id);
+            _invalid.emplace(invalid_field{field, sns, id, std::nullopt});
             co_return false;
         }
+        const auto& schema = schema_it->second;
 
         std::optional<std::vector<int32_t>> proto_offsets;
-        if (schema->type() == schema_type::protobuf) {
+        if (schema.type() == schema_type::protobuf) {
             auto offsets = get_proto_offsets(parser);
             if (offsets.empty()) {
                 vlog(
@@ -268,12 +275,15 @@ public:
                 _api->_schema_id_validation_probe.local().hit();
                 co_return true;
             }
+            if (is_invalid(topic, field, sns, id, offsets)) {
+                co_return false;
+            }
 
             proto_offsets.emplace(std::move(offsets));
         }
 
         auto record_name = co_await get_record_name(
-          *_api->_store, sns, *schema, proto_offsets);
+          *_api->_store, sns, schema, proto_offsets);
         if (!record_name) {
             vlog(
               plog.debug,
@@ -294,6 +304,8 @@ public:
               sub,
               id,
               has_id);
+            _invalid.emplace(
+              invalid_field{field, sns, id, std::move(proto_offsets)});
             co_return false;
         }
 
@@ -303,70 +315,142 @@ public:
         co_return true;
     };
 
-    ss::future<bool> validate(const model::record_batch& batch) {
-        if (
-          !_record_key_schema_id_validation
-          && !_record_value_schema_id_validation) {
-            co_return true;
-        }
-
-        auto key_is_valid =
-          [this](const model::record& record) -> ss::future<bool> {
-            if (!_record_key_schema_id_validation) {
-                return ss::make_ready_future<bool>(true);
-            }
-            return validate_field(
-              field::key,
-              _topic,
-              _record_key_subject_name_strategy,
-              record.key().copy());
-        };
+    /// The batches to validate, decompressed once for all the passes.
+    struct unpacked {
+        std::vector<const model::record_batch*> batches;
+        std::deque<model::record_batch> decompressed;
+    };
 
-        auto value_is_valid =
-          [this](const model::record& record) -> ss::future<bool> {
-            if (!_record_value_schema_id_validation) {
-                return ss::make_ready_future<bool>(true);
+    ss::future<> unpack(const data_t& data, unpacked& u) {
+        for (const auto& b : data) {
+            if (!b.compressed()) {
+                u.batches.push_back(&b);
+                continue;
             }
-            return validate_field(
-              field::val,
-              _topic,
-              _record_value_subject_name_strategy,
-              record.value().copy());
-        };
-
-        const model::record_batch& b = batch;
-        std::optional<const model::record_batch> u;
-        bool compressed = batch.compressed();
-        if (compressed) {
-            u.emplace(
-              co_await storage::internal::decompress_batch(batch.copy()));
+            u.decompressed.push_back(
+              co_await storage::decompressed_batches().decompress(b));
             _api->_schema_id_validation_probe.local().decompressed();
+            u.batches.push_back(&u.decompressed.back());
         }
+    }
 
-        bool valid{true};
-        co_await model::for_each_record(
-          compressed ? u.value() : b,
-          [&valid, k{std::move(key_is_valid)}, v{std::move(value_is_valid)}](
-            const model::record& r) {
-              return k(r)
-                .then([&r, v{std::move(v)}](bool k) {
-                    return k ? v(r) : ss::make_ready_future<bool>(false);
-                })
-                .then([&valid](bool v) { valid = v; });
-          });
-        co_return valid;
+    auto unpack(const foreign_data_t& data, unpacked& u) {
+        return unpack(*data.buffer, u);
     }
 
-    ss::future<bool> validate(const data_t& data) {
-        for (const auto& b : data) {
-            if (!co_await validate(b)) {
-                co_return false;
-            }
+    bool is_invalid(
+      const model::topic& topic,
+      field field,
+      subject_name_strategy sns,
+      schema_id id,
+      const schema_id_cache::offsets_t& offsets) {
+        if (!_api->_schema_id_cache.local().is_invalid(
+              topic, field, sns, id, offsets)) {
+            return false;
+        }
+        vlog(
+          plog.debug,
+          "validating: topic: {}, field: {}, id: {}, cached as invalid",
+          topic(),
+          to_string_view(field),
+          id);
+        _api->_schema_id_validation_probe.local().negative_hit();
+        _negative_hit = true;
+        return true;
+    }
+
+    // Collect the id of the field if it isn't cached, to look it up along
+    // with the others
+    void collect_id(
+      field field,
+      subject_name_strategy sns,
+      const iobuf& buf,
+      absl::flat_hash_set<schema_id>& ids) {
+        if (buf.size_bytes() < 5) {
+            return;
+        }
+        iobuf_const_parser parser(buf);
+        if (parser.consume_type<int8_t>() != 0) {
+            return;
+        }
+        auto id = schema_id{parser.consume_be_type<int32_t>()};
+        if (ids.contains(id)) {
+            return;
+        }
+        auto& cache = _api->_schema_id_cache.local();
+        if (
+          !cache.has(_topic, field, sns, id, std::nullopt)
+          && !cache.is_invalid(_topic, field, sns, id, std::nullopt)) {
+            ids.insert(id);
+        }
+    }
+
+    ss::future<> prefetch(const unpacked& u) {
+        absl::flat_hash_set<schema_id> ids;
+        for (const auto* b : u.batches) {
+            b->for_each_record([this, &ids](const model::record& r) {
+                if (_record_key_schema_id_validation) {
+                    collect_id(
+                      field::key,
+                      _record_key_subject_name_strategy,
+                      r.key(),
+                      ids);
+                }
+                if (_record_value_schema_id_validation) {
+                    collect_id(
+                      field::val,
+                      _record_value_subject_name_strategy,
+                      r.value(),
+                      ids);
+                }
+            });
+            co_await ss::coroutine::maybe_yield();
+        }
+        if (!ids.empty()) {
+            _schemas = co_await _api->_store->get_schema_definitions(
+              {ids.begin(), ids.end()});
+        }
+    }
+
+    ss::future<bool> validate(const model::record& r) {
+        if (
+          _record_key_schema_id_validation
+          && !co_await validate_field(
+            field::key,
+            _topic,
+            _record_key_subject_name_strategy,
+            r.key().copy())) {
+            co_return false;
+        }
+        if (
+          _record_value_schema_id_validation
+          && !co_await validate_field(
+            field::val,
+            _topic,
+            _record_value_subject_name_strategy,
+            r.value().copy())) {
+            co_return false;
         }
         co_return true;
     }
 
-    auto validate(const foreign_data_t& data) { return validate(*data.buffer); }
+    ss::future<bool> validate(const unpacked& u) {
+        _schemas.clear();
+        _invalid.reset();
+        _negative_hit = false;
+        co_await prefetch(u);
+        for (const auto* b : u.batches) {
+            auto it = model::record_batch_iterator::create(*b);
+            while (it.has_next()) {
+                auto r = it.next();
+                if (!co_await validate(r)) {
+                    co_return false;
+                }
+            }
+            co_await ss::coroutine::maybe_yield();
+        }
+        co_return true;
+    }
 
     ss::future<result> operator()(model::record_batch_reader&& rbr) {
         if (!_api) {
@@ -386,15 +470,35 @@ public:
           "Attempt to validate schema id on a record_batch_reader with "
           "multiple slices");
 
-        auto valid = co_await ss::visit(
-          slice, [this](const auto& d) { return validate(d); });
+        if (
+          !_record_key_schema_id_validation
+          && !_record_value_schema_id_validation) {
+            co_return model::make_memory_record_batch_reader(std::move(slice));
+        }
 
-        if (!valid) {
+        unpacked u;
+        co_await ss::visit(
+          slice, [this, &u](const auto& d) { return unpack(d, u); });
+
+        auto valid = co_await validate(u);
+
+        if (!valid && !_negative_hit) {
             // It's possible that the schema registry doesn't have a newly
             // written schema, update and retry.
             co_await _api->_sequencer.local().read_sync();
-            valid = co_await ss::visit(
-              slice, [this](const auto& d) { return validate(d); });
+            valid = co_await validate(u);
+            // Don't sync again for the same schema id for a while
+            auto ttl = config::shard_local_cfg()
+                         .kafka_schema_id_validation_negative_cache_ttl_ms();
+            if (!valid && _invalid && ttl > std::chrono::milliseconds{0}) {
+                _api->_schema_id_cache.local().put_invalid(
+                  _topic,
+                  _invalid->f,
+                  _invalid->sns,
+                  _invalid->id,
+                  std::move(_invalid->offsets),
+                  schema_id_cache::clock_type::now() + ttl);
+            }
         }
 
         if (!valid) {
@@ -424,6 +528,17 @@ private:
     bool _record_value_schema_id_validation;
     pandaproxy::schema_registry::subject_name_strategy
       _record_value_subject_name_strategy;
+
+    // The state of a validation pass
+    struct invalid_field {
+        field f;
+        subject_name_strategy sns;
+        schema_id id;
+        schema_id_cache::offsets_t offsets;
+    };
+    sharded_store::schema_definitions _schemas;
+    std::optional<invalid_field> _invalid;
+    bool _negative_hit{false};
 };
 
 schema_id_validator::schema_id_validator(
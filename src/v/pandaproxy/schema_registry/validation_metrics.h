@@ -44,6 +44,14 @@ public:
                               "schema ID validation cache (see cluster config: "
                               "kafka_schema_id_validation_cache_capacity)"),
               {}),
+            sm::make_counter(
+              "negative_hits",
+              [this]() { return _negative_hits; },
+              sm::description(
+                "Total number of records rejected by the server-side schema "
+                "ID validation cache of invalid IDs (see cluster config: "
+                "kafka_schema_id_validation_negative_cache_ttl_ms)"),
+              {}),
             sm::make_counter(
               "batches_decompressed",
               [this]() { return _batches_decompressed; },
@@ -57,12 +65,14 @@ public:
 
     void hit() { ++_hits; }
     void miss() { ++_misses; }
+    void negative_hit() { ++_negative_hits; }
     void decompressed() { ++_batches_decompressed; }
 
 private:
     metrics::internal_metric_groups _metrics;
     int64_t _hits;
     int64_t _misses;
+    int64_t _negative_hits{0};
     int64_t _batches_decompressed;
 };
 
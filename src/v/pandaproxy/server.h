@@ -175,6 +175,8 @@ public:
     struct context_t : base::context_t {
         request_authenticator authenticator;
         std::vector<config::rest_authn_endpoint> listeners;
+        // serve every request with the proxy's client, see shared_client
+        bool shared_client{false};
     };
 
     using base::ctx_server;
@@ -206,9 +208,17 @@ public:
               });
         }
 
+        // The authentication of the client a request is served with: the
+        // users authenticated with HTTP Basic share the proxy's client when
+        // shared_client is set.
+        config::rest_authn_method client_authn_method() const {
+            return context().shared_client ? config::rest_authn_method::none
+                                           : authn_method;
+        }
+
         template<std::invocable<kafka::client::client&> Func>
         auto dispatch(Func&& func) {
-            switch (authn_method) {
+            switch (client_authn_method()) {
             case config::rest_authn_method::none: {
                 return std::invoke(
                   std::forward<Func>(func), service().client().local());
@@ -225,7 +235,7 @@ public:
 
         template<std::invocable<kafka::client::client&> Func>
         auto dispatch(kafka::group_id const& group_id, Func&& func) {
-            switch (authn_method) {
+            switch (client_authn_method()) {
             case config::rest_authn_method::none: {
                 return service().client().invoke_on(
                   impl::consumer_shard(group_id), std::forward<Func>(func));
@@ -103,6 +103,7 @@ consensus::consensus(
     recovery_throttle,
   recovery_memory_quota& recovery_mem_quota,
   recovery_scheduler& recovery_scheduler,
+  follower_flush_batcher& flush_batcher,
   features::feature_table& ft,
   std::optional<voter_priority> voter_priority_override,
   keep_snapshotted_log should_keep_snapshotted_log)
@@ -122,8 +123,12 @@ consensus::consensus(
   , _fstats(
       _self,
       config::shard_local_cfg()
-        .raft_max_concurrent_append_requests_per_follower())
-  , _batcher(this, config::shard_local_cfg().raft_replicate_batch_window_size())
+        .raft_max_concurrent_append_requests_per_follower(),
+      config::shard_local_cfg().raft_max_inflight_append_bytes_per_follower())
+  , _batcher(
+      this,
+      config::shard_local_cfg().raft_replicate_batch_window_size(),
+      config::shard_local_cfg().raft_replicate_batch_latency_target.bind())
   , _event_manager(this)
   , _probe(std::make_unique<probe>())
   , _ctxlog(group, _log->config().ntp())
@@ -137,6 +142,7 @@ consensus::consensus(
   , _recovery_throttle(recovery_throttle)
   , _recovery_mem_quota(recovery_mem_quota)
   , _recovery_scheduler(recovery_scheduler)
+  , _flush_batcher(flush_batcher)
   , _features(ft)
   , _snapshot_mgr(
       std::filesystem::path(_log->config().work_directory()),
@@ -240,6 +246,33 @@ void consensus::maybe_step_down() {
     });
 }
 
+bool consensus::has_leader_lease() const {
+    if (
+      !config::shard_local_cfg().raft_enable_leader_lease() || !is_leader()
+      || _transferring_leadership || _lease_revoked_term == _term) {
+        return false;
+    }
+    const auto lease_start = config().quorum_match([this](vnode rni) {
+        if (rni == _self) {
+            return clock_type::now();
+        }
+        if (auto it = _fstats.find(rni); it != _fstats.end()) {
+            return it->second.lease_timestamp;
+        }
+        return clock_type::time_point::min();
+    });
+    return lease_start != clock_type::time_point::min()
+           && lease_start + leader_lease_duration() > clock_type::now();
+}
+
+void consensus::update_lease_timestamp(
+  vnode id, clock_type::time_point sent_at) {
+    if (auto it = _fstats.find(id); it != _fstats.end()) {
+        it->second.lease_timestamp = std::max(
+          it->second.lease_timestamp, sent_at);
+    }
+}
+
 clock_type::time_point consensus::majority_heartbeat() const {
     return config().quorum_match([this](vnode rni) {
         if (rni == _self) {
@@ -556,6 +589,14 @@ void consensus::successfull_append_entries_reply(
     idx.match_index = idx.last_dirty_log_index;
     idx.next_index = model::next_offset(idx.last_dirty_log_index);
     idx.last_successful_received_seq = idx.last_received_seq;
+    // a reply in the current term to a request created after the probe,
+    // replies to requests from a previous term may carry any sequence
+    if (
+      reply.term == _term
+      && idx.last_successful_received_seq >= idx.lease_probe_seq) {
+        idx.lease_timestamp = std::max(
+          idx.lease_timestamp, idx.lease_probe_timestamp);
+    }
     /**
      * Update expected log end offset only if it is smaller than current value,
      * the check is needed here as there might be pending append entries
@@ -651,6 +692,15 @@ ss::future<result<model::offset>> consensus::linearizable_barrier() {
      * Flush log on leader, to make sure the _commited_index will be updated
      */
     co_await flush_log();
+    /**
+     * No other leader can be elected while the lease is held, the commit
+     * index of this leader is the latest one.
+     */
+    if (has_leader_lease()) {
+        vlog(
+          _ctxlog.trace, "Linearizable offset under lease: {}", _commit_index);
+        co_return ret_t(_commit_index);
+    }
     const auto cfg = config();
     const auto offsets = _log->offsets();
 
@@ -1723,9 +1773,14 @@ ss::future<vote_reply> consensus::do_vote(vote_request r) {
     // timeout duration When the vote was requested because of leadership
     // transfer grant the vote immediately.
     auto prev_election = clock_type::now() - _jit.base_duration();
+    // With leader leases a vote already granted in this term is the only
+    // exception, a node we voted for in an earlier term must wait too.
+    const bool leases = config::shard_local_cfg().raft_enable_leader_lease();
+    const bool vote_granted_before = r.node_id == _voted_for
+                                     && (r.term == _term || !leases);
     if (
       _hbeat > prev_election && !r.leadership_transfer
-      && r.node_id != _voted_for) {
+      && !vote_granted_before) {
         vlog(
           _ctxlog.trace,
           "Already heard from the leader, not granting vote to node {}",
@@ -1900,6 +1955,7 @@ consensus::do_append_entries(append_entries_request&& r) {
         upsert_recovery_state(
           last_log_offset,
           request_metadata.dirty_offset,
+          request_metadata.commit_index,
           request_metadata.dirty_offset > request_metadata.prev_log_index);
         reply.may_recover = _follower_recovery_state->is_active();
 
@@ -1933,6 +1989,7 @@ consensus::do_append_entries(append_entries_request&& r) {
         upsert_recovery_state(
           last_log_offset,
           request_metadata.dirty_offset,
+          request_metadata.commit_index,
           request_metadata.dirty_offset > request_metadata.prev_log_index);
         reply.may_recover = _follower_recovery_state->is_active();
 
@@ -1985,7 +2042,10 @@ consensus::do_append_entries(append_entries_request&& r) {
         // This is a valid recovery request. In case we haven't allowed it,
         // defer to the leader and force-enter the recovery state.
         upsert_recovery_state(
-          last_log_offset, request_metadata.dirty_offset, true);
+          last_log_offset,
+          request_metadata.dirty_offset,
+          request_metadata.commit_index,
+          true);
         reply.may_recover = _follower_recovery_state->is_active();
     }
 
@@ -2084,7 +2144,8 @@ consensus::do_append_entries(append_entries_request&& r) {
                 if (_follower_recovery_state) {
                     _follower_recovery_state->update_progress(
                       ofs.last_offset,
-                      std::max(m.dirty_offset, ofs.last_offset));
+                      std::max(m.dirty_offset, ofs.last_offset),
+                      m.commit_index);
 
                     if (m.dirty_offset == m.prev_log_index) {
                         // Normal (non-recovery, non-heartbeat) append_entries
@@ -2304,7 +2365,8 @@ consensus::do_install_snapshot(install_snapshot_request r) {
         co_return reply;
     }
 
-    upsert_recovery_state(r.last_included_index, r.dirty_offset, true);
+    upsert_recovery_state(
+      r.last_included_index, r.dirty_offset, model::offset{}, true);
 
     // Write data into snapshot file at given offset (§7.3)
     size_t chunk_size = r.chunk.size_bytes();
@@ -2652,6 +2714,13 @@ ss::future<consensus::flushed> consensus::flush_log() {
     co_return flushed::yes;
 }
 
+ss::future<> consensus::flush_follower_log() {
+    if (_flush_batcher.enabled() && has_pending_flushes()) {
+        return _flush_batcher.flush(*this);
+    }
+    return flush_log().discard_result();
+}
+
 ss::future<storage::append_result> consensus::disk_append(
   model::record_batch_reader&& reader,
   update_last_quorum_index should_update_last_quorum_idx) {
@@ -3340,6 +3409,7 @@ consensus::do_transfer_leadership(transfer_leadership_request req) {
          * complete the transfer.
          */
         _transferring_leadership = true;
+        _lease_revoked_term = _term;
 
         if (!_fstats.contains(target_rni)) {
             return seastar::make_ready_future<std::error_code>(
@@ -3832,6 +3902,7 @@ void consensus::reset_last_sent_protocol_meta(const vnode& node) {
 void consensus::upsert_recovery_state(
   model::offset our_last_offset,
   model::offset leader_last_offset,
+  model::offset leader_commit_offset,
   bool already_recovering) {
     bool force_active = already_recovering
                         || !_features.is_active(
@@ -3843,6 +3914,7 @@ void consensus::upsert_recovery_state(
           *this,
           our_last_offset,
           leader_last_offset,
+          leader_commit_offset,
           force_active);
         vlog(
           _ctxlog.debug,
@@ -3858,7 +3930,7 @@ void consensus::upsert_recovery_state(
         }
 
         _follower_recovery_state->update_progress(
-          our_last_offset, leader_last_offset);
+          our_last_offset, leader_last_offset, leader_commit_offset);
     }
 }
 
@@ -3894,6 +3966,15 @@ std::optional<model::offset> consensus::get_learner_start_offset() const {
     return std::nullopt;
 }
 
+std::optional<model::offset> consensus::get_follower_catchup_offset() const {
+    if (
+      !_follower_catchup_offset
+      || !config::shard_local_cfg().raft_enable_follower_catchup_from_cloud()) {
+        return std::nullopt;
+    }
+    return _follower_catchup_offset();
+}
+
 void consensus::notify_config_update() {
     _write_caching_enabled = log_config().write_caching();
     _flush_bytes = log_config().flush_bytes();
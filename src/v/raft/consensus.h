@@ -24,6 +24,7 @@
 #include "raft/consensus_utils.h"
 #include "raft/coordinated_recovery_throttle.h"
 #include "raft/event_manager.h"
+#include "raft/follower_flush_batcher.h"
 #include "raft/follower_stats.h"
 #include "raft/group_configuration.h"
 #include "raft/heartbeats.h"
@@ -105,6 +106,7 @@ public:
       std::optional<std::reference_wrapper<coordinated_recovery_throttle>>,
       recovery_memory_quota&,
       recovery_scheduler&,
+      follower_flush_batcher&,
       features::feature_table&,
       std::optional<voter_priority> = std::nullopt,
       keep_snapshotted_log = keep_snapshotted_log::no);
@@ -177,6 +179,13 @@ public:
         return is_elected_leader() && _term == _confirmed_term;
     }
     bool is_candidate() const { return _vstate == vote_state::candidate; }
+    /**
+     * True if the leader holds a lease: a majority of voters acknowledged
+     * requests sent within the lease duration, so none of them grants a
+     * vote to another node before the lease expires and no other leader
+     * can be elected.
+     */
+    bool has_leader_lease() const;
     std::optional<model::node_id> get_leader_id() const {
         return _leader_id ? std::make_optional(_leader_id->id()) : std::nullopt;
     }
@@ -450,6 +459,9 @@ public:
     suppress_heartbeats_guard suppress_heartbeats(vnode);
 
     void update_heartbeat_status(vnode, bool);
+    /// Extend the lease with a lightweight heartbeat to \p vnode sent at \p
+    /// sent_at that the follower acknowledged.
+    void update_lease_timestamp(vnode, clock_type::time_point sent_at);
 
     bool should_reconnect_follower(const follower_index_metadata&);
 
@@ -530,6 +542,7 @@ private:
     friend replicate_batcher;
     friend event_manager;
     friend append_entries_buffer;
+    friend follower_flush_batcher;
     friend heartbeat_manager;
     using update_last_quorum_index
       = ss::bool_class<struct update_last_quorum_index>;
@@ -592,6 +605,14 @@ private:
     ss::future<> do_maybe_update_leader_commit_idx(ssx::semaphore_units);
 
     clock_type::time_point majority_heartbeat() const;
+    /**
+     * Leases last half of the election timeout, followers refuse votes for
+     * the whole of it. The margin covers the resolution of the clock and
+     * any difference in clock rates between nodes.
+     */
+    clock_type::duration leader_lease_duration() const {
+        return _jit.base_duration() / 2;
+    }
     /*
      * Start an election. When leadership transfer is requested, the election is
      * started immediately, and the vote request will contain a flag that
@@ -618,6 +639,10 @@ private:
     /// \brief _does not_ hold the lock.
     using flushed = ss::bool_class<struct flushed_executed_tag>;
     ss::future<flushed> flush_log();
+    /// \brief _does not_ hold the lock. Flushes the log after appending
+    /// entries as a follower, batched with the other groups of the shard
+    /// when enabled.
+    ss::future<> flush_follower_log();
 
     void maybe_step_down();
 
@@ -764,10 +789,24 @@ private:
     void upsert_recovery_state(
       model::offset our_last_offset,
       model::offset leader_last_offset,
+      model::offset leader_commit_offset,
       bool already_recovering);
 
     std::optional<model::offset> get_learner_start_offset() const;
 
+    using follower_catchup_offset_provider
+      = ss::noncopyable_function<std::optional<model::offset>()>;
+    /**
+     * Set the source of the offset that a voter far behind the leader may be
+     * recovered from, as new replicas are with the learner start offset. The
+     * data before it must be available elsewhere, e.g. in cloud storage.
+     */
+    void
+    set_follower_catchup_offset_provider(follower_catchup_offset_provider p) {
+        _follower_catchup_offset = std::move(p);
+    }
+    std::optional<model::offset> get_follower_catchup_offset() const;
+
     bool use_serde_configuration() const {
         return _features.is_active(features::feature::raft_config_serde);
     }
@@ -808,6 +847,11 @@ private:
     vnode _voted_for;
     std::optional<vnode> _leader_id;
     bool _transferring_leadership{false};
+    // Once leadership transfer starts the target may be elected regardless
+    // of followers hearing from the leader, so no lease is held for the rest
+    // of the term.
+    model::term_id _lease_revoked_term;
+    follower_catchup_offset_provider _follower_catchup_offset;
 
     /// useful for when we are not the leader
     clock_type::time_point _hbeat = clock_type::now();
@@ -830,7 +874,8 @@ private:
 
     /// all raft operations must happen exclusively since the common case
     /// is for the operation to touch the disk
-    mutex _op_lock{"consensus::op_lock"};
+    static inline const lock_class op_lock_class{"raft_op_lock"};
+    mutex _op_lock{"consensus::op_lock", op_lock_class};
     /// since snapshot state is orthogonal to raft state when writing snapshot
     /// it is enough to grab the snapshot mutex, there is no need to keep
     /// oplock, if the two locks are expected to be acquired at the same time
@@ -853,6 +898,7 @@ private:
       _recovery_throttle;
     recovery_memory_quota& _recovery_mem_quota;
     recovery_scheduler& _recovery_scheduler;
+    follower_flush_batcher& _flush_batcher;
     features::feature_table& _features;
     storage::simple_snapshot_manager _snapshot_mgr;
     uint64_t _snapshot_size{0};
@@ -0,0 +1,73 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "raft/follower_flush_batcher.h"
+
+#include "base/vlog.h"
+#include "raft/consensus.h"
+#include "raft/logger.h"
+#include "ssx/future-util.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/coroutine/parallel_for_each.hh>
+#include <seastar/util/later.hh>
+
+namespace raft {
+
+follower_flush_batcher::follower_flush_batcher(config::binding<bool> enabled)
+  : _enabled(std::move(enabled)) {}
+
+ss::future<> follower_flush_batcher::flush(consensus& raft) {
+    auto holder = _gate.hold();
+    ++_requests;
+    auto [it, inserted] = _pending.try_emplace(raft.group());
+    if (inserted) {
+        it->second.raft = &raft;
+    }
+    auto f = it->second.done.get_shared_future();
+    if (!_running) {
+        _running = true;
+        ssx::spawn_with_gate(_gate, [this] { return run(); });
+    }
+    co_await std::move(f);
+}
+
+ss::future<> follower_flush_batcher::run() {
+    // let the groups that are appending right now join the first epoch
+    co_await ss::yield();
+    while (!_pending.empty()) {
+        co_await flush_epoch(std::exchange(_pending, {}));
+    }
+    _running = false;
+}
+
+ss::future<> follower_flush_batcher::flush_epoch(pending_t epoch) {
+    ++_epochs;
+    vlog(raftlog.trace, "Flushing {} follower logs", epoch.size());
+    // the requesting groups are waiting for the result, so are kept alive
+    // until it is set
+    co_await ss::coroutine::parallel_for_each(
+      epoch, [](pending_t::value_type& entry) -> ss::future<> {
+          auto& pending = entry.second;
+          try {
+              co_await pending.raft->flush_log();
+              pending.done.set_value();
+          } catch (...) {
+              pending.done.set_exception(std::current_exception());
+          }
+      });
+}
+
+ss::future<> follower_flush_batcher::stop() {
+    // pending requests are still served by the running epoch loop
+    co_await _gate.close();
+}
+
+} // namespace raft
@@ -0,0 +1,79 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "base/seastarx.h"
+#include "config/property.h"
+#include "raft/fwd.h"
+#include "raft/types.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/gate.hh>
+#include <seastar/core/shared_future.hh>
+
+#include <absl/container/node_hash_map.h>
+
+namespace raft {
+
+/**
+ * Per-shard batcher of follower log flushes, owned by the group_manager.
+ *
+ * A follower flushes its log after appending entries so that it can report a
+ * new flushed offset to the leader. With thousands of groups on a shard this
+ * results in as many small flushes, each delaying the quorum ack of its
+ * group. When `raft_coalesce_follower_flushes` is enabled, the flushes
+ * requested by all the groups of the shard are collected into flush epochs.
+ * The logs of an epoch are flushed together, and requests arriving while an
+ * epoch is in progress are collected into the next one.
+ */
+class follower_flush_batcher {
+public:
+    explicit follower_flush_batcher(config::binding<bool> enabled);
+    follower_flush_batcher(follower_flush_batcher&&) = delete;
+    follower_flush_batcher& operator=(follower_flush_batcher&&) = delete;
+    follower_flush_batcher(const follower_flush_batcher&) = delete;
+    follower_flush_batcher& operator=(const follower_flush_batcher&) = delete;
+    ~follower_flush_batcher() noexcept = default;
+
+    /// Whether flushes are batched, or should be issued directly.
+    bool enabled() const { return _enabled() && !_gate.is_closed(); }
+
+    /**
+     * Flush the log of \p raft as part of the next flush epoch. The returned
+     * future resolves once the data the log held when this was called is
+     * durable.
+     */
+    ss::future<> flush(consensus& raft);
+
+    uint64_t requests() const { return _requests; }
+    uint64_t epochs() const { return _epochs; }
+
+    ss::future<> stop();
+
+private:
+    struct pending_flush {
+        consensus* raft{nullptr};
+        ss::shared_promise<> done;
+    };
+    using pending_t = absl::node_hash_map<group_id, pending_flush>;
+
+    ss::future<> run();
+    ss::future<> flush_epoch(pending_t);
+
+    config::binding<bool> _enabled;
+    pending_t _pending;
+    bool _running{false};
+    ss::gate _gate;
+    uint64_t _requests{0};
+    uint64_t _epochs{0};
+};
+
+} // namespace raft
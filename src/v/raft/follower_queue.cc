@@ -15,15 +15,31 @@
 
 #include <seastar/core/coroutine.hh>
 
+#include <algorithm>
+
 namespace raft {
 
-follower_queue::follower_queue(uint32_t max_concurrent_append_entries)
+follower_queue::follower_queue(
+  uint32_t max_concurrent_append_entries,
+  std::optional<size_t> max_inflight_bytes)
   : _max_concurrent_append_entries(max_concurrent_append_entries)
+  , _max_inflight_bytes(max_inflight_bytes)
   , _sem(std::make_unique<ssx::semaphore>(
-      _max_concurrent_append_entries, "raft/follow")) {}
+      _max_concurrent_append_entries, "raft/follow")) {
+    if (_max_inflight_bytes) {
+        _bytes_sem = std::make_unique<ssx::semaphore>(
+          *_max_inflight_bytes, "raft/follow-bytes");
+    }
+}
 
-ss::future<ssx::semaphore_units> follower_queue::get_append_entries_unit() {
-    co_return co_await ss::get_units(*_sem, 1);
+ss::future<follower_queue::units>
+follower_queue::get_append_entries_unit(size_t bytes) {
+    units u{.requests = co_await ss::get_units(*_sem, 1)};
+    if (_bytes_sem) {
+        u.bytes = co_await ss::get_units(
+          *_bytes_sem, std::min(bytes, *_max_inflight_bytes));
+    }
+    co_return u;
 }
 
 } // namespace raft
@@ -12,11 +12,19 @@
 #include "raft/group_configuration.h"
 #include "ssx/semaphore.h"
 
+#include <optional>
+
 namespace raft {
 
 class follower_queue {
 public:
-    explicit follower_queue(uint32_t);
+    /// Held for as long as an append entries request is in flight.
+    struct units {
+        ssx::semaphore_units requests;
+        ssx::semaphore_units bytes;
+    };
+
+    follower_queue(uint32_t, std::optional<size_t> max_inflight_bytes);
 
     follower_queue(follower_queue&&) noexcept = default;
     follower_queue(const follower_queue&) = delete;
@@ -26,13 +34,22 @@ public:
         vassert(is_idle(), "can not remove not idle follower queue");
     }
 
-    ss::future<ssx::semaphore_units> get_append_entries_unit();
+    /**
+     * Wait for room in the window of requests in flight to the follower for
+     * a request of \p bytes. A request larger than the byte window waits
+     * for the whole window, so that it can always be sent.
+     */
+    ss::future<units> get_append_entries_unit(size_t bytes);
 
     ss::future<> stop();
 
     bool is_idle() const {
         return _sem->waiters() == 0
-               && _sem->available_units() == _max_concurrent_append_entries;
+               && _sem->available_units() == _max_concurrent_append_entries
+               && (!_bytes_sem
+                   || (_bytes_sem->waiters() == 0
+                       && _bytes_sem->available_units()
+                            == static_cast<ssize_t>(*_max_inflight_bytes)));
     }
 
 private:
@@ -49,7 +66,10 @@ private:
      * - token-bucket based throughput limitter
      */
     uint32_t _max_concurrent_append_entries;
+    std::optional<size_t> _max_inflight_bytes;
     std::unique_ptr<ssx::semaphore> _sem;
+    // set if the window is also bounded by bytes
+    std::unique_ptr<ssx::semaphore> _bytes_sem;
 };
 
 } // namespace raft
@@ -13,6 +13,9 @@
 
 #include <absl/container/node_hash_map.h>
 
+#include <tuple>
+#include <utility>
+
 namespace raft {
 void follower_stats::update_with_configuration(const group_configuration& cfg) {
     cfg.for_each_broker_id([this](const vnode& rni) {
@@ -47,14 +50,18 @@ void follower_stats::update_with_configuration(const group_configuration& cfg) {
     }
 }
 
-ss::future<ssx::semaphore_units>
-follower_stats::get_append_entries_unit(vnode id) {
+ss::future<follower_queue::units>
+follower_stats::get_append_entries_unit(vnode id, size_t bytes) {
     if (auto it = _queues.find(id); it != _queues.end()) {
-        return it->second.get_append_entries_unit();
+        return it->second.get_append_entries_unit(bytes);
     }
-    auto [it, _] = _queues.emplace(id, _max_concurrent_append_entries);
+    auto [it, _] = _queues.emplace(
+      std::piecewise_construct,
+      std::forward_as_tuple(id),
+      std::forward_as_tuple(
+        _max_concurrent_append_entries, _max_inflight_append_bytes));
 
-    return it->second.get_append_entries_unit();
+    return it->second.get_append_entries_unit(bytes);
 }
 
 void follower_stats::return_append_entries_units(vnode id) {
@@ -27,9 +27,13 @@ public:
     using iterator = container_t::iterator;
     using const_iterator = container_t::const_iterator;
 
-    explicit follower_stats(vnode self, uint32_t max_concurrent_append_entries)
+    follower_stats(
+      vnode self,
+      uint32_t max_concurrent_append_entries,
+      std::optional<size_t> max_inflight_append_bytes)
       : _self(self)
-      , _max_concurrent_append_entries(max_concurrent_append_entries) {}
+      , _max_concurrent_append_entries(max_concurrent_append_entries)
+      , _max_inflight_append_bytes(max_inflight_append_bytes) {}
 
     const follower_index_metadata& get(vnode n) const {
         auto it = _followers.find(n);
@@ -71,7 +75,9 @@ public:
 
     size_t size() const { return _followers.size(); }
 
-    ss::future<ssx::semaphore_units> get_append_entries_unit(vnode);
+    /// Wait for room in the follower's window for a request of \p bytes.
+    ss::future<follower_queue::units>
+    get_append_entries_unit(vnode, size_t bytes);
 
     void return_append_entries_units(vnode);
 
@@ -87,6 +93,7 @@ private:
     friend std::ostream& operator<<(std::ostream&, const follower_stats&);
     vnode _self;
     uint32_t _max_concurrent_append_entries;
+    std::optional<size_t> _max_inflight_append_bytes;
     container_t _followers;
     absl::node_hash_map<vnode, follower_queue> _queues;
 };
@@ -50,6 +50,7 @@ group_manager::group_manager(
   , _recovery_scheduler(
       _configuration.recovery_concurrency_per_shard,
       _configuration.heartbeat_interval)
+  , _flush_batcher(_configuration.coalesce_follower_flushes)
   , _feature_table(feature_table.local())
   , _flush_timer_jitter(_configuration.flush_timer_interval_ms)
   , _is_ready(false) {
@@ -91,11 +92,16 @@ ss::future<> group_manager::stop() {
         f = f.then([this] { return _heartbeats.stop(); });
     }
 
-    return f.then([this] {
-        return ss::parallel_for_each(
-          _groups,
-          [](ss::lw_shared_ptr<consensus> raft) { return raft->stop(); });
-    });
+    return f
+      .then([this] {
+          return ss::parallel_for_each(
+            _groups,
+            [](ss::lw_shared_ptr<consensus> raft) { return raft->stop(); });
+      })
+      .then([this] {
+          // stopping groups wait for their pending follower flushes
+          return _flush_batcher.stop();
+      });
 }
 void group_manager::set_ready() {
     _is_ready = true;
@@ -135,6 +141,7 @@ ss::future<ss::lw_shared_ptr<raft::consensus>> group_manager::create_group(
                                        : std::nullopt,
       _recovery_mem_quota,
       _recovery_scheduler,
+      _flush_batcher,
       _feature_table,
       _is_ready ? std::nullopt : std::make_optional(min_voter_priority),
       keep_snapshotted_log);
@@ -231,9 +238,19 @@ void group_manager::setup_metrics() {
     _metrics.add_group(
       prometheus_sanitize::metrics_name("raft"),
       {sm::make_gauge(
-        "group_count",
-        [this] { return _groups.size(); },
-        sm::description("Number of raft groups"))});
+         "group_count",
+         [this] { return _groups.size(); },
+         sm::description("Number of raft groups")),
+       sm::make_counter(
+         "follower_flush_requests",
+         [this] { return _flush_batcher.requests(); },
+         sm::description(
+           "Follower log flushes requested from the shard-wide flush "
+           "batcher")),
+       sm::make_counter(
+         "follower_flush_epochs",
+         [this] { return _flush_batcher.epochs(); },
+         sm::description("Epochs of batched follower log flushes"))});
 }
 
 ss::future<> group_manager::flush_groups() {
@@ -14,6 +14,7 @@
 #include "metrics/metrics.h"
 #include "model/metadata.h"
 #include "raft/consensus_client_protocol.h"
+#include "raft/follower_flush_batcher.h"
 #include "raft/heartbeat_manager.h"
 #include "raft/recovery_memory_quota.h"
 #include "raft/recovery_scheduler.h"
@@ -51,6 +52,7 @@ public:
         config::binding<std::chrono::milliseconds> flush_timer_interval_ms;
         config::binding<model::write_caching_mode> write_caching;
         config::binding<std::chrono::milliseconds> write_caching_flush_ms;
+        config::binding<bool> coalesce_follower_flushes;
     };
     using config_provider_fn = ss::noncopyable_function<configuration()>;
 
@@ -97,6 +99,13 @@ public:
         return _recovery_scheduler.get_status();
     }
 
+    /// Time of the last successful heartbeat reply from every node this shard
+    /// sends heartbeats to
+    const heartbeat_manager::reply_times_t&
+    last_heartbeat_reply_times() const {
+        return _heartbeats.last_reply_times();
+    }
+
 private:
     void trigger_leadership_notification(raft::leadership_status);
     void setup_metrics();
@@ -122,6 +131,7 @@ private:
     coordinated_recovery_throttle& _recovery_throttle;
     recovery_memory_quota _recovery_mem_quota;
     recovery_scheduler _recovery_scheduler;
+    follower_flush_batcher _flush_batcher;
     features::feature_table& _feature_table;
     ss::timer<clock_type> _flush_timer;
     timeout_jitter _flush_timer_jitter;
@@ -50,6 +50,7 @@ heartbeat_manager::follower_request_meta::follower_request_meta(
   , seq(seq)
   , dirty_offset(dirty_offset)
   , follower_vnode(target)
+  , sent_at(clock_type::now())
   , hb_guard(c->suppress_heartbeats(follower_vnode)) {}
 
 heartbeat_manager::heartbeat_requests heartbeat_manager::requests_for_range() {
@@ -438,6 +439,7 @@ void heartbeat_manager::process_reply(
         }
         return;
     }
+    _last_reply_at[n] = clock_type::now();
     auto& reply = r.value();
     reply.for_each_lw_reply([this, n, target = reply.target(), &groups](
                               group_id group, reply_result result) {
@@ -503,6 +505,8 @@ void heartbeat_manager::process_reply(
 
         consensus->update_heartbeat_status(
           meta_it->second.follower_vnode, true);
+        consensus->update_lease_timestamp(
+          meta_it->second.follower_vnode, meta_it->second.sent_at);
     });
 
     for (auto& m : reply.full_replies()) {
@@ -621,6 +625,7 @@ void heartbeat_manager::process_reply(
         }
         return;
     }
+    _last_reply_at[n] = clock_type::now();
     for (auto& m : r.value().meta) {
         auto it = _consensus_groups.find(m.group);
         if (it == _consensus_groups.end()) {
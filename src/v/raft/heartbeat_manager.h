@@ -24,6 +24,7 @@
 #include <seastar/util/log.hh>
 
 #include <absl/container/btree_map.h>
+#include <absl/container/flat_hash_map.h>
 #include <absl/container/node_hash_map.h>
 #include <boost/container/flat_set.hpp>
 
@@ -103,6 +104,8 @@ public:
         follower_req_seq seq;
         model::offset dirty_offset;
         vnode follower_vnode;
+        // used to extend the leader lease when acknowledged
+        clock_type::time_point sent_at;
         consensus::suppress_heartbeats_guard hb_guard;
     };
     // Heartbeats from all groups for single node
@@ -153,6 +156,14 @@ public:
 
     bool is_stopped() const { return _bghbeats.is_closed(); }
 
+    using reply_times_t
+      = absl::flat_hash_map<model::node_id, clock_type::time_point>;
+
+    /// Time of the last successful heartbeat reply from every node this shard
+    /// sends heartbeats to. A reply proves that the node is alive, so it is
+    /// used as liveness evidence outside of raft.
+    const reply_times_t& last_reply_times() const { return _last_reply_at; }
+
 private:
     struct heartbeat_requests {
         /// Requests to dispatch.  Can include request to self.
@@ -233,5 +244,6 @@ private:
     model::node_id _self;
     config::binding<bool> _enable_lw_heartbeat;
     features::feature_table& _feature_table;
+    reply_times_t _last_reply_at;
 };
 } // namespace raft
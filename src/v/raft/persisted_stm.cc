@@ -345,7 +345,28 @@ ss::future<> persisted_stm<T>::do_write_local_snapshot() {
 
 template<supported_stm_snapshot T>
 void persisted_stm<T>::write_local_snapshot_in_background() {
-    ssx::spawn_with_gate(_gate, [this] { return write_local_snapshot(); });
+    /**
+     * A background snapshot that is yet to be taken already covers the
+     * current state, there is no need to queue another one. This bounds the
+     * number of snapshots held in memory at a time, no matter how often
+     * snapshots are requested.
+     */
+    if (_background_snapshot_pending) {
+        return;
+    }
+    _background_snapshot_pending = true;
+    ssx::spawn_with_gate(_gate, [this] {
+        return _op_lock.with([this]() {
+            _background_snapshot_pending = false;
+            return wait_for_snapshot_hydrated().then([this] {
+                // nothing was applied since the last snapshot
+                if (last_applied_offset() <= _last_snapshot_offset) {
+                    return ss::now();
+                }
+                return do_write_local_snapshot();
+            });
+        });
+    });
 }
 
 template<supported_stm_snapshot T>
@@ -184,7 +184,10 @@ public:
      */
     ss::future<> write_local_snapshot();
     /**
-     * Takes and persists local persisted_stm snapshot in background fiber
+     * Takes and persists local persisted_stm snapshot in background fiber.
+     * Requests made while a background snapshot is waiting to be taken are
+     * coalesced into it, and no snapshot is written if nothing was applied
+     * since the last one.
      */
     void write_local_snapshot_in_background() final;
     /**
@@ -263,6 +266,7 @@ private:
     bool _snapshot_hydrated{false};
     T _snapshot_backend;
     model::offset _last_snapshot_offset;
+    bool _background_snapshot_pending{false};
 };
 
 } // namespace raft
@@ -24,11 +24,13 @@ follower_recovery_state::follower_recovery_state(
   consensus& parent,
   model::offset our_last,
   model::offset leader_last,
+  model::offset leader_commit,
   bool already_recovering)
   : _parent(&parent)
   , _is_active(already_recovering)
   , _our_last_offset(our_last)
   , _leader_last_offset(leader_last)
+  , _leader_commit_offset(leader_commit)
   , _scheduler(&scheduler) {
     _scheduler->add(*this);
 }
@@ -40,17 +42,24 @@ void follower_recovery_state::force_active() {
 }
 
 void follower_recovery_state::update_progress(
-  model::offset our_last, model::offset leader_last) {
+  model::offset our_last,
+  model::offset leader_last,
+  model::offset leader_commit) {
     auto prev_pending = pending_offset_count();
 
     vlog(
       raftlog.trace,
-      "follower_recovery_state {} new offsets: our: {}, leader {}",
+      "follower_recovery_state {} new offsets: our: {}, leader {}, leader "
+      "commit: {}",
       *this,
       our_last,
-      leader_last);
+      leader_last,
+      leader_commit);
 
     _our_last_offset = our_last;
+    if (leader_commit != model::offset{}) {
+        _leader_commit_offset = leader_commit;
+    }
 
     // Leader last offset can go backwards in the following cases:
     // 1. leadership change
@@ -99,6 +108,11 @@ int64_t follower_recovery_state::pending_offset_count() const {
     }
 }
 
+bool follower_recovery_state::is_commit_blocked() const {
+    return _leader_commit_offset != model::offset{}
+           && _leader_commit_offset < _leader_last_offset;
+}
+
 follower_recovery_state::~follower_recovery_state() noexcept {
     if (_scheduler) {
         _scheduler->remove(*this);
@@ -109,11 +123,13 @@ follower_recovery_state::~follower_recovery_state() noexcept {
 std::ostream& operator<<(std::ostream& o, const follower_recovery_state& frs) {
     fmt::print(
       o,
-      "{{ntp: {} is_active: {}, our_last_offset: {} leader_last_offset: {}}}",
+      "{{ntp: {} is_active: {}, our_last_offset: {} leader_last_offset: {} "
+      "leader_commit_offset: {}}}",
       frs.ntp(),
       frs._is_active,
       frs._our_last_offset,
-      frs._leader_last_offset);
+      frs._leader_last_offset,
+      frs._leader_commit_offset);
     return o;
 }
 
@@ -231,7 +247,7 @@ void recovery_scheduler_base::activate_some() {
         if (is_internal(frs.ntp())) {
             // internal partitions get higher priority as we want them fully
             // operational before waiting for all the user data to be recovered.
-            priority = -1;
+            priority = -2;
         } else {
             auto config = frs._parent->config();
             bool is_learner = !config.contains(frs._parent->self())
@@ -244,6 +260,12 @@ void recovery_scheduler_base::activate_some() {
                 // thus they don't conribute to the number of under-replicated
                 // partitions)
                 priority = 1;
+            } else if (frs.is_commit_blocked()) {
+                // the leader can not commit without this replica: the data it
+                // holds is not durable yet and acks=all producers are waiting,
+                // we want these partitions to regain a majority before the
+                // ones that are merely lagging
+                priority = -1;
             }
         }
 
@@ -62,6 +62,7 @@ public:
       consensus& parent,
       model::offset our_last,
       model::offset leader_last,
+      model::offset leader_commit,
       bool force_active);
 
     follower_recovery_state(follower_recovery_state&& rhs) = delete;
@@ -71,12 +72,21 @@ public:
     ~follower_recovery_state() noexcept;
 
     void force_active();
-    void update_progress(model::offset our_last, model::offset leader_last);
+    void update_progress(
+      model::offset our_last,
+      model::offset leader_last,
+      model::offset leader_commit = {});
     void yield();
 
     const model::ntp& ntp() const;
     bool is_active() const { return _is_active; }
     int64_t pending_offset_count() const;
+    /**
+     * True if the leader holds entries it was not able to commit yet, i.e.
+     * the group may be short of in-sync replicas and this replica is needed
+     * to form a majority (and to complete acks=all produce requests).
+     */
+    bool is_commit_blocked() const;
 
     friend std::ostream&
     operator<<(std::ostream&, const follower_recovery_state&);
@@ -89,6 +99,7 @@ private:
     bool _is_active = false;
     model::offset _our_last_offset;
     model::offset _leader_last_offset;
+    model::offset _leader_commit_offset;
 
     recovery_scheduler_base* _scheduler = nullptr;
     safe_intrusive_list_hook _list_hook;
@@ -101,7 +112,9 @@ private:
  *
  * This class is responsible for limiting the number of recoveries
  * done to a single shard (and therefore to a single node) at once, and
- * prioritizing them to recover important metadata before bulk data.
+ * prioritizing them to recover important metadata before bulk data, and
+ * partitions the leader can not commit to without this replica before the
+ * ones that are merely lagging.
  *
  * It is split into a "base" class that contains most of the logic, and
  * then specialized into a subclass that contains timing code, so that the
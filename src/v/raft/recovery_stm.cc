@@ -83,10 +83,11 @@ ss::future<> recovery_stm::do_recover(ss::io_priority_class iopc) {
     auto lstats = _ptr->_log->offsets();
 
     // follower last index was already evicted at the leader, use snapshot
+    const auto start_offset = get_follower_start_offset(*meta.value());
     const required_snapshot_type snapshot_needed = get_required_snapshot_type(
-      *meta.value());
+      *meta.value(), start_offset);
     if (snapshot_needed != required_snapshot_type::none) {
-        co_return co_await install_snapshot(snapshot_needed);
+        co_return co_await install_snapshot(snapshot_needed, start_offset);
     }
 
     /**
@@ -209,20 +210,27 @@ recovery_stm::should_flush(model::offset follower_committed_match_index) const {
     return flush_after_append(is_last || should_checkpoint_flush);
 }
 
-recovery_stm::required_snapshot_type recovery_stm::get_required_snapshot_type(
+std::optional<model::offset> recovery_stm::get_follower_start_offset(
   const follower_index_metadata& follower_metadata) const {
+    if (follower_metadata.is_learner) {
+        return _ptr->get_learner_start_offset();
+    }
+    return _ptr->get_follower_catchup_offset();
+}
+
+recovery_stm::required_snapshot_type recovery_stm::get_required_snapshot_type(
+  const follower_index_metadata& follower_metadata,
+  std::optional<model::offset> start_offset) const {
     /**
      * For on demand snapshot we compare next index with follower start offset
      * i.e. next offset of last included in on demand snapshot hence we need to
      * use greater than (not greater than or equal) while the other branch is
      * comparing next index with last included snapshot offset
      */
-    if (
-      follower_metadata.is_learner && _ptr->get_learner_start_offset()
-      && follower_metadata.next_index < *_ptr->get_learner_start_offset()) {
-        // current snapshot moved beyond configured learner start offset, we can
-        // use current snapshot instead creating a new on demand one
-        if (*_ptr->get_learner_start_offset() <= _ptr->last_snapshot_index()) {
+    if (start_offset && follower_metadata.next_index < *start_offset) {
+        // current snapshot moved beyond configured start offset, we can use
+        // current snapshot instead creating a new on demand one
+        if (*start_offset <= _ptr->last_snapshot_index()) {
             return required_snapshot_type::current;
         }
         return required_snapshot_type::on_demand;
@@ -429,15 +437,15 @@ ss::future<> recovery_stm::handle_install_snapshot_reply(
     return close_snapshot_reader();
 }
 
-ss::future<> recovery_stm::install_snapshot(required_snapshot_type s_type) {
-    const auto learner_start_offset = _ptr->get_learner_start_offset();
+ss::future<> recovery_stm::install_snapshot(
+  required_snapshot_type s_type, std::optional<model::offset> start_offset) {
     // open reader if not yet available
     if (!_snapshot_reader) {
         if (
           s_type == required_snapshot_type::on_demand
-          && learner_start_offset > _ptr->start_offset()) {
+          && start_offset > _ptr->start_offset()) {
             co_await take_on_demand_snapshot(
-              model::prev_offset(*learner_start_offset));
+              model::prev_offset(*start_offset));
         } else {
             co_await open_current_snapshot();
         }
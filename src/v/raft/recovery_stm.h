@@ -68,7 +68,8 @@ private:
     std::optional<follower_index_metadata*> get_follower_meta();
     clock_type::time_point append_entries_timeout();
 
-    ss::future<> install_snapshot(required_snapshot_type);
+    ss::future<>
+      install_snapshot(required_snapshot_type, std::optional<model::offset>);
     ss::future<> send_install_snapshot_request();
     ss::future<> handle_install_snapshot_reply(result<install_snapshot_reply>);
     ss::future<> open_current_snapshot();
@@ -76,7 +77,15 @@ private:
     ss::future<iobuf> read_snapshot_chunk();
     ss::future<> close_snapshot_reader();
     required_snapshot_type get_required_snapshot_type(
-      const follower_index_metadata& follower_metadata) const;
+      const follower_index_metadata& follower_metadata,
+      std::optional<model::offset> start_offset) const;
+    /**
+     * The offset the follower may be recovered from, skipping the log before
+     * it: the learner start offset for learners and the catch up offset for
+     * voters.
+     */
+    std::optional<model::offset>
+    get_follower_start_offset(const follower_index_metadata&) const;
     bool is_recovery_finished();
     flush_after_append should_flush(model::offset) const;
     consensus* _ptr;
@@ -18,15 +18,21 @@
 #include <seastar/core/future.hh>
 #include <seastar/core/gate.hh>
 #include <seastar/core/shared_ptr.hh>
+#include <seastar/core/sleep.hh>
 
+#include <algorithm>
 #include <optional>
 
 namespace raft {
 using namespace std::chrono_literals; // NOLINT
-replicate_batcher::replicate_batcher(consensus* ptr, size_t cache_size)
+replicate_batcher::replicate_batcher(
+  consensus* ptr,
+  size_t cache_size,
+  config::binding<std::optional<std::chrono::milliseconds>> latency_target)
   : _ptr(ptr)
   , _max_batch_size_sem(cache_size, "raft/repl-batch")
-  , _max_batch_size(cache_size) {}
+  , _max_batch_size(cache_size)
+  , _latency_target(std::move(latency_target)) {}
 
 replicate_stages replicate_batcher::replicate(
   std::optional<model::term_id> expected_term,
@@ -74,7 +80,10 @@ replicate_batcher::cache_and_wait_for_result(
         if (!_flush_pending) {
             _flush_pending = true;
             ssx::background = ssx::spawn_with_gate_then(_bg, [this]() {
-                return _lock.get_units()
+                auto delay = flush_delay();
+                auto f = delay > 0us ? ss::sleep(delay) : ss::now();
+                return std::move(f)
+                  .then([this] { return _lock.get_units(); })
                   .then([this](auto units) {
                       return flush(std::move(units), false);
                   })
@@ -113,6 +122,29 @@ ss::future<> replicate_batcher::stop() {
     });
 }
 
+std::chrono::microseconds replicate_batcher::flush_delay() const {
+    using std::chrono::microseconds;
+    const auto target = _latency_target();
+    if (!target) {
+        return 0us;
+    }
+    const auto budget = std::chrono::duration_cast<microseconds>(*target)
+                        - microseconds(_flush_time.get());
+    const auto interval = microseconds(_arrival_interval.get());
+    // a quiet partition, nothing else is expected in time
+    if (
+      budget <= 0us || interval >= budget || _last_arrival_interval >= budget) {
+        return 0us;
+    }
+    const auto available = _max_batch_size_sem.available_units();
+    if (available <= 0) {
+        return 0us;
+    }
+    const auto item_bytes = std::max<int64_t>(_item_bytes.get(), 1);
+    const auto fill_time = interval * (available / item_bytes);
+    return std::min(budget, fill_time);
+}
+
 ss::future<replicate_batcher::item_ptr> replicate_batcher::do_cache(
   std::optional<model::term_id> expected_term,
   model::record_batch_reader r,
@@ -182,6 +214,19 @@ replicate_batcher::do_cache_with_backpressure(
       consistency_lvl,
       timeout);
 
+    if (_latency_target()) {
+        // capped so that a long idle period does not dominate the average
+        static constexpr auto max_interval = std::chrono::microseconds(1s);
+        const auto now = ss::steady_clock_type::now();
+        _last_arrival_interval = std::min<std::chrono::microseconds>(
+          std::chrono::duration_cast<std::chrono::microseconds>(
+            now - _last_arrival),
+          max_interval);
+        _last_arrival = now;
+        _arrival_interval.update(_last_arrival_interval.count());
+        _item_bytes.update(static_cast<int64_t>(bytes));
+    }
+
     _item_cache.emplace_back(i);
     co_return i;
 }
@@ -322,7 +367,14 @@ ss::future<> replicate_batcher::do_flush(
       _ptr, std::move(req), std::move(seqs));
     try {
         auto holder = _bg.hold();
+        const auto started = ss::steady_clock_type::now();
         auto leader_result = co_await stm->apply(std::move(u));
+        if (_latency_target()) {
+            _flush_time.update(
+              std::chrono::duration_cast<std::chrono::microseconds>(
+                ss::steady_clock_type::now() - started)
+                .count());
+        }
 
         /**
          * First phase, if leader result has error just propagate error
@@ -13,14 +13,19 @@
 
 #include "base/outcome.h"
 #include "base/units.h"
+#include "config/property.h"
 #include "model/record_batch_reader.h"
 #include "raft/types.h"
 #include "ssx/semaphore.h"
+#include "utils/moving_average.h"
 #include "utils/mutex.h"
 
 #include <seastar/core/gate.hh>
 
 #include <absl/container/flat_hash_map.h>
+
+#include <chrono>
+#include <optional>
 namespace raft {
 class consensus;
 
@@ -113,7 +118,15 @@ public:
         ss::promise<result<replicate_result>> _promise;
     };
     using item_ptr = ss::lw_shared_ptr<item>;
-    explicit replicate_batcher(consensus* ptr, size_t cache_size);
+    /**
+     * With a \p latency_target the batcher holds back flushing a busy cache
+     * to build larger batches, see flush_delay().
+     */
+    replicate_batcher(
+      consensus* ptr,
+      size_t cache_size,
+      config::binding<std::optional<std::chrono::milliseconds>>
+        latency_target);
 
     replicate_batcher(replicate_batcher&&) noexcept = default;
     replicate_batcher& operator=(replicate_batcher&&) noexcept = delete;
@@ -151,6 +164,15 @@ private:
       consistency_level,
       std::optional<std::chrono::milliseconds>);
 
+    /**
+     * How long to wait before flushing the cache so that more requests are
+     * batched together. Zero unless a latency target is set and requests
+     * are expected to arrive before it is reached: the wait is bounded by
+     * the target less the time a flush takes, and by the time expected to
+     * fill the cache. Both are moving averages over recent requests.
+     */
+    std::chrono::microseconds flush_delay() const;
+
     ss::future<result<replicate_result>> cache_and_wait_for_result(
       ss::promise<> enqueued,
       std::optional<model::term_id> expected_term,
@@ -171,6 +193,16 @@ private:
     // flush task execution can be lower than the rate at which new
     // items are added to the cache.
     bool _flush_pending = false;
+
+    using stat_t = moving_average<int64_t, 16>;
+    config::binding<std::optional<std::chrono::milliseconds>> _latency_target;
+    // moving averages of request interarrival time and flush time in
+    // microseconds and of request size, used for adaptive batching
+    stat_t _arrival_interval{0};
+    stat_t _flush_time{0};
+    stat_t _item_bytes{0};
+    std::chrono::microseconds _last_arrival_interval{0};
+    ss::steady_clock_type::time_point _last_arrival;
 };
 
 } // namespace raft
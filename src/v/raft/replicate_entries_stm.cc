@@ -102,9 +102,10 @@ replicate_entries_stm::send_append_entries_request(
     auto opts = rpc::client_opts(append_entries_timeout());
     opts.resource_units = ss::make_foreign<ss::lw_shared_ptr<units_t>>(_units);
 
-    auto f = _ptr->_fstats.get_append_entries_unit(n).then_wrapped(
+    const auto bytes = _append_result->value().byte_size;
+    auto f = _ptr->_fstats.get_append_entries_unit(n, bytes).then_wrapped(
       [this, batches = std::move(batches), opts = std::move(opts), n](
-        ss::future<ssx::semaphore_units> f) mutable {
+        ss::future<follower_queue::units> f) mutable {
           // we want to signal dispatch semaphore after calling append entries.
           // When dispatch semaphore is released the append_entries_stm releases
           // op_lock so next append entries request can be dispatched to the
@@ -9,6 +9,7 @@
 
 #include "raft/rpc_client_protocol.h"
 
+#include "config/configuration.h"
 #include "outcome_future_utils.h"
 #include "raft/raftgen_service.h"
 #include "raft/types.h"
@@ -29,6 +30,7 @@ ss::future<result<vote_reply>> rpc_client_protocol::vote(
       ss::this_shard_id(),
       n,
       timeout,
+      rpc::traffic_class::control,
       [r = std::move(r),
        opts = std::move(opts)](raftgen_client_protocol client) mutable {
           return client.vote(std::move(r), std::move(opts))
@@ -42,6 +44,13 @@ ss::future<result<append_entries_reply>> rpc_client_protocol::append_entries(
   rpc::client_opts opts,
   bool use_all_serde_encoding) {
     auto timeout = opts.timeout;
+    if (
+      auto min_bytes
+      = config::shard_local_cfg().raft_append_entries_compression_bytes();
+      min_bytes && opts.compression == rpc::compression_type::none) {
+        opts.compression = rpc::compression_type::zstd;
+        opts.min_compression_bytes = *min_bytes;
+    }
     return _connection_cache.local().with_node_client<raftgen_client_protocol>(
       _self,
       ss::this_shard_id(),
@@ -69,6 +78,7 @@ ss::future<result<heartbeat_reply>> rpc_client_protocol::heartbeat(
       ss::this_shard_id(),
       n,
       timeout,
+      rpc::traffic_class::control,
       [r = std::move(r),
        opts = std::move(opts)](raftgen_client_protocol client) mutable {
           return client.heartbeat(std::move(r), std::move(opts))
@@ -83,6 +93,7 @@ ss::future<result<heartbeat_reply_v2>> rpc_client_protocol::heartbeat_v2(
       ss::this_shard_id(),
       n,
       timeout,
+      rpc::traffic_class::control,
       [r = std::move(r),
        opts = std::move(opts)](raftgen_client_protocol client) mutable {
           return client.heartbeat_v2(std::move(r), std::move(opts))
@@ -99,6 +110,7 @@ rpc_client_protocol::install_snapshot(
       ss::this_shard_id(),
       n,
       timeout,
+      rpc::traffic_class::bulk,
       [r = std::move(r),
        opts = std::move(opts)](raftgen_client_protocol client) mutable {
           return client.install_snapshot(std::move(r), std::move(opts))
@@ -114,6 +126,7 @@ ss::future<result<timeout_now_reply>> rpc_client_protocol::timeout_now(
       ss::this_shard_id(),
       n,
       timeout,
+      rpc::traffic_class::control,
       [r = std::move(r),
        opts = std::move(opts)](raftgen_client_protocol client) mutable {
           return client.timeout_now(std::move(r), std::move(opts))
@@ -133,24 +146,39 @@ ss::future<bool> rpc_client_protocol::ensure_disconnect(model::node_id n) {
           : transport(t) {}
     };
 
-    return _connection_cache.local()
-      .with_node_client<resetter>(
-        _self,
-        ss::this_shard_id(),
-        n,
-        std::chrono::milliseconds(100),
-        [](resetter r) {
-            // Give the caller a bool clue as to whether we really shut
-            // anything down (false indicates this was a no-op)
-            bool was_valid = r.transport->is_valid();
-
-            r.transport->shutdown();
-            return was_valid;
-        })
-      .then([]([[maybe_unused]] result<bool> r) {
-          // if result contains an error no connection was shut down, return
-          // false
-          return r.has_value() ? r.value() : false;
+    auto disconnect = [this, n](rpc::traffic_class cls) {
+        return _connection_cache.local()
+          .with_node_client<resetter>(
+            _self,
+            ss::this_shard_id(),
+            n,
+            std::chrono::milliseconds(100),
+            cls,
+            [](resetter r) {
+                // Give the caller a bool clue as to whether we really shut
+                // anything down (false indicates this was a no-op)
+                bool was_valid = r.transport->is_valid();
+
+                r.transport->shutdown();
+                return was_valid;
+            })
+          .then([]([[maybe_unused]] result<bool> r) {
+              // if result contains an error no connection was shut down,
+              // return false
+              return r.has_value() ? r.value() : false;
+          });
+    };
+
+    if (!config::shard_local_cfg().rpc_client_traffic_class_connections()) {
+        return disconnect(rpc::traffic_class::general);
+    }
+    // heartbeats use a connection of their own, unresponsive peers are
+    // disconnected on both
+    return ss::when_all_succeed(
+             disconnect(rpc::traffic_class::general),
+             disconnect(rpc::traffic_class::control))
+      .then([](std::tuple<bool, bool> r) {
+          return std::get<0>(r) || std::get<1>(r);
       });
 }
 
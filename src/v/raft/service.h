@@ -23,6 +23,7 @@
 #include <seastar/core/chunked_fifo.hh>
 #include <seastar/core/sharded.hh>
 #include <seastar/core/shared_ptr.hh>
+#include <seastar/core/smp.hh>
 #include <seastar/core/timed_out_error.hh>
 #include <seastar/core/with_timeout.hh>
 #include <seastar/coroutine/maybe_yield.hh>
@@ -119,7 +120,12 @@ public:
 
         std::vector<ss::future<shard_heartbeat_replies>> futures;
         futures.reserve(grouped.shard_requests.size());
-        for (auto& [shard, req] : grouped.shard_requests) {
+        for (ss::shard_id shard = 0; shard < grouped.shard_requests.size();
+             ++shard) {
+            auto& req = grouped.shard_requests[shard];
+            if (req.full_heartbeats.empty() && req.lw_heartbeats.empty()) {
+                continue;
+            }
             // dispatch to each core in parallel
             futures.push_back(dispatch_hbeats_to_core_v2(
               shard, source, target, std::move(req)));
@@ -263,7 +269,9 @@ private:
         ss::chunked_fifo<lw_reply> lw_replies;
     };
     struct shard_groupped_hbeat_requests_v2 {
-        absl::flat_hash_map<ss::shard_id, shard_heartbeats> shard_requests;
+        // indexed by shard id, a request carries tens of thousands of groups
+        // so the grouping avoids a hash lookup per group
+        std::vector<shard_heartbeats> shard_requests;
         std::vector<group_heartbeat> group_missing_requests;
     };
 
@@ -488,6 +496,7 @@ private:
     shard_groupped_hbeat_requests_v2
     group_hbeats_by_shard(heartbeat_request_v2 hb_request) {
         shard_groupped_hbeat_requests_v2 ret;
+        ret.shard_requests.resize(ss::smp::count);
 
         for (const auto& full_beat : hb_request.full_heartbeats()) {
             auto const shard = _shard_table.shard_for(full_beat.group);
@@ -497,8 +506,7 @@ private:
                 continue;
             }
 
-            auto [it, _] = ret.shard_requests.try_emplace(*shard);
-            it->second.full_heartbeats.push_back(
+            ret.shard_requests[*shard].full_heartbeats.push_back(
               full_heartbeat{.group = full_beat.group, .data = full_beat.data});
         }
         hb_request.for_each_lw_heartbeat([this, &ret](int64_t group_id) {
@@ -510,8 +518,7 @@ private:
                 return;
             }
 
-            auto [it, _] = ret.shard_requests.try_emplace(*shard);
-            it->second.lw_heartbeats.push_back(lw_beat);
+            ret.shard_requests[*shard].lw_heartbeats.push_back(lw_beat);
         });
 
         return ret;
@@ -53,6 +53,12 @@ public:
      * method it will be retried with the same record batch.
      */
     virtual ss::future<> apply(const model::record_batch&) = 0;
+    /**
+     * Returns false if batches of a given type never change the state of
+     * this state machine. Such batches are not passed to `apply`, the state
+     * machine offset is moved past them instead.
+     */
+    virtual bool consumes(model::record_batch_type) const { return true; }
     /**
      * This function will be called every time a snapshot is applied in apply
      * fiber. Snapshot will contain only a data specific for this state machine
@@ -12,6 +12,7 @@
 #include "raft/state_machine_manager.h"
 
 #include "bytes/iostream.h"
+#include "config/configuration.h"
 #include "config/property.h"
 #include "model/fundamental.h"
 #include "model/timeout_clock.h"
@@ -137,7 +138,9 @@ batch_applicator::apply_to_stm(
             co_return applied_successfully::no;
         }
 
-        co_await state.stm_entry->stm->apply(batch);
+        if (state.stm_entry->stm->consumes(batch.header().type)) {
+            co_await state.stm_entry->stm->apply(batch);
+        }
         state.stm_entry->stm->set_next(model::next_offset(last_offset));
         co_return applied_successfully::yes;
     } catch (...) {
@@ -153,20 +156,37 @@ batch_applicator::apply_to_stm(
     }
 }
 
-state_machine_manager::named_stm::named_stm(ss::sstring name, stm_ptr stm)
+namespace {
+// Bounds the number of deferred state machines that a shard starts at
+// the same time, so that their snapshot replays don't compete with the
+// partitions that are still starting.
+constexpr size_t max_concurrent_deferred_starts = 16;
+
+ssx::semaphore& deferred_start_semaphore() {
+    static thread_local ssx::semaphore sem{
+      max_concurrent_deferred_starts, "raft/deferred_stm_start"};
+    return sem;
+}
+} // namespace
+
+state_machine_manager::named_stm::named_stm(
+  ss::sstring name, stm_ptr stm, bool deferred)
   : name(std::move(name))
-  , stm(std::move(stm)) {}
+  , stm(std::move(stm))
+  , deferred(deferred) {}
 
 state_machine_manager::state_machine_manager(
   consensus* raft, std::vector<named_stm> stms, ss::scheduling_group apply_sg)
   : _raft(raft)
   , _log(ctx_log(_raft->group(), _raft->ntp()))
-  , _apply_sg(apply_sg) {
+  , _apply_sg(apply_sg)
+  , _independent_apply(
+      config::shard_local_cfg().raft_enable_independent_stm_apply.bind()) {
     for (auto& n_stm : stms) {
         _machines.try_emplace(
           n_stm.name,
           ss::make_lw_shared<state_machine_entry>(
-            n_stm.name, std::move(n_stm.stm)));
+            n_stm.name, std::move(n_stm.stm), n_stm.deferred));
     }
 }
 
@@ -175,13 +195,26 @@ ss::future<> state_machine_manager::start() {
     if (_machines.empty()) {
         co_return;
     }
-    co_await ss::coroutine::parallel_for_each(_machines, [this](auto& pair) {
-        vlog(_log.trace, "starting {} state machine", pair.first);
-        return pair.second->stm->start();
-    });
+    // the initial offset is derived from the state machines started right
+    // away, only defer if there is at least one of them
+    const bool defer = std::any_of(
+      _machines.begin(), _machines.end(), [](const auto& pair) {
+          return !pair.second->deferred;
+      });
+    co_await ss::coroutine::parallel_for_each(
+      _machines, [this, defer](auto& pair) {
+          if (defer && pair.second->deferred) {
+              return ss::now();
+          }
+          vlog(_log.trace, "starting {} state machine", pair.first);
+          return pair.second->stm->start().then(
+            [entry = pair.second] { entry->started = true; });
+      });
     std::vector<model::offset> offsets;
     for (const auto& [name, stm_meta] : _machines) {
-        offsets.push_back(stm_meta->stm->last_applied_offset());
+        if (stm_meta->started) {
+            offsets.push_back(stm_meta->stm->last_applied_offset());
+        }
     }
     std::sort(offsets.begin(), offsets.end());
     _next = model::next_offset(offsets.front());
@@ -189,12 +222,61 @@ ss::future<> state_machine_manager::start() {
       _log.debug,
       "started state machine manager with initial next offset: {}",
       _next);
+    for (auto& [name, entry] : _machines) {
+        if (entry->started) {
+            continue;
+        }
+        /**
+         * Nothing is applied to the state machine until it is started, the
+         * background apply fiber catches it up afterwards.
+         */
+        auto units = entry->background_apply_mutex.try_get_units();
+        vassert(units, "background apply of {} started before the stm", name);
+        ++_pending_deferred_starts;
+        ssx::spawn_with_gate(
+          _gate, [this, entry, units = std::move(*units)]() mutable {
+              return deferred_start(entry, std::move(units));
+          });
+    }
     ssx::spawn_with_gate(_gate, [this] {
         return ss::do_until(
           [this] { return _as.abort_requested(); }, [this] { return apply(); });
     });
 }
 
+ss::future<> state_machine_manager::deferred_start(
+  entry_ptr entry, ssx::semaphore_units apply_units) {
+    auto decrement = ss::defer([this] { --_pending_deferred_starts; });
+    while (!entry->started) {
+        bool error = false;
+        try {
+            auto units = co_await ss::get_units(
+              deferred_start_semaphore(), 1, _as);
+            vlog(_log.trace, "starting deferred {} state machine", entry->name);
+            co_await entry->stm->start();
+            entry->started = true;
+        } catch (...) {
+            auto e = std::current_exception();
+            if (ssx::is_shutdown_exception(e)) {
+                co_return;
+            }
+            error = true;
+            vlog(
+              _log.warn,
+              "error starting deferred {} state machine - {}",
+              entry->name,
+              e);
+        }
+        if (error) {
+            co_await ss::sleep_abortable(1s, _as);
+        }
+    }
+    apply_units.return_all();
+    if (!_as.abort_requested()) {
+        maybe_start_background_apply(entry);
+    }
+}
+
 ss::future<> state_machine_manager::stop() {
     vlog(
       _log.debug,
@@ -204,8 +286,12 @@ ss::future<> state_machine_manager::stop() {
     _as.request_abort();
 
     co_await _gate.close();
-    co_await ss::coroutine::parallel_for_each(
-      _machines, [](auto p) { return p.second->stm->stop(); });
+    co_await ss::coroutine::parallel_for_each(_machines, [](auto p) {
+        if (!p.second->started) {
+            return ss::now();
+        }
+        return p.second->stm->stop();
+    });
 }
 
 ss::future<> state_machine_manager::apply_raft_snapshot() {
@@ -302,49 +388,28 @@ ss::future<> state_machine_manager::apply() {
              * We need to return here as applied snapshot may not yet be
              * committed.
              */
+            std::vector<ssx::semaphore_units> units;
+            if (_independent_apply() || _pending_deferred_starts > 0) {
+                // state machines are applied by their own fibers, which must
+                // not read the log while the snapshot is being applied, and
+                // deferred ones must be started before it is applied
+                units = co_await acquire_background_apply_mutexes();
+            }
             co_return co_await apply_raft_snapshot();
         }
 
-        /**
-         * Raft make_reader method allows callers reading up to
-         * last_visible index. In order to make the STMs safe and working
-         * with the raft semantics (i.e. what is applied must be comitted)
-         * we have to limit reading to the committed offset.
-         */
-        vlog(
-          _log.trace,
-          "reading batches in range [{}, {}]",
-          _next,
-          _raft->committed_offset());
-        /**
-         * Use default priority for now, it is going to be unified with apply
-         * scheduling group soon
-         */
-        storage::log_reader_config config(
-          _next, _raft->committed_offset(), ss::default_priority_class());
-
-        model::record_batch_reader reader = co_await _raft->make_reader(config);
-        // collect STMs which has the same _next offset as the offset in
-        // manager and there is no background apply taking place
-        std::vector<entry_ptr> machines;
-        for (auto& [_, entry] : _machines) {
+        if (_independent_apply()) {
             /**
-             * We can simply check if a mutex is ready here as calling
-             * maybe_start_background_apply() will make the mutex underlying
-             * semaphore immediately not ready as there are no scheduling points
-             * before calling `get_units`
+             * Every state machine is applied by its own fiber up to the
+             * committed offset, so that a slow state machine does not hold
+             * back the others. Here we only move the offset the fibers apply
+             * up to, they are started below.
              */
-            if (
-              entry->stm->next() == _next
-              && entry->background_apply_mutex.ready()) {
-                machines.push_back(entry);
-            }
+            _next = std::max(
+              model::next_offset(_raft->committed_offset()), _next);
+        } else {
+            co_await apply_to_all();
         }
-        auto last_applied = co_await std::move(reader).consume(
-          batch_applicator(default_ctx, machines, _as, _log),
-          model::no_timeout);
-
-        _next = std::max(model::next_offset(last_applied), _next);
         vlog(_log.trace, "updating _next offset with: {}", _next);
     } catch (const ss::timed_out_error&) {
         vlog(_log.debug, "state machine apply timeout");
@@ -365,6 +430,48 @@ ss::future<> state_machine_manager::apply() {
     }
 }
 
+ss::future<> state_machine_manager::apply_to_all() {
+    /**
+     * Raft make_reader method allows callers reading up to
+     * last_visible index. In order to make the STMs safe and working
+     * with the raft semantics (i.e. what is applied must be comitted)
+     * we have to limit reading to the committed offset.
+     */
+    vlog(
+      _log.trace,
+      "reading batches in range [{}, {}]",
+      _next,
+      _raft->committed_offset());
+    /**
+     * Use default priority for now, it is going to be unified with apply
+     * scheduling group soon
+     */
+    storage::log_reader_config config(
+      _next, _raft->committed_offset(), ss::default_priority_class());
+
+    model::record_batch_reader reader = co_await _raft->make_reader(config);
+    // collect STMs which has the same _next offset as the offset in
+    // manager and there is no background apply taking place
+    std::vector<entry_ptr> machines;
+    for (auto& [_, entry] : _machines) {
+        /**
+         * We can simply check if a mutex is ready here as calling
+         * maybe_start_background_apply() will make the mutex underlying
+         * semaphore immediately not ready as there are no scheduling points
+         * before calling `get_units`
+         */
+        if (
+          entry->stm->next() == _next
+          && entry->background_apply_mutex.ready()) {
+            machines.push_back(entry);
+        }
+    }
+    auto last_applied = co_await std::move(reader).consume(
+      batch_applicator(default_ctx, machines, _as, _log), model::no_timeout);
+
+    _next = std::max(model::next_offset(last_applied), _next);
+}
+
 void state_machine_manager::maybe_start_background_apply(
   const entry_ptr& entry) {
     if (likely(entry->stm->next() == _next)) {
@@ -398,13 +505,15 @@ ss::future<> state_machine_manager::background_apply_fiber(
   entry_ptr entry, ssx::semaphore_units units) {
     while (!_as.abort_requested() && entry->stm->next() < _next) {
         storage::log_reader_config config(
-          entry->stm->next(), _next, ss::default_priority_class());
+          entry->stm->next(),
+          model::prev_offset(_next),
+          ss::default_priority_class());
 
         vlog(
           _log.debug,
           "reading batches in range [{}, {}] for '{}' stm background apply",
           entry->stm->next(),
-          _next,
+          model::prev_offset(_next),
           entry->name);
         bool error = false;
         try {
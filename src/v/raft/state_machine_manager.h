@@ -50,6 +50,9 @@ concept StateMachineIterateFunc = requires(
  * State machine manager is an entry point for registering state machines
  * built on top of replicated log. State machine managers uses a single
  * fiber to read and apply record batches to all managed state machines.
+ * With `raft_enable_independent_stm_apply` each state machine is instead
+ * applied by its own fiber, so that a slow state machine does not delay
+ * the others.
  *
  * When a machine throws an exception or timeouts when applying batches to
  * its state subsequent applies are executed in the separate apply fiber
@@ -113,9 +116,10 @@ public:
 private:
     using stm_ptr = ss::shared_ptr<state_machine_base>;
     struct named_stm {
-        named_stm(ss::sstring, stm_ptr);
+        named_stm(ss::sstring, stm_ptr, bool deferred = false);
         ss::sstring name;
         stm_ptr stm;
+        bool deferred;
     };
 
     state_machine_manager(
@@ -129,10 +133,13 @@ private:
     static constexpr const char* background_ctx = "background";
 
     struct state_machine_entry {
-        explicit state_machine_entry(
-          ss::sstring name, ss::shared_ptr<state_machine_base> stm)
+        state_machine_entry(
+          ss::sstring name,
+          ss::shared_ptr<state_machine_base> stm,
+          bool deferred)
           : name(std::move(name))
-          , stm(std::move(stm)) {}
+          , stm(std::move(stm))
+          , deferred(deferred) {}
         state_machine_entry(state_machine_entry&&) noexcept = default;
         state_machine_entry(const state_machine_entry&) noexcept = delete;
         state_machine_entry& operator=(state_machine_entry&&) noexcept = delete;
@@ -142,6 +149,9 @@ private:
 
         ss::sstring name;
         ss::shared_ptr<state_machine_base> stm;
+        // started in the background, after the manager
+        bool deferred;
+        bool started{false};
         mutex background_apply_mutex{
           "state_machine_manager::background_apply_mutex"};
     };
@@ -150,12 +160,14 @@ private:
       = absl::flat_hash_map<ss::sstring, entry_ptr, sstring_hash, sstring_eq>;
 
     void maybe_start_background_apply(const entry_ptr&);
+    ss::future<> deferred_start(entry_ptr, ssx::semaphore_units);
     ss::future<> background_apply_fiber(entry_ptr, ssx::semaphore_units);
 
     ss::future<> apply_raft_snapshot();
     ss::future<> do_apply_raft_snapshot(
       raft::snapshot_metadata metadata, storage::snapshot_reader& reader);
     ss::future<> apply();
+    ss::future<> apply_to_all();
 
     ss::future<std::vector<ssx::semaphore_units>>
     acquire_background_apply_mutexes();
@@ -181,9 +193,11 @@ private:
     mutex _apply_mutex{"stm_manager::apply"};
     state_machines_t _machines;
     model::offset _next{0};
+    size_t _pending_deferred_starts{0};
     ss::gate _gate;
     ss::abort_source _as;
     ss::scheduling_group _apply_sg;
+    config::binding<bool> _independent_apply;
 };
 
 /**
@@ -199,6 +213,21 @@ public:
         return machine;
     }
 
+    /**
+     * Creates a state machine that is started in the background once the
+     * other state machines of the partition are started, so that it doesn't
+     * delay the partition start. Batches are applied to it once it has
+     * caught up. Only for state machines that are not needed to serve
+     * produce and fetch requests.
+     */
+    template<ManagableStateMachine T, typename... Args>
+    ss::shared_ptr<T> create_deferred_stm(Args&&... args) {
+        auto machine = ss::make_shared<T>(std::forward<Args>(args)...);
+        _stms.emplace_back(ss::sstring(T::name), machine, true);
+
+        return machine;
+    }
+
     void with_scheduing_group(ss::scheduling_group sg) { _sg = sg; }
 
     state_machine_manager build(raft::consensus* raft) && {
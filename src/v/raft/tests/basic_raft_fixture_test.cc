@@ -7,6 +7,7 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "config/configuration.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
 #include "model/record.h"
@@ -20,6 +21,12 @@
 #include "test_utils/async.h"
 #include "test_utils/test.h"
 
+#include <seastar/core/loop.hh>
+#include <seastar/core/sleep.hh>
+#include <seastar/util/defer.hh>
+
+#include <boost/range/irange.hpp>
+
 #include <algorithm>
 
 using namespace raft;
@@ -74,6 +81,143 @@ TEST_F_CORO(raft_fixture, validate_replication) {
     co_await assert_logs_equal();
 }
 
+/**
+ * With a per follower byte window smaller than a single request and slow
+ * followers, requests queue up for the window rather than being dropped, and
+ * a request larger than the window is still sent.
+ */
+TEST_F_CORO(raft_fixture, validate_replication_with_append_bytes_window) {
+    config::shard_local_cfg()
+      .raft_max_inflight_append_bytes_per_follower.set_value(
+        std::make_optional<size_t>(4096));
+    auto reset = ss::defer([] {
+        config::shard_local_cfg()
+          .raft_max_inflight_append_bytes_per_follower.reset();
+    });
+    co_await create_simple_group(3);
+    auto leader = co_await wait_for_leader(10s);
+    for (auto& [_, node] : nodes()) {
+        node->on_dispatch([](raft::msg_type t) {
+            if (t == raft::msg_type::append_entries) {
+                return ss::sleep(20ms);
+            }
+            return ss::now();
+        });
+    }
+    auto& leader_node = node(leader);
+
+    co_await ss::parallel_for_each(
+      boost::irange(20), [this, &leader_node](int) -> ss::future<> {
+          auto result = co_await leader_node.raft()->replicate(
+            make_batches(10, 10, 128),
+            replicate_options(consistency_level::leader_ack));
+          ASSERT_TRUE_CORO(result.has_value());
+      });
+
+    co_await wait_for_committed_offset(leader_node.raft()->dirty_offset(), 10s);
+    co_await assert_logs_equal();
+}
+
+/**
+ * With adaptive batching concurrent requests are still all replicated, and
+ * so is a single request once the partition went quiet.
+ */
+TEST_F_CORO(raft_fixture, validate_replication_with_batch_latency_target) {
+    config::shard_local_cfg().raft_replicate_batch_latency_target.set_value(
+      std::make_optional<std::chrono::milliseconds>(5ms));
+    auto reset = ss::defer([] {
+        config::shard_local_cfg().raft_replicate_batch_latency_target.reset();
+    });
+    co_await create_simple_group(3);
+    auto leader = co_await wait_for_leader(10s);
+    auto& leader_node = node(leader);
+
+    co_await ss::parallel_for_each(
+      boost::irange(50), [this, &leader_node](int) -> ss::future<> {
+          auto result = co_await leader_node.raft()->replicate(
+            make_batches(1, 10, 128),
+            replicate_options(consistency_level::quorum_ack));
+          ASSERT_TRUE_CORO(result.has_value());
+      });
+
+    co_await ss::sleep(1s);
+    auto result = co_await leader_node.raft()->replicate(
+      make_batches(1, 10, 128),
+      replicate_options(consistency_level::quorum_ack));
+    ASSERT_TRUE_CORO(result.has_value());
+
+    co_await wait_for_committed_offset(leader_node.raft()->dirty_offset(), 10s);
+    co_await assert_logs_equal();
+}
+
+/**
+ * With follower flushes batched into shard-wide epochs, quorum_ack requests
+ * are still acknowledged only once followers flushed them.
+ */
+TEST_F_CORO(raft_fixture, validate_replication_with_coalesced_flushes) {
+    config::shard_local_cfg().raft_coalesce_follower_flushes.set_value(true);
+    auto reset = ss::defer([] {
+        config::shard_local_cfg().raft_coalesce_follower_flushes.reset();
+    });
+    co_await create_simple_group(3);
+    auto leader = co_await wait_for_leader(10s);
+    auto& leader_node = node(leader);
+
+    co_await ss::parallel_for_each(
+      boost::irange(20), [this, &leader_node](int) -> ss::future<> {
+          auto result = co_await leader_node.raft()->replicate(
+            make_batches(5, 10, 128),
+            replicate_options(consistency_level::quorum_ack));
+          ASSERT_TRUE_CORO(result.has_value());
+      });
+
+    const auto dirty = leader_node.raft()->dirty_offset();
+    co_await wait_for_committed_offset(dirty, 10s);
+    co_await tests::cooperative_spin_wait_with_timeout(10s, [this, dirty] {
+        return std::all_of(
+          nodes().begin(), nodes().end(), [dirty](const auto& entry) {
+              return entry.second->raft()->flushed_offset() >= dirty;
+          });
+    });
+    co_await assert_logs_equal();
+}
+
+/**
+ * A leader holding a lease answers linearizable barriers with its commit
+ * index, and the lease expires when followers stop acknowledging requests.
+ */
+TEST_F_CORO(raft_fixture, validate_leader_lease) {
+    config::shard_local_cfg().raft_enable_leader_lease.set_value(true);
+    auto reset = ss::defer(
+      [] { config::shard_local_cfg().raft_enable_leader_lease.reset(); });
+    co_await create_simple_group(3);
+    auto leader = co_await wait_for_leader(10s);
+    auto& leader_node = node(leader);
+
+    auto result = co_await leader_node.raft()->replicate(
+      make_batches({{"k_1", "v_1"}}),
+      replicate_options(consistency_level::quorum_ack));
+    ASSERT_TRUE_CORO(result.has_value());
+
+    co_await tests::cooperative_spin_wait_with_timeout(
+      5s, [&leader_node] { return leader_node.raft()->has_leader_lease(); });
+    auto barrier = co_await leader_node.raft()->linearizable_barrier();
+    ASSERT_TRUE_CORO(barrier.has_value());
+    ASSERT_EQ_CORO(barrier.value(), leader_node.raft()->committed_offset());
+
+    leader_node.on_dispatch([](raft::msg_type t) {
+        if (
+          t == raft::msg_type::append_entries
+          || t == raft::msg_type::heartbeat
+          || t == raft::msg_type::heartbeat_v2) {
+            return ss::sleep(2s);
+        }
+        return ss::now();
+    });
+    co_await tests::cooperative_spin_wait_with_timeout(
+      5s, [&leader_node] { return !leader_node.raft()->has_leader_lease(); });
+}
+
 TEST_F_CORO(raft_fixture, validate_recovery) {
     co_await create_simple_group(5);
     auto leader = co_await wait_for_leader(10s);
@@ -104,6 +248,46 @@ TEST_F_CORO(raft_fixture, validate_recovery) {
     co_await assert_logs_equal();
 }
 
+TEST_F_CORO(raft_fixture, validate_follower_catchup_offset) {
+    config::shard_local_cfg().raft_enable_follower_catchup_from_cloud.set_value(
+      true);
+    auto reset = ss::defer([] {
+        config::shard_local_cfg()
+          .raft_enable_follower_catchup_from_cloud.reset();
+    });
+    co_await create_simple_group(3);
+    auto leader = co_await wait_for_leader(10s);
+    const auto ids = all_ids();
+    auto follower = *std::find_if(
+      ids.begin(), ids.end(), [leader](model::node_id id) {
+          return id != leader;
+      });
+
+    // the follower comes back with an empty log
+    co_await stop_node(follower, remove_data_dir::yes);
+    leader = co_await wait_for_leader(10s);
+    auto& leader_node = node(leader);
+    for (int i = 0; i < 20; ++i) {
+        auto result = co_await leader_node.raft()->replicate(
+          make_batches(1, 10, 128),
+          replicate_options(consistency_level::quorum_ack));
+        ASSERT_TRUE_CORO(result.has_value());
+    }
+    const auto catchup_offset = model::offset(
+      leader_node.raft()->committed_offset()() - 5);
+    leader_node.raft()->set_follower_catchup_offset_provider(
+      [catchup_offset] { return catchup_offset; });
+
+    auto& new_node = add_node(follower, model::revision_id(0));
+    co_await new_node.init_and_start(all_vnodes());
+    co_await wait_for_committed_offset(
+      leader_node.raft()->committed_offset(), 10s);
+
+    // the log before the catch up offset was skipped
+    ASSERT_EQ_CORO(new_node.raft()->start_offset(), catchup_offset);
+    co_await assert_logs_equal(catchup_offset);
+}
+
 TEST_F_CORO(raft_fixture, validate_adding_nodes_to_cluster) {
     co_await create_simple_group(1);
     // wait for leader
@@ -167,6 +167,7 @@ public:
      * Called when a local snapshot is taken
      */
     ss::future<stm_snapshot> take_local_snapshot() final {
+        ++local_snapshots_taken;
         co_return stm_snapshot::create(
           0, last_applied_offset(), serde::to_iobuf(state));
     };
@@ -265,6 +266,7 @@ public:
     }
 
     kv_state state;
+    size_t local_snapshots_taken = 0;
     raft_node_instance& raft_node;
 };
 
@@ -549,3 +551,25 @@ TEST_F_CORO(persisted_stm_test_fixture, test_raft_and_local_snapshot) {
         ASSERT_EQ_CORO(stm->state, expected);
     }
 }
+
+TEST_F_CORO(persisted_stm_test_fixture, test_background_snapshots_coalesced) {
+    co_await initialize_state_machines();
+    kv_state expected;
+    auto ops = random_operations(200);
+    for (auto batch : ops) {
+        co_await apply_operations(expected, std::move(batch));
+    }
+    co_await wait_for_apply();
+
+    for (auto& [_, stm] : node_stms) {
+        const auto taken = stm->local_snapshots_taken;
+        for (int i = 0; i < 10; ++i) {
+            stm->write_local_snapshot_in_background();
+        }
+        // queued after the background snapshots
+        co_await stm->write_local_snapshot();
+        // the background requests resulted in a single snapshot of the
+        // current state, the explicit one is always taken
+        ASSERT_EQ_CORO(stm->local_snapshots_taken - taken, 2);
+    }
+}
@@ -375,6 +375,8 @@ raft_node_instance::raft_node_instance(
   })
   , _recovery_scheduler(
       config::mock_binding<size_t>(64), config::mock_binding(10ms))
+  , _flush_batcher(
+      config::shard_local_cfg().raft_coalesce_follower_flushes.bind())
   , _leader_clb(std::move(leader_update_clb)) {
     config::shard_local_cfg().disable_metrics.set_value(true);
 }
@@ -401,6 +403,8 @@ raft_node_instance::raft_node_instance(
   })
   , _recovery_scheduler(
       config::mock_binding<size_t>(64), config::mock_binding(10ms))
+  , _flush_batcher(
+      config::shard_local_cfg().raft_coalesce_follower_flushes.bind())
   , _leader_clb(std::move(leader_update_clb)) {
     config::shard_local_cfg().disable_metrics.set_value(true);
 }
@@ -451,6 +455,7 @@ raft_node_instance::initialise(std::vector<raft::vnode> initial_nodes) {
       _recovery_throttle.local(),
       _recovery_mem_quota,
       _recovery_scheduler,
+      _flush_batcher,
       _features.local());
     co_await _hb_manager->register_group(_raft);
 }
@@ -476,6 +481,8 @@ ss::future<> raft_node_instance::stop() {
         co_await _protocol->stop();
         vlog(_logger.debug, "stopping raft");
         co_await _raft->stop();
+        vlog(_logger.debug, "stopping flush batcher");
+        co_await _flush_batcher.stop();
         vlog(_logger.debug, "stopping recovery throttle");
         co_await _recovery_throttle.stop();
         vlog(_logger.debug, "stopping log");
@@ -242,6 +242,7 @@ private:
     ss::sharded<coordinated_recovery_throttle> _recovery_throttle;
     recovery_memory_quota _recovery_mem_quota;
     recovery_scheduler _recovery_scheduler;
+    follower_flush_batcher _flush_batcher;
     std::unique_ptr<heartbeat_manager> _hb_manager;
     leader_update_clb_t _leader_clb;
     ss::lw_shared_ptr<consensus> _raft;
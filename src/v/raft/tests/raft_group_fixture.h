@@ -183,6 +183,7 @@ struct raft_node {
           recovery_throttle.local(),
           recovery_mem_quota,
           recovery_scheduler.local(),
+          flush_batcher,
           feature_table.local(),
           std::nullopt);
     }
@@ -353,6 +354,7 @@ struct raft_node {
     ss::sharded<storage::api> storage;
     ss::sharded<raft::coordinated_recovery_throttle> recovery_throttle;
     ss::sharded<raft::recovery_scheduler> recovery_scheduler;
+    raft::follower_flush_batcher flush_batcher{config::mock_binding(false)};
     ss::shared_ptr<storage::log> log;
     ss::sharded<ss::abort_source> as_service;
     ss::sharded<rpc::connection_cache> cache;
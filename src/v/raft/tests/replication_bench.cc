@@ -0,0 +1,185 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "base/units.h"
+#include "base/vassert.h"
+#include "base/vlog.h"
+#include "model/fundamental.h"
+#include "model/record_batch_reader.h"
+#include "raft/tests/raft_fixture.h"
+#include "raft/types.h"
+#include "utils/hdr_hist.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/sleep.hh>
+#include <seastar/coroutine/parallel_for_each.hh>
+#include <seastar/testing/perf_tests.hh>
+#include <seastar/util/log.hh>
+
+#include <boost/range/irange.hpp>
+
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+ss::logger benchlog("raft-replication-bench");
+
+/*
+ * Each run replicates about this much data, so that runs with different
+ * batch sizes are comparable.
+ */
+constexpr size_t bytes_per_run = 16_MiB;
+// number of replicate requests the leader is kept busy with
+constexpr size_t concurrency = 16;
+
+/*
+ * A three replica group on top of raft_fixture. Requests are exchanged
+ * through the fixture's in memory protocol, which serializes them the same
+ * way the rpc layer does.
+ */
+struct replication_bench : raft::raft_fixture {
+    replication_bench() {
+        SetUpAsync().get();
+        create_simple_group(3).get();
+        wait_for_leader(10s).get();
+    }
+
+    replication_bench(const replication_bench&) = delete;
+    replication_bench& operator=(const replication_bench&) = delete;
+    replication_bench(replication_bench&&) = delete;
+    replication_bench& operator=(replication_bench&&) = delete;
+
+    ~replication_bench() override { TearDownAsync().get(); }
+
+    // not running as a gtest test
+    void TestBody() override {}
+
+    /// Batches of a single record of \p batch_size bytes.
+    ss::future<ss::circular_buffer<model::record_batch>>
+    make_batches(size_t count, size_t batch_size) {
+        return model::consume_reader_to_memory(
+          raft_fixture::make_batches(count, 1, batch_size), model::no_timeout);
+    }
+
+    static ss::future<> replicate(
+      raft::consensus& raft,
+      model::record_batch batch,
+      raft::consistency_level level) {
+        auto result = co_await raft.replicate(
+          model::make_memory_record_batch_reader(std::move(batch)),
+          raft::replicate_options(level));
+        vassert(result.has_value(), "replicate failed: {}", result.error());
+    }
+
+    /*
+     * Replicate bytes_per_run in batches of \p batch_size bytes, keeping
+     * `concurrency` requests in flight, and report the replicate latency.
+     */
+    ss::future<size_t>
+    replicate_bench(size_t batch_size, raft::consistency_level level) {
+        const size_t per_fiber = bytes_per_run / batch_size / concurrency;
+        auto leader_id = co_await wait_for_leader(10s);
+        auto raft = node(leader_id).raft();
+        std::vector<ss::circular_buffer<model::record_batch>> batches;
+        for (size_t i = 0; i < concurrency; ++i) {
+            batches.push_back(co_await make_batches(per_fiber, batch_size));
+        }
+        hdr_hist latency;
+
+        perf_tests::start_measuring_time();
+        co_await ss::coroutine::parallel_for_each(
+          boost::irange<size_t>(0, concurrency),
+          [raft, level, &batches, &latency](size_t i) -> ss::future<> {
+              for (auto& b : batches[i]) {
+                  auto m = latency.auto_measure();
+                  co_await replicate(*raft, std::move(b), level);
+              }
+          });
+        perf_tests::stop_measuring_time();
+
+        vlog(
+          benchlog.info,
+          "{} byte batches, {}: latency p50: {}us, p99: {}us, p999: {}us",
+          batch_size,
+          level,
+          latency.get_value_at(50.0),
+          latency.get_value_at(99.0),
+          latency.get_value_at(99.9));
+        // do not let the replication of this run overlap with next one
+        co_await wait_for_committed_offset(raft->dirty_offset(), 30s);
+        co_return per_fiber * concurrency;
+    }
+
+    /*
+     * Replace one of the followers with an empty replica and measure the
+     * time it takes to recover bytes_per_run worth of batches of
+     * \p batch_size bytes.
+     */
+    ss::future<size_t> recovery_bench(size_t batch_size) {
+        const size_t count = bytes_per_run / batch_size;
+        auto leader_id = co_await wait_for_leader(10s);
+        auto raft = node(leader_id).raft();
+        for (auto& b : co_await make_batches(count, batch_size)) {
+            co_await replicate(
+              *raft, std::move(b), raft::consistency_level::quorum_ack);
+        }
+        const auto target = raft->dirty_offset();
+
+        model::node_id follower_id;
+        for (auto id : all_ids()) {
+            if (id != leader_id) {
+                follower_id = id;
+                break;
+            }
+        }
+        co_await stop_node(follower_id, remove_data_dir::yes);
+        auto& follower = add_node(follower_id, model::revision_id{0});
+
+        perf_tests::start_measuring_time();
+        co_await follower.init_and_start(all_vnodes());
+        while (follower.raft()->dirty_offset() < target) {
+            co_await ss::sleep(1ms);
+        }
+        perf_tests::stop_measuring_time();
+        co_return count;
+    }
+};
+
+} // namespace
+
+PERF_TEST_C(replication_bench, replicate_1KiB_quorum_ack) {
+    co_return co_await replicate_bench(
+      1_KiB, raft::consistency_level::quorum_ack);
+}
+PERF_TEST_C(replication_bench, replicate_16KiB_quorum_ack) {
+    co_return co_await replicate_bench(
+      16_KiB, raft::consistency_level::quorum_ack);
+}
+PERF_TEST_C(replication_bench, replicate_128KiB_quorum_ack) {
+    co_return co_await replicate_bench(
+      128_KiB, raft::consistency_level::quorum_ack);
+}
+PERF_TEST_C(replication_bench, replicate_1KiB_leader_ack) {
+    co_return co_await replicate_bench(
+      1_KiB, raft::consistency_level::leader_ack);
+}
+PERF_TEST_C(replication_bench, replicate_16KiB_leader_ack) {
+    co_return co_await replicate_bench(
+      16_KiB, raft::consistency_level::leader_ack);
+}
+PERF_TEST_C(replication_bench, recovery_16KiB) {
+    co_return co_await recovery_bench(16_KiB);
+}
+PERF_TEST_C(replication_bench, recovery_128KiB) {
+    co_return co_await recovery_bench(128_KiB);
+}
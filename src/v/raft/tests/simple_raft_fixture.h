@@ -71,7 +71,8 @@ struct simple_raft_fixture {
         _producer_state_manager
           .start(
             config::mock_binding(std::numeric_limits<uint64_t>::max()),
-            std::chrono::milliseconds::max())
+            std::chrono::milliseconds::max(),
+            config::mock_binding<size_t>(0))
           .get();
         _producer_state_manager
           .invoke_on_all(
@@ -99,7 +100,8 @@ struct simple_raft_fixture {
                   .flush_timer_interval_ms = config::mock_binding(100ms),
                   .write_caching = config::mock_binding(
                     model::write_caching_mode::off),
-                  .write_caching_flush_ms = config::mock_binding(100ms)};
+                  .write_caching_flush_ms = config::mock_binding(100ms),
+                  .coalesce_follower_flushes = config::mock_binding(false)};
             },
             [] {
                 return raft::recovery_memory_quota::configuration{
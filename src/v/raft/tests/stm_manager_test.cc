@@ -7,8 +7,12 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "config/configuration.h"
 #include "raft/tests/stm_test_fixture.h"
 
+#include <seastar/core/condition-variable.hh>
+#include <seastar/util/defer.hh>
+
 using namespace raft;
 
 inline ss::logger logger("stm-test-logger");
@@ -75,6 +79,75 @@ struct local_snapshot_stm : public simple_kv {
     };
 };
 
+/**
+ * Does not apply any batch until released.
+ */
+struct blocking_kv : public simple_kv {
+    static constexpr std::string_view name = "blocking_kv";
+    explicit blocking_kv(raft_node_instance& rn)
+      : simple_kv(rn) {}
+
+    ss::future<> apply(const model::record_batch& batch) override {
+        co_await _cv.wait([this] { return _released; });
+        co_await simple_kv::apply(batch);
+    }
+
+    void release() {
+        _released = true;
+        _cv.broadcast();
+    }
+
+    bool _released = false;
+    ss::condition_variable _cv;
+};
+/**
+ * Does not finish starting until released.
+ */
+struct blocking_start_kv : public simple_kv {
+    static constexpr std::string_view name = "blocking_start_kv";
+    explicit blocking_start_kv(raft_node_instance& rn)
+      : simple_kv(rn) {}
+
+    ss::future<> start() override {
+        co_await _cv.wait([this] { return _released; });
+        _started = true;
+    }
+
+    ss::future<> apply(const model::record_batch& batch) override {
+        vassert(_started, "batch {} applied before start", batch.header());
+        co_await simple_kv::apply(batch);
+    }
+
+    void release() {
+        _released = true;
+        _cv.broadcast();
+    }
+
+    bool _released = false;
+    bool _started = false;
+    ss::condition_variable _cv;
+};
+/**
+ * Only consumes data batches.
+ */
+struct data_kv : public simple_kv {
+    static constexpr std::string_view name = "data_kv";
+    explicit data_kv(raft_node_instance& rn)
+      : simple_kv(rn) {}
+
+    bool consumes(model::record_batch_type type) const override {
+        return type == model::record_batch_type::raft_data;
+    }
+
+    ss::future<> apply(const model::record_batch& batch) override {
+        vassert(
+          batch.header().type == model::record_batch_type::raft_data,
+          "batch {} is not expected to be applied",
+          batch.header());
+        co_await simple_kv::apply(batch);
+    }
+};
+
 TEST_F_CORO(state_machine_fixture, test_basic_apply) {
     /**
      * Create 3 replicas group with simple_kv STM
@@ -351,3 +424,86 @@ TEST_F_CORO(
 
     ASSERT_EQ_CORO(new_stm->state, partial_expected_state);
 }
+
+TEST_F_CORO(state_machine_fixture, test_independent_apply) {
+    config::shard_local_cfg().raft_enable_independent_stm_apply.set_value(
+      true);
+    auto reset = ss::defer([] {
+        config::shard_local_cfg().raft_enable_independent_stm_apply.reset();
+    });
+    create_nodes();
+    std::vector<ss::shared_ptr<data_kv>> stms;
+    std::vector<ss::shared_ptr<blocking_kv>> blocked_stms;
+
+    for (auto& [id, node] : nodes()) {
+        raft::state_machine_manager_builder builder;
+        stms.push_back(builder.create_stm<data_kv>(*node));
+        blocked_stms.push_back(builder.create_stm<blocking_kv>(*node));
+        co_await node->init_and_start(all_vnodes(), std::move(builder));
+    }
+    auto release = ss::defer([&blocked_stms] {
+        for (auto& stm : blocked_stms) {
+            stm->release();
+        }
+    });
+
+    auto expected = co_await build_random_state(1000);
+    auto committed_offset = co_await with_leader(
+      10s,
+      [](raft_node_instance& node) { return node.raft()->committed_offset(); });
+
+    // a blocked state machine does not hold back the others
+    for (auto& stm : stms) {
+        co_await stm->wait(committed_offset, default_timeout());
+        ASSERT_EQ_CORO(stm->state, expected);
+    }
+    for (auto& stm : blocked_stms) {
+        ASSERT_TRUE_CORO(stm->state.empty());
+        stm->release();
+    }
+
+    co_await wait_for_apply();
+    for (auto& stm : blocked_stms) {
+        ASSERT_EQ_CORO(stm->state, expected);
+    }
+}
+
+TEST_F_CORO(state_machine_fixture, test_deferred_start) {
+    create_nodes();
+    std::vector<ss::shared_ptr<simple_kv>> stms;
+    std::vector<ss::shared_ptr<blocking_start_kv>> deferred_stms;
+
+    for (auto& [id, node] : nodes()) {
+        raft::state_machine_manager_builder builder;
+        stms.push_back(builder.create_stm<simple_kv>(*node));
+        deferred_stms.push_back(
+          builder.create_deferred_stm<blocking_start_kv>(*node));
+        // the partition starts without waiting for the deferred stm
+        co_await node->init_and_start(all_vnodes(), std::move(builder));
+    }
+    auto release = ss::defer([&deferred_stms] {
+        for (auto& stm : deferred_stms) {
+            stm->release();
+        }
+    });
+
+    auto expected = co_await build_random_state(1000);
+    auto committed_offset = co_await with_leader(
+      10s,
+      [](raft_node_instance& node) { return node.raft()->committed_offset(); });
+
+    for (auto& stm : stms) {
+        co_await stm->wait(committed_offset, default_timeout());
+        ASSERT_EQ_CORO(stm->state, expected);
+    }
+    for (auto& stm : deferred_stms) {
+        ASSERT_TRUE_CORO(stm->state.empty());
+        stm->release();
+    }
+
+    // once started the deferred stm catches up
+    co_await wait_for_apply();
+    for (auto& stm : deferred_stms) {
+        ASSERT_EQ_CORO(stm->state, expected);
+    }
+}
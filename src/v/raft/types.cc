@@ -11,6 +11,7 @@
 
 #include "base/vassert.h"
 #include "base/vlog.h"
+#include "model/adl_serde.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
 #include "model/record.h"
@@ -145,6 +146,9 @@ void follower_index_metadata::reset() {
     last_sent_seq = follower_req_seq{0};
     last_received_seq = follower_req_seq{0};
     last_successful_received_seq = follower_req_seq{0};
+    lease_probe_seq = follower_req_seq{0};
+    lease_probe_timestamp = {};
+    lease_timestamp = {};
     suppress_heartbeats_count = 0;
     last_sent_protocol_meta.reset();
 }
@@ -639,9 +643,19 @@ ss::future<> append_entries_request::serde_async_write(iobuf& dst) {
     class streaming_writer {
     public:
         ss::future<ss::stop_iteration> operator()(model::record_batch b) {
-            co_await reflection::async_adl<model::record_batch>{}.to(
-              _out, std::move(b));
+            /**
+             * Records are sent in their encoded form, the way the adl
+             * format carries compressed batches, rather than one by one.
+             * Their encoding is the same as in the log, so the receiver
+             * does not decode and then encode them again, it only shares
+             * the batch body out of the request buffer.
+             */
+            reflection::serialize(
+              _out,
+              reflection::batch_header{.bhdr = b.header(), .is_compressed = 1},
+              std::move(b).release_data());
             ++_count;
+            co_await ss::coroutine::maybe_yield();
             co_return ss::stop_iteration::no;
         }
         iobuf end_of_stream() {
@@ -93,7 +93,14 @@ struct follower_index_metadata {
         return suppress_heartbeats_count > 0;
     }
 
-    follower_req_seq next_follower_sequence() { return ++last_sent_seq; }
+    follower_req_seq next_follower_sequence() {
+        ++last_sent_seq;
+        if (lease_probe_seq <= last_successful_received_seq) {
+            lease_probe_seq = last_sent_seq;
+            lease_probe_timestamp = clock_type::now();
+        }
+        return last_sent_seq;
+    }
 
     static bool is_first_request(follower_req_seq seq) { return seq() == 1; }
 
@@ -168,6 +175,14 @@ struct follower_index_metadata {
     follower_req_seq last_received_seq{0};
     // sequence number of last received successfull append entries request
     follower_req_seq last_successful_received_seq{0};
+    // Leader lease tracking. Requests are sampled by sequence: the probe is
+    // the first request sent after the previous probe was acknowledged. Once
+    // a request with a sequence at or after the probe is acknowledged the
+    // follower is known to have heard from the leader after the probe was
+    // created, which is recorded in `lease_timestamp`.
+    follower_req_seq lease_probe_seq{0};
+    clock_type::time_point lease_probe_timestamp;
+    clock_type::time_point lease_timestamp;
     bool is_learner = true;
     bool is_recovering = false;
 
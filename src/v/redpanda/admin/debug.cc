@@ -20,14 +20,21 @@
 #include "config/configuration.h"
 #include "config/node_config.h"
 #include "json/validator.h"
+#include "kafka/server/compression_advisor.h"
+#include "kafka/server/group_manager.h"
+#include "kafka/server/group_router.h"
+#include "kafka/server/server.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
 #include "redpanda/admin/api-doc/debug.json.hh"
 #include "redpanda/admin/server.h"
 #include "redpanda/admin/util.h"
+#include "resource_mgmt/memory_accounting.h"
 #include "serde/rw/rw.h"
 #include "storage/kvstore.h"
+#include "utils/file_io.h"
 
+#include <seastar/core/sleep.hh>
 #include <seastar/core/sstring.hh>
 #include <seastar/json/json_elements.hh>
 
@@ -391,6 +398,15 @@ void admin_server::register_debug_routes() {
           return sampled_memory_profile_handler(std::move(req));
       });
 
+    register_route_raw_async<superuser>(
+      ss::httpd::debug_json::sampled_memory_profile_pprof,
+      [this](
+        std::unique_ptr<ss::http::request> req,
+        std::unique_ptr<ss::http::reply> rep) {
+          return sampled_memory_profile_pprof_handler(
+            std::move(req), std::move(rep));
+      });
+
     register_route<user>(
       ss::httpd::debug_json::restart_service,
       [this](std::unique_ptr<ss::http::request> req) {
@@ -410,6 +426,37 @@ void admin_server::register_debug_routes() {
         -> ss::future<ss::json::json_return_type> {
           return cpu_profile_handler(std::move(req));
       });
+    register_route_raw_async<superuser>(
+      ss::httpd::debug_json::cpu_profile_collapsed,
+      [this](
+        std::unique_ptr<ss::http::request> req,
+        std::unique_ptr<ss::http::reply> rep) {
+          return cpu_profile_collapsed_handler(std::move(req), std::move(rep));
+      });
+    register_route<user>(
+      ss::httpd::debug_json::get_kafka_slow_requests,
+      [this](std::unique_ptr<ss::http::request> req)
+        -> ss::future<ss::json::json_return_type> {
+          return kafka_slow_requests_handler(std::move(req));
+      });
+    register_route<user>(
+      ss::httpd::debug_json::get_consumer_lag,
+      [this](std::unique_ptr<ss::http::request> req)
+        -> ss::future<ss::json::json_return_type> {
+          return consumer_lag_handler(std::move(req));
+      });
+    register_route<user>(
+      ss::httpd::debug_json::get_memory_accounting,
+      [this](std::unique_ptr<ss::http::request> req)
+        -> ss::future<ss::json::json_return_type> {
+          return memory_accounting_handler(std::move(req));
+      });
+    register_route<user>(
+      ss::httpd::debug_json::get_compression_advice,
+      [this](std::unique_ptr<ss::http::request> req)
+        -> ss::future<ss::json::json_return_type> {
+          return compression_advice_handler(std::move(req));
+      });
     register_route<superuser>(
       ss::httpd::debug_json::set_storage_failure_injection_enabled,
       [](std::unique_ptr<ss::http::request> req) {
@@ -481,12 +528,10 @@ void admin_server::register_debug_routes() {
 
 using admin::apply_validator;
 
-ss::future<ss::json::json_return_type>
-admin_server::cpu_profile_handler(std::unique_ptr<ss::http::request> req) {
-    vlog(adminlog.info, "Request to sampled cpu profile");
-
+ss::future<std::vector<resources::cpu_profiler::shard_samples>>
+admin_server::collect_cpu_profile(const ss::http::request& req) {
     std::optional<size_t> shard_id;
-    if (auto e = req->get_query_param("shard"); !e.empty()) {
+    if (auto e = req.get_query_param("shard"); !e.empty()) {
         try {
             shard_id = boost::lexical_cast<size_t>(e);
         } catch (const boost::bad_lexical_cast&) {
@@ -505,7 +550,7 @@ admin_server::cpu_profile_handler(std::unique_ptr<ss::http::request> req) {
     }
 
     std::optional<std::chrono::milliseconds> wait_ms;
-    if (auto e = req->get_query_param("wait_ms"); !e.empty()) {
+    if (auto e = req.get_query_param("wait_ms"); !e.empty()) {
         try {
             wait_ms = std::chrono::milliseconds(
               boost::lexical_cast<uint64_t>(e));
@@ -522,13 +567,24 @@ admin_server::cpu_profile_handler(std::unique_ptr<ss::http::request> req) {
         }
     }
 
-    std::vector<resources::cpu_profiler::shard_samples> profiles;
+    std::optional<ss::sstring> scheduling_group;
+    if (auto e = req.get_query_param("scheduling_group"); !e.empty()) {
+        scheduling_group = std::move(e);
+    }
+
     if (!wait_ms) {
-        profiles = co_await _cpu_profiler.local().results(shard_id);
-    } else {
-        profiles = co_await _cpu_profiler.local().collect_results_for_period(
-          *wait_ms, shard_id);
+        co_return co_await _cpu_profiler.local().results(
+          shard_id, std::nullopt, std::move(scheduling_group));
     }
+    co_return co_await _cpu_profiler.local().collect_results_for_period(
+      *wait_ms, shard_id, std::move(scheduling_group));
+}
+
+ss::future<ss::json::json_return_type>
+admin_server::cpu_profile_handler(std::unique_ptr<ss::http::request> req) {
+    vlog(adminlog.info, "Request to sampled cpu profile");
+
+    auto profiles = co_await collect_cpu_profile(*req);
 
     std::vector<ss::httpd::debug_json::cpu_profile_shard_samples> response{
       profiles.size()};
@@ -540,6 +596,7 @@ admin_server::cpu_profile_handler(std::unique_ptr<ss::http::request> req) {
             ss::httpd::debug_json::cpu_profile_sample s;
             s.occurrences = sample.occurrences;
             s.user_backtrace = sample.user_backtrace;
+            s.scheduling_group = sample.scheduling_group;
 
             response[i].samples.push(s);
         }
@@ -549,6 +606,164 @@ admin_server::cpu_profile_handler(std::unique_ptr<ss::http::request> req) {
       std::move(response));
 }
 
+ss::future<std::unique_ptr<ss::http::reply>>
+admin_server::cpu_profile_collapsed_handler(
+  std::unique_ptr<ss::http::request> req,
+  std::unique_ptr<ss::http::reply> rep) {
+    vlog(adminlog.info, "Request to sampled cpu profile in collapsed format");
+
+    auto profiles = co_await collect_cpu_profile(*req);
+    rep->write_body(
+      "txt", resources::cpu_profiler::to_collapsed_stacks(profiles));
+    co_return std::move(rep);
+}
+
+ss::future<ss::json::json_return_type>
+admin_server::kafka_slow_requests_handler(std::unique_ptr<ss::http::request>) {
+    using namespace std::chrono;
+    auto per_shard = co_await _kafka_server.map([](kafka::server& s) {
+        return s.request_traces().slow_requests();
+    });
+
+    std::vector<ss::httpd::debug_json::kafka_traced_request> response;
+    for (ss::shard_id shard = 0; shard < per_shard.size(); ++shard) {
+        for (const auto& trace : per_shard[shard]) {
+            ss::httpd::debug_json::kafka_traced_request r;
+            r.shard = shard;
+            r.api_key = trace.key()();
+            r.correlation_id = trace.correlation()();
+            r.client_id = trace.client_id();
+            r.started_at = duration_cast<milliseconds>(
+                             trace.started_at().time_since_epoch())
+                             .count();
+            r.duration_us
+              = duration_cast<microseconds>(trace.elapsed()).count();
+            const auto& durations = trace.durations();
+            for (size_t i = 0; i < durations.size(); ++i) {
+                if (durations[i] == kafka::request_trace::clock::duration{}) {
+                    continue;
+                }
+                ss::httpd::debug_json::kafka_request_stage stage;
+                stage.stage = ss::sstring(
+                  kafka::to_string_view(static_cast<kafka::request_stage>(i)));
+                stage.duration_us
+                  = duration_cast<microseconds>(durations[i]).count();
+                r.stages.push(stage);
+            }
+            response.push_back(std::move(r));
+        }
+    }
+
+    co_return ss::json::json_return_type(std::move(response));
+}
+
+ss::future<ss::json::json_return_type>
+admin_server::memory_accounting_handler(std::unique_ptr<ss::http::request>) {
+    using namespace resources;
+    std::vector<ss::httpd::debug_json::subsystem_memory> response;
+    response.reserve(ss::smp::count * all_mem_subsystems.size());
+    for (auto shard : ss::smp::all_cpus()) {
+        auto per_subsystem = co_await ss::smp::submit_to(shard, [] {
+            std::array<int64_t, all_mem_subsystems.size()> bytes{};
+            for (size_t i = 0; i < all_mem_subsystems.size(); ++i) {
+                bytes[i] = memory_accounting::local().consumption(
+                  all_mem_subsystems[i]);
+            }
+            return bytes;
+        });
+        for (size_t i = 0; i < all_mem_subsystems.size(); ++i) {
+            ss::httpd::debug_json::subsystem_memory m;
+            m.shard = shard;
+            m.subsystem = ss::sstring(to_string_view(all_mem_subsystems[i]));
+            m.bytes = per_subsystem[i];
+            response.push_back(std::move(m));
+        }
+    }
+    co_return ss::json::json_return_type(std::move(response));
+}
+
+ss::future<ss::json::json_return_type>
+admin_server::compression_advice_handler(std::unique_ptr<ss::http::request>) {
+    using namespace std::chrono;
+    using advisor = kafka::compression_advisor;
+    if (!config::shard_local_cfg().kafka_compression_advisor_interval_ms()) {
+        throw ss::httpd::bad_request_exception(
+          "Compression advisor is disabled, see "
+          "kafka_compression_advisor_interval_ms");
+    }
+    // the measures of the shards add up, each has sampled the batches
+    // produced through it
+    absl::flat_hash_map<model::topic, advisor::topic_advice> merged;
+    for (auto shard : ss::smp::all_cpus()) {
+        auto advice = co_await ss::smp::submit_to(shard, [] {
+            auto* a = advisor::local();
+            return a ? a->advice()
+                     : absl::flat_hash_map<
+                       model::topic,
+                       advisor::topic_advice>{};
+        });
+        for (auto& [topic, a] : advice) {
+            auto [it, inserted] = merged.try_emplace(topic, a);
+            if (inserted) {
+                continue;
+            }
+            it->second.samples += a.samples;
+            for (size_t i = 0; i < a.measures.size(); ++i) {
+                it->second.measures[i] += a.measures[i];
+            }
+        }
+    }
+
+    std::vector<ss::httpd::debug_json::topic_compression_advice> response;
+    response.reserve(merged.size());
+    for (const auto& [topic, a] : merged) {
+        ss::httpd::debug_json::topic_compression_advice r;
+        r.topic = topic();
+        r.samples = a.samples;
+        r.recommended = fmt::format("{}", advisor::recommend(a.measures));
+        for (const auto& m : a.measures) {
+            ss::httpd::debug_json::codec_measure cm;
+            cm.codec = fmt::format("{}", m.codec);
+            cm.uncompressed_bytes = m.uncompressed_bytes;
+            cm.compressed_bytes = m.compressed_bytes;
+            cm.compress_us
+              = duration_cast<microseconds>(m.compress_time).count();
+            cm.decompress_us
+              = duration_cast<microseconds>(m.decompress_time).count();
+            r.codecs.push(cm);
+        }
+        response.push_back(std::move(r));
+    }
+    co_return ss::json::json_return_type(std::move(response));
+}
+
+ss::future<ss::json::json_return_type>
+admin_server::consumer_lag_handler(std::unique_ptr<ss::http::request>) {
+    if (!config::shard_local_cfg().group_consumer_lag_refresh_ms()) {
+        throw ss::httpd::bad_request_exception(
+          "Consumer lag tracking is disabled, see "
+          "group_consumer_lag_refresh_ms");
+    }
+    auto per_shard = co_await _kafka_server.map([](kafka::server& s) {
+        return s.group_router().get_group_manager().local().consumer_lag();
+    });
+
+    std::vector<ss::httpd::debug_json::consumer_group_lag> response;
+    for (ss::shard_id shard = 0; shard < per_shard.size(); ++shard) {
+        for (const auto& [group, lag] : per_shard[shard]) {
+            ss::httpd::debug_json::consumer_group_lag r;
+            r.group = group();
+            r.shard = shard;
+            r.lag_sum = lag.total;
+            r.lag_max = lag.max;
+            r.unknown_partitions = lag.unknown_partitions;
+            response.push_back(std::move(r));
+        }
+    }
+
+    co_return ss::json::json_return_type(std::move(response));
+}
+
 ss::future<ss::json::json_return_type>
 admin_server::get_local_offsets_translated_handler(
   std::unique_ptr<ss::http::request> req) {
@@ -708,6 +923,56 @@ admin_server::sampled_memory_profile_handler(
       std::move(resp));
 }
 
+ss::future<std::unique_ptr<ss::http::reply>>
+admin_server::sampled_memory_profile_pprof_handler(
+  std::unique_ptr<ss::http::request> req,
+  std::unique_ptr<ss::http::reply> rep) {
+    vlog(adminlog.info, "Request to sampled memory profile in pprof format");
+
+    std::optional<size_t> shard_id;
+    if (auto e = req->get_query_param("shard"); !e.empty()) {
+        try {
+            shard_id = boost::lexical_cast<size_t>(e);
+        } catch (const boost::bad_lexical_cast&) {
+            throw ss::httpd::bad_param_exception(
+              fmt::format("Invalid parameter 'shard_id' value {{{}}}", e));
+        }
+        if (*shard_id >= ss::smp::count) {
+            throw ss::httpd::bad_param_exception(fmt::format(
+              "Shard id too high, max shard id is {}", ss::smp::count - 1));
+        }
+    }
+
+    static constexpr auto max_window = std::chrono::seconds(60);
+    std::optional<std::chrono::seconds> window;
+    if (auto e = req->get_query_param("seconds"); !e.empty()) {
+        try {
+            window = std::chrono::seconds(boost::lexical_cast<uint32_t>(e));
+        } catch (const boost::bad_lexical_cast&) {
+            throw ss::httpd::bad_param_exception(
+              fmt::format("Invalid parameter 'seconds' value {{{}}}", e));
+        }
+        if (*window > max_window) {
+            throw ss::httpd::bad_param_exception(fmt::format(
+              "Window too long, max is {} seconds", max_window.count()));
+        }
+    }
+
+    auto& sampling = _memory_sampling_service.local();
+    auto profile = co_await sampling.take_profile(shard_id);
+    if (window.has_value()) {
+        // the profile of the live set is cumulative, the growth over the
+        // window is what leaks or builds up
+        co_await ss::sleep(*window);
+        auto last = co_await sampling.take_profile(shard_id);
+        profile = last.growth_since(profile);
+    }
+
+    auto maps = co_await read_fully_to_string("/proc/self/maps");
+    rep->write_body("txt", profile.to_pprof(maps));
+    co_return std::move(rep);
+}
+
 ss::future<ss::json::json_return_type>
 admin_server::get_local_storage_usage_handler(
   std::unique_ptr<ss::http::request>) {
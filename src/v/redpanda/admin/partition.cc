@@ -860,13 +860,22 @@ admin_server::get_topic_partitions_handler(
     using partition_t = ss::httpd::partition_json::partition;
     fragmented_vector<partition_t> partitions;
     const auto& assignments = tp_md->get().get_assignments();
-    partitions.reserve(assignments.size());
+    auto page = admin::page::from_request(*req);
 
     const auto* disabled_set
       = _controller->get_topics_state().local().get_topic_disabled_set(tp_ns);
 
-    // Normal topic
+    // Normal topic, assignments are ordered by partition id. Only the
+    // partitions in the page are looked up, the reconciliation state of each
+    // is a request to the controller.
+    size_t index = 0;
     for (const auto& p_as : assignments) {
+        if (page.past_end(index)) {
+            break;
+        }
+        if (!page.contains(index++)) {
+            continue;
+        }
         partition_t p;
         p.ns = tp_ns.ns;
         p.topic = tp_ns.tp;
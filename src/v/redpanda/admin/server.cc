@@ -14,7 +14,10 @@
 #include "archival/ntp_archiver_service.h"
 #include "base/vlog.h"
 #include "cloud_storage/cache_service.h"
+#include "cloud_storage/materialized_resources.h"
 #include "cloud_storage/partition_manifest.h"
+#include "cloud_storage/read_cost_table.h"
+#include "cloud_storage/remote.h"
 #include "cloud_storage/remote_partition.h"
 #include "cloud_storage/spillover_manifest.h"
 #include "cluster/cloud_storage_size_reducer.h"
@@ -165,6 +168,7 @@ using namespace std::chrono_literals;
 
 using admin::apply_validator;
 using admin::get_boolean_query_param;
+using admin::get_integer_query_param;
 using admin::lw_shared_container;
 
 ss::logger adminlog{"admin_api_server"};
@@ -303,6 +307,7 @@ admin_server::admin_server(
   ss::sharded<storage::node>& storage_node,
   ss::sharded<memory_sampling>& memory_sampling_service,
   ss::sharded<cloud_storage::cache>& cloud_storage_cache,
+  ss::sharded<cloud_storage::remote>& cloud_storage_api,
   ss::sharded<resources::cpu_profiler>& cpu_profiler,
   ss::sharded<transform::service>* transform_service,
   ss::sharded<security::audit::audit_log_manager>& audit_mgr,
@@ -333,6 +338,7 @@ admin_server::admin_server(
   , _storage_node(storage_node)
   , _memory_sampling_service(memory_sampling_service)
   , _cloud_storage_cache(cloud_storage_cache)
+  , _cloud_storage_api(cloud_storage_api)
   , _cpu_profiler(cpu_profiler)
   , _transform_service(transform_service)
   , _audit_mgr(audit_mgr)
@@ -447,32 +453,6 @@ admin_server::parse_json_body(ss::http::request* req) {
     }
 }
 
-namespace {
-
-/**
- * Helper for requests with decimal_integer URL query parameters.
- *
- * Throws a bad_request exception if the parameter is present but not
- * an integer.
- */
-std::optional<uint64_t>
-get_integer_query_param(const ss::http::request& req, std::string_view name) {
-    auto key = ss::sstring(name);
-    if (!req.query_parameters.contains(key)) {
-        return std::nullopt;
-    }
-
-    const ss::sstring& str_param = req.query_parameters.at(key);
-    try {
-        return std::stoi(str_param);
-    } catch (const std::invalid_argument&) {
-        throw ss::httpd::bad_request_exception(
-          fmt::format("Parameter {} must be an integer", name));
-    }
-}
-
-} // namespace
-
 void admin_server::configure_metrics_route() {
     ss::prometheus::add_prometheus_routes(
       _server,
@@ -2808,6 +2788,12 @@ self_test_result_to_json(const cluster::self_test_result& str) {
     r.max_latency = str.max;
     r.rps = str.rps;
     r.bps = str.bps;
+    for (const auto& b : str.latency_histogram) {
+        ss::httpd::debug_json::self_test_latency_bucket bucket;
+        bucket.upper_bound = b.upper_bound;
+        bucket.count = b.count;
+        r.latency_histogram.push(bucket);
+    }
     return r;
 }
 } // namespace
@@ -3237,6 +3223,7 @@ admin_server::get_cluster_partitions_handler(
     }
 
     bool with_internal = get_boolean_query_param(*req, "with_internal");
+    auto page = admin::page::from_request(*req);
 
     const auto& topics_state = _controller->get_topics_state().local();
 
@@ -3261,7 +3248,12 @@ admin_server::get_cluster_partitions_handler(
     std::sort(topics.begin(), topics.end());
 
     ss::chunked_fifo<cluster_partition_info> partitions;
+    // Index in the listing of the first partition of the next topic
+    size_t index = 0;
     for (const auto& ns_tp : topics) {
+        if (page.past_end(index)) {
+            break;
+        }
         auto topic_it = topics_state.topics_map().find(ns_tp);
         if (topic_it == topics_state.topics_map().end()) {
             // probably got deleted while we were iterating.
@@ -3274,10 +3266,11 @@ admin_server::get_cluster_partitions_handler(
           topics_state.get_topic_disabled_set(ns_tp),
           disabled_filter);
 
-        std::move(
-          topic_partitions.begin(),
-          topic_partitions.end(),
-          std::back_inserter(partitions));
+        for (auto& p : topic_partitions) {
+            if (page.contains(index++)) {
+                partitions.push_back(std::move(p));
+            }
+        }
 
         co_await ss::coroutine::maybe_yield();
     }
@@ -3306,12 +3299,20 @@ admin_server::get_cluster_partitions_topic_handler(
           fmt::format("topic {} not found", ns_tp));
     }
 
-    auto partitions = topic2cluster_partitions(
+    auto topic_partitions = topic2cluster_partitions(
       ns_tp,
       topic_it->second.get_assignments(),
       topics_state.get_topic_disabled_set(ns_tp),
       disabled_filter);
 
+    auto page = admin::page::from_request(*req);
+    ss::chunked_fifo<cluster_partition_info> partitions;
+    for (size_t i = 0; i < topic_partitions.size() && !page.past_end(i); ++i) {
+        if (page.contains(i)) {
+            partitions.push_back(std::move(topic_partitions[i]));
+        }
+    }
+
     co_return ss::json::json_return_type(ss::json::stream_range_as_array(
       lw_shared_container{std::move(partitions)},
       [](const auto& p) { return p.to_json(); }));
@@ -4062,6 +4063,53 @@ admin_server::post_cloud_storage_cache_trim(
     co_return ss::json::json_return_type(ss::json::json_void());
 }
 
+ss::future<ss::json::json_return_type>
+admin_server::get_cloud_storage_read_costs(
+  std::unique_ptr<ss::http::request> req) {
+    if (!_cloud_storage_api.local_is_initialized()) {
+        throw ss::httpd::bad_request_exception(
+          "Cloud storage is not enabled on this node");
+    }
+    auto limit = get_integer_query_param(*req, "limit").value_or(
+      cloud_storage::ts_read_cost_table::default_capacity);
+
+    using entries_t = std::vector<cloud_storage::ts_read_cost_table::entry>;
+    auto entries = co_await _cloud_storage_api.map_reduce0(
+      [](cloud_storage::remote& api) {
+          auto& table = api.materialized().get_read_cost_table();
+          return table.top(table.size());
+      },
+      entries_t{},
+      [](entries_t acc, entries_t shard_entries) {
+          std::move(
+            shard_entries.begin(),
+            shard_entries.end(),
+            std::back_inserter(acc));
+          return acc;
+      });
+
+    // A partition moved between shards may have been read on both.
+    cloud_storage::ts_read_cost_table merged(entries.size());
+    for (const auto& e : entries) {
+        merged.add(e.key, e.cost);
+    }
+
+    std::vector<ss::httpd::shadow_indexing_json::cloud_storage_read_cost> res;
+    for (const auto& e : merged.top(limit)) {
+        ss::httpd::shadow_indexing_json::cloud_storage_read_cost r;
+        r.ns = e.key.ntp.ns();
+        r.topic = e.key.ntp.tp.topic();
+        r.partition = e.key.ntp.tp.partition();
+        r.client = e.key.client;
+        r.get_requests = e.cost.get_requests;
+        r.bytes_downloaded = e.cost.bytes_downloaded;
+        r.cache_hits = e.cost.cache_hits;
+        r.hydration_wait_ms = e.cost.hydration_wait.count();
+        res.push_back(std::move(r));
+    }
+    co_return ss::json::json_return_type(std::move(res));
+}
+
 ss::future<std::unique_ptr<ss::http::reply>> admin_server::get_manifest(
   std::unique_ptr<ss::http::request> req,
   std::unique_ptr<ss::http::reply> rep) {
@@ -4308,6 +4356,12 @@ void admin_server::register_shadow_indexing_routes() {
           return post_cloud_storage_cache_trim(std::move(req));
       });
 
+    register_route<user>(
+      ss::httpd::shadow_indexing_json::get_cloud_storage_read_costs,
+      [this](auto req) {
+          return get_cloud_storage_read_costs(std::move(req));
+      });
+
     register_route_raw_async<user>(
       ss::httpd::shadow_indexing_json::get_manifest,
       [this](
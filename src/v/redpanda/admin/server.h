@@ -87,6 +87,7 @@ public:
       ss::sharded<storage::node>&,
       ss::sharded<memory_sampling>&,
       ss::sharded<cloud_storage::cache>&,
+      ss::sharded<cloud_storage::remote>&,
       ss::sharded<resources::cpu_profiler>&,
       ss::sharded<transform::service>*,
       ss::sharded<security::audit::audit_log_manager>&,
@@ -566,6 +567,8 @@ private:
     delete_cloud_storage_lifecycle(std::unique_ptr<ss::http::request> req);
     ss::future<ss::json::json_return_type>
     post_cloud_storage_cache_trim(std::unique_ptr<ss::http::request> req);
+    ss::future<ss::json::json_return_type>
+    get_cloud_storage_read_costs(std::unique_ptr<ss::http::request> req);
     ss::future<std::unique_ptr<ss::http::reply>> get_manifest(
       std::unique_ptr<ss::http::request> req,
       std::unique_ptr<ss::http::reply> rep);
@@ -594,6 +597,18 @@ private:
     // Debug routes
     ss::future<ss::json::json_return_type>
       cpu_profile_handler(std::unique_ptr<ss::http::request>);
+    ss::future<std::unique_ptr<ss::http::reply>> cpu_profile_collapsed_handler(
+      std::unique_ptr<ss::http::request>, std::unique_ptr<ss::http::reply>);
+    ss::future<std::vector<resources::cpu_profiler::shard_samples>>
+    collect_cpu_profile(const ss::http::request&);
+    ss::future<ss::json::json_return_type>
+      kafka_slow_requests_handler(std::unique_ptr<ss::http::request>);
+    ss::future<ss::json::json_return_type>
+      consumer_lag_handler(std::unique_ptr<ss::http::request>);
+    ss::future<ss::json::json_return_type>
+      memory_accounting_handler(std::unique_ptr<ss::http::request>);
+    ss::future<ss::json::json_return_type>
+      compression_advice_handler(std::unique_ptr<ss::http::request>);
     ss::future<ss::json::json_return_type>
       get_local_offsets_translated_handler(std::unique_ptr<ss::http::request>);
     ss::future<ss::json::json_return_type>
@@ -602,6 +617,9 @@ private:
       restart_service_handler(std::unique_ptr<ss::http::request>);
     ss::future<ss::json::json_return_type>
       sampled_memory_profile_handler(std::unique_ptr<ss::http::request>);
+    ss::future<std::unique_ptr<ss::http::reply>>
+    sampled_memory_profile_pprof_handler(
+      std::unique_ptr<ss::http::request>, std::unique_ptr<ss::http::reply>);
 
     ss::future<ss::json::json_return_type> get_node_uuid_handler();
     ss::future<ss::json::json_return_type>
@@ -681,6 +699,7 @@ private:
     ss::sharded<storage::node>& _storage_node;
     ss::sharded<memory_sampling>& _memory_sampling_service;
     ss::sharded<cloud_storage::cache>& _cloud_storage_cache;
+    ss::sharded<cloud_storage::remote>& _cloud_storage_api;
     ss::sharded<resources::cpu_profiler>& _cpu_profiler;
     ss::sharded<transform::service>* _transform_service;
     ss::sharded<security::audit::audit_log_manager>& _audit_mgr;
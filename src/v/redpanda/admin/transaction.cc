@@ -17,6 +17,8 @@
 #include <seastar/coroutine/maybe_yield.hh>
 #include <seastar/json/json_elements.hh>
 
+#include <algorithm>
+
 void admin_server::register_transaction_routes() {
     register_route<user>(
       ss::httpd::transaction_json::get_all_transactions,
@@ -80,12 +82,25 @@ admin_server::get_all_transactions_handler(
 
     using tx_info = ss::httpd::transaction_json::transaction_summary;
     fragmented_vector<tx_info> ans;
-    ans.reserve(res.value().size());
+    auto page = admin::page::from_request(*req);
+    // Pages must be cut from a listing in a stable order
+    std::sort(
+      res.value().begin(),
+      res.value().end(),
+      [](const auto& l, const auto& r) { return l.id < r.id; });
+    // Index in the listing of the next transaction that isn't a tombstone
+    size_t index = 0;
 
     for (auto& tx : res.value()) {
         if (tx.status == cluster::tm_transaction::tx_status::tombstone) {
             continue;
         }
+        if (page.past_end(index)) {
+            break;
+        }
+        if (!page.contains(index++)) {
+            continue;
+        }
 
         tx_info new_tx;
 
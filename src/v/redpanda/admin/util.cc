@@ -57,6 +57,32 @@ bool get_boolean_query_param(
            || str_param == "1";
 }
 
+std::optional<uint64_t>
+get_integer_query_param(const ss::http::request& req, std::string_view name) {
+    auto key = ss::sstring(name);
+    if (!req.query_parameters.contains(key)) {
+        return std::nullopt;
+    }
+
+    const ss::sstring& str_param = req.query_parameters.at(key);
+    try {
+        auto value = std::stoll(str_param);
+        if (value >= 0) {
+            return value;
+        }
+    } catch (const std::logic_error&) {
+    }
+    throw ss::httpd::bad_request_exception(
+      fmt::format("Parameter {} must be a non-negative integer", name));
+}
+
+page page::from_request(const ss::http::request& req) {
+    return page{
+      .offset = get_integer_query_param(req, "offset").value_or(0),
+      .limit = get_integer_query_param(req, "limit"),
+    };
+}
+
 bool path_decode(const std::string_view in, ss::sstring& out) {
     size_t pos = 0;
     ss::sstring buff(in.length(), 0);
@@ -13,6 +13,9 @@
 
 #include <seastar/http/request.hh>
 
+#include <cstdint>
+#include <optional>
+
 #pragma once
 
 namespace admin {
@@ -48,6 +51,40 @@ void apply_validator(
 bool get_boolean_query_param(
   const ss::http::request& req, std::string_view name);
 
+/**
+ * Helper for requests with decimal_integer URL query parameters.
+ *
+ * Throws a bad_request exception if the parameter is present but not
+ * a non-negative integer.
+ */
+std::optional<uint64_t>
+get_integer_query_param(const ss::http::request& req, std::string_view name);
+
+/**
+ * The page of a listing selected by the `offset` and `limit` URL query
+ * parameters, so that clients of large clusters can fetch listings in
+ * bounded pieces. Without the parameters the page is the whole listing.
+ *
+ * Items are counted from the start of the listing in its stable order, a
+ * client has reached the end once it gets a page shorter than its limit.
+ */
+struct page {
+    size_t offset{0};
+    std::optional<size_t> limit;
+
+    static page from_request(const ss::http::request& req);
+
+    /// Whether the item at `index` of the listing is in the page.
+    bool contains(size_t index) const {
+        return index >= offset && !past_end(index);
+    }
+
+    /// Whether the item at `index` and all that follow it are past the page.
+    bool past_end(size_t index) const {
+        return limit.has_value() && index >= offset + *limit;
+    }
+};
+
 /**
  * Helper for decoding path parameters.
  *
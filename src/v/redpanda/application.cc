@@ -77,6 +77,7 @@
 #include "features/fwd.h"
 #include "finjector/stress_fiber.h"
 #include "kafka/client/configuration.h"
+#include "kafka/server/compression_advisor.h"
 #include "kafka/server/coordinator_ntp_mapper.h"
 #include "kafka/server/group_manager.h"
 #include "kafka/server/group_router.h"
@@ -99,9 +100,12 @@
 #include "raft/service.h"
 #include "redpanda/admin/server.h"
 #include "resource_mgmt/io_priority.h"
+#include "resource_mgmt/lock_contention_probe.h"
+#include "resource_mgmt/memory_accounting.h"
 #include "resource_mgmt/memory_groups.h"
 #include "resource_mgmt/memory_sampling.h"
 #include "resource_mgmt/scheduling_groups_probe.h"
+#include "resource_mgmt/stall_attribution.h"
 #include "resource_mgmt/smp_groups.h"
 #include "rpc/rpc_utils.h"
 #include "security/audit/audit_log_manager.h"
@@ -110,6 +114,7 @@
 #include "storage/backlog_controller.h"
 #include "storage/chunk_cache.h"
 #include "storage/compaction_controller.h"
+#include "storage/compression_offload.h"
 #include "storage/directories.h"
 #include "syschecks/syschecks.h"
 #include "transform/api.h"
@@ -132,6 +137,7 @@
 #include <seastar/core/shared_ptr.hh>
 #include <seastar/core/smp.hh>
 #include <seastar/core/thread.hh>
+#include <seastar/core/when_all.hh>
 #include <seastar/json/json_elements.hh>
 #include <seastar/net/tls.hh>
 #include <seastar/util/conversions.hh>
@@ -321,6 +327,9 @@ void application::shutdown() {
     if (_kafka_conn_quotas.local_is_initialized()) {
         _kafka_conn_quotas.stop().get();
     }
+    if (_kafka_known_clients.local_is_initialized()) {
+        _kafka_known_clients.stop().get();
+    }
     if (_rpc.local_is_initialized()) {
         _rpc.invoke_on_all(&rpc::rpc_server::wait_for_shutdown).get();
         _rpc.stop().get();
@@ -437,6 +446,7 @@ int application::run(int ac, char** av) {
                     shutdown();
                     vlog(_log.info, "Shutdown complete.");
                 });
+                _startup.begin("initialize");
                 // must initialize configuration before services
                 hydrate_config(cfg);
                 initialize();
@@ -481,8 +491,13 @@ void application::initialize(
         memory_groups();
     }).get();
     construct_service(
-      _memory_sampling, std::ref(_log), ss::sharded_parameter([]() {
+      _memory_sampling,
+      std::ref(_log),
+      ss::sharded_parameter([]() {
           return config::shard_local_cfg().sampled_memory_profile.bind();
+      }),
+      ss::sharded_parameter([]() {
+          return config::shard_local_cfg().sampled_memory_profile_rate.bind();
       }))
       .get();
     _memory_sampling.invoke_on_all(&memory_sampling::start).get();
@@ -699,6 +714,36 @@ void application::setup_internal_metrics() {
       });
 }
 
+void application::setup_startup_metrics() {
+    namespace sm = ss::metrics;
+
+    auto make_phase_gauges = [this](const sm::label& phase_label) {
+        std::vector<sm::metric_definition> gauges;
+        for (const auto& p : _startup.phases()) {
+            auto seconds = std::chrono::duration<double>(p.duration).count();
+            gauges.push_back(
+              sm::make_gauge(
+                "startup_phase_seconds",
+                [seconds] { return seconds; },
+                sm::description(
+                  "Time taken by a phase of the last startup, in seconds"),
+                {phase_label(p.name)})
+                .aggregate({sm::shard_label}));
+        }
+        return gauges;
+    };
+
+    if (!config::shard_local_cfg().disable_metrics()) {
+        _metrics.add_group(
+          "application", make_phase_gauges(sm::label("phase")));
+    }
+    if (!config::shard_local_cfg().disable_public_metrics()) {
+        _public_metrics.local().groups.add_group(
+          "application",
+          make_phase_gauges(metrics::make_namespaced_label("phase")));
+    }
+}
+
 void application::validate_arguments(const po::variables_map& cfg) {
     if (!cfg.count("redpanda-cfg")) {
         throw std::invalid_argument("Missing redpanda-cfg flag");
@@ -1023,6 +1068,7 @@ void application::configure_admin_server() {
       std::ref(storage_node),
       std::ref(_memory_sampling),
       std::ref(shadow_index_cache),
+      std::ref(cloud_storage_api),
       std::ref(_cpu_profiler),
       &_transform_service,
       std::ref(audit_mgr),
@@ -1068,7 +1114,7 @@ static storage::kvstore_config kvstore_config_from_global_config(
 static storage::log_config manager_config_from_global_config(
   scheduling_groups& sgs,
   std::optional<storage::file_sanitize_config> sanitizer_config) {
-    return storage::log_config(
+    auto cfg = storage::log_config(
       config::node().data_directory().as_sstring(),
       config::shard_local_cfg().log_segment_size.bind(),
       config::shard_local_cfg().compacted_log_segment_size.bind(),
@@ -1087,10 +1133,14 @@ static storage::log_config manager_config_from_global_config(
         .max_size = config::shard_local_cfg().reclaim_max_size(),
         .min_free_memory
         = config::shard_local_cfg().reclaim_batch_cache_min_free(),
+        .eviction_policy
+        = config::shard_local_cfg().batch_cache_eviction_policy(),
       },
       config::shard_local_cfg().readers_cache_eviction_timeout_ms(),
       sgs.compaction_sg(),
       std::move(sanitizer_config));
+    cfg.cold_dir = config::node().cold_data_directory();
+    return cfg;
 }
 
 static storage::backlog_controller_config compaction_controller_config(
@@ -1275,9 +1325,31 @@ void application::wire_up_redpanda_services(
   model::node_id node_id, ::stop_signal& app_signal) {
     ss::smp::invoke_on_all([] {
         resources::available_memory::local().register_metrics();
+        resources::memory_accounting::local().register_metrics();
+        resources::lock_contention_probe::local().start(
+          config::shard_local_cfg().lock_contention_tracking_enabled.bind());
     }).get();
+    if (config::shard_local_cfg().reactor_stall_attribution_enabled()) {
+        ss::smp::invoke_on_all([] {
+            resources::stall_attribution::local().start();
+        }).get();
+        _deferred.emplace_back([] {
+            ss::smp::invoke_on_all([] {
+                resources::stall_attribution::local().stop();
+            }).get();
+        });
+    }
 
     construct_single_service(thread_worker);
+    construct_service(
+      _compression_offload,
+      std::ref(*thread_worker),
+      ss::sharded_parameter([] {
+          return config::shard_local_cfg()
+            .storage_compression_offload_bytes.bind();
+      }),
+      config::shard_local_cfg().storage_compression_offload_max_in_flight())
+      .get();
 
     // cluster
     syschecks::systemd_message("Initializing connection cache").get();
@@ -1333,6 +1405,9 @@ void application::wire_up_redpanda_services(
               .write_caching_flush_ms
               = config::shard_local_cfg()
                   .raft_replica_max_flush_delay_ms.bind(),
+              .coalesce_follower_flushes
+              = config::shard_local_cfg()
+                  .raft_coalesce_follower_flushes.bind(),
             };
         },
         [] {
@@ -1434,7 +1509,11 @@ void application::wire_up_redpanda_services(
       ss::sharded_parameter([]() {
           return config::shard_local_cfg().max_concurrent_producer_ids.bind();
       }),
-      config::shard_local_cfg().transactional_id_expiration_ms.value())
+      config::shard_local_cfg().transactional_id_expiration_ms.value(),
+      ss::sharded_parameter([]() {
+          return config::shard_local_cfg()
+            .max_spilled_producer_state_bytes.bind();
+      }))
       .get();
 
     producer_manager.invoke_on_all(&cluster::producer_state_manager::start)
@@ -1572,6 +1651,7 @@ void application::wire_up_redpanda_services(
       std::ref(controller->get_members_table()),
       std::ref(feature_table),
       std::ref(node_status_table),
+      std::ref(raft_group_manager),
       ss::sharded_parameter(
         [] { return config::shard_local_cfg().node_status_interval.bind(); }),
       ss::sharded_parameter([] {
@@ -1873,6 +1953,7 @@ void application::wire_up_redpanda_services(
           };
       })
       .get();
+    _kafka_known_clients.start().get();
 
     ss::sharded<net::server_configuration> kafka_cfg;
     kafka_cfg.start(ss::sstring("kafka_rpc")).get();
@@ -1882,6 +1963,7 @@ void application::wire_up_redpanda_services(
       .invoke_on_all([this](net::server_configuration& c) {
           return ss::async([this, &c] {
               c.conn_quotas = std::ref(_kafka_conn_quotas);
+              c.known_clients = std::ref(_kafka_known_clients);
               c.max_service_memory_per_core = int64_t(
                 memory_groups().kafka_total_memory());
               c.listen_backlog
@@ -2021,6 +2103,14 @@ void application::wire_up_redpanda_services(
         sched_groups.compaction_sg(),
         priority_manager::local().compaction_priority()))
       .get();
+    construct_service(
+      _compression_advisor,
+      ss::sharded_parameter([] {
+          return config::shard_local_cfg()
+            .kafka_compression_advisor_interval_ms.bind();
+      }),
+      sched_groups.compaction_sg())
+      .get();
 }
 
 ss::future<> application::set_proxy_config(ss::sstring name, std::any val) {
@@ -2303,9 +2393,12 @@ void application::wire_up_and_start(::stop_signal& app_signal, bool test_mode) {
     construct_service(_as).get();
 
     // Bootstrap services.
+    _startup.begin("bootstrap_services");
     wire_up_bootstrap_services();
     start_bootstrap_services();
 
+    _startup.begin("cluster_discovery");
+
     // Begin the cluster discovery manager so we can confirm our initial node
     // ID. A valid node ID is required before we can initialize the rest of our
     // subsystems.
@@ -2390,6 +2483,7 @@ void application::wire_up_and_start(::stop_signal& app_signal, bool test_mode) {
       node_id,
       storage.local().get_cluster_uuid());
 
+    _startup.begin("wire_up_runtime_services");
     wire_up_runtime_services(node_id, app_signal);
 
     if (test_mode) {
@@ -2419,22 +2513,33 @@ void application::wire_up_and_start(::stop_signal& app_signal, bool test_mode) {
 
     start_runtime_services(cd, app_signal);
 
+    // Pandaproxy and the Schema Registry don't depend on each other, start
+    // them together.
+    _startup.begin("proxy_and_schema_registry");
+    auto start_proxy = ss::now();
     if (_proxy_config && !config::node().recovery_mode_enabled) {
-        _proxy->start().get();
-        vlog(
-          _log.info,
-          "Started Pandaproxy listening at {}",
-          _proxy_config->pandaproxy_api());
+        start_proxy = _proxy->start().then([this] {
+            vlog(
+              _log.info,
+              "Started Pandaproxy listening at {}",
+              _proxy_config->pandaproxy_api());
+        });
     }
-
+    auto start_schema_registry = ss::now();
     if (_schema_reg_config && !config::node().recovery_mode_enabled) {
-        _schema_registry->start().get();
-        vlog(
-          _log.info,
-          "Started Schema Registry listening at {}",
-          _schema_reg_config->schema_registry_api());
+        start_schema_registry = _schema_registry->start().then([this] {
+            vlog(
+              _log.info,
+              "Started Schema Registry listening at {}",
+              _schema_reg_config->schema_registry_api());
+        });
     }
+    ss::when_all_succeed(
+      std::move(start_proxy), std::move(start_schema_registry))
+      .discard_result()
+      .get();
 
+    _startup.begin("audit");
     audit_mgr.invoke_on_all(&security::audit::audit_log_manager::start).get();
 
     if (!audit_mgr.local().report_redpanda_app_event(
@@ -2446,16 +2551,19 @@ void application::wire_up_and_start(::stop_signal& app_signal, bool test_mode) {
         throw std::runtime_error("Failed to enqueue startup audit event!");
     }
 
+    _startup.begin("kafka");
     start_kafka(node_id, app_signal);
     controller->set_ready().get();
 
     if (
       wasm_data_transforms_enabled() && !config::node().recovery_mode_enabled) {
+        _startup.begin("data_transforms");
         const auto& cluster = config::shard_local_cfg();
         wasm::runtime::config config = {
           .heap_memory = {
             .per_core_pool_size_bytes = cluster.data_transforms_per_core_memory_reservation.value(),
             .per_engine_memory_limit = cluster.data_transforms_per_function_memory_limit.value(),
+            .huge_pages = cluster.data_transforms_huge_page_memory.value(),
           },
           .stack_memory = {
             .debug_host_stack_usage = false,
@@ -2463,24 +2571,35 @@ void application::wire_up_and_start(::stop_signal& app_signal, bool test_mode) {
           .cpu = {
             .per_invocation_timeout = cluster.data_transforms_runtime_limit_ms.value(),
           },
+          .standby_engines = cluster.data_transforms_standby_engines.value(),
         };
+        if (cluster.data_transforms_compilation_cache_enabled()) {
+            config.compilation_cache_directory
+              = config::node().data_directory().path / "wasm_compilation_cache";
+        }
         _wasm_runtime->start(config).get();
         _transform_rpc_client.invoke_on_all(&transform::rpc::client::start)
           .get();
         _transform_service.invoke_on_all(&transform::service::start).get();
     }
 
+    _startup.begin("finalize");
     construct_service(_aggregate_metrics_watcher).get();
 
     _admin.invoke_on_all([](admin_server& admin) { admin.set_ready(); }).get();
     _monitor_unsafe_log_flag->start().get();
 
+    _startup.finish();
+    _startup.log_report(_log);
+    setup_startup_metrics();
+
     vlog(_log.info, "Successfully started Redpanda!");
     syschecks::systemd_notify_ready().get();
 }
 
 void application::start_runtime_services(
   cluster::cluster_discovery& cd, ::stop_signal& app_signal) {
+    _startup.begin("runtime_services");
     ssx::background = feature_table.invoke_on_all(
       [this](features::feature_table& ft) {
           return ft.await_feature_then(
@@ -2496,10 +2615,17 @@ void application::start_runtime_services(
       });
 
     thread_worker->start({.name = "worker"}).get();
+    _compression_offload
+      .invoke_on_all(&storage::compression_offload::start)
+      .get();
+    _compression_advisor
+      .invoke_on_all(&kafka::compression_advisor::start)
+      .get();
 
     // single instance
     node_status_backend.invoke_on_all(&cluster::node_status_backend::start)
       .get();
+    _startup.begin("partition_manager");
     syschecks::systemd_message("Starting the partition manager").get();
     partition_manager
       .invoke_on_all([this](cluster::partition_manager& pm) {
@@ -2524,6 +2650,7 @@ void application::start_runtime_services(
       .get();
     partition_manager.invoke_on_all(&cluster::partition_manager::start).get();
 
+    _startup.begin("group_managers");
     syschecks::systemd_message("Starting Raft group manager").get();
     raft_group_manager.invoke_on_all(&raft::group_manager::start).get();
 
@@ -2552,6 +2679,7 @@ void application::start_runtime_services(
           })
           .get();
     }
+    _startup.begin("controller");
     syschecks::systemd_message("Starting controller").get();
     ss::shared_ptr<cluster::cloud_metadata::offsets_upload_requestor>
       offsets_upload_requestor;
@@ -2574,6 +2702,7 @@ void application::start_runtime_services(
 
     // FIXME: in first patch explain why this is started after the
     // controller so the broker set will be available. Then next patch fix.
+    _startup.begin("rpc");
     syschecks::systemd_message("Starting metadata dissination service").get();
     md_dissemination_service
       .invoke_on_all(&cluster::metadata_dissemination_service::start)
@@ -2703,17 +2832,23 @@ void application::start_runtime_services(
 
     // After we have started internal RPC listener, we may join
     // the cluster (if we aren't already a member)
+    _startup.begin("cluster_join");
     controller->get_members_manager()
       .invoke_on(
         cluster::members_manager::shard,
         &cluster::members_manager::join_cluster)
       .get();
 
-    quota_mgr.invoke_on_all(&kafka::quota_manager::start).get();
-    snc_quota_mgr.invoke_on_all(&kafka::snc_quota_manager::start).get();
-    usage_manager.invoke_on_all(&kafka::usage_manager::start).get();
+    // The quota and usage managers are independent of each other
+    ss::when_all_succeed(
+      quota_mgr.invoke_on_all(&kafka::quota_manager::start),
+      snc_quota_mgr.invoke_on_all(&kafka::snc_quota_manager::start),
+      usage_manager.invoke_on_all(&kafka::usage_manager::start))
+      .discard_result()
+      .get();
 
     if (_await_controller_last_applied.has_value()) {
+        _startup.begin("controller_catch_up");
         syschecks::systemd_message(
           "Waiting for controller to replicate (joining cluster)")
           .get();
@@ -2723,6 +2858,7 @@ void application::start_runtime_services(
           .get();
     }
 
+    _startup.begin("background_services");
     if (!config::node().admin().empty()) {
         _admin.invoke_on_all(&admin_server::start).get0();
     }
@@ -34,6 +34,7 @@
 #include "metrics/aggregate_metrics_watcher.h"
 #include "metrics/metrics.h"
 #include "net/conn_quota.h"
+#include "net/known_clients.h"
 #include "net/fwd.h"
 #include "pandaproxy/fwd.h"
 #include "pandaproxy/rest/configuration.h"
@@ -42,6 +43,7 @@
 #include "pandaproxy/schema_registry/fwd.h"
 #include "raft/fwd.h"
 #include "redpanda/monitor_unsafe_log_flag.h"
+#include "redpanda/startup_timeline.h"
 #include "resource_mgmt/cpu_profiler.h"
 #include "resource_mgmt/cpu_scheduling.h"
 #include "resource_mgmt/memory_groups.h"
@@ -268,8 +270,12 @@ private:
     void setup_metrics();
     void setup_public_metrics();
     void setup_internal_metrics();
+    void setup_startup_metrics();
     std::unique_ptr<ss::app_template> _app;
 
+    // The phases of starting up, reported once redpanda has started
+    startup_timeline _startup;
+
     // Early in startup, we load config from disk or from the response to
     // a cluster join request: this is used to prime config_manager's state
     // so that the config doesn't walk through all intermediate states
@@ -297,9 +303,12 @@ private:
     ss::sharded<rpc::rpc_server> _rpc;
     ss::sharded<admin_server> _admin;
     ss::sharded<net::conn_quota> _kafka_conn_quotas;
+    ss::sharded<net::known_clients> _kafka_known_clients;
     std::unique_ptr<pandaproxy::rest::api> _proxy;
     std::unique_ptr<pandaproxy::schema_registry::api> _schema_registry;
     ss::sharded<storage::compaction_controller> _compaction_controller;
+    ss::sharded<storage::compression_offload> _compression_offload;
+    ss::sharded<kafka::compression_advisor> _compression_advisor;
     ss::sharded<archival::upload_controller> _archival_upload_controller;
     ss::sharded<archival::upload_housekeeping_service>
       _archival_upload_housekeeping;
@@ -0,0 +1,63 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "redpanda/startup_timeline.h"
+
+#include "base/vlog.h"
+
+#include <fmt/format.h>
+
+#include <iterator>
+
+void startup_timeline::begin(std::string_view name) {
+    auto now = clock_type::now();
+    if (_current) {
+        _phases.push_back(
+          {.name = std::move(_current->name),
+           .duration = now - _current->start});
+    }
+    _current = current_phase{.name = ss::sstring(name), .start = now};
+}
+
+void startup_timeline::finish() {
+    if (!_current) {
+        return;
+    }
+    _phases.push_back(
+      {.name = std::move(_current->name),
+       .duration = clock_type::now() - _current->start});
+    _current.reset();
+}
+
+startup_timeline::clock_type::duration startup_timeline::total() const {
+    clock_type::duration total{0};
+    for (const auto& p : _phases) {
+        total += p.duration;
+    }
+    return total;
+}
+
+void startup_timeline::log_report(ss::logger& log) const {
+    using ms = std::chrono::milliseconds;
+    fmt::memory_buffer report;
+    for (const auto& p : _phases) {
+        fmt::format_to(
+          std::back_inserter(report),
+          " {}={}ms",
+          p.name,
+          std::chrono::duration_cast<ms>(p.duration).count());
+    }
+    vlog(
+      log.info,
+      "Startup took {}ms:{}",
+      std::chrono::duration_cast<ms>(total()).count(),
+      fmt::to_string(report));
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "base/seastarx.h"
+
+#include <seastar/core/sstring.hh>
+#include <seastar/util/log.hh>
+
+#include <chrono>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+/**
+ * How long each phase of starting redpanda took, so that the time a restart
+ * takes can be attributed to storage, controller replay, partition bootstrap
+ * and so on. The phases follow each other: beginning a phase ends the one
+ * before it.
+ */
+class startup_timeline {
+public:
+    using clock_type = std::chrono::steady_clock;
+
+    struct phase {
+        ss::sstring name;
+        clock_type::duration duration;
+    };
+
+    /// Ends the current phase, if any, and begins the next one.
+    void begin(std::string_view name);
+
+    /// Ends the current phase, if any.
+    void finish();
+
+    const std::vector<phase>& phases() const { return _phases; }
+
+    clock_type::duration total() const;
+
+    /// Logs the duration of the startup and of each of its phases.
+    void log_report(ss::logger&) const;
+
+private:
+    struct current_phase {
+        ss::sstring name;
+        clock_type::time_point start;
+    };
+
+    std::vector<phase> _phases;
+    std::optional<current_phase> _current;
+};
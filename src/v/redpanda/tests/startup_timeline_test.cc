@@ -0,0 +1,38 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#define BOOST_TEST_MODULE startup_timeline
+#include "redpanda/startup_timeline.h"
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_CASE(test_empty_timeline) {
+    startup_timeline timeline;
+    timeline.finish();
+    BOOST_REQUIRE(timeline.phases().empty());
+    BOOST_REQUIRE(
+      timeline.total() == startup_timeline::clock_type::duration{});
+}
+
+BOOST_AUTO_TEST_CASE(test_phases_follow_each_other) {
+    startup_timeline timeline;
+    timeline.begin("storage");
+    timeline.begin("controller");
+    BOOST_REQUIRE_EQUAL(timeline.phases().size(), 1);
+    timeline.finish();
+    timeline.finish();
+
+    const auto& phases = timeline.phases();
+    BOOST_REQUIRE_EQUAL(phases.size(), 2);
+    BOOST_REQUIRE_EQUAL(phases[0].name, "storage");
+    BOOST_REQUIRE_EQUAL(phases[1].name, "controller");
+    BOOST_REQUIRE(timeline.total() == phases[0].duration + phases[1].duration);
+}
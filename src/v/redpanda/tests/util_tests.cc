@@ -13,6 +13,7 @@
 #include "redpanda/admin/util.h"
 
 #include <seastar/core/sstring.hh>
+#include <seastar/http/exception.hh>
 
 #include <boost/test/unit_test.hpp>
 
@@ -36,3 +37,25 @@ BOOST_AUTO_TEST_CASE(test_path_encode_changed) {
     auto expected_chars = seastar::sstring{" "};
     BOOST_REQUIRE_EQUAL(result, expected_chars);
 }
+
+BOOST_AUTO_TEST_CASE(test_page_from_request) {
+    seastar::http::request req;
+    auto all = admin::page::from_request(req);
+    BOOST_REQUIRE(all.contains(0));
+    BOOST_REQUIRE(all.contains(1'000'000));
+    BOOST_REQUIRE(!all.past_end(1'000'000));
+
+    req.query_parameters["offset"] = "2";
+    req.query_parameters["limit"] = "3";
+    auto p = admin::page::from_request(req);
+    BOOST_REQUIRE(!p.contains(1));
+    BOOST_REQUIRE(p.contains(2));
+    BOOST_REQUIRE(p.contains(4));
+    BOOST_REQUIRE(!p.contains(5));
+    BOOST_REQUIRE(!p.past_end(4));
+    BOOST_REQUIRE(p.past_end(5));
+
+    req.query_parameters["limit"] = "-1";
+    BOOST_REQUIRE_THROW(
+      admin::page::from_request(req), seastar::httpd::bad_request_exception);
+}
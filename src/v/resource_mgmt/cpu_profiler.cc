@@ -23,7 +23,11 @@
 #include <seastar/core/sleep.hh>
 #include <seastar/util/later.hh>
 
+#include <absl/container/flat_hash_map.h>
+
 #include <iterator>
+#include <string_view>
+#include <utility>
 
 namespace resources {
 
@@ -53,7 +57,8 @@ ss::future<> cpu_profiler::stop() {
 
 ss::future<std::vector<cpu_profiler::shard_samples>> cpu_profiler::results(
   std::optional<ss::shard_id> shard_id,
-  std::optional<ss::lowres_clock::time_point> filter_before) {
+  std::optional<ss::lowres_clock::time_point> filter_before,
+  std::optional<ss::sstring> scheduling_group) {
     if (_gate.is_closed()) {
         co_return std::vector<shard_samples>{};
     }
@@ -63,8 +68,9 @@ ss::future<std::vector<cpu_profiler::shard_samples>> cpu_profiler::results(
 
     if (shard_id) {
         auto shard_result = co_await container().invoke_on(
-          shard_id.value(),
-          [filter_before](auto& s) { return s.shard_results(filter_before); });
+          shard_id.value(), [filter_before, &scheduling_group](auto& s) {
+              return s.shard_results(filter_before, scheduling_group);
+          });
 
         results.emplace_back(
           shard_result.shard,
@@ -72,7 +78,9 @@ ss::future<std::vector<cpu_profiler::shard_samples>> cpu_profiler::results(
           std::move(shard_result.samples));
     } else {
         results = co_await container().map_reduce0(
-          [filter_before](auto& s) { return s.shard_results(filter_before); },
+          [filter_before, &scheduling_group](auto& s) {
+              return s.shard_results(filter_before, scheduling_group);
+          },
           std::vector<shard_samples>{},
           [](std::vector<shard_samples> results, shard_samples shard_result) {
               results.emplace_back(
@@ -87,9 +95,13 @@ ss::future<std::vector<cpu_profiler::shard_samples>> cpu_profiler::results(
 }
 
 cpu_profiler::shard_samples cpu_profiler::shard_results(
-  std::optional<ss::lowres_clock::time_point> filter_before) const {
+  std::optional<ss::lowres_clock::time_point> filter_before,
+  std::optional<ss::sstring> scheduling_group) const {
     size_t dropped_samples = 0;
-    absl::node_hash_map<ss::simple_backtrace, size_t> backtraces;
+    absl::node_hash_map<
+      std::pair<ss::scheduling_group, ss::simple_backtrace>,
+      size_t>
+      backtraces;
     for (auto& results_buffer : _results_buffers) {
         if (filter_before && results_buffer.polled_time < *filter_before) {
             continue;
@@ -97,16 +109,20 @@ cpu_profiler::shard_samples cpu_profiler::shard_results(
 
         dropped_samples += results_buffer.dropped_samples;
         for (auto& result : results_buffer.samples) {
-            backtraces[result.user_backtrace]++;
+            if (scheduling_group && result.sg.name() != *scheduling_group) {
+                continue;
+            }
+            backtraces[{result.sg, result.user_backtrace}]++;
         }
     }
 
     std::vector<sample> results{};
     results.reserve(backtraces.size());
 
-    for (auto& backtrace : backtraces) {
+    for (auto& [key, occurrences] : backtraces) {
+        auto& [sg, backtrace] = key;
         results.emplace_back(
-          ssx::sformat("{}", backtrace.first), backtrace.second);
+          ssx::sformat("{}", backtrace), sg.name(), occurrences);
     }
 
     return {ss::this_shard_id(), dropped_samples, results};
@@ -176,7 +192,9 @@ void cpu_profiler::on_sample_period_change() {
 
 ss::future<std::vector<cpu_profiler::shard_samples>>
 cpu_profiler::collect_results_for_period(
-  std::chrono::milliseconds timeout, std::optional<ss::shard_id> shard_id) {
+  std::chrono::milliseconds timeout,
+  std::optional<ss::shard_id> shard_id,
+  std::optional<ss::sstring> scheduling_group) {
     if (_gate.is_closed()) {
         co_return std::vector<shard_samples>{};
     }
@@ -198,7 +216,45 @@ cpu_profiler::collect_results_for_period(
     // check if profiler should be disabled post-override.
     on_enabled_change();
 
-    co_return co_await results(shard_id, polling_start_time);
+    co_return co_await results(
+      shard_id, polling_start_time, std::move(scheduling_group));
+}
+
+ss::sstring
+cpu_profiler::to_collapsed_stacks(const std::vector<shard_samples>& results) {
+    absl::flat_hash_map<ss::sstring, size_t> stacks;
+    std::vector<std::string_view> frames;
+    for (const auto& shard_result : results) {
+        for (const auto& sample : shard_result.samples) {
+            // backtraces are formatted innermost frame first, separated by
+            // whitespace
+            frames.clear();
+            std::string_view backtrace = sample.user_backtrace;
+            while (!backtrace.empty()) {
+                auto end = backtrace.find_first_of(" \n");
+                if (end != 0) {
+                    frames.push_back(backtrace.substr(0, end));
+                }
+                if (end == std::string_view::npos) {
+                    break;
+                }
+                backtrace.remove_prefix(end + 1);
+            }
+
+            ss::sstring stack = sample.scheduling_group;
+            for (auto it = frames.rbegin(); it != frames.rend(); ++it) {
+                stack += ";";
+                stack.append(it->data(), it->size());
+            }
+            stacks[std::move(stack)] += sample.occurrences;
+        }
+    }
+
+    ss::sstring out;
+    for (const auto& [stack, occurrences] : stacks) {
+        out += ssx::sformat("{} {}\n", stack, occurrences);
+    }
+    return out;
 }
 
 } // namespace resources
@@ -49,10 +49,13 @@ class cpu_profiler : public ss::peering_sharded_service<cpu_profiler> {
 public:
     struct sample {
         ss::sstring user_backtrace;
+        // name of the scheduling group the backtrace was sampled in
+        ss::sstring scheduling_group;
         size_t occurrences;
 
-        sample(ss::sstring ub, size_t o)
+        sample(ss::sstring ub, ss::sstring sg, size_t o)
           : user_backtrace(std::move(ub))
+          , scheduling_group(std::move(sg))
           , occurrences(o) {}
     };
 
@@ -72,21 +75,35 @@ public:
     // them as a vector.
     ss::future<std::vector<shard_samples>> results(
       std::optional<ss::shard_id> shard_id,
-      std::optional<ss::lowres_clock::time_point> filter_before = std::nullopt);
+      std::optional<ss::lowres_clock::time_point> filter_before = std::nullopt,
+      std::optional<ss::sstring> scheduling_group = std::nullopt);
 
     // Returns the samples and dropped samples from the shard this function
     // is called on.
     //
     // `filter_before` will filter out any samples taken before a specified
     // time_point before from the returned samples.
+    //
+    // `scheduling_group` will filter out any samples taken in another
+    // scheduling group than the one of that name.
     shard_samples shard_results(
-      std::optional<ss::lowres_clock::time_point> filter_before
-      = std::nullopt) const;
+      std::optional<ss::lowres_clock::time_point> filter_before = std::nullopt,
+      std::optional<ss::sstring> scheduling_group = std::nullopt) const;
 
     // Enables the profiler for `timeout` milliseconds, then returns samples
     // collected during that time period.
     ss::future<std::vector<shard_samples>> collect_results_for_period(
-      std::chrono::milliseconds timeout, std::optional<ss::shard_id> shard_id);
+      std::chrono::milliseconds timeout,
+      std::optional<ss::shard_id> shard_id,
+      std::optional<ss::sstring> scheduling_group = std::nullopt);
+
+    // Formats samples in the collapsed stack format read by flamegraph.pl,
+    // speedscope and the like: a line per distinct stack with its frames
+    // from the outermost to the innermost, separated by ';', and the number
+    // of occurrences. The outermost frame is the scheduling group. Identical
+    // stacks from different shards are summed.
+    static ss::sstring
+    to_collapsed_stacks(const std::vector<shard_samples>& results);
 
 private:
     // Used to poll seastar at set intervals to capture all samples
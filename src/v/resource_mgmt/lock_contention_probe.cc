@@ -0,0 +1,88 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "resource_mgmt/lock_contention_probe.h"
+
+#include "config/configuration.h"
+#include "prometheus/prometheus_sanitize.h"
+#include "utils/lock_contention.h"
+
+#include <seastar/core/metrics.hh>
+
+#include <vector>
+
+namespace resources {
+
+void lock_contention_probe::start(config::binding<bool> enabled) {
+    _enabled.emplace(std::move(enabled));
+    _enabled->watch([this] { on_enabled_change(); });
+    on_enabled_change();
+}
+
+void lock_contention_probe::on_enabled_change() {
+    const bool enabled = (*_enabled)();
+    lock_class::set_tracking_enabled(enabled);
+    if (enabled) {
+        register_metrics();
+    }
+}
+
+void lock_contention_probe::register_metrics() {
+    if (_metrics || config::shard_local_cfg().disable_metrics()) {
+        // already initialized or disabled
+        return;
+    }
+
+    namespace sm = ss::metrics;
+    auto class_label = sm::label("lock_class");
+    std::vector<sm::metric_definition> defs;
+    for (const auto* cls : lock_class::all()) {
+        auto& stats = cls->local_stats();
+        const std::vector<sm::label_instance> labels{
+          class_label(cls->name())};
+        defs.emplace_back(sm::make_counter(
+          "acquisitions",
+          [&stats] { return stats.acquisitions; },
+          sm::description("Number of times the locks of a class were taken"),
+          labels));
+        defs.emplace_back(sm::make_counter(
+          "contended_acquisitions",
+          [&stats] { return stats.contended_acquisitions; },
+          sm::description(
+            "Number of times the locks of a class were taken after waiting"),
+          labels));
+        defs.emplace_back(sm::make_gauge(
+          "waiters",
+          [&stats] { return stats.waiters; },
+          sm::description("Number of waiters for the locks of a class"),
+          labels));
+        defs.emplace_back(sm::make_histogram(
+          "wait_time_us",
+          [&stats] { return stats.wait_us.seastar_histogram_logform(); },
+          sm::description(
+            "Time spent waiting for the locks of a class, by the "
+            "acquisitions that had to wait"),
+          labels));
+        defs.emplace_back(sm::make_histogram(
+          "hold_time_us",
+          [&stats] { return stats.hold_us.seastar_histogram_logform(); },
+          sm::description(
+            "Time the locks of a class were held for, by the holders "
+            "releasing them at the end of a scope"),
+          labels));
+    }
+    _metrics.emplace().add_group(
+      prometheus_sanitize::metrics_name("lock_contention"), defs);
+}
+
+thread_local lock_contention_probe lock_contention_probe::_local_instance;
+
+} // namespace resources
@@ -0,0 +1,52 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "base/seastarx.h"
+#include "config/property.h"
+#include "metrics/metrics.h"
+
+#include <optional>
+
+namespace resources {
+
+/**
+ * @brief Turns the tracking of lock contention on and off on a shard and
+ * exports the statistics of every lock_class.
+ *
+ * The metrics are created the first time tracking is enabled, a series per
+ * lock class, and stay once it is disabled again.
+ */
+class lock_contention_probe final {
+public:
+    lock_contention_probe() = default;
+    lock_contention_probe(const lock_contention_probe&) = delete;
+    lock_contention_probe& operator=(const lock_contention_probe&) = delete;
+
+    /// Tracks contention on this shard while \p enabled is true.
+    void start(config::binding<bool> enabled);
+
+    /// The lock_contention_probe instance of this shard.
+    static lock_contention_probe& local() { return _local_instance; }
+
+private:
+    void on_enabled_change();
+    void register_metrics();
+
+    static thread_local lock_contention_probe
+      _local_instance; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+    std::optional<config::binding<bool>> _enabled;
+    std::optional<metrics::internal_metric_groups> _metrics;
+};
+
+} // namespace resources
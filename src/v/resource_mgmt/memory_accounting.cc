@@ -0,0 +1,69 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "resource_mgmt/memory_accounting.h"
+
+#include "config/configuration.h"
+#include "prometheus/prometheus_sanitize.h"
+
+#include <seastar/core/metrics.hh>
+
+#include <vector>
+
+namespace resources {
+
+std::string_view to_string_view(mem_subsystem s) {
+    switch (s) {
+    case mem_subsystem::compaction:
+        return "compaction";
+    case mem_subsystem::cloud_manifests:
+        return "cloud_manifests";
+    case mem_subsystem::fetch_sessions:
+        return "fetch_sessions";
+    case mem_subsystem::transactions:
+        return "transactions";
+    }
+    return "unknown";
+}
+
+memory_accounting::memory_accounting() {
+    for (auto s : all_mem_subsystems) {
+        _roots[static_cast<size_t>(s)] = ss::make_shared<util::mem_tracker>(
+          ss::sstring(to_string_view(s)));
+    }
+}
+
+void memory_accounting::register_metrics() {
+    if (_metrics || config::shard_local_cfg().disable_metrics()) {
+        // already initialized or disabled
+        return;
+    }
+
+    namespace sm = ss::metrics;
+    auto subsystem_label = sm::label("subsystem");
+    std::vector<sm::metric_definition> defs;
+    defs.reserve(all_mem_subsystems.size());
+    for (auto s : all_mem_subsystems) {
+        defs.emplace_back(sm::make_gauge(
+          "tracked_bytes",
+          [this, s] { return consumption(s); },
+          sm::description(
+            "Memory held by the structures of a subsystem, as accounted for "
+            "by their memory trackers"),
+          {subsystem_label(ss::sstring(to_string_view(s)))}));
+    }
+    _metrics.emplace().add_group(
+      prometheus_sanitize::metrics_name("memory_accounting"), defs);
+}
+
+thread_local memory_accounting memory_accounting::_local_instance;
+
+} // namespace resources
@@ -0,0 +1,97 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "base/seastarx.h"
+#include "metrics/metrics.h"
+#include "utils/tracking_allocator.h"
+
+#include <seastar/core/shared_ptr.hh>
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace resources {
+
+/**
+ * The subsystems whose resident memory is accounted for on every shard.
+ */
+enum class mem_subsystem : uint8_t {
+    compaction,
+    cloud_manifests,
+    fetch_sessions,
+    transactions,
+};
+
+inline constexpr std::array all_mem_subsystems{
+  mem_subsystem::compaction,
+  mem_subsystem::cloud_manifests,
+  mem_subsystem::fetch_sessions,
+  mem_subsystem::transactions,
+};
+
+std::string_view to_string_view(mem_subsystem);
+
+/**
+ * @brief Attributes the memory of a shard to the subsystems holding it.
+ *
+ * Every subsystem has a root mem_tracker on every shard. The structures of a
+ * subsystem track their memory with a child of the root (e.g. one per
+ * partition), through a tracking_allocator or by reporting their allocations
+ * to the tracker directly, so that the consumption of the root is the memory
+ * of the whole subsystem on the shard.
+ */
+class memory_accounting final {
+public:
+    memory_accounting();
+    memory_accounting(const memory_accounting&) = delete;
+    memory_accounting& operator=(const memory_accounting&) = delete;
+
+    /// The root tracker of \p s on this shard.
+    util::mem_tracker& root(mem_subsystem s) {
+        return *_roots[static_cast<size_t>(s)];
+    }
+
+    /// A new tracker of the memory of a structure of \p s.
+    ss::shared_ptr<util::mem_tracker>
+    create_tracker(mem_subsystem s, ss::sstring label) {
+        return root(s).create_child(std::move(label));
+    }
+
+    /// The memory of \p s on this shard, in bytes.
+    int64_t consumption(mem_subsystem s) const {
+        return _roots[static_cast<size_t>(s)]->consumption();
+    }
+
+    /**
+     * @brief Register a gauge of the consumption of every subsystem.
+     *
+     * Without this call the accounting still works, but no metrics are
+     * created.
+     */
+    void register_metrics();
+
+    /// The memory_accounting instance of this shard.
+    static memory_accounting& local() { return _local_instance; }
+
+private:
+    static thread_local memory_accounting
+      _local_instance; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+    std::array<ss::shared_ptr<util::mem_tracker>, all_mem_subsystems.size()>
+      _roots;
+    std::optional<metrics::internal_metric_groups> _metrics;
+};
+
+} // namespace resources
@@ -12,6 +12,8 @@
 #include "resource_mgmt/memory_sampling.h"
 
 #include "base/vlog.h"
+#include "config/configuration.h"
+#include "prometheus/prometheus_sanitize.h"
 #include "resource_mgmt/available_memory.h"
 #include "ssx/future-util.h"
 #include "ssx/sformat.h"
@@ -19,11 +21,16 @@
 #include <seastar/core/condition-variable.hh>
 #include <seastar/core/future.hh>
 #include <seastar/core/memory.hh>
+#include <seastar/core/metrics.hh>
 #include <seastar/core/smp.hh>
 #include <seastar/core/sstring.hh>
 #include <seastar/util/memory_diagnostics.hh>
 
+#include <absl/container/flat_hash_map.h>
+
+#include <algorithm>
 #include <chrono>
+#include <iterator>
 #include <limits>
 #include <vector>
 
@@ -152,30 +159,36 @@ void memory_sampling::start_low_available_memory_logging() {
 }
 
 memory_sampling::memory_sampling(
-  ss::logger& logger, config::binding<bool> enabled)
+  ss::logger& logger,
+  config::binding<bool> enabled,
+  config::binding<size_t> sampling_rate)
   : memory_sampling(
-    logger, std::move(enabled), std::chrono::seconds(60), 0.2, 0.1) {}
+    logger,
+    std::move(enabled),
+    std::move(sampling_rate),
+    std::chrono::seconds(60),
+    0.2,
+    0.1) {}
 
 memory_sampling::memory_sampling(
   ss::logger& logger,
   config::binding<bool> enabled,
+  config::binding<size_t> sampling_rate,
   std::chrono::seconds log_check_frequency,
   double first_log_limit_fraction,
   double second_log_limit_fraction)
   : _logger(logger)
   , _enabled(std::move(enabled))
+  , _sampling_rate(std::move(sampling_rate))
   , _first_log_limit_fraction(first_log_limit_fraction)
   , _second_log_limit_fraction(second_log_limit_fraction)
   , _log_check_frequency(log_check_frequency) {
     _enabled.watch([this]() { on_enabled_change(); });
+    _sampling_rate.watch([this]() { on_enabled_change(); });
 }
 
 void memory_sampling::on_enabled_change() {
-    // We chose a sampling rate of ~3MB. From testing this has a very low
-    // overhead of something like ~1%. We could still get away with something
-    // smaller like 1MB and have acceptable overhead (~3%) but 3MB should be a
-    // safer default for the initial rollout.
-    const size_t sampling_rate = 3000037;
+    const size_t sampling_rate = _sampling_rate();
 
     // Note no logging here as seastar already logs about this
     if (_enabled()) {
@@ -200,6 +213,40 @@ void memory_sampling::start() {
     on_enabled_change();
 
     start_low_available_memory_logging();
+
+    setup_metrics();
+}
+
+void memory_sampling::setup_metrics() {
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+
+    namespace sm = ss::metrics;
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("memory_sampling"),
+      {
+        sm::make_gauge(
+          "rate_bytes",
+          [] { return ss::memory::get_heap_profiling_sample_rate(); },
+          sm::description(
+            "Average number of bytes allocated between two sampled "
+            "allocations, 0 when sampling is disabled")),
+        sm::make_gauge(
+          "live_samples",
+          [this] { return _last_profile_samples; },
+          sm::description(
+            "Number of live sampled allocations as of the last profile")),
+        sm::make_counter(
+          "profiles_taken",
+          [this] { return _profiles_taken; },
+          sm::description("Number of memory profiles taken")),
+        sm::make_counter(
+          "profile_collection_time_us",
+          [this] { return _profiles_collection_time.count(); },
+          sm::description(
+            "Total time spent collecting memory profiles, in microseconds")),
+      });
 }
 
 ss::future<> memory_sampling::stop() {
@@ -247,3 +294,166 @@ memory_sampling::get_sampled_memory_profiles(std::optional<size_t> shard_id) {
 
     co_return resp;
 }
+
+memory_profile memory_sampling::take_local_profile() {
+    const auto start = std::chrono::steady_clock::now();
+    auto stacks = ss::memory::sampled_memory_profile();
+
+    memory_profile profile;
+    profile.sampling_rate = ss::memory::get_heap_profiling_sample_rate();
+    size_t samples = 0;
+    for (const auto& stack : stacks) {
+        samples += stack.count;
+    }
+    if (stacks.size() > memory_profile::max_sites) {
+        top_n_allocation_sites(stacks, memory_profile::max_sites);
+        auto dropped = stacks.begin() + memory_profile::max_sites;
+        for (auto it = dropped; it != stacks.end(); ++it) {
+            profile.dropped_size += it->size;
+        }
+        profile.dropped_sites = std::distance(dropped, stacks.end());
+        stacks.erase(dropped, stacks.end());
+    }
+
+    profile.sites.reserve(stacks.size());
+    for (const auto& stack : stacks) {
+        memory_profile::site site{.size = stack.size, .count = stack.count};
+        const auto& frames = stack.backtrace.frames();
+        site.frames.reserve(frames.size());
+        for (const auto& frame : frames) {
+            site.frames.push_back(
+              frame.so ? frame.so->begin + frame.addr : frame.addr);
+        }
+        profile.sites.push_back(std::move(site));
+    }
+
+    profile.collection_time
+      = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start);
+    ++_profiles_taken;
+    _profiles_collection_time += profile.collection_time;
+    _last_profile_samples = samples;
+    return profile;
+}
+
+ss::future<memory_profile>
+memory_sampling::take_profile(std::optional<size_t> shard_id) {
+    if (shard_id.has_value()) {
+        co_return co_await container().invoke_on(
+          *shard_id, [](memory_sampling& s) { return s.take_local_profile(); });
+    }
+    co_return co_await container().map_reduce0(
+      [](memory_sampling& s) { return s.take_local_profile(); },
+      memory_profile{},
+      [](memory_profile all, const memory_profile& shard) {
+          all.merge(shard);
+          return all;
+      });
+}
+
+namespace {
+
+using site_index = absl::flat_hash_map<std::vector<uintptr_t>, size_t>;
+
+/// Keeps the max_sites largest sites of \p profile.
+void bound_sites(memory_profile& profile) {
+    auto& sites = profile.sites;
+    if (sites.size() <= memory_profile::max_sites) {
+        return;
+    }
+    auto dropped = sites.begin() + memory_profile::max_sites;
+    std::nth_element(
+      sites.begin(), dropped, sites.end(), [](const auto& l, const auto& r) {
+          return l.size > r.size;
+      });
+    for (auto it = dropped; it != sites.end(); ++it) {
+        profile.dropped_size += it->size;
+    }
+    profile.dropped_sites += std::distance(dropped, sites.end());
+    sites.erase(dropped, sites.end());
+}
+
+} // namespace
+
+void memory_profile::merge(const memory_profile& other) {
+    site_index index;
+    index.reserve(sites.size());
+    for (size_t i = 0; i < sites.size(); ++i) {
+        index.emplace(sites[i].frames, i);
+    }
+    for (const auto& s : other.sites) {
+        auto [it, inserted] = index.emplace(s.frames, sites.size());
+        if (inserted) {
+            sites.push_back(s);
+        } else {
+            sites[it->second].size += s.size;
+            sites[it->second].count += s.count;
+        }
+    }
+    dropped_size += other.dropped_size;
+    dropped_sites += other.dropped_sites;
+    sampling_rate = std::max(sampling_rate, other.sampling_rate);
+    collection_time += other.collection_time;
+    bound_sites(*this);
+}
+
+memory_profile memory_profile::growth_since(const memory_profile& base) const {
+    site_index index;
+    index.reserve(base.sites.size());
+    for (size_t i = 0; i < base.sites.size(); ++i) {
+        index.emplace(base.sites[i].frames, i);
+    }
+
+    memory_profile growth;
+    growth.sampling_rate = sampling_rate;
+    growth.collection_time = base.collection_time + collection_time;
+    for (const auto& s : sites) {
+        size_t base_size = 0;
+        size_t base_count = 0;
+        if (auto it = index.find(s.frames); it != index.end()) {
+            base_size = base.sites[it->second].size;
+            base_count = base.sites[it->second].count;
+        }
+        if (s.size <= base_size) {
+            continue;
+        }
+        growth.sites.push_back(
+          {.size = s.size - base_size,
+           .count = s.count > base_count ? s.count - base_count : 0,
+           .frames = s.frames});
+    }
+    return growth;
+}
+
+ss::sstring memory_profile::to_pprof(std::string_view mapped_libraries) const {
+    size_t total_size = 0;
+    size_t total_count = 0;
+    for (const auto& s : sites) {
+        total_size += s.size;
+        total_count += s.count;
+    }
+
+    fmt::memory_buffer out;
+    auto it = std::back_inserter(out);
+    fmt::format_to(
+      it,
+      "heap profile: {}: {} [0: 0] @ heapprofile\n"
+      "# sampling rate: {} bytes\n"
+      "# collection time: {}us\n"
+      "# sites left out of the table: {} of {} bytes\n",
+      total_count,
+      total_size,
+      sampling_rate,
+      collection_time.count(),
+      dropped_sites,
+      dropped_size);
+    for (const auto& s : sites) {
+        fmt::format_to(it, "{}: {} [0: 0] @", s.count, s.size);
+        for (auto frame : s.frames) {
+            fmt::format_to(it, " {:#x}", frame);
+        }
+        fmt::format_to(it, "\n");
+    }
+    fmt::format_to(it, "\nMAPPED_LIBRARIES:\n{}", mapped_libraries);
+    return {out.data(), out.size()};
+}
@@ -16,6 +16,8 @@
 #include "prometheus/prometheus_sanitize.h"
 #include "resource_mgmt/cpu_scheduling.h"
 
+#include <seastar/core/lowres_clock.hh>
+
 class scheduling_groups_probe {
 public:
     void start(const scheduling_groups& scheduling_groups) {
@@ -50,3 +52,46 @@ public:
 private:
     metrics::public_metric_groups _public_metrics;
 };
+
+/**
+ * Tells whether a scheduling group is under CPU pressure: its tasks were
+ * runnable but waited for the other groups for more than `max_wait_ratio` of
+ * the last sampling interval. Meant as the throttle of the background tasks
+ * of a ssx::work_queue running in the group.
+ */
+class scheduling_group_pressure {
+public:
+    explicit scheduling_group_pressure(
+      ss::scheduling_group sg,
+      double max_wait_ratio = 0.5,
+      ss::lowres_clock::duration interval = std::chrono::milliseconds(100))
+      : _sg(sg)
+      , _max_wait_ratio(max_wait_ratio)
+      , _interval(interval)
+      , _sampled_at(ss::lowres_clock::now())
+      , _waittime(_sg.get_stats().waittime) {}
+
+    bool operator()() {
+        auto now = ss::lowres_clock::now();
+        auto elapsed = now - _sampled_at;
+        if (elapsed < _interval) {
+            return _under_pressure;
+        }
+        auto waittime = _sg.get_stats().waittime;
+        _under_pressure = std::chrono::duration<double>(waittime - _waittime)
+                            .count()
+                          > _max_wait_ratio
+                              * std::chrono::duration<double>(elapsed).count();
+        _sampled_at = now;
+        _waittime = waittime;
+        return _under_pressure;
+    }
+
+private:
+    ss::scheduling_group _sg;
+    double _max_wait_ratio;
+    ss::lowres_clock::duration _interval;
+    ss::lowres_clock::time_point _sampled_at;
+    std::chrono::nanoseconds _waittime;
+    bool _under_pressure{false};
+};
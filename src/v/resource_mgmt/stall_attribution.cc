@@ -0,0 +1,182 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "resource_mgmt/stall_attribution.h"
+
+#include "base/vlog.h"
+#include "config/configuration.h"
+#include "prometheus/prometheus_sanitize.h"
+#include "resource_mgmt/logger.h"
+
+#include <seastar/core/metrics.hh>
+#include <seastar/core/reactor.hh>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <iterator>
+
+namespace resources {
+
+stall_attribution::stall_attribution()
+  : _timer([this] { process_reports(); }) {}
+
+void stall_attribution::start() {
+    if (_started) {
+        return;
+    }
+    _started = true;
+    ss::engine().set_stall_detector_report_function(
+      [this]() noexcept { on_report(); });
+    _timer.arm_periodic(process_interval);
+}
+
+void stall_attribution::stop() {
+    if (!_started) {
+        return;
+    }
+    _started = false;
+    // an empty function restores the logging of the detector
+    ss::engine().set_stall_detector_report_function({});
+    _timer.cancel();
+    process_reports();
+}
+
+void stall_attribution::on_report() noexcept {
+    const auto head = _head.load(std::memory_order_relaxed);
+    if (head - _tail.load(std::memory_order_relaxed) >= max_pending_reports) {
+        _dropped_reports.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    auto& r = _reports[head % max_pending_reports];
+    r.tasks_processed = ss::engine().get_sched_stats().tasks_processed;
+    r.at = clock_type::now();
+    r.sg = ss::current_scheduling_group();
+    r.frame_count = 0;
+    // seastar's own stall report collects the backtrace the same way, from
+    // the signal handler, without allocating
+    ss::backtrace([&r](ss::frame f) {
+        if (r.frame_count < max_frames) {
+            r.frames[r.frame_count++] = f;
+        }
+    });
+    // publishes the report to process_reports
+    std::atomic_signal_fence(std::memory_order_release);
+    _head.store(head + 1, std::memory_order_relaxed);
+}
+
+void stall_attribution::process_reports() {
+    const auto threshold = ss::engine().get_blocked_reactor_notify_ms();
+    std::atomic_signal_fence(std::memory_order_acquire);
+    const auto head = _head.load(std::memory_order_relaxed);
+    auto tail = _tail.load(std::memory_order_relaxed);
+
+    // the reports of a stall are consecutive and all have the count of tasks
+    // processed before the stalled one. This runs on the shard, so every
+    // stall reported so far is over.
+    const report* first = nullptr;
+    std::chrono::milliseconds stalled_for{0};
+    auto finish_stall = [this, &first, &stalled_for] {
+        if (first != nullptr) {
+            auto& s = stats(first->sg);
+            ++s.stalls;
+            s.duration_ms.record(stalled_for.count());
+        }
+    };
+    for (; tail != head; ++tail) {
+        const auto& r = _reports[tail % max_pending_reports];
+        if (first == nullptr || r.tasks_processed != first->tasks_processed) {
+            finish_stall();
+            first = &r;
+        }
+        stalled_for = threshold
+                      + std::chrono::duration_cast<std::chrono::milliseconds>(
+                        r.at - first->at);
+        log_report(r, stalled_for);
+    }
+    finish_stall();
+    _tail.store(tail, std::memory_order_relaxed);
+
+    if (auto dropped = _dropped_reports.exchange(0); dropped > 0) {
+        vlog(
+          resourceslog.warn,
+          "Dropped {} reactor stall reports on shard {}",
+          dropped,
+          ss::this_shard_id());
+    }
+}
+
+void stall_attribution::log_report(
+  const report& r, std::chrono::milliseconds stalled_for) {
+    fmt::memory_buffer backtrace;
+    for (size_t i = 0; i < r.frame_count; ++i) {
+        const auto& f = r.frames[i];
+        if (f.so != nullptr && !f.so->name.empty()) {
+            fmt::format_to(std::back_inserter(backtrace), "{}+", f.so->name);
+        }
+        fmt::format_to(std::back_inserter(backtrace), "{:#x} ", f.addr);
+    }
+    vlog(
+      resourceslog.warn,
+      "Reactor stalled for {} ms on shard {} in scheduling group {}. "
+      "Backtrace: {}",
+      stalled_for.count(),
+      ss::this_shard_id(),
+      r.sg.name(),
+      fmt::to_string(backtrace));
+}
+
+uint64_t stall_attribution::stalls(ss::scheduling_group sg) const {
+    auto it = std::find_if(_groups.begin(), _groups.end(), [sg](auto& g) {
+        return g->sg == sg;
+    });
+    return it == _groups.end() ? 0 : (*it)->stalls;
+}
+
+stall_attribution::group_stats&
+stall_attribution::stats(ss::scheduling_group sg) {
+    auto it = std::find_if(_groups.begin(), _groups.end(), [sg](auto& g) {
+        return g->sg == sg;
+    });
+    if (it != _groups.end()) {
+        return **it;
+    }
+
+    auto& g = *_groups.emplace_back(std::make_unique<group_stats>(sg));
+    if (!config::shard_local_cfg().disable_metrics()) {
+        namespace sm = ss::metrics;
+        const std::vector<sm::label_instance> labels{
+          sm::label("scheduling_group")(sg.name())};
+        g.metrics.add_group(
+          prometheus_sanitize::metrics_name("reactor_stalls"),
+          {
+            sm::make_counter(
+              "count",
+              [&g] { return g.stalls; },
+              sm::description(
+                "Number of reactor stalls that happened in a scheduling "
+                "group"),
+              labels),
+            sm::make_histogram(
+              "duration_ms",
+              [&g] { return g.duration_ms.seastar_histogram_logform(); },
+              sm::description(
+                "Duration of the reactor stalls that happened in a "
+                "scheduling group"),
+              labels),
+          });
+    }
+    return g;
+}
+
+thread_local stall_attribution stall_attribution::_local_instance;
+
+} // namespace resources
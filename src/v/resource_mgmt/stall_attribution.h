@@ -0,0 +1,116 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "base/seastarx.h"
+#include "metrics/metrics.h"
+#include "utils/mergeable_hist.h"
+
+#include <seastar/core/scheduling.hh>
+#include <seastar/core/timer.hh>
+#include <seastar/util/backtrace.hh>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace resources {
+
+/**
+ * @brief Attributes the reactor stalls of a shard to the scheduling group
+ * they happened in.
+ *
+ * Scheduling groups are the boundaries between the components of redpanda
+ * (kafka, fetch, raft, cluster, archival_upload, compaction...), so they tell
+ * which workload is stalling the reactor, with a bounded set of labels.
+ *
+ * Once started, the stall detector of the shard reports to this service
+ * instead of logging. The report runs in the signal handler of the detector:
+ * it only copies the backtrace and the scheduling group of the stalled task
+ * into a fixed ring, dropping the report when the ring is full. A timer then
+ * logs the reports, in the format of seastar with the scheduling group, and
+ * counts the stalls of every group with a histogram of their duration.
+ *
+ * The detector reports a stall once it lasted blocked_reactor_notify_ms,
+ * then again while it lasts. The duration of a stall is the time between
+ * its first and last reports plus the threshold, a lower bound within the
+ * interval between reports.
+ */
+class stall_attribution final {
+public:
+    static constexpr size_t max_pending_reports = 32;
+    static constexpr size_t max_frames = 32;
+    static constexpr auto process_interval = std::chrono::seconds(1);
+
+    stall_attribution();
+    stall_attribution(const stall_attribution&) = delete;
+    stall_attribution& operator=(const stall_attribution&) = delete;
+
+    /// Takes over the reports of the stall detector of this shard.
+    void start();
+    /// Gives the reports back to the stall detector.
+    void stop();
+
+    /// Logs and counts the reports received so far, done periodically.
+    void process_reports();
+
+    /// The number of stalls that happened in \p sg, once processed.
+    uint64_t stalls(ss::scheduling_group sg) const;
+
+    /// The stall_attribution instance of this shard.
+    static stall_attribution& local() { return _local_instance; }
+
+private:
+    using clock_type = std::chrono::steady_clock;
+
+    struct report {
+        uint64_t tasks_processed;
+        clock_type::time_point at;
+        ss::scheduling_group sg;
+        size_t frame_count;
+        std::array<ss::frame, max_frames> frames;
+    };
+
+    struct group_stats {
+        explicit group_stats(ss::scheduling_group sg)
+          : sg(sg) {}
+
+        ss::scheduling_group sg;
+        uint64_t stalls{0};
+        mergeable_hist duration_ms;
+        metrics::internal_metric_groups metrics;
+    };
+
+    // called by the stall detector, in its signal handler
+    void on_report() noexcept;
+    void log_report(const report&, std::chrono::milliseconds stalled_for);
+    group_stats& stats(ss::scheduling_group);
+
+    static thread_local stall_attribution
+      _local_instance; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+    // single producer (the signal handler) single consumer (the timer) ring,
+    // both run on the shard so the handler may only interrupt the consumer
+    std::array<report, max_pending_reports> _reports{};
+    std::atomic<size_t> _head{0};
+    std::atomic<size_t> _tail{0};
+    std::atomic<uint64_t> _dropped_reports{0};
+
+    ss::timer<> _timer;
+    bool _started{false};
+    std::vector<std::unique_ptr<group_stats>> _groups;
+};
+
+} // namespace resources
@@ -16,6 +16,7 @@
 #include <seastar/core/future.hh>
 #include <seastar/core/internal/cpu_profiler.hh>
 #include <seastar/core/lowres_clock.hh>
+#include <seastar/core/scheduling.hh>
 #include <seastar/core/smp.hh>
 #include <seastar/core/thread.hh>
 #include <seastar/core/timer.hh>
@@ -23,6 +24,9 @@
 #include <seastar/coroutine/maybe_yield.hh>
 #include <seastar/testing/test_case.hh>
 #include <seastar/testing/thread_test_case.hh>
+#include <seastar/util/defer.hh>
+
+#include <boost/algorithm/string.hpp>
 
 #include <boost/test/tools/old/interface.hpp>
 #include <boost/test/unit_test.hpp>
@@ -30,6 +34,7 @@
 #include <chrono>
 #include <exception>
 #include <optional>
+#include <set>
 
 namespace {
 ss::future<> busy_loop(std::chrono::milliseconds duration) {
@@ -177,3 +182,48 @@ SEASTAR_TEST_CASE(test_cpu_profiler_enable_override_filter_old_samples) {
     // previous override.
     BOOST_TEST(override_results[ss::this_shard_id()].samples.size() == 0);
 }
+
+SEASTAR_THREAD_TEST_CASE(test_cpu_profiler_scheduling_group_filter) {
+    auto sg = ss::create_scheduling_group("profiled", 100).get();
+    auto destroy_sg = ss::defer(
+      [sg] { ss::destroy_scheduling_group(sg).get(); });
+
+    resources::cpu_profiler cp(
+      config::mock_binding(true), config::mock_binding(2ms));
+    cp.start().get();
+
+    ss::with_scheduling_group(sg, [] { return busy_loop(256ms + 10ms); })
+      .get();
+
+    auto results = cp.shard_results(std::nullopt, "profiled");
+    BOOST_TEST(results.samples.size() >= 1);
+    for (const auto& sample : results.samples) {
+        BOOST_REQUIRE_EQUAL(sample.scheduling_group, "profiled");
+    }
+
+    auto none = cp.shard_results(std::nullopt, "not_a_scheduling_group");
+    BOOST_REQUIRE(none.samples.empty());
+
+    cp.stop().get();
+}
+
+SEASTAR_THREAD_TEST_CASE(test_cpu_profiler_collapsed_stacks) {
+    using sample = resources::cpu_profiler::sample;
+    std::vector<resources::cpu_profiler::shard_samples> results;
+    results.push_back(
+      {.shard = 0,
+       .dropped_samples = 0,
+       .samples = {
+         sample("0x3 0x2 0x1", "kafka", 2), sample("0x5 0x4", "raft", 1)}});
+    results.push_back(
+      {.shard = 1,
+       .dropped_samples = 0,
+       .samples = {sample("0x3 0x2 0x1 ", "kafka", 3)}});
+
+    auto collapsed = resources::cpu_profiler::to_collapsed_stacks(results);
+    std::set<ss::sstring> lines;
+    boost::split(lines, collapsed, boost::is_any_of("\n"));
+    BOOST_REQUIRE(
+      lines
+      == (std::set<ss::sstring>{"", "kafka;0x1;0x2;0x3 5", "raft;0x4;0x5 1"}));
+}
@@ -0,0 +1,58 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "resource_mgmt/memory_accounting.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+#include <absl/container/flat_hash_map.h>
+#include <boost/test/unit_test.hpp>
+
+namespace {
+auto& local() { return resources::memory_accounting::local(); }
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(structures_are_accounted_to_their_subsystem) {
+    using resources::mem_subsystem;
+    const auto before = local().consumption(mem_subsystem::fetch_sessions);
+    const auto others = local().consumption(mem_subsystem::transactions);
+    {
+        auto tracker = local().create_tracker(
+          mem_subsystem::fetch_sessions, "test");
+        auto map = util::mem_tracked::map<absl::flat_hash_map, int, int>(
+          tracker);
+        for (int i = 0; i < 1000; ++i) {
+            map.emplace(i, i);
+        }
+        BOOST_REQUIRE_GT(tracker->consumption(), 0);
+        BOOST_REQUIRE_EQUAL(
+          local().consumption(mem_subsystem::fetch_sessions),
+          before + tracker->consumption());
+
+        auto child = tracker->create_child("child");
+        child->allocate(100);
+        BOOST_REQUIRE_EQUAL(
+          local().consumption(mem_subsystem::fetch_sessions),
+          before + tracker->consumption());
+        child->deallocate(100);
+    }
+    // destroyed trackers leave the subsystem
+    BOOST_REQUIRE_EQUAL(
+      local().consumption(mem_subsystem::fetch_sessions), before);
+    BOOST_REQUIRE_EQUAL(
+      local().consumption(mem_subsystem::transactions), others);
+}
+
+SEASTAR_THREAD_TEST_CASE(subsystems_have_names) {
+    for (auto s : resources::all_mem_subsystems) {
+        BOOST_REQUIRE_NE(resources::to_string_view(s), "unknown");
+        BOOST_REQUIRE_EQUAL(
+          local().root(s).consumption(), local().consumption(s));
+    }
+}
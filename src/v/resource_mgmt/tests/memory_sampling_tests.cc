@@ -26,6 +26,54 @@
 #include <sstream>
 #include <string>
 
+SEASTAR_THREAD_TEST_CASE(test_memory_profile_growth) {
+    memory_profile base;
+    base.sites.push_back({.size = 1000, .count = 1, .frames = {0x10, 0x20}});
+    base.sites.push_back({.size = 5000, .count = 5, .frames = {0x30}});
+
+    memory_profile other_shard;
+    other_shard.sites.push_back({.size = 1000, .count = 1, .frames = {0x30}});
+    other_shard.sites.push_back({.size = 700, .count = 1, .frames = {0x40}});
+    base.merge(other_shard);
+    BOOST_REQUIRE_EQUAL(base.sites.size(), 3);
+
+    memory_profile current;
+    current.sites.push_back({.size = 3000, .count = 3, .frames = {0x10, 0x20}});
+    current.sites.push_back({.size = 2000, .count = 2, .frames = {0x30}});
+    current.sites.push_back({.size = 100, .count = 1, .frames = {0x50}});
+
+    // only the sites that grew remain, by what they gained
+    auto growth = current.growth_since(base);
+    BOOST_REQUIRE_EQUAL(growth.sites.size(), 2);
+    BOOST_REQUIRE_EQUAL(growth.sites[0].size, 2000);
+    BOOST_REQUIRE_EQUAL(growth.sites[0].count, 2);
+    BOOST_REQUIRE_EQUAL(growth.sites[1].size, 100);
+
+    const std::string text = growth.to_pprof(
+      "00400000-00401000 r-xp 00000000 00:00 0 rp\n");
+    BOOST_REQUIRE(
+      text.starts_with("heap profile: 3: 2100 [0: 0] @ heapprofile\n"));
+    auto contains = [&text](std::string_view needle) {
+        return text.find(needle) != std::string::npos;
+    };
+    BOOST_REQUIRE(contains("2: 2000 [0: 0] @ 0x10 0x20\n"));
+    BOOST_REQUIRE(contains("1: 100 [0: 0] @ 0x50\n"));
+    BOOST_REQUIRE(contains("\nMAPPED_LIBRARIES:\n00400000"));
+}
+
+SEASTAR_THREAD_TEST_CASE(test_memory_profile_is_bounded) {
+    memory_profile profile;
+    memory_profile other;
+    for (uintptr_t i = 0; i < memory_profile::max_sites + 10; ++i) {
+        other.sites.push_back({.size = i + 1, .count = 1, .frames = {i}});
+    }
+    profile.merge(other);
+    BOOST_REQUIRE_EQUAL(profile.sites.size(), memory_profile::max_sites);
+    BOOST_REQUIRE_EQUAL(profile.dropped_sites, 10);
+    // the smallest sites are left out
+    BOOST_REQUIRE_EQUAL(profile.dropped_size, 55);
+}
+
 #ifndef SEASTAR_DEFAULT_ALLOCATOR
 
 SEASTAR_THREAD_TEST_CASE(test_no_allocs_in_oom_callback) {
@@ -84,6 +132,7 @@ SEASTAR_THREAD_TEST_CASE(test_low_watermark_logging) {
     memory_sampling sampling(
       dummy_logger,
       config::mock_binding<bool>(true),
+      config::mock_binding<size_t>(memory_sampling::default_sampling_rate),
       std::chrono::seconds(1),
       first_log_limit,
       second_log_limit);
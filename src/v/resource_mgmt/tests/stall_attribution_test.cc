@@ -0,0 +1,47 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "resource_mgmt/stall_attribution.h"
+
+#include <seastar/core/reactor.hh>
+#include <seastar/core/scheduling.hh>
+#include <seastar/testing/thread_test_case.hh>
+#include <seastar/util/defer.hh>
+
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+SEASTAR_THREAD_TEST_CASE(test_stalls_are_attributed_to_scheduling_group) {
+    auto sg = ss::create_scheduling_group("stalling", 100).get();
+    auto prev_threshold = ss::engine().get_blocked_reactor_notify_ms();
+    ss::engine().update_blocked_reactor_notify_ms(10ms);
+    auto& attribution = resources::stall_attribution::local();
+    auto cleanup = ss::defer([&] {
+        attribution.stop();
+        ss::engine().update_blocked_reactor_notify_ms(prev_threshold);
+        ss::destroy_scheduling_group(sg).get();
+    });
+    attribution.start();
+
+    ss::with_scheduling_group(sg, [] {
+        // stall the reactor, without yielding
+        auto until = std::chrono::steady_clock::now() + 100ms;
+        while (std::chrono::steady_clock::now() < until) {
+        }
+    }).get();
+
+    attribution.process_reports();
+    BOOST_REQUIRE_EQUAL(attribution.stalls(sg), 1);
+    BOOST_REQUIRE_EQUAL(attribution.stalls(ss::default_scheduling_group()), 0);
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "rpc/admission_queue.h"
+
+#include "prometheus/prometheus_sanitize.h"
+#include "ssx/sformat.h"
+
+#include <seastar/core/metrics.hh>
+
+#include <algorithm>
+
+namespace rpc {
+
+admission_queue::admission_queue(
+  std::string_view service, admission_limits limits, size_t server_memory)
+  : _service(service)
+  , _memory_quota(std::max<size_t>(
+      static_cast<size_t>(
+        static_cast<double>(server_memory)
+        * std::clamp(limits.memory_share, 0.0, 1.0)),
+      1))
+  , _max_concurrency(std::max<size_t>(limits.max_concurrency, 1))
+  , _memory(_memory_quota, ssx::sformat("rpc/{}/memory", service))
+  , _concurrency(
+      _max_concurrency, ssx::sformat("rpc/{}/concurrency", service)) {}
+
+ss::future<ssx::semaphore_units> admission_queue::admit() {
+    if (_concurrency.available_units() <= 0 || _concurrency.waiters()) {
+        ++_waited_for_admission;
+    }
+    ++_admitted;
+    return ss::get_units(_concurrency, 1);
+}
+
+ss::future<ssx::semaphore_units>
+admission_queue::reserve_memory(size_t ask) {
+    ask = std::min(ask, _memory_quota);
+    if (
+      _memory.available_units() < static_cast<ssize_t>(ask)
+      || _memory.waiters()) {
+        ++_waited_for_memory;
+    }
+    return ss::get_units(_memory, ask);
+}
+
+void admission_queue::setup_metrics() {
+    namespace sm = ss::metrics;
+    auto service_label = sm::label("service");
+    const std::vector<sm::label_instance> labels{service_label(_service)};
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("internal_rpc:admission"),
+      {
+        sm::make_counter(
+          "requests",
+          [this] { return _admitted; },
+          sm::description("Requests admitted to the service"),
+          labels),
+        sm::make_counter(
+          "requests_waited",
+          [this] { return _waited_for_admission; },
+          sm::description(
+            "Requests that waited for the concurrency limit of the service"),
+          labels),
+        sm::make_counter(
+          "memory_waits",
+          [this] { return _waited_for_memory; },
+          sm::description(
+            "Requests that waited for the memory quota of the service"),
+          labels),
+        sm::make_gauge(
+          "requests_inflight",
+          [this] {
+              return _max_concurrency
+                     - static_cast<size_t>(
+                       std::max<ssize_t>(_concurrency.available_units(), 0));
+          },
+          sm::description("Requests of the service being handled"),
+          labels),
+        sm::make_gauge(
+          "queued_requests",
+          [this] { return _concurrency.waiters() + _memory.waiters(); },
+          sm::description("Requests waiting in the service admission queue"),
+          labels),
+        sm::make_gauge(
+          "consumed_mem_bytes",
+          [this] {
+              return _memory_quota
+                     - static_cast<size_t>(
+                       std::max<ssize_t>(_memory.available_units(), 0));
+          },
+          sm::description("Memory of the quota of the service in use"),
+          labels),
+      },
+      {},
+      {sm::shard_label});
+}
+
+} // namespace rpc
@@ -0,0 +1,79 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "base/seastarx.h"
+#include "metrics/metrics.h"
+#include "ssx/semaphore.h"
+
+#include <seastar/core/future.hh>
+
+#include <cstddef>
+#include <string_view>
+
+namespace rpc {
+
+/// \brief limits of the requests of a single service handled by a server
+/// shard at a time
+struct admission_limits {
+    /// share of the memory of the server the requests of the service may use
+    double memory_share;
+    /// requests of the service handled concurrently
+    size_t max_concurrency;
+};
+
+/**
+ * Admits the requests of a service with admission_limits. Requests beyond the
+ * limits of the service wait in its queue, so that a flood of requests of a
+ * bulk service, e.g. data transforms or self test, neither takes all the
+ * memory of the server nor all the time of the shard from other services.
+ *
+ * Like the memory of the server, the limits apply before the request is read,
+ * so a request waiting for admission holds back the following requests on its
+ * connection. Latency sensitive requests should use their own connections,
+ * see rpc_client_traffic_class_connections.
+ */
+class admission_queue {
+public:
+    /// server_memory is the memory of the whole server, the quota of the
+    /// service is its share of it
+    admission_queue(
+      std::string_view service, admission_limits, size_t server_memory);
+
+    admission_queue(const admission_queue&) = delete;
+    admission_queue& operator=(const admission_queue&) = delete;
+    admission_queue(admission_queue&&) = delete;
+    admission_queue& operator=(admission_queue&&) = delete;
+    ~admission_queue() = default;
+
+    /// Waits until the service is below its concurrency limit
+    ss::future<ssx::semaphore_units> admit();
+
+    /// Waits for memory of the quota of the service. Requests larger than
+    /// the quota wait for the entire quota.
+    ss::future<ssx::semaphore_units> reserve_memory(size_t);
+
+    void setup_metrics();
+
+private:
+    ss::sstring _service;
+    size_t _memory_quota;
+    size_t _max_concurrency;
+    ssx::semaphore _memory;
+    ssx::semaphore _concurrency;
+    uint64_t _admitted{0};
+    uint64_t _waited_for_admission{0};
+    uint64_t _waited_for_memory{0};
+    metrics::internal_metric_groups _metrics;
+};
+
+} // namespace rpc
@@ -237,6 +237,34 @@ ss::future<> connection_cache::apply_changes(
               return cache._cache.remove(con.node);
           });
       });
+
+    // Let all shards know where the connections are
+    std::vector<connection_allocation_strategy::connection_assignment_action>
+      added;
+    if (config) {
+        std::copy_if(
+          changes.add_connections.begin(),
+          changes.add_connections.end(),
+          std::back_inserter(added),
+          [&config](const auto& con) {
+              return con.node == config->dest_node;
+          });
+    }
+    co_await container().invoke_on_all(
+      [&added, &removed = changes.remove_connections](connection_cache& cache) {
+          for (const auto& con : removed) {
+              auto it = cache._connection_shards.find(con.node);
+              if (it != cache._connection_shards.end()) {
+                  it->second.erase(con.shard);
+                  if (it->second.empty()) {
+                      cache._connection_shards.erase(it);
+                  }
+              }
+          }
+          for (const auto& con : added) {
+              cache._connection_shards[con.node].insert(con.shard);
+          }
+      });
 }
 
 ss::future<> connection_cache::remove_broker_client_coordinator(
@@ -128,40 +128,77 @@ public:
       ss::shard_id src_shard,
       model::node_id node_id,
       timeout_spec connection_timeout,
+      traffic_class cls,
       Func&& f) {
-        using ret_t = result_wrap_t<std::invoke_result_t<Func, Protocol>>;
-
-        if (is_shutting_down()) {
-            return ss::futurize<ret_t>::convert(
-              rpc::make_error_code(errc::shutting_down));
-        }
+        return with_client_on<Protocol, Func>(
+          rpc::connection_cache::shard_for(self, src_shard, node_id),
+          node_id,
+          connection_timeout,
+          cls,
+          std::forward<Func>(f));
+    }
 
-        auto shard = rpc::connection_cache::shard_for(self, src_shard, node_id);
-        if (!shard) {
-            return ss::futurize<ret_t>::convert(
-              rpc::make_error_code(errc::missing_node_rpc_client));
-        }
+    /// \brief like with_node_client, but sends the request over the
+    /// connection of dest_shard when it has one to the node, if any.
+    ///
+    /// The rpc server uses port based load balancing and the connections of a
+    /// shard use local ports of that shard, so between nodes with the same
+    /// number of cores a connection terminates on the shard it was opened
+    /// from. A request for a partition replica hosted on dest_shard of the
+    /// node is then handled there without hopping across cores again.
+    template<typename Protocol, typename Func>
+    requires requires(Func&& f, Protocol proto) { f(proto); }
+    auto with_node_client_for_shard(
+      model::node_id self,
+      ss::shard_id src_shard,
+      model::node_id node_id,
+      std::optional<ss::shard_id> dest_shard,
+      timeout_spec connection_timeout,
+      Func&& f) {
+        auto shard = dest_shard && has_connection_on(node_id, *dest_shard)
+                       ? dest_shard
+                       : shard_for(self, src_shard, node_id);
+        return with_client_on<Protocol, Func>(
+          shard,
+          node_id,
+          connection_timeout,
+          traffic_class::general,
+          std::forward<Func>(f));
+    }
 
-        return ss::with_gate(
-          _gate,
-          [this,
-           node_id,
-           connection_timeout,
-           shard,
-           f = std::forward<Func>(f)]() mutable {
-              return container().invoke_on(
-                *shard,
-                [node_id, f = std::forward<Func>(f), connection_timeout](
-                  connection_cache& cache) mutable {
-                    if (cache.is_shutting_down()) {
-                        return ss::futurize<ret_t>::convert(
-                          rpc::make_error_code(errc::shutting_down));
-                    }
+    template<typename Protocol, typename Func>
+    requires requires(Func&& f, Protocol proto) { f(proto); }
+    auto with_node_client(
+      model::node_id self,
+      ss::shard_id src_shard,
+      model::node_id node_id,
+      timeout_spec connection_timeout,
+      Func&& f) {
+        return with_node_client<Protocol, Func>(
+          self,
+          src_shard,
+          node_id,
+          connection_timeout,
+          traffic_class::general,
+          std::forward<Func>(f));
+    }
 
-                    return cache._cache.with_node_client<Protocol, Func>(
-                      node_id, connection_timeout, std::forward<Func>(f));
-                });
-          });
+    template<typename Protocol, typename Func, RpcDurationOrPoint Timeout>
+    requires requires(Func&& f, Protocol proto) { f(proto); }
+    auto with_node_client(
+      model::node_id self,
+      ss::shard_id src_shard,
+      model::node_id node_id,
+      Timeout connection_timeout,
+      traffic_class cls,
+      Func&& f) {
+        return with_node_client<Protocol, Func>(
+          self,
+          src_shard,
+          node_id,
+          timeout_spec::from_either(connection_timeout),
+          cls,
+          std::forward<Func>(f));
     }
 
     template<typename Protocol, typename Func, RpcDurationOrPoint Timeout>
@@ -229,6 +266,53 @@ private:
         rpc::backoff_policy backoff;
     };
 
+    template<typename Protocol, typename Func>
+    auto with_client_on(
+      std::optional<ss::shard_id> shard,
+      model::node_id node_id,
+      timeout_spec connection_timeout,
+      traffic_class cls,
+      Func&& f) {
+        using ret_t = result_wrap_t<std::invoke_result_t<Func, Protocol>>;
+
+        if (is_shutting_down()) {
+            return ss::futurize<ret_t>::convert(
+              rpc::make_error_code(errc::shutting_down));
+        }
+
+        if (!shard) {
+            return ss::futurize<ret_t>::convert(
+              rpc::make_error_code(errc::missing_node_rpc_client));
+        }
+
+        return ss::with_gate(
+          _gate,
+          [this,
+           node_id,
+           connection_timeout,
+           cls,
+           shard,
+           f = std::forward<Func>(f)]() mutable {
+              return container().invoke_on(
+                *shard,
+                [node_id, f = std::forward<Func>(f), connection_timeout, cls](
+                  connection_cache& cache) mutable {
+                    if (cache.is_shutting_down()) {
+                        return ss::futurize<ret_t>::convert(
+                          rpc::make_error_code(errc::shutting_down));
+                    }
+
+                    return cache._cache.with_node_client<Protocol, Func>(
+                      node_id, connection_timeout, cls, std::forward<Func>(f));
+                });
+          });
+    }
+
+    bool has_connection_on(model::node_id node, ss::shard_id shard) const {
+        auto it = _connection_shards.find(node);
+        return it != _connection_shards.end() && it->second.contains(shard);
+    }
+
     ss::future<> update_broker_client_coordinator(connection_config);
     ss::future<>
     remove_broker_client_coordinator(model::node_id self, model::node_id dest);
@@ -239,6 +323,9 @@ private:
 
     // Shard-local map that where connections for a given shard are located
     absl::flat_hash_map<model::node_id, ss::shard_id> _connection_map;
+    // Shards holding a connection to a given node, the same on all shards
+    absl::flat_hash_map<model::node_id, absl::flat_hash_set<ss::shard_id>>
+      _connection_shards;
 
     ss::future<> add_or_update_connection_location(
       ss::shard_id dest_shard, model::node_id node, ss::shard_id conn_loc) {
@@ -12,6 +12,7 @@
 #include "rpc/connection_set.h"
 
 #include "rpc/rpc_utils.h"
+#include "ssx/sformat.h"
 
 namespace rpc {
 ss::future<> connection_set::try_add_or_update(
@@ -38,12 +39,51 @@ ss::future<> connection_set::try_add_or_update(
       .disable_metrics = net::metrics_disabled(
         config::shard_local_cfg().disable_metrics),
       .version = get_default_transport_version()};
+    _striped.insert_or_assign(
+      node, striped_connections{.config = config, .backoff = backoff});
     auto trans = ss::make_lw_shared<rpc::reconnect_transport>(
       std::move(config), std::move(backoff), _label, node);
 
     _connections.emplace(node, std::move(trans));
 }
 
+connection_set::transport_ptr
+connection_set::get(model::node_id n, traffic_class cls) {
+    auto conn_it = _connections.find(n);
+    if (conn_it == _connections.end()) {
+        return nullptr;
+    }
+    if (
+      cls == traffic_class::general
+      || !config::shard_local_cfg().rpc_client_traffic_class_connections()) {
+        return conn_it->second;
+    }
+    auto it = _striped.find(n);
+    if (it == _striped.end()) {
+        // connections emplaced directly can't be striped
+        return conn_it->second;
+    }
+    auto& transport = it->second.transports[static_cast<size_t>(cls)];
+    if (!transport) {
+        // the connection is labeled with the traffic class so that its
+        // metrics don't collide with the ones of the general connection
+        auto label = connection_cache_label{
+          _label ? ssx::sformat("{}_{}", (*_label)(), cls)
+                 : ssx::sformat("{}", cls)};
+        transport = ss::make_lw_shared<rpc::reconnect_transport>(
+          it->second.config, it->second.backoff, label, n);
+    }
+    return transport;
+}
+
+ss::future<> connection_set::stop_striped(striped_connections& striped) {
+    for (auto& transport : striped.transports) {
+        if (transport) {
+            co_await transport->stop();
+        }
+    }
+}
+
 ss::future<> connection_set::remove(model::node_id n) {
     auto it = _connections.find(n);
     if (it == _connections.end()) {
@@ -52,6 +92,12 @@ ss::future<> connection_set::remove(model::node_id n) {
     auto ptr = it->second;
     _connections.erase(it);
 
+    if (auto s_it = _striped.find(n); s_it != _striped.end()) {
+        auto striped = std::move(s_it->second);
+        _striped.erase(s_it);
+        co_await stop_striped(striped);
+    }
+
     if (!ptr) {
         co_return;
     }
@@ -61,10 +107,13 @@ ss::future<> connection_set::remove(model::node_id n) {
 
 ss::future<> connection_set::remove_all() {
     auto connections = std::exchange(_connections, {});
+    auto striped = std::exchange(_striped, {});
     co_await parallel_for_each(connections, [](auto& it) {
         auto& [_, cli] = it;
         return cli->stop();
     });
+    co_await parallel_for_each(
+      striped, [](auto& it) { return stop_striped(it.second); });
     connections.clear();
 }
 
@@ -77,6 +126,14 @@ void connection_set::reset_client_backoff(model::node_id node_id) {
     }
     auto recon_transport = conn_it->second;
     recon_transport->reset_backoff();
+
+    if (auto it = _striped.find(node_id); it != _striped.end()) {
+        for (auto& transport : it->second.transports) {
+            if (transport) {
+                transport->reset_backoff();
+            }
+        }
+    }
 }
 
 } // namespace rpc
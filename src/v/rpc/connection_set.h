@@ -29,11 +29,18 @@
 
 #include <absl/container/flat_hash_map.h>
 
+#include <array>
 #include <chrono>
 #include <unordered_map>
 
 namespace rpc {
 
+/// Set of client connections to peers, one per peer for the general traffic.
+///
+/// With rpc_client_traffic_class_connections enabled, control and bulk
+/// requests (see traffic_class) use separate connections to the peer, each
+/// with its own output stream and send queue. These are created with the same
+/// configuration as the general one the first time they are used.
 class connection_set {
 public:
     using transport_ptr = ss::lw_shared_ptr<rpc::reconnect_transport>;
@@ -61,6 +68,10 @@ public:
         return _connections.find(n)->second;
     }
 
+    /// Returns the connection used for the traffic class, nullptr if there is
+    /// no connection to the node
+    transport_ptr get(model::node_id n, traffic_class);
+
     bool contains(model::node_id n) const {
         return _connections.find(n) != _connections.cend();
     }
@@ -92,18 +103,21 @@ public:
     template<typename Protocol, typename Func>
     requires requires(Func&& f, Protocol proto) { f(proto); }
     auto with_node_client(
-      model::node_id node_id, timeout_spec connection_timeout, Func&& f) {
+      model::node_id node_id,
+      timeout_spec connection_timeout,
+      traffic_class cls,
+      Func&& f) {
         using ret_t = result_wrap_t<std::invoke_result_t<Func, Protocol>>;
-        auto conn_it = _connections.find(node_id);
+        auto transport = get(node_id, cls);
 
-        if (conn_it == _connections.end()) {
+        if (!transport) {
             // No client available
             return ss::futurize<ret_t>::convert(
               rpc::make_error_code(errc::missing_node_rpc_client));
         }
 
         return ss::do_with(
-          conn_it->second,
+          std::move(transport),
           [connection_timeout = connection_timeout.timeout_at(),
            f = std::forward<Func>(f)](auto& transport_ptr) mutable {
               return transport_ptr->get_connected(connection_timeout)
@@ -120,6 +134,17 @@ public:
           });
     }
 
+    template<typename Protocol, typename Func>
+    requires requires(Func&& f, Protocol proto) { f(proto); }
+    auto with_node_client(
+      model::node_id node_id, timeout_spec connection_timeout, Func&& f) {
+        return with_node_client<Protocol, Func>(
+          node_id,
+          connection_timeout,
+          traffic_class::general,
+          std::forward<Func>(f));
+    }
+
     template<typename Protocol, typename Func, RpcDurationOrPoint Timeout>
     requires requires(Func&& f, Protocol proto) { f(proto); }
     auto with_node_client(
@@ -139,7 +164,18 @@ public:
 private:
     using underlying = std::unordered_map<model::node_id, transport_ptr>;
 
+    // configuration of the general connection to a node, used to create the
+    // connections of the other traffic classes
+    struct striped_connections {
+        rpc::transport_configuration config;
+        rpc::backoff_policy backoff;
+        std::array<transport_ptr, traffic_class_count> transports;
+    };
+
+    static ss::future<> stop_striped(striped_connections&);
+
     underlying _connections;
+    absl::flat_hash_map<model::node_id, striped_connections> _striped;
     transport_version _default_transport_version{transport_version::v2};
     std::optional<connection_cache_label> _label;
 };
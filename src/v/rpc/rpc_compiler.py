@@ -109,6 +109,10 @@ public:
        return _ssg;
     }
 
+    std::string_view name() const final {
+       return "{{service_name}}";
+    }
+
     ::rpc::method* method_from_id(uint32_t id) final {
        switch(id) {
        {%- for method in methods %}
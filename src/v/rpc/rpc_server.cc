@@ -17,6 +17,7 @@
 #include <seastar/core/condition-variable.hh>
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/future-util.hh>
+#include <seastar/core/with_scheduling_group.hh>
 
 #include <exception>
 
@@ -36,11 +37,21 @@ struct server_context_impl final : streaming_context {
         server.probe().request_received();
     }
     ss::future<ssx::semaphore_units> reserve_memory(size_t ask) final {
+        if (admission) {
+            // the quota of the service first, so that requests of a service
+            // over its quota don't hold memory of the server
+            admission_units.push_back(co_await admission->reserve_memory(ask));
+        }
         auto fut = get_units(server.memory(), ask);
         if (server.memory().waiters()) {
             server.probe().waiting_for_available_memory();
         }
-        return fut;
+        co_return co_await std::move(fut);
+    }
+    ss::future<> admit() {
+        if (admission) {
+            admission_units.push_back(co_await admission->admit());
+        }
     }
     ~server_context_impl() override { server.probe().request_completed(); }
     const header& get_header() const final { return hdr; }
@@ -52,8 +63,25 @@ struct server_context_impl final : streaming_context {
     ss::lw_shared_ptr<net::connection> conn;
     header hdr;
     ss::promise<> pr;
+    // admission queue of the service of the method, if it has limits
+    admission_queue* admission{nullptr};
+    // held until the reply is sent
+    std::vector<ssx::semaphore_units> admission_units;
 };
 
+void rpc_server::add_admission_queue(const service& s, bool setup_metrics) {
+    auto limits = s.get_admission_limits();
+    if (!limits) {
+        return;
+    }
+    auto queue = std::make_unique<admission_queue>(
+      s.name(), *limits, static_cast<size_t>(cfg.max_service_memory_per_core));
+    if (setup_metrics) {
+        queue->setup_metrics();
+    }
+    _admission_queues.emplace(&s, std::move(queue));
+}
+
 ss::future<> rpc_server::apply(ss::lw_shared_ptr<net::connection> conn) {
     return ss::do_until(
       [this, conn] { return conn->input().eof() || abort_requested(); },
@@ -74,12 +102,14 @@ ss::future<> rpc_server::apply(ss::lw_shared_ptr<net::connection> conn) {
       });
 }
 
-ss::future<>
-rpc_server::send_reply(ss::lw_shared_ptr<server_context_impl> ctx, netbuf buf) {
+ss::future<> rpc_server::send_reply(
+  ss::lw_shared_ptr<server_context_impl> ctx,
+  netbuf buf,
+  compression_policy compression) {
     if (config::shard_local_cfg().rpc_server_compress_replies()) {
-        buf.set_min_compression_bytes(reply_min_compression_bytes);
-        buf.set_compression(rpc::compression_type::zstd);
+        compression = compression_policy::above(reply_min_compression_bytes);
     }
+    compression.apply(buf);
     buf.set_correlation_id(ctx->get_header().correlation_id);
 
     auto view = co_await std::move(buf).as_scattered();
@@ -194,12 +224,24 @@ ss::future<> rpc_server::dispatch_method_once(
               }
 
               method* m = it->get()->method_from_id(method_id);
+              const auto compression = it->get()->reply_compression();
+              const auto sg = it->get()->get_scheduling_group();
+              if (auto q = _admission_queues.find(it->get());
+                  q != _admission_queues.end()) {
+                  ctx->admission = q->second.get();
+              }
 
-              return m->handle(ctx->conn->input(), *ctx)
+              return ctx->admit()
+                .then([ctx, m, sg] {
+                    return ss::with_scheduling_group(sg, [ctx, m] {
+                        return m->handle(ctx->conn->input(), *ctx);
+                    });
+                })
                 .then_wrapped([this,
                                ctx,
                                m,
                                method_id,
+                               compression,
                                l = hist().auto_measure()](
                                 ss::future<netbuf> fut) mutable {
                     bool error = true;
@@ -278,7 +320,7 @@ ss::future<> rpc_server::dispatch_method_once(
                          */
                         reply_buf.set_version(ctx->get_header().version);
                     }
-                    return send_reply(ctx, std::move(reply_buf))
+                    return send_reply(ctx, std::move(reply_buf), compression)
                       .finally([m, l = std::move(l)]() mutable {
                           m->probes.latency_hist().record(
                             l->compute_total_latency().count());
@@ -11,8 +11,11 @@
 #include "base/vassert.h"
 #include "config/configuration.h"
 #include "net/server.h"
+#include "rpc/admission_queue.h"
 #include "rpc/service.h"
 
+#include <absl/container/flat_hash_map.h>
+
 namespace rpc {
 
 struct service;
@@ -45,10 +48,12 @@ public:
         vassert(
           !_all_services_added,
           "Adding service after all services already added");
-        if (!config::shard_local_cfg().disable_metrics()) {
-            for (auto& s : services) {
+        const bool metrics = !config::shard_local_cfg().disable_metrics();
+        for (auto& s : services) {
+            if (metrics) {
                 s->setup_metrics();
             }
+            add_admission_queue(*s, metrics);
         }
         std::move(
           services.begin(), services.end(), std::back_inserter(_services));
@@ -63,18 +68,26 @@ public:
     template<std::derived_from<service> T, typename... Args>
     void register_service(Args&&... args) {
         _services.push_back(std::make_unique<T>(std::forward<Args>(args)...));
+        add_admission_queue(*_services.back(), false);
     }
 
 private:
+    void add_admission_queue(const service&, bool setup_metrics);
     ss::future<>
       dispatch_method_once(header, ss::lw_shared_ptr<net::connection>);
-    ss::future<> send_reply(ss::lw_shared_ptr<server_context_impl>, netbuf);
+    ss::future<> send_reply(
+      ss::lw_shared_ptr<server_context_impl>,
+      netbuf,
+      compression_policy = compression_policy::never());
     ss::future<>
       send_reply_skip_payload(ss::lw_shared_ptr<server_context_impl>, netbuf);
 
     bool _all_services_added{false};
     bool _service_unavailable_allowed{false};
     std::vector<std::unique_ptr<service>> _services;
+    // queues of the services with admission limits
+    absl::flat_hash_map<const service*, std::unique_ptr<admission_queue>>
+      _admission_queues;
 };
 
 } // namespace rpc
@@ -13,6 +13,7 @@
 
 #include "base/seastarx.h"
 #include "reflection/async_adl.h"
+#include "rpc/admission_queue.h"
 #include "rpc/parse_utils.h"
 #include "rpc/types.h"
 #include "ssx/sformat.h"
@@ -22,6 +23,8 @@
 #include <seastar/core/scheduling.hh>
 
 #include <cstdint>
+#include <optional>
+#include <string_view>
 
 namespace rpc {
 
@@ -37,6 +40,18 @@ struct service {
     /// \brief return nullptr when method not found
     virtual method* method_from_id(uint32_t) = 0;
     virtual void setup_metrics() = 0;
+    virtual std::string_view name() const = 0;
+    /// \brief limits of the requests of the service, the requests of services
+    /// without limits are only limited by the memory of the server. Methods
+    /// of all services run in the scheduling group of their service.
+    virtual std::optional<admission_limits> get_admission_limits() const {
+        return std::nullopt;
+    }
+    /// \brief compression of the replies of the service, the replies of all
+    /// services are compressed when rpc_server_compress_replies is set
+    virtual compression_policy reply_compression() const {
+        return compression_policy::never();
+    }
 };
 
 class rpc_internal_body_parsing_exception : public std::exception {
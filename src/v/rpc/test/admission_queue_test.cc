@@ -0,0 +1,47 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "rpc/admission_queue.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+#include <vector>
+
+SEASTAR_THREAD_TEST_CASE(admission_queue_concurrency_limit) {
+    rpc::admission_queue queue(
+      "test", {.memory_share = 1.0, .max_concurrency = 2}, 1024);
+
+    std::vector<ssx::semaphore_units> admitted;
+    admitted.push_back(queue.admit().get());
+    admitted.push_back(queue.admit().get());
+
+    auto third = queue.admit();
+    BOOST_REQUIRE(!third.available());
+
+    admitted.pop_back();
+    auto units = third.get();
+    BOOST_REQUIRE_EQUAL(units.count(), 1);
+}
+
+SEASTAR_THREAD_TEST_CASE(admission_queue_memory_quota) {
+    // a quarter of the server memory
+    rpc::admission_queue queue(
+      "test", {.memory_share = 0.25, .max_concurrency = 16}, 1024);
+
+    auto first = queue.reserve_memory(200).get();
+    auto second = queue.reserve_memory(100);
+    BOOST_REQUIRE(!second.available());
+    first.return_all();
+    BOOST_REQUIRE_EQUAL(second.get().count(), 100);
+
+    // requests larger than the quota wait for the whole quota rather than
+    // forever
+    auto large = queue.reserve_memory(4096).get();
+    BOOST_REQUIRE_EQUAL(large.count(), 256);
+}
@@ -8,6 +8,7 @@
 // by the Apache License, Version 2.0
 
 #include "base/vlog.h"
+#include "config/configuration.h"
 #include "config/tls_config.h"
 #include "model/metadata.h"
 #include "rpc/connection_cache.h"
@@ -115,3 +116,38 @@ SEASTAR_THREAD_TEST_CASE(connection_allocation_strategy_remove_test) {
         BOOST_REQUIRE(map_rm != change_rm.remove_mapping.end());
     }
 }
+
+SEASTAR_THREAD_TEST_CASE(connection_set_traffic_class_striping_test) {
+    rpc::connection_set connections(rpc::connection_cache_label{"test"});
+    const model::node_id node{1};
+    connections
+      .try_add_or_update(
+        node, net::unresolved_address("127.0.0.1", 33145), config::tls_config{})
+      .get();
+    // all the traffic classes share a connection unless striping is enabled
+    auto general = connections.get(node);
+    BOOST_REQUIRE(
+      connections.get(node, rpc::traffic_class::control) == general);
+    BOOST_REQUIRE(connections.get(node, rpc::traffic_class::bulk) == general);
+
+    config::shard_local_cfg().rpc_client_traffic_class_connections.set_value(
+      true);
+    auto control = connections.get(node, rpc::traffic_class::control);
+    auto bulk = connections.get(node, rpc::traffic_class::bulk);
+    BOOST_REQUIRE(control && bulk);
+    BOOST_REQUIRE(control != general);
+    BOOST_REQUIRE(bulk != general);
+    BOOST_REQUIRE(bulk != control);
+    BOOST_REQUIRE(
+      connections.get(node, rpc::traffic_class::general) == general);
+    // connections are created once and reused
+    BOOST_REQUIRE(
+      connections.get(node, rpc::traffic_class::control) == control);
+
+    // unknown nodes have no connection in any class
+    BOOST_REQUIRE(
+      !connections.get(model::node_id{2}, rpc::traffic_class::bulk));
+
+    config::shard_local_cfg().rpc_client_traffic_class_connections.reset();
+    connections.remove_all().get();
+}
@@ -0,0 +1,230 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "base/units.h"
+#include "config/tls_config.h"
+#include "model/metadata.h"
+#include "net/dns.h"
+#include "random/generators.h"
+#include "rpc/connection_cache.h"
+#include "rpc/rpc_server.h"
+#include "rpc/test/echo_v2_service.h"
+#include "utils/hdr_hist.h"
+
+#include <seastar/core/abort_source.hh>
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/loop.hh>
+#include <seastar/core/map_reduce.hh>
+#include <seastar/core/memory.hh>
+#include <seastar/core/sharded.hh>
+#include <seastar/core/smp.hh>
+#include <seastar/testing/perf_tests.hh>
+
+#include <boost/range/irange.hpp>
+#include <fmt/core.h>
+
+#include <chrono>
+
+/*
+ * Round trips of the rpc_server and the connection_cache over loopback TCP,
+ * optionally TLS, on all the shards. The server listens on every shard and
+ * the connection cache spreads its connections over the shards, like between
+ * two brokers. Every run sends `Concurrency` echo requests of `PayloadSize`
+ * bytes in parallel, perf_tests reports the time per request. The summary
+ * printed at the end of each test adds the throughput, the latency
+ * percentiles and the allocations per request of all the shards.
+ *
+ * The TLS tests expect the certificates of rpc/test in the working directory.
+ */
+
+namespace {
+
+constexpr uint16_t bench_port = 32149;
+const model::node_id self_node{0};
+const model::node_id server_node{1};
+constexpr auto request_timeout = std::chrono::seconds(10);
+
+struct echo_service final
+  : echo_v2::echo_service_base<rpc::default_message_codec> {
+    echo_service(ss::scheduling_group sg, ss::smp_service_group ssg)
+      : echo_v2::echo_service_base<rpc::default_message_codec>(sg, ssg) {}
+
+    ss::future<echo_v2::echo_resp>
+    echo(echo_v2::echo_req req, rpc::streaming_context&) final {
+        return ss::make_ready_future<echo_v2::echo_resp>(
+          echo_v2::echo_resp{.str = std::move(req.str)});
+    }
+};
+
+// allocations of all the shards so far
+ss::future<size_t> allocations() {
+    return ss::map_reduce(
+      boost::irange<unsigned>(0, ss::smp::count),
+      [](unsigned shard) {
+          return ss::smp::submit_to(
+            shard, [] { return ss::memory::stats().mallocs(); });
+      },
+      size_t{0},
+      std::plus<>());
+}
+
+config::tls_config bench_tls_config(bool tls) {
+    if (!tls) {
+        return {};
+    }
+    return config::tls_config(
+      true,
+      config::key_cert{"redpanda.key", "redpanda.crt"},
+      "root_certificate_authority.chain_cert",
+      false);
+}
+
+} // namespace
+
+template<size_t PayloadSize, size_t Concurrency, bool Tls>
+class rpc_e2e_bench {
+public:
+    rpc_e2e_bench()
+      : _address("127.0.0.1", bench_port)
+      , _ssg(ss::create_smp_service_group({5000}).get())
+      , _payload(random_generators::gen_alphanum_string(PayloadSize)) {
+        const auto tls = bench_tls_config(Tls);
+        auto credentials = tls.get_credentials_builder().get();
+
+        net::server_configuration scfg("rpc_e2e_bench");
+        scfg.disable_metrics = net::metrics_disabled::yes;
+        scfg.disable_public_metrics = net::public_metrics_disabled::yes;
+        scfg.addrs.emplace_back(
+          net::resolve_dns(_address).get(),
+          credentials
+            ? credentials->build_reloadable_server_credentials().get()
+            : nullptr);
+        scfg.max_service_memory_per_core = static_cast<int64_t>(
+          ss::memory::stats().total_memory() / 10);
+        _server.start(std::move(scfg)).get();
+        _server
+          .invoke_on_all([ssg = _ssg](rpc::rpc_server& s) {
+              s.register_service<echo_service>(
+                ss::default_scheduling_group(), ssg);
+          })
+          .get();
+        _server.invoke_on_all(&rpc::rpc_server::start).get();
+
+        _as.start().get();
+        _cache.start(std::ref(_as)).get();
+        _cache.local()
+          .update_broker_client(self_node, server_node, _address, tls)
+          .get();
+    }
+
+    rpc_e2e_bench(const rpc_e2e_bench&) = delete;
+    rpc_e2e_bench(rpc_e2e_bench&&) = delete;
+    rpc_e2e_bench& operator=(const rpc_e2e_bench&) = delete;
+    rpc_e2e_bench& operator=(rpc_e2e_bench&&) = delete;
+
+    ~rpc_e2e_bench() {
+        print_summary();
+        _cache.stop().get();
+        _as.stop().get();
+        _server.stop().get();
+        ss::destroy_smp_service_group(_ssg).get();
+    }
+
+    ss::future<size_t> run() {
+        const auto allocs_before = co_await allocations();
+        const auto start = clock_type::now();
+        perf_tests::start_measuring_time();
+        co_await ss::parallel_for_each(
+          boost::irange<size_t>(0, Concurrency),
+          [this](size_t) { return round_trip(); });
+        perf_tests::stop_measuring_time();
+        _measured += clock_type::now() - start;
+        _allocations += co_await allocations() - allocs_before;
+        co_return Concurrency;
+    }
+
+private:
+    using clock_type = std::chrono::steady_clock;
+
+    ss::future<> round_trip() {
+        const auto start = clock_type::now();
+        auto reply = co_await _cache.local()
+                       .with_node_client<echo_v2::echo_client_protocol>(
+                         self_node,
+                         ss::this_shard_id(),
+                         server_node,
+                         request_timeout,
+                         [this](echo_v2::echo_client_protocol proto) mutable {
+                             return proto
+                               .echo(
+                                 echo_v2::echo_req{.str = _payload},
+                                 rpc::client_opts(request_timeout))
+                               .then(&rpc::get_ctx_data<echo_v2::echo_resp>);
+                         });
+        if (!reply) {
+            throw std::runtime_error(
+              fmt::format("echo failed: {}", reply.error().message()));
+        }
+        _latency.record(
+          std::chrono::duration_cast<std::chrono::microseconds>(
+            clock_type::now() - start)
+            .count());
+        ++_requests;
+        // the payload goes both ways
+        _bytes += 2 * PayloadSize;
+    }
+
+    void print_summary() const {
+        const auto seconds = std::chrono::duration<double>(_measured).count();
+        if (_requests == 0 || seconds <= 0) {
+            return;
+        }
+        fmt::print(
+          "payload: {}B concurrency: {} tls: {} shards: {} requests: {} "
+          "req/s: {:.0f} MiB/s: {:.2f} latency us p50: {} p99: {} p999: {} "
+          "allocs/req: {:.1f}\n",
+          PayloadSize,
+          Concurrency,
+          Tls,
+          ss::smp::count,
+          _requests,
+          static_cast<double>(_requests) / seconds,
+          static_cast<double>(_bytes) / seconds / static_cast<double>(1_MiB),
+          _latency.get_value_at(50.0),
+          _latency.get_value_at(99.0),
+          _latency.get_value_at(99.9),
+          static_cast<double>(_allocations) / static_cast<double>(_requests));
+    }
+
+    net::unresolved_address _address;
+    ss::smp_service_group _ssg;
+    ss::sstring _payload;
+    ss::sharded<rpc::rpc_server> _server;
+    ss::sharded<ss::abort_source> _as;
+    ss::sharded<rpc::connection_cache> _cache;
+
+    hdr_hist _latency{60'000'000, 1, 3};
+    clock_type::duration _measured{0};
+    size_t _requests{0};
+    size_t _bytes{0};
+    size_t _allocations{0};
+};
+
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define RPC_E2E_PERF_TEST(name, payload_size, concurrency, tls)                \
+    class rpc_e2e_##name                                                       \
+      : public rpc_e2e_bench<payload_size, concurrency, tls> {};               \
+    PERF_TEST_F(rpc_e2e_##name, echo) { return run(); }
+
+RPC_E2E_PERF_TEST(small_serial, 128, 1, false);
+RPC_E2E_PERF_TEST(small_concurrent, 128, 64, false);
+RPC_E2E_PERF_TEST(medium_concurrent, 16_KiB, 16, false);
+RPC_E2E_PERF_TEST(large_concurrent, 1_MiB, 4, false);
+RPC_E2E_PERF_TEST(small_concurrent_tls, 128, 64, true);
+RPC_E2E_PERF_TEST(medium_concurrent_tls, 16_KiB, 16, true);
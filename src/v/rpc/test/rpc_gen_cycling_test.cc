@@ -118,6 +118,12 @@ struct echo_v2_impl final : echo_v2::echo_service_base<Codec> {
         return ss::make_ready_future<echo_v2::echo_resp>(
           echo_v2::echo_resp{.str = req.str, .str_two = req.str_two});
     }
+
+    rpc::compression_policy reply_compression() const final {
+        return rpc::compression_policy::above(reply_compression_bytes);
+    }
+
+    static constexpr size_t reply_compression_bytes = 1024;
 };
 
 class rpc_integration_fixture : public rpc_simple_integration_fixture {
@@ -589,6 +595,41 @@ FIXTURE_TEST(rpc_mixed_compression, rpc_integration_fixture) {
     client.stop().get();
 }
 
+FIXTURE_TEST(rpc_service_reply_compression, rpc_integration_fixture) {
+    using echo_v2_service = echo_v2_impl<rpc::default_message_codec>;
+    configure_server();
+    register_services();
+    start_server();
+
+    auto client = rpc::make_client<echo_v2::echo_client_protocol>(
+      client_config());
+    client.connect(model::no_timeout).get();
+
+    // small replies are sent as is
+    auto reply = client
+                   .echo(
+                     echo_v2::echo_req{.str = "small", .str_two = "reply"},
+                     rpc::client_opts(rpc::no_timeout))
+                   .get0();
+    BOOST_REQUIRE(
+      reply.value().hdr.compression == rpc::compression_type::none);
+    BOOST_REQUIRE_EQUAL(reply.value().data.str, "small");
+
+    const auto data = random_generators::gen_alphanum_string(
+      echo_v2_service::reply_compression_bytes);
+    reply = client
+              .echo(
+                echo_v2::echo_req{.str = data, .str_two = data},
+                rpc::client_opts(rpc::no_timeout))
+              .get0();
+    BOOST_REQUIRE(
+      reply.value().hdr.compression == rpc::compression_type::zstd);
+    BOOST_REQUIRE_EQUAL(reply.value().data.str, data);
+    BOOST_REQUIRE_EQUAL(reply.value().data.str_two, data);
+
+    client.stop().get();
+}
+
 FIXTURE_TEST(ordering_test, rpc_integration_fixture) {
     configure_server();
     register_services();
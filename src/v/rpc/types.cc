@@ -68,6 +68,18 @@ std::ostream& operator<<(std::ostream& o, const status& s) {
     }
 }
 
+std::ostream& operator<<(std::ostream& o, traffic_class c) {
+    switch (c) {
+    case traffic_class::general:
+        return o << "general";
+    case traffic_class::control:
+        return o << "control";
+    case traffic_class::bulk:
+        return o << "bulk";
+    }
+    return o << "unknown";
+}
+
 std::ostream& operator<<(std::ostream& o, transport_version v) {
     fmt::print(
       o,
@@ -37,6 +37,7 @@
 #include <cstdint>
 #include <iosfwd>
 #include <limits>
+#include <optional>
 #include <type_traits>
 #include <vector>
 
@@ -162,6 +163,22 @@ inline constexpr timeout_spec timeout_spec::none = {
 using connection_cache_label
   = named_type<ss::sstring, struct connection_cache_label_tag>;
 
+/// Class of the requests sent to a peer. When client connections are striped
+/// by traffic class, every class uses its own connection, so that small latency
+/// sensitive requests don't queue behind large ones.
+enum class traffic_class : uint8_t {
+    // everything else, e.g. replication
+    general = 0,
+    // small latency sensitive requests, e.g. raft heartbeats and votes
+    control,
+    // large transfers, e.g. snapshots sent to recovering replicas
+    bulk,
+};
+
+inline constexpr size_t traffic_class_count = 3;
+
+std::ostream& operator<<(std::ostream&, traffic_class);
+
 enum class compression_type : uint8_t {
     none = 0,
     zstd,
@@ -414,6 +431,46 @@ inline void netbuf::set_min_compression_bytes(size_t min) {
     _min_compression_bytes = min;
 }
 
+/**
+ * Compression of the payloads of a service on the wire: never, always or
+ * only for payloads of at least min_bytes bytes. Every supported transport
+ * version decodes zstd payloads, so the policy only depends on the sender.
+ */
+struct compression_policy {
+    compression_type type{compression_type::none};
+    size_t min_bytes{0};
+
+    static compression_policy never() { return {}; }
+    static compression_policy always() {
+        return {.type = compression_type::zstd, .min_bytes = 0};
+    }
+    static compression_policy above(size_t min_bytes) {
+        return {.type = compression_type::zstd, .min_bytes = min_bytes};
+    }
+    /// Policy of a `<name>_compression_bytes` style property: no value
+    /// disables compression
+    static compression_policy from_threshold(std::optional<size_t> bytes) {
+        return bytes ? above(*bytes) : never();
+    }
+
+    bool enabled() const { return type != compression_type::none; }
+
+    void apply(netbuf& b) const {
+        if (enabled()) {
+            b.set_compression(type);
+            b.set_min_compression_bytes(min_bytes);
+        }
+    }
+
+    /// Options set explicitly by the caller take precedence
+    void apply(client_opts& opts) const {
+        if (enabled() && opts.compression == compression_type::none) {
+            opts.compression = type;
+            opts.min_compression_bytes = min_bytes;
+        }
+    }
+};
+
 class method_probes {
 public:
     using hist_t = log_hist_internal;
@@ -114,19 +114,21 @@ acl_store::find(resource_type resource, const ss::sstring& name) const {
     }
 
     /*
-     * the acls are sorted within (resource-type, pattern-type) bounds by name
-     * in reverse order so longer names (prefixes) appear first.
+     * longer prefixes come first.
      */
     std::vector<acl_matches::entry_set_ref> prefixes;
-    {
-        auto it = _acls.lower_bound(
-          resource_pattern(resource, name, pattern_type::prefixed));
-
-        auto end = _acls.upper_bound(resource_pattern(
-          resource, name.substr(0, 1), pattern_type::prefixed));
-
-        for (; it != end; ++it) {
-            if (std::string_view(name).starts_with(it->first.name())) {
+    if (const auto lengths = _prefix_lengths.find(resource);
+        lengths != _prefix_lengths.end()) {
+        for (auto len : lengths->second) {
+            if (len > name.size()) {
+                continue;
+            }
+            if (len == 0) {
+                break;
+            }
+            const auto it = _acls.find(resource_pattern(
+              resource, name.substr(0, len), pattern_type::prefixed));
+            if (it != _acls.end()) {
                 prefixes.emplace_back(it->first, it->second);
             }
         }
@@ -170,6 +172,10 @@ std::vector<std::vector<acl_binding>> acl_store::remove_bindings(
         }
     }
 
+    if (!dry_run) {
+        ++_revision;
+    }
+
     // deleted binding index of deleted filter that matched
     absl::flat_hash_map<acl_binding, size_t> deleted;
 
@@ -238,11 +244,16 @@ ss::future<fragmented_vector<acl_binding>> acl_store::all_bindings() const {
 ss::future<>
 acl_store::reset_bindings(const fragmented_vector<acl_binding>& bindings) {
     // NOTE: not coroutinized because otherwise clang-14 crashes.
+    ++_revision;
     _acls.clear();
+    _prefix_lengths.clear();
     return ss::do_for_each(
              bindings,
              [this](const auto& binding) {
-                 _acls[binding.pattern()].insert(binding.entry());
+                 // the store changes between yields, so may only be cached
+                 // for as long
+                 ++_revision;
+                 insert_pattern(binding.pattern()).insert(binding.entry());
              })
       .then([this] {
           return ss::do_for_each(_acls, [](auto& kv) { kv.second.rehash(); });
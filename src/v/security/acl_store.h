@@ -12,6 +12,8 @@
 #include "security/acl.h"
 
 #include <absl/container/btree_map.h>
+#include <absl/container/btree_set.h>
+#include <absl/container/flat_hash_map.h>
 #include <absl/container/node_hash_set.h>
 
 namespace security {
@@ -134,8 +136,9 @@ public:
     ~acl_store() noexcept = default;
 
     void add_bindings(const std::vector<acl_binding>& bindings) {
+        ++_revision;
         for (auto& binding : bindings) {
-            auto& entries = _acls[binding.pattern()];
+            auto& entries = insert_pattern(binding.pattern());
             entries.insert(binding.entry());
             entries.rehash();
         }
@@ -155,7 +158,18 @@ public:
     ss::future<fragmented_vector<acl_binding>> all_bindings() const;
     ss::future<> reset_bindings(const fragmented_vector<acl_binding>& bindings);
 
+    // Changes every time the bindings change, so that results computed from
+    // the bindings can be cached until then.
+    uint64_t revision() const { return _revision; }
+
 private:
+    acl_entry_set& insert_pattern(const resource_pattern& pattern) {
+        if (pattern.pattern() == pattern_type::prefixed) {
+            _prefix_lengths[pattern.resource()].insert(pattern.name().size());
+        }
+        return _acls[pattern];
+    }
+
     /*
      * resource pattern ordering:
      *
@@ -178,6 +192,13 @@ private:
 
     absl::btree_map<resource_pattern, acl_entry_set, resource_pattern_compare>
       _acls;
+    // The lengths of the prefixed patterns of each resource type, longest
+    // first. Finding the prefixes of a name looks up the prefixes of the name
+    // with these lengths, rather than scanning every pattern that sorts
+    // between the name and its first character.
+    absl::flat_hash_map<resource_type, absl::btree_set<size_t, std::greater<>>>
+      _prefix_lengths;
+    uint64_t _revision{0};
 };
 
 } // namespace security
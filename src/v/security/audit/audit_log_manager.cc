@@ -509,8 +509,12 @@ ss::future<> audit_client::produce(
 ss::future<> audit_client::do_produce(
   std::vector<kafka::client::record_essence> records, audit_probe& probe) {
     const auto n_records = records.size();
+    /// Keep all the records of a drain in one batch, so that the batch
+    /// compresses well, rather than spreading them over every partition
     kafka::produce_response r = co_await _client.produce_records(
-      model::kafka_audit_logging_topic, std::move(records));
+      model::kafka_audit_logging_topic,
+      std::move(records),
+      kafka::client::client::sticky_partition::yes);
     bool errored = std::any_of(
       r.data.responses.cbegin(),
       r.data.responses.cend(),
@@ -582,11 +586,9 @@ ss::future<> audit_sink::publish_app_lifecycle_event(
     /// audit is disabled.
     auto lifecycle_event = std::make_unique<application_lifecycle>(
       application_lifecycle::construct(event, ss::sstring{subsystem_name}));
-    auto as_json = lifecycle_event->to_json();
-    iobuf b;
-    b.append(as_json.c_str(), as_json.size());
     std::vector<kafka::client::record_essence> rs;
-    rs.push_back(kafka::client::record_essence{.value = std::move(b)});
+    rs.push_back(
+      kafka::client::record_essence{.value = lifecycle_event->to_json_iobuf()});
     co_await produce(std::move(rs));
 }
 
@@ -848,14 +850,12 @@ ss::future<> audit_log_manager::drain() {
     std::vector<kafka::client::record_essence> essences;
     auto records = std::exchange(_queue, underlying_t{});
     auto& records_seq = records.get<underlying_list>();
+    essences.reserve(records_seq.size());
     while (!records_seq.empty()) {
         auto first = records_seq.extract(records_seq.begin());
         auto audit_msg = std::move(first.value()).release();
-        auto as_json = audit_msg->to_json();
-        iobuf b;
-        b.append(as_json.c_str(), as_json.size());
         essences.push_back(
-          kafka::client::record_essence{.value = std::move(b)});
+          kafka::client::record_essence{.value = audit_msg->to_json_iobuf()});
         co_await ss::maybe_yield();
     }
 
@@ -9,6 +9,7 @@
  */
 #pragma once
 
+#include "bytes/iobuf.h"
 #include "config/node_config.h"
 #include "security/audit/schemas/types.h"
 
@@ -27,6 +28,23 @@ ss::sstring rjson_serialize(const T& v) {
     return ss::sstring{str_buf.GetString(), str_buf.GetSize()};
 }
 
+/// Serializes straight into an iobuf, saving the intermediate string when
+/// the result is going to be produced anyway
+template<typename T>
+iobuf rjson_serialize_iobuf(const T& v) {
+    ::json::StringBuffer str_buf;
+    ::json::Writer<::json::StringBuffer> wrt(str_buf);
+
+    using ::json::rjson_serialize;
+    using ::security::audit::rjson_serialize;
+
+    rjson_serialize(wrt, v);
+
+    iobuf b;
+    b.append(str_buf.GetString(), str_buf.GetSize());
+    return b;
+}
+
 template<typename T>
 type_uid get_ocsf_type(class_uid class_uid, T activity_id) {
     using t = type_uid::type;
@@ -48,6 +66,7 @@ public:
 
     virtual ss::sstring api_info() const = 0;
     virtual ss::sstring to_json() const = 0;
+    virtual iobuf to_json_iobuf() const = 0;
     virtual size_t estimated_size() const noexcept = 0;
     virtual void increment(timestamp_t) const = 0;
     virtual category_uid get_category_uid() const = 0;
@@ -78,6 +97,11 @@ public:
           *(static_cast<const Derived*>(this)));
     }
 
+    iobuf to_json_iobuf() const final {
+        return ::security::audit::rjson_serialize_iobuf(
+          *(static_cast<const Derived*>(this)));
+    }
+
     category_uid get_category_uid() const final { return _category_uid; }
 
     class_uid get_class_uid() const final { return _class_uid; }
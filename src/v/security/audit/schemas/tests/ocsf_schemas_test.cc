@@ -438,6 +438,10 @@ BOOST_AUTO_TEST_CASE(validate_application_lifecycle) {
       fmt::arg("product", test_product_ser));
 
     BOOST_REQUIRE_EQUAL(ser, ::json::minify(expected));
+
+    iobuf expected_buf;
+    expected_buf.append(ser.data(), ser.size());
+    BOOST_REQUIRE_EQUAL(app_lifecycle.to_json_iobuf(), expected_buf);
 }
 
 BOOST_AUTO_TEST_CASE(validate_increment) {
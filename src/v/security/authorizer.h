@@ -21,6 +21,7 @@
 #include <seastar/core/sstring.hh>
 #include <seastar/util/bool_class.hh>
 
+#include <absl/container/flat_hash_map.h>
 #include <absl/container/flat_hash_set.h>
 #include <fmt/core.h>
 
@@ -241,14 +242,107 @@ public:
       acl_operation operation,
       const acl_principal& principal,
       const acl_host& host) const {
-        auto type = get_resource_type<T>();
-        auto acls = _store.find(type, resource_name());
-
         if (_superusers.contains(principal)) {
             return auth_result::superuser_authorized(
               principal, host, operation, resource_name);
         }
 
+        auto type = get_resource_type<T>();
+        if (_decisions_revision != _store.revision()) {
+            _decisions.clear();
+            _decisions_revision = _store.revision();
+        }
+        decision_key key{
+          .type = type,
+          .resource_name = resource_name(),
+          .operation = operation,
+          .principal = principal,
+          .host = host,
+        };
+        if (auto it = _decisions.find(key); it != _decisions.end()) {
+            const auto& d = it->second;
+            return {
+              .authorized = d.authorized,
+              .empty_matches = d.empty_matches,
+              .resource_pattern = d.resource_pattern,
+              .acl = d.acl,
+              .principal = principal,
+              .host = host,
+              .resource_type = type,
+              .resource_name = resource_name(),
+              .operation = operation};
+        }
+        auto result = do_authorized(resource_name, operation, principal, host);
+        if (_decisions.size() >= max_cached_decisions) {
+            _decisions.clear();
+        }
+        _decisions.emplace(
+          std::move(key),
+          decision{
+            .authorized = result.authorized,
+            .empty_matches = result.empty_matches,
+            .resource_pattern = result.resource_pattern,
+            .acl = result.acl,
+          });
+        return result;
+    }
+
+    ss::future<fragmented_vector<acl_binding>> all_bindings() const {
+        return _store.all_bindings();
+    }
+
+    ss::future<>
+    reset_bindings(const fragmented_vector<acl_binding>& bindings) {
+        return _store.reset_bindings(bindings);
+    }
+
+    acl_store& store() { return _store; }
+
+private:
+    /*
+     * Decisions are cached until the ACLs or the superusers change. They refer
+     * to the patterns and entries of the store, which are valid until then.
+     */
+    static constexpr size_t max_cached_decisions = 10'000;
+
+    struct decision_key {
+        resource_type type;
+        ss::sstring resource_name;
+        acl_operation operation;
+        acl_principal principal;
+        acl_host host;
+
+        friend bool operator==(const decision_key&, const decision_key&)
+          = default;
+
+        template<typename H>
+        friend H AbslHashValue(H h, const decision_key& k) {
+            return H::combine(
+              std::move(h),
+              k.type,
+              k.resource_name,
+              k.operation,
+              k.principal,
+              k.host);
+        }
+    };
+
+    struct decision {
+        bool authorized;
+        bool empty_matches;
+        std::optional<std::reference_wrapper<const resource_pattern>>
+          resource_pattern;
+        std::optional<acl_entry_set::const_reference> acl;
+    };
+
+    template<typename T>
+    auth_result do_authorized(
+      const T& resource_name,
+      acl_operation operation,
+      const acl_principal& principal,
+      const acl_host& host) const {
+        auto acls = _store.find(get_resource_type<T>(), resource_name());
+
         if (acls.empty()) {
             return auth_result::empty_match_result(
               principal,
@@ -275,18 +369,6 @@ public:
           acl_any_implied_ops_allowed(acls, principal, host, operation));
     }
 
-    ss::future<fragmented_vector<acl_binding>> all_bindings() const {
-        return _store.all_bindings();
-    }
-
-    ss::future<>
-    reset_bindings(const fragmented_vector<acl_binding>& bindings) {
-        return _store.reset_bindings(bindings);
-    }
-
-    acl_store& store() { return _store; }
-
-private:
     /*
      * Compute whether the specified operation is allowed based on the implied
      * operations.
@@ -333,6 +415,8 @@ private:
         }
     }
     acl_store _store;
+    mutable absl::flat_hash_map<decision_key, decision> _decisions;
+    mutable uint64_t _decisions_revision{0};
 
     // The list of superusers is stored twice: once as a vector in the
     // configuration subsystem, then again has a set here for fast lookups.
@@ -344,6 +428,7 @@ private:
         // in any case involve constructing a set to do a comparison
         // between old and new.
         _superusers.clear();
+        _decisions.clear();
         for (const auto& username : _superusers_conf()) {
             auto principal = acl_principal(principal_type::user, username);
             vlog(seclog.info, "Registered superuser account: {}", principal);
@@ -12,8 +12,10 @@
 #include "security/request_auth.h"
 
 #include "base/vlog.h"
+#include "bytes/bytes.h"
 #include "cluster/controller.h"
 #include "config/configuration.h"
+#include "hashing/secure.h"
 #include "seastar/http/exception.hh"
 #include "security/credential_store.h"
 #include "security/oidc_authenticator.h"
@@ -33,6 +35,50 @@ request_authenticator::request_authenticator(
   , _require_auth(std::move(require_auth))
   , _superusers(std::move(superusers)) {}
 
+std::optional<ss::sstring> request_authenticator::find_verified_password(
+  const security::credential_user& username,
+  const security::scram_credential& cred,
+  const password_digest& digest) {
+    auto it = _verified_passwords.find(username());
+    if (it == _verified_passwords.end()) {
+        return std::nullopt;
+    }
+    const auto& verified = it->second;
+    if (
+      verified.expires < ss::lowres_clock::now()
+      || verified.stored_key != cred.stored_key()) {
+        _verified_passwords.erase(it);
+        return std::nullopt;
+    }
+    if (verified.digest != digest) {
+        return std::nullopt;
+    }
+    return verified.sasl_mechanism;
+}
+
+void request_authenticator::remember_verified_password(
+  const security::credential_user& username,
+  const security::scram_credential& cred,
+  const password_digest& digest,
+  ss::sstring sasl_mechanism) {
+    if (_verified_passwords.size() >= max_verified_passwords) {
+        absl::erase_if(_verified_passwords, [](const auto& entry) {
+            return entry.second.expires < ss::lowres_clock::now();
+        });
+        if (_verified_passwords.size() >= max_verified_passwords) {
+            _verified_passwords.clear();
+        }
+    }
+    _verified_passwords.insert_or_assign(
+      username(),
+      verified_password{
+        .stored_key = cred.stored_key(),
+        .digest = digest,
+        .sasl_mechanism = std::move(sasl_mechanism),
+        .expires = ss::lowres_clock::now() + verified_password_ttl,
+      });
+}
+
 /**
  * Attempt to authenticate the request.
  *
@@ -125,22 +171,35 @@ request_auth_result request_authenticator::do_authenticate(
               std::move(username), "Unauthorized");
         } else {
             const auto& cred = cred_opt.value();
+            hmac_sha256 mac(cred.salt());
+            mac.update(password());
+            auto digest = mac.reset();
             ss::sstring sasl_mechanism;
             bool is_valid{false};
-            if (security::scram_sha256::validate_password(
-                  password,
-                  cred.stored_key(),
-                  cred.salt(),
-                  cred.iterations())) {
+            if (auto verified = find_verified_password(username, cred, digest);
+                verified.has_value()) {
                 is_valid = true;
-                sasl_mechanism = security::scram_sha256_authenticator::name;
-            } else if (security::scram_sha512::validate_password(
-                         password,
-                         cred.stored_key(),
-                         cred.salt(),
-                         cred.iterations())) {
-                is_valid = true;
-                sasl_mechanism = security::scram_sha512_authenticator::name;
+                sasl_mechanism = std::move(*verified);
+            } else {
+                if (security::scram_sha256::validate_password(
+                      password,
+                      cred.stored_key(),
+                      cred.salt(),
+                      cred.iterations())) {
+                    is_valid = true;
+                    sasl_mechanism = security::scram_sha256_authenticator::name;
+                } else if (security::scram_sha512::validate_password(
+                             password,
+                             cred.stored_key(),
+                             cred.salt(),
+                             cred.iterations())) {
+                    is_valid = true;
+                    sasl_mechanism = security::scram_sha512_authenticator::name;
+                }
+                if (is_valid) {
+                    remember_verified_password(
+                      username, cred, digest, sasl_mechanism);
+                }
             }
             if (!is_valid) {
                 // User found, password doesn't match
@@ -11,14 +11,23 @@
 
 #pragma once
 
+#include "bytes/bytes.h"
 #include "cluster/fwd.h"
 #include "config/property.h"
 #include "security/fwd.h"
+#include "security/scram_credential.h"
 #include "security/types.h"
 
+#include <seastar/core/lowres_clock.hh>
 #include <seastar/http/exception.hh>
 #include <seastar/http/request.hh>
 
+#include <absl/container/flat_hash_map.h>
+
+#include <array>
+#include <chrono>
+#include <optional>
+
 class unauthorized_user_exception : public ss::httpd::base_exception {
 public:
     unauthorized_user_exception(
@@ -130,9 +139,35 @@ private:
       security::credential_store const& cred_store,
       bool require_auth);
 
+    // Basic auth sends the password with every request, and checking it
+    // against the stored credential costs a PBKDF2 of thousands of
+    // iterations. A password that was checked recently is remembered by an
+    // HMAC of it, until the credential changes or the entry expires.
+    static constexpr auto verified_password_ttl = std::chrono::seconds(60);
+    static constexpr size_t max_verified_passwords = 1024;
+
+    using password_digest = std::array<char, 32>;
+    struct verified_password {
+        bytes stored_key;
+        password_digest digest;
+        ss::sstring sasl_mechanism;
+        ss::lowres_clock::time_point expires;
+    };
+
+    std::optional<ss::sstring> find_verified_password(
+      const security::credential_user&,
+      const security::scram_credential&,
+      const password_digest&);
+    void remember_verified_password(
+      const security::credential_user&,
+      const security::scram_credential&,
+      const password_digest&,
+      ss::sstring sasl_mechanism);
+
     cluster::controller* _controller{nullptr};
     config::binding<bool> _require_auth;
     config::binding<std::vector<ss::sstring>> _superusers;
+    absl::flat_hash_map<ss::sstring, verified_password> _verified_passwords;
 };
 
 inline constexpr std::string_view authz_basic_prefix = "Basic ";
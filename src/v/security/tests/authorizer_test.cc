@@ -700,6 +700,46 @@ BOOST_AUTO_TEST_CASE(remove_all_acl_prefixed_resource) {
     BOOST_REQUIRE(get_acls(auth, acl_binding_filter::any()).empty());
 }
 
+BOOST_AUTO_TEST_CASE(cached_decisions_follow_acl_changes) {
+    acl_principal user(principal_type::user, "alice");
+    acl_host host("192.168.3.1");
+    model::topic topic("foo-3uk3rlkj");
+
+    auto auth = make_test_instance();
+
+    std::vector<acl_binding> bindings;
+    bindings.emplace_back(prefixed_resource, allow_read_acl);
+    auth.add_bindings(bindings);
+
+    for (int i = 0; i < 2; ++i) {
+        auto result = auth.authorized(topic, acl_operation::read, user, host);
+        BOOST_REQUIRE(result.authorized);
+        BOOST_REQUIRE_EQUAL(result.acl, allow_read_acl);
+        BOOST_REQUIRE_EQUAL(result.resource_pattern, prefixed_resource);
+        BOOST_REQUIRE_EQUAL(result.resource_name, topic());
+    }
+
+    // a longer prefix that denies takes precedence
+    bindings.clear();
+    resource_pattern longer(
+      resource_type::topic, "foo-3", pattern_type::prefixed);
+    bindings.emplace_back(longer, deny_read_acl);
+    auth.add_bindings(bindings);
+    auto result = auth.authorized(topic, acl_operation::read, user, host);
+    BOOST_REQUIRE(!result.authorized);
+    BOOST_REQUIRE_EQUAL(result.resource_pattern, longer);
+
+    {
+        std::vector<acl_binding_filter> filters;
+        filters.emplace_back(longer, acl_entry_filter::any());
+        filters.emplace_back(prefixed_resource, acl_entry_filter::any());
+        auth.remove_bindings(filters);
+    }
+    result = auth.authorized(topic, acl_operation::read, user, host);
+    BOOST_REQUIRE(!result.authorized);
+    BOOST_REQUIRE(result.empty_matches);
+}
+
 BOOST_AUTO_TEST_CASE(acls_on_literal_resource) {
     auto auth = make_test_instance();
 
@@ -15,10 +15,17 @@
 #include "hashing/crc32c.h"
 #include "serde/logger.h"
 #include "serde/read_header.h"
+#include "serde/rw/envelope.h"
+#include "serde/rw/map.h"
 #include "serde/rw/rw.h"
+#include "serde/rw/vector.h"
 #include "ssx/future-util.h"
 #include "ssx/sformat.h"
 
+#include <seastar/coroutine/maybe_yield.hh>
+
+#include <tuple>
+
 namespace serde {
 
 template<typename T>
@@ -61,6 +68,137 @@ inline ss::future<crc::crc32c> calculate_crc_async(iobuf_const_parser in) {
       });
 }
 
+/// Envelopes, vectors and maps that may span at least this many bytes are
+/// decoded incrementally by read_async(), yielding to the reactor between
+/// their fields and elements when it asks to preempt. Smaller ones are decoded
+/// synchronously, the suspension points would cost more than they save.
+inline constexpr size_t async_read_incremental_bytes = 64 * 1024;
+
+template<typename T>
+ss::future<std::decay_t<T>>
+read_async_nested(iobuf_parser& in, size_t const bytes_left_limit);
+
+namespace detail {
+
+template<typename T>
+ss::future<> verify_checksum_async(iobuf_parser& in, const header& h) {
+    auto shared = in.share_no_consume(in.bytes_left() - h._bytes_left_limit);
+    return ss::do_with(std::move(shared), [h](const iobuf& shared) {
+        return calculate_crc_async(iobuf_const_parser{shared})
+          .then([h](const crc::crc32c crc) {
+              if (unlikely(crc.value() != h._checksum)) {
+                  throw serde_exception(fmt_with_ctx(
+                    ssx::sformat,
+                    "serde: envelope {} (ends at bytes_left={}) has "
+                    "bad checksum: stored={}, actual={}",
+                    type_str<T>(),
+                    h._bytes_left_limit,
+                    h._checksum,
+                    crc.value()));
+              }
+          });
+    });
+}
+
+// types with a custom synchronous read are left to it
+template<typename T>
+concept incrementally_decodable_envelope
+  = inherits_from_envelope<T> && !has_serde_read<T> && !DirectReadable<T>;
+
+template<typename T>
+concept incrementally_decodable_vector
+  = Vector<T> && !requires(const T& t) { t.c_str(); };
+
+template<typename T>
+concept incrementally_decodable = incrementally_decodable_envelope<T>
+                                  || incrementally_decodable_vector<T>
+                                  || Map<T>;
+
+template<typename T, size_t I = 0, typename Fields>
+ss::future<> read_fields_async(
+  iobuf_parser& in, Fields& fields, const header& h) {
+    if constexpr (I < std::tuple_size_v<Fields>) {
+        using FieldType = std::decay_t<std::tuple_element_t<I, Fields>>;
+        if (h._bytes_left_limit == in.bytes_left()) {
+            // written by an older version of the type
+            co_return;
+        }
+        if (unlikely(in.bytes_left() < h._bytes_left_limit)) {
+            throw serde_exception(fmt_with_ctx(
+              ssx::sformat,
+              "field spill over in {}, field type {}: envelope_end={}, "
+              "in.bytes_left()={}",
+              type_str<T>(),
+              type_str<FieldType>(),
+              h._bytes_left_limit,
+              in.bytes_left()));
+        }
+        std::get<I>(fields) = co_await read_async_nested<FieldType>(
+          in, h._bytes_left_limit);
+        co_await ss::coroutine::maybe_yield();
+        co_await read_fields_async<T, I + 1>(in, fields, h);
+    } else {
+        co_return;
+    }
+}
+
+template<typename T>
+ss::future<T> read_incrementally(iobuf_parser& in, size_t bytes_left_limit) {
+    T t{};
+    if constexpr (incrementally_decodable_envelope<T>) {
+        auto const h = read_header<T>(in, bytes_left_limit);
+        if constexpr (is_checksum_envelope<T>) {
+            co_await verify_checksum_async<T>(in, h);
+        }
+        auto fields = envelope_to_tuple(t);
+        co_await read_fields_async<T>(in, fields, h);
+        if (in.bytes_left() > h._bytes_left_limit) {
+            in.skip(in.bytes_left() - h._bytes_left_limit);
+        }
+    } else if constexpr (incrementally_decodable_vector<T>) {
+        using value_type = typename T::value_type;
+        const size_t size = read_nested<serde_size_t>(in, bytes_left_limit);
+        if constexpr (Reservable<T>) {
+            t.reserve(size);
+        }
+        if constexpr (is_bulk_decodable<value_type>::value) {
+            // bulk copies of a bounded number of bytes between yields
+            constexpr size_t batch = std::max<size_t>(
+              1, async_read_incremental_bytes / sizeof(value_type));
+            for (size_t read = 0; read < size;) {
+                const auto n = std::min(batch, size - read);
+                read_bulk(
+                  in, t, static_cast<serde_size_t>(n), bytes_left_limit);
+                read += n;
+                co_await ss::coroutine::maybe_yield();
+            }
+        } else {
+            for (size_t i = 0; i < size; ++i) {
+                t.push_back(
+                  co_await read_async_nested<value_type>(in, bytes_left_limit));
+                co_await ss::coroutine::maybe_yield();
+            }
+        }
+        t.shrink_to_fit();
+    } else {
+        const size_t size = read_nested<serde_size_t>(in, bytes_left_limit);
+        if constexpr (Reservable<T>) {
+            t.reserve(size);
+        }
+        for (size_t i = 0; i < size; ++i) {
+            auto key = co_await read_async_nested<typename T::key_type>(
+              in, bytes_left_limit);
+            auto value = co_await read_async_nested<typename T::mapped_type>(
+              in, bytes_left_limit);
+            t.emplace(std::move(key), std::move(value));
+            co_await ss::coroutine::maybe_yield();
+        }
+    }
+    co_return t;
+}
+
+} // namespace detail
+
 template<typename T>
 ss::future<std::decay_t<T>>
 read_async_nested(iobuf_parser& in, size_t const bytes_left_limit) {
@@ -70,23 +208,7 @@ read_async_nested(iobuf_parser& in, size_t const bytes_left_limit) {
         auto const h = read_header<Type>(in, bytes_left_limit);
         auto f = ss::now();
         if constexpr (is_checksum_envelope<Type>) {
-            auto shared = in.share_no_consume(
-              in.bytes_left() - h._bytes_left_limit);
-            f = ss::do_with(std::move(shared), [h](const iobuf& shared) {
-                return calculate_crc_async(iobuf_const_parser{shared})
-                  .then([h](const crc::crc32c crc) {
-                      if (unlikely(crc.value() != h._checksum)) {
-                          throw serde_exception(fmt_with_ctx(
-                            ssx::sformat,
-                            "serde: envelope {} (ends at bytes_left={}) has "
-                            "bad checksum: stored={}, actual={}",
-                            type_str<Type>(),
-                            h._bytes_left_limit,
-                            h._checksum,
-                            crc.value()));
-                      }
-                  });
-            });
+            f = detail::verify_checksum_async<Type>(in, h);
         }
 
         if constexpr (has_serde_async_direct_read<Type>) {
@@ -100,6 +222,13 @@ read_async_nested(iobuf_parser& in, size_t const bytes_left_limit) {
                 });
             });
         }
+    } else if constexpr (detail::incrementally_decodable<Type>) {
+        if (
+          in.bytes_left() - bytes_left_limit >= async_read_incremental_bytes) {
+            return detail::read_incrementally<Type>(in, bytes_left_limit);
+        }
+        return ss::make_ready_future<Type>(
+          read_nested<T>(in, bytes_left_limit));
     } else {
         return ss::make_ready_future<std::decay_t<T>>(
           read_nested<T>(in, bytes_left_limit));
@@ -0,0 +1,39 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#pragma once
+
+#include "utils/named_type.h"
+
+#include <bit>
+#include <type_traits>
+
+namespace serde {
+
+/**
+ * Element types which are serialized as their in-memory representation, i.e.
+ * little endian scalars and named types wrapping them. Vectors of these, and
+ * envelopes made only of these, are encoded and decoded with bulk copies
+ * instead of element by element.
+ */
+template<typename T>
+struct is_bulk_decodable
+  : std::bool_constant<
+      std::endian::native == std::endian::little && std::is_arithmetic_v<T>
+      && !std::is_same_v<T, bool>> {};
+
+template<typename T, typename Tag, typename IsConstexpr>
+struct is_bulk_decodable<::detail::base_named_type<T, Tag, IsConstexpr>>
+  : std::bool_constant<
+      is_bulk_decodable<T>::value
+      && sizeof(::detail::base_named_type<T, Tag, IsConstexpr>) == sizeof(T)
+      && std::is_trivially_copyable_v<
+        ::detail::base_named_type<T, Tag, IsConstexpr>>> {};
+
+} // namespace serde
@@ -14,10 +14,13 @@
 #include "serde/envelope.h"
 #include "serde/envelope_for_each_field.h"
 #include "serde/read_header.h"
+#include "serde/rw/bulk.h"
 #include "serde/rw/rw.h"
 #include "serde/serde_size_t.h"
 
+#include <tuple>
 #include <type_traits>
+#include <utility>
 
 namespace serde {
 
@@ -29,6 +32,85 @@ concept has_serde_read = requires(T t, iobuf_parser& in, const header& h) {
     t.serde_read(in, h);
 };
 
+namespace detail {
+
+template<typename Fields>
+struct bulk_fields;
+
+template<typename... Fs>
+struct bulk_fields<std::tuple<Fs&...>> {
+    static constexpr bool decodable
+      = (is_bulk_decodable<std::decay_t<Fs>>::value && ...);
+    static constexpr std::size_t size = (std::size_t{0} + ... + sizeof(Fs));
+};
+
+template<typename T>
+using envelope_bulk_fields
+  = bulk_fields<decltype(envelope_to_tuple(std::declval<T&>()))>;
+
+} // namespace detail
+
+/**
+ * Envelopes made only of fixed size scalars and named types, without padding,
+ * e.g. raft protocol and heartbeat metadata. Their serialized body is the same
+ * as their in-memory representation, so it is written and read with a single
+ * copy instead of field by field. The wire format doesn't change.
+ */
+template<typename T>
+concept trivially_serializable_envelope
+  = inherits_from_envelope<T> && !is_checksum_envelope<T>
+    && !has_serde_read<T> && !has_serde_write<T> && !DirectReadable<T>
+    && std::is_standard_layout_v<T> && std::is_trivially_copyable_v<T>
+    && detail::envelope_bulk_fields<T>::decodable
+    && detail::envelope_bulk_fields<T>::size == sizeof(T);
+
+/// True if the fields are laid out in memory in the order they are
+/// serialized, which serde_fields() doesn't guarantee. The offsets are known
+/// at compile time, so the check folds to a constant.
+template<trivially_serializable_envelope T>
+bool has_wire_layout(T& t) {
+    auto const* base = reinterpret_cast<char const*>(&t);
+    std::ptrdiff_t offset = 0;
+    return std::apply(
+      [&](auto&... f) {
+          return (
+            (reinterpret_cast<char const*>(&f) - base
+             == std::exchange(
+               offset, offset + static_cast<std::ptrdiff_t>(sizeof(f))))
+            && ...);
+      },
+      envelope_to_tuple(t));
+}
+
+/// Writes the body of the envelope with a single copy, false if the envelope
+/// has to be written field by field
+template<typename T>
+bool write_trivial(iobuf& out, T& t) {
+    if constexpr (trivially_serializable_envelope<T>) {
+        if (likely(has_wire_layout(t))) {
+            out.append(reinterpret_cast<char const*>(&t), sizeof(T));
+            return true;
+        }
+    }
+    return false;
+}
+
+/// Reads the body of the envelope with a single copy, false if it has to be
+/// read field by field, e.g. when it was written by another version of the
+/// type with a different set of fields
+template<typename T>
+bool read_trivial(iobuf_parser& in, T& t, const header& h) {
+    if constexpr (trivially_serializable_envelope<T>) {
+        if (
+          in.bytes_left() - h._bytes_left_limit == sizeof(T)
+          && has_wire_layout(t)) {
+            in.consume_to(sizeof(T), reinterpret_cast<char*>(&t));
+            return true;
+        }
+    }
+    return false;
+}
+
 template<typename T>
 requires is_envelope<std::decay_t<T>>
 void tag_invoke(
@@ -62,7 +144,7 @@ void tag_invoke(
 
     if constexpr (has_serde_read<Type>) {
         t.serde_read(in, h);
-    } else {
+    } else if (!read_trivial(in, t, h)) {
         envelope_for_each_field(t, [&](auto& f) {
             using FieldType = std::decay_t<decltype(f)>;
             if (h._bytes_left_limit == in.bytes_left()) {
@@ -105,7 +187,7 @@ void tag_invoke(tag_t<write_tag>, iobuf& out, T t) {
     auto const size_before = out.size_bytes();
     if constexpr (has_serde_write<Type>) {
         t.serde_write(out);
-    } else {
+    } else if (!write_trivial(out, t)) {
         envelope_for_each_field(
           t, [&out](auto& f) { write(out, std::move(f)); });
     }
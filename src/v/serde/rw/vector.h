@@ -10,6 +10,7 @@
 #pragma once
 
 #include "base/vlog.h"
+#include "serde/rw/bulk.h"
 #include "serde/rw/reservable.h"
 #include "serde/rw/rw.h"
 #include "serde/serde_exception.h"
@@ -17,7 +18,9 @@
 #include "serde/type_str.h"
 #include "ssx/sformat.h"
 
+#include <array>
 #include <cinttypes>
+#include <iterator>
 #include <limits>
 #include <type_traits>
 
@@ -37,6 +40,50 @@ concept Vector = requires(T t) {
     { t.size() } -> std::convertible_to<std::size_t>;
 };
 
+template<typename T>
+concept ContiguousVector = requires(T t, std::size_t n) {
+    t.resize(n);
+    t.data();
+} && std::contiguous_iterator<typename T::iterator>;
+
+template<typename T>
+void read_bulk(
+  iobuf_parser& in,
+  T& t,
+  serde_size_t const size,
+  std::size_t const bytes_left_limit) {
+    using value_type = typename T::value_type;
+
+    const auto bytes = static_cast<std::size_t>(size) * sizeof(value_type);
+    if (unlikely(in.bytes_left() - bytes_left_limit < bytes)) {
+        throw serde_exception(fmt_with_ctx(
+          ssx::sformat,
+          "reading {} of {} elements: {} bytes left",
+          type_str<T>(),
+          size,
+          in.bytes_left()));
+    }
+
+    if constexpr (ContiguousVector<T>) {
+        const auto offset = t.size();
+        t.resize(offset + size);
+        in.consume_to(bytes, reinterpret_cast<char*>(t.data() + offset));
+    } else {
+        // the elements are staged in small batches on the stack, so that the
+        // parser is consumed in a few large copies
+        std::array<value_type, 64> batch;
+        for (serde_size_t read = 0; read < size;) {
+            const auto n = std::min<std::size_t>(batch.size(), size - read);
+            in.consume_to(
+              n * sizeof(value_type), reinterpret_cast<char*>(batch.data()));
+            for (std::size_t i = 0; i < n; ++i) {
+                t.push_back(batch[i]);
+            }
+            read += n;
+        }
+    }
+}
+
 void tag_invoke(
   tag_t<read_tag>,
   iobuf_parser& in,
@@ -49,8 +96,12 @@ void tag_invoke(
     if constexpr (Reservable<decltype(t)>) {
         t.reserve(size);
     }
-    for (auto i = 0U; i < size; ++i) {
-        t.push_back(read_nested<value_type>(in, bytes_left_limit));
+    if constexpr (is_bulk_decodable<value_type>::value) {
+        read_bulk(in, t, size, bytes_left_limit);
+    } else {
+        for (auto i = 0U; i < size; ++i) {
+            t.push_back(read_nested<value_type>(in, bytes_left_limit));
+        }
     }
     t.shrink_to_fit();
 }
@@ -10,6 +10,7 @@
 #include "bytes/iobuf.h"
 #include "cluster/health_monitor_types.h"
 #include "cluster/node/types.h"
+#include "container/fragmented_vector.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
 #include "serde/serde.h"
@@ -18,6 +19,8 @@
 #include <seastar/core/sharded.hh>
 #include <seastar/testing/perf_tests.hh>
 
+#include <absl/container/flat_hash_set.h>
+
 struct small_t
   : public serde::
       envelope<small_t, serde::version<3>, serde::compat_version<2>> {
@@ -94,6 +97,73 @@ PERF_TEST(big_10mb, deserialize) {
     return deserialize_big(10 << 20 /*10MB*/, 1 << 15 /*32KB*/);
 }
 
+// shaped like append_entries: a few scalars, the offsets of the batches and
+// the batches themselves
+struct entries_t
+  : public serde::
+      envelope<entries_t, serde::version<0>, serde::compat_version<0>> {
+    model::term_id term;
+    fragmented_vector<model::offset> offsets;
+    iobuf batches;
+};
+
+inline entries_t gen_entries(size_t batches, size_t batch_size) {
+    entries_t ret{.term = model::term_id(1)};
+    for (size_t i = 0; i < batches; ++i) {
+        ret.offsets.push_back(model::offset(i));
+        ret.batches.append(ss::temporary_buffer<char>(batch_size));
+    }
+    return ret;
+}
+
+/// Bytes of the decoded message copied out of the serialized buffer, i.e. not
+/// sharing its fragments
+inline size_t copied_bytes(const iobuf& source, const entries_t& msg) {
+    size_t copied = sizeof(msg.term)
+                    + msg.offsets.size() * sizeof(model::offset);
+    for (const auto& frag : msg.batches) {
+        auto shared = std::any_of(
+          source.begin(), source.end(), [&frag](const auto& src) {
+              return frag.get() >= src.get()
+                     && frag.get() + frag.size() <= src.get() + src.size();
+          });
+        if (!shared) {
+            copied += frag.size();
+        }
+    }
+    return copied;
+}
+
+inline void deserialize_entries(
+  std::string_view name, size_t batches, size_t batch_size) {
+    auto o = iobuf();
+    serde::write(o, gen_entries(batches, batch_size));
+    auto source = o.share(0, o.size_bytes());
+    const auto message_size = o.size_bytes();
+
+    perf_tests::start_measuring_time();
+    auto result = serde::from_iobuf<entries_t>(std::move(o));
+    perf_tests::do_not_optimize(result);
+    perf_tests::stop_measuring_time();
+
+    static thread_local absl::flat_hash_set<std::string_view> reported;
+    if (reported.insert(name).second) {
+        fmt::print(
+          "{}: {} bytes copied per message of {} bytes\n",
+          name,
+          copied_bytes(source, result),
+          message_size);
+    }
+}
+
+PERF_TEST(entries_1mb, deserialize) {
+    deserialize_entries("entries_1mb", 32, 1 << 15 /*32KB*/);
+}
+
+PERF_TEST(entries_small_batches, deserialize) {
+    deserialize_entries("entries_small_batches", 4096, 256);
+}
+
 cluster::topic_status make_topic_status(size_t id, size_t num_partitions) {
     cluster::topic_status ts;
     ts.tp_ns = model::topic_namespace(
@@ -1077,3 +1077,229 @@ SEASTAR_THREAD_TEST_CASE(collections_interop) {
     BOOST_REQUIRE(serialized_vector == serialized_fifo);
     BOOST_REQUIRE(serialized_vector == serialized_f_vector);
 }
+
+namespace {
+// splits the buffer into tiny fragments, so that elements straddle fragments
+iobuf refragment(const iobuf& in, size_t fragment_size) {
+    iobuf out;
+    auto parser = iobuf_const_parser(in);
+    while (parser.bytes_left() > 0) {
+        auto n = std::min(fragment_size, parser.bytes_left());
+        iobuf fragment;
+        fragment.append(parser.read_string(n).data(), n);
+        out.append_fragments(std::move(fragment));
+    }
+    return out;
+}
+} // namespace
+
+struct bulk_decoded_msg
+  : serde::envelope<
+      bulk_decoded_msg,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    fragmented_vector<model::offset> offsets;
+    std::vector<int64_t> values;
+    ss::chunked_fifo<double> ratios;
+    std::vector<int8_t> bytes;
+};
+
+SEASTAR_THREAD_TEST_CASE(bulk_decoded_vectors_test) {
+    for (size_t size : {0, 1, 63, 64, 65, 1000, 5000}) {
+        bulk_decoded_msg msg;
+        for (size_t i = 0; i < size; ++i) {
+            msg.offsets.push_back(model::offset(i * 3));
+            msg.values.push_back(-static_cast<int64_t>(i));
+            msg.ratios.push_back(static_cast<double>(i) / 7);
+            msg.bytes.push_back(static_cast<int8_t>(i));
+        }
+        auto b = refragment(serde::to_iobuf(std::move(msg)), 3);
+        auto out = serde::from_iobuf<bulk_decoded_msg>(std::move(b));
+
+        BOOST_REQUIRE_EQUAL(out.offsets.size(), size);
+        BOOST_REQUIRE_EQUAL(out.values.size(), size);
+        BOOST_REQUIRE_EQUAL(out.ratios.size(), size);
+        BOOST_REQUIRE_EQUAL(out.bytes.size(), size);
+        size_t i = 0;
+        for (auto r : out.ratios) {
+            BOOST_REQUIRE_EQUAL(out.offsets[i], model::offset(i * 3));
+            BOOST_REQUIRE_EQUAL(out.values[i], -static_cast<int64_t>(i));
+            BOOST_REQUIRE_EQUAL(r, static_cast<double>(i) / 7);
+            BOOST_REQUIRE_EQUAL(out.bytes[i], static_cast<int8_t>(i));
+            ++i;
+        }
+    }
+}
+
+SEASTAR_THREAD_TEST_CASE(bulk_decoded_vector_buffer_too_short) {
+    auto b = serde::to_iobuf(std::vector<int64_t>(10, 1));
+    b.trim_back(4);
+    BOOST_CHECK_THROW(
+      serde::from_iobuf<std::vector<int64_t>>(std::move(b)),
+      serde::serde_exception);
+}
+
+struct iobuf_msg
+  : serde::envelope<iobuf_msg, serde::version<0>, serde::compat_version<0>> {
+    int32_t id;
+    iobuf data;
+};
+
+SEASTAR_THREAD_TEST_CASE(envelope_iobuf_field_shares_fragments) {
+    iobuf data;
+    for (int i = 0; i < 16; ++i) {
+        auto chunk = random_generators::gen_alphanum_string(32 * 1024);
+        data.append(chunk.data(), chunk.size());
+    }
+    auto expected = data.copy();
+    auto b = serde::to_iobuf(iobuf_msg{.id = 1, .data = std::move(data)});
+    auto source = b.share(0, b.size_bytes());
+
+    auto out = serde::from_iobuf<iobuf_msg>(std::move(b));
+    BOOST_REQUIRE(out.data == expected);
+    // every fragment of the decoded field points into the serialized buffer
+    for (const auto& frag : out.data) {
+        BOOST_REQUIRE(std::any_of(
+          source.begin(), source.end(), [&frag](const auto& src) {
+              return frag.get() >= src.get()
+                     && frag.get() + frag.size() <= src.get() + src.size();
+          }));
+    }
+}
+
+struct trivial_msg
+  : serde::envelope<trivial_msg, serde::version<0>, serde::compat_version<0>> {
+    int64_t a;
+    model::offset b;
+    int32_t c;
+    int16_t d;
+    int8_t e;
+    uint8_t f;
+
+    auto serde_fields() { return std::tie(a, b, c, d, e, f); }
+};
+
+// same fields, serialized in another order than the one of the declaration
+struct reordered_trivial_msg
+  : serde::envelope<
+      reordered_trivial_msg,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    int64_t a;
+    model::offset b;
+    int32_t c;
+    int16_t d;
+    int8_t e;
+    uint8_t f;
+
+    auto serde_fields() { return std::tie(f, e, d, c, b, a); }
+};
+
+struct padded_msg
+  : serde::envelope<padded_msg, serde::version<0>, serde::compat_version<0>> {
+    int8_t a;
+    int64_t b;
+};
+
+struct bool_msg
+  : serde::envelope<bool_msg, serde::version<0>, serde::compat_version<0>> {
+    int64_t a;
+    bool b;
+    int8_t c;
+    int16_t d;
+    int32_t e;
+};
+
+static_assert(serde::trivially_serializable_envelope<trivial_msg>);
+static_assert(serde::trivially_serializable_envelope<reordered_trivial_msg>);
+static_assert(!serde::trivially_serializable_envelope<padded_msg>);
+static_assert(!serde::trivially_serializable_envelope<bool_msg>);
+static_assert(serde::trivially_serializable_envelope<test_msg0>);
+
+namespace {
+// the per-field encoding the envelope would have without the bulk copy
+template<typename T>
+iobuf encode_field_by_field(T t) {
+    iobuf body;
+    serde::envelope_for_each_field(
+      t, [&body](auto& f) { serde::write(body, f); });
+    iobuf out;
+    serde::write(out, T::redpanda_serde_version);
+    serde::write(out, T::redpanda_serde_compat_version);
+    serde::write(out, static_cast<serde::serde_size_t>(body.size_bytes()));
+    out.append(std::move(body));
+    return out;
+}
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(trivially_serializable_envelope_wire_compat) {
+    const trivial_msg msg{
+      .a = -1, .b = model::offset(42), .c = 1 << 20, .d = -3, .e = 4, .f = 250};
+    auto expected = encode_field_by_field(msg);
+    BOOST_REQUIRE(serde::to_iobuf(msg) == expected);
+
+    auto out = serde::from_iobuf<trivial_msg>(std::move(expected));
+    BOOST_REQUIRE_EQUAL(out.a, msg.a);
+    BOOST_REQUIRE_EQUAL(out.b, msg.b);
+    BOOST_REQUIRE_EQUAL(out.c, msg.c);
+    BOOST_REQUIRE_EQUAL(out.d, msg.d);
+    BOOST_REQUIRE_EQUAL(out.e, msg.e);
+    BOOST_REQUIRE_EQUAL(out.f, msg.f);
+
+    // the layout check falls back to the per-field encoding
+    const reordered_trivial_msg reordered{
+      .a = -1, .b = model::offset(42), .c = 1 << 20, .d = -3, .e = 4, .f = 250};
+    auto expected_reordered = encode_field_by_field(reordered);
+    BOOST_REQUIRE(serde::to_iobuf(reordered) == expected_reordered);
+    auto out_reordered = serde::from_iobuf<reordered_trivial_msg>(
+      std::move(expected_reordered));
+    BOOST_REQUIRE_EQUAL(out_reordered.a, reordered.a);
+    BOOST_REQUIRE_EQUAL(out_reordered.f, reordered.f);
+
+    // vectors of them
+    std::vector<trivial_msg> msgs(10, msg);
+    auto decoded = serde::from_iobuf<std::vector<trivial_msg>>(
+      serde::to_iobuf(msgs));
+    BOOST_REQUIRE_EQUAL(decoded.size(), msgs.size());
+    BOOST_REQUIRE_EQUAL(decoded.back().b, msg.b);
+}
+
+struct incremental_item
+  : serde::
+      envelope<incremental_item, serde::version<0>, serde::compat_version<0>> {
+    int32_t id;
+    ss::sstring name;
+    std::vector<int64_t> offsets;
+    absl::flat_hash_map<int32_t, ss::sstring> tags;
+
+    bool operator==(const incremental_item&) const = default;
+};
+
+SEASTAR_THREAD_TEST_CASE(read_async_incremental_test) {
+    using items_t = fragmented_vector<incremental_item>;
+    items_t items;
+    for (int i = 0; i < 5000; ++i) {
+        incremental_item item{.id = i, .name = fmt::format("item-{}", i)};
+        item.offsets.resize(i % 13, i);
+        for (int j = 0; j < i % 5; ++j) {
+            item.tags.emplace(j, fmt::format("tag-{}", j));
+        }
+        items.push_back(std::move(item));
+    }
+    auto b = serde::to_iobuf(items.copy());
+    BOOST_REQUIRE_GT(b.size_bytes(), serde::async_read_incremental_bytes);
+
+    {
+        auto parser = iobuf_parser{b.copy()};
+        auto decoded = serde::read_async<items_t>(parser).get();
+        BOOST_REQUIRE(decoded == items);
+    }
+    {
+        // truncated in the middle of the last element
+        b.trim_back(10);
+        auto parser = iobuf_parser{std::move(b)};
+        BOOST_CHECK_THROW(
+          serde::read_async<items_t>(parser).get(),
+          serde::serde_exception);
+    }
+}
@@ -14,10 +14,14 @@
 #include "base/seastarx.h"
 
 #include <seastar/core/future.hh>
+#include <seastar/core/preempt.hh>
+#include <seastar/util/later.hh>
 #include <seastar/coroutine/maybe_yield.hh>
 
+#include <chrono>
 #include <iterator>
 #include <limits>
+#include <ranges>
 
 //
 // async_algorithms.h
@@ -35,6 +39,17 @@
 // times. For example, in a doubly nested loop where the inner loop always ran
 // for less than interval iterations, we would not yield with the simple
 // functions.
+//
+// The yield budget is counted in iterations: every Traits::interval
+// iterations the loop calls maybe_yield, which only yields once the task
+// quota of the reactor is used up. A loop that must also give way at a finer
+// granularity sets Traits::time_budget and yields unconditionally once that
+// much time passed since it last yielded.
+//
+// Beside for_each, the helpers below cover the common container operations of
+// hot loops: async_copy and async_erase_if. The container must not be
+// modified by anything else until the returned future resolves, since the
+// loop may be suspended in the middle of it.
 
 namespace ssx {
 
@@ -46,7 +61,10 @@ struct async_counter {
 struct async_algo_traits {
     // The number of elements processed before trying to yield
     constexpr static ssize_t interval = 100;
-    // Called every time after we call maybe_yield, useful to
+    // If non-zero, the time after which the loop yields even if the reactor
+    // did not ask for it. Checked every interval elements.
+    constexpr static std::chrono::microseconds time_budget{0};
+    // Called every time we try to yield, useful to
     // introspect the behavior in tests.
     static void yield_called() {}
 };
@@ -120,6 +138,35 @@ iter_size<I> for_each_limit(const I begin, const I end, ssize_t limit, Fn f) {
     return {i, count};
 }
 
+/**
+ * Yields as the Traits say, once interval iterations were done: when the time
+ * budget is set and used up, otherwise only if the reactor needs it (as
+ * maybe_yield does).
+ */
+template<typename Traits>
+class yield_point {
+public:
+    using clock_type = std::chrono::steady_clock;
+
+    ss::future<> operator()() {
+        Traits::yield_called();
+        if constexpr (Traits::time_budget.count() > 0) {
+            auto now = clock_type::now();
+            if (now - _last_yield >= Traits::time_budget) {
+                _last_yield = now;
+                return ss::yield();
+            }
+        }
+        if (ss::need_preempt()) {
+            return ss::yield();
+        }
+        return ss::make_ready_future();
+    }
+
+private:
+    clock_type::time_point _last_yield{clock_type::now()};
+};
+
 template<
   typename Traits,
   typename Counter,
@@ -127,15 +174,15 @@ template<
   std::forward_iterator Iterator>
 ss::future<>
 async_for_each_coro(Counter counter, Iterator begin, Iterator end, Fn f) {
+    yield_point<Traits> yield;
     do {
         auto new_begin = for_each_limit(
           begin, end, remaining<Traits>(counter), f);
         begin = new_begin.iter;
         counter.count += new_begin.count;
         if (counter.count >= Traits::interval) {
-            co_await ss::coroutine::maybe_yield();
+            co_await yield();
             counter.count = 0;
-            Traits::yield_called();
         }
     } while (begin != end);
 }
@@ -166,6 +213,114 @@ async_for_each_fast(Counter counter, Iterator begin, Iterator end, Fn f) {
       counter, new_begin.iter, end, std::move(f));
 }
 
+template<
+  typename Traits,
+  std::forward_iterator Iterator,
+  std::weakly_incrementable Out>
+ss::future<Out> async_copy_coro(Iterator begin, Iterator end, Out out) {
+    yield_point<Traits> yield;
+    while (begin != end) {
+        co_await yield();
+        auto copied = for_each_limit(
+          begin, end, Traits::interval, [&out](const auto& v) {
+              *out = v;
+              ++out;
+          });
+        begin = copied.iter;
+    }
+    co_return out;
+}
+
+// containers erasing an element does not invalidate the iterators to the
+// others of, e.g. maps
+template<typename Container>
+concept erasable_by_iterator = requires(
+  Container& c, typename Container::iterator it) {
+    typename Container::key_type;
+    c.erase(it);
+};
+
+// containers whose elements are moved down to fill the erased ones, e.g.
+// vectors
+template<typename Container>
+concept compactable = std::ranges::random_access_range<Container>
+                      && !erasable_by_iterator<Container>;
+
+/**
+ * Visits at most limit elements from it on, erasing those matching pred.
+ * Returns the iterator to the next element to visit.
+ */
+template<erasable_by_iterator Container, typename Pred>
+typename Container::iterator erase_if_limit(
+  Container& c,
+  typename Container::iterator it,
+  ssize_t limit,
+  Pred& pred,
+  size_t& erased) {
+    for (ssize_t i = 0; i < limit && it != c.end(); ++i) {
+        if (pred(*it)) {
+            c.erase(it++);
+            ++erased;
+        } else {
+            ++it;
+        }
+    }
+    return it;
+}
+
+/**
+ * Visits at most limit elements from index read on, moving those that do not
+ * match pred down to index write. Returns the next index to read.
+ */
+template<compactable Container, typename Pred>
+size_t compact_limit(
+  Container& c, size_t read, size_t& write, ssize_t limit, Pred& pred) {
+    const auto end = std::min(c.size(), read + static_cast<size_t>(limit));
+    for (; read < end; ++read) {
+        if (!pred(c[read])) {
+            if (write != read) {
+                c[write] = std::move(c[read]);
+            }
+            ++write;
+        }
+    }
+    return read;
+}
+
+template<compactable Container>
+size_t erase_tail(Container& c, size_t size) {
+    const auto erased = c.size() - size;
+    auto new_end = c.begin() + static_cast<ssize_t>(size);
+    if constexpr (requires { c.erase_to_end(new_end); }) {
+        c.erase_to_end(new_end);
+    } else {
+        c.erase(new_end, c.end());
+    }
+    return erased;
+}
+
+template<typename Traits, erasable_by_iterator Container, typename Pred>
+ss::future<size_t> async_erase_if_coro(
+  Container& c, typename Container::iterator it, Pred pred, size_t erased) {
+    yield_point<Traits> yield;
+    while (it != c.end()) {
+        co_await yield();
+        it = erase_if_limit(c, it, Traits::interval, pred, erased);
+    }
+    co_return erased;
+}
+
+template<typename Traits, compactable Container, typename Pred>
+ss::future<size_t>
+async_erase_if_coro(Container& c, size_t read, size_t write, Pred pred) {
+    yield_point<Traits> yield;
+    while (read < c.size()) {
+        co_await yield();
+        read = compact_limit(c, read, write, Traits::interval, pred);
+    }
+    co_return erase_tail(c, write);
+}
+
 } // namespace detail
 
 /**
@@ -252,4 +407,90 @@ ss::future<> async_for_each_counter(
       detail::ref_counter{counter.count}, begin, end, std::move(f));
 }
 
+/**
+ * @brief Call f on every element of a container, e.g. a map, yielding
+ * occasionally.
+ *
+ * Same as async_for_each over the whole range of the container, which must
+ * not be modified until the returned future resolves.
+ */
+template<
+  typename Traits = async_algo_traits,
+  std::ranges::forward_range Range,
+  typename Fn>
+ss::future<> async_for_each(Range& range, Fn f) {
+    return async_for_each<Traits>(
+      std::ranges::begin(range), std::ranges::end(range), std::move(f));
+}
+
+/**
+ * @brief Copy the elements of a range to out, yielding occasionally.
+ *
+ * This is equivalent to std::copy, except that the computational loop yields
+ * every Traits::interval iterations. The returned future resolves to the
+ * output iterator past the last element copied.
+ *
+ * The iterators must remain valid until the returned future resolves.
+ */
+template<
+  typename Traits = async_algo_traits,
+  std::forward_iterator Iterator,
+  std::weakly_incrementable Out>
+ss::future<Out> async_copy(Iterator begin, Iterator end, Out out) {
+    // like async_for_each_fast, small ranges are copied without a coroutine
+    auto copied = detail::for_each_limit(
+      begin, end, Traits::interval, [&out](const auto& v) {
+          *out = v;
+          ++out;
+      });
+    if (copied.iter == end) [[likely]] {
+        return ss::make_ready_future<Out>(std::move(out));
+    }
+    return detail::async_copy_coro<Traits>(copied.iter, end, std::move(out));
+}
+
+/**
+ * @brief Erase the elements of a container matching pred, yielding
+ * occasionally.
+ *
+ * This is equivalent to std::erase_if, except that the computational loop
+ * yields every Traits::interval iterations. The returned future resolves to
+ * the number of elements erased.
+ *
+ * Maps and sets erase the elements in place, so the container stays valid
+ * while the loop is suspended. Random access containers (vector, deque,
+ * chunked_vector) are compacted: the elements kept are moved down over the
+ * erased ones and the tail is erased at the end, so the container holds
+ * moved-from elements while the loop is suspended. In either case it must not
+ * be modified, nor its elements read, until the returned future resolves.
+ *
+ * The predicate is taken by value.
+ */
+template<typename Traits = async_algo_traits, typename Container, typename Pred>
+requires detail::erasable_by_iterator<Container>
+         || detail::compactable<Container>
+ss::future<size_t> async_erase_if(Container& c, Pred pred) {
+    // like async_for_each_fast, small containers are handled without a
+    // coroutine
+    if constexpr (detail::erasable_by_iterator<Container>) {
+        size_t erased = 0;
+        auto it = detail::erase_if_limit(
+          c, c.begin(), Traits::interval, pred, erased);
+        if (it == c.end()) [[likely]] {
+            return ss::make_ready_future<size_t>(erased);
+        }
+        return detail::async_erase_if_coro<Traits>(
+          c, it, std::move(pred), erased);
+    } else {
+        size_t write = 0;
+        auto read = detail::compact_limit(
+          c, 0, write, Traits::interval, pred);
+        if (read == c.size()) [[likely]] {
+            return ss::make_ready_future<size_t>(detail::erase_tail(c, write));
+        }
+        return detail::async_erase_if_coro<Traits>(
+          c, read, write, std::move(pred));
+    }
+}
+
 } // namespace ssx
@@ -252,6 +252,69 @@ TEST(AsyncAlgo, async_for_each_large_container) {
 int value(int i) { return i; }
 int value(std::pair<const int, int> p) { return p.second; }
 
+TYPED_TEST(AsyncAlgo, async_for_each_range) {
+    auto c = this->make(250);
+    auto expected = c;
+    std::for_each(expected.begin(), expected.end(), add_one{});
+
+    task_counter t_counter;
+    ssx::async_for_each<test_traits<100>>(c, add_one{}).get();
+    EXPECT_EQ(c, expected);
+    EXPECT_EQ(2, t_counter.yield_delta());
+}
+
+TYPED_TEST(AsyncAlgo, async_copy_same_result) {
+    for (size_t size : {0, 1, 99, 100, 101, 1000}) {
+        auto c = this->make(size);
+        std::vector<typename TypeParam::value_type> expected(
+          c.begin(), c.end());
+
+        std::vector<typename TypeParam::value_type> copied;
+        ssx::async_copy(c.begin(), c.end(), std::back_inserter(copied)).get();
+        EXPECT_EQ(copied, expected);
+    }
+}
+
+TYPED_TEST(AsyncAlgo, async_erase_if_same_result) {
+    auto is_odd = [](const auto& v) { return value(v) % 2 == 1; };
+    for (size_t size : {0, 1, 2, 99, 100, 101, 1000}) {
+        auto c = this->make(size);
+        auto expected = c;
+        auto expected_erased = std::erase_if(expected, is_odd);
+
+        task_counter t_counter;
+        auto erased = ssx::async_erase_if<test_traits<10>>(c, is_odd).get();
+        EXPECT_EQ(erased, expected_erased);
+        EXPECT_EQ(c, expected);
+        // the first interval is done before the first yield
+        const ssize_t expected_yields = size == 0 ? 0 : (size + 9) / 10 - 1;
+        EXPECT_EQ(expected_yields, t_counter.yield_delta());
+    }
+}
+
+namespace {
+struct time_budget_traits : async_algo_traits {
+    constexpr static ssize_t interval = 1;
+    constexpr static std::chrono::microseconds time_budget{1};
+};
+} // namespace
+
+TEST(AsyncAlgo, async_for_each_time_budget) {
+    // every interval takes longer than the time budget, so the loop yields
+    // to the reactor even though it did not ask for it
+    std::vector<int> v(100);
+    task_counter tasks;
+    auto slow = [](int& x) {
+        auto until = std::chrono::steady_clock::now() + 2us;
+        while (std::chrono::steady_clock::now() < until) {
+        }
+        x++;
+    };
+    async_for_each<time_budget_traits>(v.begin(), v.end(), slow).get();
+    EXPECT_GT(tasks.task_delta(), 50);
+    EXPECT_EQ(v, std::vector<int>(100, 1));
+}
+
 TYPED_TEST(AsyncAlgo, async_for_each_move_correctness) {
     auto v = this->make(10);
 
@@ -163,4 +163,113 @@ TEST(WorkQueue, RecursiveSubmit) {
     queue.shutdown().get();
 }
 
+TEST(WorkQueue, Priorities) {
+    work_queue queue([](auto ex) { std::rethrow_exception(ex); });
+    queue.submit([] { return ss::yield(); });
+
+    std::vector<int> values;
+    auto push = [&values](int v) {
+        return [&values, v] {
+            values.push_back(v);
+            return ss::now();
+        };
+    };
+    queue.submit({.priority = work_priority::background}, push(1));
+    queue.submit(push(2));
+    queue.submit({.priority = work_priority::urgent}, push(3));
+    queue.submit({.priority = work_priority::urgent}, push(4));
+    queue.submit(push(5));
+    ss::promise<> p;
+    queue.submit({.priority = work_priority::background}, [&] {
+        values.push_back(6);
+        p.set_value();
+        return ss::now();
+    });
+
+    p.get_future().get();
+    EXPECT_THAT(values, ElementsAre(3, 4, 2, 5, 1, 6));
+    queue.shutdown().get();
+}
+
+TEST(WorkQueue, OverdueDeadlinesRunFirst) {
+    work_queue queue([](auto ex) { std::rethrow_exception(ex); });
+    queue.submit([] { return ss::yield(); });
+
+    std::vector<int> values;
+    queue.submit({.priority = work_priority::urgent}, [&] {
+        values.push_back(1);
+        return ss::now();
+    });
+    queue.submit(
+      {.priority = work_priority::background,
+       .deadline = ss::lowres_clock::now() - 1s},
+      [&] {
+          values.push_back(2);
+          return ss::now();
+      });
+    queue.submit({.deadline = ss::lowres_clock::now() + 1h}, [&] {
+        values.push_back(3);
+        return ss::now();
+    });
+    auto done = submit(&queue, [&] { values.push_back(4); });
+
+    done.get();
+    EXPECT_THAT(values, ElementsAre(2, 1, 3, 4));
+    queue.shutdown().get();
+}
+
+TEST(WorkQueue, CoalescesTasksByKey) {
+    work_queue queue([](auto ex) { std::rethrow_exception(ex); });
+    queue.submit([] { return ss::yield(); });
+
+    std::vector<int> values;
+    auto push = [&values](int v) {
+        return [&values, v] {
+            values.push_back(v);
+            return ss::now();
+        };
+    };
+    queue.submit({.key = "a"}, push(1));
+    queue.submit(push(2));
+    queue.submit({.key = "b"}, push(3));
+    // replaces the pending task of key "a" in its place
+    queue.submit({.key = "a"}, push(4));
+    // promotes the pending task of key "b"
+    queue.submit({.priority = work_priority::urgent, .key = "b"}, push(5));
+    EXPECT_EQ(queue.size(), 3);
+    auto done = submit(&queue, [&] { values.push_back(6); });
+
+    done.get();
+    EXPECT_THAT(values, ElementsAre(5, 4, 2, 6));
+
+    // once ran, a key can be submitted again
+    queue.submit({.key = "a"}, push(7));
+    submit(&queue, [&] { values.push_back(8); }).get();
+    queue.shutdown().get();
+    EXPECT_THAT(values, ElementsAre(5, 4, 2, 6, 7, 8));
+}
+
+TEST(WorkQueue, ThrottlesBackgroundTasks) {
+    work_queue queue([](auto ex) { std::rethrow_exception(ex); });
+    bool under_pressure = true;
+    queue.set_throttle([&under_pressure] { return under_pressure; });
+
+    std::vector<int> values;
+    ss::promise<> p;
+    queue.submit({.priority = work_priority::background}, [&] {
+        values.push_back(1);
+        p.set_value();
+        return ss::now();
+    });
+    auto done = submit(&queue, [&] { values.push_back(2); });
+    done.get();
+    EXPECT_THAT(values, ElementsAre(2));
+    EXPECT_EQ(queue.size(), 1);
+
+    under_pressure = false;
+    p.get_future().get();
+    EXPECT_THAT(values, ElementsAre(2, 1));
+    queue.shutdown().get();
+}
+
 } // namespace ssx
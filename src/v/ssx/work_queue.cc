@@ -30,13 +30,86 @@ work_queue::work_queue(ss::scheduling_group sg, error_reporter_fn fn)
 }
 
 void work_queue::submit(ss::noncopyable_function<ss::future<>()> fn) {
+    submit(work_options{}, std::move(fn));
+}
+
+void work_queue::submit(
+  work_options opts, ss::noncopyable_function<ss::future<>()> fn) {
     if (_as.abort_requested()) {
         return;
     }
-    _tasks.push_back(std::move(fn));
+    if (opts.key) {
+        if (auto it = _keyed.find(*opts.key); it != _keyed.end()) {
+            // coalesce with the pending task, it keeps its place in the
+            // queue unless it is promoted to a higher priority
+            auto id = it->second;
+            auto pending = erase(id);
+            id.first = std::min(id.first, opts.priority);
+            if (pending.deadline && opts.deadline) {
+                opts.deadline = std::min(*pending.deadline, *opts.deadline);
+            } else if (!opts.deadline) {
+                opts.deadline = pending.deadline;
+            }
+            insert(
+              id,
+              task{
+                .fn = std::move(fn),
+                .deadline = opts.deadline,
+                .key = std::move(opts.key)});
+            _cond_var.signal();
+            return;
+        }
+    }
+    insert(
+      task_id{opts.priority, _next_seq++},
+      task{
+        .fn = std::move(fn),
+        .deadline = opts.deadline,
+        .key = std::move(opts.key)});
+    _cond_var.signal();
+}
+
+void work_queue::set_throttle(throttle_fn fn) {
+    _throttle = std::move(fn);
     _cond_var.signal();
 }
 
+void work_queue::insert(task_id id, task t) {
+    if (t.deadline) {
+        _deadlines.emplace(*t.deadline, id);
+    }
+    if (t.key) {
+        _keyed[*t.key] = id;
+    }
+    _tasks.emplace(id, std::move(t));
+}
+
+work_queue::task work_queue::erase(task_id id) {
+    auto it = _tasks.find(id);
+    auto t = std::move(it->second);
+    _tasks.erase(it);
+    if (t.deadline) {
+        _deadlines.erase(std::make_pair(*t.deadline, id));
+    }
+    if (t.key) {
+        _keyed.erase(*t.key);
+    }
+    return t;
+}
+
+std::optional<work_queue::task> work_queue::pick() {
+    if (
+      !_deadlines.empty()
+      && _deadlines.begin()->first <= ss::lowres_clock::now()) {
+        return erase(_deadlines.begin()->second);
+    }
+    auto id = _tasks.begin()->first;
+    if (id.first == work_priority::background && _throttle && _throttle()) {
+        return std::nullopt;
+    }
+    return erase(id);
+}
+
 ss::future<> work_queue::shutdown() {
     _as.request_abort();
     _cond_var.signal();
@@ -44,12 +117,17 @@ ss::future<> work_queue::shutdown() {
 }
 
 void work_queue::submit_after(
-  ss::future<> fut, ss::noncopyable_function<ss::future<>()> fn) {
+  ss::future<> fut,
+  work_options opts,
+  ss::noncopyable_function<ss::future<>()> fn) {
     auto holder = _gate.hold();
     ssx::background = fut.then_wrapped(
-      [this, fn = std::move(fn), h = std::move(holder)](auto fut) mutable {
+      [this,
+       opts = std::move(opts),
+       fn = std::move(fn),
+       h = std::move(holder)](auto fut) mutable {
           fut.ignore_ready_future();
-          submit(std::move(fn));
+          submit(std::move(opts), std::move(fn));
       });
 }
 
@@ -60,10 +138,18 @@ ss::future<> work_queue::process() {
         if (_as.abort_requested()) {
             co_return;
         }
-        auto task_fn = std::move(_tasks.front());
-        _tasks.pop_front();
+        auto next = pick();
+        if (!next) {
+            // only throttled tasks are pending, look again once the
+            // pressure may have gone or when a task is submitted
+            try {
+                co_await _cond_var.wait(throttle_recheck_interval);
+            } catch (const ss::condition_variable_timed_out&) {
+            }
+            continue;
+        }
         try {
-            co_await task_fn();
+            co_await next->fn();
         } catch (...) {
             _error_reporter(std::current_exception());
         }
@@ -15,43 +15,106 @@
 #include "ssx/future-util.h"
 
 #include <seastar/core/abort_source.hh>
-#include <seastar/core/chunked_fifo.hh>
 #include <seastar/core/condition-variable.hh>
 #include <seastar/core/future-util.hh>
 #include <seastar/core/future.hh>
 #include <seastar/core/lowres_clock.hh>
 #include <seastar/core/scheduling.hh>
+#include <seastar/core/sstring.hh>
 #include <seastar/util/noncopyable_function.hh>
 
+#include <absl/container/btree_map.h>
+#include <absl/container/btree_set.h>
+#include <absl/container/flat_hash_map.h>
+
+#include <optional>
+
 namespace ssx {
 
+enum class work_priority : uint8_t {
+    // maintenance that must not wait behind routine work
+    urgent = 0,
+    normal = 1,
+    // work that can wait while the shard is busy, see
+    // work_queue::set_throttle
+    background = 2,
+};
+
+struct work_options {
+    work_priority priority = work_priority::normal;
+    // once it passed, the task runs before any task whose deadline did not,
+    // regardless of priorities and throttling
+    std::optional<ss::lowres_clock::time_point> deadline;
+    // a task submitted while a task with the same key is pending replaces it
+    // (e.g. a rebalance requested several times), keeping the earliest
+    // position, the highest priority and the earliest deadline of the two
+    std::optional<ss::sstring> key;
+};
+
 /**
  * A small utility for running async tasks sequentially on a single fiber.
+ *
+ * Tasks run by priority then in the order of submission, tasks submitted
+ * without options are normal and so run in FIFO order.
  */
 class work_queue {
 public:
     using error_reporter_fn
       = ss::noncopyable_function<void(const std::exception_ptr&)>;
+    using throttle_fn = ss::noncopyable_function<bool()>;
 
     explicit work_queue(error_reporter_fn);
     work_queue(ss::scheduling_group, error_reporter_fn);
     // Add a task to the queue to be processed.
     void submit(ss::noncopyable_function<ss::future<>()>);
+    void submit(work_options, ss::noncopyable_function<ss::future<>()>);
     // Add a task to the queue to be processed after some timeout.
     template<typename Clock = ss::lowres_clock>
     void
       submit_delayed(Clock::duration, ss::noncopyable_function<ss::future<>()>);
+    template<typename Clock = ss::lowres_clock>
+    void submit_delayed(
+      Clock::duration, work_options, ss::noncopyable_function<ss::future<>()>);
+    // Background tasks are held back while the function returns true (e.g.
+    // the shard is under CPU pressure), it is checked again every
+    // throttle_recheck_interval while only background tasks are pending.
+    void set_throttle(throttle_fn);
     // Shutdown the queue, waiting for the currently executing task to finish.
     ss::future<> shutdown();
 
+    // The number of pending tasks.
+    size_t size() const { return _tasks.size(); }
+
+    static constexpr auto throttle_recheck_interval
+      = std::chrono::milliseconds(100);
+
 private:
-    void submit_after(ss::future<>, ss::noncopyable_function<ss::future<>()>);
+    // tasks are ordered by priority, then by order of submission
+    using task_id = std::pair<work_priority, uint64_t>;
+    struct task {
+        ss::noncopyable_function<ss::future<>()> fn;
+        std::optional<ss::lowres_clock::time_point> deadline;
+        std::optional<ss::sstring> key;
+    };
+
+    void submit_after(
+      ss::future<>, work_options, ss::noncopyable_function<ss::future<>()>);
+
+    void insert(task_id, task);
+    task erase(task_id);
+    // The next task to run, none if only throttled tasks are pending.
+    std::optional<task> pick();
 
     ss::future<> process();
 
     error_reporter_fn _error_reporter;
+    throttle_fn _throttle;
     ss::condition_variable _cond_var;
-    ss::chunked_fifo<ss::noncopyable_function<ss::future<>()>> _tasks;
+    absl::btree_map<task_id, task> _tasks;
+    absl::btree_set<std::pair<ss::lowres_clock::time_point, task_id>>
+      _deadlines;
+    absl::flat_hash_map<ss::sstring, task_id> _keyed;
+    uint64_t _next_seq{0};
     ss::abort_source _as;
     ss::gate _gate;
 };
@@ -59,9 +122,18 @@ private:
 template<typename Clock>
 void work_queue::submit_delayed(
   Clock::duration delay, ss::noncopyable_function<ss::future<>()> fn) {
+    submit_delayed<Clock>(delay, work_options{}, std::move(fn));
+}
+
+template<typename Clock>
+void work_queue::submit_delayed(
+  Clock::duration delay,
+  work_options opts,
+  ss::noncopyable_function<ss::future<>()> fn) {
     if (_as.abort_requested()) {
         return;
     }
-    submit_after(ss::sleep_abortable<Clock>(delay, _as), std::move(fn));
+    submit_after(
+      ss::sleep_abortable<Clock>(delay, _as), std::move(opts), std::move(fn));
 }
 } // namespace ssx
@@ -56,9 +56,9 @@ public:
             f = _log_mgr->stop();
         }
         if (_kvstore) {
-            return f.then([this] { return _kvstore->stop(); });
+            f = f.then([this] { return _kvstore->stop(); });
         }
-        return f;
+        return f.then([this] { return _resources.stop(); });
     }
 
     void set_node_uuid(const model::node_uuid& node_uuid) {
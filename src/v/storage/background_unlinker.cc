@@ -0,0 +1,142 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "storage/background_unlinker.h"
+
+#include "base/vlog.h"
+#include "ssx/future-util.h"
+#include "storage/logger.h"
+
+#include <seastar/core/file.hh>
+#include <seastar/core/seastar.hh>
+#include <seastar/core/sleep.hh>
+#include <seastar/core/smp.hh>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <chrono>
+
+namespace storage {
+
+background_unlinker::background_unlinker(
+  config::binding<size_t> bytes_per_sec, config::binding<size_t> truncate_step)
+  : _bytes_per_sec(std::move(bytes_per_sec))
+  , _truncate_step(std::move(truncate_step)) {}
+
+ss::future<> background_unlinker::start(std::filesystem::path base_dir) {
+    auto dir = base_dir / ".segment_deletion"
+               / fmt::to_string(ss::this_shard_id());
+    if (co_await ss::file_exists(dir.string())) {
+        co_await ss::recursive_remove_directory(dir);
+    }
+    co_await ss::recursive_touch_directory(dir.string());
+    _dir = std::move(dir);
+}
+
+ss::future<bool>
+background_unlinker::remove(std::filesystem::path path, size_t size) {
+    if (
+      !_dir || _bytes_per_sec() == 0 || _truncate_step() == 0
+      || size < _truncate_step() || _gate.is_closed()) {
+        co_return false;
+    }
+
+    // the file is renamed right away so that a new file created under the
+    // same name is never mistaken for this one
+    auto pending = *_dir / fmt::to_string(_next_id++);
+    try {
+        co_await ss::rename_file(path.string(), pending.string());
+    } catch (...) {
+        vlog(
+          stlog.info,
+          "Cannot queue {} for deletion: {}",
+          path,
+          std::current_exception());
+        co_return false;
+    }
+    vlog(stlog.debug, "Queued {} ({} bytes) for deletion", path, size);
+
+    _queue.push_back(pending_file{.path = std::move(pending), .size = size});
+    _pending_bytes += size;
+    if (!_running) {
+        _running = true;
+        ssx::spawn_with_gate(_gate, [this] { return run(); });
+    }
+    _cv.signal();
+    co_return true;
+}
+
+ss::future<> background_unlinker::run() {
+    while (!_as.abort_requested()) {
+        if (_queue.empty()) {
+            try {
+                co_await _cv.wait();
+            } catch (const ss::broken_condition_variable&) {
+                break;
+            }
+            continue;
+        }
+        auto file = std::move(_queue.front());
+        _queue.pop_front();
+        try {
+            co_await release(file);
+        } catch (const ss::sleep_aborted&) {
+            // shutting down, the file is removed on next start
+        } catch (...) {
+            vlog(
+              stlog.warn,
+              "Error deleting {}: {}",
+              file.path,
+              std::current_exception());
+        }
+        _pending_bytes -= file.size;
+    }
+}
+
+ss::future<> background_unlinker::release(const pending_file& file) {
+    auto f = co_await ss::open_file_dma(
+      file.path.string(), ss::open_flags::wo);
+    std::exception_ptr ex;
+    try {
+        auto remaining = co_await f.size();
+        while (remaining > 0) {
+            auto step = std::min<uint64_t>(
+              remaining, std::max<size_t>(_truncate_step(), 1));
+            remaining -= step;
+            co_await f.truncate(remaining);
+            if (auto rate = _bytes_per_sec(); rate > 0) {
+                auto delay = std::chrono::duration<double>(
+                  static_cast<double>(step) / static_cast<double>(rate));
+                co_await ss::sleep_abortable<ss::lowres_clock>(
+                  std::chrono::duration_cast<ss::lowres_clock::duration>(
+                    delay),
+                  _as);
+            }
+        }
+    } catch (...) {
+        ex = std::current_exception();
+    }
+    co_await f.close();
+    if (ex) {
+        std::rethrow_exception(ex);
+    }
+    co_await ss::remove_file(file.path.string());
+    vlog(stlog.debug, "Deleted {} ({} bytes)", file.path, file.size);
+}
+
+ss::future<> background_unlinker::stop() {
+    _as.request_abort();
+    _cv.broken();
+    co_await _gate.close();
+}
+
+} // namespace storage
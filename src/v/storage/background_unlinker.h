@@ -0,0 +1,94 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "base/seastarx.h"
+#include "config/property.h"
+
+#include <seastar/core/abort_source.hh>
+#include <seastar/core/condition-variable.hh>
+#include <seastar/core/future.hh>
+#include <seastar/core/gate.hh>
+
+#include <deque>
+#include <filesystem>
+#include <optional>
+
+namespace storage {
+
+/**
+ * Per-shard service releasing removed segment files in the background.
+ *
+ * Unlinking a large file makes the filesystem free all of its extents at
+ * once, which on XFS and ext4 can hold up other I/O on the disk for a long
+ * time: retention removing many segments at once shows up as produce latency.
+ * With `segment_deletion_bytes_per_sec` set, large files are instead renamed
+ * out of the way and queued. A background fiber shrinks each one by
+ * `segment_deletion_truncate_step` at a time, at the configured rate, and
+ * unlinks what is left.
+ *
+ * Queued files are moved to a per-shard directory under the data directory.
+ * Files still queued at shutdown are left there and removed when the service
+ * is next started. Files from other filesystems are removed inline.
+ */
+class background_unlinker {
+public:
+    background_unlinker(
+      config::binding<size_t> bytes_per_sec,
+      config::binding<size_t> truncate_step);
+    background_unlinker(const background_unlinker&) = delete;
+    background_unlinker& operator=(const background_unlinker&) = delete;
+    background_unlinker(background_unlinker&&) = delete;
+    background_unlinker& operator=(background_unlinker&&) = delete;
+    ~background_unlinker() noexcept = default;
+
+    /**
+     * Set up the directory for queued files under \p base_dir, removing
+     * files left over from a previous run. Nothing is queued before this is
+     * called.
+     */
+    ss::future<> start(std::filesystem::path base_dir);
+
+    /**
+     * Queue the file at \p path, of \p size bytes, for deletion. Returns
+     * false if the file was not taken, in which case the caller removes it
+     * inline as usual.
+     */
+    ss::future<bool> remove(std::filesystem::path path, size_t size);
+
+    /// Bytes queued for deletion and not yet released.
+    size_t pending_bytes() const { return _pending_bytes; }
+
+    ss::future<> stop();
+
+private:
+    struct pending_file {
+        std::filesystem::path path;
+        size_t size;
+    };
+
+    ss::future<> run();
+    ss::future<> release(const pending_file&);
+
+    config::binding<size_t> _bytes_per_sec;
+    config::binding<size_t> _truncate_step;
+    std::optional<std::filesystem::path> _dir;
+    std::deque<pending_file> _queue;
+    size_t _pending_bytes{0};
+    uint64_t _next_id{0};
+    bool _running{false};
+    ss::condition_variable _cv;
+    ss::abort_source _as;
+    ss::gate _gate;
+};
+
+} // namespace storage
@@ -0,0 +1,106 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "model/fundamental.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <optional>
+
+namespace storage {
+
+/**
+ * File positions of batch boundaries within a segment, as found by the
+ * offset range size scans and by the appender.
+ *
+ * The segment index resolves an offset to a file position only at index
+ * entries, so translating an arbitrary batch offset means scanning from the
+ * nearest entry. The archival uploader translates the same boundaries over
+ * and over: each upload starts where the previous one ended. Remembering a
+ * handful of recent boundaries turns those repeated scans into lookups.
+ *
+ * A boundary stays valid until the segment's data file is rewritten or
+ * truncated, at which point the owner clears the cache.
+ */
+class batch_boundary_cache {
+public:
+    static constexpr size_t capacity = 4;
+
+    /**
+     * The position between two batches. All batches before the position end
+     * at or before prev_last, and the batch starting at the position (if
+     * any) begins at or after next_base.
+     */
+    struct boundary {
+        model::offset prev_last;
+        model::offset next_base;
+        size_t filepos;
+
+        /// Position after all batches with a base offset below target.
+        bool matches_exclusive(model::offset target) const {
+            return prev_last < target && target <= next_base;
+        }
+
+        /// Position after all batches with a last offset up to target.
+        bool matches_inclusive(model::offset target) const {
+            return prev_last <= target && target < next_base;
+        }
+    };
+
+    std::optional<size_t>
+    find(model::offset target, model::boundary_type type) const {
+        auto matches = [target, type](const boundary& b) {
+            return type == model::boundary_type::inclusive
+                     ? b.matches_inclusive(target)
+                     : b.matches_exclusive(target);
+        };
+        if (_tail && matches(*_tail)) {
+            return _tail->filepos;
+        }
+        for (size_t i = 0; i < _size; ++i) {
+            if (matches(_boundaries[i])) {
+                return _boundaries[i].filepos;
+            }
+        }
+        return std::nullopt;
+    }
+
+    /// Remember a boundary found by scanning, replacing the oldest one.
+    void insert(boundary b) {
+        _boundaries[_next] = b;
+        _next = (_next + 1) % capacity;
+        _size = std::min(_size + 1, capacity);
+    }
+
+    /// Record the end of a batch appended at the tail of the segment.
+    void append(model::offset last_offset, size_t end_filepos) {
+        _tail = boundary{
+          .prev_last = last_offset,
+          .next_base = model::next_offset(last_offset),
+          .filepos = end_filepos};
+    }
+
+    void clear() {
+        _tail.reset();
+        _size = 0;
+        _next = 0;
+    }
+
+private:
+    std::optional<boundary> _tail;
+    std::array<boundary, capacity> _boundaries{};
+    size_t _size{0};
+    size_t _next{0};
+};
+
+} // namespace storage
@@ -132,9 +132,29 @@ batch_cache::batch_cache(const reclaim_options& opts)
   , _background_reclaimer(
       *this, opts.min_free_memory, opts.background_reclaimer_sg)
   , _available_mem_deregister(register_memory_reporter(*this)) {
+    if (s3_fifo()) {
+        _ghost.emplace();
+    }
     _background_reclaimer.start();
 }
 
+void batch_cache::admit(range& r, model::offset o) {
+    if (!s3_fifo()) {
+        _lru.push_back(r);
+        _probe.admitted_main();
+        return;
+    }
+    if (_ghost->remove(&r._index, o)) {
+        _probe.ghost_hit();
+        _probe.admitted_main();
+        _lru.push_back(r);
+        return;
+    }
+    _probe.admitted_small();
+    r._in_small = true;
+    _small.push_back(r);
+}
+
 batch_cache::entry
 batch_cache::put(batch_cache_index& index, const model::record_batch& input) {
     // notify no matter what the exit path
@@ -156,8 +176,11 @@ batch_cache::put(batch_cache_index& index, const model::record_batch& input) {
 
     if (static_cast<size_t>(input.size_bytes()) > range::range_size) {
         auto r = new range(index, input);
-        _lru.push_back(*r);
+        admit(*r, input.base_offset());
         _size_bytes += r->memory_size();
+        if (r->_in_small) {
+            _small_size_bytes += r->memory_size();
+        }
         return entry(0, r->weak_from_this());
     }
 
@@ -165,8 +188,11 @@ batch_cache::put(batch_cache_index& index, const model::record_batch& input) {
       !index._small_batches_range || !index._small_batches_range->valid()
       || !index._small_batches_range->fits(input)) {
         auto r = new range(index);
-        _lru.push_back(*r);
+        admit(*r, input.base_offset());
         _size_bytes += r->memory_size();
+        if (r->_in_small) {
+            _small_size_bytes += r->memory_size();
+        }
         index._small_batches_range = r->weak_from_this();
     }
 
@@ -176,13 +202,16 @@ batch_cache::put(batch_cache_index& index, const model::record_batch& input) {
     int64_t diff = (int64_t)index._small_batches_range->memory_size()
                    - initial_sz;
     _size_bytes += diff;
+    if (index._small_batches_range->_in_small) {
+        _small_size_bytes += diff;
+    }
     return entry(offset, index._small_batches_range->weak_from_this());
 }
 
 batch_cache::~batch_cache() noexcept {
     clear();
     vassert(
-      _size_bytes == 0 && _lru.empty(),
+      _size_bytes == 0 && _small_size_bytes == 0 && empty(),
       "Detected incorrect batch_cache accounting. {}",
       *this);
 }
@@ -194,6 +223,9 @@ void batch_cache::evict(range_ptr&& e) {
         // r-value reference `e` wouldn't do that.
         auto p = std::exchange(e, {});
         _size_bytes -= p->memory_size();
+        if (p->_in_small) {
+            _small_size_bytes -= p->memory_size();
+        }
         _lru.erase_and_dispose(
           _lru.iterator_to(*p), [](range* e) { delete e; });
     }
@@ -238,41 +270,12 @@ size_t batch_cache::reclaim(size_t size) {
      * index still exists even though the batch data was removed.
      */
     size_t reclaimed = 0;
-    intrusive_list<range, &range::_hook> reclaimed_ranges;
-
-    for (auto it = _lru.begin(); it != _lru.end();) {
-        if (reclaimed >= _reclaim_size) {
-            break;
-        }
-
-        // skip any range that has a live reference.
-        if (unlikely(it->pinned())) {
-            ++it;
-            continue;
-        }
-        // if entry is empty it will be disposed by other reclaim caller
-        if (unlikely(it->empty())) {
-            continue;
-        }
-        // reclaim the batch's record data
-        reclaimed += it->memory_size();
-        it->_arena.clear();
+    range_list reclaimed_ranges;
 
-        /*
-         * if the owning index is locked invalidate the range but leave it on
-         * the lru list for deferred deletion so as to not invalidate any open
-         * iterators on the index.
-         */
-        if (unlikely(it->_index.locked())) {
-            it->invalidate();
-            ++it;
-            continue;
-        }
-
-        // collect the entries that will be fully removed
-        it = _lru.erase_and_dispose(it, [&reclaimed_ranges](range* e) {
-            reclaimed_ranges.push_back(*e);
-        });
+    if (s3_fifo()) {
+        reclaim_s3_fifo(reclaimed_ranges, reclaimed);
+    } else {
+        reclaim_lru(reclaimed_ranges, reclaimed);
     }
 
     /*
@@ -304,14 +307,125 @@ size_t batch_cache::reclaim(size_t size) {
     return reclaimed;
 }
 
+batch_cache::range_list::iterator batch_cache::reclaim_range(
+  range_list& queue,
+  range_list::iterator it,
+  range_list& reclaimed,
+  size_t& reclaimed_bytes) {
+    // skip any range that has a live reference.
+    if (unlikely(it->pinned())) {
+        return ++it;
+    }
+    // if entry is empty it will be disposed by other reclaim caller
+    if (unlikely(it->empty())) {
+        return ++it;
+    }
+    // reclaim the batch's record data
+    const auto size = it->memory_size();
+    reclaimed_bytes += size;
+    if (it->_in_small) {
+        _small_size_bytes -= size;
+        it->_in_small = false;
+    }
+    it->_arena.clear();
+
+    /*
+     * if the owning index is locked invalidate the range but leave it on
+     * the lru list for deferred deletion so as to not invalidate any open
+     * iterators on the index.
+     */
+    if (unlikely(it->_index.locked())) {
+        it->invalidate();
+        return ++it;
+    }
+
+    // collect the entries that will be fully removed
+    return queue.erase_and_dispose(
+      it, [&reclaimed](range* e) { reclaimed.push_back(*e); });
+}
+
+void batch_cache::reclaim_lru(range_list& reclaimed, size_t& reclaimed_bytes) {
+    for (auto it = _lru.begin(); it != _lru.end();) {
+        if (reclaimed_bytes >= _reclaim_size) {
+            break;
+        }
+        it = reclaim_range(_lru, it, reclaimed, reclaimed_bytes);
+    }
+}
+
+void batch_cache::reclaim_s3_fifo(
+  range_list& reclaimed, size_t& reclaimed_bytes) {
+    /*
+     * drain the small queue down to its target share of the cache. ranges
+     * that were touched while on probation are promoted to the main queue,
+     * and the rest are reclaimed and remembered by the ghost queue.
+     */
+    const auto small_target = (_size_bytes / 100) * small_queue_percent;
+    for (auto it = _small.begin(); it != _small.end();) {
+        if (
+          reclaimed_bytes >= _reclaim_size
+          || _small_size_bytes <= small_target) {
+            break;
+        }
+        if (it->_freq > 1 && !it->empty()) {
+            auto& r = *it;
+            it = _small.erase(it);
+            _small_size_bytes -= r.memory_size();
+            r._in_small = false;
+            r._freq = 0;
+            _lru.push_back(r);
+            _probe.promoted();
+            continue;
+        }
+        if (!it->pinned() && !it->empty()) {
+            for (auto o : it->_offsets) {
+                _ghost->insert(&it->_index, o);
+            }
+        }
+        it = reclaim_range(_small, it, reclaimed, reclaimed_bytes);
+    }
+
+    /*
+     * then the main queue, giving ranges touched since they were last
+     * considered a second chance. each reinsertion decrements the frequency
+     * so the scan is bounded by max_freq passes over the queue.
+     */
+    for (auto it = _lru.begin(); it != _lru.end();) {
+        if (reclaimed_bytes >= _reclaim_size) {
+            break;
+        }
+        if (it->_freq > 0 && !it->pinned()) {
+            auto& r = *it;
+            it = _lru.erase(it);
+            --r._freq;
+            _lru.push_back(r);
+            continue;
+        }
+        it = reclaim_range(_lru, it, reclaimed, reclaimed_bytes);
+    }
+
+    /*
+     * the main queue may hold less than the request, in which case the
+     * remainder comes from the small queue regardless of its target.
+     */
+    for (auto it = _small.begin(); it != _small.end();) {
+        if (reclaimed_bytes >= _reclaim_size) {
+            break;
+        }
+        it = reclaim_range(_small, it, reclaimed, reclaimed_bytes);
+    }
+}
+
 std::optional<model::record_batch>
 batch_cache_index::get(model::offset offset) {
     lock_guard lk(*this);
     if (auto it = find_first_contains(offset); it != _index.end()) {
         batch_cache::range::lock_guard g(*it->second.range());
         _cache->touch(it->second.range());
+        _cache->probe().cache_hit();
         return it->second.batch();
     }
+    _cache->probe().cache_miss();
     return std::nullopt;
 }
 
@@ -328,7 +442,13 @@ batch_cache_index::read_result batch_cache_index::read(
     if (unlikely(offset > max_offset)) {
         return ret;
     }
-    for (auto it = find_first_contains(offset); it != _index.end();) {
+    auto it = find_first_contains(offset);
+    if (it == _index.end()) {
+        _cache->probe().cache_miss();
+    } else {
+        _cache->probe().cache_hit();
+    }
+    while (it != _index.end()) {
         auto batch = it->second.batch();
 
         auto take = !type_filter || type_filter == batch.header().type;
@@ -436,11 +556,13 @@ std::ostream&
 operator<<(std::ostream& os, const batch_cache::reclaim_options& opts) {
     fmt::print(
       os,
-      "growth window {} stable window {} min_size {} max_size {}",
+      "growth window {} stable window {} min_size {} max_size {} "
+      "eviction_policy {}",
       opts.growth_window,
       opts.stable_window,
       opts.min_size,
-      opts.max_size);
+      opts.max_size,
+      opts.eviction_policy);
     return os;
 }
 
@@ -449,7 +571,9 @@ std::ostream& operator<<(std::ostream& o, const batch_cache& b) {
     // Do _not_ print size of _lru
     return o << "{is_reclaiming:" << b.is_memory_reclaiming()
              << ", size_bytes: " << b._size_bytes
-             << ", lru_empty:" << b._lru.empty() << "}";
+             << ", small_size_bytes: " << b._small_size_bytes
+             << ", lru_empty:" << b._lru.empty()
+             << ", small_empty:" << b._small.empty() << "}";
 }
 std::ostream&
 operator<<(std::ostream& o, const batch_cache_index::read_result& c) {
@@ -13,9 +13,11 @@
 #include "base/units.h"
 #include "base/vassert.h"
 #include "container/intrusive_list_helpers.h"
+#include "model/metadata.h"
 #include "model/record.h"
 #include "resource_mgmt/available_memory.h"
 #include "ssx/semaphore.h"
+#include "storage/batch_cache_probe.h"
 
 #include <seastar/core/circular_buffer.hh>
 #include <seastar/core/condition-variable.hh>
@@ -27,9 +29,12 @@
 
 #include <absl/container/btree_map.h>
 #include <absl/container/flat_hash_map.h>
+#include <absl/hash/hash.h>
 
 #include <limits>
+#include <optional>
 #include <type_traits>
+#include <vector>
 
 class batch_cache_test_fixture;
 namespace storage {
@@ -94,8 +99,19 @@ class batch_cache_index;
  * the future, consider other solutions like blocking the reclaimer or only
  * allowing asynchronous reclaims while executing within the batch catch.
  *
- * TODO:
- *  - add probes to track statistics
+ * Eviction policy
+ * ===============
+ *
+ * By default ranges are reclaimed in LRU order. With the `s3_fifo` policy new
+ * ranges are instead admitted to a small probationary fifo queue, and only
+ * ranges that are touched again before they reach the head of that queue are
+ * promoted to the main queue. The main queue is a fifo with second chance
+ * reinsertion of recently touched ranges. Ranges reclaimed from the small
+ * queue are remembered by a ghost queue, and a batch that comes back while
+ * still present in the ghost queue is admitted directly to the main queue.
+ * This keeps a single scan (e.g. a consumer catching up from the start of a
+ * topic) from flushing the batches that are read repeatedly at the tail. See
+ * io/cache.h for the same scheme applied to the page cache.
  */
 
 class batch_cache {
@@ -115,6 +131,8 @@ public:
         // background reclaimer settings
         ss::scheduling_group background_reclaimer_sg;
         size_t min_free_memory = 64_MiB;
+        model::batch_cache_eviction_policy eviction_policy
+          = model::batch_cache_eviction_policy::lru;
     };
 
     /*
@@ -190,6 +208,9 @@ public:
         std::vector<model::offset> _offsets;
 
         bool _pinned{false};
+        // s3_fifo policy: access frequency (saturating) and queue membership
+        uint8_t _freq{0};
+        bool _in_small{false};
         size_t _size = 0;
         intrusive_list_hook _hook;
         batch_cache_index& _index;
@@ -246,7 +267,7 @@ public:
     ss::future<> stop() { return _background_reclaimer.stop(); }
 
     /// Returns true if the cache is empty, and false otherwise.
-    bool empty() const { return _lru.empty(); }
+    bool empty() const { return _lru.empty() && _small.empty(); }
 
     /// Removes all entries from the cache.
     void clear() { reclaim(std::numeric_limits<size_t>::max()); }
@@ -281,8 +302,12 @@ public:
     void touch(range_ptr& e) {
         if (e) {
             auto p = e.get();
-            p->_hook.unlink();
-            _lru.push_back(*p);
+            if (s3_fifo()) {
+                p->_freq = std::min<uint8_t>(p->_freq + 1, max_freq);
+            } else {
+                p->_hook.unlink();
+                _lru.push_back(*p);
+            }
         }
     }
 
@@ -312,8 +337,90 @@ public:
      */
     size_t size_bytes() const { return _size_bytes; }
 
+    /// Cache hit, miss and admission statistics.
+    const batch_cache_probe& probe() const { return _probe; }
+    batch_cache_probe& probe() { return _probe; }
+
+    /// Register the cache metrics. Must be called at most once per shard.
+    void setup_metrics() { _probe.setup_metrics(); }
+
 private:
     friend batch_cache_test_fixture;
+
+    using range_list = intrusive_list<range, &range::_hook>;
+
+    /// Saturation point of the s3_fifo access frequency counter.
+    static constexpr uint8_t max_freq = 3;
+    /// Target share of the cache held by the s3_fifo small queue, in percent.
+    static constexpr size_t small_queue_percent = 10;
+
+    /*
+     * Ghost queue for the s3_fifo policy. Recently reclaimed batches are
+     * remembered by a fingerprint of their owning index and base offset in a
+     * fixed size direct-mapped table. A colliding insert overwrites the older
+     * fingerprint, which approximates fifo order without any bookkeeping.
+     *
+     * The table is allocated up front because it is updated from within the
+     * synchronous memory reclaimer, where allocating is not an option.
+     */
+    class ghost_queue {
+    public:
+        static constexpr size_t slots = 8192;
+
+        ghost_queue()
+          : _table(slots, 0) {}
+
+        void insert(const batch_cache_index* index, model::offset o) {
+            auto fp = fingerprint(index, o);
+            _table[fp % slots] = fp;
+        }
+
+        /// Returns true and forgets the batch if it is in the ghost queue.
+        bool remove(const batch_cache_index* index, model::offset o) {
+            auto fp = fingerprint(index, o);
+            auto& slot = _table[fp % slots];
+            if (slot != fp) {
+                return false;
+            }
+            slot = 0;
+            return true;
+        }
+
+    private:
+        static uint64_t
+        fingerprint(const batch_cache_index* index, model::offset o) {
+            // 0 marks an empty slot
+            return std::max<uint64_t>(
+              1, absl::HashOf(reinterpret_cast<uintptr_t>(index), o()));
+        }
+
+        std::vector<uint64_t> _table;
+    };
+
+    bool s3_fifo() const {
+        return _reclaim_opts.eviction_policy
+               == model::batch_cache_eviction_policy::s3_fifo;
+    }
+
+    /*
+     * Track a newly created range in the queue selected by the eviction
+     * policy. The batch \p o is the first batch that will be added to it.
+     */
+    void admit(range&, model::offset o);
+
+    /*
+     * Release the record data of the range at \p it and move it onto
+     * \p reclaimed for deferred removal. Pinned and empty ranges are skipped.
+     * Returns the iterator to the next range in \p queue.
+     */
+    range_list::iterator reclaim_range(
+      range_list& queue,
+      range_list::iterator it,
+      range_list& reclaimed,
+      size_t& reclaimed_bytes);
+
+    void reclaim_lru(range_list& reclaimed, size_t& reclaimed_bytes);
+    void reclaim_s3_fifo(range_list& reclaimed, size_t& reclaimed_bytes);
     struct batch_reclaiming_lock {
         explicit batch_reclaiming_lock(batch_cache& b) noexcept
           : ref(b)
@@ -374,7 +481,14 @@ private:
                               : reclaim_result::reclaimed_nothing;
     }
 
-    intrusive_list<range, &range::_hook> _lru;
+    /*
+     * with the lru policy all ranges are on _lru in recency order. with the
+     * s3_fifo policy _lru is the main queue and _small the probationary queue.
+     */
+    range_list _lru;
+    range_list _small;
+    size_t _small_size_bytes{0};
+    std::optional<ghost_queue> _ghost;
     reclaimer _reclaimer;
     bool _is_reclaiming{false};
     size_t _size_bytes{0};
@@ -384,6 +498,7 @@ private:
     size_t _reclaim_size;
     background_reclaimer _background_reclaimer;
     resources::available_memory::deregister_holder _available_mem_deregister;
+    batch_cache_probe _probe;
 
     friend std::ostream& operator<<(std::ostream&, const reclaim_options&);
     friend std::ostream& operator<<(std::ostream&, const batch_cache&);
@@ -0,0 +1,54 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "metrics/metrics.h"
+
+#include <cstdint>
+
+namespace storage {
+
+/**
+ * Per-shard batch cache statistics. Hits and misses are counted per lookup
+ * against a batch_cache_index; admissions and promotions are counted per
+ * cache range.
+ */
+class batch_cache_probe {
+public:
+    void cache_hit() { ++_hits; }
+    void cache_miss() { ++_misses; }
+    void admitted_small() { ++_small_admissions; }
+    void admitted_main() { ++_main_admissions; }
+    void ghost_hit() { ++_ghost_hits; }
+    void promoted() { ++_promotions; }
+    void clear() { _metrics.clear(); }
+
+    uint64_t hits() const { return _hits; }
+    uint64_t misses() const { return _misses; }
+    uint64_t small_admissions() const { return _small_admissions; }
+    uint64_t main_admissions() const { return _main_admissions; }
+    uint64_t ghost_hits() const { return _ghost_hits; }
+    uint64_t promotions() const { return _promotions; }
+
+    void setup_metrics();
+
+private:
+    uint64_t _hits{0};
+    uint64_t _misses{0};
+    uint64_t _small_admissions{0};
+    uint64_t _main_admissions{0};
+    uint64_t _ghost_hits{0};
+    uint64_t _promotions{0};
+
+    metrics::internal_metric_groups _metrics;
+};
+
+} // namespace storage
@@ -34,6 +34,8 @@ public:
     ~compacted_offset_list() noexcept = default;
 
     bool contains(model::offset) const;
+    /// Whether every offset of [first, last] is in the list.
+    bool contains_range(model::offset first, model::offset last) const;
     void add(model::offset);
 
 private:
@@ -61,4 +63,15 @@ inline bool compacted_offset_list::contains(model::offset o) const {
     return _to_keep.contains(x);
 }
 
+inline bool compacted_offset_list::contains_range(
+  model::offset first, model::offset last) const {
+    if (first < _base || last < first) {
+        return false;
+    }
+    const uint64_t x = (first - _base)();
+    const uint64_t y = (last - _base)();
+    // the range of roaring is half open
+    return _to_keep.containsRange(x, y + 1);
+}
+
 } // namespace storage::internal
@@ -0,0 +1,183 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "storage/compaction_key_filter.h"
+
+#include "base/vlog.h"
+#include "hashing/xx.h"
+#include "serde/serde.h"
+#include "storage/logger.h"
+#include "utils/file_io.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/seastar.hh>
+
+#include <algorithm>
+#include <cstring>
+#include <system_error>
+
+namespace storage {
+
+compaction_key_hasher::digest_type
+compaction_key_hasher::hash(const compaction_key& key) {
+    switch (_algorithm) {
+    case model::compaction_key_hash::sha256:
+        try {
+            _sha256.update(key);
+            return _sha256.reset();
+        } catch (...) {
+            _sha256.reset();
+            throw;
+        }
+    case model::compaction_key_hash::xxh3: {
+        const auto* data = reinterpret_cast<const char*>(key.data());
+        const auto probe = xxhash3_128(data, key.size(), 1);
+        const auto fp = xxhash3_128(data, key.size());
+        static_assert(probe.size() + fp.size() == digest_size);
+        digest_type digest;
+        std::memcpy(digest.data(), probe.data(), probe.size());
+        std::memcpy(digest.data() + probe.size(), fp.data(), fp.size());
+        return digest;
+    }
+    }
+    __builtin_unreachable();
+}
+
+compaction_key_filter::fingerprint_type compaction_key_filter::fingerprint(
+  const compaction_key_hasher::digest_type& digest) {
+    static_assert(fingerprint_size <= compaction_key_hasher::digest_size);
+    fingerprint_type fp;
+    std::memcpy(
+      fp.data(),
+      digest.data() + compaction_key_hasher::digest_size - fingerprint_size,
+      fingerprint_size);
+    return fp;
+}
+
+void compaction_key_filter::builder::add(const compaction_key& key) {
+    if (_overflow) {
+        return;
+    }
+    if (_fingerprints.size() >= max_keys) {
+        _overflow = true;
+        _fingerprints.clear();
+        return;
+    }
+    _fingerprints.push_back(fingerprint(_hasher.hash(key)));
+}
+
+ss::future<std::optional<compaction_key_filter>>
+compaction_key_filter::builder::build(model::offset committed_offset) && {
+    if (_overflow) {
+        co_return std::nullopt;
+    }
+    compaction_key_filter filter(
+      committed_offset, _fingerprints.size(), _hasher.algorithm());
+    for (const auto& fp : _fingerprints) {
+        filter.set(fp);
+        if (ss::need_preempt()) {
+            co_await ss::maybe_yield();
+        }
+    }
+    co_return std::move(filter);
+}
+
+compaction_key_filter::compaction_key_filter(
+  model::offset committed_offset,
+  size_t num_keys,
+  model::compaction_key_hash key_hash)
+  : _committed_offset(committed_offset)
+  , _num_hashes(num_hashes)
+  , _key_hash(key_hash) {
+    const auto words = std::max<size_t>(
+      1, (num_keys * bits_per_key + 63) / 64);
+    _bits.reserve(words);
+    for (size_t i = 0; i < words; ++i) {
+        _bits.push_back(0);
+    }
+}
+
+template<typename Func>
+void compaction_key_filter::for_each_bit(
+  const fingerprint_type& fp, Func f) const {
+    // double hashing over the two halves of the fingerprint
+    uint64_t h1 = 0;
+    uint64_t h2 = 0;
+    std::memcpy(&h1, fp.data(), sizeof(h1));
+    std::memcpy(&h2, fp.data() + sizeof(h1), sizeof(h2));
+    h2 |= 1;
+    const auto num_bits = _bits.size() * 64;
+    for (uint32_t i = 0; i < _num_hashes; ++i) {
+        f((h1 + i * h2) % num_bits);
+    }
+}
+
+void compaction_key_filter::set(const fingerprint_type& fp) {
+    for_each_bit(fp, [this](size_t bit) {
+        _bits[bit / 64] |= uint64_t(1) << (bit % 64);
+    });
+}
+
+bool compaction_key_filter::may_contain(const fingerprint_type& fp) const {
+    bool found = true;
+    for_each_bit(fp, [this, &found](size_t bit) {
+        found = found && (_bits[bit / 64] & (uint64_t(1) << (bit % 64))) != 0;
+    });
+    return found;
+}
+
+ss::future<> compaction_key_filter::write(const segment_full_path& path) && {
+    return write_fully(path, serde::to_iobuf(std::move(*this)));
+}
+
+ss::future<std::optional<compaction_key_filter>>
+compaction_key_filter::read(const segment_full_path& path) {
+    std::optional<compaction_key_filter> filter;
+    try {
+        auto buf = co_await read_fully(path);
+        filter = serde::from_iobuf<compaction_key_filter>(std::move(buf));
+    } catch (const std::system_error& e) {
+        if (e.code() != std::errc::no_such_file_or_directory) {
+            vlog(stlog.info, "error reading key filter {}: {}", path, e);
+        }
+        co_return std::nullopt;
+    } catch (...) {
+        vlog(
+          stlog.info,
+          "error decoding key filter {}: {}",
+          path,
+          std::current_exception());
+        co_return std::nullopt;
+    }
+    if (filter->_bits.empty() || filter->_num_hashes == 0) {
+        vlog(stlog.info, "ignoring empty key filter {}", path);
+        co_return std::nullopt;
+    }
+    co_return std::move(filter);
+}
+
+ss::future<>
+remove_compaction_key_filter(const segment_full_path& reader_path) {
+    auto path = reader_path.to_key_filter();
+    return ss::remove_file(path.string())
+      .handle_exception([path](const std::exception_ptr& e) {
+          try {
+              rethrow_exception(e);
+          } catch (const std::filesystem::filesystem_error& e) {
+              if (e.code() == std::errc::no_such_file_or_directory) {
+                  // Do not log: ENOENT on removal is success
+                  return;
+              }
+          }
+          vlog(stlog.warn, "error removing key filter {} - {}", path, e);
+      });
+}
+
+} // namespace storage
@@ -0,0 +1,162 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "container/fragmented_vector.h"
+#include "hashing/secure.h"
+#include "model/fundamental.h"
+#include "model/metadata.h"
+#include "serde/envelope.h"
+#include "storage/compacted_index.h"
+#include "storage/fs_utils.h"
+
+#include <seastar/core/future.hh>
+
+#include <array>
+#include <cstdint>
+#include <optional>
+
+namespace storage {
+
+/**
+ * Hashes compaction keys to the 32-byte digests that hash_key_offset_map and
+ * compaction_key_filter take their fingerprints from, with the hash function
+ * selected by `log_compaction_key_hash`.
+ *
+ * The xxh3 digest is made of two 128-bit xxh3 hashes with different seeds:
+ * the map probes from the first and both the map and the filters identify
+ * keys by the second, like they do with the last 16 bytes of a sha256 digest.
+ */
+class compaction_key_hasher {
+public:
+    static constexpr size_t digest_size = hash_sha256::digest_size;
+    using digest_type = hash_sha256::digest_type;
+
+    explicit compaction_key_hasher(
+      model::compaction_key_hash algorithm = model::compaction_key_hash::sha256)
+      : _algorithm(algorithm) {}
+
+    digest_type hash(const compaction_key&);
+
+    model::compaction_key_hash algorithm() const { return _algorithm; }
+
+private:
+    model::compaction_key_hash _algorithm;
+    hash_sha256 _sha256;
+};
+
+/**
+ * Bloom filter over the keys of a segment, persisted next to the segment once
+ * sliding window compaction has deduplicated it.
+ *
+ * Keys are identified by the same 128-bit fingerprint of their digest that
+ * hash_key_offset_map stores, so a filter can be tested against the keys of a
+ * map built with the same hash function without access to the keys
+ * themselves. A later compaction can then skip reading a segment whose filter
+ * matches none of the keys in the map.
+ *
+ * Compaction only ever removes keys from a segment, so a filter remains a
+ * superset of its segment's keys until the segment is truncated or merged
+ * with another. The committed offset recorded with the filter detects the
+ * latter, and truncation removes the filter.
+ */
+class compaction_key_filter
+  : public serde::envelope<
+      compaction_key_filter,
+      serde::version<1>,
+      serde::compat_version<0>> {
+public:
+    static constexpr size_t fingerprint_size = 16;
+    using fingerprint_type = std::array<char, fingerprint_size>;
+
+    /// Filters aren't built for segments with more keys than this.
+    static constexpr size_t max_keys = 1 << 20;
+    static constexpr size_t bits_per_key = 10;
+    static constexpr uint32_t num_hashes = 7;
+
+    /// The fingerprint of a key digest, which is its last 16 bytes.
+    static fingerprint_type
+    fingerprint(const compaction_key_hasher::digest_type&);
+
+    /**
+     * Collects the fingerprints of the keys of a segment. The filter is sized
+     * from the final number of distinct keys, so it's built at the end.
+     */
+    class builder {
+    public:
+        explicit builder(
+          model::compaction_key_hash key_hash
+          = model::compaction_key_hash::sha256)
+          : _hasher(key_hash) {}
+
+        void add(const compaction_key&);
+
+        /// Returns nullopt if too many keys were added.
+        ss::future<std::optional<compaction_key_filter>>
+        build(model::offset committed_offset) &&;
+
+    private:
+        compaction_key_hasher _hasher;
+        chunked_vector<fingerprint_type> _fingerprints;
+        bool _overflow{false};
+    };
+
+    compaction_key_filter() = default;
+
+    bool may_contain(const fingerprint_type&) const;
+
+    model::offset committed_offset() const { return _committed_offset; }
+
+    /// The hash function the fingerprints of the filter were taken with.
+    model::compaction_key_hash key_hash() const { return _key_hash; }
+
+    /**
+     * Writes the filter to \p path, replacing an existing file. The caller
+     * renames it into place alongside the compacted index.
+     */
+    ss::future<> write(const segment_full_path& path) &&;
+
+    /**
+     * Reads the filter persisted at \p path. Returns nullopt if there is no
+     * filter or it can't be decoded, in which case the segment has to be
+     * assumed to share keys with anything.
+     */
+    static ss::future<std::optional<compaction_key_filter>>
+    read(const segment_full_path& path);
+
+    auto serde_fields() {
+        return std::tie(_committed_offset, _num_hashes, _bits, _key_hash);
+    }
+
+private:
+    compaction_key_filter(
+      model::offset committed_offset,
+      size_t num_keys,
+      model::compaction_key_hash key_hash);
+
+    /// Calls \p f with the index of each bit of \p fp.
+    template<typename Func>
+    void for_each_bit(const fingerprint_type& fp, Func f) const;
+
+    void set(const fingerprint_type&);
+
+    model::offset _committed_offset;
+    uint32_t _num_hashes{0};
+    chunked_vector<uint64_t> _bits;
+    // filters written before version 1 hold sha256 fingerprints
+    model::compaction_key_hash _key_hash{model::compaction_key_hash::sha256};
+};
+
+/// Removes the key filter of the segment at \p reader_path, if any.
+ss::future<>
+remove_compaction_key_filter(const segment_full_path& reader_path);
+
+} // namespace storage
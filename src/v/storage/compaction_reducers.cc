@@ -273,8 +273,12 @@ copy_data_segment_reducer::filter(model::record_batch batch) {
 }
 
 ss::future<ss::stop_iteration> copy_data_segment_reducer::filter_and_append(
-  model::compression original, model::record_batch b) {
+  model::compression compression,
+  model::record_batch b,
+  std::optional<model::record_batch> original) {
     using stop_t = ss::stop_iteration;
+    const auto type = b.header().type;
+    const auto record_count = b.record_count();
     auto to_copy = co_await filter(std::move(b));
     if (to_copy == std::nullopt) {
         co_return stop_t::no;
@@ -293,7 +297,22 @@ ss::future<ss::stop_iteration> copy_data_segment_reducer::filter_and_append(
                 r.offset_delta());
           });
     }
-    auto batch = co_await compress_batch(original, std::move(to_copy.value()));
+    const bool unchanged = to_copy->header().type == type
+                           && to_copy->record_count() == record_count;
+    if (original && unchanged) {
+        // every record was kept, the compressed batch we read is what
+        // compressing them again would give
+        co_await append(std::move(*original), compactible_batch);
+        co_return stop_t::no;
+    }
+    auto batch = co_await compress_batch(
+      compression, std::move(to_copy.value()));
+    co_await append(std::move(batch), compactible_batch);
+    co_return stop_t::no;
+}
+
+ss::future<> copy_data_segment_reducer::append(
+  model::record_batch batch, bool compactible_batch) {
     auto const start_pos = _appender->file_byte_offset();
     auto const header_size = batch.header().size_bytes;
     _acc += header_size;
@@ -319,8 +338,15 @@ ss::future<ss::stop_iteration> copy_data_segment_reducer::filter_and_append(
       "Size must be deterministic. Expected:{} == {}",
       _appender->file_byte_offset(),
       start_pos + header_size);
+}
 
-    co_return stop_t::no;
+bool copy_data_segment_reducer::can_copy_compressed(
+  const model::record_batch_header& hdr) {
+    if (!is_compactible(hdr)) {
+        // neither filtered nor indexed
+        return true;
+    }
+    return _compacted_idx == nullptr && _keep_all_fn && _keep_all_fn(hdr);
 }
 
 ss::future<ss::stop_iteration>
@@ -330,11 +356,18 @@ copy_data_segment_reducer::operator()(model::record_batch b) {
     }
     const auto comp = b.header().attrs.compression();
     if (!b.compressed()) {
-        co_return co_await filter_and_append(comp, std::move(b));
+        co_return co_await filter_and_append(comp, std::move(b), std::nullopt);
+    }
+    if (can_copy_compressed(b.header())) {
+        const bool compactible_batch = is_compactible(b);
+        co_await append(std::move(b), compactible_batch);
+        co_return ss::stop_iteration::no;
     }
+    auto original = b.share();
     auto batch = co_await decompress_batch(std::move(b));
 
-    co_return co_await filter_and_append(comp, std::move(batch));
+    co_return co_await filter_and_append(
+      comp, std::move(batch), std::move(original));
 }
 
 ss::future<ss::stop_iteration>
@@ -16,6 +16,7 @@
 #include "container/fragmented_vector.h"
 #include "hashing/xx.h"
 #include "model/record_batch_reader.h"
+#include "resource_mgmt/memory_accounting.h"
 #include "storage/compacted_index.h"
 #include "storage/compacted_index_writer.h"
 #include "storage/compacted_offset_list.h"
@@ -54,8 +55,8 @@ public:
 
     explicit compaction_key_reducer(size_t max_mem = default_max_memory_usage)
       : _max_mem(max_mem)
-      , _memory_tracker(
-          ss::make_shared<util::mem_tracker>("compaction_key_reducer_index"))
+      , _memory_tracker(resources::memory_accounting::local().create_tracker(
+          resources::mem_subsystem::compaction, "compaction_key_reducer_index"))
       , _indices{util::tracking_allocator<value_type>{_memory_tracker}} {}
 
     ss::future<ss::stop_iteration> operator()(compacted_index::entry&&);
@@ -119,6 +120,10 @@ class copy_data_segment_reducer : public compaction_reducer {
 public:
     using filter_t = ss::noncopyable_function<ss::future<bool>(
       const model::record_batch&, const model::record&, bool)>;
+    /// Tells from the header alone that \p filter_t keeps every record of a
+    /// batch, such a batch is copied as is without being decompressed.
+    using keep_all_t
+      = ss::noncopyable_function<bool(const model::record_batch_header&)>;
     copy_data_segment_reducer(
       filter_t f,
       segment_appender* a,
@@ -126,8 +131,10 @@ public:
       offset_delta_time apply_offset,
       model::offset segment_last_offset,
       compacted_index_writer* cidx = nullptr,
-      bool inject_failure = false)
+      bool inject_failure = false,
+      keep_all_t keep_all = nullptr)
       : _should_keep_fn(std::move(f))
+      , _keep_all_fn(std::move(keep_all))
       , _segment_last_offset(segment_last_offset)
       , _appender(a)
       , _compacted_idx(cidx)
@@ -139,8 +146,16 @@ public:
     storage::index_state end_of_stream() { return std::move(_idx); }
 
 private:
-    ss::future<ss::stop_iteration>
-      filter_and_append(model::compression, model::record_batch);
+    ss::future<ss::stop_iteration> filter_and_append(
+      model::compression,
+      model::record_batch,
+      std::optional<model::record_batch> original);
+
+    ss::future<> append(model::record_batch, bool compactible_batch);
+
+    // Whether a compressed batch can be copied without decompressing it:
+    // none of its records are filtered out or indexed.
+    bool can_copy_compressed(const model::record_batch_header&);
 
     ss::future<> maybe_keep_offset(
       const model::record_batch&,
@@ -154,6 +169,7 @@ private:
     model::record_batch make_placeholder_batch(model::record_batch_header&);
 
     filter_t _should_keep_fn;
+    keep_all_t _keep_all_fn;
 
     // Offset to keep in case the index is empty as of getting to this offset.
     model::offset _segment_last_offset;
@@ -0,0 +1,74 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "storage/compression_offload.h"
+
+#include "compression/compression.h"
+
+#include <seastar/core/coroutine.hh>
+
+namespace storage {
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local compression_offload* compression_offload::_local_instance
+  = nullptr;
+
+compression_offload::compression_offload(
+  ssx::singleton_thread_worker& worker,
+  config::binding<std::optional<size_t>> threshold,
+  size_t max_in_flight)
+  : _worker(worker)
+  , _threshold(std::move(threshold))
+  , _budget(max_in_flight) {}
+
+ss::future<> compression_offload::start() {
+    _local_instance = this;
+    return ss::now();
+}
+
+ss::future<> compression_offload::stop() {
+    _local_instance = nullptr;
+    _budget.broken();
+    co_await _gate.close();
+}
+
+bool compression_offload::should_offload(size_t size_bytes) const {
+    auto threshold = _threshold();
+    return threshold && size_bytes >= *threshold;
+}
+
+template<typename Func>
+ss::future<iobuf> compression_offload::run_on_worker(Func func) {
+    auto holder = _gate.hold();
+    co_return co_await container().invoke_on(
+      ssx::singleton_thread_worker::shard_id,
+      [func = std::move(func)](compression_offload& o) mutable {
+          return ss::with_gate(o._gate, [&o, func = std::move(func)]() mutable {
+              return ss::get_units(o._budget, 1)
+                .then([&o, func = std::move(func)](auto units) mutable {
+                    return o._worker.submit(std::move(func))
+                      .finally([units = std::move(units)] {});
+                });
+          });
+      });
+}
+
+ss::future<iobuf>
+compression_offload::compress(const iobuf& buf, model::compression c) {
+    return run_on_worker(
+      [&buf, c] { return compression::compressor::compress(buf, c); });
+}
+
+ss::future<iobuf>
+compression_offload::uncompress(const iobuf& buf, model::compression c) {
+    return run_on_worker(
+      [&buf, c] { return compression::compressor::uncompress(buf, c); });
+}
+
+} // namespace storage
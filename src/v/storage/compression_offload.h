@@ -0,0 +1,76 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "base/seastarx.h"
+#include "bytes/iobuf.h"
+#include "config/property.h"
+#include "model/compression.h"
+#include "ssx/thread_worker.h"
+
+#include <seastar/core/gate.hh>
+#include <seastar/core/semaphore.hh>
+#include <seastar/core/sharded.hh>
+
+#include <optional>
+
+namespace storage {
+
+/**
+ * Compresses and decompresses large batches on the thread worker rather than
+ * on the reactor: a single large zstd or gzip batch takes long enough to
+ * stall the reactor, e.g. during compaction.
+ *
+ * Batches below the threshold stay inline, for them a round trip to the
+ * worker costs more than the work. The batches in flight on the worker are
+ * bounded for the whole node: the budget is on the shard of the singleton
+ * thread worker and every shard takes its units there.
+ *
+ * The buffers handed out must stay alive and unchanged until the returned
+ * future resolves, the worker reads them from its thread.
+ */
+class compression_offload
+  : public ss::peering_sharded_service<compression_offload> {
+public:
+    compression_offload(
+      ssx::singleton_thread_worker&,
+      config::binding<std::optional<size_t>> threshold,
+      size_t max_in_flight);
+
+    ss::future<> start();
+    ss::future<> stop();
+
+    /// The instance of this shard, null when the service is not running, in
+    /// which case everything is done inline.
+    static compression_offload* local() { return _local_instance; }
+
+    /// Whether a batch of \p size_bytes is worth offloading.
+    bool should_offload(size_t size_bytes) const;
+
+    ss::future<iobuf> compress(const iobuf&, model::compression);
+    ss::future<iobuf> uncompress(const iobuf&, model::compression);
+
+private:
+    template<typename Func>
+    ss::future<iobuf> run_on_worker(Func);
+
+    ssx::singleton_thread_worker& _worker;
+    config::binding<std::optional<size_t>> _threshold;
+    // only used on the shard of the thread worker
+    ss::semaphore _budget;
+    ss::gate _gate;
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    static thread_local compression_offload* _local_instance;
+};
+
+} // namespace storage
@@ -0,0 +1,86 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "storage/decompression_cache.h"
+
+#include "config/configuration.h"
+#include "storage/parser_utils.h"
+
+#include <algorithm>
+
+namespace storage {
+
+decompression_cache::decompression_cache()
+  : _max_size_bytes(
+      config::shard_local_cfg().storage_decompression_cache_size.bind()) {
+    _max_size_bytes.watch([this] { evict(); });
+}
+
+ss::future<model::record_batch>
+decompression_cache::decompress(const model::record_batch& b) {
+    if (_max_size_bytes() == 0 || !b.compressed()) {
+        return internal::decompress_batch(b);
+    }
+
+    const auto& hdr = b.header();
+    auto it = std::find_if(
+      _entries.begin(), _entries.end(), [&b, &hdr](const entry& e) {
+          return e.crc == hdr.crc && e.size_bytes == hdr.size_bytes
+                 && e.compressed == b.data();
+      });
+    if (it != _entries.end()) {
+        ++_hits;
+        auto body = it->body.share(0, it->body.size_bytes());
+        auto h = hdr;
+        h.attrs.remove_compression();
+        internal::reset_size_checksum_metadata(h, body);
+        return ss::make_ready_future<model::record_batch>(model::record_batch(
+          h, std::move(body), model::record_batch::tag_ctor_ng{}));
+    }
+
+    ++_misses;
+    return internal::decompress_batch(b).then(
+      [this,
+       crc = hdr.crc,
+       size_bytes = hdr.size_bytes,
+       compressed = b.data().copy()](model::record_batch decompressed) mutable {
+          put(
+            crc,
+            size_bytes,
+            std::move(compressed),
+            decompressed.share().release_data());
+          return decompressed;
+      });
+}
+
+void decompression_cache::put(
+  uint32_t crc, int32_t size_bytes, iobuf compressed, iobuf body) {
+    // a single large batch would flush every other entry
+    if ((compressed.size_bytes() + body.size_bytes()) * 4 > _max_size_bytes()) {
+        return;
+    }
+    auto& e = _entries.emplace_back(entry{
+      .crc = crc,
+      .size_bytes = size_bytes,
+      .compressed = std::move(compressed),
+      .body = std::move(body),
+    });
+    _size_bytes += e.memory();
+    evict();
+}
+
+void decompression_cache::evict() {
+    while (!_entries.empty() && _size_bytes > _max_size_bytes()) {
+        _size_bytes -= _entries.front().memory();
+        _entries.pop_front();
+    }
+}
+
+} // namespace storage
@@ -0,0 +1,77 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "config/property.h"
+#include "model/record.h"
+
+#include <seastar/core/future.hh>
+
+#include <deque>
+
+namespace storage {
+
+/**
+ * Shard-local cache of decompressed batch bodies.
+ *
+ * A produced batch is decompressed by every server path that inspects its
+ * records: schema id validation before it is replicated, the compaction index
+ * when it is appended to a compacted topic and data transforms when they read
+ * it back. Those paths see the same batch on the partition's shard within a
+ * short time, so the last few decompressed bodies are kept and shared.
+ *
+ * Entries are matched by the compressed records rather than by offset, as
+ * offsets are assigned only after validation. A hit still rebuilds the header
+ * of the decompressed batch from the batch asked for, so it never depends on
+ * which path populated the entry. The cache is bounded by
+ * `storage_decompression_cache_size`; a size of zero disables it.
+ */
+class decompression_cache {
+public:
+    decompression_cache();
+
+    /// Returns \p b decompressed, from the cache when possible.
+    /// \throw std::runtime_error If \p b is not compressed
+    ss::future<model::record_batch> decompress(const model::record_batch& b);
+
+    size_t size_bytes() const { return _size_bytes; }
+    size_t hits() const { return _hits; }
+    size_t misses() const { return _misses; }
+
+private:
+    struct entry {
+        uint32_t crc;
+        int32_t size_bytes;
+        iobuf compressed;
+        iobuf body;
+
+        size_t memory() const {
+            return compressed.size_bytes() + body.size_bytes();
+        }
+    };
+
+    void put(uint32_t crc, int32_t size_bytes, iobuf compressed, iobuf body);
+    void evict();
+
+    config::binding<size_t> _max_size_bytes;
+    std::deque<entry> _entries;
+    size_t _size_bytes{0};
+    size_t _hits{0};
+    size_t _misses{0};
+};
+
+/// Returns the shard-local decompression cache.
+inline decompression_cache& decompressed_batches() {
+    static thread_local decompression_cache cache;
+    return cache;
+}
+
+} // namespace storage
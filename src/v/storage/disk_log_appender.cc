@@ -97,6 +97,7 @@ disk_log_appender::operator()(model::record_batch& batch) {
         release_lock();
     }
     _last_term = batch.term();
+    auto latency = _log.get_probe().sample_append();
     try {
         // we might have gotten the lock, but in a concurrency
         // situation - say a segment eviction we need to double
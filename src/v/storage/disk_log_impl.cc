@@ -21,6 +21,7 @@
 #include "ssx/future-util.h"
 #include "storage/chunk_cache.h"
 #include "storage/compacted_offset_list.h"
+#include "storage/compaction_key_filter.h"
 #include "storage/compaction_reducers.h"
 #include "storage/disk_log_appender.h"
 #include "storage/fwd.h"
@@ -528,9 +529,46 @@ segment_set disk_log_impl::find_sliding_range(
     return segs;
 }
 
+bool disk_log_impl::is_dirty_enough_to_compact() {
+    size_t dirty = 0;
+    size_t total = 0;
+    for (const auto& seg : _segs) {
+        if (seg->has_appender()) {
+            break;
+        }
+        dirty += seg->dirty_bytes();
+        total += seg->size_bytes();
+    }
+    _probe->set_dirty_segment_bytes(dirty);
+
+    const auto min_ratio
+      = config::shard_local_cfg().min_cleanable_dirty_ratio();
+    if (min_ratio <= 0.0 || total == 0) {
+        return true;
+    }
+    const auto ratio = static_cast<double>(dirty)
+                       / static_cast<double>(total);
+    if (ratio < min_ratio) {
+        vlog(
+          gclog.debug,
+          "[{}] skipping compaction, dirty ratio {:.3f} ({}/{} bytes) is "
+          "below {}",
+          config().ntp(),
+          ratio,
+          dirty,
+          total,
+          min_ratio);
+        return false;
+    }
+    return true;
+}
+
 ss::future<bool> disk_log_impl::sliding_window_compact(
   const compaction_config& cfg, std::optional<model::offset> new_start_offset) {
     vlog(gclog.debug, "[{}] running sliding window compaction", config().ntp());
+    if (!is_dirty_enough_to_compact()) {
+        co_return false;
+    }
     auto segs = find_sliding_range(cfg, new_start_offset);
     if (segs.empty()) {
         vlog(gclog.debug, "[{}] no more segments to compact", config().ntp());
@@ -622,6 +660,8 @@ ss::future<bool> disk_log_impl::sliding_window_compact(
       idx_start_offset,
       map.max_offset());
 
+    const bool use_key_filters
+      = config::shard_local_cfg().log_compaction_use_key_filters();
     auto segment_modify_lock = co_await _segment_rewrite_lock.get_units();
     for (auto& seg : segs) {
         if (cfg.asrc) {
@@ -655,13 +695,31 @@ ss::future<bool> disk_log_impl::sliding_window_compact(
               seg->filename());
             continue;
         }
+        if (
+          use_key_filters && cfg.hash_key_map
+          && seg->offsets().base_offset < idx_start_offset
+          && !co_await may_share_keys(cfg, *cfg.hash_key_map, *seg)) {
+            // None of the keys in the map are in this segment, so there is
+            // nothing to deduplicate. Skip it without reading it.
+            seg->mark_as_finished_windowed_compaction();
+            _probe->segment_skipped_by_key_filter();
+            vlog(
+              gclog.debug,
+              "[{}] treating segment as compacted, its key filter shares no "
+              "keys with the offset map: {}",
+              config().ntp(),
+              seg->filename());
+            continue;
+        }
         // TODO: implement a segment replacement strategy such that each term
         // tries to write only one segment (or more if the term had a large
         // amount of data), rather than replacing N segments with N segments.
         const auto tmpname = seg->reader().path().to_compaction_staging();
         const auto cmp_idx_tmpname = tmpname.to_compacted_index();
+        const auto key_filter_tmpname = tmpname.to_key_filter();
         auto staging_to_clean = scoped_file_tracker{
-          cfg.files_to_cleanup, {tmpname, cmp_idx_tmpname}};
+          cfg.files_to_cleanup,
+          {tmpname, cmp_idx_tmpname, key_filter_tmpname}};
 
         auto appender = co_await internal::make_segment_appender(
           tmpname,
@@ -684,6 +742,12 @@ ss::future<bool> disk_log_impl::sliding_window_compact(
           tmpname,
           seg);
         auto initial_generation_id = seg->get_generation_id();
+        std::optional<compaction_key_filter::builder> key_filter;
+        if (use_key_filters) {
+            key_filter.emplace(
+              cfg.hash_key_map ? cfg.hash_key_map->key_hash_algorithm()
+                               : model::compaction_key_hash::sha256);
+        }
         std::exception_ptr eptr;
         index_state new_idx;
         try {
@@ -695,7 +759,8 @@ ss::future<bool> disk_log_impl::sliding_window_compact(
               compacted_idx_writer,
               *_probe,
               storage::internal::should_apply_delta_time_offset(_feature_table),
-              _feature_table);
+              _feature_table,
+              key_filter ? &key_filter.value() : nullptr);
 
         } catch (...) {
             eptr = std::current_exception();
@@ -707,6 +772,19 @@ ss::future<bool> disk_log_impl::sliding_window_compact(
             std::rethrow_exception(eptr);
         }
 
+        // The filter is written next to the staging files and renamed with
+        // them. It isn't built if the segment has too many keys, in which
+        // case any existing filter still covers the keys that remain.
+        bool has_key_filter = false;
+        if (key_filter) {
+            auto filter = co_await std::move(*key_filter).build(
+              new_idx.max_offset);
+            if (filter) {
+                co_await std::move(*filter).write(key_filter_tmpname);
+                has_key_filter = true;
+            }
+        }
+
         vlog(
           gclog.debug,
           "[{}] Replacing segment {} with {}",
@@ -743,6 +821,11 @@ ss::future<bool> disk_log_impl::sliding_window_compact(
         co_await seg->index().flush();
         co_await ss::rename_file(
           cmp_idx_tmpname.string(), cmp_idx_name.string());
+        if (has_key_filter) {
+            co_await ss::rename_file(
+              key_filter_tmpname.string(),
+              seg->path().to_key_filter().string());
+        }
 
         seg->mark_as_finished_windowed_compaction();
         _probe->segment_compacted();
@@ -929,6 +1012,9 @@ ss::future<compaction_result> disk_log_impl::compact_adjacent_segments(
         co_await ss::remove_file(compact_index.string());
     }
 
+    // the key filter of the target covers only its own keys
+    co_await remove_compaction_key_filter(target->reader().path());
+
     // lock the range. only metadata (e.g. open/rename/delete) i/o occurs with
     // these locks held so it is a relatively short duration. all of the data
     // copying and compaction i/o occurred above with no locks held. 5 retries
@@ -1142,6 +1228,10 @@ ss::future<> disk_log_impl::housekeeping(housekeeping_config cfg) {
      */
     auto new_start_offset = co_await do_gc(cfg.gc);
 
+    if (_manager.config().cold_dir && !config().is_compacted()) {
+        co_await move_segments_to_cold(cfg.compact);
+    }
+
     /*
      * comapction. could factor out into a public interface like gc/retention if
      * there is a need to run it separately.
@@ -1177,6 +1267,56 @@ ss::future<> disk_log_impl::housekeeping(housekeeping_config cfg) {
     _probe->set_compaction_ratio(_compaction_ratio.get());
 }
 
+ss::future<> disk_log_impl::move_segments_to_cold(compaction_config cfg) {
+    auto cold_dir = _manager.cold_directory(config());
+    if (!cold_dir) {
+        co_return;
+    }
+
+    /*
+     * the newest bytes of the log, including the active segment, stay in the
+     * data directory. older sealed segments are moved oldest first.
+     */
+    const size_t hot_bytes = config::shard_local_cfg().storage_hot_tier_bytes();
+    size_t total_bytes = 0;
+    for (const auto& seg : _segs) {
+        total_bytes += seg->size_bytes();
+    }
+    std::vector<ss::lw_shared_ptr<segment>> segments;
+    size_t older_bytes = 0;
+    for (const auto& seg : _segs) {
+        older_bytes += seg->size_bytes();
+        if (total_bytes - older_bytes < hot_bytes) {
+            break;
+        }
+        if (!seg->has_appender() && !seg->is_cold() && !seg->is_closed()) {
+            segments.push_back(seg);
+        }
+    }
+
+    for (auto& seg : segments) {
+        if (_compaction_as.abort_requested()) {
+            co_return;
+        }
+        auto cold = *cold_dir
+                    / std::filesystem::path(seg->filename()).filename();
+        try {
+            co_await internal::move_segment_to_cold(
+              seg, std::move(cold), cfg, *_probe, *_readers_cache);
+        } catch (const segment_closed_exception&) {
+            // removed by retention or truncation in the meantime
+        } catch (...) {
+            vlog(
+              gclog.warn,
+              "[{}] error moving segment {} to the cold directory: {}",
+              config().ntp(),
+              seg->filename(),
+              std::current_exception());
+            co_return;
+        }
+    }
+}
+
 ss::future<> disk_log_impl::do_compact(
   compaction_config compact_cfg,
   std::optional<model::offset> new_start_offset) {
@@ -1550,7 +1690,13 @@ ss::future<> disk_log_impl::flush() {
     }
     vlog(
       stlog.trace, "flush on segment with offsets {}", _segs.back()->offsets());
-    return _segs.back()->flush();
+    auto& flusher = _manager.flusher();
+    auto f = flusher.enabled() ? flusher.flush(_segs.back())
+                               : _segs.back()->flush();
+    if (auto latency = _probe->sample_flush(); latency) {
+        return f.finally([latency = std::move(latency)] {});
+    }
+    return f;
 }
 
 size_t disk_log_impl::max_segment_size() const {
@@ -1763,17 +1909,21 @@ struct batch_size_accumulator {
         //
         if (boundary == model::boundary_type::inclusive) {
             if (b.last_offset() > target) {
+                result_boundary->next_base = b.base_offset();
                 co_return ss::stop_iteration::yes;
             }
             *result_size_bytes += model::packed_record_batch_header_size
                                   + b.data().size_bytes();
+            result_boundary->prev_last = b.last_offset();
             co_return ss::stop_iteration::no;
         } else {
             if (b.base_offset() >= target) {
+                result_boundary->next_base = b.base_offset();
                 co_return ss::stop_iteration::yes;
             }
             *result_size_bytes += model::packed_record_batch_header_size
                                   + b.data().size_bytes();
+            result_boundary->prev_last = b.last_offset();
             co_return ss::stop_iteration::no;
         }
     }
@@ -1782,6 +1932,8 @@ struct batch_size_accumulator {
     size_t* result_size_bytes{nullptr};
     model::offset target;
     model::boundary_type boundary;
+    // Updated with the batches on either side of the resulting position
+    batch_boundary_cache::boundary* result_boundary{nullptr};
 };
 } // namespace details
 
@@ -1791,15 +1943,28 @@ ss::future<size_t> disk_log_impl::get_file_offset(
   model::offset target,
   model::boundary_type boundary,
   ss::io_priority_class priority) {
+    if (auto filepos = s->batch_boundaries().find(target, boundary); filepos) {
+        co_return *filepos;
+    }
+
     auto index_entry = maybe_index_entry.value_or(segment_index::entry{
       .offset = s->offsets().base_offset,
       .filepos = 0,
     });
     size_t size_bytes{index_entry.filepos};
+    // index entries are at the base offset of a batch, so any batch before
+    // the entry ends before it. the reader stops at the target, so if no
+    // batch past the position is read the next one starts after the target.
+    batch_boundary_cache::boundary found{
+      .prev_last = model::prev_offset(index_entry.offset),
+      .next_base = model::next_offset(target),
+      .filepos = index_entry.filepos,
+    };
     details::batch_size_accumulator acc{
       .result_size_bytes = &size_bytes,
       .target = target,
       .boundary = boundary,
+      .result_boundary = &found,
     };
 
     storage::log_reader_config reader_cfg(index_entry.offset, target, priority);
@@ -1818,6 +1983,8 @@ ss::future<size_t> disk_log_impl::get_file_offset(
           std::current_exception());
         throw;
     }
+    found.filepos = size_bytes;
+    s->batch_boundaries().insert(found);
     co_return size_bytes;
 }
 
@@ -2731,6 +2898,8 @@ disk_log_impl::update_configuration(ntp_config::default_overrides o) {
 
     auto was_compacted = config().is_compacted();
     mutable_config().set_overrides(o);
+    // retention settings are part of the disk usage report
+    _disk_usage_cache.reset();
 
     /**
      * For most of the settings we always query ntp config, only cleanup_policy
@@ -3288,6 +3457,23 @@ ss::future<usage_report> disk_log_impl::disk_usage(gc_config cfg) {
     // protect against concurrent log removal with housekeeping loop
     auto gate = _compaction_housekeeping_gate.hold();
 
+    /*
+     * monitoring polls the usage of every partition every few seconds. while a
+     * log keeps its size and segments its report is reused, the bound on its
+     * age covers the changes to reclaimable space driven by time and uploads.
+     */
+    const auto now = ss::lowres_clock::now();
+    const auto size = size_bytes();
+    const auto segments = _segs.size();
+    if (
+      _disk_usage_cache && _disk_usage_cache->max_bytes == cfg.max_bytes
+      && _disk_usage_cache->size_bytes == size
+      && _disk_usage_cache->segments == segments
+      && now - _disk_usage_cache->taken
+           < config::shard_local_cfg().storage_disk_usage_cache_ms()) {
+        co_return _disk_usage_cache->report;
+    }
+
     /*
      * compute the amount of current disk usage as well as the amount available
      * for being reclaimed.
@@ -3307,7 +3493,15 @@ ss::future<usage_report> disk_log_impl::disk_usage(gc_config cfg) {
     target.min_capacity_wanted = std::max(
       target.min_capacity_wanted, target.min_capacity);
 
-    co_return usage_report(usage, reclaim, target);
+    usage_report report(usage, reclaim, target);
+    _disk_usage_cache = cached_disk_usage{
+      .report = report,
+      .max_bytes = cfg.max_bytes,
+      .size_bytes = size,
+      .segments = segments,
+      .taken = now,
+    };
+    co_return report;
 }
 
 fragmented_vector<ss::lw_shared_ptr<segment>>
@@ -173,6 +173,10 @@ public:
       const compaction_config& cfg,
       std::optional<model::offset> new_start_offset = std::nullopt);
 
+    // Returns whether the ratio of dirty bytes in the closed segments passes
+    // `min_cleanable_dirty_ratio`, and updates the dirty bytes probe.
+    bool is_dirty_enough_to_compact();
+
     void set_last_compaction_window_start_offset(model::offset o) {
         _last_compaction_window_start_offset = o;
     }
@@ -222,6 +226,9 @@ private:
     find_compaction_range(const compaction_config&);
 
     ss::future<std::optional<model::offset>> do_gc(gc_config);
+    // moves sealed segments beyond the newest `storage_hot_tier_bytes` to
+    // the cold directory
+    ss::future<> move_segments_to_cold(compaction_config);
     ss::future<> do_compact(
       compaction_config, std::optional<model::offset> new_start_offset);
 
@@ -330,7 +337,10 @@ private:
     // repeatedly takes+releases segment read locks, and without this extra
     // coarse grained lock, the compaction can happen in between steps.
     // See https://github.com/redpanda-data/redpanda/issues/7118
-    mutex _segment_rewrite_lock{"segment_rewrite_lock"};
+    static inline const lock_class segment_rewrite_lock_class{
+      "segment_rewrite_lock"};
+    mutex _segment_rewrite_lock{
+      "segment_rewrite_lock", segment_rewrite_lock_class};
 
     // Bytes written since last time we requested stm snapshot
     ssx::semaphore_units _stm_dirty_bytes_units;
@@ -344,7 +354,10 @@ private:
     // We need to take this irrespective of whether we're actually rolling or
     // not, in order to ensure that writers wait for a background roll to
     // complete if one is ongoing.
-    mutex _segments_rolling_lock{"segments_rolling_lock"};
+    static inline const lock_class segments_rolling_lock_class{
+      "segments_rolling_lock"};
+    mutex _segments_rolling_lock{
+      "segments_rolling_lock", segments_rolling_lock_class};
     // This counter is incremented when the log is truncated. It doesn't
     // count logical truncations and can be incremented multiple times.
     size_t _suffix_truncation_indicator{0};
@@ -352,6 +365,17 @@ private:
     std::optional<model::offset> _cloud_gc_offset;
     std::optional<model::offset> _last_compaction_window_start_offset;
     size_t _reclaimable_size_bytes{0};
+
+    // last disk usage report, valid while the log keeps its size and segments
+    // for up to `storage_disk_usage_cache_ms`
+    struct cached_disk_usage {
+        usage_report report;
+        std::optional<size_t> max_bytes;
+        size_t size_bytes;
+        size_t segments;
+        ss::lowres_clock::time_point taken;
+    };
+    std::optional<cached_disk_usage> _disk_usage_cache;
 };
 
 } // namespace storage
@@ -0,0 +1,75 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "storage/flush_coordinator.h"
+
+#include "base/vlog.h"
+#include "ssx/future-util.h"
+#include "storage/logger.h"
+#include "storage/segment.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/coroutine/parallel_for_each.hh>
+
+namespace storage {
+
+flush_coordinator::flush_coordinator(
+  config::binding<std::chrono::milliseconds> window)
+  : _window(std::move(window)) {
+    _timer.set_callback([this] { dispatch(); });
+}
+
+ss::future<> flush_coordinator::flush(ss::lw_shared_ptr<segment> seg) {
+    auto holder = _gate.hold();
+    _probe.flush_requested();
+    auto [it, inserted] = _pending.try_emplace(seg.get());
+    if (inserted) {
+        it->second.seg = std::move(seg);
+    }
+    auto f = it->second.done.get_shared_future();
+    if (!_timer.armed()) {
+        _timer.arm(_window());
+    }
+    co_await std::move(f);
+}
+
+void flush_coordinator::dispatch() {
+    if (_pending.empty()) {
+        return;
+    }
+    ssx::spawn_with_gate(
+      _gate, [this] { return do_dispatch(std::exchange(_pending, {})); });
+}
+
+ss::future<> flush_coordinator::do_dispatch(pending_t batch) {
+    _probe.batch_dispatched(batch.size());
+    vlog(stlog.trace, "Dispatching {} coalesced segment flushes", batch.size());
+    // submit every flush of the window at once so that the disk sees them
+    // together rather than spread over the window
+    co_await ss::coroutine::parallel_for_each(
+      batch, [](pending_t::value_type& entry) -> ss::future<> {
+          auto& pending = entry.second;
+          try {
+              co_await pending.seg->flush();
+              pending.done.set_value();
+          } catch (...) {
+              pending.done.set_exception(std::current_exception());
+          }
+      });
+}
+
+ss::future<> flush_coordinator::stop() {
+    _timer.cancel();
+    // issue anything still waiting for the window so that callers complete
+    dispatch();
+    co_await _gate.close();
+}
+
+} // namespace storage
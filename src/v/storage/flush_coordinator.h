@@ -0,0 +1,80 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "base/seastarx.h"
+#include "config/property.h"
+#include "storage/fwd.h"
+#include "storage/probe.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/gate.hh>
+#include <seastar/core/shared_future.hh>
+#include <seastar/core/shared_ptr.hh>
+#include <seastar/core/timer.hh>
+
+#include <absl/container/node_hash_map.h>
+
+#include <chrono>
+
+namespace storage {
+
+/**
+ * Per-shard coordinator of log flushes.
+ *
+ * With many acks=all partitions on a shard, each partition's flush issues its
+ * own small fdatasync. When `storage_flush_coalesce_window_ms` is non-zero,
+ * flush requests are instead collected for the length of the window and then
+ * issued together. Requests for the same segment within a window share one
+ * flush, and the flushes of a window are submitted to the disk at once rather
+ * than trickling in.
+ */
+class flush_coordinator {
+public:
+    explicit flush_coordinator(
+      config::binding<std::chrono::milliseconds> window);
+    flush_coordinator(flush_coordinator&&) = delete;
+    flush_coordinator& operator=(flush_coordinator&&) = delete;
+    flush_coordinator(const flush_coordinator&) = delete;
+    flush_coordinator& operator=(const flush_coordinator&) = delete;
+    ~flush_coordinator() noexcept = default;
+
+    /// Whether flushes are coalesced, or should be issued directly.
+    bool enabled() const { return _window() > std::chrono::milliseconds(0); }
+
+    /**
+     * Flush \p seg as part of the current window. The returned future
+     * resolves once a flush of the segment issued after this call completes.
+     */
+    ss::future<> flush(ss::lw_shared_ptr<segment> seg);
+
+    flush_coordinator_probe& probe() { return _probe; }
+
+    ss::future<> stop();
+
+private:
+    struct pending_flush {
+        ss::lw_shared_ptr<segment> seg;
+        ss::shared_promise<> done;
+    };
+    using pending_t = absl::node_hash_map<const segment*, pending_flush>;
+
+    void dispatch();
+    ss::future<> do_dispatch(pending_t);
+
+    config::binding<std::chrono::milliseconds> _window;
+    pending_t _pending;
+    ss::timer<> _timer;
+    ss::gate _gate;
+    flush_coordinator_probe _probe;
+};
+
+} // namespace storage
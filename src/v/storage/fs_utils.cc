@@ -112,6 +112,16 @@ segment_full_path segment_full_path::to_compacted_index() const {
     }
 }
 
+segment_full_path segment_full_path::to_key_filter() const {
+    if (extension == ".log") {
+        return with_extension(".key_filter");
+    } else if (extension == ".log.compaction.staging") {
+        return with_extension(".log.compaction.key_filter");
+    } else {
+        vassert(false, "Unexpected extension {}", extension);
+    }
+}
+
 segment_full_path segment_full_path::to_compaction_staging() const {
     vassert(extension == ".log", "Unexpected extension {}", extension);
     return with_extension(".log.compaction.staging");
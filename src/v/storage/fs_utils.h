@@ -136,6 +136,7 @@ public:
      */
     segment_full_path to_index() const;
     segment_full_path to_compacted_index() const;
+    segment_full_path to_key_filter() const;
     segment_full_path to_compaction_staging() const;
     segment_full_path to_staging() const;
 
@@ -16,6 +16,8 @@ namespace storage {
 class api;
 class compacted_index_writer;
 class compaction_controller;
+class compression_offload;
+class hash_key_offset_map;
 class key_offset_map;
 class kvstore;
 class node_api;
@@ -24,6 +26,7 @@ class log;
 class log_manager;
 class probe;
 class offset_translator_state;
+class reader_handle_cache;
 class readers_cache;
 class segment;
 class segment_appender;
@@ -35,6 +35,82 @@ index_state index_state::make_empty_index(offset_delta_time with_offset) {
     return idx;
 }
 
+bool index_state::pack() {
+    if (packed) {
+        return true;
+    }
+    if (size() < min_packed_entries) {
+        return false;
+    }
+    /*
+     * the delta-delta encoding of offsets and positions requires them to be
+     * non-decreasing, which is always the case unless the index is corrupt.
+     * leave such an index alone rather than asserting.
+     */
+    if (
+      !std::is_sorted(relative_offset_index.begin(), relative_offset_index.end())
+      || !std::is_sorted(position_index.begin(), position_index.end())) {
+        return false;
+    }
+    packed = std::make_unique<const packed_index>(packed_index{
+      .relative_offset_index = packed_index::offset_column(
+        relative_offset_index),
+      .relative_time_index = packed_index::time_column(relative_time_index),
+      .position_index = packed_index::position_column(position_index),
+    });
+    relative_offset_index = fragmented_vector<uint32_t>{};
+    relative_time_index = fragmented_vector<uint32_t>{};
+    position_index = fragmented_vector<uint64_t>{};
+    return true;
+}
+
+void index_state::unpack() {
+    if (likely(!packed)) {
+        return;
+    }
+    relative_offset_index = packed->relative_offset_index.unpack();
+    relative_time_index = packed->relative_time_index.unpack();
+    position_index = packed->position_index.unpack();
+    packed.reset();
+}
+
+size_t index_state::entries_memory_usage() const {
+    if (packed) {
+        return packed->memory_usage();
+    }
+    return relative_offset_index.memory_size()
+           + relative_time_index.memory_size() + position_index.memory_size();
+}
+
+bool operator==(const index_state& a, const index_state& b) {
+    if (
+      a.bitflags != b.bitflags || a.base_offset != b.base_offset
+      || a.max_offset != b.max_offset || a.base_timestamp != b.base_timestamp
+      || a.max_timestamp != b.max_timestamp
+      || a.batch_timestamps_are_monotonic != b.batch_timestamps_are_monotonic
+      || a.with_offset != b.with_offset
+      || a.non_data_timestamps != b.non_data_timestamps
+      || a.broker_timestamp != b.broker_timestamp
+      || a.num_compactible_records_appended
+           != b.num_compactible_records_appended
+      || a.size() != b.size()) {
+        return false;
+    }
+    if (!a.packed && !b.packed) {
+        return a.relative_offset_index == b.relative_offset_index
+               && a.relative_time_index == b.relative_time_index
+               && a.position_index == b.position_index;
+    }
+    for (size_t i = 0; i < a.size(); ++i) {
+        auto [ao, at, ap] = a.get_entry(i);
+        auto [bo, bt, bp] = b.get_entry(i);
+        if (ao != bo || at() != bt() || ap != bp) {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool index_state::maybe_index(
   size_t accumulator,
   size_t step,
@@ -54,6 +130,8 @@ bool index_state::maybe_index(
       base_offset,
       *this);
 
+    unpack();
+
     bool retval = false;
 
     // The first non-config batch in the segment, use its timestamp
@@ -132,7 +210,7 @@ std::ostream& operator<<(std::ostream& o, const index_state& s) {
              << s.num_compactible_records_appended << ", index("
              << s.relative_offset_index.size() << ","
              << s.relative_time_index.size() << "," << s.position_index.size()
-             << ")}";
+             << "), packed:" << (s.packed ? s.packed->size() : 0) << "}";
 }
 
 void index_state::serde_write(iobuf& out) const {
@@ -144,9 +222,15 @@ void index_state::serde_write(iobuf& out) const {
     write(tmp, max_offset);
     write(tmp, base_timestamp);
     write(tmp, max_timestamp);
-    write(tmp, relative_offset_index.copy());
-    write(tmp, relative_time_index.copy());
-    write(tmp, position_index.copy());
+    if (packed) {
+        write(tmp, packed->relative_offset_index.unpack());
+        write(tmp, packed->relative_time_index.unpack());
+        write(tmp, packed->position_index.unpack());
+    } else {
+        write(tmp, relative_offset_index.copy());
+        write(tmp, relative_time_index.copy());
+        write(tmp, position_index.copy());
+    }
     write(tmp, batch_timestamps_are_monotonic);
     write(tmp, with_offset);
     write(tmp, non_data_timestamps);
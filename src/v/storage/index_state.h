@@ -17,10 +17,12 @@
 #include "model/fundamental.h"
 #include "model/timestamp.h"
 #include "serde/envelope.h"
+#include "storage/packed_index.h"
 
 #include <seastar/core/sharded.hh>
 
 #include <cstdint>
+#include <memory>
 #include <optional>
 
 namespace storage {
@@ -119,6 +121,9 @@ struct index_state
     model::timestamp max_timestamp{0};
 
     /// breaking indexes into their own has a 6x latency reduction
+    ///
+    /// when the index is packed (see pack()) these are empty and the entries
+    /// are held by `packed` instead.
     fragmented_vector<uint32_t> relative_offset_index;
     fragmented_vector<uint32_t> relative_time_index;
     fragmented_vector<uint64_t> position_index;
@@ -148,17 +153,43 @@ struct index_state
     // support this field, and we can't conclude anything.
     std::optional<size_t> num_compactible_records_appended{0};
 
-    size_t size() const { return relative_offset_index.size(); }
+    // in-memory only packed encoding of the index entries. not serialized,
+    // and not part of the logical state of the index.
+    std::unique_ptr<const packed_index> packed;
 
-    bool empty() const { return relative_offset_index.empty(); }
+    size_t size() const {
+        return packed ? packed->size() : relative_offset_index.size();
+    }
+
+    bool empty() const { return size() == 0; }
+
+    /// Indices with fewer entries than this aren't worth packing.
+    static constexpr size_t min_packed_entries = 64;
+
+    /// \brief Encode the entries into the compact read-only packed form.
+    ///
+    /// Entries are transparently unpacked again by any modification. Returns
+    /// false if the index was left unpacked, e.g. because it is too small or
+    /// its offsets or positions are not sorted.
+    bool pack();
+
+    /// Restore the entries to the unpacked form.
+    void unpack();
+
+    bool is_packed() const { return packed != nullptr; }
+
+    /// Approximate memory used by the index entries, in bytes.
+    size_t entries_memory_usage() const;
 
     void add_entry(
       uint32_t relative_offset, offset_time_index relative_time, uint64_t pos) {
+        unpack();
         relative_offset_index.push_back(relative_offset);
         relative_time_index.push_back(relative_time.raw_value());
         position_index.push_back(pos);
     }
     void pop_back() {
+        unpack();
         relative_offset_index.pop_back();
         relative_time_index.pop_back();
         position_index.pop_back();
@@ -168,6 +199,12 @@ struct index_state
     }
     std::tuple<uint32_t, offset_time_index, uint64_t>
     get_entry(size_t i) const {
+        if (packed) {
+            return {
+              packed->relative_offset_index[i],
+              offset_time_index{packed->relative_time_index[i], with_offset},
+              packed->position_index[i]};
+        }
         return {
           relative_offset_index[i],
           offset_time_index{relative_time_index[i], with_offset},
@@ -175,26 +212,55 @@ struct index_state
     }
 
     void shrink_to_fit() {
+        if (packed) {
+            return;
+        }
         relative_offset_index.shrink_to_fit();
         relative_time_index.shrink_to_fit();
         position_index.shrink_to_fit();
     }
 
+    /// Index of the first entry with relative offset not less than \p o.
+    size_t lower_bound_offset(uint32_t o) const {
+        if (packed) {
+            return packed->relative_offset_index.lower_bound(o);
+        }
+        return std::distance(
+          relative_offset_index.begin(),
+          std::lower_bound(
+            relative_offset_index.begin(), relative_offset_index.end(), o));
+    }
+
+    /// Index of the first entry with file position greater than \p pos.
+    size_t upper_bound_position(uint64_t pos) const {
+        if (packed) {
+            return packed->position_index.upper_bound(pos);
+        }
+        return std::distance(
+          position_index.begin(),
+          std::upper_bound(position_index.begin(), position_index.end(), pos));
+    }
+
     std::optional<std::tuple<uint32_t, offset_time_index, uint64_t>>
     find_entry(model::timestamp ts) {
         const auto idx = offset_time_index{ts, with_offset};
 
-        auto it = std::lower_bound(
-          std::begin(relative_time_index),
-          std::end(relative_time_index),
-          idx.raw_value(),
-          std::less<uint32_t>{});
-        if (it == relative_offset_index.end()) {
+        size_t dist = 0;
+        if (packed) {
+            dist = packed->relative_time_index.lower_bound(idx.raw_value());
+        } else {
+            dist = std::distance(
+              relative_time_index.begin(),
+              std::lower_bound(
+                std::begin(relative_time_index),
+                std::end(relative_time_index),
+                idx.raw_value(),
+                std::less<uint32_t>{}));
+        }
+        if (dist == size()) {
             return std::nullopt;
         }
 
-        const auto dist = std::distance(relative_offset_index.begin(), it);
-
         // lower_bound will place us on the first batch in the index that has
         // 'max_timestamp' greater than 'ts'. Since not every batch is indexed,
         // it's not guaranteed* that 'ts' will be present in the batch
@@ -222,7 +288,7 @@ struct index_state
         batch_timestamps_are_monotonic = batch_timestamps_are_monotonic && pred;
     }
 
-    friend bool operator==(const index_state&, const index_state&) = default;
+    friend bool operator==(const index_state&, const index_state&);
 
     friend std::ostream& operator<<(std::ostream&, const index_state&);
 
@@ -236,9 +302,15 @@ private:
       , max_offset(o.max_offset)
       , base_timestamp(o.base_timestamp)
       , max_timestamp(o.max_timestamp)
-      , relative_offset_index(o.relative_offset_index.copy())
-      , relative_time_index(o.relative_time_index.copy())
-      , position_index(o.position_index.copy())
+      , relative_offset_index(
+          o.packed ? o.packed->relative_offset_index.unpack()
+                   : o.relative_offset_index.copy())
+      , relative_time_index(
+          o.packed ? o.packed->relative_time_index.unpack()
+                   : o.relative_time_index.copy())
+      , position_index(
+          o.packed ? o.packed->position_index.unpack()
+                   : o.position_index.copy())
       , batch_timestamps_are_monotonic(o.batch_timestamps_are_monotonic)
       , with_offset(o.with_offset)
       , non_data_timestamps(o.non_data_timestamps)
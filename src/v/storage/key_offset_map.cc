@@ -10,10 +10,20 @@
  */
 #include "storage/key_offset_map.h"
 
+#include "resource_mgmt/memory_accounting.h"
+
+#include <bit>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 namespace storage {
 
 simple_key_offset_map::simple_key_offset_map(std::optional<size_t> max_keys)
-  : _memory_tracker(ss::make_shared<util::mem_tracker>("simple_key_offset_map"))
+  : _memory_tracker(resources::memory_accounting::local().create_tracker(
+      resources::mem_subsystem::compaction, "simple_key_offset_map"))
   , _map(util::mem_tracked::map<absl::btree_map, compaction_key, model::offset>(
       _memory_tracker))
   , _max_keys(max_keys ? *max_keys : default_key_limit) {}
@@ -51,127 +61,73 @@ size_t simple_key_offset_map::capacity() const { return _max_keys; }
 
 seastar::future<std::optional<model::offset>>
 hash_key_offset_map::get(const compaction_key& key) const {
-    const auto hash = hash_key(key);
-
-    // handle a non-normalized probe position
-    // (true, value) -> stop and return value
-    // (false, _)    -> keep probing
-    auto handle_entry =
-      [&](size_t index) -> std::pair<bool, std::optional<model::offset>> {
-        ++probe_count_;
-        index = index % entries_.size();
-        auto& entry = entries_[index];
-        if (entry.empty()) {
-            return std::make_pair(true, std::nullopt);
-        } else if (entry.digest == hash) {
-            return std::make_pair(true, entry.offset);
-        }
-        return std::make_pair(false, std::nullopt);
-    };
-
-    ++search_count_;
-
-    // probe using the hash
-    probe probe(hash);
-    auto index = probe.next();
-    while (index.has_value()) {
-        const auto [stop, value] = handle_entry(index.value());
-        if (stop) {
-            return seastar::make_ready_future<std::optional<model::offset>>(
-              value);
-        }
-        const auto next_index = probe.next();
-        if (next_index.has_value()) {
-            index = next_index;
-        } else {
-            break;
-        }
-    }
-
-    // fall back to linear probe
-    const auto linear_base = index.value_or(0);
-    for (size_t probe = 0; probe < entries_.size(); ++probe) {
-        const auto [stop, value] = handle_entry(linear_base + probe);
-        if (stop) {
-            return seastar::make_ready_future<std::optional<model::offset>>(
-              value);
-        }
+    const key_hash hash(hash_key(key));
+    const auto loc = find(hash);
+    if (!loc.found) {
+        return seastar::make_ready_future<std::optional<model::offset>>(
+          std::nullopt);
     }
-
     return seastar::make_ready_future<std::optional<model::offset>>(
-      std::nullopt);
+      groups_[loc.group_index].slots[loc.slot_index].offset);
 }
 
 seastar::future<bool>
 hash_key_offset_map::put(const compaction_key& key, model::offset offset) {
-    const auto hash = hash_key(key);
-
-    const auto full = size_ >= capacity_;
-
-    enum class handle {
-        inserted,
-        not_inserted,
-        not_inserted_full,
-    };
+    const key_hash hash(hash_key(key));
+    const auto loc = find(hash);
+    if (loc.group_index == groups_.size()) {
+        return seastar::make_ready_future<bool>(false);
+    }
 
-    // handle a non-normalized probe position
-    auto handle_entry = [&](size_t index) {
-        ++probe_count_;
-        index = index % entries_.size();
-        auto& entry = entries_[index];
-        if (entry.empty()) {
-            if (full) {
-                return handle::not_inserted_full;
-            }
-            entry.digest = hash;
+    auto& g = groups_[loc.group_index];
+    auto& entry = g.slots[loc.slot_index];
+    if (loc.found) {
+        if (offset > entry.offset) {
             entry.offset = offset;
-            ++size_;
             max_offset_ = std::max(max_offset_, offset);
-            return handle::inserted;
-        } else if (entry.digest == hash) {
-            if (offset > entry.offset) {
-                entry.offset = offset;
-                max_offset_ = std::max(max_offset_, offset);
-            }
-            return handle::inserted;
         }
-        return handle::not_inserted;
-    };
-
-    ++search_count_;
+        return seastar::make_ready_future<bool>(true);
+    }
 
-    // probe using the hash
-    probe probe(hash);
-    auto index = probe.next();
-    while (index.has_value()) {
-        const auto res = handle_entry(index.value());
-        if (res == handle::inserted) {
-            return seastar::make_ready_future<bool>(true);
-        }
-        if (res == handle::not_inserted_full) {
-            return seastar::make_ready_future<bool>(false);
-        }
-        const auto next_index = probe.next();
-        if (next_index.has_value()) {
-            index = next_index;
-        } else {
-            break;
-        }
+    if (size_ >= capacity_) {
+        return seastar::make_ready_future<bool>(false);
     }
+    g.ctrl[loc.slot_index] = hash.ctrl;
+    entry.fingerprint = hash.fingerprint;
+    entry.offset = offset;
+    ++size_;
+    max_offset_ = std::max(max_offset_, offset);
+    return seastar::make_ready_future<bool>(true);
+}
+
+hash_key_offset_map::hash_key_offset_map(model::compaction_key_hash key_hash)
+  : hasher_(key_hash)
+  , memory_tracker_(resources::memory_accounting::local().create_tracker(
+      resources::mem_subsystem::compaction, "hash_key_offset_map")) {}
 
-    // fall back to linear probe
-    const auto linear_base = index.value_or(0);
-    for (size_t probe = 0; probe < entries_.size(); ++probe) {
-        const auto res = handle_entry(linear_base + probe);
-        if (res == handle::inserted) {
-            return seastar::make_ready_future<bool>(true);
+hash_key_offset_map::location
+hash_key_offset_map::find(const key_hash& hash) const {
+    ++search_count_;
+    const auto num_groups = groups_.size();
+    auto index = num_groups > 0 ? hash.start % num_groups : 0;
+    for (size_t probe = 0; probe < num_groups; ++probe) {
+        ++probe_count_;
+        const auto& g = groups_[index];
+        for (auto m = g.match(hash.ctrl); m != 0; m &= m - 1) {
+            const auto i = static_cast<size_t>(std::countr_zero(m));
+            if (g.slots[i].fingerprint == hash.fingerprint) {
+                return {.group_index = index, .slot_index = i, .found = true};
+            }
         }
-        if (res == handle::not_inserted_full) {
-            return seastar::make_ready_future<bool>(false);
+        if (auto m = g.match(ctrl_empty); m != 0) {
+            const auto i = static_cast<size_t>(std::countr_zero(m));
+            return {.group_index = index, .slot_index = i, .found = false};
+        }
+        if (++index == num_groups) {
+            index = 0;
         }
     }
-
-    return seastar::make_ready_future<bool>(false);
+    return {.group_index = num_groups, .slot_index = 0, .found = false};
 }
 
 model::offset hash_key_offset_map::max_offset() const { return max_offset_; }
@@ -180,22 +136,25 @@ size_t hash_key_offset_map::size() const { return size_; }
 size_t hash_key_offset_map::capacity() const { return capacity_; }
 
 seastar::future<> hash_key_offset_map::initialize(size_t size_bytes) {
-    co_await fragmented_vector_clear_async(entries_);
-    while (entries_.memory_size() < size_bytes) {
-        for (size_t i = 0; i < entries_.elements_per_fragment(); ++i) {
-            entries_.push_back(entry{});
+    co_await fragmented_vector_clear_async(groups_);
+    while (groups_.memory_size() < size_bytes) {
+        for (size_t i = 0; i < groups_.elements_per_fragment(); ++i) {
+            groups_.push_back(group{});
         }
         if (seastar::need_preempt()) {
             co_await seastar::maybe_yield();
         }
     }
+    memory_tracker_->deallocate(memory_tracker_->consumption());
+    memory_tracker_->allocate(static_cast<int64_t>(groups_.memory_size()));
     size_ = 0;
     max_offset_ = model::offset{};
-    if (entries_.size() > 0) {
+    if (groups_.size() > 0) {
         capacity_ = std::max(
           size_t(1),
           static_cast<size_t>(
-            static_cast<double>(entries_.size()) * max_load_factor));
+            static_cast<double>(groups_.size() * group_width)
+            * max_load_factor));
     } else {
         capacity_ = 0;
     }
@@ -204,7 +163,7 @@ seastar::future<> hash_key_offset_map::initialize(size_t size_bytes) {
 }
 
 seastar::future<> hash_key_offset_map::reset() {
-    co_await fragmented_vector_fill_async(entries_, entry{});
+    co_await fragmented_vector_fill_async(groups_, group{});
     size_ = 0;
     max_offset_ = model::offset{};
     search_count_ = 0;
@@ -219,38 +178,55 @@ double hash_key_offset_map::hit_rate() const {
            / static_cast<double>(probe_count_);
 }
 
-bool hash_key_offset_map::entry::empty() const {
-    return digest == hash_type::digest_type{};
+seastar::future<bool>
+hash_key_offset_map::may_share_keys(const compaction_key_filter& filter) const {
+    if (filter.key_hash() != key_hash_algorithm()) {
+        co_return true;
+    }
+    constexpr uint32_t all_slots = (uint32_t(1) << group_width) - 1;
+    for (const auto& g : groups_) {
+        // occupied slots hold a key
+        for (auto m = g.match(ctrl_empty) ^ all_slots; m != 0; m &= m - 1) {
+            const auto i = static_cast<size_t>(std::countr_zero(m));
+            if (filter.may_contain(g.slots[i].fingerprint)) {
+                co_return true;
+            }
+        }
+        if (seastar::need_preempt()) {
+            co_await seastar::maybe_yield();
+        }
+    }
+    co_return false;
 }
 
-hash_key_offset_map::probe::probe(const hash_type::digest_type& hash)
-  : iter(hash.data())
-  , end(iter + hash_type::digest_size) {}
+hash_key_offset_map::key_hash::key_hash(const hash_type::digest_type& digest) {
+    static_assert(
+      sizeof(start) + 1 + fingerprint_size <= hash_type::digest_size);
+    std::memcpy(&start, digest.data(), sizeof(start));
+    ctrl = static_cast<uint8_t>(digest[sizeof(start)]) & 0x7f;
+    fingerprint = compaction_key_filter::fingerprint(digest);
+}
 
-std::optional<hash_key_offset_map::probe::index_type>
-hash_key_offset_map::probe::next() {
-    if ((iter + sizeof(index_type)) > end) {
-        return std::nullopt;
+uint32_t hash_key_offset_map::group::match(uint8_t c) const {
+#if defined(__SSE2__)
+    const auto ctrls = _mm_loadu_si128(
+      reinterpret_cast<const __m128i*>(ctrl.data()));
+    const auto needle = _mm_set1_epi8(static_cast<char>(c));
+    return static_cast<uint32_t>(
+      _mm_movemask_epi8(_mm_cmpeq_epi8(ctrls, needle)));
+#else
+    // fixed width loop that the compiler vectorizes on other targets
+    uint32_t mask = 0;
+    for (size_t i = 0; i < group_width; ++i) {
+        mask |= static_cast<uint32_t>(ctrl[i] == c) << i;
     }
-
-    // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
-    index_type index;
-    std::memcpy(&index, iter, sizeof(index_type));
-
-    iter += sizeof(index_type);
-
-    return index;
+    return mask;
+#endif
 }
 
 hash_key_offset_map::hash_type::digest_type
 hash_key_offset_map::hash_key(const compaction_key& key) const {
-    try {
-        hasher_.update(key);
-        return hasher_.reset();
-    } catch (...) {
-        hasher_.reset();
-        throw;
-    }
+    return hasher_.hash(key);
 }
 
 } // namespace storage
@@ -9,14 +9,17 @@
 #pragma once
 
 #include "container/fragmented_vector.h"
-#include "hashing/secure.h"
 #include "storage/compacted_index.h"
+#include "storage/compaction_key_filter.h"
 #include "utils/tracking_allocator.h"
 
 #include <seastar/core/future.hh>
 
 #include <absl/container/btree_map.h>
 
+#include <array>
+#include <cstdint>
+
 namespace storage {
 
 /**
@@ -95,7 +98,21 @@ private:
 };
 
 /**
- * A key_offset_map in which the key space is mapped to sha256(key).
+ * A key_offset_map in which the key space is mapped to a digest of the key,
+ * sha256(key) unless the map is built with another compaction_key_hash.
+ *
+ * The table is laid out like a swiss table. Slots are arranged in groups of
+ * 16, each with an array of one-byte control words holding 7 bits of the key
+ * hash, or a marker for an empty slot. A lookup selects a group from the hash
+ * and compares all 16 control words at once, then compares the stored
+ * fingerprint only for the slots whose control word matched. A slot stores a
+ * 128-bit fingerprint of the digest rather than the full 256-bit digest, which
+ * keeps a slot at 24 bytes while the chance of two keys in a map sharing a
+ * fingerprint remains negligible.
+ *
+ * There are no deletions, so probing stops at the first group with an empty
+ * slot: a key is always inserted into the first such group in its probe
+ * sequence.
  *
  * This container does not auto-grow on insert, and a default initialized
  * instance has zero capacity. To add capacity call `reset(size_bytes)`. This is
@@ -109,6 +126,9 @@ class hash_key_offset_map : public key_offset_map {
     static constexpr double max_load_factor = 0.95;
 
 public:
+    explicit hash_key_offset_map(
+      model::compaction_key_hash key_hash = model::compaction_key_hash::sha256);
+
     seastar::future<std::optional<model::offset>>
     get(const compaction_key& key) const override;
 
@@ -139,47 +159,83 @@ public:
 
     /**
      * The ratio of hash table searches (e.g. one get or put) to the number of
-     * underlying accesses made into the hash table.
+     * groups of slots probed in the hash table.
      */
     double hit_rate() const;
 
+    /**
+     * Returns false if none of the keys in the map are in \p filter, in which
+     * case the segment the filter was built from has no records that are
+     * shadowed by the map. A filter built with another hash function may
+     * share any key.
+     */
+    seastar::future<bool> may_share_keys(const compaction_key_filter&) const;
+
+    /// The hash function keys are identified by.
+    model::compaction_key_hash key_hash_algorithm() const {
+        return hasher_.algorithm();
+    }
+
 private:
-    using hash_type = hash_sha256;
+    using hash_type = compaction_key_hasher;
+
+    static constexpr size_t group_width = 16;
+    static constexpr size_t fingerprint_size
+      = compaction_key_filter::fingerprint_size;
+    static constexpr uint8_t ctrl_empty = 0x80;
 
     /**
-     * hash table entry.
+     * The parts of a key digest used by the table: the group to start probing
+     * from, the 7-bit control word, and the fingerprint stored in the slot.
+     * They are taken from non-overlapping bytes of the digest, and the
+     * fingerprint is the one compaction_key_filter is built from.
      */
-    struct entry {
-        hash_type::digest_type digest{};
+    struct key_hash {
+        explicit key_hash(const hash_type::digest_type&);
+
+        uint64_t start;
+        uint8_t ctrl;
+        std::array<char, fingerprint_size> fingerprint;
+    };
+
+    struct slot {
+        std::array<char, fingerprint_size> fingerprint;
         model::offset offset;
-        bool empty() const;
     };
 
-    /**
-     * Uses successive chunks of sizeof(index_type) bytes taken from hash(key)
-     * as probes into the hash table. When `next()` returns null then the caller
-     * should switch to linear probing.
-     */
-    struct probe {
-        using index_type = uint32_t;
-        static_assert(sizeof(index_type) <= hash_type::digest_size);
+    struct group {
+        group() { ctrl.fill(ctrl_empty); }
 
-        explicit probe(const hash_type::digest_type&);
+        /// Bitmask of the slots whose control word equals \p c.
+        uint32_t match(uint8_t c) const;
 
-        std::optional<index_type> next();
+        std::array<uint8_t, group_width> ctrl;
+        std::array<slot, group_width> slots;
+    };
 
-        hash_type::digest_type::const_pointer iter;
-        hash_type::digest_type::const_pointer end;
+    /**
+     * Location of a key in the table, or of the first empty slot in its probe
+     * sequence if the key isn't present. If neither was found then
+     * `group_index` is the number of groups.
+     */
+    struct location {
+        size_t group_index;
+        size_t slot_index;
+        bool found;
     };
 
+    location find(const key_hash&) const;
+
     /**
-     * hash the compaction key. this helper will catch exceptions and reset the
-     * hashing object which is reused to avoid reinitialization of gnutls state.
+     * hash the compaction key. the hashing object is reused to avoid
+     * reinitialization of gnutls state.
      */
     hash_type::digest_type hash_key(const compaction_key&) const;
 
     mutable hash_type hasher_;
-    large_fragment_vector<entry> entries_;
+    // accounts for the memory of groups_
+    ss::shared_ptr<util::mem_tracker> memory_tracker_;
+    large_fragment_vector<group> groups_;
     size_t size_{0};
     model::offset max_offset_;
     size_t capacity_{0};
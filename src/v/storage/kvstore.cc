@@ -31,6 +31,8 @@
 #include <seastar/util/defer.hh>
 #include <seastar/util/log.hh>
 
+#include <absl/container/flat_hash_map.h>
+
 static ss::logger lg("kvstore");
 
 namespace storage {
@@ -79,6 +81,12 @@ ss::future<> kvstore::start() {
               "entries_removed",
               [this] { return _probe.entries_removed; },
               ss::metrics::description("Number of entries removaled")),
+            ss::metrics::make_total_operations(
+              "entries_coalesced",
+              [this] { return _probe.coalesced_entries; },
+              ss::metrics::description(
+                "Number of operations superseded by a later operation on the "
+                "same key before being written")),
             ss::metrics::make_current_bytes(
               "cached_bytes",
               [this] { return _probe.cached_bytes; },
@@ -135,6 +143,7 @@ ss::future<> kvstore::stop() {
         op.done.set_exception(ss::gate_closed_exception());
     }
     _ops.clear();
+    _ops_bytes = 0;
 
     return f.then([this] {
         // wait until the flusher exists--it might create _segment
@@ -191,8 +200,16 @@ ss::future<> kvstore::put(key_space ks, bytes key, std::optional<iobuf> value) {
     key = make_spaced_key(ks, key);
     return ss::with_gate(
       _gate, [this, key = std::move(key), value = std::move(value)]() mutable {
+          _ops_bytes += key.size() + (value ? value->size_bytes() : 0);
           auto& w = _ops.emplace_back(std::move(key), std::move(value));
-          if (!_timer.armed()) {
+          const auto flush_bytes
+            = config::shard_local_cfg().kvstore_flush_bytes();
+          if (flush_bytes > 0 && _ops_bytes >= flush_bytes) {
+              // enough is pending to make the write worthwhile: flush now
+              // rather than waiting out the commit interval
+              _timer.cancel();
+              _sem.signal();
+          } else if (!_timer.armed()) {
               _timer.arm(_conf.commit_interval());
           }
           return w.done.get_future();
@@ -236,11 +253,29 @@ ss::future<> kvstore::flush_and_apply_ops() {
 
     // flush and apply whatever happens to be queued up
     auto ops = std::exchange(_ops, {});
+    _ops_bytes = 0;
+
+    // only the last operation on each key needs to be logged and applied,
+    // the earlier ones are resolved along with it
+    absl::flat_hash_map<bytes_view, size_t, bytes_type_hash> last_op;
+    last_op.reserve(ops.size());
+    for (size_t i = 0; i < ops.size(); ++i) {
+        last_op[bytes_view(ops[i].key)] = i;
+    }
+    std::vector<bool> superseded(ops.size(), true);
+    for (const auto& [key, i] : last_op) {
+        superseded[i] = false;
+    }
+    _probe.entries_coalesced(ops.size() - last_op.size());
 
     // build the operation batch to be logged
     storage::record_batch_builder builder(
       model::record_batch_type::kvstore, _next_offset);
-    for (auto& op : ops) {
+    for (size_t i = 0; i < ops.size(); ++i) {
+        if (superseded[i]) {
+            continue;
+        }
+        auto& op = ops[i];
         std::optional<iobuf> value;
         if (op.value) {
             value = op.value->share(0, op.value->size_bytes());
@@ -260,9 +295,15 @@ ss::future<> kvstore::flush_and_apply_ops() {
     return _segment->append(std::move(batch))
       .then([this](append_result) { return _segment->flush(); })
       .then([this]() { return _db_mut.get_units(); })
-      .then([this, last_offset, ops = std::move(ops)](auto units) mutable {
-          for (auto& op : ops) {
-              apply_op(std::move(op.key), std::move(op.value), units);
+      .then([this,
+             last_offset,
+             ops = std::move(ops),
+             superseded = std::move(superseded)](auto units) mutable {
+          for (size_t i = 0; i < ops.size(); ++i) {
+              auto& op = ops[i];
+              if (!superseded[i]) {
+                  apply_op(std::move(op.key), std::move(op.value), units);
+              }
               op.done.set_value();
           }
           _next_offset = last_offset + model::offset(1);
@@ -272,71 +313,94 @@ ss::future<> kvstore::flush_and_apply_ops() {
 
 ss::future<> kvstore::roll() {
     if (!_segment) {
-        return make_segment(
-                 _ntpc,
-                 model::offset(_next_offset),
-                 model::term_id(0),
-                 ss::default_priority_class(),
-                 record_version_type::v1,
-                 config::shard_local_cfg().storage_read_buffer_size(),
-                 config::shard_local_cfg().storage_read_readahead_count(),
-                 std::nullopt,
-                 _resources,
-                 _feature_table,
-                 _ntp_sanitizer_config)
-          .then([this](ss::lw_shared_ptr<segment> seg) {
-              _segment = std::move(seg);
-          });
+        _segment = co_await make_segment(
+          _ntpc,
+          model::offset(_next_offset),
+          model::term_id(0),
+          ss::default_priority_class(),
+          record_version_type::v1,
+          config::shard_local_cfg().storage_read_buffer_size(),
+          config::shard_local_cfg().storage_read_readahead_count(),
+          std::nullopt,
+          _resources,
+          _feature_table,
+          _ntp_sanitizer_config);
+        co_return;
     }
 
-    if (_segment->appender().file_byte_offset() > _conf.max_segment_size) {
-        _probe.roll_segment();
+    if (
+      _segment->appender().file_byte_offset() <= _conf.max_segment_size
+      || _snapshot_in_progress) {
+        // keep appending to the segment while the previous roll finishes
+        co_return;
+    }
 
+    _probe.roll_segment();
+
+    vlog(
+      lg.debug,
+      "Rolling segment with base offset {} size {}",
+      _segment->offsets().base_offset,
+      _segment->appender().file_byte_offset());
+    // _segment being set is a signal to stop() to flush and close the
+    // segment. we clear _segment here before closing and finishing the roll
+    // process so that if an issue occurs and the flush fiber terminates
+    // that stop() doesn't try to flush and close a closed and partially
+    // cleaned-up segment.
+    auto seg = std::exchange(_segment, nullptr);
+    co_await seg->close();
+
+    // the flusher is the only writer to the database, so the capture is
+    // consistent with the end of the closed segment
+    auto snap = co_await capture_snapshot();
+
+    _segment = co_await make_segment(
+      _ntpc,
+      model::offset(_next_offset),
+      model::term_id(0),
+      ss::default_priority_class(),
+      record_version_type::v1,
+      config::shard_local_cfg().storage_read_buffer_size(),
+      config::shard_local_cfg().storage_read_readahead_count(),
+      std::nullopt,
+      _resources,
+      _feature_table,
+      _ntp_sanitizer_config);
+
+    // until the snapshot is durable, recovery replays the old segment on top
+    // of the previous snapshot, so writing it needn't hold up flushes
+    _snapshot_in_progress = true;
+    ssx::spawn_with_gate(
+      _gate, [this, seg = std::move(seg), snap = std::move(snap)]() mutable {
+          return finish_roll(std::move(seg), std::move(snap)).finally([this] {
+              _snapshot_in_progress = false;
+          });
+      });
+}
+
+ss::future<> kvstore::finish_roll(
+  ss::lw_shared_ptr<segment> seg, std::optional<db_snapshot> snap) {
+    try {
+        if (snap) {
+            co_await write_snapshot(std::move(*snap));
+        }
         vlog(
           lg.debug,
-          "Rolling segment with base offset {} size {}",
-          _segment->offsets().base_offset,
-          _segment->appender().file_byte_offset());
-        // _segment being set is a signal to stop() to flush and close the
-        // segment. we clear _segment here before closing and finishing the roll
-        // process so that if an issue occurs and the flush fiber terminates
-        // that stop() doesn't try to flush and close a closed and partially
-        // cleaned-up segment.
-        auto seg = std::exchange(_segment, nullptr);
-        return seg->close()
-          .then([this] { return save_snapshot(); })
-          .then([seg] {
-              vlog(
-                lg.debug,
-                "Removing old segment with base offset {}",
-                seg->offsets().base_offset);
-              return ss::remove_file(seg->reader().path().string()).then([seg] {
-                  return ss::remove_file(seg->index().path().string());
-              });
-          })
-          .then([this] {
-              return make_segment(
-                       _ntpc,
-                       model::offset(_next_offset),
-                       model::term_id(0),
-                       ss::default_priority_class(),
-                       record_version_type::v1,
-                       config::shard_local_cfg().storage_read_buffer_size(),
-                       config::shard_local_cfg().storage_read_readahead_count(),
-                       std::nullopt,
-                       _resources,
-                       _feature_table,
-                       _ntp_sanitizer_config)
-                .then([this](ss::lw_shared_ptr<segment> seg) {
-                    _segment = std::move(seg);
-                });
-          });
+          "Removing old segment with base offset {}",
+          seg->offsets().base_offset);
+        co_await ss::remove_file(seg->reader().path().string());
+        co_await ss::remove_file(seg->index().path().string());
+    } catch (...) {
+        // the segment is left behind for recovery to replay or remove
+        vlog(
+          lg.warn,
+          "Error snapshotting rolled segment with base offset {}: {}",
+          seg->offsets().base_offset,
+          std::current_exception());
     }
-
-    return ss::now();
 }
 
-ss::future<> kvstore::save_snapshot() {
+ss::future<std::optional<kvstore::db_snapshot>> kvstore::capture_snapshot() {
     vassert(
       _next_offset >= model::offset(0),
       "Unexpected next offset {}",
@@ -344,10 +408,11 @@ ss::future<> kvstore::save_snapshot() {
 
     // no operations have been applied to the db
     if (_next_offset == model::offset(0)) {
-        co_return;
+        co_return std::nullopt;
     }
 
-    // package up the db into a batch
+    // package up the db into a batch. values are shared rather than copied:
+    // operations applied later replace them in the db without modifying them.
     storage::record_batch_builder builder(
       model::record_batch_type::kvstore, model::offset(0));
     auto units = co_await _db_mut.get_units();
@@ -357,29 +422,39 @@ ss::future<> kvstore::save_snapshot() {
           entry.second.share(0, entry.second.size_bytes()));
         co_await ss::coroutine::maybe_yield();
     }
+    // the last log offset represented in the snapshot
+    auto last_offset = _next_offset - model::offset(1);
     units.return_all();
-    auto batch = std::move(builder).build();
+    co_return db_snapshot{
+      .last_offset = last_offset, .batch = std::move(builder).build()};
+}
+
+ss::future<> kvstore::save_snapshot() {
+    auto snap = co_await capture_snapshot();
+    if (snap) {
+        co_await write_snapshot(std::move(*snap));
+    }
+}
 
+ss::future<> kvstore::write_snapshot(db_snapshot snap) {
     // serialize batch: size_prefix + batch
     iobuf data;
     auto ph = data.reserve(sizeof(int32_t));
     co_await reflection::async_adl<model::record_batch>{}.to(
-      data, std::move(batch));
+      data, std::move(snap.batch));
     auto size = ss::cpu_to_le(int32_t(data.size_bytes() - sizeof(int32_t)));
     ph.write((const char*)&size, sizeof(size));
 
     vlog(
       lg.debug,
       "Creating snapshot at offset {} ({} bytes)",
-      _next_offset - model::offset(1),
+      snap.last_offset,
       size);
 
     auto wr = co_await _snap.start_snapshot();
-    // the last log offset represented in the snapshot
-    auto last_offset = _next_offset - model::offset(1);
 
     iobuf meta;
-    reflection::serialize(meta, last_offset);
+    reflection::serialize(meta, snap.last_offset);
 
     co_await wr.write_metadata(std::move(meta));
     auto& os = wr.output();
@@ -397,6 +472,7 @@ ss::future<> kvstore::recover() {
      */
     co_await load_snapshot();
 
+    log_recovery_stats stats;
     auto segments = co_await recover_segments(
       partition_path(_ntpc),
       _ntpc.is_compacted(),
@@ -407,7 +483,10 @@ ss::future<> kvstore::recover() {
       std::nullopt,
       _resources,
       _feature_table,
-      _ntp_sanitizer_config);
+      _ntp_sanitizer_config,
+      stats);
+
+    vlog(lg.debug, "Recovered kvstore segments: {}", stats);
 
     co_await replay_segments(std::move(segments));
 }
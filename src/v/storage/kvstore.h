@@ -46,9 +46,20 @@ namespace storage {
  *   auto f = kvstore.operation(...);
  *
  * Operations are staged in an ordered in-memory container. After a commit
- * interval has elapsed the operations are serialized into a single blob and
- * flushed to disk. Once the flush is complete the operations are applied to the
- * in-memory cache, and the associated promise is resolved.
+ * interval has elapsed, or once `kvstore_flush_bytes` are pending, the
+ * operations are serialized into a single blob and flushed to disk. Only the
+ * last of several operations on the same key within a flush is written. Once
+ * the flush is complete the operations are applied to the in-memory cache, and
+ * the associated promise is resolved.
+ *
+ * Snapshots
+ * =========
+ *
+ * When the segment fills up a new one is started and the database is
+ * snapshotted in the background. The snapshot shares the buffers of the
+ * database as of the roll, which later operations replace rather than modify,
+ * so only the capture delays flushing and not the write of the snapshot. The
+ * old segment is removed once the snapshot is durable.
  *
  * Concurrency
  * ===========
@@ -158,6 +169,7 @@ private:
      * segment is created.
      */
     std::vector<op> _ops;
+    size_t _ops_bytes{0};
     ss::timer<> _timer;
     ssx::semaphore _sem{0, "s/kvstore"};
     ss::lw_shared_ptr<segment> _segment;
@@ -174,6 +186,23 @@ private:
     ss::future<> roll();
     ss::future<> save_snapshot();
 
+    /**
+     * Snapshot of the database up to and including last_offset. The batch
+     * shares the buffers of the database entries at the time of capture.
+     */
+    struct db_snapshot {
+        model::offset last_offset;
+        model::record_batch batch;
+    };
+    ss::future<std::optional<db_snapshot>> capture_snapshot();
+    ss::future<> write_snapshot(db_snapshot);
+    ss::future<>
+      finish_roll(ss::lw_shared_ptr<segment>, std::optional<db_snapshot>);
+
+    // Set while a background snapshot of a rolled segment is written. The
+    // segment isn't rolled again until it completes.
+    bool _snapshot_in_progress{false};
+
     /*
      * Recovery
      *
@@ -220,6 +249,7 @@ private:
         void entry_fetched() { ++entries_fetched; }
         void entry_written() { ++entries_written; }
         void entry_removed() { ++entries_removed; }
+        void entries_coalesced(size_t count) { coalesced_entries += count; }
         void add_cached_bytes(size_t count) { cached_bytes += count; }
         void dec_cached_bytes(size_t count) { cached_bytes -= count; }
 
@@ -227,6 +257,7 @@ private:
         uint64_t entries_fetched{0};
         uint64_t entries_written{0};
         uint64_t entries_removed{0};
+        uint64_t coalesced_entries{0};
         size_t cached_bytes{0};
 
         metrics::internal_metric_groups metrics;
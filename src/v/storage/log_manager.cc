@@ -30,6 +30,7 @@
 #include "storage/kvstore.h"
 #include "storage/log.h"
 #include "storage/logger.h"
+#include "storage/reader_handle_cache.h"
 #include "storage/segment.h"
 #include "storage/segment_appender.h"
 #include "storage/segment_index.h"
@@ -142,7 +143,9 @@ log_manager::log_manager(
   , _feature_table(feature_table)
   , _jitter(_config.compaction_interval())
   , _trigger_gc_jitter(0s, 5s)
-  , _batch_cache(config.reclaim_opts) {
+  , _batch_cache(config.reclaim_opts)
+  , _flush_coordinator(
+      config::shard_local_cfg().storage_flush_coalesce_window_ms.bind()) {
     _config.compaction_interval.watch([this]() {
         _jitter = simple_time_jitter<ss::lowres_clock>{
           _config.compaction_interval()};
@@ -170,6 +173,12 @@ ss::future<> log_manager::clean_close(ss::shared_ptr<storage::log> log) {
 }
 
 ss::future<> log_manager::start() {
+    co_await _resources.recycler().start(_config.base_dir);
+    co_await _resources.unlinker().start(_config.base_dir);
+    _batch_cache.setup_metrics();
+    _flush_coordinator.probe().setup_metrics();
+    auto& handles = internal::reader_handles();
+    handles.probe().setup_metrics(handles);
     if (unlikely(config::shard_local_cfg()
                    .log_disable_housekeeping_for_tests.value())) {
         co_return;
@@ -183,11 +192,13 @@ ss::future<> log_manager::stop() {
     _housekeeping_sem.broken();
 
     co_await _open_gate.close();
+    co_await _flush_coordinator.stop();
     co_await ss::coroutine::parallel_for_each(
       _logs, [this](logs_type::value_type& entry) {
           return clean_close(entry.second->handle);
       });
     co_await _batch_cache.stop();
+    internal::reader_handles().probe().clear_metrics();
     co_await ssx::async_clear(_logs)();
     if (_compaction_hash_key_map) {
         // Clear memory used for the compaction hash map, if any.
@@ -248,7 +259,8 @@ log_manager::housekeeping_scan(model::timestamp collection_threshold) {
       && is_not_set(_logs_list.front().flags, bflags::compacted)) {
         auto compaction_mem_bytes
           = memory_groups().compaction_reserved_memory();
-        auto compaction_map = std::make_unique<hash_key_offset_map>();
+        auto compaction_map = std::make_unique<hash_key_offset_map>(
+          config::shard_local_cfg().log_compaction_key_hash());
         co_await compaction_map->initialize(compaction_mem_bytes);
         _compaction_hash_key_map = std::move(compaction_map);
     }
@@ -530,6 +542,7 @@ ss::future<ss::shared_ptr<log>> log_manager::do_manage(ntp_config cfg) {
     with_cache cache_enabled = cfg.cache_enabled();
     auto ntp_sanitizer_cfg = _config.maybe_get_ntp_sanitizer_config(cfg.ntp());
 
+    log_recovery_stats recovery_stats;
     auto segments = co_await recover_segments(
       partition_path(cfg),
       cfg.is_compacted(),
@@ -540,10 +553,14 @@ ss::future<ss::shared_ptr<log>> log_manager::do_manage(ntp_config cfg) {
       last_clean_segment,
       _resources,
       _feature_table,
-      std::move(ntp_sanitizer_cfg));
+      std::move(ntp_sanitizer_cfg),
+      recovery_stats);
 
     auto l = storage::make_disk_backed_log(
       std::move(cfg), *this, std::move(segments), _kvstore, _feature_table);
+    vlog(
+      stlog.debug, "Recovered log {}: {}", l->config().ntp(), recovery_stats);
+    l->get_probe().set_recovery_stats(recovery_stats);
     auto [it, success] = _logs.emplace(
       l->config().ntp(), std::make_unique<log_housekeeping_meta>(l));
     _logs_list.push_back(*it->second);
@@ -563,6 +580,17 @@ ss::future<> log_manager::shutdown(model::ntp ntp) {
     vlog(stlog.debug, "Shutdown: {}", ntp);
 }
 
+std::optional<std::filesystem::path>
+log_manager::cold_directory(const ntp_config& cfg) const {
+    if (!_config.cold_dir) {
+        return std::nullopt;
+    }
+    auto relative = std::filesystem::path(cfg.work_directory())
+                      .lexically_relative(cfg.base_directory());
+    return std::filesystem::absolute(
+      std::filesystem::path(*_config.cold_dir) / relative);
+}
+
 ss::future<> log_manager::remove(model::ntp ntp) {
     vlog(stlog.info, "Asked to remove: {}", ntp);
     auto g = _open_gate.hold();
@@ -607,6 +635,13 @@ ss::future<> log_manager::remove(model::ntp ntp) {
           return ss::make_ready_future<>();
       });
     co_await remove_file(ntp_dir);
+    if (auto cold_dir = cold_directory(lg->config()); cold_dir) {
+        // segment removal has taken the cold files, but staging files of an
+        // interrupted migration may be left
+        if (co_await ss::file_exists(cold_dir->string())) {
+            co_await ss::recursive_remove_directory(*cold_dir);
+        }
+    }
     // We always dispatch topic directory deletion to core 0 as requests may
     // come from different cores
     co_await dispatch_topic_dir_deletion(topic_dir);
@@ -758,7 +793,7 @@ int64_t log_manager::compaction_backlog() const {
 }
 
 std::ostream& operator<<(std::ostream& o, const log_config& c) {
-    o << "{base_dir:" << c.base_dir
+    o << "{base_dir:" << c.base_dir << ", cold_dir:" << c.cold_dir
       << ", max_segment.size:" << c.max_segment_size()
       << ", file_sanitize_config:" << c.file_config << ", retention_bytes:";
     if (c.retention_bytes()) {
@@ -22,6 +22,7 @@
 #include "random/simple_time_jitter.h"
 #include "storage/batch_cache.h"
 #include "storage/file_sanitizer_types.h"
+#include "storage/flush_coordinator.h"
 #include "storage/key_offset_map.h"
 #include "storage/log.h"
 #include "storage/log_housekeeping_meta.h"
@@ -44,6 +45,7 @@
 
 #include <array>
 #include <chrono>
+#include <filesystem>
 #include <optional>
 
 namespace storage {
@@ -111,6 +113,10 @@ struct log_config {
       = std::chrono::seconds(30);
     ss::scheduling_group compaction_sg;
 
+    // Slower directory that sealed segments are moved to, if any. Partitions
+    // keep the same layout under it as under base_dir.
+    std::optional<ss::sstring> cold_dir;
+
     // Used for testing. Configuration object for creating
     // sanitizing or erroring file wrappers.
     std::optional<file_sanitize_config> file_config;
@@ -207,6 +213,11 @@ public:
 
     const log_config& config() const { return _config; }
 
+    /// Directory holding the cold segments of the partition, if a cold
+    /// directory is configured.
+    std::optional<std::filesystem::path>
+    cold_directory(const ntp_config&) const;
+
     /// Returns the number of managed logs.
     size_t size() const { return _logs.size(); }
 
@@ -225,6 +236,9 @@ public:
 
     storage_resources& resources() { return _resources; }
 
+    /// Coalesces flushes of the logs on this shard.
+    flush_coordinator& flusher() { return _flush_coordinator; }
+
     /*
      * Return disk usage information for all logs managed on the current core.
      */
@@ -275,6 +289,7 @@ private:
     logs_type _logs;
     compaction_list_type _logs_list;
     batch_cache _batch_cache;
+    flush_coordinator _flush_coordinator;
 
     // Hash key-map to use across multiple compactions to reuse reserved memory
     // rather than reallocating repeatedly.
@@ -12,6 +12,7 @@
 #include "base/vassert.h"
 #include "base/vlog.h"
 #include "bytes/iobuf.h"
+#include "config/configuration.h"
 #include "model/fundamental.h"
 #include "model/record.h"
 #include "storage/logger.h"
@@ -178,17 +179,21 @@ void skipping_consumer::print(std::ostream& os) const {
 }
 
 log_segment_batch_reader::log_segment_batch_reader(
-  segment& seg, log_reader_config& config, probe& p) noexcept
+  segment& seg,
+  log_reader_config& config,
+  probe& p,
+  ss::lw_shared_ptr<ss::file_input_stream_history> readahead_history) noexcept
   : _seg(seg)
   , _config(config)
-  , _probe(p) {}
+  , _probe(p)
+  , _readahead_history(std::move(readahead_history)) {}
 
 ss::future<std::unique_ptr<continuous_batch_parser>>
 log_segment_batch_reader::initialize(
   model::timeout_clock::time_point timeout,
   std::optional<model::offset> next_cached_batch) {
     auto input = co_await _seg.offset_data_stream(
-      _config.start_offset, _config.prio);
+      _config.start_offset, _config.prio, _readahead_history);
     co_return std::make_unique<continuous_batch_parser>(
       std::make_unique<skipping_consumer>(*this, timeout, next_cached_batch),
       std::move(input));
@@ -252,6 +257,7 @@ log_segment_batch_reader::read_some(model::timeout_clock::time_point timeout) {
         co_return result<records_t>(records_t{});
     }
 
+    auto latency = _probe.sample_read();
     if (!_iterator) {
         _iterator = co_await initialize(timeout, cache_read.next_cached_batch);
     }
@@ -299,9 +305,14 @@ log_reader::log_reader(
         }
     }
 
+    if (config::shard_local_cfg().storage_read_readahead_max_count() > 0) {
+        _readahead_history
+          = ss::make_lw_shared<ss::file_input_stream_history>();
+    }
+
     if (_iterator.next_seg != _lease->range.end()) {
         _iterator.reader = std::make_unique<log_segment_batch_reader>(
-          **_iterator.next_seg, _config, _probe);
+          **_iterator.next_seg, _config, _probe, _readahead_history);
     }
 }
 
@@ -321,7 +332,7 @@ ss::future<> log_reader::find_next_valid_iterator() {
     }
     if (_iterator.next_seg != _lease->range.end()) {
         _iterator.reader = std::make_unique<log_segment_batch_reader>(
-          **_iterator.next_seg, _config, _probe);
+          **_iterator.next_seg, _config, _probe, _readahead_history);
         _iterator.current_reader_seg = _iterator.next_seg;
     }
     if (tmp_reader) {
@@ -91,7 +91,11 @@ public:
     static constexpr size_t max_buffer_size = 32 * 1024; // 32KB
 
     log_segment_batch_reader(
-      segment&, log_reader_config& config, probe& p) noexcept;
+      segment&,
+      log_reader_config& config,
+      probe& p,
+      ss::lw_shared_ptr<ss::file_input_stream_history> readahead_history
+      = nullptr) noexcept;
     log_segment_batch_reader(log_segment_batch_reader&&) noexcept = default;
     log_segment_batch_reader& operator=(log_segment_batch_reader&&) noexcept
       = delete;
@@ -122,6 +126,7 @@ private:
     segment& _seg;
     log_reader_config& _config;
     probe& _probe;
+    ss::lw_shared_ptr<ss::file_input_stream_history> _readahead_history;
 
     std::unique_ptr<continuous_batch_parser> _iterator;
     tmp_state _state;
@@ -245,6 +250,11 @@ private:
     std::optional<model::offset> _expected_next;
     probe& _probe;
     ss::abort_source::subscription _as_sub;
+
+    // Access pattern of this reader, shared by the streams it opens on each
+    // segment so that their read-ahead adapts to it. Kept across
+    // reset_config so that a cached reader resumes with what it learnt.
+    ss::lw_shared_ptr<ss::file_input_stream_history> _readahead_history;
 };
 
 /**
@@ -17,23 +17,62 @@
 #include "model/fundamental.h"
 #include "storage/logger.h"
 
+#include <algorithm>
 #include <iterator>
 
 namespace storage {
 
+offset_translator_state::batches_t::iterator
+offset_translator_state::lower_bound(model::offset o) {
+    return std::partition_point(
+      _batches.begin(), _batches.end(), [o](const batch_info& b) {
+          return b.last_offset < o;
+      });
+}
+
+offset_translator_state::batches_t::const_iterator
+offset_translator_state::lower_bound(model::offset o) const {
+    return std::partition_point(
+      _batches.begin(), _batches.end(), [o](const batch_info& b) {
+          return b.last_offset < o;
+      });
+}
+
+offset_translator_state::batches_t::iterator
+offset_translator_state::upper_bound(model::offset o) {
+    return std::partition_point(
+      _batches.begin(), _batches.end(), [o](const batch_info& b) {
+          return b.last_offset <= o;
+      });
+}
+
+void offset_translator_state::append(batch_info b) {
+    if (
+      _batches.size() > 1
+      && b.base_offset == model::next_offset(_batches.back().last_offset)) {
+        // the delta grows by exactly the length of both batches, so the pair
+        // translates the same as a single batch spanning them
+        auto& back = _batches.back();
+        back.last_offset = b.last_offset;
+        back.next_delta = b.next_delta;
+        return;
+    }
+    _batches.push_back(b);
+}
+
 int64_t offset_translator_state::delta(model::offset o) const {
-    if (_last_offset2batch.empty()) {
+    if (_batches.empty()) {
         return 0;
     }
 
-    auto it = _last_offset2batch.lower_bound(o);
-    if (it == _last_offset2batch.begin()) {
+    auto it = lower_bound(o);
+    if (it == _batches.begin()) {
         // We don't have enough information to calculate delta if we've ended up
-        // here (even if we have an entry with the key o in the
-        // _last_offset2batch map). The reason is that the first entry of the
-        // map doesn't represent a real non-data batch, but rather an
-        // amalgamation of all non-data batches prior to the start of the
-        // translation range that is needed to save the delta at the log start.
+        // here (even if we have an entry with the last offset o). The reason is
+        // that the first entry doesn't represent a real non-data batch, but
+        // rather an amalgamation of all non-data batches prior to the start of
+        // the translation range that is needed to save the delta at the log
+        // start.
         //
         // One common way to get this error is when the client code tries to
         // translate the end offset of an empty log (which is by convention
@@ -47,15 +86,15 @@ int64_t offset_translator_state::delta(model::offset o) const {
           "{})",
           _ntp,
           o,
-          model::next_offset(_last_offset2batch.begin()->first))};
+          model::next_offset(_batches.front().last_offset))};
     }
 
-    auto delta = std::prev(it)->second.next_delta;
-    if (it == _last_offset2batch.end() || o < it->second.base_offset) {
+    auto delta = std::prev(it)->next_delta;
+    if (it == _batches.end() || o < it->base_offset) {
         // This is the common case: offset o is the offset of a record in a data
         // batch between non-data batches pointed to by iterators `it` and
-        // `std::prev(it)` (or, if `it` is the map end, o is beyond the last
-        // non-data batch in the log). Delta that we need is stored in the map
+        // `std::prev(it)` (or, if `it` is the end, o is beyond the last
+        // non-data batch in the log). Delta that we need is stored in the
         // element pointed to by `std::prev(it)`.
         return delta;
     } else {
@@ -66,7 +105,7 @@ int64_t offset_translator_state::delta(model::offset o) const {
         // (redpanda) offset 0 is a config batch. Then its data (kafka) offset
         // must be 0, the same as the data (kafka) offset of the data record at
         // log (redpanda) offset 1.
-        return delta + (o - it->second.base_offset);
+        return delta + (o - it->base_offset);
     }
 }
 model::offset_delta
@@ -81,7 +120,7 @@ model::offset offset_translator_state::from_log_offset(model::offset o) const {
 
 model::offset offset_translator_state::to_log_offset(
   model::offset data_offset, model::offset hint) const {
-    if (_last_offset2batch.empty()) {
+    if (_batches.empty()) {
         return data_offset;
     }
 
@@ -90,11 +129,10 @@ model::offset offset_translator_state::to_log_offset(
     }
 
     model::offset min_log_offset = model::next_offset(
-      _last_offset2batch.begin()->first);
+      _batches.front().last_offset);
 
     model::offset min_data_offset
-      = min_log_offset
-        - model::offset(_last_offset2batch.begin()->second.next_delta);
+      = min_log_offset - model::offset(_batches.front().next_delta);
     if (data_offset < min_data_offset) {
         throw std::runtime_error{fmt::format(
           "ntp {}: data offset {} is outside the translation range (starting "
@@ -107,60 +145,55 @@ model::offset offset_translator_state::to_log_offset(
     model::offset search_start = std::max(
       std::max(hint, data_offset), min_log_offset);
 
-    // We iterate over the intervals (beginning exclusive, end inclusive)
-    // with constant delta, starting at the interval containing
-    // log offset equal to `data_offset` (because log offset is at least as
-    // big as data offset) and stopping when we find the interval where
-    // given data offset is achievable.
-    auto interval_end_it = _last_offset2batch.lower_bound(search_start);
+    // The intervals (beginning exclusive, end inclusive) with constant delta
+    // start at the interval containing log offset equal to `data_offset`
+    // (because log offset is at least as big as data offset). Each interval
+    // holds zero or more data records, so the largest data offset before each
+    // following non-data batch never decreases, and the interval where the
+    // given data offset is achievable is found by binary search: it ends at
+    // the first batch before which the data offset has been reached.
+    auto first = lower_bound(search_start);
     vassert(
-      interval_end_it != _last_offset2batch.begin(),
+      first != _batches.begin(),
       "ntp {}: log offset search start too small: {}",
       _ntp,
       search_start);
-    auto delta = std::prev(interval_end_it)->second.next_delta;
-
-    while (interval_end_it != _last_offset2batch.end()) {
+    auto interval_end_it = first;
+    auto count = std::distance(first, _batches.end());
+    while (count > 0) {
+        auto step = count / 2;
+        auto mid = std::next(interval_end_it, step);
         model::offset max_do_this_interval
-          = model::prev_offset(interval_end_it->second.base_offset)
-            - model::offset{delta};
-        if (max_do_this_interval >= data_offset) {
-            break;
+          = model::prev_offset(mid->base_offset)
+            - model::offset{std::prev(mid)->next_delta};
+        if (max_do_this_interval < data_offset) {
+            interval_end_it = std::next(mid);
+            count -= step + 1;
+        } else {
+            count = step;
         }
-
-        delta = interval_end_it->second.next_delta;
-        ++interval_end_it;
     }
 
-    return data_offset + model::offset(delta);
+    return data_offset + model::offset(std::prev(interval_end_it)->next_delta);
 }
 
 int64_t offset_translator_state::last_delta() const {
-    vassert(
-      !_last_offset2batch.empty(),
-      "ntp {}: offsets map shouldn't be empty",
-      _ntp);
+    vassert(!_batches.empty(), "ntp {}: offsets map shouldn't be empty", _ntp);
 
-    return _last_offset2batch.rbegin()->second.next_delta;
+    return _batches.back().next_delta;
 }
 
 model::offset offset_translator_state::last_gap_offset() const {
-    vassert(
-      !_last_offset2batch.empty(),
-      "ntp {}: offsets map shouldn't be empty",
-      _ntp);
+    vassert(!_batches.empty(), "ntp {}: offsets map shouldn't be empty", _ntp);
 
-    return _last_offset2batch.rbegin()->first;
+    return _batches.back().last_offset;
 }
 
 void offset_translator_state::add_gap(
   model::offset base_offset, model::offset last_offset) {
-    vassert(
-      !_last_offset2batch.empty(),
-      "ntp {}: offsets map shouldn't be empty",
-      _ntp);
+    vassert(!_batches.empty(), "ntp {}: offsets map shouldn't be empty", _ntp);
 
-    if (last_offset < _last_offset2batch.begin()->first) {
+    if (last_offset < _batches.front().last_offset) {
         // The gap is added before the
         vlog(
           stlog.error,
@@ -169,20 +202,18 @@ void offset_translator_state::add_gap(
           _ntp,
           base_offset,
           last_offset,
-          _last_offset2batch.begin()->first);
+          _batches.front().last_offset);
         return;
     }
-    auto rbegin = _last_offset2batch.rbegin();
+    const auto& back = _batches.back();
     int64_t length = last_offset() - base_offset() + 1;
-    int64_t next_delta = rbegin->second.next_delta + length;
-
-    if (base_offset <= rbegin->first) {
-        auto it = _last_offset2batch.find(last_offset);
-        if (
-          it == _last_offset2batch.end()
-          || it->second.base_offset != base_offset) {
-            // If the gap is added second time it should match
-            // the existing one.
+    int64_t next_delta = back.next_delta + length;
+
+    if (base_offset <= back.last_offset) {
+        auto it = lower_bound(last_offset);
+        if (it == _batches.end() || base_offset < it->base_offset) {
+            // If the gap is added second time it should match the existing
+            // one, or be part of a run of batches it was merged into.
             throw std::runtime_error(fmt_with_ctx(
               fmt::format,
               "ntp {}: inconsistent add_gap: {}-{}, next gap offset: {}, next "
@@ -190,8 +221,8 @@ void offset_translator_state::add_gap(
               _ntp,
               base_offset,
               last_offset,
-              rbegin->second.base_offset,
-              rbegin->second.next_delta));
+              back.base_offset,
+              back.next_delta));
         }
         return;
     }
@@ -202,9 +233,10 @@ void offset_translator_state::add_gap(
       base_offset,
       last_offset,
       next_delta);
-    _last_offset2batch.emplace(
-      last_offset,
-      batch_info{.base_offset = base_offset, .next_delta = next_delta});
+    append(batch_info{
+      .base_offset = base_offset,
+      .last_offset = last_offset,
+      .next_delta = next_delta});
 }
 
 bool offset_translator_state::add_absolute_delta(
@@ -220,12 +252,12 @@ bool offset_translator_state::add_absolute_delta(
     // Remove all overlapping elements
     auto gap_end = model::prev_offset(offset);
     auto gap_length = delta;
-    auto it = _last_offset2batch.upper_bound(gap_end);
+    auto it = upper_bound(gap_end);
     // Add new element if empty or delta is different
     model::offset gap_begin = offset - model::offset(delta);
-    if (it != _last_offset2batch.begin()) {
+    if (it != _batches.begin()) {
         auto back_it = std::prev(it);
-        gap_length -= back_it->second.next_delta;
+        gap_length -= back_it->next_delta;
         gap_begin = offset - model::offset(gap_length);
         if (gap_length < 0) {
             // gap is inconsistent and will overlap with the previous
@@ -238,53 +270,51 @@ bool offset_translator_state::add_absolute_delta(
               _ntp,
               offset,
               delta,
-              back_it->first,
-              back_it->second.next_delta,
-              back_it->second.base_offset,
+              back_it->last_offset,
+              back_it->next_delta,
+              back_it->base_offset,
               gap_length));
         }
     }
-    _last_offset2batch.erase(it, _last_offset2batch.end());
-    if (gap_length > 0 || _last_offset2batch.empty()) {
-        _last_offset2batch.emplace(
-          gap_end, batch_info{.base_offset = gap_begin, .next_delta = delta});
+    _batches.erase(it, _batches.end());
+    if (gap_length > 0 || _batches.empty()) {
+        if (_batches.empty() || _batches.back().last_offset < gap_end) {
+            _batches.push_back(batch_info{
+              .base_offset = gap_begin,
+              .last_offset = gap_end,
+              .next_delta = delta});
+        }
         return true;
     }
     return false;
 }
 
-void offset_translator_state::reset() { _last_offset2batch.clear(); }
+void offset_translator_state::reset() { _batches.clear(); }
 
 bool offset_translator_state::truncate(model::offset offset) {
-    vassert(
-      !_last_offset2batch.empty(),
-      "ntp {}: offsets map shouldn't be empty",
-      _ntp);
+    vassert(!_batches.empty(), "ntp {}: offsets map shouldn't be empty", _ntp);
 
-    auto it = _last_offset2batch.lower_bound(offset);
-    if (it == _last_offset2batch.begin()) {
+    auto it = lower_bound(offset);
+    if (it == _batches.begin()) {
         throw std::runtime_error{fmt::format(
           "ntp {}: trying to truncate offset_translator at offset {} which "
           "is "
           "<= base translation offset {}",
           _ntp,
           offset,
-          _last_offset2batch.begin()->first)};
+          _batches.front().last_offset)};
     }
 
-    if (it != _last_offset2batch.end()) {
-        if (offset > it->second.base_offset) {
-            throw std::runtime_error{fmt::format(
-              "ntp {}: trying to truncate offset_translator at offset {} "
-              "which "
-              "is in the middle of the batch [{},{}]",
-              _ntp,
-              offset,
-              it->second.base_offset,
-              it->first)};
+    if (it != _batches.end()) {
+        if (offset > it->base_offset) {
+            // The offset is in the middle of a run of merged batches, at the
+            // start of one of them: keep the part of the run before it.
+            it->next_delta -= it->last_offset - offset + 1;
+            it->last_offset = model::prev_offset(offset);
+            ++it;
         }
 
-        _last_offset2batch.erase(it, _last_offset2batch.end());
+        _batches.erase(it, _batches.end());
         return true;
     }
 
@@ -292,36 +322,48 @@ bool offset_translator_state::truncate(model::offset offset) {
 }
 
 bool offset_translator_state::prefix_truncate(model::offset offset) {
-    vassert(
-      !_last_offset2batch.empty(),
-      "ntp {}: offsets map shouldn't be empty",
-      _ntp);
+    vassert(!_batches.empty(), "ntp {}: offsets map shouldn't be empty", _ntp);
 
-    auto it = _last_offset2batch.upper_bound(offset);
-    if (it != _last_offset2batch.end() && offset >= it->second.base_offset) {
-        throw std::runtime_error{fmt::format(
-          "ntp {}: trying to prefix truncate offset translator at offset "
-          "{} "
-          "which is in the middle of the batch {}-{}",
-          _ntp,
-          offset,
-          it->second.base_offset,
-          it->first)};
+    auto it = upper_bound(offset);
+    if (it != _batches.end() && offset >= it->base_offset) {
+        if (it == _batches.begin()) {
+            throw std::runtime_error{fmt::format(
+              "ntp {}: trying to prefix truncate offset translator at offset "
+              "{} "
+              "which is in the middle of the batch {}-{}",
+              _ntp,
+              offset,
+              it->base_offset,
+              it->last_offset)};
+        }
+        // The offset is in the middle of a run of merged batches, at the end
+        // of one of them: the part of the run up to the offset moves into the
+        // base element.
+        auto base_batch = batch_info{
+          .base_offset = offset,
+          .last_offset = offset,
+          .next_delta = std::prev(it)->next_delta
+                        + (offset - it->base_offset + 1)};
+        it->base_offset = model::next_offset(offset);
+        _batches.erase(_batches.begin(), it);
+        _batches.push_front(base_batch);
+        return true;
     }
 
-    if (it == _last_offset2batch.begin()) {
+    if (it == _batches.begin()) {
         return false;
     }
 
     auto prev_it = std::prev(it);
-    if (prev_it == _last_offset2batch.begin() && prev_it->first == offset) {
+    if (prev_it == _batches.begin() && prev_it->last_offset == offset) {
         return false;
     }
 
-    auto base_batch = prev_it->second;
+    auto base_batch = *prev_it;
     base_batch.base_offset = offset;
-    _last_offset2batch.erase(_last_offset2batch.begin(), it);
-    _last_offset2batch.emplace(offset, base_batch);
+    base_batch.last_offset = offset;
+    _batches.erase(_batches.begin(), it);
+    _batches.push_front(base_batch);
     return true;
 }
 
@@ -355,21 +397,18 @@ struct persisted_batches_map
 } // namespace
 
 iobuf offset_translator_state::serialize_map() const {
-    vassert(
-      !_last_offset2batch.empty(),
-      "ntp {}: offsets map shouldn't be empty",
-      _ntp);
+    vassert(!_batches.empty(), "ntp {}: offsets map shouldn't be empty", _ntp);
 
     chunked_vector<persisted_batch> batches;
-    batches.reserve(_last_offset2batch.size());
-    for (const auto& [o, b] : _last_offset2batch) {
-        int32_t length = int32_t(o - b.base_offset) + 1;
+    batches.reserve(_batches.size());
+    for (const auto& b : _batches) {
+        int32_t length = int32_t(b.last_offset - b.base_offset) + 1;
         batches.push_back(
           persisted_batch{.base_offset = b.base_offset, .length = length});
     }
 
     persisted_batches_map persisted{
-      .start_delta = _last_offset2batch.begin()->second.next_delta,
+      .start_delta = _batches.front().next_delta,
       .batches = std::move(batches),
     };
 
@@ -384,7 +423,7 @@ offset_translator_state::from_serialized_map(model::ntp ntp, iobuf buf) {
           "ntp {}: persisted offset translator map shouldn't be empty", ntp)};
     }
 
-    absl::btree_map<model::offset, batch_info> last_offset2batch;
+    offset_translator_state state(std::move(ntp));
     int64_t cur_delta = persisted.start_delta;
     model::offset prev_last_offset;
     for (auto it = persisted.batches.begin(); it != persisted.batches.end();
@@ -395,7 +434,7 @@ offset_translator_state::from_serialized_map(model::ntp ntp, iobuf buf) {
                 throw std::runtime_error{fmt::format(
                   "ntp {}: inconsistency in serialized offset translator "
                   "state: offset {} is after {}",
-                  ntp,
+                  state._ntp,
                   b.base_offset,
                   prev_last_offset)};
             }
@@ -403,14 +442,14 @@ offset_translator_state::from_serialized_map(model::ntp ntp, iobuf buf) {
         }
 
         model::offset last_offset = b.base_offset + model::offset{b.length - 1};
-        last_offset2batch.emplace(
-          last_offset,
-          batch_info{.base_offset = b.base_offset, .next_delta = cur_delta});
+        // maps persisted before adjacent batches were merged get merged here
+        state.append(batch_info{
+          .base_offset = b.base_offset,
+          .last_offset = last_offset,
+          .next_delta = cur_delta});
         prev_last_offset = last_offset;
     }
 
-    offset_translator_state state(std::move(ntp));
-    state._last_offset2batch = std::move(last_offset2batch);
     return state;
 }
 
@@ -418,23 +457,25 @@ offset_translator_state offset_translator_state::from_bootstrap_state(
   model::ntp ntp, const absl::btree_map<model::offset, int64_t>& offset2delta) {
     offset_translator_state state(std::move(ntp));
     for (const auto& [o, d] : offset2delta) {
-        state._last_offset2batch.emplace(
-          o, batch_info{.base_offset = o, .next_delta = d});
+        // not merged: the delta may grow by more than the batch length, as
+        // the non-data batches in between aren't known
+        state._batches.push_back(
+          batch_info{.base_offset = o, .last_offset = o, .next_delta = d});
     }
     return state;
 }
 
 std::ostream&
 operator<<(std::ostream& os, const offset_translator_state& state) {
-    const auto& map = state._last_offset2batch;
+    const auto& batches = state._batches;
 
-    if (map.empty()) {
+    if (batches.empty()) {
         return os << "{empty}";
     }
 
-    return os << "{base offset/delta: " << map.begin()->first << "/"
-              << map.begin()->second.next_delta << ", map size: " << map.size()
-              << ", last delta: " << map.rbegin()->second.next_delta << "}";
+    return os << "{base offset/delta: " << batches.front().last_offset << "/"
+              << batches.front().next_delta << ", map size: " << batches.size()
+              << ", last delta: " << batches.back().next_delta << "}";
 }
 
 } // namespace storage
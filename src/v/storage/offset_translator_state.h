@@ -16,6 +16,8 @@
 
 #include <absl/container/btree_map.h>
 
+#include <deque>
+
 namespace storage {
 
 /// Provides offset translation between raw log offsets and offsets not counting
@@ -25,9 +27,9 @@ namespace storage {
 /// for these batches to occupy offset space (see
 /// https://github.com/redpanda-data/redpanda/issues/1184 for details).
 ///
-/// It works by maintaining an in-memory map of all filtered batch offsets.
-/// This map allows us to quickly find a delta between the raw log offset and
-/// corresponding translated offset.
+/// It works by maintaining an in-memory sorted sequence of all filtered batch
+/// offsets, in which runs of adjacent filtered batches are merged into one
+/// entry. Both translation directions are binary searches over it.
 class offset_translator_state {
 public:
     /// Create an empty translator - the delta between log and kafka offsets is
@@ -40,9 +42,10 @@ public:
     offset_translator_state(
       model::ntp ntp, model::offset base_offset, int64_t base_delta)
       : _ntp(std::move(ntp)) {
-        _last_offset2batch.emplace(
-          base_offset,
-          batch_info{.base_offset = base_offset, .next_delta = base_delta});
+        _batches.push_back(batch_info{
+          .base_offset = base_offset,
+          .last_offset = base_offset,
+          .next_delta = base_delta});
     }
 
     offset_translator_state(const offset_translator_state&) = delete;
@@ -52,7 +55,7 @@ public:
 
     const model::ntp& ntp() const { return _ntp; }
 
-    bool empty() const { return _last_offset2batch.empty(); }
+    bool empty() const { return _batches.empty(); }
 
     /// Difference between the log offset and the kafka offset.
     int64_t delta(model::offset) const;
@@ -105,29 +108,41 @@ public:
     operator<<(std::ostream&, const offset_translator_state&);
 
 private:
-    // Represents a non-data batch in the log - a batch that contributes to the
-    // difference (aka delta) between log (redpanda) and data (kafka) offset.
+    // Represents a run of adjacent non-data batches in the log - batches that
+    // contribute to the difference (aka delta) between log (redpanda) and data
+    // (kafka) offset.
     struct batch_info {
         model::offset base_offset;
+        model::offset last_offset;
         // The difference between log and data offsets that we want to find by
-        // querying the offset translator. `next_delta` of a _last_offset2batch
-        // map element is active for log offsets in the interval (last offset;
-        // next last offset] (left end exclusive, right end inclusive).
+        // querying the offset translator. `next_delta` of a _batches element
+        // is active for log offsets in the interval (last offset; next last
+        // offset] (left end exclusive, right end inclusive).
         int64_t next_delta;
     };
 
-    // Map from the last offset of non-data batches to the corresponding batch
-    // info.
+    // Non-data batches ordered by last offset.
     //
-    // As prefix truncations happen, we remove elements with keys less than
-    // log_start and substitute them with a single element with the key
-    // prev_offset(log_start) and next_delta equal to delta(log_start) - this
-    // way we can calculate delta for any offset starting from log_start.
-    using batches_map_t = absl::btree_map<model::offset, batch_info>;
+    // As prefix truncations happen, we remove elements with last offsets less
+    // than log_start and substitute them with a single element with the last
+    // offset prev_offset(log_start) and next_delta equal to delta(log_start) -
+    // this way we can calculate delta for any offset starting from log_start.
+    // That first element is never merged with the batches following it.
+    using batches_t = std::deque<batch_info>;
+
+    /// First element with a last offset not less than (lower_bound) or
+    /// greater than (upper_bound) the offset.
+    batches_t::iterator lower_bound(model::offset);
+    batches_t::const_iterator lower_bound(model::offset) const;
+    batches_t::iterator upper_bound(model::offset);
+
+    /// Appends a run of non-data batches, merging it into the last element if
+    /// the two are adjacent.
+    void append(batch_info);
 
 private:
     model::ntp _ntp;
-    batches_map_t _last_offset2batch;
+    batches_t _batches;
 };
 
 } // namespace storage
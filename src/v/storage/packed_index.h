@@ -0,0 +1,201 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "base/vassert.h"
+#include "container/fragmented_vector.h"
+#include "utils/delta_for.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace storage {
+
+/*
+ * An immutable column of integers packed in rows of 16 values with the
+ * delta-FOR codec from utils/delta_for.h.
+ *
+ * The last value of every packed row is also kept unpacked in a contiguous
+ * fence array, and values that don't fill a final row are kept unpacked in a
+ * tail. A search binary searches the fence to select a single row, and then
+ * decodes and scans only that row. The row scan is a branch-free count over
+ * a fixed size array which the compiler vectorizes.
+ *
+ * Searches assume the column is sorted, as do the searches of the unpacked
+ * columns in index_state.
+ */
+template<typename T, typename Delta>
+class packed_index_column {
+    static constexpr size_t row_width = details::FOR_buffer_depth;
+    using encoder_t = deltafor_encoder<int64_t, Delta>;
+    using decoder_t = deltafor_decoder<int64_t, Delta>;
+    using row_t = std::array<int64_t, row_width>;
+
+public:
+    explicit packed_index_column(const fragmented_vector<T>& values)
+      : _size(values.size()) {
+        const auto rows = values.size() / row_width;
+        _fence.reserve(rows);
+        _row_offset.reserve(rows);
+
+        encoder_t enc(0);
+        auto it = values.begin();
+        for (size_t r = 0; r < rows; ++r) {
+            row_t row;
+            for (auto& v : row) {
+                v = static_cast<int64_t>(*it++);
+            }
+            _row_offset.push_back(enc.get_position().offset);
+            enc.add(row);
+            _fence.push_back(static_cast<T>(row.back()));
+        }
+        _tail.assign(it, values.end());
+
+        // the encoder grows its buffer while appending, so keep a tightly
+        // sized copy of the encoded data.
+        _encoder = encoder_t(
+          0, enc.get_row_count(), enc.get_last_value(), enc.copy());
+    }
+
+    packed_index_column(packed_index_column&&) noexcept = default;
+    packed_index_column& operator=(packed_index_column&&) noexcept = default;
+    packed_index_column(const packed_index_column&) = delete;
+    packed_index_column& operator=(const packed_index_column&) = delete;
+    ~packed_index_column() noexcept = default;
+
+    size_t size() const { return _size; }
+
+    T operator[](size_t i) const {
+        const auto r = i / row_width;
+        if (r == _fence.size()) {
+            return _tail[i - r * row_width];
+        }
+        return static_cast<T>(decode_row(r)[i % row_width]);
+    }
+
+    /// Index of the first value not less than \p v, or size() if none.
+    size_t lower_bound(T v) const {
+        return search(v, [](T a, T b) { return a < b; });
+    }
+
+    /// Index of the first value greater than \p v, or size() if none.
+    size_t upper_bound(T v) const {
+        return search(v, [](T a, T b) { return a <= b; });
+    }
+
+    fragmented_vector<T> unpack() const {
+        fragmented_vector<T> ret;
+        decoder_t dec(
+          _encoder.get_initial_value(),
+          _encoder.get_row_count(),
+          _encoder.share());
+        row_t row;
+        while (dec.read(row)) {
+            for (auto v : row) {
+                ret.push_back(static_cast<T>(v));
+            }
+        }
+        for (auto v : _tail) {
+            ret.push_back(v);
+        }
+        return ret;
+    }
+
+    /// Approximate memory used by the column, in bytes.
+    size_t memory_usage() const {
+        return _encoder.mem_use() + _fence.capacity() * sizeof(T)
+               + _row_offset.capacity() * sizeof(uint32_t)
+               + _tail.capacity() * sizeof(T);
+    }
+
+private:
+    /*
+     * Returns the number of leading values for which `before(value, v)` is
+     * true. `before` must be consistent with the order of the column.
+     */
+    template<typename Before>
+    size_t search(T v, Before before) const {
+        // rows are selected by their last value
+        auto it = std::partition_point(
+          _fence.begin(), _fence.end(), [&](T f) { return before(f, v); });
+        if (it == _fence.end()) {
+            auto n = count(_tail.begin(), _tail.end(), v, before);
+            return _fence.size() * row_width + n;
+        }
+        const auto r = static_cast<size_t>(std::distance(_fence.begin(), it));
+        const auto row = decode_row(r);
+        return r * row_width
+               + count(row.begin(), row.end(), static_cast<int64_t>(v), before);
+    }
+
+    template<typename It, typename V, typename Before>
+    static size_t count(It begin, It end, V v, Before before) {
+        size_t n = 0;
+        for (auto it = begin; it != end; ++it) {
+            n += before(static_cast<T>(*it), static_cast<T>(v)) ? 1 : 0;
+        }
+        return n;
+    }
+
+    row_t decode_row(size_t r) const {
+        vassert(r < _fence.size(), "Row {} out of range {}", r, _fence.size());
+        decoder_t dec(
+          _encoder.get_initial_value(),
+          _encoder.get_row_count(),
+          _encoder.share());
+        if (r > 0) {
+            dec.skip(deltafor_stream_pos_t<int64_t>{
+              .initial = static_cast<int64_t>(_fence[r - 1]),
+              .offset = _row_offset[r],
+              .num_rows = static_cast<uint32_t>(r),
+            });
+        }
+        row_t row{};
+        dec.read(row);
+        return row;
+    }
+
+    size_t _size;
+    encoder_t _encoder;
+    std::vector<T> _fence;
+    std::vector<uint32_t> _row_offset;
+    std::vector<T> _tail;
+};
+
+/*
+ * Packed form of the entry columns of an index_state. Offsets and file
+ * positions are non-decreasing and use delta-delta encoding, while time
+ * deltas may go backwards and use xor encoding.
+ */
+struct packed_index {
+    using offset_column
+      = packed_index_column<uint32_t, details::delta_delta<int64_t>>;
+    using time_column = packed_index_column<uint32_t, details::delta_xor>;
+    using position_column
+      = packed_index_column<uint64_t, details::delta_delta<int64_t>>;
+
+    offset_column relative_offset_index;
+    time_column relative_time_index;
+    position_column position_index;
+
+    size_t size() const { return relative_offset_index.size(); }
+
+    size_t memory_usage() const {
+        return relative_offset_index.memory_usage()
+               + relative_time_index.memory_usage()
+               + position_index.memory_usage();
+    }
+};
+
+} // namespace storage
@@ -0,0 +1,77 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "config/configuration.h"
+#include "io/page_cache.h"
+#include "io/pager.h"
+#include "io/persistence.h"
+#include "io/scheduler.h"
+
+#include <filesystem>
+#include <memory>
+
+namespace storage::internal {
+
+/**
+ * Shard-local state backing the experimental paged segment read path (see
+ * `storage_page_cache_enabled`).
+ *
+ * Every segment_reader on the core shares a single page cache and I/O
+ * scheduler. The scheduler bounds the number of segment files held open for
+ * reading, and the page cache bounds the memory used for resident pages.
+ */
+class paging_context {
+public:
+    paging_context(size_t cache_size, size_t max_open_files)
+      : _cache(experimental::io::page_cache::config{
+        .cache_size = cache_size, .small_size = cache_size / 10})
+      , _scheduler(max_open_files) {}
+
+    paging_context(paging_context&&) = delete;
+    paging_context& operator=(paging_context&&) = delete;
+    paging_context(const paging_context&) = delete;
+    paging_context& operator=(const paging_context&) = delete;
+    ~paging_context() noexcept = default;
+
+    /// Create a pager for the segment file at \p path.
+    std::unique_ptr<experimental::io::pager>
+    make_pager(std::filesystem::path path) {
+        return std::make_unique<experimental::io::pager>(
+          std::move(path), &_storage, &_cache, &_scheduler);
+    }
+
+    const experimental::io::page_cache& cache() const { return _cache; }
+
+private:
+    experimental::io::disk_persistence _storage;
+    experimental::io::page_cache _cache;
+    experimental::io::scheduler _scheduler;
+};
+
+/**
+ * Returns the shard-local paging context, or nullptr if the paged read path
+ * is disabled. The setting requires a restart, so it's read once per shard.
+ */
+inline paging_context* paging() {
+    static thread_local std::unique_ptr<paging_context> ctx = [] {
+        const auto& cfg = config::shard_local_cfg();
+        if (!cfg.storage_page_cache_enabled()) {
+            return std::unique_ptr<paging_context>();
+        }
+        return std::make_unique<paging_context>(
+          cfg.storage_page_cache_size(),
+          cfg.storage_page_cache_max_open_files());
+    }();
+    return ctx.get();
+}
+
+} // namespace storage::internal
@@ -15,6 +15,7 @@
 #include "model/record.h"
 #include "model/record_utils.h"
 #include "reflection/adl.h"
+#include "storage/compression_offload.h"
 #include "storage/logger.h"
 
 #include <seastar/core/byteorder.hh>
@@ -33,7 +34,28 @@ model::record_batch_reader decompress_batch_consumer::end_of_stream() {
     return model::make_memory_record_batch_reader(std::move(_batches));
 }
 
+static model::record_batch
+make_decompressed_batch(model::record_batch_header h, iobuf body_buf) {
+    // must remove compression first!
+    h.attrs.remove_compression();
+    reset_size_checksum_metadata(h, body_buf);
+    return model::record_batch(
+      h, std::move(body_buf), model::record_batch::tag_ctor_ng{});
+}
+
+static ss::future<model::record_batch> offloaded_decompress_batch(
+  compression_offload& offload, model::record_batch b) {
+    auto body_buf = co_await offload.uncompress(
+      b.data(), b.header().attrs.compression());
+    co_return make_decompressed_batch(b.header(), std::move(body_buf));
+}
+
 ss::future<model::record_batch> decompress_batch(model::record_batch&& b) {
+    if (auto* offload = compression_offload::local();
+        offload && b.compressed()
+        && offload->should_offload(b.data().size_bytes())) {
+        return offloaded_decompress_batch(*offload, std::move(b));
+    }
     return ss::futurize_invoke(decompress_batch_sync, std::move(b));
 }
 
@@ -58,13 +80,7 @@ model::record_batch maybe_decompress_batch_sync(const model::record_batch& b) {
     }
     iobuf body_buf = compression::compressor::uncompress(
       b.data(), b.header().attrs.compression());
-    // must remove compression first!
-    auto h = b.header();
-    h.attrs.remove_compression();
-    reset_size_checksum_metadata(h, body_buf);
-    auto batch = model::record_batch(
-      h, std::move(body_buf), model::record_batch::tag_ctor_ng{});
-    return batch;
+    return make_decompressed_batch(b.header(), std::move(body_buf));
 }
 
 compress_batch_consumer::compress_batch_consumer(
@@ -98,8 +114,15 @@ compress_batch(model::compression c, model::record_batch b) {
         co_return b;
     }
     auto h = b.header();
-    auto payload = co_await compression::stream_compressor::compress(
-      std::move(b).release_data(), c);
+    auto data = std::move(b).release_data();
+    iobuf payload;
+    if (auto* offload = compression_offload::local();
+        offload && offload->should_offload(data.size_bytes())) {
+        payload = co_await offload->compress(data, c);
+    } else {
+        payload = co_await compression::stream_compressor::compress(
+          std::move(data), c);
+    }
     // compression bit must be set first!
     h.attrs |= c;
     reset_size_checksum_metadata(h, payload);
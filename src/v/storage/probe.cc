@@ -11,6 +11,8 @@
 
 #include "config/configuration.h"
 #include "prometheus/prometheus_sanitize.h"
+#include "storage/batch_cache_probe.h"
+#include "storage/reader_handle_cache.h"
 #include "storage/readers_cache_probe.h"
 #include "storage/segment.h"
 
@@ -147,11 +149,56 @@ void probe::setup_metrics(const model::ntp& ntp) {
           [this] { return _segment_compacted; },
           sm::description("Number of compacted segments"),
           labels),
+        sm::make_counter(
+          "key_filter_skipped_segments",
+          [this] { return _segments_skipped_by_key_filter; },
+          sm::description("Number of segments that compaction skipped because "
+                          "their key filter shared no keys with the key map"),
+          labels),
         sm::make_gauge(
           "partition_size",
           [this] { return _partition_bytes; },
           sm::description("Current size of partition in bytes"),
           labels),
+        sm::make_gauge(
+          "dirty_segment_bytes",
+          [this] { return _dirty_segment_bytes; },
+          sm::description("Bytes in closed segments of a compacted log written "
+                          "since the log was last compacted"),
+          labels),
+        sm::make_gauge(
+          "recovery_open_segments_ms",
+          [this] { return _recovery.open_segments.count(); },
+          sm::description("Time spent opening segments during log recovery"),
+          labels),
+        sm::make_gauge(
+          "recovery_materialize_index_ms",
+          [this] { return _recovery.materialize_indices.count(); },
+          sm::description(
+            "Time spent loading segment indices during log recovery"),
+          labels),
+        sm::make_gauge(
+          "recovery_replay_ms",
+          [this] { return _recovery.replay_segments.count(); },
+          sm::description("Time spent replaying segments during log recovery"),
+          labels),
+        sm::make_gauge(
+          "recovery_segments_replayed",
+          [this] { return _recovery.segments_replayed; },
+          sm::description("Number of segments replayed during log recovery"),
+          labels),
+        sm::make_gauge(
+          "recovery_replayed_bytes",
+          [this] { return _recovery.bytes_replayed; },
+          sm::description("Number of bytes replayed during log recovery"),
+          labels),
+        sm::make_gauge(
+          "recovery_clean_segments_skipped",
+          [this] { return _recovery.clean_segments_skipped; },
+          sm::description(
+            "Number of segments not replayed during log recovery because they "
+            "were cleanly closed"),
+          labels),
       },
       {},
       {sm::shard_label, partition_label});
@@ -168,6 +215,36 @@ void probe::setup_metrics(const model::ntp& ntp) {
           labels)
           .aggregate({sm::shard_label}),
       });
+
+    _sample_interval
+      = config::shard_local_cfg().storage_latency_sample_interval();
+    if (_sample_interval == 0) {
+        return;
+    }
+    // per topic, unless metrics aggregation is disabled
+    _metrics.add_group(
+      group_name,
+      {
+        sm::make_histogram(
+          "append_latency_us",
+          [this] { return _append_latency.hist.internal_histogram_logform(); },
+          sm::description("Latency of a sample of batch appends"),
+          labels),
+        sm::make_histogram(
+          "flush_latency_us",
+          [this] { return _flush_latency.hist.internal_histogram_logform(); },
+          sm::description("Latency of a sample of log flushes"),
+          labels),
+        sm::make_histogram(
+          "read_latency_us",
+          [this] { return _read_latency.hist.internal_histogram_logform(); },
+          sm::description(
+            "Latency of a sample of reads served from disk rather than the "
+            "batch cache"),
+          labels),
+      },
+      {},
+      {sm::shard_label, partition_label});
 }
 
 void probe::add_initial_segment(const segment& s) {
@@ -219,4 +296,109 @@ void readers_cache_probe::setup_metrics(const model::ntp& ntp) {
       {},
       {sm::shard_label, partition_label});
 }
+
+void batch_cache_probe::setup_metrics() {
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+    namespace sm = ss::metrics;
+
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("storage:batch_cache"),
+      {
+        sm::make_counter(
+          "hits",
+          [this] { return _hits; },
+          sm::description("Batch cache lookups that found a cached batch")),
+        sm::make_counter(
+          "misses",
+          [this] { return _misses; },
+          sm::description("Batch cache lookups that found no cached batch")),
+        sm::make_counter(
+          "small_queue_admissions",
+          [this] { return _small_admissions; },
+          sm::description(
+            "Ranges admitted to the probationary queue (s3_fifo policy)")),
+        sm::make_counter(
+          "main_queue_admissions",
+          [this] { return _main_admissions; },
+          sm::description("Ranges admitted directly to the main queue")),
+        sm::make_counter(
+          "ghost_hits",
+          [this] { return _ghost_hits; },
+          sm::description("Ranges admitted to the main queue because their "
+                          "data was recently released from the probationary "
+                          "queue (s3_fifo policy)")),
+        sm::make_counter(
+          "promotions",
+          [this] { return _promotions; },
+          sm::description("Ranges promoted from the probationary queue to "
+                          "the main queue (s3_fifo policy)")),
+      },
+      {},
+      {sm::shard_label});
+}
+
+void reader_handle_probe::setup_metrics(const reader_handle_cache& cache) {
+    // the cache is per shard and outlives any one log_manager
+    _metrics.clear();
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+    namespace sm = ss::metrics;
+
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("storage:reader_handles"),
+      {
+        sm::make_counter(
+          "opened",
+          [this] { return _opened; },
+          sm::description("Segment files opened for reading")),
+        sm::make_counter(
+          "reused",
+          [this] { return _reused; },
+          sm::description(
+            "Segment file reads served by an idle cached file handle")),
+        sm::make_counter(
+          "evicted",
+          [this] { return _evicted; },
+          sm::description(
+            "Idle segment file handles closed to stay within "
+            "storage_reader_handle_cache_size")),
+        sm::make_gauge(
+          "idle",
+          [&cache] { return cache.size(); },
+          sm::description("Idle segment file handles held open for reuse")),
+      },
+      {},
+      {sm::shard_label});
+}
+
+void flush_coordinator_probe::setup_metrics() {
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+    namespace sm = ss::metrics;
+
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("storage:flush_coordinator"),
+      {
+        sm::make_counter(
+          "requests",
+          [this] { return _requests; },
+          sm::description("Log flushes requested through the coordinator")),
+        sm::make_counter(
+          "segment_flushes",
+          [this] { return _segment_flushes; },
+          sm::description(
+            "Segment flushes issued, after coalescing requests for the same "
+            "segment")),
+        sm::make_counter(
+          "batches",
+          [this] { return _batches; },
+          sm::description("Windows of coalesced flushes issued")),
+      },
+      {},
+      {sm::shard_label});
+}
 } // namespace storage
@@ -15,11 +15,13 @@
 #include "storage/fwd.h"
 #include "storage/logger.h"
 #include "storage/types.h"
+#include "utils/log_hist.h"
 
 #include <seastar/core/metrics_registration.hh>
 #include <seastar/core/shared_ptr.hh>
 
 #include <cstdint>
+#include <memory>
 
 namespace storage {
 struct disk_metrics {
@@ -49,6 +51,50 @@ private:
     metrics::public_metric_groups _public_metrics;
 };
 
+// Per-shard probe of segment file handles opened for reading.
+class reader_handle_probe {
+public:
+    void handle_opened() { ++_opened; }
+    void handle_reused() { ++_reused; }
+    void handle_evicted() { ++_evicted; }
+
+    uint64_t opened() const { return _opened; }
+    uint64_t reused() const { return _reused; }
+    uint64_t evicted() const { return _evicted; }
+
+    void setup_metrics(const reader_handle_cache&);
+    void clear_metrics() { _metrics.clear(); }
+
+private:
+    uint64_t _opened = 0;
+    uint64_t _reused = 0;
+    uint64_t _evicted = 0;
+    metrics::internal_metric_groups _metrics;
+};
+
+// Per-shard statistics of the flush_coordinator.
+class flush_coordinator_probe {
+public:
+    void flush_requested() { ++_requests; }
+    void batch_dispatched(size_t segments) {
+        ++_batches;
+        _segment_flushes += segments;
+    }
+
+    uint64_t requests() const { return _requests; }
+    uint64_t segment_flushes() const { return _segment_flushes; }
+    uint64_t batches() const { return _batches; }
+
+    void setup_metrics();
+    void clear_metrics() { _metrics.clear(); }
+
+private:
+    uint64_t _requests = 0;
+    uint64_t _segment_flushes = 0;
+    uint64_t _batches = 0;
+    metrics::internal_metric_groups _metrics;
+};
+
 // Per-NTP probe.
 class probe {
 public:
@@ -86,6 +132,11 @@ public:
     void segment_compacted() { ++_segment_compacted; }
     auto get_segments_compacted() const { return _segment_compacted; }
 
+    void segment_skipped_by_key_filter() { ++_segments_skipped_by_key_filter; }
+    auto get_segments_skipped_by_key_filter() const {
+        return _segments_skipped_by_key_filter;
+    }
+
     void batch_write_error(const std::exception_ptr& e) {
         stlog.error("Error writing record batch {}", e);
         ++_batch_write_errors;
@@ -106,14 +157,41 @@ public:
     void add_initial_segment(const segment&);
     void remove_partition_bytes(size_t remove) { _partition_bytes -= remove; }
     void set_compaction_ratio(double r) { _compaction_ratio = r; }
+    void set_dirty_segment_bytes(uint64_t b) { _dirty_segment_bytes = b; }
 
     int64_t get_batch_parse_errors() const { return _batch_parse_errors; }
+
+    void set_recovery_stats(const log_recovery_stats& s) { _recovery = s; }
+    const log_recovery_stats& recovery_stats() const { return _recovery; }
+
+    /*
+     * Latency of one in every `storage_latency_sample_interval` appends,
+     * flushes and disk reads. The measurement records its latency when
+     * destroyed; operations that are not sampled get a null measurement.
+     */
+    using latency_measurement = std::unique_ptr<log_hist_internal::measurement>;
+    latency_measurement sample_append() { return sample(_append_latency); }
+    latency_measurement sample_flush() { return sample(_flush_latency); }
+    latency_measurement sample_read() { return sample(_read_latency); }
     /**
      * Clears all probe related metrics
      */
     void clear_metrics() { _metrics.clear(); }
 
 private:
+    struct sampled_latency {
+        log_hist_internal hist;
+        uint32_t ops{0};
+    };
+
+    latency_measurement sample(sampled_latency& l) {
+        if (_sample_interval == 0 || ++l.ops < _sample_interval) {
+            return nullptr;
+        }
+        l.ops = 0;
+        return l.hist.auto_measure();
+    }
+
     uint64_t _partition_bytes = 0;
     uint64_t _bytes_written = 0;
     uint64_t _bytes_read = 0;
@@ -124,6 +202,7 @@ private:
     uint64_t _cached_batches_read = 0;
 
     uint32_t _segment_compacted = 0;
+    uint32_t _segments_skipped_by_key_filter = 0;
     uint32_t _corrupted_compaction_index = 0;
     uint32_t _log_segments_created = 0;
     uint32_t _log_segments_removed = 0;
@@ -131,6 +210,13 @@ private:
     uint32_t _batch_parse_errors = 0;
     uint32_t _batch_write_errors = 0;
     double _compaction_ratio = 1.0;
+    uint64_t _dirty_segment_bytes = 0;
+    log_recovery_stats _recovery;
+    // zero until metrics are set up, so that nothing is sampled without them
+    uint32_t _sample_interval = 0;
+    sampled_latency _append_latency;
+    sampled_latency _flush_latency;
+    sampled_latency _read_latency;
     metrics::internal_metric_groups _metrics;
 };
 } // namespace storage
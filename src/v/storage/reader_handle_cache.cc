@@ -0,0 +1,60 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "storage/reader_handle_cache.h"
+
+#include "base/vlog.h"
+#include "config/configuration.h"
+#include "ssx/future-util.h"
+#include "storage/logger.h"
+
+namespace storage {
+
+bool reader_handle_cache::insert(segment_reader& reader) noexcept {
+    const auto capacity
+      = config::shard_local_cfg().storage_reader_handle_cache_size();
+    if (capacity == 0) {
+        // the limit may have been lowered to zero at runtime
+        evict(0);
+        return false;
+    }
+    vassert(!reader._idle_hook.is_linked(), "Double insert of {}", reader);
+    _lru.push_back(reader);
+    ++_size;
+    evict(capacity);
+    return true;
+}
+
+void reader_handle_cache::remove(segment_reader& reader) noexcept {
+    if (reader._idle_hook.is_linked()) {
+        reader._idle_hook.unlink();
+        --_size;
+    }
+}
+
+void reader_handle_cache::evict(size_t capacity) noexcept {
+    while (_size > capacity) {
+        auto& reader = _lru.front();
+        _lru.pop_front();
+        --_size;
+        _probe.handle_evicted();
+        vlog(stlog.debug, "Closing idle segment file {}", reader.path());
+        auto file = std::exchange(reader._data_file, ss::file{});
+        ssx::background = file.close().then_wrapped([file](ss::future<> f) {
+            if (f.failed()) {
+                vlog(
+                  stlog.warn,
+                  "Error closing idle segment file: {}",
+                  f.get_exception());
+            }
+        });
+    }
+}
+
+} // namespace storage
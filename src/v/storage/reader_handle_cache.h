@@ -0,0 +1,67 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "storage/probe.h"
+#include "storage/segment_reader.h"
+
+#include <cstddef>
+
+namespace storage {
+
+/**
+ * Per-shard LRU of idle segment file handles.
+ *
+ * A segment_reader opens its data file on demand. Once the last handle on
+ * the file is released, rather than closing the file the reader parks it
+ * here so that a later read can reuse it without another open. The cache
+ * is bounded by `storage_reader_handle_cache_size`: when it is exceeded the
+ * least recently used idle file is closed.
+ */
+class reader_handle_cache {
+public:
+    reader_handle_cache() = default;
+    reader_handle_cache(reader_handle_cache&&) = delete;
+    reader_handle_cache& operator=(reader_handle_cache&&) = delete;
+    reader_handle_cache(const reader_handle_cache&) = delete;
+    reader_handle_cache& operator=(const reader_handle_cache&) = delete;
+    ~reader_handle_cache() noexcept = default;
+
+    /// Park the idle file of \p reader. Returns false if caching is disabled,
+    /// in which case the caller should close the file itself.
+    bool insert(segment_reader& reader) noexcept;
+
+    /// Take the idle file of \p reader out of the cache for reuse.
+    void remove(segment_reader& reader) noexcept;
+
+    size_t size() const { return _size; }
+
+    reader_handle_probe& probe() { return _probe; }
+
+private:
+    void evict(size_t capacity) noexcept;
+
+    intrusive_list<segment_reader, &segment_reader::_idle_hook> _lru;
+    size_t _size{0};
+    reader_handle_probe _probe;
+};
+
+namespace internal {
+
+/// Returns the shard-local cache of idle segment file handles.
+inline reader_handle_cache& reader_handles() {
+    static thread_local reader_handle_cache cache;
+    return cache;
+}
+
+} // namespace internal
+
+} // namespace storage
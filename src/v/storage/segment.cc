@@ -15,10 +15,13 @@
 #include "config/configuration.h"
 #include "ssx/future-util.h"
 #include "storage/compacted_index_writer.h"
+#include "storage/compaction_key_filter.h"
+#include "storage/decompression_cache.h"
 #include "storage/file_sanitizer.h"
 #include "storage/fs_utils.h"
 #include "storage/fwd.h"
 #include "storage/logger.h"
+#include "storage/paging.h"
 #include "storage/parser_utils.h"
 #include "storage/readers_cache.h"
 #include "storage/segment_appender_utils.h"
@@ -40,6 +43,7 @@
 #include <optional>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 namespace storage {
 
@@ -120,6 +124,10 @@ ss::future<usage> segment::persistent_size() {
      */
     if (!_appender && _data_disk_usage_size.has_value()) {
         u.data = _data_disk_usage_size.value();
+    } else if (is_cold()) {
+        // the data file is on the cold directory, and does not count
+        // against the space of the data directory
+        _data_disk_usage_size = 0;
     } else {
         try {
             _data_disk_usage_size = co_await ss::file_size(
@@ -165,6 +173,9 @@ segment::remove_persistent_state(std::filesystem::path path) {
     }
 
     try {
+        if (co_await _resources.unlinker().remove(path, file_size)) {
+            co_return file_size;
+        }
         co_await ss::remove_file(path.c_str());
         vlog(stlog.debug, "removed: {} size {}", path, file_size);
         co_return file_size;
@@ -193,22 +204,40 @@ ss::future<size_t> segment::remove_persistent_state() {
     clear_cached_disk_usage();
 
     /*
-     * the compaction index is included in the removal list, even if the topic
-     * isn't compactible, because compaction can be enabled or disabled at
-     * runtime. if the index doesn't exist, it's silently ignored.
+     * the compaction index and key filter are included in the removal list,
+     * even if the topic isn't compactible, because compaction can be enabled
+     * or disabled at runtime. if they don't exist, they're silently ignored.
      */
-    const auto rm = std::to_array<std::filesystem::path>({
-      reader().path(),
+    std::vector<std::filesystem::path> rm = {
       index().path(),
       reader().path().to_compacted_index(),
-    });
+      reader().path().to_key_filter(),
+    };
+
+    size_t recycled = 0;
+    if (auto cold = release_cold_path(); cold) {
+        // only a link lives next to the index. it is removed before the file
+        // it points to, which is never recycled across directories
+        try {
+            co_await ss::remove_file(reader().path().string());
+        } catch (const std::exception& e) {
+            vlog(stlog.info, "error removing {}: {}", reader().path(), e);
+        }
+        rm.push_back(std::move(*cold));
+    } else {
+        // the data file may be kept for reuse by a new segment instead
+        recycled = co_await _resources.recycler().retire(reader().path());
+        if (recycled == 0) {
+            rm.emplace_back(reader().path());
+        }
+    }
 
     co_return co_await ss::map_reduce(
       rm,
       [this](std::filesystem::path path) {
           return remove_persistent_state(std::move(path));
       },
-      size_t(0),
+      recycled,
       std::plus<>());
 }
 
@@ -238,6 +267,7 @@ ss::future<> segment::do_release_appender(
         std::optional<compacted_index_writer>& compacted_index) {
           return appender->close()
             .then([this] { return _idx.flush(); })
+            .then([this] { _idx.maybe_pack(); })
             .then([this, &compacted_index] {
                 if (compacted_index) {
                     return compacted_index->close();
@@ -385,6 +415,7 @@ ss::future<> segment::do_truncate(
     _tracker.stable_offset = new_max_offset;
     _tracker.dirty_offset = new_max_offset;
     _reader->set_file_size(physical);
+    _reader->truncate_pages(physical);
     vlog(
       stlog.trace,
       "truncating segment {} at {}",
@@ -392,6 +423,7 @@ ss::future<> segment::do_truncate(
       new_max_offset);
     _generation_id++;
     cache_truncate(new_max_offset + model::offset(1));
+    _batch_boundaries.clear();
     auto f = ss::now();
     if (is_compacted_segment()) {
         // if compaction index is opened close it
@@ -404,6 +436,9 @@ ss::future<> segment::do_truncate(
         }
         // always remove compaction index when truncating compacted segments
         f = f.then([this] { return remove_compacted_index(_reader->path()); });
+        // the key filter may be missing keys appended after the truncation
+        f = f.then(
+          [this] { return remove_compaction_key_filter(_reader->path()); });
     }
 
     f = f.then([this, new_max_offset, new_max_timestamp] {
@@ -440,6 +475,9 @@ ss::future<bool> segment::materialize_index() {
             _tracker.committed_offset = _idx.max_offset();
             _tracker.stable_offset = _idx.max_offset();
             _tracker.dirty_offset = _idx.max_offset();
+            if (!_appender) {
+                _idx.maybe_pack();
+            }
         }
         return yn;
     });
@@ -488,7 +526,7 @@ ss::future<> segment::compaction_index_batch(const model::record_batch& b) {
     // compacted topics, and/or avoiding huge batches on compacted topics.
     auto units = co_await _resources.get_compaction_compression_units();
 
-    auto decompressed = co_await internal::decompress_batch(b);
+    auto decompressed = co_await decompressed_batches().decompress(b);
 
     co_return co_await do_compaction_index_batch(decompressed);
 }
@@ -542,6 +580,8 @@ ss::future<append_result> segment::do_append(const model::record_batch& b) {
           // index the write
           _idx.maybe_track(
             b.header(), ss::lowres_system_clock::now(), start_physical_offset);
+          _batch_boundaries.append(b.last_offset(), end_physical_offset);
+          _reader->populate_pages(start_physical_offset, b);
           auto ret = append_result{
             .base_offset = b.base_offset(),
             .last_offset = b.last_offset(),
@@ -617,8 +657,10 @@ ss::future<append_result> segment::append(model::record_batch&& b) {
     });
 }
 
-ss::future<segment_reader_handle>
-segment::offset_data_stream(model::offset o, ss::io_priority_class iopc) {
+ss::future<segment_reader_handle> segment::offset_data_stream(
+  model::offset o,
+  ss::io_priority_class iopc,
+  ss::lw_shared_ptr<ss::file_input_stream_history> readahead_history) {
     check_segment_not_closed("offset_data_stream()");
     auto nearest = _idx.find_nearest(o);
     size_t position = 0;
@@ -630,7 +672,23 @@ segment::offset_data_stream(model::offset o, ss::io_priority_class iopc) {
     // size) (https://github.com/redpanda-data/redpanda/issues/2101)
     vassert(position < size_bytes(), "Index points beyond file size");
 
-    return _reader->data_stream(position, iopc);
+    std::optional<adaptive_readahead> readahead;
+    const auto max_read_ahead
+      = config::shard_local_cfg().storage_read_readahead_max_count();
+    if (readahead_history && max_read_ahead > 0 && !_reader->has_pager()) {
+        // reserve for the current buffer and every buffer read ahead of it
+        // at the largest read-ahead the stream may grow to
+        const auto bytes = _reader->buffer_size()
+                           * (static_cast<size_t>(max_read_ahead) + 1);
+        if (auto units = _resources.try_get_readahead_units(bytes); units) {
+            readahead = adaptive_readahead{
+              .history = std::move(readahead_history),
+              .max_read_ahead = static_cast<unsigned>(max_read_ahead),
+              .units = std::move(*units)};
+        }
+    }
+
+    return _reader->data_stream(position, iopc, std::move(readahead));
 }
 
 void segment::advance_stable_offset(size_t filepos) {
@@ -738,6 +796,9 @@ ss::future<ss::lw_shared_ptr<segment>> open_segment(
     auto rdr = std::make_unique<segment_reader>(
       path, buf_size, read_ahead, ntp_sanitizer_config);
     co_await rdr->load_size();
+    if (auto* paging = internal::paging(); paging && !ntp_sanitizer_config) {
+        rdr->set_pager(paging->make_pager(std::filesystem::path(path)));
+    }
 
     auto idx = segment_index(
       rdr->path().to_index(),
@@ -770,14 +831,31 @@ ss::future<ss::lw_shared_ptr<segment>> make_segment(
   std::optional<ntp_sanitizer_config> ntp_sanitizer_config) {
     auto path = segment_full_path(ntpc, base_offset, term, version);
     vlog(stlog.info, "Creating new segment {}", path);
-    return open_segment(
-             path,
-             std::move(batch_cache),
+    return resources.recycler()
+      .reuse(path)
+      .then([path,
+             batch_cache = std::move(batch_cache),
              buf_size,
              read_ahead,
-             resources,
-             feature_table,
-             ntp_sanitizer_config)
+             &resources,
+             &feature_table,
+             ntp_sanitizer_config](bool recycled) mutable {
+          return open_segment(
+                   path,
+                   std::move(batch_cache),
+                   buf_size,
+                   read_ahead,
+                   resources,
+                   feature_table,
+                   ntp_sanitizer_config)
+            .then([recycled](ss::lw_shared_ptr<segment> seg) {
+                if (recycled) {
+                    // a reused file keeps its size, but holds no batches
+                    seg->reader().set_file_size(0);
+                }
+                return seg;
+            });
+      })
       .then([path, &ntpc, pc, &resources, ntp_sanitizer_config](
               ss::lw_shared_ptr<segment> seg) mutable {
           return with_segment(
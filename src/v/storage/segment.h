@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include "storage/batch_boundary_cache.h"
 #include "storage/batch_cache.h"
 #include "storage/compacted_index_writer.h"
 #include "storage/file_sanitizer_types.h"
@@ -28,7 +29,9 @@
 #include <seastar/core/sharded.hh>
 
 #include <exception>
+#include <filesystem>
 #include <optional>
+#include <utility>
 
 namespace storage {
 struct segment_closed_exception final : std::exception {
@@ -104,9 +107,14 @@ public:
     ss::future<append_result> do_append(const model::record_batch&);
     ss::future<bool> materialize_index();
 
-    /// main read interface
-    ss::future<segment_reader_handle>
-      offset_data_stream(model::offset, ss::io_priority_class);
+    /// main read interface. with a \p readahead_history the read-ahead of
+    /// the stream adapts to the access pattern recorded in the history,
+    /// memory permitting.
+    ss::future<segment_reader_handle> offset_data_stream(
+      model::offset,
+      ss::io_priority_class,
+      ss::lw_shared_ptr<ss::file_input_stream_history> readahead_history
+      = nullptr);
 
     const offset_tracker& offsets() const { return _tracker; }
     bool empty() const;
@@ -123,6 +131,9 @@ public:
     bool finished_self_compaction() const;
     void mark_as_finished_windowed_compaction();
     bool finished_windowed_compaction() const;
+    /// \brief bytes that may hold keys shadowing those of older segments,
+    /// i.e. the whole segment until sliding window compaction deduplicates it
+    size_t dirty_bytes() const;
     /// \brief used for compaction, to reset the tracker from index
     void force_set_commit_offset_from_index();
 
@@ -140,8 +151,18 @@ public:
     size_t file_size() const { return _reader->file_size(); }
     const ss::sstring filename() const { return _reader->filename(); }
     const segment_full_path& path() const { return _reader->path(); }
+    /// Set if the data file has been moved to the cold directory, in which
+    /// case the segment's own path is a symlink to \p cold.
+    void mark_cold(std::filesystem::path cold) { _cold_path = std::move(cold); }
+    std::optional<std::filesystem::path> release_cold_path() {
+        return std::exchange(_cold_path, std::nullopt);
+    }
+    bool is_cold() const { return _cold_path.has_value(); }
     segment_index& index();
     const segment_index& index() const;
+    /// Recently resolved batch positions, cleared when the data file is
+    /// truncated or replaced.
+    batch_boundary_cache& batch_boundaries() { return _batch_boundaries; }
     segment_appender_ptr release_appender();
     segment_appender& appender();
     const segment_appender& appender() const;
@@ -258,9 +279,11 @@ private:
     offset_tracker _tracker;
     segment_reader_ptr _reader;
     segment_index _idx;
+    batch_boundary_cache _batch_boundaries;
     bitflags _flags{bitflags::none};
     segment_appender_ptr _appender;
     std::optional<size_t> _data_disk_usage_size;
+    std::optional<std::filesystem::path> _cold_path;
 
     // compaction index size should be cleared whenever the size might change
     // (e.g. after compaction). when cleared it will reset the next time the
@@ -395,6 +418,9 @@ inline bool segment::finished_windowed_compaction() const {
     return (_flags & bitflags::finished_windowed_compaction)
            == bitflags::finished_windowed_compaction;
 }
+inline size_t segment::dirty_bytes() const {
+    return finished_windowed_compaction() ? 0 : size_bytes();
+}
 inline std::optional<std::reference_wrapper<batch_cache_index>>
 segment::cache() {
     using ret_t = std::optional<std::reference_wrapper<batch_cache_index>>;
@@ -450,6 +476,8 @@ inline bool segment::is_closed() const {
 inline segment_reader& segment::reader() { return *_reader; }
 inline void segment::swap_reader(segment_reader_ptr new_reader) {
     std::swap(new_reader, _reader);
+    // the new file, e.g. a compacted one, has batches at other positions
+    _batch_boundaries.clear();
 }
 inline segment_reader_ptr segment::release_segment_reader() {
     return std::move(_reader);
@@ -10,6 +10,7 @@
 #include "storage/segment_deduplication_utils.h"
 
 #include "storage/compacted_index_writer.h"
+#include "storage/compaction_key_filter.h"
 #include "storage/compaction_reducers.h"
 #include "storage/index_state.h"
 #include "storage/key_offset_map.h"
@@ -38,26 +39,51 @@ ss::future<ss::stop_iteration> put_entry(
     co_return ss::stop_iteration::yes;
 }
 
+compaction_key
+record_key(const model::record_batch& b, const model::record& r) {
+    auto key_view = compaction_key{iobuf_to_bytes(r.key())};
+    return enhance_key(
+      b.header().type, b.header().attrs.is_control(), key_view);
+}
+
 ss::future<bool> should_keep(
   const key_offset_map& map,
   const model::record_batch& b,
-  const model::record& r) {
+  const model::record& r,
+  compaction_key_filter::builder* key_filter) {
     const auto o = b.base_offset() + model::offset_delta(r.offset_delta());
-    auto key_view = compaction_key{iobuf_to_bytes(r.key())};
-    auto key = enhance_key(
-      b.header().type, b.header().attrs.is_control(), key_view);
+    auto key = record_key(b, r);
     auto latest_offset_indexed = co_await map.get(key);
     // If the map hasn't indexed the given key, we should keep the
-    // key.
-    if (!latest_offset_indexed.has_value()) {
-        co_return true;
+    // key. Otherwise, we should only keep the record if its offset is equal
+    // or higher than that indexed.
+    const bool keep = !latest_offset_indexed.has_value()
+                      || o >= latest_offset_indexed.value();
+    if (keep && key_filter) {
+        key_filter->add(key);
     }
-    // We should only keep the record if its offset is equal or higher than
-    // that indexed.
-    co_return o >= latest_offset_indexed.value();
+    co_return keep;
 }
 } // anonymous namespace
 
+ss::future<bool> may_share_keys(
+  const compaction_config& cfg,
+  const hash_key_offset_map& map,
+  const segment& seg) {
+    auto filter = co_await compaction_key_filter::read(
+      seg.path().to_key_filter());
+    if (
+      !filter.has_value()
+      || filter->committed_offset() != seg.offsets().committed_offset) {
+        // Without a current filter, any key may be in the segment.
+        co_return true;
+    }
+    if (cfg.asrc) {
+        cfg.asrc->check();
+    }
+    co_return co_await map.may_share_keys(*filter);
+}
+
 ss::future<bool> build_offset_map_for_segment(
   const compaction_config& cfg, const segment& seg, key_offset_map& m) {
     auto compaction_idx_path = seg.path().to_compacted_index();
@@ -188,6 +214,7 @@ ss::future<index_state> deduplicate_segment(
   probe& probe,
   offset_delta_time should_offset_delta_times,
   ss::sharded<features::feature_table>& feature_table,
+  compaction_key_filter::builder* key_filter,
   bool inject_reader_failure) {
     auto read_holder = co_await seg->read_lock();
     if (seg->is_closed()) {
@@ -200,7 +227,8 @@ ss::future<index_state> deduplicate_segment(
     auto copy_reducer = internal::copy_data_segment_reducer(
       [&map,
        segment_last_offset = seg->offsets().committed_offset,
-       compaction_placeholder_enabled](
+       compaction_placeholder_enabled,
+       key_filter](
         const model::record_batch& b,
         const model::record& r,
         bool is_last_record_in_batch) {
@@ -216,9 +244,12 @@ ss::future<index_state> deduplicate_segment(
                 "retaining last record: {} of segment from batch: {}",
                 r,
                 b.header());
+              if (key_filter) {
+                  key_filter->add(record_key(b, r));
+              }
               return ss::make_ready_future<bool>(true);
           }
-          return should_keep(map, b, r);
+          return should_keep(map, b, r, key_filter);
       },
       &appender,
       seg->path().is_internal_topic(),
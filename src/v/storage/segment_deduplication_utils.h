@@ -10,6 +10,7 @@
 
 #include "base/seastarx.h"
 #include "model/fundamental.h"
+#include "storage/compaction_key_filter.h"
 #include "storage/fwd.h"
 #include "storage/index_state.h"
 #include "storage/segment_set.h"
@@ -47,8 +48,19 @@ ss::future<model::offset> build_offset_map(
   storage::probe&,
   key_offset_map&);
 
+// Returns false if the key filter persisted with 'seg' shows that none of the
+// keys in 'map' are in the segment, in which case deduplicating the segment
+// against 'map' would remove nothing. Returns true if there is no filter or it
+// is stale.
+ss::future<bool> may_share_keys(
+  const compaction_config& cfg,
+  const hash_key_offset_map& map,
+  const segment& seg);
+
 // Rewrites 'seg' according to the parameters in 'cfg' to 'appender' and
 // 'cmp_idx_writer', deduplicating with latest offsets per key from 'map'.
+// If 'key_filter' is set, the keys of the records that are kept are added
+// to it.
 ss::future<index_state> deduplicate_segment(
   const compaction_config& cfg,
   const key_offset_map& map,
@@ -58,6 +70,7 @@ ss::future<index_state> deduplicate_segment(
   storage::probe& probe,
   offset_delta_time should_offset_delta_times,
   ss::sharded<features::feature_table>&,
+  compaction_key_filter::builder* key_filter = nullptr,
   bool inject_reader_failure = false);
 
 } // namespace storage
@@ -10,6 +10,7 @@
 #include "storage/segment_index.h"
 
 #include "base/vassert.h"
+#include "config/configuration.h"
 #include "model/fundamental.h"
 #include "model/timestamp.h"
 #include "serde/serde.h"
@@ -165,15 +166,10 @@ segment_index::find_above_size_bytes(size_t distance) {
     if (_state.empty()) {
         return std::nullopt;
     }
-    auto it = std::upper_bound(
-      std::begin(_state.position_index),
-      std::end(_state.position_index),
-      distance);
-
-    if (it == _state.position_index.end()) {
+    const auto i = _state.upper_bound_position(distance);
+    if (i == _state.size()) {
         return std::nullopt;
     }
-    int i = std::distance(_state.position_index.begin(), it);
     return translate_index_entry(_state, _state.get_entry(i));
 }
 
@@ -182,19 +178,11 @@ segment_index::find_below_size_bytes(size_t distance) {
     if (_state.empty()) {
         return std::nullopt;
     }
-    auto it = std::upper_bound(
-      std::begin(_state.position_index),
-      std::end(_state.position_index),
-      distance);
-
-    if (it != _state.position_index.begin()) {
-        it = std::prev(it);
-    } else {
+    const auto i = _state.upper_bound_position(distance);
+    if (i == 0) {
         return std::nullopt;
     }
-
-    int i = std::distance(_state.position_index.begin(), it);
-    return translate_index_entry(_state, _state.get_entry(i));
+    return translate_index_entry(_state, _state.get_entry(i - 1));
 }
 
 std::optional<segment_index::entry>
@@ -203,19 +191,13 @@ segment_index::find_nearest(model::offset o) {
         return std::nullopt;
     }
     const uint32_t needle = o() - _state.base_offset();
-    auto it = std::lower_bound(
-      std::begin(_state.relative_offset_index),
-      std::end(_state.relative_offset_index),
-      needle,
-      std::less<uint32_t>{});
-    if (it == _state.relative_offset_index.end()) {
-        it = std::prev(it);
-    }
     // make it signed so it can be negative
-    int i = std::distance(_state.relative_offset_index.begin(), it);
+    int i = static_cast<int>(
+      std::min(_state.lower_bound_offset(needle), _state.size() - 1));
     do {
-        if (_state.relative_offset_index[i] <= needle) {
-            return translate_index_entry(_state, _state.get_entry(i));
+        auto entry = _state.get_entry(i);
+        if (std::get<0>(entry) <= needle) {
+            return translate_index_entry(_state, entry);
         }
     } while (i-- > 0);
 
@@ -228,16 +210,11 @@ ss::future<> segment_index::truncate(
         co_return;
     }
     const uint32_t i = new_max_offset() - _state.base_offset();
-    auto it = std::lower_bound(
-      std::begin(_state.relative_offset_index),
-      std::end(_state.relative_offset_index),
-      i,
-      std::less<uint32_t>{});
+    const auto first_removed = _state.lower_bound_offset(i);
 
-    if (it != _state.relative_offset_index.end()) {
+    if (first_removed != _state.size()) {
         _needs_persistence = true;
-        int remove_back_elems = std::distance(
-          it, _state.relative_offset_index.end());
+        int remove_back_elems = _state.size() - first_removed;
         while (remove_back_elems-- > 0) {
             _state.pop_back();
         }
@@ -311,6 +288,12 @@ ss::future<> segment_index::flush() {
     });
 }
 
+void segment_index::maybe_pack() {
+    if (config::shard_local_cfg().storage_packed_index_enabled()) {
+        _state.pack();
+    }
+}
+
 ss::future<> segment_index::flush_to_file(ss::file backing_file) {
     co_await backing_file.truncate(0);
     auto out = co_await ss::make_file_output_stream(std::move(backing_file));
@@ -200,6 +200,14 @@ public:
     ss::future<> flush();
     ss::future<> truncate(model::offset, model::timestamp);
 
+    /// Switch the in-memory entries to the compact read-only encoding if
+    /// `storage_packed_index_enabled` is set. Called once no more entries are
+    /// expected to be added; a later modification unpacks them again.
+    void maybe_pack();
+
+    /// Approximate memory used by the in-memory index entries, in bytes.
+    size_t memory_usage() const { return _state.entries_memory_usage(); }
+
     ss::future<ss::file> open();
 
     const segment_full_path& path() const { return _path; }
@@ -11,18 +11,70 @@
 
 #include "base/vassert.h"
 #include "base/vlog.h"
+#include "io/pager.h"
 #include "ssx/future-util.h"
 #include "storage/logger.h"
+#include "storage/reader_handle_cache.h"
+#include "storage/segment_appender_utils.h"
 #include "storage/segment_utils.h"
 
 #include <seastar/core/file.hh>
 #include <seastar/core/fstream.hh>
 #include <seastar/core/iostream.hh>
 #include <seastar/core/reactor.hh>
+#include <seastar/core/seastar.hh>
 #include <seastar/core/sstring.hh>
 
+#include <deque>
+
 namespace storage {
 
+namespace {
+
+/**
+ * Data source over a byte range of a segment file, backed by a pager. Each
+ * refill reads up to buffer_size bytes and hands them out one page-sized
+ * buffer at a time.
+ */
+class paged_data_source final : public ss::data_source_impl {
+public:
+    paged_data_source(
+      experimental::io::pager* pager,
+      size_t pos,
+      size_t end,
+      size_t buffer_size)
+      : _pager(pager)
+      , _pos(pos)
+      , _end(end)
+      , _buffer_size(std::max<size_t>(buffer_size, 1)) {}
+
+    ss::future<ss::temporary_buffer<char>> get() override {
+        if (_buffers.empty()) {
+            if (_pos >= _end) {
+                co_return ss::temporary_buffer<char>();
+            }
+            const auto len = std::min(_buffer_size, _end - _pos);
+            auto buffers = co_await _pager->read(_pos, len);
+            _pos += len;
+            for (auto& buf : buffers) {
+                _buffers.push_back(std::move(buf));
+            }
+        }
+        auto buf = std::move(_buffers.front());
+        _buffers.pop_front();
+        co_return buf;
+    }
+
+private:
+    experimental::io::pager* _pager;
+    size_t _pos;
+    size_t _end;
+    size_t _buffer_size;
+    std::deque<ss::temporary_buffer<char>> _buffers;
+};
+
+} // namespace
+
 segment_reader::segment_reader(
   segment_full_path path,
   size_t buffer_size,
@@ -41,6 +93,8 @@ segment_reader::~segment_reader() noexcept {
           _path);
     }
 
+    internal::reader_handles().remove(*this);
+
     for (auto& i : _streams) {
         i._parent = nullptr;
     }
@@ -51,12 +105,21 @@ segment_reader::~segment_reader() noexcept {
 ss::future<> segment_reader::load_size() {
     ss::gate::holder guard{_gate};
 
+    // stat by path where possible, so that loading a segment doesn't need a
+    // file descriptor. opening the reader creates a missing file.
+    if (co_await ss::file_exists(filename())) {
+        auto s = co_await ss::file_stat(filename());
+        set_file_size(s.size);
+        co_return;
+    }
     auto s = co_await stat();
     set_file_size(s.st_size);
 };
 
-ss::future<segment_reader_handle>
-segment_reader::data_stream(size_t pos, const ss::io_priority_class pc) {
+ss::future<segment_reader_handle> segment_reader::data_stream(
+  size_t pos,
+  const ss::io_priority_class pc,
+  std::optional<adaptive_readahead> readahead) {
     vassert(
       pos <= _file_size,
       "cannot read negative bytes. Asked to read at position: '{}' - {}",
@@ -73,18 +136,7 @@ segment_reader::data_stream(size_t pos, const ss::io_priority_class pc) {
     // preventing x-file synchronization This is fine, because truncation to
     // sealed segments are supposed to be very rare events. The hotpath of
     // truncating the appender, is optimized.
-
-    ss::file_input_stream_options options;
-    options.buffer_size = _buffer_size;
-    options.io_priority_class = pc;
-    options.read_ahead = _read_ahead;
-
-    ss::gate::holder guard{_gate};
-
-    auto handle = co_await get();
-    handle.set_stream(make_file_input_stream(
-      _data_file, pos, _file_size - pos, std::move(options)));
-    co_return std::move(handle);
+    co_return co_await data_stream(pos, _file_size, pc, std::move(readahead));
 }
 
 ss::future<segment_reader_handle> segment_reader::get() {
@@ -95,10 +147,15 @@ ss::future<segment_reader_handle> segment_reader::get() {
       _data_file_refcount);
     // Lock to prevent double-opens
     auto units = co_await _open_lock.get_units();
-    if (!_data_file) {
+    auto& cache = internal::reader_handles();
+    if (_idle_hook.is_linked()) {
+        cache.remove(*this);
+        cache.probe().handle_reused();
+    } else if (!_data_file) {
         vlog(stlog.debug, "Opening segment file {}", _path);
         _data_file = co_await internal::make_reader_handle(
           std::filesystem::path(_path), _sanitizer_config);
+        cache.probe().handle_opened();
     }
 
     _data_file_refcount++;
@@ -123,6 +180,10 @@ ss::future<> segment_reader::put() {
     vassert(_data_file_refcount > 0, "bad put() on {}", _path);
     _data_file_refcount--;
     if (_data_file && _data_file_refcount == 0) {
+        // keep the idle file open for reuse unless the reader is closing
+        if (!_gate.is_closed() && internal::reader_handles().insert(*this)) {
+            co_return;
+        }
         vlog(stlog.debug, "Closing segment file {}", _path);
         // Note: a get() can now come in and open a fresh file handle: this
         // means we strictly-speaking can consume >1 file descriptors from one
@@ -142,7 +203,10 @@ ss::future<struct stat> segment_reader::stat() {
 }
 
 ss::future<segment_reader_handle> segment_reader::data_stream(
-  size_t pos_begin, size_t pos_end, const ss::io_priority_class pc) {
+  size_t pos_begin,
+  size_t pos_end,
+  const ss::io_priority_class pc,
+  std::optional<adaptive_readahead> readahead) {
     vassert(
       pos_begin <= _file_size,
       "cannot read negative bytes. Asked to read at positions: '{}-{}' - {}",
@@ -155,22 +219,74 @@ ss::future<segment_reader_handle> segment_reader::data_stream(
       pos_begin,
       pos_end,
       *this);
+    ss::gate::holder guard{_gate};
+
+    if (_pager) {
+        // the pager manages its own file handle, so only the reference is
+        // tracked here to keep close() and handle accounting consistent.
+        _data_file_refcount++;
+        auto handle = segment_reader_handle(this);
+        handle.set_stream(ss::input_stream<char>(
+          ss::data_source(std::make_unique<paged_data_source>(
+            _pager.get(), pos_begin, pos_end, _buffer_size))));
+        co_return handle;
+    }
+
     ss::file_input_stream_options options;
     options.buffer_size = _buffer_size;
     options.io_priority_class = pc;
     options.read_ahead = _read_ahead;
+    if (readahead) {
+        // seastar starts from the fixed read-ahead and adjusts it within
+        // these bounds as the history of the consumer accumulates
+        options.read_ahead = std::max(_read_ahead, readahead->max_read_ahead);
+        options.dynamic_adjustments = std::move(readahead->history);
+    }
 
-    ss::gate::holder guard{_gate};
     auto handle = co_await get();
     handle.set_stream(make_file_input_stream(
       _data_file, pos_begin, pos_end - pos_begin, std::move(options)));
+    if (readahead) {
+        handle._readahead_units = std::move(readahead->units);
+    }
     co_return handle;
 }
 
+void segment_reader::set_pager(std::unique_ptr<experimental::io::pager> pager) {
+    vassert(
+      _streams.empty() && _data_file_refcount == 0,
+      "Pager must be set before any streams are opened: {}",
+      *this);
+    _pager = std::move(pager);
+}
+
+void segment_reader::populate_pages(
+  size_t pos, const model::record_batch& batch) {
+    if (!_pager) {
+        return;
+    }
+    auto hdr = disk_header_to_iobuf(batch.header());
+    for (const auto& f : hdr) {
+        _pager->populate(pos, f.get(), f.size());
+        pos += f.size();
+    }
+    for (const auto& f : batch.data()) {
+        _pager->populate(pos, f.get(), f.size());
+        pos += f.size();
+    }
+}
+
+void segment_reader::truncate_pages(size_t sz) {
+    if (_pager) {
+        _pager->truncate(sz);
+    }
+}
+
 ss::future<> segment_reader::truncate(size_t n) {
     ss::gate::holder guard{_gate};
 
     _file_size = n;
+    truncate_pages(n);
     return ss::open_file_dma(ss::sstring(_path), ss::open_flags::rw)
       .then([n](ss::file f) {
           return f.truncate(n)
@@ -183,6 +299,10 @@ ss::future<> segment_reader::close() {
     if (!_gate.is_closed()) {
         co_await _gate.close();
     }
+    if (_pager) {
+        co_await _pager->close();
+    }
+    internal::reader_handles().remove(*this);
     if (_data_file) {
         co_return co_await _data_file.close();
     }
@@ -215,6 +335,7 @@ ss::future<> segment_reader_handle::close() {
         co_await _stream.value().close();
         _stream = std::nullopt;
     }
+    _readahead_units.reset();
     _hook.unlink();
 
     if (_parent) {
@@ -235,6 +356,7 @@ void segment_reader_handle::operator=(segment_reader_handle&& rhs) noexcept {
         ssx::background = _parent->put();
     }
     _stream = std::exchange(rhs._stream, std::nullopt);
+    _readahead_units = std::exchange(rhs._readahead_units, std::nullopt);
     _parent = std::exchange(rhs._parent, nullptr);
     _hook.swap_nodes(rhs._hook);
 }
@@ -14,6 +14,7 @@
 #include "base/seastarx.h"
 #include "container/intrusive_list_helpers.h"
 #include "model/fundamental.h"
+#include "ssx/semaphore.h"
 #include "storage/file_sanitizer_types.h"
 #include "storage/fs_utils.h"
 #include "storage/types.h"
@@ -29,9 +30,14 @@
 #include <type_traits>
 #include <vector>
 
+namespace experimental::io {
+class pager;
+} // namespace experimental::io
+
 namespace storage {
 
 class segment_reader;
+class reader_handle_cache;
 
 struct stream_provider {
     virtual ss::input_stream<char> take_stream() = 0;
@@ -59,11 +65,16 @@ private:
     // created to just stat() a file for example.
     std::optional<ss::input_stream<char>> _stream;
 
+    // Memory reserved for the read-ahead buffers of an adaptive stream,
+    // released once the stream is closed.
+    std::optional<ssx::semaphore_units> _readahead_units;
+
 public:
     explicit segment_reader_handle(segment_reader* parent);
 
     segment_reader_handle(segment_reader_handle&& rhs) noexcept {
         _stream = std::exchange(rhs._stream, std::nullopt);
+        _readahead_units = std::exchange(rhs._readahead_units, std::nullopt);
         _parent = std::exchange(rhs._parent, nullptr);
         _hook.swap_nodes(rhs._hook);
     }
@@ -108,6 +119,21 @@ public:
 
 using segment_reader_ptr = std::unique_ptr<segment_reader>;
 
+/**
+ * Lets the read-ahead of a stream follow its access pattern. The history is
+ * shared by the successive streams of one consumer, so that the buffer size
+ * and read-ahead learnt by one stream carry over to the next: they grow while
+ * the consumer reads everything that was read ahead, and shrink when
+ * read-ahead data is discarded unused.
+ */
+struct adaptive_readahead {
+    ss::lw_shared_ptr<ss::file_input_stream_history> history;
+    // upper bound on the read-ahead the stream may grow to
+    unsigned max_read_ahead{0};
+    // memory reserved for the read-ahead buffers at their maximum
+    ssx::semaphore_units units;
+};
+
 class segment_reader {
 public:
     segment_reader(
@@ -132,6 +158,8 @@ public:
     const ss::sstring filename() const { return path(); }
     const segment_full_path& path() const { return _path; }
 
+    size_t buffer_size() const { return _buffer_size; }
+
     bool empty() const { return _file_size == 0; }
 
     /// close the underlying file handle
@@ -144,11 +172,31 @@ public:
     ss::future<> truncate(size_t sz);
 
     /// create an input stream _sharing_ the underlying file handle
-    /// starting at position @pos
-    ss::future<segment_reader_handle>
-    data_stream(size_t pos, const ss::io_priority_class);
-    ss::future<segment_reader_handle>
-    data_stream(size_t pos_begin, size_t pos_end, const ss::io_priority_class);
+    /// starting at position @pos. with @readahead the stream adapts its
+    /// read-ahead, otherwise it uses the fixed read-ahead of the reader.
+    /// adaptive read-ahead does not apply to paged readers.
+    ss::future<segment_reader_handle> data_stream(
+      size_t pos,
+      const ss::io_priority_class,
+      std::optional<adaptive_readahead> readahead = std::nullopt);
+    ss::future<segment_reader_handle> data_stream(
+      size_t pos_begin,
+      size_t pos_end,
+      const ss::io_priority_class,
+      std::optional<adaptive_readahead> readahead = std::nullopt);
+
+    /// serve all reads through \p pager rather than a dedicated file handle.
+    /// must be called before any streams are created.
+    void set_pager(std::unique_ptr<experimental::io::pager> pager);
+    bool has_pager() const { return _pager != nullptr; }
+
+    /// when paging is enabled, copy a batch being appended at physical
+    /// position @pos into the page cache so that tail reads are served
+    /// from memory. the batch is serialized exactly as the appender does.
+    void populate_pages(size_t pos, const model::record_batch&);
+
+    /// when paging is enabled, drop cached pages beyond @sz
+    void truncate_pages(size_t sz);
 
 private:
     segment_full_path _path;
@@ -157,11 +205,15 @@ private:
     // concurrent calls to get()
     mutex _open_lock{"segment_reader::open_lock"};
 
-    // This is only initialized if _data_file_refcount is greater than zero
+    // This is only initialized if _data_file_refcount is greater than zero,
+    // or while the idle file is parked in the shard's reader_handle_cache.
     ss::file _data_file;
 
     uint32_t _data_file_refcount{0};
 
+    // Linked while the idle _data_file is held by the reader_handle_cache
+    intrusive_list_hook _idle_hook;
+
     intrusive_list<segment_reader_handle, &segment_reader_handle::_hook>
       _streams;
 
@@ -169,6 +221,7 @@ private:
     size_t _buffer_size{0};
     unsigned _read_ahead{0};
     std::optional<ntp_sanitizer_config> _sanitizer_config;
+    std::unique_ptr<experimental::io::pager> _pager;
 
     // Keeps track of operations that cannot be pre-empted by close()
     ss::gate _gate;
@@ -179,6 +232,7 @@ private:
     ss::future<> put();
 
     friend class segment_reader_handle;
+    friend class reader_handle_cache;
     friend std::ostream& operator<<(std::ostream&, const segment_reader&);
 };
 
@@ -0,0 +1,163 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "storage/segment_recycler.h"
+
+#include "base/vlog.h"
+#include "storage/logger.h"
+#include "storage/parser_utils.h"
+#include "storage/storage_resources.h"
+
+#include <seastar/core/file.hh>
+#include <seastar/core/seastar.hh>
+#include <seastar/core/smp.hh>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+
+namespace storage {
+
+namespace {
+// How much of a zeroed file is read back to check that zeroing took effect.
+constexpr size_t zero_check_bytes = 4096;
+
+ss::future<> remove_quietly(const std::filesystem::path& path) {
+    try {
+        co_await ss::remove_file(path.string());
+    } catch (...) {
+        vlog(
+          stlog.debug,
+          "Cannot remove pooled segment file {}: {}",
+          path,
+          std::current_exception());
+    }
+}
+} // namespace
+
+segment_recycler::segment_recycler(storage_resources& resources)
+  : _resources(resources) {}
+
+ss::future<> segment_recycler::start(std::filesystem::path base_dir) {
+    auto dir = base_dir / ".segment_pool" / fmt::to_string(ss::this_shard_id());
+    if (co_await ss::file_exists(dir.string())) {
+        co_await ss::recursive_remove_directory(dir);
+    }
+    co_await ss::recursive_touch_directory(dir.string());
+    _dir = std::move(dir);
+}
+
+ss::future<size_t> segment_recycler::retire(std::filesystem::path path) {
+    if (!_dir || _unsupported) {
+        co_return 0;
+    }
+    size_t size = 0;
+    try {
+        size = co_await ss::file_size(path.string());
+    } catch (...) {
+        co_return 0;
+    }
+    if (size == 0) {
+        co_return 0;
+    }
+    auto units = _resources.try_get_segment_recycle_units(size);
+    if (!units) {
+        co_return 0;
+    }
+
+    auto pooled = *_dir / fmt::to_string(_next_id++);
+    try {
+        co_await ss::rename_file(path.string(), pooled.string());
+    } catch (...) {
+        vlog(
+          stlog.info,
+          "Cannot retire {} to the segment pool: {}",
+          path,
+          std::current_exception());
+        co_return 0;
+    }
+    vlog(stlog.debug, "Retired {} ({} bytes) as {}", path, size, pooled);
+    _pool.push_back(entry{
+      .path = std::move(pooled), .size = size, .units = std::move(*units)});
+    co_return size;
+}
+
+ss::future<bool> segment_recycler::reuse(std::filesystem::path path) {
+    if (_pool.empty() || _unsupported) {
+        co_return false;
+    }
+    if (co_await ss::file_exists(path.string())) {
+        co_return false;
+    }
+    while (!_pool.empty() && !_unsupported) {
+        auto e = std::move(_pool.front());
+        _pool.pop_front();
+        try {
+            // zero before renaming: a crash in between leaves a pooled file
+            // behind, never a segment with stale contents
+            co_await zero(e.path, e.size);
+            co_await ss::rename_file(e.path.string(), path.string());
+            vlog(
+              stlog.debug,
+              "Reusing {} ({} bytes) for {}",
+              e.path,
+              e.size,
+              path);
+            co_return true;
+        } catch (...) {
+            vlog(
+              stlog.debug,
+              "Cannot reuse {} for {}: {}",
+              e.path,
+              path,
+              std::current_exception());
+        }
+        co_await remove_quietly(e.path);
+    }
+    while (_unsupported && !_pool.empty()) {
+        auto e = std::move(_pool.front());
+        _pool.pop_front();
+        co_await remove_quietly(e.path);
+    }
+    co_return false;
+}
+
+ss::future<>
+segment_recycler::zero(const std::filesystem::path& path, size_t size) {
+    auto f = co_await ss::open_file_dma(path.string(), ss::open_flags::rw);
+    std::exception_ptr ex;
+    try {
+        // the file keeps its size, so this zeroes the range in place and
+        // keeps the extents allocated
+        co_await f.allocate(0, size);
+        co_await f.flush();
+        auto head = co_await f.dma_read<char>(
+          0, std::min(size, zero_check_bytes));
+        if (head.empty() || !internal::is_zero(head.get(), head.size())) {
+            // allocate() is a no-op where zeroing a range isn't supported
+            _unsupported = true;
+            vlog(
+              stlog.warn,
+              "Filesystem does not support zeroing a file range in place, "
+              "disabling segment recycling");
+            throw std::runtime_error(
+              fmt::format("{} was not zeroed", path.string()));
+        }
+    } catch (...) {
+        ex = std::current_exception();
+    }
+    co_await f.close();
+    if (ex) {
+        std::rethrow_exception(ex);
+    }
+}
+
+} // namespace storage
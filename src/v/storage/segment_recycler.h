@@ -0,0 +1,95 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "base/seastarx.h"
+#include "ssx/semaphore.h"
+
+#include <seastar/core/future.hh>
+
+#include <deque>
+#include <filesystem>
+#include <optional>
+
+namespace storage {
+
+class storage_resources;
+
+/**
+ * Per-shard pool of retired segment data files.
+ *
+ * Creating a segment fallocates its space step by step as it fills, and
+ * removing one hands the extents back to the filesystem. Under high churn
+ * both show up as filesystem metadata work and extent allocation stalls on
+ * the roll path. Instead, a retired data file may be parked in the pool and
+ * later renamed into place for a new segment, keeping its extents.
+ *
+ * A reused file has its contents zeroed in place before it is handed out, so
+ * that after a crash recovery sees the new segment's batches followed by
+ * zeros, exactly as with a fallocated tail. The file keeps its size; the new
+ * segment must treat itself as empty regardless.
+ *
+ * Pooled files are kept in a per-shard directory under the data directory,
+ * which is cleared when the pool is started. Files from other filesystems are
+ * not taken.
+ *
+ * The bytes held by the pool are accounted for by storage_resources.
+ */
+class segment_recycler {
+public:
+    explicit segment_recycler(storage_resources&);
+    segment_recycler(const segment_recycler&) = delete;
+    segment_recycler& operator=(const segment_recycler&) = delete;
+    segment_recycler(segment_recycler&&) = delete;
+    segment_recycler& operator=(segment_recycler&&) = delete;
+    ~segment_recycler() noexcept = default;
+
+    /**
+     * Set up the pool directory under \p base_dir, removing files left over
+     * from a previous run. Nothing is pooled before this is called.
+     */
+    ss::future<> start(std::filesystem::path base_dir);
+
+    /**
+     * Park the data file at \p path in the pool. Returns the size of the
+     * file taken, or zero if it was not taken, in which case the caller
+     * removes it as usual.
+     */
+    ss::future<size_t> retire(std::filesystem::path path);
+
+    /**
+     * Move a pooled file to \p path, zeroed, for use by a new segment.
+     * Returns false if there was no usable file in the pool.
+     */
+    ss::future<bool> reuse(std::filesystem::path path);
+
+    size_t size() const { return _pool.size(); }
+
+private:
+    struct entry {
+        std::filesystem::path path;
+        size_t size;
+        ssx::semaphore_units units;
+    };
+
+    ss::future<> zero(const std::filesystem::path&, size_t);
+
+    storage_resources& _resources;
+    std::optional<std::filesystem::path> _dir;
+    std::deque<entry> _pool;
+    uint64_t _next_id{0};
+    // Set if zeroing a file in place was found not to work, after which
+    // nothing is recycled.
+    bool _unsupported{false};
+};
+
+} // namespace storage
@@ -15,18 +15,24 @@
 #include "storage/log_replayer.h"
 #include "storage/logger.h"
 #include "storage/segment.h"
+#include "storage/storage_resources.h"
 #include "utils/directory_walker.h"
 #include "utils/filtered_lower_bound.h"
 
+#include <seastar/core/coroutine.hh>
 #include <seastar/core/future.hh>
 #include <seastar/core/loop.hh>
 #include <seastar/core/seastar.hh>
 #include <seastar/core/thread.hh>
+#include <seastar/core/when_all.hh>
 
 #include <absl/container/btree_set.h>
 #include <fmt/format.h>
 
+#include <chrono>
 #include <exception>
+#include <filesystem>
+#include <optional>
 
 namespace storage {
 struct segment_ordering {
@@ -184,19 +190,56 @@ is_last_segment(segment* s, std::optional<ss::sstring> last_clean_segment) {
                 == std::string(last_clean_segment.value());
 }
 
+using recovery_clock = std::chrono::steady_clock;
+
+static std::chrono::milliseconds elapsed_ms(recovery_clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+      recovery_clock::now() - start);
+}
+
+// Checksum the segment and truncate it to its last valid batch. Returns false
+// if nothing could be recovered, in which case the segment is closed and set
+// aside. Must be called in the context of a ss::thread.
+static bool replay_segment(segment& s) {
+    auto replayer = log_replayer(s);
+    auto recovered = replayer.recover_in_thread(ss::default_priority_class());
+    if (!recovered) {
+        vlog(stlog.info, "Unable to recover segment: {}", s);
+        s.close().get();
+        ss::rename_file(
+          s.reader().filename(), s.reader().filename() + ".cannotrecover")
+          .get();
+        return false;
+    }
+    s.truncate(
+       recovered.last_offset.value(),
+       recovered.truncate_file_pos.value(),
+       recovered.last_max_timestamp.value())
+      .get();
+    // persist index
+    s.index().flush().get();
+    vlog(stlog.info, "Recovered: {}", s);
+    return true;
+}
+
 // Recover the last segment. Whenever we close a segment, we will likely
 // open a new one to which we will direct new writes. That new segment
 // might be empty. To optimize log replay, implement #140.
 static ss::future<segment_set> unsafe_do_recover(
   segment_set&& segments,
   std::optional<ss::sstring> last_clean_segment,
-  ss::abort_source& as) {
+  ss::abort_source& as,
+  storage_resources& resources,
+  log_recovery_stats& stats) {
     return ss::async([segments = std::move(segments),
                       last_clean_segment = std::move(last_clean_segment),
-                      &as]() mutable {
+                      &as,
+                      &resources,
+                      &stats]() mutable {
         if (segments.empty() || as.abort_requested()) {
             return std::move(segments);
         }
+        const auto materialize_start = recovery_clock::now();
         segment_set::underlying_t good = std::move(segments).release();
         absl::btree_set<segment*> to_recover_set;
         for (size_t i = 0; i < good.size(); ++i) {
@@ -255,6 +298,8 @@ static ss::future<segment_set> unsafe_do_recover(
                 to_recover_set.insert(&s);
             }
         }
+        stats.materialize_indices = elapsed_ms(materialize_start);
+
         segment_set::underlying_t to_recover;
         // keep segments sorted
         auto good_end = std::stable_partition(
@@ -304,43 +349,63 @@ static ss::future<segment_set> unsafe_do_recover(
             good.pop_back();
         }
 
-        for (auto& s : to_recover) {
+        /*
+         * segments are replayed concurrently within the shard's replay budget.
+         * results are collected by position so that recovered segments are
+         * kept in order, and all replays are waited on before returning or
+         * rethrowing so that no I/O is left pending on a segment.
+         */
+        const auto replay_start = recovery_clock::now();
+        std::vector<ss::lw_shared_ptr<segment>> recovered(to_recover.size());
+        std::vector<ss::future<>> replays;
+        replays.reserve(to_recover.size());
+        for (size_t i = 0; i < to_recover.size(); ++i) {
             // check for abort
             if (unlikely(as.abort_requested())) {
-                return segment_set(std::move(good));
+                break;
             }
 
+            auto& s = to_recover[i];
             if (is_last_segment(s.get(), last_clean_segment)) {
                 vlog(
                   stlog.debug,
                   "Skipping recovery of {}, it is marked clean",
                   s);
-                good.emplace_back(std::move(s));
+                ++stats.clean_segments_skipped;
+                recovered[i] = std::move(s);
                 continue;
             }
 
-            // Check if the segment was marked clean on shutdown
-            auto replayer = log_replayer(*s);
-            auto recovered = replayer.recover_in_thread(
-              ss::default_priority_class());
-            if (!recovered) {
-                vlog(stlog.info, "Unable to recover segment: {}", s);
-                s->close().get();
-                ss::rename_file(
-                  s->reader().filename(),
-                  s->reader().filename() + ".cannotrecover")
-                  .get();
-                continue;
+            const auto size = s->file_size();
+            auto units = resources.get_replay_units(size).get();
+            ++stats.segments_replayed;
+            stats.bytes_replayed += size;
+            replays.push_back(ss::async(
+              [&s, &slot = recovered[i], units = std::move(units)]() mutable {
+                  if (replay_segment(*s)) {
+                      slot = std::move(s);
+                  }
+              }));
+        }
+
+        std::exception_ptr replay_error;
+        for (auto& f : ss::when_all(replays.begin(), replays.end()).get()) {
+            if (f.failed()) {
+                auto ex = f.get_exception();
+                if (!replay_error) {
+                    replay_error = std::move(ex);
+                }
+            }
+        }
+        stats.replay_segments = elapsed_ms(replay_start);
+        if (replay_error) {
+            std::rethrow_exception(replay_error);
+        }
+
+        for (auto& s : recovered) {
+            if (s) {
+                good.emplace_back(std::move(s));
             }
-            s->truncate(
-               recovered.last_offset.value(),
-               recovered.truncate_file_pos.value(),
-               recovered.last_max_timestamp.value())
-              .get();
-            // persist index
-            s->index().flush().get();
-            vlog(stlog.info, "Recovered: {}", s);
-            good.emplace_back(std::move(s));
         }
         return segment_set(std::move(good));
     });
@@ -349,7 +414,9 @@ static ss::future<segment_set> unsafe_do_recover(
 static ss::future<segment_set> do_recover(
   segment_set&& segments,
   std::optional<ss::sstring> last_clean_segment,
-  ss::abort_source& as) {
+  ss::abort_source& as,
+  storage_resources& resources,
+  log_recovery_stats& stats) {
     // light-weight copy used for clean-up if recovery fails
     segment_set::underlying_t copy;
     copy.reserve(segments.size());
@@ -361,7 +428,8 @@ static ss::future<segment_set> do_recover(
     // are any pending io operations on a file associated with the segment
     // at the time of destruction seastar will complain about the file handle
     // being destroyed with pending ops.
-    return unsafe_do_recover(std::move(segments), last_clean_segment, as)
+    return unsafe_do_recover(
+             std::move(segments), last_clean_segment, as, resources, stats)
       .handle_exception(
         [copy = std::move(copy)](const std::exception_ptr& ex) mutable {
             return ss::do_with(
@@ -381,6 +449,27 @@ static ss::future<segment_set> do_recover(
         });
 }
 
+/**
+ * Resolve the data file of a segment moved to the cold directory, whose own
+ * path is a symlink to it. Returns nullopt if the file is missing.
+ */
+static ss::future<std::optional<std::filesystem::path>>
+resolve_cold_segment(std::filesystem::path link) {
+    auto target = std::filesystem::read_symlink(link);
+    if (target.is_relative()) {
+        target = link.parent_path() / target;
+    }
+    if (!co_await ss::file_exists(target.string())) {
+        vlog(
+          stlog.error,
+          "Skipping segment {}: its data file {} is missing",
+          link,
+          target);
+        co_return std::nullopt;
+    }
+    co_return target;
+}
+
 /**
  * \brief Open all segments in a directory.
  *
@@ -423,10 +512,15 @@ static ss::future<segment_set::underlying_t> open_segments(
                     return ss::now();
                 }
                 /*
-                 * Skip non-regular files (including links)
+                 * Skip non-regular files. Links are segments whose data file
+                 * was moved to the cold directory.
                  */
+                using ss::directory_entry_type;
+                const bool is_link = seg.type
+                                     && *seg.type == directory_entry_type::link;
                 if (
-                  !seg.type || *seg.type != ss::directory_entry_type::regular) {
+                  !seg.type
+                  || (*seg.type != directory_entry_type::regular && !is_link)) {
                     return ss::make_ready_future<>();
                 }
 
@@ -436,16 +530,39 @@ static ss::future<segment_set::underlying_t> open_segments(
                     return ss::make_ready_future<>();
                 }
 
-                return open_segment(
-                         *path,
-                         cache_factory(),
-                         buf_size,
-                         read_ahead,
-                         resources,
-                         feature_table,
-                         san_cfg)
-                  .then([&segs](ss::lw_shared_ptr<segment> p) {
-                      segs.push_back(std::move(p));
+                auto cold
+                  = is_link
+                      ? resolve_cold_segment(*path)
+                      : ss::make_ready_future<
+                        std::optional<std::filesystem::path>>();
+                return std::move(cold).then(
+                  [path = std::move(*path),
+                   is_link,
+                   cache_factory,
+                   san_cfg,
+                   &segs,
+                   buf_size,
+                   read_ahead,
+                   &resources,
+                   &feature_table](std::optional<std::filesystem::path> cold) {
+                      if (is_link && !cold) {
+                          return ss::make_ready_future<>();
+                      }
+                      return open_segment(
+                               path,
+                               cache_factory(),
+                               buf_size,
+                               read_ahead,
+                               resources,
+                               feature_table,
+                               san_cfg)
+                        .then([&segs, cold = std::move(cold)](
+                                ss::lw_shared_ptr<segment> p) mutable {
+                            if (cold) {
+                                p->mark_cold(std::move(*cold));
+                            }
+                            segs.push_back(std::move(p));
+                        });
                   });
             });
           /*
@@ -469,7 +586,8 @@ ss::future<segment_set> recover_segments(
   std::optional<ss::sstring> last_clean_segment,
   storage_resources& resources,
   ss::sharded<features::feature_table>& feature_table,
-  std::optional<ntp_sanitizer_config> ntp_sanitizer_config) {
+  std::optional<ntp_sanitizer_config> ntp_sanitizer_config,
+  log_recovery_stats& stats) {
     return ss::recursive_touch_directory(ss::sstring(path))
       .then([&as,
              path,
@@ -478,7 +596,9 @@ ss::future<segment_set> recover_segments(
              read_buf_size,
              read_readahead_count,
              &resources,
-             &feature_table] {
+             &feature_table,
+             &stats] {
+          const auto start = recovery_clock::now();
           return open_segments(
             path,
             cache_factory,
@@ -487,12 +607,16 @@ ss::future<segment_set> recover_segments(
             read_readahead_count,
             resources,
             feature_table,
-            ntp_sanitizer_config);
+            ntp_sanitizer_config)
+            .finally([&stats, start] {
+                stats.open_segments = elapsed_ms(start);
+            });
       })
       .then([&as,
              is_compaction_enabled,
-             last_clean_segment = std::move(last_clean_segment)](
-              segment_set::underlying_t segs) {
+             last_clean_segment = std::move(last_clean_segment),
+             &resources,
+             &stats](segment_set::underlying_t segs) {
           auto segments = segment_set(std::move(segs));
           // we have to mark compacted segments before recovery to allow reading
           // gaps introduced by compaction
@@ -501,7 +625,8 @@ ss::future<segment_set> recover_segments(
                   s->mark_as_compacted_segment();
               }
           }
-          return do_recover(std::move(segments), last_clean_segment, as);
+          return do_recover(
+            std::move(segments), last_clean_segment, as, resources, stats);
       });
 }
 
@@ -16,6 +16,7 @@
 #include "storage/file_sanitizer_types.h"
 #include "storage/fs_utils.h"
 #include "storage/fwd.h"
+#include "storage/types.h"
 
 #include <seastar/core/circular_buffer.hh>
 #include <seastar/core/sharded.hh>
@@ -104,6 +105,7 @@ ss::future<segment_set> recover_segments(
   std::optional<ss::sstring> last_clean_segment,
   storage_resources&,
   ss::sharded<features::feature_table>& feature_table,
-  std::optional<ntp_sanitizer_config> ntp_sanitizer_config);
+  std::optional<ntp_sanitizer_config> ntp_sanitizer_config,
+  log_recovery_stats& stats);
 
 } // namespace storage
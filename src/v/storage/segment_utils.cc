@@ -410,12 +410,20 @@ ss::future<storage::index_state> do_copy_segment_data(
       seg->reader().filename(),
       tmpname);
 
-    auto should_keep = [compacted_list = std::move(compacted_offsets)](
+    // the offsets outlive the reducer, it is consumed below
+    auto should_keep = [&compacted_offsets](
                          const model::record_batch& b,
                          const model::record& r,
                          bool) {
         const auto o = b.base_offset() + model::offset_delta(r.offset_delta());
-        return ss::make_ready_future<bool>(compacted_list.contains(o));
+        return ss::make_ready_future<bool>(compacted_offsets.contains(o));
+    };
+    // a batch with a record at every offset of its range, all of which are
+    // kept, is copied without decompressing it
+    auto keep_all = [&compacted_offsets](const model::record_batch_header& h) {
+        return h.record_count == h.last_offset_delta + 1
+               && compacted_offsets.contains_range(
+                 h.base_offset, h.last_offset());
     };
 
     model::offset segment_last_offset{};
@@ -428,7 +436,10 @@ ss::future<storage::index_state> do_copy_segment_data(
       appender.get(),
       seg->path().is_internal_topic(),
       apply_offset,
-      segment_last_offset);
+      segment_last_offset,
+      nullptr,
+      false,
+      std::move(keep_all));
 
     // create the segment, get the in-memory index for the new segment
     auto new_index = co_await create_segment_full_reader(
@@ -482,6 +493,18 @@ ss::future<> do_swap_data_file_handles(
       old_name,
       s->reader().filename());
     co_await ss::rename_file(old_name, s->reader().filename());
+    if (auto cold = s->release_cold_path(); cold) {
+        // the link to the cold data file has been replaced
+        try {
+            co_await ss::remove_file(cold->string());
+        } catch (...) {
+            vlog(
+              gclog.warn,
+              "error removing cold data file {}: {}",
+              *cold,
+              std::current_exception());
+        }
+    }
     // the on disk file is changing so clear the size cache
     s->clear_cached_disk_usage();
 
@@ -498,6 +521,73 @@ ss::future<> do_swap_data_file_handles(
     pb.add_initial_segment(*s.get());
 }
 
+ss::future<bool> move_segment_to_cold(
+  ss::lw_shared_ptr<segment> s,
+  std::filesystem::path cold,
+  compaction_config cfg,
+  probe& pb,
+  readers_cache& readers_cache) {
+    auto read_holder = co_await s->read_lock();
+    if (s->is_closed()) {
+        throw segment_closed_exception();
+    }
+    auto segment_generation = s->get_generation_id();
+
+    auto staging = std::filesystem::path(cold.string() + ".staging");
+    co_await ss::recursive_touch_directory(cold.parent_path().string());
+    if (co_await ss::file_exists(staging.string())) {
+        co_await ss::remove_file(staging.string());
+    }
+    {
+        auto writer = co_await make_writer_handle(
+          staging, cfg.sanitizer_config);
+        auto output = co_await ss::make_file_output_stream(std::move(writer));
+        auto reader_handle = co_await s->reader().data_stream(0, cfg.iopc);
+        std::exception_ptr ex;
+        try {
+            co_await ss::copy(reader_handle.stream(), output);
+        } catch (...) {
+            ex = std::current_exception();
+        }
+        co_await reader_handle.close();
+        co_await output.close();
+        if (ex) {
+            co_await ss::remove_file(staging.string());
+            std::rethrow_exception(ex);
+        }
+    }
+    co_await ss::rename_file(staging.string(), cold.string());
+    co_await ss::sync_directory(cold.parent_path().string());
+    read_holder.return_all();
+
+    auto rdr_holder = co_await readers_cache.evict_segment_readers(s);
+    auto write_lock_holder = co_await s->write_lock();
+    if (s->is_closed() || segment_generation != s->get_generation_id()) {
+        vlog(
+          gclog.debug,
+          "segment {} changed while being copied to {}, leaving it in place",
+          s->reader().filename(),
+          cold);
+        co_await ss::remove_file(cold.string());
+        co_return false;
+    }
+
+    // the link is created next to the segment and renamed over it, so that
+    // the segment's own path always names a complete copy of the data
+    auto link = std::filesystem::path(
+      fmt::format("{}.cold.staging", s->reader().filename()));
+    if (co_await ss::file_exists(link.string())) {
+        co_await ss::remove_file(link.string());
+    }
+    std::filesystem::create_symlink(cold, link);
+    co_await do_swap_data_file_handles(link, s, cfg, pb);
+    co_await ss::sync_directory(link.parent_path().string());
+    vlog(
+      gclog.debug, "moved data file of {} to {}", s->reader().filename(), cold);
+    s->mark_cold(std::move(cold));
+    co_return true;
+}
+
 /**
  * Executes segment compaction, returns size of compacted segment or an empty
  * optional if segment wasn't compacted
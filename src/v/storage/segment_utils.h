@@ -190,6 +190,20 @@ ss::future<> do_swap_data_file_handles(
   storage::compaction_config,
   probe&);
 
+/**
+ * Move the data file of a sealed segment to \p cold, leaving a symlink to it
+ * under the segment's own path so that readers and recovery find it there.
+ * The copy is made under the segment's read lock and the link swapped in
+ * under its write lock. Returns false if the segment changed in between, in
+ * which case it is left in place.
+ */
+ss::future<bool> move_segment_to_cold(
+  ss::lw_shared_ptr<segment>,
+  std::filesystem::path cold,
+  compaction_config,
+  probe&,
+  readers_cache&);
+
 // Generates a random jitter percentage [as a fraction] with in the passed
 // percents range.
 float random_jitter(jitter_percents);
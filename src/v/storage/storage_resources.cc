@@ -33,6 +33,12 @@ storage_resources::storage_resources(
   , _global_target_replay_bytes(target_replay_bytes)
   , _max_concurrent_replay(max_concurrent_replay)
   , _compaction_index_mem_limit(compaction_index_memory)
+  , _max_concurrent_replay_bytes(
+      config::shard_local_cfg().storage_max_concurrent_replay_bytes.bind())
+  , _readahead_memory(
+      config::shard_local_cfg().storage_read_readahead_memory.bind())
+  , _segment_recycle_bytes(
+      config::shard_local_cfg().storage_segment_recycle_bytes.bind())
   , _append_chunk_size(internal::chunks().chunk_size())
   , _offset_translator_dirty_bytes(
       _global_target_replay_bytes() / ss::smp::count)
@@ -43,7 +49,14 @@ storage_resources::storage_resources(
   , _inflight_recovery(
       std::max(_max_concurrent_replay() / ss::smp::count, uint64_t{1}))
   , _inflight_close_flush(
-      std::max(_max_concurrent_replay() / ss::smp::count, uint64_t{1})) {
+      std::max(_max_concurrent_replay() / ss::smp::count, uint64_t{1}))
+  , _inflight_replay_bytes(_max_concurrent_replay_bytes())
+  , _readahead_bytes(_readahead_memory())
+  , _recycled_segment_bytes(_segment_recycle_bytes())
+  , _recycler(*this)
+  , _unlinker(
+      config::shard_local_cfg().segment_deletion_bytes_per_sec.bind(),
+      config::shard_local_cfg().segment_deletion_truncate_step.bind()) {
     // Register notifications on configuration changes
     _global_target_replay_bytes.watch([this]() {
         auto v = per_shard_target_replay_bytes(_global_target_replay_bytes());
@@ -65,9 +78,20 @@ storage_resources::storage_resources(
         _inflight_close_flush.set_capacity(v);
     });
 
+    _max_concurrent_replay_bytes.watch([this] {
+        _inflight_replay_bytes.set_capacity(_max_concurrent_replay_bytes());
+    });
+
     _compaction_index_mem_limit.watch([this] {
         _compaction_index_bytes.set_capacity(_compaction_index_mem_limit());
     });
+
+    _readahead_memory.watch(
+      [this] { _readahead_bytes.set_capacity(_readahead_memory()); });
+
+    _segment_recycle_bytes.watch([this] {
+        _recycled_segment_bytes.set_capacity(_segment_recycle_bytes());
+    });
 }
 
 // Unit test convenience for tests that want to control the falloc step
@@ -120,6 +144,23 @@ void storage_resources::update_partition_count(size_t partition_count) {
     update_min_checkpoint_bytes();
 }
 
+std::optional<ssx::semaphore_units>
+storage_resources::try_get_segment_recycle_units(size_t bytes) {
+    if (_segment_recycle_bytes() == 0) {
+        return std::nullopt;
+    }
+    if (_partition_count > 0) {
+        // Same heuristic as for fallocation: leave at least half of this
+        // shard's share of the free space alone.
+        uint64_t space_free_this_shard = _space_allowance_free
+                                         / ss::smp::count;
+        if (bytes > space_free_this_shard / 2) {
+            return std::nullopt;
+        }
+    }
+    return _recycled_segment_bytes.try_get_units(bytes);
+}
+
 size_t storage_resources::calc_falloc_step() {
     // Heuristic: use at most half the available disk space for per-allocating
     // space to write into.
@@ -14,9 +14,13 @@
 #include "base/units.h"
 #include "config/property.h"
 #include "ssx/semaphore.h"
+#include "storage/background_unlinker.h"
+#include "storage/segment_recycler.h"
 #include "utils/adjustable_semaphore.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <optional>
 
 namespace storage {
 
@@ -75,6 +79,16 @@ public:
         return _inflight_recovery.get_units(1);
     }
 
+    /**
+     * Units for checksumming \p bytes of segment data during log recovery.
+     * Requests are clamped to the budget so that a segment larger than the
+     * whole budget may still be replayed on its own.
+     */
+    ss::future<ssx::semaphore_units> get_replay_units(size_t bytes) {
+        return _inflight_replay_bytes.get_units(
+          std::clamp<size_t>(bytes, 1, _inflight_replay_bytes.capacity()));
+    }
+
     ss::future<ssx::semaphore_units> get_close_flush_units() {
         return _inflight_close_flush.get_units(1);
     }
@@ -83,6 +97,33 @@ public:
         return _inflight_compaction_compression.get_units(1);
     }
 
+    /**
+     * Units for \p bytes of read-ahead buffers of a log reader. Readers
+     * don't wait for memory: if none is available they read with the
+     * default fixed read-ahead instead.
+     */
+    std::optional<ssx::semaphore_units> try_get_readahead_units(size_t bytes) {
+        return _readahead_bytes.try_get_units(bytes);
+    }
+
+    /**
+     * Units for keeping \p bytes of retired segment files in the recycling
+     * pool. None are granted while free disk space is low, so that the pool
+     * never stands in the way of space being returned to the filesystem.
+     */
+    std::optional<ssx::semaphore_units>
+    try_get_segment_recycle_units(size_t bytes);
+
+    segment_recycler& recycler() { return _recycler; }
+
+    background_unlinker& unlinker() { return _unlinker; }
+
+    /**
+     * Stop background work started on behalf of storage components. Only
+     * required once something has been queued to the unlinker.
+     */
+    ss::future<> stop() { return _unlinker.stop(); }
+
     /**
      * An adjustable_semaphore will set checkpoint_hint whenever its units
      * are exhausted, but this can happen with pathological frequency if
@@ -111,6 +152,9 @@ private:
     config::binding<uint64_t> _global_target_replay_bytes;
     config::binding<uint64_t> _max_concurrent_replay;
     config::binding<uint64_t> _compaction_index_mem_limit;
+    config::binding<size_t> _max_concurrent_replay_bytes;
+    config::binding<size_t> _readahead_memory;
+    config::binding<size_t> _segment_recycle_bytes;
     size_t _append_chunk_size;
 
     // A lower bound on how many units a caller must have to be
@@ -152,10 +196,26 @@ private:
     // (e.g. when we shut down and ask everyone to flush)
     adjustable_semaphore _inflight_close_flush{0};
 
+    // How many bytes of segment data may be checksummed concurrently by log
+    // recovery on this shard?
+    adjustable_semaphore _inflight_replay_bytes{0};
+
     // Decompressing batches for compaction indexing may have an outsized
     // memory footprint compared with the batch's original size, we must
     // limit how many of these we do in parallel.
     adjustable_semaphore _inflight_compaction_compression{1};
+
+    // How much memory may log readers on this shard reserve for adaptive
+    // read-ahead?
+    adjustable_semaphore _readahead_bytes{0};
+
+    // How many bytes of retired segment files may this shard keep around
+    // for reuse by new segments?
+    adjustable_semaphore _recycled_segment_bytes{0};
+
+    segment_recycler _recycler;
+
+    background_unlinker _unlinker;
 };
 
 } // namespace storage
@@ -0,0 +1,118 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "base/units.h"
+#include "config/property.h"
+#include "random/generators.h"
+#include "storage/background_unlinker.h"
+
+#include <seastar/core/sleep.hh>
+#include <seastar/core/smp.hh>
+#include <seastar/testing/thread_test_case.hh>
+#include <seastar/util/defer.hh>
+
+#include <boost/test/tools/old/interface.hpp>
+#include <fmt/format.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+std::filesystem::path make_test_dir() {
+    auto dir = std::filesystem::path(fmt::format(
+      "test.background_unlinker.{}",
+      random_generators::gen_alphanum_string(8)));
+    std::filesystem::create_directories(dir);
+    return dir;
+}
+
+void write_file(const std::filesystem::path& path, size_t size) {
+    std::ofstream out(path, std::ios::binary);
+    auto data = random_generators::gen_alphanum_string(size);
+    out.write(data.data(), static_cast<std::streamsize>(data.size()));
+}
+
+size_t count_pending(const std::filesystem::path& dir) {
+    auto pending = dir / ".segment_deletion"
+                   / fmt::to_string(ss::this_shard_id());
+    return std::distance(
+      std::filesystem::directory_iterator(pending),
+      std::filesystem::directory_iterator{});
+}
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(test_background_unlinker_deletes_in_steps) {
+    auto dir = make_test_dir();
+    auto cleanup = ss::defer([dir] { std::filesystem::remove_all(dir); });
+
+    // four steps at 256KiB/s: deleting the file takes about 250ms
+    storage::background_unlinker unlinker(
+      config::mock_binding<size_t>(256_KiB),
+      config::mock_binding<size_t>(16_KiB));
+    auto stop = ss::defer([&unlinker] { unlinker.stop().get(); });
+    unlinker.start(dir).get();
+
+    auto path = dir / "0-1-v1.log";
+    write_file(path, 64_KiB);
+
+    BOOST_REQUIRE(unlinker.remove(path, 64_KiB).get());
+    BOOST_REQUIRE(!std::filesystem::exists(path));
+    BOOST_REQUIRE_EQUAL(unlinker.pending_bytes(), 64_KiB);
+
+    // a new file under the same name is left alone
+    write_file(path, 1_KiB);
+
+    for (int i = 0; i < 500 && unlinker.pending_bytes() > 0; ++i) {
+        ss::sleep(10ms).get();
+    }
+    BOOST_REQUIRE_EQUAL(unlinker.pending_bytes(), 0);
+    BOOST_REQUIRE_EQUAL(count_pending(dir), 0);
+    BOOST_REQUIRE_EQUAL(std::filesystem::file_size(path), 1_KiB);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_background_unlinker_small_files_inline) {
+    auto dir = make_test_dir();
+    auto cleanup = ss::defer([dir] { std::filesystem::remove_all(dir); });
+
+    storage::background_unlinker unlinker(
+      config::mock_binding<size_t>(256_KiB),
+      config::mock_binding<size_t>(16_KiB));
+    auto stop = ss::defer([&unlinker] { unlinker.stop().get(); });
+    unlinker.start(dir).get();
+
+    auto path = dir / "0-1-v1.log";
+    write_file(path, 4_KiB);
+
+    // smaller than one step: the caller unlinks it
+    BOOST_REQUIRE(!unlinker.remove(path, 4_KiB).get());
+    BOOST_REQUIRE(std::filesystem::exists(path));
+    BOOST_REQUIRE_EQUAL(unlinker.pending_bytes(), 0);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_background_unlinker_disabled) {
+    auto dir = make_test_dir();
+    auto cleanup = ss::defer([dir] { std::filesystem::remove_all(dir); });
+
+    storage::background_unlinker unlinker(
+      config::mock_binding<size_t>(0), config::mock_binding<size_t>(16_KiB));
+    auto stop = ss::defer([&unlinker] { unlinker.stop().get(); });
+    unlinker.start(dir).get();
+
+    auto path = dir / "0-1-v1.log";
+    write_file(path, 64_KiB);
+
+    BOOST_REQUIRE(!unlinker.remove(path, 64_KiB).get());
+    BOOST_REQUIRE(std::filesystem::exists(path));
+}
@@ -312,3 +312,70 @@ FIXTURE_TEST(test_random_batch_sizes, batch_cache_test_fixture) {
         BOOST_REQUIRE_LE(r.waste(), max_waste);
     }
 }
+
+static storage::batch_cache::reclaim_options s3_fifo_opts = {
+  .growth_window = std::chrono::milliseconds(3000),
+  .stable_window = std::chrono::milliseconds(10000),
+  .min_size = 1,
+  .max_size = 1,
+  .eviction_policy = model::batch_cache_eviction_policy::s3_fifo,
+};
+
+SEASTAR_THREAD_TEST_CASE(s3_fifo_scan_resistance) {
+    storage::batch_cache cache(s3_fifo_opts);
+    auto stop = ss::defer([&cache] { cache.stop().get(); });
+    storage::batch_cache_index index(cache);
+
+    // batches larger than a range each get their own range
+    const auto batch_size = storage::batch_cache::range::range_size + 1;
+
+    // a range read repeatedly while on probation
+    auto hot = cache.put(index, make_random_batch(batch_size));
+    cache.touch(hot.range());
+    cache.touch(hot.range());
+
+    // followed by a scan of ranges read only once
+    std::vector<storage::batch_cache::entry> scan;
+    for (int i = 1; i <= 5; ++i) {
+        scan.push_back(
+          cache.put(index, make_random_batch(batch_size, model::offset(i))));
+    }
+    BOOST_REQUIRE_EQUAL(cache.probe().small_admissions(), 6);
+
+    // the scan is reclaimed rather than the hot range
+    for (size_t i = 0; i < scan.size(); ++i) {
+        BOOST_REQUIRE_GT(cache.reclaim(1), 0);
+    }
+    BOOST_REQUIRE(hot.range());
+    for (auto& e : scan) {
+        BOOST_REQUIRE(!e.range());
+    }
+    BOOST_REQUIRE_EQUAL(cache.probe().promotions(), 1);
+
+    cache.evict(std::move(hot.range()));
+    BOOST_REQUIRE(cache.empty());
+}
+
+SEASTAR_THREAD_TEST_CASE(s3_fifo_ghost_admission) {
+    storage::batch_cache cache(s3_fifo_opts);
+    auto stop = ss::defer([&cache] { cache.stop().get(); });
+    storage::batch_cache_index index(cache);
+
+    auto batch = make_batch(10, model::offset(10));
+    index.put(batch);
+    BOOST_REQUIRE(index.get(model::offset(10)));
+    BOOST_REQUIRE_EQUAL(cache.probe().small_admissions(), 1);
+    BOOST_REQUIRE_EQUAL(cache.probe().hits(), 1);
+
+    // reclaimed from the small queue without being read again
+    BOOST_REQUIRE_GT(cache.reclaim(1), 0);
+    BOOST_REQUIRE(!index.get(model::offset(10)));
+    BOOST_REQUIRE_EQUAL(cache.probe().misses(), 1);
+
+    // coming back while remembered by the ghost queue skips probation
+    index.put(batch);
+    BOOST_REQUIRE_EQUAL(cache.probe().ghost_hits(), 1);
+    BOOST_REQUIRE_EQUAL(cache.probe().main_admissions(), 1);
+    BOOST_REQUIRE_EQUAL(cache.probe().small_admissions(), 1);
+    BOOST_REQUIRE(index.get(model::offset(10)));
+}
@@ -7,11 +7,13 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "base/units.h"
 #include "bytes/random.h"
 #include "model/fundamental.h"
 #include "random/generators.h"
 #include "storage/compacted_index.h"
 #include "storage/compaction_reducers.h"
+#include "storage/key_offset_map.h"
 
 #include <seastar/core/loop.hh>
 #include <seastar/core/reactor.hh>
@@ -19,8 +21,10 @@
 
 #include <absl/container/flat_hash_map.h>
 #include <absl/container/node_hash_map.h>
+#include <fmt/format.h>
 
 #include <unordered_map>
+#include <vector>
 
 struct reducer_bench {
     storage::internal::compaction_key_reducer reducer;
@@ -41,3 +45,100 @@ PERF_TEST_F(reducer_bench, compaction_key_reducer_test) {
         perf_tests::stop_measuring_time();
     });
 }
+
+/*
+ * Lookups and updates against a full hash_key_offset_map. The first run fills
+ * the map and reports its density, each run then measures a batch of probes.
+ * Every lookup hashes its key, so the runs compare the key hash functions.
+ */
+template<model::compaction_key_hash KeyHash>
+struct key_map_bench_t {
+    static constexpr size_t map_size = 16_MiB;
+    static constexpr size_t probes = 1000;
+
+    ss::future<> fill() {
+        if (!keys.empty()) {
+            co_return;
+        }
+        co_await map.initialize(map_size);
+        for (int64_t o = 0;; ++o) {
+            storage::compaction_key key(random_generators::get_bytes(20));
+            if (!co_await map.put(key, model::offset(o))) {
+                break;
+            }
+            if (keys.size() < probes) {
+                keys.push_back(std::move(key));
+            }
+        }
+        fmt::print(
+          "hash_key_offset_map ({}): {} keys in {} MiB ({:.0f} keys per MiB), "
+          "hit rate {:.2f}\n",
+          KeyHash,
+          map.size(),
+          map_size / 1_MiB,
+          static_cast<double>(map.size()) / (map_size / 1_MiB),
+          map.hit_rate());
+    }
+
+    ss::future<size_t> get_keys() {
+        co_await fill();
+        size_t found = 0;
+        perf_tests::start_measuring_time();
+        for (const auto& key : keys) {
+            found += (co_await map.get(key)).has_value() ? 1 : 0;
+        }
+        perf_tests::stop_measuring_time();
+        perf_tests::do_not_optimize(found);
+        co_return keys.size();
+    }
+
+    ss::future<size_t> put_keys() {
+        co_await fill();
+        perf_tests::start_measuring_time();
+        for (const auto& key : keys) {
+            auto inserted = co_await map.put(key, map.max_offset());
+            perf_tests::do_not_optimize(inserted);
+        }
+        perf_tests::stop_measuring_time();
+        co_return keys.size();
+    }
+
+    ss::future<size_t> get_missing_keys() {
+        co_await fill();
+        std::vector<storage::compaction_key> missing;
+        missing.reserve(probes);
+        for (size_t i = 0; i < probes; ++i) {
+            missing.emplace_back(random_generators::get_bytes(21));
+        }
+        size_t found = 0;
+        perf_tests::start_measuring_time();
+        for (const auto& key : missing) {
+            found += (co_await map.get(key)).has_value() ? 1 : 0;
+        }
+        perf_tests::stop_measuring_time();
+        perf_tests::do_not_optimize(found);
+        co_return missing.size();
+    }
+
+    storage::hash_key_offset_map map{KeyHash};
+    std::vector<storage::compaction_key> keys;
+};
+
+using key_map_bench = key_map_bench_t<model::compaction_key_hash::sha256>;
+using xxh3_key_map_bench = key_map_bench_t<model::compaction_key_hash::xxh3>;
+
+PERF_TEST_C(key_map_bench, key_map_get) { co_return co_await get_keys(); }
+PERF_TEST_C(key_map_bench, key_map_put) { co_return co_await put_keys(); }
+PERF_TEST_C(key_map_bench, key_map_get_missing) {
+    co_return co_await get_missing_keys();
+}
+
+PERF_TEST_C(xxh3_key_map_bench, key_map_get) {
+    co_return co_await get_keys();
+}
+PERF_TEST_C(xxh3_key_map_bench, key_map_put) {
+    co_return co_await put_keys();
+}
+PERF_TEST_C(xxh3_key_map_bench, key_map_get_missing) {
+    co_return co_await get_missing_keys();
+}
@@ -11,6 +11,7 @@
 #include "bytes/random.h"
 #include "random/generators.h"
 #include "storage/compacted_index.h"
+#include "storage/compacted_offset_list.h"
 #include "storage/compaction_reducers.h"
 
 #include <seastar/testing/thread_test_case.hh>
@@ -70,3 +71,24 @@ SEASTAR_THREAD_TEST_CASE(compaction_reducer_max_mem_usage_test) {
         BOOST_REQUIRE_LE(reducer.idx_mem_usage(), 16_KiB);
     }
 }
+
+SEASTAR_THREAD_TEST_CASE(compacted_offset_list_contains_range_test) {
+    storage::internal::compacted_offset_list list(
+      model::offset(100), roaring::Roaring{});
+    for (auto o : {100, 101, 102, 103, 105}) {
+        list.add(model::offset(o));
+    }
+
+    BOOST_REQUIRE(list.contains_range(model::offset(100), model::offset(103)));
+    BOOST_REQUIRE(list.contains_range(model::offset(101), model::offset(101)));
+    BOOST_REQUIRE(list.contains_range(model::offset(105), model::offset(105)));
+    // 104 was compacted away
+    BOOST_REQUIRE(
+      !list.contains_range(model::offset(100), model::offset(105)));
+    BOOST_REQUIRE(
+      !list.contains_range(model::offset(103), model::offset(104)));
+    // below the base or empty
+    BOOST_REQUIRE(!list.contains_range(model::offset(99), model::offset(101)));
+    BOOST_REQUIRE(
+      !list.contains_range(model::offset(102), model::offset(101)));
+}
@@ -0,0 +1,78 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "base/units.h"
+#include "model/compression.h"
+#include "model/record.h"
+#include "model/tests/random_batch.h"
+#include "ssx/thread_worker.h"
+#include "storage/compression_offload.h"
+#include "storage/parser_utils.h"
+
+#include <seastar/core/sharded.hh>
+#include <seastar/core/thread.hh>
+#include <seastar/testing/thread_test_case.hh>
+#include <seastar/util/defer.hh>
+
+namespace {
+
+model::record_batch make_batch(model::offset o) {
+    return model::test::make_random_batch(model::test::record_batch_spec{
+      .offset = o, .allow_compression = false, .count = 1, .records = 20});
+}
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(large_batches_are_offloaded) {
+    ssx::singleton_thread_worker worker;
+    worker.start({.name = "test"}).get();
+    auto stop_worker = ss::defer([&worker] { worker.stop().get(); });
+
+    ss::sharded<storage::compression_offload> offload;
+    offload
+      .start(
+        std::ref(worker),
+        ss::sharded_parameter(
+          [] { return config::mock_binding<std::optional<size_t>>(64); }),
+        2)
+      .get();
+    auto stop_offload = ss::defer([&offload] { offload.stop().get(); });
+    BOOST_REQUIRE(storage::compression_offload::local() == nullptr);
+    offload.invoke_on_all(&storage::compression_offload::start).get();
+
+    BOOST_REQUIRE(!offload.local().should_offload(63));
+    BOOST_REQUIRE(offload.local().should_offload(64));
+
+    // the batches of every shard roundtrip through the worker, inline and
+    // offloaded (de)compression are interchangeable
+    offload
+      .invoke_on_all([](storage::compression_offload& o) {
+          return ss::async([&o] {
+              for (auto c :
+                   {model::compression::zstd, model::compression::gzip}) {
+                  auto batch = make_batch(model::offset(0));
+                  BOOST_REQUIRE(o.should_offload(batch.data().size_bytes()));
+                  auto expected = batch.copy();
+                  auto compressed = storage::internal::compress_batch(
+                                      c, std::move(batch))
+                                      .get();
+                  BOOST_REQUIRE(compressed.compressed());
+                  auto inline_decompressed
+                    = storage::internal::maybe_decompress_batch_sync(
+                      compressed);
+                  BOOST_REQUIRE_EQUAL(inline_decompressed, expected);
+                  auto decompressed = storage::internal::decompress_batch(
+                                        std::move(compressed))
+                                        .get();
+                  BOOST_REQUIRE_EQUAL(decompressed, expected);
+              }
+          });
+      })
+      .get();
+}
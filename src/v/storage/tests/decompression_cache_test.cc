@@ -0,0 +1,84 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "base/units.h"
+#include "config/configuration.h"
+#include "model/compression.h"
+#include "model/record.h"
+#include "model/tests/random_batch.h"
+#include "storage/decompression_cache.h"
+#include "storage/parser_utils.h"
+
+#include <seastar/testing/thread_test_case.hh>
+#include <seastar/util/defer.hh>
+
+namespace {
+
+model::record_batch make_compressed_batch(model::offset o) {
+    auto batch = model::test::make_random_batch(model::test::record_batch_spec{
+      .offset = o, .allow_compression = false, .count = 1, .records = 10});
+    return storage::internal::compress_batch(
+             model::compression::zstd, std::move(batch))
+      .get();
+}
+
+auto set_cache_size(size_t size) {
+    config::shard_local_cfg().storage_decompression_cache_size.set_value(size);
+    return ss::defer([] {
+        config::shard_local_cfg().storage_decompression_cache_size.reset();
+    });
+}
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(decompressed_batches_are_shared) {
+    auto reset = set_cache_size(1_MiB);
+    storage::decompression_cache cache;
+    auto batch = make_compressed_batch(model::offset(0));
+    auto expected = storage::internal::maybe_decompress_batch_sync(batch);
+
+    BOOST_REQUIRE_EQUAL(cache.decompress(batch).get(), expected);
+    BOOST_REQUIRE_EQUAL(cache.misses(), 1);
+    BOOST_REQUIRE_EQUAL(cache.decompress(batch).get(), expected);
+    BOOST_REQUIRE_EQUAL(cache.hits(), 1);
+
+    // the header of a hit is the one of the batch asked for, e.g. once the
+    // batch was assigned offsets
+    auto appended = batch.copy();
+    appended.header().base_offset = model::offset(100);
+    auto expected_appended = storage::internal::maybe_decompress_batch_sync(
+      appended);
+    BOOST_REQUIRE_EQUAL(cache.decompress(appended).get(), expected_appended);
+    BOOST_REQUIRE_EQUAL(cache.hits(), 2);
+
+    // other records miss
+    auto other = make_compressed_batch(model::offset(0));
+    BOOST_REQUIRE_EQUAL(
+      cache.decompress(other).get(),
+      storage::internal::maybe_decompress_batch_sync(other));
+    BOOST_REQUIRE_EQUAL(cache.misses(), 2);
+}
+
+SEASTAR_THREAD_TEST_CASE(decompression_cache_is_bounded) {
+    auto reset = set_cache_size(1_MiB);
+    storage::decompression_cache cache;
+    for (int i = 0; i < 100; ++i) {
+        cache.decompress(make_compressed_batch(model::offset(0))).get();
+        BOOST_REQUIRE_LE(cache.size_bytes(), 1_MiB);
+    }
+
+    // disabling the cache drops its entries
+    config::shard_local_cfg().storage_decompression_cache_size.set_value(
+      size_t(0));
+    BOOST_REQUIRE_EQUAL(cache.size_bytes(), 0);
+    auto batch = make_compressed_batch(model::offset(0));
+    cache.decompress(batch).get();
+    cache.decompress(batch).get();
+    BOOST_REQUIRE_EQUAL(cache.hits(), 0);
+}
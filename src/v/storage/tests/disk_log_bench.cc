@@ -0,0 +1,343 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "base/units.h"
+#include "config/configuration.h"
+#include "config/mock_property.h"
+#include "features/feature_table.h"
+#include "model/fundamental.h"
+#include "model/record_batch_reader.h"
+#include "model/tests/random_batch.h"
+#include "model/timeout_clock.h"
+#include "random/generators.h"
+#include "storage/kvstore.h"
+#include "storage/log_manager.h"
+#include "storage/ntp_config.h"
+#include "storage/storage_resources.h"
+#include "storage/types.h"
+
+#include <seastar/core/abort_source.hh>
+#include <seastar/core/circular_buffer.hh>
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/seastar.hh>
+#include <seastar/coroutine/parallel_for_each.hh>
+#include <seastar/testing/perf_tests.hh>
+#include <seastar/util/file.hh>
+
+#include <boost/range/irange.hpp>
+#include <fmt/format.h>
+
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+/*
+ * Each run of a benchmark appends or reads about this much data, so that
+ * runs with different batch sizes and partition counts are comparable.
+ */
+constexpr size_t bytes_per_run = 32_MiB;
+
+ss::circular_buffer<model::record_batch>
+make_batches(size_t count, size_t batch_size, int key_cardinality = 0) {
+    static constexpr int records_per_batch = 4;
+    ss::circular_buffer<model::record_batch> batches;
+    for (size_t i = 0; i < count; ++i) {
+        model::test::record_batch_spec spec{
+          .allow_compression = false,
+          .count = records_per_batch,
+          .records = records_per_batch,
+          .record_sizes = std::vector<size_t>(
+            records_per_batch, batch_size / records_per_batch),
+          .timestamp = model::timestamp(static_cast<int64_t>(i)),
+        };
+        if (key_cardinality > 0) {
+            spec.max_key_cardinality = key_cardinality;
+        }
+        batches.push_back(model::test::make_random_batch(spec));
+    }
+    return batches;
+}
+
+struct bytes_consumer {
+    ss::future<ss::stop_iteration> operator()(model::record_batch b) {
+        bytes += b.size_bytes();
+        ++batches;
+        co_return ss::stop_iteration::no;
+    }
+    std::pair<size_t, size_t> end_of_stream() { return {batches, bytes}; }
+
+    size_t batches{0};
+    size_t bytes{0};
+};
+
+/*
+ * A log manager over a real directory, created once per benchmark. The data
+ * directory is removed when the benchmark is done.
+ */
+struct disk_log_bench {
+    disk_log_bench()
+      : dir(
+          "disk_log_bench." + random_generators::gen_alphanum_string(8)) {
+        config::shard_local_cfg().disable_metrics.set_value(true);
+        feature_table.start().get();
+        feature_table
+          .invoke_on_all(
+            [](features::feature_table& f) { f.testing_activate_all(); })
+          .get();
+        kvstore = std::make_unique<storage::kvstore>(
+          storage::kvstore_config(
+            1_MiB, config::mock_binding(10ms), dir, std::nullopt),
+          resources,
+          feature_table);
+        kvstore->start().get();
+        storage::log_config cfg(
+          dir, 128_MiB, ss::default_priority_class(), storage::with_cache::yes);
+        manager = std::make_unique<storage::log_manager>(
+          std::move(cfg), *kvstore, resources, feature_table);
+        manager->start().get();
+    }
+
+    disk_log_bench(const disk_log_bench&) = delete;
+    disk_log_bench& operator=(const disk_log_bench&) = delete;
+    disk_log_bench(disk_log_bench&&) = delete;
+    disk_log_bench& operator=(disk_log_bench&&) = delete;
+
+    ~disk_log_bench() {
+        logs.clear();
+        manager->stop().get();
+        kvstore->stop().get();
+        feature_table.stop().get();
+        ss::recursive_remove_directory(std::filesystem::path(dir)).get();
+        config::shard_local_cfg().disable_metrics.reset();
+    }
+
+    /// Open \p count partitions of a fresh topic, removing those of the
+    /// previous run.
+    ss::future<> manage(size_t count, bool compacted = false) {
+        for (auto& log : std::exchange(logs, {})) {
+            auto ntp = log->config().ntp();
+            log = nullptr;
+            co_await manager->remove(std::move(ntp));
+        }
+        auto topic = model::topic(
+          fmt::format("t{}", random_generators::gen_alphanum_string(8)));
+        for (size_t i = 0; i < count; ++i) {
+            auto overrides
+              = std::make_unique<storage::ntp_config::default_overrides>();
+            if (compacted) {
+                overrides->cleanup_policy_bitflags
+                  = model::cleanup_policy_bitflags::compaction;
+            }
+            logs.push_back(co_await manager->manage(storage::ntp_config(
+              model::ntp(model::kafka_namespace, topic, model::partition_id(i)),
+              manager->config().base_dir,
+              std::move(overrides))));
+        }
+    }
+
+    static ss::future<> append(
+      ss::shared_ptr<storage::log> log,
+      ss::circular_buffer<model::record_batch> batches) {
+        storage::log_append_config cfg{
+          storage::log_append_config::fsync::no,
+          ss::default_priority_class(),
+          model::no_timeout};
+        auto reader = model::make_memory_record_batch_reader(
+          std::move(batches));
+        co_await std::move(reader).for_each_ref(
+          log->make_appender(cfg), cfg.timeout);
+        co_await log->flush();
+    }
+
+    /// Fill each open log with \p count batches of \p batch_size bytes.
+    ss::future<> fill(size_t count, size_t batch_size, int keys = 0) {
+        for (auto& log : logs) {
+            co_await append(log, make_batches(count, batch_size, keys));
+        }
+    }
+
+    /*
+     * Append bytes_per_run spread over \p partitions logs, in appends of one
+     * batch of \p batch_size bytes each, and flush.
+     */
+    ss::future<size_t> append_bench(size_t batch_size, size_t partitions) {
+        co_await manage(partitions);
+        const size_t per_log = bytes_per_run / batch_size / partitions;
+        std::vector<ss::circular_buffer<model::record_batch>> batches;
+        for (size_t i = 0; i < partitions; ++i) {
+            batches.push_back(make_batches(per_log, batch_size));
+        }
+        perf_tests::start_measuring_time();
+        co_await ss::coroutine::parallel_for_each(
+          boost::irange<size_t>(0, partitions),
+          [this, &batches](size_t i) -> ss::future<> {
+              for (auto& b : batches[i]) {
+                  ss::circular_buffer<model::record_batch> one;
+                  one.push_back(std::move(b));
+                  co_await append(logs[i], std::move(one));
+              }
+          });
+        perf_tests::stop_measuring_time();
+        co_return per_log * partitions;
+    }
+
+    /// Read the newest batch of the log over and over, as a consumer at the
+    /// tail of the log does.
+    ss::future<size_t> tail_read_bench(size_t batch_size) {
+        const size_t count = bytes_per_run / batch_size;
+        co_await manage(1);
+        co_await fill(count, batch_size);
+        auto log = logs.front();
+        const auto last = log->offsets().dirty_offset;
+        perf_tests::start_measuring_time();
+        for (size_t i = 0; i < count; ++i) {
+            co_await read_one(log, last);
+        }
+        perf_tests::stop_measuring_time();
+        co_return count;
+    }
+
+    /// Read single batches from random offsets of the log.
+    ss::future<size_t> random_read_bench(size_t batch_size) {
+        const size_t count = bytes_per_run / batch_size;
+        co_await manage(1);
+        co_await fill(count, batch_size);
+        auto log = logs.front();
+        const auto last = log->offsets().dirty_offset;
+        std::vector<model::offset> offsets;
+        offsets.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            offsets.emplace_back(random_generators::get_int<int64_t>(last()));
+        }
+        perf_tests::start_measuring_time();
+        for (auto o : offsets) {
+            co_await read_one(log, o);
+        }
+        perf_tests::stop_measuring_time();
+        co_return count;
+    }
+
+    ss::future<size_t> timequery_bench() {
+        constexpr size_t count = 8192;
+        constexpr size_t queries = 1000;
+        co_await manage(1);
+        co_await fill(count, 4_KiB);
+        auto log = logs.front();
+        perf_tests::start_measuring_time();
+        for (size_t i = 0; i < queries; ++i) {
+            auto ts = model::timestamp(
+              random_generators::get_int<int64_t>(count - 1));
+            auto res = co_await log->timequery(storage::timequery_config(
+              ts,
+              log->offsets().dirty_offset,
+              ss::default_priority_class(),
+              std::nullopt));
+            perf_tests::do_not_optimize(res);
+        }
+        perf_tests::stop_measuring_time();
+        co_return queries;
+    }
+
+    /// Truncate the log back one batch at a time.
+    ss::future<size_t> truncate_bench() {
+        constexpr size_t count = 1024;
+        co_await manage(1);
+        co_await fill(count, 4_KiB);
+        auto log = logs.front();
+        perf_tests::start_measuring_time();
+        for (size_t i = 0; i < count - 1; ++i) {
+            auto last = log->offsets().dirty_offset;
+            co_await log->truncate(storage::truncate_config(
+              model::offset(last() - 3), ss::default_priority_class()));
+        }
+        perf_tests::stop_measuring_time();
+        co_return count - 1;
+    }
+
+    /// Compact a log of small segments with a bounded number of keys.
+    ss::future<size_t> compaction_bench() {
+        constexpr size_t segments = 16;
+        constexpr size_t batches_per_segment = 256;
+        co_await manage(1, true);
+        auto log = logs.front();
+        for (size_t i = 0; i < segments; ++i) {
+            co_await append(
+              log, make_batches(batches_per_segment, 4_KiB, 1000));
+            co_await log->force_roll(ss::default_priority_class());
+        }
+        ss::abort_source as;
+        storage::housekeeping_config cfg(
+          model::timestamp::min(),
+          std::nullopt,
+          log->offsets().committed_offset,
+          ss::default_priority_class(),
+          as);
+        perf_tests::start_measuring_time();
+        co_await log->housekeeping(cfg);
+        perf_tests::stop_measuring_time();
+        co_return segments * batches_per_segment;
+    }
+
+    static ss::future<>
+    read_one(ss::shared_ptr<storage::log> log, model::offset o) {
+        storage::log_reader_config cfg(o, o, ss::default_priority_class());
+        cfg.max_bytes = 1;
+        cfg.skip_batch_cache = true;
+        auto reader = co_await log->make_reader(cfg);
+        auto res = co_await std::move(reader).consume(
+          bytes_consumer{}, model::no_timeout);
+        perf_tests::do_not_optimize(res);
+    }
+
+    ss::sstring dir;
+    storage::storage_resources resources;
+    ss::sharded<features::feature_table> feature_table;
+    std::unique_ptr<storage::kvstore> kvstore;
+    std::unique_ptr<storage::log_manager> manager;
+    std::vector<ss::shared_ptr<storage::log>> logs;
+};
+
+} // namespace
+
+PERF_TEST_C(disk_log_bench, append_1KiB_1p) {
+    co_return co_await append_bench(1_KiB, 1);
+}
+PERF_TEST_C(disk_log_bench, append_16KiB_1p) {
+    co_return co_await append_bench(16_KiB, 1);
+}
+PERF_TEST_C(disk_log_bench, append_128KiB_1p) {
+    co_return co_await append_bench(128_KiB, 1);
+}
+PERF_TEST_C(disk_log_bench, append_16KiB_16p) {
+    co_return co_await append_bench(16_KiB, 16);
+}
+PERF_TEST_C(disk_log_bench, append_16KiB_128p) {
+    co_return co_await append_bench(16_KiB, 128);
+}
+PERF_TEST_C(disk_log_bench, tail_read_16KiB) {
+    co_return co_await tail_read_bench(16_KiB);
+}
+PERF_TEST_C(disk_log_bench, random_read_1KiB) {
+    co_return co_await random_read_bench(1_KiB);
+}
+PERF_TEST_C(disk_log_bench, random_read_16KiB) {
+    co_return co_await random_read_bench(16_KiB);
+}
+PERF_TEST_C(disk_log_bench, timequery) { co_return co_await timequery_bench(); }
+PERF_TEST_C(disk_log_bench, truncate) { co_return co_await truncate_bench(); }
+PERF_TEST_C(disk_log_bench, compaction) {
+    co_return co_await compaction_bench();
+}
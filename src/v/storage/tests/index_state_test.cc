@@ -1,4 +1,5 @@
 #define BOOST_TEST_MODULE storage
+#include "base/units.h"
 #include "bytes/bytes.h"
 #include "random/generators.h"
 #include "serde/serde.h"
@@ -244,3 +245,90 @@ BOOST_AUTO_TEST_CASE(offset_time_index_test) {
         }
     }
 }
+
+static storage::index_state make_sorted_index_state(size_t n) {
+    auto st = storage::index_state::make_empty_index(
+      storage::offset_delta_time::yes);
+    st.base_offset = model::offset(1000);
+    st.base_timestamp = model::timestamp(1000000);
+    uint32_t offset = 0;
+    int64_t time = 0;
+    uint64_t pos = 0;
+    for (size_t i = 0; i < n; ++i) {
+        st.add_entry(
+          offset,
+          storage::offset_time_index{
+            model::timestamp{time}, storage::offset_delta_time::yes},
+          pos);
+        offset += random_generators::get_int<uint32_t>(1, 1000);
+        time += random_generators::get_int<int64_t>(0, 100);
+        pos += random_generators::get_int<uint64_t>(1, 64_KiB);
+    }
+    return st;
+}
+
+BOOST_AUTO_TEST_CASE(packed_index_lookups) {
+    for (size_t n : {64, 100, 1000, 4099}) {
+        auto st = make_sorted_index_state(n);
+        auto packed = st.copy();
+        BOOST_REQUIRE(packed.pack());
+        BOOST_REQUIRE(packed.is_packed());
+        BOOST_REQUIRE(packed.relative_offset_index.empty());
+        BOOST_REQUIRE_EQUAL(packed.size(), n);
+        BOOST_REQUIRE(packed == st);
+        BOOST_REQUIRE_LT(
+          packed.entries_memory_usage(), st.entries_memory_usage());
+
+        for (size_t i = 0; i < n; ++i) {
+            auto [o, t, p] = st.get_entry(i);
+            auto [po, pt, pp] = packed.get_entry(i);
+            BOOST_REQUIRE_EQUAL(o, po);
+            BOOST_REQUIRE_EQUAL(t(), pt());
+            BOOST_REQUIRE_EQUAL(p, pp);
+
+            for (auto delta : {-1, 0, 1}) {
+                BOOST_REQUIRE_EQUAL(
+                  st.lower_bound_offset(o + delta),
+                  packed.lower_bound_offset(o + delta));
+                BOOST_REQUIRE_EQUAL(
+                  st.upper_bound_position(p + delta),
+                  packed.upper_bound_position(p + delta));
+                auto ts = model::timestamp(t() + delta);
+                auto e = st.find_entry(ts);
+                auto pe = packed.find_entry(ts);
+                BOOST_REQUIRE_EQUAL(e.has_value(), pe.has_value());
+                if (e) {
+                    BOOST_REQUIRE_EQUAL(std::get<0>(*e), std::get<0>(*pe));
+                    BOOST_REQUIRE_EQUAL(std::get<2>(*e), std::get<2>(*pe));
+                }
+            }
+        }
+
+        // serialized form is unchanged
+        iobuf expected;
+        iobuf actual;
+        st.serde_write(expected);
+        packed.serde_write(actual);
+        BOOST_REQUIRE_EQUAL(expected, actual);
+
+        // modifications unpack the entries
+        packed.pop_back();
+        BOOST_REQUIRE(!packed.is_packed());
+        BOOST_REQUIRE_EQUAL(packed.size(), n - 1);
+        st.pop_back();
+        BOOST_REQUIRE(packed == st);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(packed_index_skips_small_and_unsorted) {
+    auto small = make_sorted_index_state(
+      storage::index_state::min_packed_entries - 1);
+    BOOST_REQUIRE(!small.pack());
+    BOOST_REQUIRE(!small.is_packed());
+
+    auto unsorted = make_sorted_index_state(1000);
+    std::swap(
+      unsorted.relative_offset_index[10], unsorted.relative_offset_index[20]);
+    BOOST_REQUIRE(!unsorted.pack());
+    BOOST_REQUIRE(!unsorted.is_packed());
+}
@@ -9,6 +9,9 @@
  * by the Apache License, Version 2.0
  */
 #include "base/units.h"
+#include "base/vassert.h"
+#include "serde/serde.h"
+#include "storage/compaction_key_filter.h"
 #include "storage/key_offset_map.h"
 
 #include <gtest/gtest.h>
@@ -20,6 +23,27 @@ storage::compaction_key k(std::string_view key) {
 }
 
 model::offset o(int o) { return model::offset(o); }
+
+storage::compaction_key_filter::fingerprint_type
+fingerprint(const storage::compaction_key& key) {
+    hash_sha256 h;
+    h.update(key);
+    return storage::compaction_key_filter::fingerprint(h.reset());
+}
+
+storage::compaction_key_filter make_filter(
+  std::string_view prefix,
+  int count,
+  model::offset offset,
+  model::compaction_key_hash key_hash = model::compaction_key_hash::sha256) {
+    storage::compaction_key_filter::builder builder(key_hash);
+    for (int i = 0; i < count; ++i) {
+        builder.add(k(fmt::format("{}-{}", prefix, i)));
+    }
+    auto filter = std::move(builder).build(offset).get();
+    vassert(filter.has_value(), "Filter of {} keys wasn't built", count);
+    return std::move(filter.value());
+}
 } // namespace
 
 template<typename T>
@@ -37,8 +61,18 @@ public:
     default_sized_hash_key_offset_map() { initialize(1_MiB).get(); }
 };
 
-using test_types = ::testing::
-  Types<storage::simple_key_offset_map, default_sized_hash_key_offset_map>;
+class default_sized_xxh3_key_offset_map : public storage::hash_key_offset_map {
+public:
+    default_sized_xxh3_key_offset_map()
+      : storage::hash_key_offset_map(model::compaction_key_hash::xxh3) {
+        initialize(1_MiB).get();
+    }
+};
+
+using test_types = ::testing::Types<
+  storage::simple_key_offset_map,
+  default_sized_hash_key_offset_map,
+  default_sized_xxh3_key_offset_map>;
 
 TYPED_TEST_SUITE(KeyOffsetMapTest, test_types);
 
@@ -205,7 +239,33 @@ TEST(HashKeyOffsetMapTest, HitRate) {
         ++i;
     }
 
-    EXPECT_LE(map.hit_rate(), 0.3) << fmt::format("Inserted {}", i);
+    // most searches are resolved by the first group probed, even when full
+    EXPECT_GE(map.hit_rate(), 0.5) << fmt::format("Inserted {}", i);
+}
+
+TEST(HashKeyOffsetMapTest, Density) {
+    storage::hash_key_offset_map map;
+    map.initialize(1_MiB).get();
+
+    // a slot and its control word take 25 bytes
+    EXPECT_GE(map.capacity(), 1_MiB / 32);
+
+    int i = 0;
+    for (;; ++i) {
+        const auto key = fmt::format("key-{}", i);
+        storage::compaction_key ck(bytes(key.begin(), key.end()));
+        if (!map.put(ck, model::offset(i)).get()) {
+            break;
+        }
+    }
+    EXPECT_EQ(map.size(), map.capacity());
+
+    // every key maps to its own fingerprint
+    for (int j = 0; j < i; ++j) {
+        const auto key = fmt::format("key-{}", j);
+        storage::compaction_key ck(bytes(key.begin(), key.end()));
+        ASSERT_EQ(map.get(ck).get(), model::offset(j));
+    }
 }
 
 TEST(HashKeyOffsetMapTest, Initialize) {
@@ -261,3 +321,96 @@ TEST(HashKeyOffsetMapTest, Initialize) {
         ASSERT_EQ(val.value(), model::offset(99));
     }
 }
+
+TEST(CompactionKeyFilterTest, MayContain) {
+    const auto filter = make_filter("key", 10000, o(100));
+    EXPECT_EQ(filter.committed_offset(), o(100));
+
+    // no false negatives
+    for (int i = 0; i < 10000; ++i) {
+        ASSERT_TRUE(
+          filter.may_contain(fingerprint(k(fmt::format("key-{}", i)))));
+    }
+
+    // 10 bits per key gives a false positive rate of about 1%
+    int false_positives = 0;
+    for (int i = 0; i < 10000; ++i) {
+        if (filter.may_contain(fingerprint(k(fmt::format("other-{}", i))))) {
+            ++false_positives;
+        }
+    }
+    EXPECT_LT(false_positives, 300);
+}
+
+TEST(CompactionKeyFilterTest, Serde) {
+    auto filter = make_filter("key", 1000, o(100));
+    auto copy = serde::from_iobuf<storage::compaction_key_filter>(
+      serde::to_iobuf(std::move(filter)));
+    EXPECT_EQ(copy.committed_offset(), o(100));
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_TRUE(copy.may_contain(fingerprint(k(fmt::format("key-{}", i)))));
+    }
+}
+
+TEST(CompactionKeyFilterTest, BuilderOverflow) {
+    storage::compaction_key_filter::builder builder;
+    for (size_t i = 0; i <= storage::compaction_key_filter::max_keys; ++i) {
+        builder.add(k(fmt::format("key-{}", i)));
+    }
+    EXPECT_FALSE(std::move(builder).build(o(100)).get().has_value());
+}
+
+TEST(HashKeyOffsetMapTest, MayShareKeys) {
+    storage::hash_key_offset_map map;
+    map.initialize(1_MiB).get();
+    const auto filter = make_filter("key", 1000, o(100));
+
+    // an empty map shares no keys with anything
+    EXPECT_FALSE(map.may_share_keys(filter).get());
+
+    ASSERT_TRUE(map.put(k("other"), o(1)).get());
+    EXPECT_FALSE(map.may_share_keys(filter).get());
+
+    ASSERT_TRUE(map.put(k("key-500"), o(2)).get());
+    EXPECT_TRUE(map.may_share_keys(filter).get());
+}
+
+TEST(CompactionKeyFilterTest, SerdeKeepsKeyHash) {
+    auto filter = make_filter(
+      "key", 1000, o(100), model::compaction_key_hash::xxh3);
+    EXPECT_EQ(filter.key_hash(), model::compaction_key_hash::xxh3);
+    auto copy = serde::from_iobuf<storage::compaction_key_filter>(
+      serde::to_iobuf(std::move(filter)));
+    EXPECT_EQ(copy.key_hash(), model::compaction_key_hash::xxh3);
+
+    storage::compaction_key_hasher hasher(model::compaction_key_hash::xxh3);
+    for (int i = 0; i < 1000; ++i) {
+        const auto digest = hasher.hash(k(fmt::format("key-{}", i)));
+        ASSERT_TRUE(copy.may_contain(
+          storage::compaction_key_filter::fingerprint(digest)));
+    }
+}
+
+TEST(HashKeyOffsetMapTest, MayShareKeysXxh3) {
+    storage::hash_key_offset_map map(model::compaction_key_hash::xxh3);
+    map.initialize(1_MiB).get();
+    const auto filter = make_filter(
+      "key", 1000, o(100), model::compaction_key_hash::xxh3);
+    EXPECT_FALSE(map.may_share_keys(filter).get());
+
+    ASSERT_TRUE(map.put(k("other"), o(1)).get());
+    EXPECT_FALSE(map.may_share_keys(filter).get());
+
+    ASSERT_TRUE(map.put(k("key-500"), o(2)).get());
+    EXPECT_TRUE(map.may_share_keys(filter).get());
+}
+
+TEST(HashKeyOffsetMapTest, MayShareKeysOtherKeyHash) {
+    // the fingerprints of a filter built with another hash function can't be
+    // compared with the map's, so the filter may share any key
+    storage::hash_key_offset_map map(model::compaction_key_hash::xxh3);
+    map.initialize(1_MiB).get();
+    const auto filter = make_filter("key", 1000, o(100));
+    ASSERT_TRUE(map.put(k("other"), o(1)).get());
+    EXPECT_TRUE(map.may_share_keys(filter).get());
+}
@@ -188,3 +188,47 @@ FIXTURE_TEST(kvstore, kvstore_test_fixture) {
     }
     kvs->stop().get();
 }
+
+FIXTURE_TEST(kvstore_coalesced_writes, kvstore_test_fixture) {
+    set_configuration("disable_metrics", true);
+    // flush on size as well as on the commit interval
+    set_configuration("kvstore_flush_bytes", size_t(1024));
+
+    std::unordered_map<bytes, iobuf> truth;
+    std::vector<ss::future<>> writes;
+
+    auto kvs = make_kvstore();
+    kvs->start().get();
+    // many writes to few keys, issued without waiting so that operations on
+    // the same key land in the same flush. enough data is written to roll
+    // segments and snapshot in the background while writing continues.
+    for (int i = 0; i < 2000; i++) {
+        auto k = random_generators::get_bytes(1);
+        auto value = bytes_to_iobuf(random_generators::get_bytes(50));
+        truth[k] = value.copy();
+        writes.push_back(
+          kvs->put(storage::kvstore::key_space::testing, k, std::move(value)));
+    }
+    ss::when_all_succeed(writes.begin(), writes.end()).get();
+
+    for (auto& e : truth) {
+        BOOST_REQUIRE(
+          kvs->get(storage::kvstore::key_space::testing, e.first).value()
+          == e.second);
+    }
+    kvs->stop().get();
+    kvs.reset(nullptr);
+
+    // the last write to each key survives a restart
+    kvs = make_kvstore();
+    kvs->start().get();
+    for (auto& e : truth) {
+        BOOST_REQUIRE(
+          kvs->get(storage::kvstore::key_space::testing, e.first).value()
+          == e.second);
+    }
+    kvs->stop().get();
+    ss::smp::invoke_on_all([] {
+        config::shard_local_cfg().kvstore_flush_bytes.reset();
+    }).get();
+}
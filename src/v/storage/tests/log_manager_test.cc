@@ -142,4 +142,9 @@ SEASTAR_THREAD_TEST_CASE(test_can_load_logs) {
     BOOST_CHECK(!file_exists(seg4->reader().filename()).get0());
     BOOST_CHECK(
       file_exists(seg4->reader().filename() + ".cannotrecover").get0());
+
+    // the unrecoverable segment was replayed before being set aside
+    const auto& stats = m.get(ntps[3].ntp())->get_probe().recovery_stats();
+    BOOST_CHECK_EQUAL(stats.segments_replayed, 1);
+    BOOST_CHECK_GT(stats.bytes_replayed, 0);
 }
@@ -7,6 +7,7 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "config/configuration.h"
 #include "model/record.h"
 #include "model/record_batch_reader.h"
 #include "model/record_utils.h"
@@ -16,11 +17,14 @@
 #include "storage/disk_log_appender.h"
 #include "storage/file_sanitizer.h"
 #include "storage/log_reader.h"
+#include "storage/paging.h"
 #include "storage/parser_utils.h"
+#include "storage/reader_handle_cache.h"
 #include "storage/segment.h"
 #include "storage/segment_appender.h"
 #include "storage/segment_appender_utils.h"
 #include "storage/segment_reader.h"
+#include "storage/storage_resources.h"
 #include "utils/disk_log_builder.h"
 
 #include <seastar/core/thread.hh>
@@ -318,3 +322,164 @@ SEASTAR_THREAD_TEST_CASE(iobuf_is_zero_test) {
     zero.append(zeros.data(), zeros.size());
     BOOST_REQUIRE_EQUAL(storage::internal::is_zero(zero), true);
 }
+
+SEASTAR_THREAD_TEST_CASE(test_paged_segment_reader) {
+    const ss::sstring name = "paged."
+                             + random_generators::gen_alphanum_string(20);
+    const auto data = random_generators::gen_alphanum_string(100_KiB);
+    {
+        auto fd = ss::open_file_dma(
+                    name, ss::open_flags::create | ss::open_flags::rw)
+                    .get0();
+        auto out = ss::make_file_output_stream(std::move(fd)).get0();
+        out.write(data.data(), data.size()).get();
+        out.close().get();
+    }
+
+    storage::internal::paging_context paging(64_KiB, 1);
+    segment_reader reader(segment_full_path::mock(name), 16_KiB, 0);
+    reader.load_size().get();
+    reader.set_pager(paging.make_pager(std::filesystem::path(name)));
+
+    auto read_range = [&reader](size_t begin, size_t end) {
+        auto handle = reader
+                        .data_stream(begin, end, ss::default_priority_class())
+                        .get0();
+        auto buf = handle.stream().read_exactly(end - begin).get0();
+        handle.close().get();
+        return ss::sstring(buf.get(), buf.size());
+    };
+
+    // unaligned range larger than the cache
+    BOOST_REQUIRE_EQUAL(read_range(10, data.size()), data.substr(10));
+    BOOST_REQUIRE_EQUAL(read_range(4000, 9000), data.substr(4000, 5000));
+
+    // appended batches are visible from memory before being read from disk
+    auto batch = model::test::make_random_batch(model::offset(0), 1, false);
+    auto expected = storage::disk_header_to_iobuf(batch.header());
+    expected.append(batch.data().copy());
+    reader.populate_pages(data.size(), batch);
+    reader.set_file_size(data.size() + expected.size_bytes());
+    auto tail = read_range(data.size(), reader.file_size());
+    iobuf actual;
+    actual.append(tail.data(), tail.size());
+    BOOST_REQUIRE(actual == expected);
+
+    reader.close().get();
+    ss::remove_file(name).get();
+}
+
+SEASTAR_THREAD_TEST_CASE(test_reader_handle_cache) {
+    auto make_file = [](const ss::sstring& name) {
+        auto fd = ss::open_file_dma(
+                    name, ss::open_flags::create | ss::open_flags::rw)
+                    .get0();
+        auto out = ss::make_file_output_stream(std::move(fd)).get0();
+        out.write(name.data(), name.size()).get();
+        out.close().get();
+    };
+    const ss::sstring name_a = "handles."
+                               + random_generators::gen_alphanum_string(20);
+    const ss::sstring name_b = "handles."
+                               + random_generators::gen_alphanum_string(20);
+    make_file(name_a);
+    make_file(name_b);
+
+    config::shard_local_cfg().storage_reader_handle_cache_size.set_value(
+      size_t{1});
+    auto& cache = storage::internal::reader_handles();
+    const auto& probe = cache.probe();
+    const auto opened = probe.opened();
+    const auto reused = probe.reused();
+    const auto evicted = probe.evicted();
+
+    segment_reader a(segment_full_path::mock(name_a), 4_KiB, 0);
+    segment_reader b(segment_full_path::mock(name_b), 4_KiB, 0);
+    // loading the size doesn't need a file handle
+    a.load_size().get();
+    b.load_size().get();
+    BOOST_REQUIRE_EQUAL(a.file_size(), name_a.size());
+    BOOST_REQUIRE_EQUAL(probe.opened(), opened);
+
+    auto read = [](segment_reader& r) {
+        auto handle = r.data_stream(0, ss::default_priority_class()).get0();
+        auto buf = handle.stream().read_exactly(r.file_size()).get0();
+        handle.close().get();
+        return ss::sstring(buf.get(), buf.size());
+    };
+
+    // the idle handle is kept open and reused by the next read
+    BOOST_REQUIRE_EQUAL(read(a), name_a);
+    BOOST_REQUIRE_EQUAL(cache.size(), 1);
+    BOOST_REQUIRE_EQUAL(read(a), name_a);
+    BOOST_REQUIRE_EQUAL(probe.opened(), opened + 1);
+    BOOST_REQUIRE_EQUAL(probe.reused(), reused + 1);
+
+    // a second idle handle exceeds the budget and evicts the first
+    BOOST_REQUIRE_EQUAL(read(b), name_b);
+    BOOST_REQUIRE_EQUAL(cache.size(), 1);
+    BOOST_REQUIRE_EQUAL(probe.evicted(), evicted + 1);
+    BOOST_REQUIRE_EQUAL(read(a), name_a);
+    BOOST_REQUIRE_EQUAL(probe.opened(), opened + 3);
+
+    a.close().get();
+    b.close().get();
+    BOOST_REQUIRE_EQUAL(cache.size(), 0);
+    config::shard_local_cfg().storage_reader_handle_cache_size.reset();
+    ss::remove_file(name_a).get();
+    ss::remove_file(name_b).get();
+}
+
+SEASTAR_THREAD_TEST_CASE(test_adaptive_readahead_stream) {
+    const ss::sstring name = "readahead."
+                             + random_generators::gen_alphanum_string(20);
+    const auto data = random_generators::gen_alphanum_string(100_KiB);
+    {
+        auto fd = ss::open_file_dma(
+                    name, ss::open_flags::create | ss::open_flags::rw)
+                    .get0();
+        auto out = ss::make_file_output_stream(std::move(fd)).get0();
+        out.write(data.data(), data.size()).get();
+        out.close().get();
+    }
+
+    config::shard_local_cfg().storage_read_readahead_memory.set_value(
+      size_t{64_KiB});
+    storage::storage_resources resources;
+
+    segment_reader reader(segment_full_path::mock(name), 4_KiB, 1);
+    reader.load_size().get();
+
+    auto history = ss::make_lw_shared<ss::file_input_stream_history>();
+    auto read_all = [&reader, &resources, &history] {
+        auto units = resources.try_get_readahead_units(
+          reader.buffer_size() * 9);
+        BOOST_REQUIRE(units.has_value());
+        auto handle = reader
+                        .data_stream(
+                          0,
+                          ss::default_priority_class(),
+                          storage::adaptive_readahead{
+                            .history = history,
+                            .max_read_ahead = 8,
+                            .units = std::move(*units)})
+                        .get0();
+        // the reservation is held for as long as the stream is open
+        BOOST_REQUIRE(
+          !resources.try_get_readahead_units(reader.buffer_size() * 9));
+        auto buf = handle.stream().read_exactly(reader.file_size()).get0();
+        handle.close().get();
+        return ss::sstring(buf.get(), buf.size());
+    };
+
+    // the history carries over to the next stream of the same consumer
+    BOOST_REQUIRE_EQUAL(read_all(), data);
+    BOOST_REQUIRE_EQUAL(read_all(), data);
+
+    // closing the streams returned their reservations
+    BOOST_REQUIRE(resources.try_get_readahead_units(64_KiB));
+
+    reader.close().get();
+    config::shard_local_cfg().storage_read_readahead_memory.reset();
+    ss::remove_file(name).get();
+}
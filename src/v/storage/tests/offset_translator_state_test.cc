@@ -10,6 +10,7 @@
  */
 
 #include "model/fundamental.h"
+#include "random/generators.h"
 #include "storage/offset_translator_state.h"
 
 #include <seastar/testing/thread_test_case.hh>
@@ -17,6 +18,7 @@
 
 #include <cstdint>
 #include <stdexcept>
+#include <vector>
 
 static const model::ntp ntp;
 
@@ -151,3 +153,88 @@ SEASTAR_THREAD_TEST_CASE(offset_translator_state_case_2) {
     BOOST_REQUIRE_EQUAL(state.last_delta(), 10_do);
     BOOST_REQUIRE_EQUAL(state.last_gap_offset(), 100_rp);
 }
+
+SEASTAR_THREAD_TEST_CASE(offset_translator_state_merge_adjacent) {
+    storage::offset_translator_state state(ntp, 9_rp, 5);
+
+    // [10..gap..11][12..gap..14] data [17..gap..17]
+    state.add_gap(10_rp, 11_rp);
+    state.add_gap(12_rp, 14_rp);
+    state.add_gap(17_rp, 17_rp);
+    BOOST_REQUIRE_EQUAL(state.last_delta(), 11_do);
+    BOOST_REQUIRE_EQUAL(state.last_gap_offset(), 17_rp);
+    // the two adjacent batches share one entry
+    BOOST_REQUIRE_NE(
+      fmt::format("{}", state).find("map size: 3"), std::string::npos);
+
+    BOOST_REQUIRE_EQUAL(state.delta(12_rp), 7);
+    BOOST_REQUIRE_EQUAL(state.from_log_offset(15_rp), 5_rp);
+    BOOST_REQUIRE_EQUAL(state.to_log_offset(5_rp), 15_rp);
+    BOOST_REQUIRE_EQUAL(state.to_log_offset(7_rp), 18_rp);
+
+    // either half of the run may be added again
+    state.add_gap(12_rp, 14_rp);
+    state.add_gap(10_rp, 11_rp);
+    BOOST_REQUIRE_EQUAL(state.last_delta(), 11_do);
+
+    // truncating at a batch within the run keeps the part before it
+    BOOST_REQUIRE(state.truncate(12_rp));
+    BOOST_REQUIRE_EQUAL(state.last_delta(), 7_do);
+    BOOST_REQUIRE_EQUAL(state.last_gap_offset(), 11_rp);
+    state.add_gap(12_rp, 14_rp);
+
+    // prefix truncating after a batch within the run keeps the rest of it
+    BOOST_REQUIRE(state.prefix_truncate(11_rp));
+    BOOST_REQUIRE_EQUAL(state.delta(12_rp), 7);
+    BOOST_REQUIRE_EQUAL(state.delta(15_rp), 10);
+    BOOST_REQUIRE_EQUAL(state.to_log_offset(5_rp), 15_rp);
+}
+
+SEASTAR_THREAD_TEST_CASE(offset_translator_state_translate_random) {
+    // a log of random data and non-data batches, with the kafka offset of
+    // each log offset being the number of data records before it
+    static constexpr int64_t log_size = 5000;
+    storage::offset_translator_state state(ntp, model::offset{-1}, 0);
+    std::vector<model::offset> kafka_offsets;
+    std::vector<model::offset> data_offsets;
+    std::vector<model::offset> batch_bases;
+    int64_t o = 0;
+    while (o < log_size) {
+        const auto length = random_generators::get_int<int64_t>(1, 5);
+        const auto data = random_generators::get_int(0, 2) == 0;
+        batch_bases.push_back(model::offset{o});
+        if (!data) {
+            state.add_gap(model::offset{o}, model::offset{o + length - 1});
+        }
+        for (int64_t i = 0; i < length; ++i) {
+            kafka_offsets.emplace_back(data_offsets.size());
+            if (data) {
+                data_offsets.emplace_back(o + i);
+            }
+        }
+        o += length;
+    }
+
+    auto check = [&](const storage::offset_translator_state& s, int64_t from) {
+        for (auto i = from; i < o; ++i) {
+            BOOST_REQUIRE_EQUAL(
+              s.from_log_offset(model::offset{i}), kafka_offsets[i]);
+        }
+        for (size_t k = 0; k < data_offsets.size(); ++k) {
+            if (data_offsets[k] < model::offset{from}) {
+                continue;
+            }
+            BOOST_REQUIRE_EQUAL(
+              s.to_log_offset(model::offset(k)), data_offsets[k]);
+        }
+    };
+    check(state, 0);
+    check(
+      storage::offset_translator_state::from_serialized_map(
+        ntp, state.serialize_map()),
+      0);
+
+    const auto start = batch_bases[batch_bases.size() / 2];
+    BOOST_REQUIRE(state.prefix_truncate(model::prev_offset(start)));
+    check(state, start());
+}
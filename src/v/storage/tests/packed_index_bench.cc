@@ -0,0 +1,129 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "base/units.h"
+#include "model/timestamp.h"
+#include "random/generators.h"
+#include "storage/index_state.h"
+
+#include <seastar/testing/perf_tests.hh>
+
+#include <fmt/format.h>
+
+#include <vector>
+
+namespace {
+
+// a 1GiB segment indexed every 32KiB
+constexpr size_t entries_per_segment = 32_KiB;
+constexpr size_t lookups = 1000;
+
+storage::index_state make_index() {
+    auto st = storage::index_state::make_empty_index(
+      storage::offset_delta_time::yes);
+    uint32_t offset = 0;
+    int64_t time = 0;
+    uint64_t pos = 0;
+    for (size_t i = 0; i < entries_per_segment; ++i) {
+        st.add_entry(
+          offset,
+          storage::offset_time_index{
+            model::timestamp{time}, storage::offset_delta_time::yes},
+          pos);
+        offset += random_generators::get_int<uint32_t>(1, 500);
+        time += random_generators::get_int<int64_t>(0, 50);
+        pos += random_generators::get_int<uint64_t>(32_KiB, 33_KiB);
+    }
+    return st;
+}
+
+struct index_bench {
+    index_bench()
+      : unpacked(make_index())
+      , packed(unpacked.copy()) {
+        packed.pack();
+        auto [max_offset, max_time, max_pos] = unpacked.get_entry(
+          unpacked.size() - 1);
+        for (size_t i = 0; i < lookups; ++i) {
+            offsets.push_back(random_generators::get_int<uint32_t>(max_offset));
+            times.push_back(model::timestamp(
+              random_generators::get_int<int64_t>(max_time())));
+            positions.push_back(random_generators::get_int<uint64_t>(max_pos));
+        }
+
+        static bool reported = false;
+        if (!reported) {
+            reported = true;
+            fmt::print(
+              "index memory per segment ({} entries): unpacked {} bytes, "
+              "packed {} bytes\n",
+              entries_per_segment,
+              unpacked.entries_memory_usage(),
+              packed.entries_memory_usage());
+        }
+    }
+
+    size_t find_offsets(const storage::index_state& st) {
+        size_t acc = 0;
+        perf_tests::start_measuring_time();
+        for (auto o : offsets) {
+            acc += st.lower_bound_offset(o);
+        }
+        perf_tests::stop_measuring_time();
+        perf_tests::do_not_optimize(acc);
+        return offsets.size();
+    }
+
+    size_t find_times(storage::index_state& st) {
+        size_t acc = 0;
+        perf_tests::start_measuring_time();
+        for (auto t : times) {
+            acc += std::get<2>(st.find_entry(t).value());
+        }
+        perf_tests::stop_measuring_time();
+        perf_tests::do_not_optimize(acc);
+        return times.size();
+    }
+
+    size_t find_positions(const storage::index_state& st) {
+        size_t acc = 0;
+        perf_tests::start_measuring_time();
+        for (auto p : positions) {
+            acc += st.upper_bound_position(p);
+        }
+        perf_tests::stop_measuring_time();
+        perf_tests::do_not_optimize(acc);
+        return positions.size();
+    }
+
+    storage::index_state unpacked;
+    storage::index_state packed;
+    std::vector<uint32_t> offsets;
+    std::vector<model::timestamp> times;
+    std::vector<uint64_t> positions;
+};
+
+} // namespace
+
+PERF_TEST_F(index_bench, offset_lookup_unpacked) {
+    return find_offsets(unpacked);
+}
+PERF_TEST_F(index_bench, offset_lookup_packed) { return find_offsets(packed); }
+
+PERF_TEST_F(index_bench, timestamp_lookup_unpacked) {
+    return find_times(unpacked);
+}
+PERF_TEST_F(index_bench, timestamp_lookup_packed) { return find_times(packed); }
+
+PERF_TEST_F(index_bench, position_lookup_unpacked) {
+    return find_positions(unpacked);
+}
+PERF_TEST_F(index_bench, position_lookup_packed) {
+    return find_positions(packed);
+}
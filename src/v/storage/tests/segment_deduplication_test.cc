@@ -7,6 +7,7 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "config/configuration.h"
 #include "gmock/gmock.h"
 #include "random/generators.h"
 #include "storage/chunk_cache.h"
@@ -116,6 +117,29 @@ TEST(FindSlidingRangeTest, TestCollectExcludesPrevious) {
     ASSERT_EQ(segs.front()->offsets().base_offset(), 0);
 }
 
+TEST(FindSlidingRangeTest, TestDirtyRatio) {
+    storage::disk_log_builder b;
+    build_segments(b, 3);
+    auto cleanup = ss::defer([&] {
+        config::shard_local_cfg().min_cleanable_dirty_ratio.reset();
+        b.stop().get();
+    });
+    auto& disk_log = b.get_disk_log_impl();
+
+    // the threshold is disabled by default
+    ASSERT_TRUE(disk_log.is_dirty_enough_to_compact());
+
+    // every segment has been compacted
+    config::shard_local_cfg().min_cleanable_dirty_ratio.set_value(0.01);
+    ASSERT_FALSE(disk_log.is_dirty_enough_to_compact());
+
+    // new segments that haven't been compacted are dirty
+    add_segments(b, 3, 10, 30, false);
+    ASSERT_TRUE(disk_log.is_dirty_enough_to_compact());
+    config::shard_local_cfg().min_cleanable_dirty_ratio.set_value(0.99);
+    ASSERT_FALSE(disk_log.is_dirty_enough_to_compact());
+}
+
 // Even though segments with one record would be skipped over during
 // compaction, that shouldn't be reflected by the sliding range.
 TEST(FindSlidingRangeTest, TestCollectOneRecordSegments) {
@@ -326,6 +350,7 @@ TEST(DeduplicateSegmentsTest, TestBadReader) {
         disk_log.get_probe(),
         storage::internal::should_apply_delta_time_offset(b.feature_table()),
         b.feature_table(),
+        /*key_filter=*/nullptr,
         /*inject_reader_failure=*/true)
         .get(),
       std::runtime_error);
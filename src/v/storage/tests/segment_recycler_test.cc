@@ -0,0 +1,132 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "base/units.h"
+#include "config/configuration.h"
+#include "random/generators.h"
+#include "storage/segment_recycler.h"
+#include "storage/storage_resources.h"
+
+#include <seastar/core/seastar.hh>
+#include <seastar/core/smp.hh>
+#include <seastar/testing/thread_test_case.hh>
+#include <seastar/util/defer.hh>
+
+#include <boost/test/tools/old/interface.hpp>
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+namespace {
+
+std::filesystem::path make_test_dir() {
+    auto dir = std::filesystem::path(fmt::format(
+      "test.segment_recycler.{}", random_generators::gen_alphanum_string(8)));
+    std::filesystem::create_directories(dir);
+    return dir;
+}
+
+void write_file(const std::filesystem::path& path, size_t size) {
+    std::ofstream out(path, std::ios::binary);
+    auto data = random_generators::gen_alphanum_string(size);
+    out.write(data.data(), static_cast<std::streamsize>(data.size()));
+}
+
+std::string read_file(const std::filesystem::path& path) {
+    std::ifstream in(path, std::ios::binary);
+    return {std::istreambuf_iterator<char>(in), {}};
+}
+
+size_t count_recycled(const std::filesystem::path& dir) {
+    auto pool = dir / ".segment_pool" / fmt::to_string(ss::this_shard_id());
+    return std::distance(
+      std::filesystem::directory_iterator(pool),
+      std::filesystem::directory_iterator{});
+}
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(test_segment_recycler_reuse) {
+    config::shard_local_cfg().storage_segment_recycle_bytes.set_value(
+      size_t(1_MiB));
+    auto reset = ss::defer([] {
+        config::shard_local_cfg().storage_segment_recycle_bytes.reset();
+    });
+    auto dir = make_test_dir();
+    auto cleanup = ss::defer([dir] { std::filesystem::remove_all(dir); });
+
+    storage::storage_resources resources;
+    resources.update_allowance(100_GiB, 100_GiB);
+    auto& recycler = resources.recycler();
+    recycler.start(dir).get();
+
+    constexpr size_t size = 64_KiB;
+    auto retired = dir / "0-1-v1.log";
+    write_file(retired, size);
+
+    BOOST_REQUIRE_EQUAL(recycler.retire(retired).get(), size);
+    BOOST_REQUIRE(!std::filesystem::exists(retired));
+    BOOST_REQUIRE_EQUAL(recycler.size(), 1);
+    BOOST_REQUIRE_EQUAL(count_recycled(dir), 1);
+
+    auto target = dir / "100-1-v1.log";
+    auto reused = recycler.reuse(target).get();
+    BOOST_REQUIRE_EQUAL(recycler.size(), 0);
+    BOOST_REQUIRE_EQUAL(count_recycled(dir), 0);
+    if (!reused) {
+        // e.g. tmpfs, which cannot zero a range in place: recycling turns
+        // itself off rather than handing out stale data
+        BOOST_TEST_MESSAGE("filesystem does not support zeroing in place");
+        BOOST_REQUIRE(!std::filesystem::exists(target));
+        BOOST_REQUIRE_EQUAL(recycler.retire(target).get(), 0);
+        return;
+    }
+    auto contents = read_file(target);
+    BOOST_REQUIRE_EQUAL(contents.size(), size);
+    BOOST_REQUIRE(std::ranges::all_of(contents, [](char c) { return c == 0; }));
+}
+
+SEASTAR_THREAD_TEST_CASE(test_segment_recycler_bounded) {
+    config::shard_local_cfg().storage_segment_recycle_bytes.set_value(
+      size_t(96_KiB));
+    auto reset = ss::defer([] {
+        config::shard_local_cfg().storage_segment_recycle_bytes.reset();
+    });
+    auto dir = make_test_dir();
+    auto cleanup = ss::defer([dir] { std::filesystem::remove_all(dir); });
+
+    storage::storage_resources resources;
+    resources.update_allowance(100_GiB, 100_GiB);
+    auto& recycler = resources.recycler();
+    recycler.start(dir).get();
+
+    auto first = dir / "0-1-v1.log";
+    auto second = dir / "100-1-v1.log";
+    write_file(first, 64_KiB);
+    write_file(second, 64_KiB);
+
+    BOOST_REQUIRE_EQUAL(recycler.retire(first).get(), 64_KiB);
+    // the pool is full: the file is left for the caller to remove
+    BOOST_REQUIRE_EQUAL(recycler.retire(second).get(), 0);
+    BOOST_REQUIRE(std::filesystem::exists(second));
+    BOOST_REQUIRE_EQUAL(recycler.size(), 1);
+
+    // an existing file is never replaced by a pooled one
+    BOOST_REQUIRE(!recycler.reuse(second).get());
+    BOOST_REQUIRE_EQUAL(recycler.size(), 1);
+
+    // nothing is pooled while recycling is disabled
+    config::shard_local_cfg().storage_segment_recycle_bytes.set_value(
+      size_t(0));
+    BOOST_REQUIRE_EQUAL(recycler.retire(second).get(), 0);
+}
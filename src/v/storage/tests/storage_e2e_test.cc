@@ -11,6 +11,7 @@
 #include "base/vassert.h"
 #include "bytes/bytes.h"
 #include "bytes/random.h"
+#include "config/configuration.h"
 #include "config/mock_property.h"
 #include "model/fundamental.h"
 #include "model/namespace.h"
@@ -49,6 +50,7 @@
 #include <fmt/chrono.h>
 
 #include <algorithm>
+#include <filesystem>
 #include <iterator>
 #include <numeric>
 #include <optional>
@@ -136,6 +138,109 @@ FIXTURE_TEST(append_twice_to_same_segment, storage_test_fixture) {
     BOOST_REQUIRE_EQUAL(lstats.committed_offset, batches.back().last_offset());
 };
 
+FIXTURE_TEST(test_coalesced_flushes, storage_test_fixture) {
+    config::shard_local_cfg().storage_flush_coalesce_window_ms.set_value(
+      std::chrono::milliseconds(10));
+    storage::log_manager mgr = make_log_manager();
+    auto deferred = ss::defer([&mgr]() mutable {
+        mgr.stop().get0();
+        config::shard_local_cfg().storage_flush_coalesce_window_ms.reset();
+    });
+    auto ntp = model::ntp("default", "test", 0);
+    auto log
+      = mgr.manage(storage::ntp_config(ntp, mgr.config().base_dir)).get0();
+    append_random_batches(
+      log,
+      10,
+      model::term_id(0),
+      {},
+      storage::log_append_config::fsync::no,
+      false);
+
+    // flushes of a log requested within one window share a segment flush
+    std::vector<ss::future<>> flushes;
+    for (int i = 0; i < 5; ++i) {
+        flushes.push_back(log->flush());
+    }
+    ss::when_all_succeed(flushes.begin(), flushes.end()).get();
+
+    auto& probe = mgr.flusher().probe();
+    BOOST_REQUIRE_EQUAL(probe.requests(), 5);
+    BOOST_REQUIRE_EQUAL(probe.segment_flushes(), 1);
+    BOOST_REQUIRE_EQUAL(probe.batches(), 1);
+    BOOST_REQUIRE_EQUAL(
+      log->offsets().committed_offset, log->offsets().dirty_offset);
+};
+
+FIXTURE_TEST(test_segments_moved_to_cold_directory, storage_test_fixture) {
+    config::shard_local_cfg().storage_hot_tier_bytes.set_value(size_t(0));
+    auto cfg = default_log_config(test_dir);
+    cfg.max_segment_size = config::mock_binding<size_t>(10);
+    cfg.cold_dir = test_dir + "_cold";
+    auto cleanup = ss::defer([cold = *cfg.cold_dir] {
+        config::shard_local_cfg().storage_hot_tier_bytes.reset();
+        std::filesystem::remove_all(std::filesystem::path(cold));
+    });
+    auto ntp = model::ntp("default", "test", 0);
+    ss::abort_source as;
+    storage::housekeeping_config hk_cfg(
+      model::timestamp::min(),
+      std::nullopt,
+      model::offset::max(),
+      ss::default_priority_class(),
+      as);
+    auto require_same = [](
+                          const ss::circular_buffer<model::record_batch>& a,
+                          const ss::circular_buffer<model::record_batch>& b) {
+        BOOST_REQUIRE_EQUAL(a.size(), b.size());
+        for (size_t i = 0; i < a.size(); ++i) {
+            BOOST_REQUIRE(a[i] == b[i]);
+        }
+    };
+
+    ss::circular_buffer<model::record_batch> batches;
+    {
+        storage::log_manager mgr = make_log_manager(cfg);
+        auto deferred = ss::defer([&mgr]() mutable { mgr.stop().get(); });
+        auto log
+          = mgr.manage(storage::ntp_config(ntp, mgr.config().base_dir)).get();
+        append_random_batches(log, 10);
+        log->flush().get();
+        batches = read_and_validate_all_batches(log);
+
+        log->housekeeping(hk_cfg).get();
+
+        // every sealed segment is now a link into the cold directory
+        BOOST_REQUIRE_GT(log->segments().size(), 1);
+        for (const auto& seg : log->segments()) {
+            BOOST_REQUIRE_EQUAL(seg->is_cold(), !seg->has_appender());
+            BOOST_REQUIRE_EQUAL(
+              std::filesystem::is_symlink(seg->filename().c_str()),
+              seg->is_cold());
+        }
+        require_same(read_and_validate_all_batches(log), batches);
+    }
+
+    // on restart the moved segments are recovered through their links
+    storage::log_manager mgr = make_log_manager(cfg);
+    auto deferred = ss::defer([&mgr]() mutable { mgr.stop().get(); });
+    auto log = mgr.manage(storage::ntp_config(ntp, mgr.config().base_dir))
+                 .get();
+    const auto& segs = log->segments();
+    for (auto it = segs.begin(); it != std::prev(segs.end()); ++it) {
+        BOOST_REQUIRE((*it)->is_cold());
+    }
+    require_same(read_and_validate_all_batches(log), batches);
+
+    // removing the partition removes its cold files too
+    auto cold_dir = mgr.cold_directory(log->config());
+    BOOST_REQUIRE(cold_dir.has_value());
+    BOOST_REQUIRE(std::filesystem::exists(*cold_dir));
+    log = nullptr;
+    mgr.remove(ntp).get();
+    BOOST_REQUIRE(!std::filesystem::exists(*cold_dir));
+};
+
 FIXTURE_TEST(test_assigning_offsets_in_multiple_segment, storage_test_fixture) {
     auto cfg = default_log_config(test_dir);
     cfg.max_segment_size = config::mock_binding<size_t>(1_KiB);
@@ -3696,6 +3801,15 @@ FIXTURE_TEST(test_offset_range_size, storage_test_fixture) {
         BOOST_REQUIRE_EQUAL(expected_size, result->on_disk_size);
         BOOST_REQUIRE_EQUAL(last, result->last_offset);
 
+        // A repeated query is answered from the cached batch boundaries and
+        // must agree with the scan.
+        auto cached
+          = log->offset_range_size(base, last, ss::default_priority_class())
+              .get();
+        BOOST_REQUIRE(cached.has_value());
+        BOOST_REQUIRE_EQUAL(expected_size, cached->on_disk_size);
+        BOOST_REQUIRE_EQUAL(last, cached->last_offset);
+
         // Validate using the segment reader
         size_t consumed_size = 0;
         storage::log_reader_config reader_cfg(
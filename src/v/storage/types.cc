@@ -16,6 +16,7 @@
 #include "utils/human.h"
 #include "utils/to_string.h"
 
+#include <fmt/chrono.h>
 #include <fmt/core.h>
 #include <fmt/ostream.h>
 
@@ -174,6 +175,20 @@ std::ostream& operator<<(std::ostream& o, const offset_stats& s) {
     return o;
 }
 
+std::ostream& operator<<(std::ostream& o, const log_recovery_stats& s) {
+    fmt::print(
+      o,
+      "{{open_segments:{}, materialize_indices:{}, replay_segments:{}, "
+      "segments_replayed:{}, bytes_replayed:{}, clean_segments_skipped:{}}}",
+      s.open_segments,
+      s.materialize_indices,
+      s.replay_segments,
+      s.segments_replayed,
+      s.bytes_replayed,
+      s.clean_segments_skipped);
+    return o;
+}
+
 std::ostream& operator<<(std::ostream& os, const gc_config& cfg) {
     fmt::print(
       os,
@@ -28,6 +28,7 @@
 #include <seastar/core/rwlock.hh>
 #include <seastar/util/bool_class.hh>
 
+#include <chrono>
 #include <optional>
 #include <vector>
 
@@ -205,6 +206,22 @@ struct offset_stats {
     friend std::ostream& operator<<(std::ostream&, const offset_stats&);
 };
 
+/// Breakdown of the time spent recovering a log at startup.
+struct log_recovery_stats {
+    /// Opening the segment files.
+    std::chrono::milliseconds open_segments{0};
+    /// Loading segment indices from disk.
+    std::chrono::milliseconds materialize_indices{0};
+    /// Checksumming segments without a usable index.
+    std::chrono::milliseconds replay_segments{0};
+    size_t segments_replayed{0};
+    size_t bytes_replayed{0};
+    /// Replays avoided because the segment was closed cleanly.
+    size_t clean_segments_skipped{0};
+
+    friend std::ostream& operator<<(std::ostream&, const log_recovery_stats&);
+};
+
 struct log_append_config {
     using fsync = ss::bool_class<class skip_tag>;
     fsync should_fsync;
@@ -336,6 +353,10 @@ struct log_reader_config {
 
     opt_client_address_t client_address;
 
+    // Kafka client id of the reader, the reads from object storage are
+    // accounted to.
+    std::optional<ss::sstring> client_id;
+
     // do not reuse cached readers. if this field is set to true the make_reader
     // method will proceed with creating a new reader without checking the
     // readers cache.
@@ -41,7 +41,9 @@
 #include "wasm/api.h"
 #include "wasm/cache.h"
 #include "wasm/errc.h"
+#include "wasm/transform_probe.h"
 
+#include <seastar/core/chunked_fifo.hh>
 #include <seastar/core/circular_buffer.hh>
 #include <seastar/core/loop.hh>
 #include <seastar/core/lowres_clock.hh>
@@ -56,7 +58,9 @@
 #include <absl/container/flat_hash_map.h>
 #include <boost/range/irange.hpp>
 
+#include <algorithm>
 #include <system_error>
+#include <vector>
 
 namespace transform {
 
@@ -146,7 +150,8 @@ public:
     }
 
     ss::future<model::record_batch_reader>
-    read_batch(kafka::offset offset, ss::abort_source* as) final {
+    read_batch(
+      kafka::offset offset, size_t max_bytes, ss::abort_source* as) final {
         auto _ = _gate.hold();
         // There currently no way to abort the call to get the sync start, so
         // instead we wrap the resulting future in our abort source.
@@ -180,10 +185,6 @@ public:
             co_return model::make_memory_record_batch_reader(
               model::record_batch_reader::data_t{});
         }
-        // TODO(rockwood): This is currently an arbitrary value, but we should
-        // dynamically update this based on how much memory is available in the
-        // transform subsystem.
-        constexpr static size_t max_bytes = 128_KiB;
         auto translater = co_await _partition.make_reader(
           storage::log_reader_config(
             /*start_offset=*/start_offset,
@@ -339,8 +340,88 @@ private:
     commit_batcher<>* _batcher;
 };
 
+/**
+ * An engine on another core, that is handed the batches to transform there.
+ *
+ * The transformed records are buffered on the engine's core and copied back
+ * to this core once the batch is done. The latency of the transform is only
+ * recorded by the probe of the engine's core.
+ */
+class remote_engine final : public wasm::engine {
+    using output_records = ss::chunked_fifo<
+      std::pair<std::optional<model::topic>, model::transformed_data>>;
+
+public:
+    remote_engine(
+      ss::foreign_ptr<ss::shared_ptr<wasm::engine>> engine,
+      const model::transform_metadata& meta)
+      : _engine(std::move(engine)) {
+        for (const auto& output_topic : meta.output_topics) {
+            _output_topics.push_back(output_topic.tp);
+        }
+    }
+
+    ss::future<> transform(
+      model::record_batch batch,
+      wasm::transform_probe* probe,
+      wasm::transform_callback cb) override {
+        auto fut = co_await ss::coroutine::as_future(ss::smp::submit_to(
+          _engine.get_owner_shard(),
+          [this, &batch] { return transform_on_owner(batch); }));
+        if (fut.failed()) {
+            probe->transform_error();
+            std::rethrow_exception(fut.get_exception());
+        }
+        auto records = fut.get();
+        for (const auto& [topic, data] : *records) {
+            co_await cb(topic, data.copy());
+        }
+    }
+
+    ss::future<> start() override {
+        return ss::smp::submit_to(
+          _engine.get_owner_shard(), [this] { return _engine->start(); });
+    }
+    ss::future<> stop() override {
+        return ss::smp::submit_to(
+          _engine.get_owner_shard(), [this] { return _engine->stop(); });
+    }
+
+private:
+    ss::future<ss::foreign_ptr<std::unique_ptr<output_records>>>
+    transform_on_owner(const model::record_batch& batch) {
+        auto records = std::make_unique<output_records>();
+        wasm::transform_probe probe;
+        co_await _engine->transform(
+          batch.copy(),
+          &probe,
+          [this, &records](
+            std::optional<model::topic_view> topic,
+            model::transformed_data data) {
+              // The output topics are checked here, so that writes to other
+              // topics fail the transform as they would on this core.
+              if (topic && !is_output_topic(*topic)) {
+                  return ssx::now(wasm::write_success::no);
+              }
+              records->emplace_back(topic, std::move(data));
+              return ssx::now(wasm::write_success::yes);
+          });
+        co_return ss::make_foreign(std::move(records));
+    }
+
+    bool is_output_topic(model::topic_view topic) const {
+        return std::ranges::any_of(
+          _output_topics, [topic](const model::topic& t) {
+              return model::topic_view(t) == topic;
+          });
+    }
+
+    ss::foreign_ptr<ss::shared_ptr<wasm::engine>> _engine;
+    std::vector<model::topic> _output_topics;
+};
+
 using wasm_engine_factory = ss::noncopyable_function<
-  ss::future<ss::optimized_optional<ss::shared_ptr<wasm::engine>>>(
+  ss::future<std::vector<ss::shared_ptr<wasm::engine>>>(
     model::transform_metadata)>;
 
 class proc_factory : public processor_factory {
@@ -363,8 +444,8 @@ public:
       model::transform_metadata meta,
       processor::state_callback cb,
       probe* p) final {
-        auto engine = co_await _wasm_engine_factory(meta);
-        if (!engine) {
+        auto engines = co_await _wasm_engine_factory(meta);
+        if (engines.empty()) {
             throw std::runtime_error("unable to create wasm engine");
         }
         auto partition = kafka::make_partition_proxy(ntp, *_partition_manager);
@@ -388,7 +469,7 @@ public:
           id,
           ntp,
           meta,
-          *std::move(engine),
+          std::move(engines),
           std::move(cb),
           std::move(src),
           std::move(sinks),
@@ -486,7 +567,7 @@ ss::future<> service::start() {
         &_plugin_frontend->local(), &_partition_manager->local()),
       std::make_unique<proc_factory>(
         [this](model::transform_metadata meta) {
-            return create_engine(std::move(meta));
+            return create_engines(std::move(meta));
         },
         &_topic_table->local(),
         &_partition_manager->local(),
@@ -718,6 +799,42 @@ service::create_engine(model::transform_metadata meta) {
     co_return co_await (*factory)->make_engine(std::move(logger));
 }
 
+ss::future<std::vector<ss::shared_ptr<wasm::engine>>>
+service::create_engines(model::transform_metadata meta) {
+    std::vector<ss::shared_ptr<wasm::engine>> engines;
+    auto local = co_await create_engine(meta);
+    if (!local) {
+        co_return engines;
+    }
+    engines.push_back(*std::move(local));
+    size_t count = std::min<size_t>(
+      config::shard_local_cfg().data_transforms_parallel_engines(),
+      ss::smp::count);
+    // The other engines are on the following cores, which are shared with
+    // the processors of those cores.
+    for (size_t i = 1; i < count; ++i) {
+        auto shard = ss::shard_id((ss::this_shard_id() + i) % ss::smp::count);
+        auto remote = co_await container().invoke_on(
+          shard,
+          [](service& s, model::transform_metadata meta) {
+              return s.create_engine(std::move(meta))
+                .then([](ss::optimized_optional<ss::shared_ptr<wasm::engine>>
+                           engine) {
+                    return ss::make_foreign(
+                      engine ? *std::move(engine)
+                             : ss::shared_ptr<wasm::engine>(nullptr));
+                });
+          },
+          meta);
+        if (!remote) {
+            co_return std::vector<ss::shared_ptr<wasm::engine>>{};
+        }
+        engines.push_back(
+          ss::make_shared<remote_engine>(std::move(remote), meta));
+    }
+    co_return engines;
+}
+
 ss::future<
   ss::optimized_optional<ss::foreign_ptr<ss::shared_ptr<wasm::factory>>>>
 service::get_factory(model::transform_metadata meta) {
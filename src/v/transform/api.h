@@ -126,6 +126,11 @@ private:
     ss::future<ss::optimized_optional<ss::shared_ptr<wasm::engine>>>
       create_engine(model::transform_metadata);
 
+    // The engines to run the transform with on this core, the first of which
+    // is local. Empty if the engine could not be created.
+    ss::future<std::vector<ss::shared_ptr<wasm::engine>>>
+      create_engines(model::transform_metadata);
+
     ss::future<
       ss::optimized_optional<ss::foreign_ptr<ss::shared_ptr<wasm::factory>>>>
       get_factory(model::transform_metadata);
@@ -56,6 +56,9 @@ public:
     /**
      * Read from the log starting at a given offset, aborting when requested.
      *
+     * `max_bytes` is how much the reader should read, at least one batch is
+     * returned when the log has records after the offset.
+     *
      * NOTE: It's important in terms of lifetimes that the source **always**
      * outlives any reader returned from this method.
      *
@@ -63,7 +66,7 @@ public:
      * method before calling stop.
      */
     virtual ss::future<model::record_batch_reader>
-    read_batch(kafka::offset, ss::abort_source*) = 0;
+    read_batch(kafka::offset, size_t max_bytes, ss::abort_source*) = 0;
 };
 
 /**
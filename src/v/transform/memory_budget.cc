@@ -0,0 +1,71 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "transform/memory_budget.h"
+
+#include <algorithm>
+
+namespace transform {
+
+memory_budget::memory_budget(config::binding<size_t> total)
+  : _total(std::move(total))
+  , _timer([this] { rebalance(); }) {
+    _total.watch([this] { rebalance(); });
+    _timer.arm_periodic(rebalance_interval);
+}
+
+memory_budget::share_holder memory_budget::acquire_share() {
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    share_holder s(new share(std::min(min_share, total())));
+    _shares.push_back(*s);
+    rebalance();
+    return s;
+}
+
+void memory_budget::rebalance() {
+    size_t count = 0;
+    double total_demand = 0;
+    for (auto& s : _shares) {
+        ++count;
+        double demand = static_cast<double>(s._read_bytes);
+        if (s._lag > 0) {
+            demand *= 2;
+        }
+        s._demand = (s._demand + demand) / 2;
+        s._read_bytes = 0;
+        total_demand += s._demand;
+    }
+    if (count == 0) {
+        return;
+    }
+    size_t total = _total();
+    size_t floor = std::min(min_share, total / count);
+    size_t spare = total - floor * count;
+    for (auto& s : _shares) {
+        size_t extra = 0;
+        if (total_demand > 0) {
+            extra = static_cast<size_t>(
+              static_cast<double>(spare) * (s._demand / total_demand));
+        } else {
+            extra = spare / count;
+        }
+        size_t limit = floor + extra;
+        if (limit == s._limit) {
+            continue;
+        }
+        s._limit = limit;
+        if (s._on_change) {
+            s._on_change(limit);
+        }
+    }
+}
+
+} // namespace transform
@@ -0,0 +1,111 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "base/seastarx.h"
+#include "base/units.h"
+#include "config/property.h"
+#include "container/intrusive_list_helpers.h"
+
+#include <seastar/core/lowres_clock.hh>
+#include <seastar/core/timer.hh>
+#include <seastar/util/noncopyable_function.hh>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+namespace transform {
+
+/**
+ * The memory a shard has to buffer records between reading, transforming and
+ * writing them, shared between the processors of the shard.
+ *
+ * Each processor holds a share of the budget, which limits how much its
+ * queues buffer. Every share gets up to `min_share`, the rest of the budget
+ * is split in proportion to the demand of the shares, which is how much
+ * their processor has been reading, counted twice while it lags behind the
+ * partition. Idle processors give up their headroom to the busy ones, while
+ * the sum of the shares stays within the budget.
+ *
+ * The shares are rebalanced every `rebalance_interval` and when a share is
+ * acquired.
+ */
+class memory_budget {
+public:
+    class share {
+    public:
+        share(const share&) = delete;
+        share& operator=(const share&) = delete;
+        share(share&&) = delete;
+        share& operator=(share&&) = delete;
+        ~share() = default;
+
+        size_t limit() const { return _limit; }
+
+        // Calls `fn` with the new limit every time it changes.
+        void watch(ss::noncopyable_function<void(size_t)> fn) {
+            _on_change = std::move(fn);
+        }
+
+        void record_read(size_t bytes) { _read_bytes += bytes; }
+        void report_lag(int64_t lag) { _lag = lag; }
+
+    private:
+        friend memory_budget;
+        explicit share(size_t limit)
+          : _limit(limit) {}
+
+        size_t _limit;
+        ss::noncopyable_function<void(size_t)> _on_change;
+        // Bytes read since the last rebalance
+        size_t _read_bytes = 0;
+        int64_t _lag = 0;
+        // A moving average of the demand at each rebalance
+        double _demand = 0;
+        intrusive_list_hook _hook;
+    };
+
+    using share_holder = std::unique_ptr<share>;
+
+    static constexpr size_t min_share = 64_KiB;
+    static constexpr auto rebalance_interval = std::chrono::seconds(1);
+
+    explicit memory_budget(config::binding<size_t> total);
+    memory_budget(const memory_budget&) = delete;
+    memory_budget& operator=(const memory_budget&) = delete;
+    memory_budget(memory_budget&&) = delete;
+    memory_budget& operator=(memory_budget&&) = delete;
+    ~memory_budget() = default;
+
+    /**
+     * Take a share of the budget, which is given back when the returned
+     * object is destroyed.
+     */
+    [[nodiscard("the share is given back when the returned object is "
+                "destroyed")]] share_holder
+    acquire_share();
+
+    /**
+     * Recompute the limits of the shares from their recent demand.
+     */
+    void rebalance();
+
+    size_t total() const { return _total(); }
+
+private:
+    config::binding<size_t> _total;
+    intrusive_list<share, &share::_hook> _shares;
+    ss::timer<ss::lowres_clock> _timer;
+};
+
+} // namespace transform
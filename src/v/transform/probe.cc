@@ -42,6 +42,34 @@ void probe::setup_metrics(const model::transform_metadata& meta) {
         labels)
         .aggregate({sm::shard_label}));
 
+    metric_defs.emplace_back(
+      sm::make_histogram(
+        "read_wait_sec",
+        sm::description(
+          "A histogram of the time in seconds the transform waits for the "
+          "next batch from the input topic"),
+        labels,
+        [this] { return _read_wait.public_histogram_logform(); })
+        .aggregate({sm::shard_label}));
+    metric_defs.emplace_back(
+      sm::make_histogram(
+        "write_wait_sec",
+        sm::description(
+          "A histogram of the time in seconds it takes to write a batch to an "
+          "output topic"),
+        labels,
+        [this] { return _write_wait.public_histogram_logform(); })
+        .aggregate({sm::shard_label}));
+    metric_defs.emplace_back(
+      sm::make_histogram(
+        "end_to_end_latency_sec",
+        sm::description(
+          "A histogram of the time in seconds from the timestamp of an input "
+          "batch until its output is written"),
+        labels,
+        [this] { return _end_to_end_latency.public_histogram_logform(); })
+        .aggregate({sm::shard_label}));
+
     auto output_topic_label = sm::label("output_topic");
     _lag.reserve(meta.output_topics.size());
     _write_bytes.reserve(meta.output_topics.size());
@@ -15,6 +15,9 @@
 
 #include <absl/container/flat_hash_map.h>
 
+#include <chrono>
+#include <memory>
+
 namespace transform {
 
 struct processor_state_change {
@@ -35,6 +38,21 @@ public:
     void state_change(processor_state_change);
     void report_lag(model::output_topic_index, int64_t delta);
 
+    // How long the transform waits for its next input batch.
+    std::unique_ptr<hist_t::measurement> read_wait_measurement() {
+        return _read_wait.auto_measure();
+    }
+    // How long it takes to write output batches to the sink.
+    std::unique_ptr<hist_t::measurement> write_wait_measurement() {
+        return _write_wait.auto_measure();
+    }
+    // The time from the timestamp of an input batch until the output of it
+    // is written to the sink.
+    void record_end_to_end_latency(std::chrono::milliseconds latency) {
+        _end_to_end_latency.record(
+          std::chrono::duration_cast<hist_t::duration_type>(latency).count());
+    }
+
 private:
     friend class ProcessorTestFixture;
 
@@ -44,6 +62,9 @@ private:
     std::vector<uint64_t> _lag;
     absl::flat_hash_map<model::transform_report::processor::state, uint64_t>
       _processor_state;
+    hist_t _read_wait;
+    hist_t _write_wait;
+    hist_t _end_to_end_latency;
 };
 
 } // namespace transform
@@ -76,6 +76,14 @@ model::ntp offsets_ntp(model::partition_id id) {
       model::kafka_internal_namespace, model::transform_offsets_topic, id};
 }
 
+::rpc::client_opts make_client_opts(model::timeout_clock::duration d) {
+    ::rpc::client_opts opts(model::timeout_clock::now() + d);
+    ::rpc::compression_policy::from_threshold(
+      config::shard_local_cfg().rpc_data_transforms_compression_bytes())
+      .apply(opts);
+    return opts;
+}
+
 cluster::errc map_errc(std::error_code ec) {
     if (ec.category() == cluster::error_category()) {
         return static_cast<cluster::errc>(ec.value());
@@ -264,19 +272,24 @@ ss::future<produce_reply> client::do_local_produce(produce_request req) {
 
 ss::future<produce_reply>
 client::do_remote_produce(model::node_id node, produce_request req) {
+    auto send = [req = req.share()](
+                  impl::transform_rpc_client_protocol proto) mutable {
+        return proto.produce(std::move(req), make_client_opts(timeout));
+    };
+    // the leader hands the request to the shard of its replica, prefer the
+    // connection terminating on that shard
+    const auto& tp = req.topic_data.front().tp;
+    auto shard = _topic_metadata->find_replica_shard(
+      model::ntp(model::kafka_namespace, tp.topic, tp.partition), node);
     auto resp = co_await _connections->local()
-                  .with_node_client<impl::transform_rpc_client_protocol>(
+                  .with_node_client_for_shard<
+                    impl::transform_rpc_client_protocol>(
                     _self,
                     ss::this_shard_id(),
                     node,
-                    timeout,
-                    [req = req.share()](
-                      impl::transform_rpc_client_protocol proto) mutable {
-                        return proto.produce(
-                          std::move(req),
-                          ::rpc::client_opts(
-                            model::timeout_clock::now() + timeout));
-                    })
+                    shard,
+                    ::rpc::timeout_spec::from_now(timeout),
+                    std::move(send))
                   .then(&::rpc::get_ctx_data<produce_reply>);
     if (resp.has_error()) {
         cluster::errc ec = map_errc(resp.assume_error());
@@ -340,8 +353,7 @@ client::do_remote_store_wasm_binary(
                       impl::transform_rpc_client_protocol proto) mutable {
                         return proto.store_wasm_binary(
                           store_wasm_binary_request(std::move(data), timeout),
-                          ::rpc::client_opts(
-                            model::timeout_clock::now() + timeout));
+                          make_client_opts(timeout));
                     })
                   .then(&::rpc::get_ctx_data<store_wasm_binary_reply>);
     if (resp.has_error()) {
@@ -400,7 +412,7 @@ ss::future<cluster::errc> client::do_remote_delete_wasm_binary(
             [timeout, key](impl::transform_rpc_client_protocol proto) mutable {
                 return proto.delete_wasm_binary(
                   delete_wasm_binary_request(key, timeout),
-                  ::rpc::client_opts(model::timeout_clock::now() + timeout));
+                  make_client_opts(timeout));
             })
           .then(&::rpc::get_ctx_data<delete_wasm_binary_reply>);
     if (resp.has_error()) {
@@ -457,8 +469,7 @@ ss::future<result<iobuf, cluster::errc>> client::do_remote_load_wasm_binary(
                       impl::transform_rpc_client_protocol proto) mutable {
                         return proto.load_wasm_binary(
                           load_wasm_binary_request(offset, timeout),
-                          ::rpc::client_opts(
-                            model::timeout_clock::now() + timeout));
+                          make_client_opts(timeout));
                     })
                   .then(&::rpc::get_ctx_data<load_wasm_binary_reply>);
     if (resp.has_error()) {
@@ -610,8 +621,7 @@ ss::future<find_coordinator_response> client::do_remote_find_coordinator(
             timeout,
             [req = request](impl::transform_rpc_client_protocol proto) mutable {
                 return proto.find_coordinator(
-                  std::move(req),
-                  ::rpc::client_opts(model::timeout_clock::now() + timeout));
+                  std::move(req), make_client_opts(timeout));
             })
           .then(&::rpc::get_ctx_data<find_coordinator_response>);
     if (!response) {
@@ -675,9 +685,7 @@ ss::future<offset_commit_response> client::do_remote_offset_commit(
                         [request = std::move(request)](
                           impl::transform_rpc_client_protocol proto) mutable {
                             return proto.offset_commit(
-                              std::move(request),
-                              ::rpc::client_opts(
-                                model::timeout_clock::now() + timeout));
+                              std::move(request), make_client_opts(timeout));
                         })
                       .then(&::rpc::get_ctx_data<offset_commit_response>);
     if (!response) {
@@ -742,8 +750,7 @@ ss::future<offset_fetch_response> client::do_remote_offset_fetch(
             timeout,
             [request](impl::transform_rpc_client_protocol proto) mutable {
                 return proto.offset_fetch(
-                  std::move(request),
-                  ::rpc::client_opts(model::timeout_clock::now() + timeout));
+                  std::move(request), make_client_opts(timeout));
             })
           .then(&::rpc::get_ctx_data<offset_fetch_response>);
     if (!response) {
@@ -796,9 +803,7 @@ client::generate_remote_report(model::node_id node) {
                     timeout,
                     [](impl::transform_rpc_client_protocol proto) mutable {
                         return proto.generate_report(
-                          {},
-                          ::rpc::client_opts(
-                            model::timeout_clock::now() + timeout));
+                          {}, make_client_opts(timeout));
                     })
                   .then(&::rpc::get_ctx_data<generate_report_reply>);
     vlog(log.trace, "generate_one_report_response(node={}): {}", node, resp);
@@ -955,8 +960,7 @@ client::do_remote_list_committed_offsets(
                       impl::transform_rpc_client_protocol proto) mutable {
                         return proto.list_committed_offsets(
                           list_commits_request(partition),
-                          ::rpc::client_opts(
-                            model::timeout_clock::now() + timeout));
+                          make_client_opts(timeout));
                     })
                   .then(&::rpc::get_ctx_data<list_commits_reply>);
     vlog(log.trace, "list_committed_offsets(node={}): {}", node, resp);
@@ -1043,8 +1047,7 @@ ss::future<cluster::errc> client::do_remote_delete_committed_offsets(
                       impl::transform_rpc_client_protocol proto) mutable {
                         return proto.delete_committed_offsets(
                           delete_commits_request(partition, std::move(ids)),
-                          ::rpc::client_opts(
-                            model::timeout_clock::now() + timeout));
+                          make_client_opts(timeout));
                     })
                   .then(&::rpc::get_ctx_data<delete_commits_reply>);
     vlog(
@@ -68,6 +68,20 @@ public:
         return _cache->local().get_default_batch_max_bytes();
     };
 
+    std::optional<ss::shard_id>
+    find_replica_shard(const model::ntp& ntp, model::node_id node) const final {
+        auto assignment = _cache->local().get_partition_assignment(ntp);
+        if (!assignment) {
+            return std::nullopt;
+        }
+        for (const auto& replica : assignment->replicas) {
+            if (replica.node_id == node) {
+                return replica.shard;
+            }
+        }
+        return std::nullopt;
+    }
+
 private:
     ss::sharded<cluster::metadata_cache>* _cache;
 };
@@ -114,6 +114,14 @@ public:
      * The default max batch bytes size.
      */
     virtual uint32_t get_default_batch_max_bytes() const = 0;
+
+    /**
+     * Lookup the shard of the replica of the ntp hosted on the node, if any.
+     */
+    virtual std::optional<ss::shard_id>
+    find_replica_shard(const model::ntp&, model::node_id) const {
+        return std::nullopt;
+    }
 };
 
 /**
@@ -15,6 +15,7 @@
 #include "cluster/partition_manager.h"
 #include "cluster/shard_table.h"
 #include "cluster/types.h"
+#include "config/configuration.h"
 #include "kafka/server/partition_proxy.h"
 #include "model/ktp.h"
 #include "model/metadata.h"
@@ -363,6 +364,11 @@ ss::future<cluster::errc> local_service::delete_committed_offsets(
       *shard, ntp, std::move(ids));
 }
 
+::rpc::compression_policy network_service::reply_compression() const {
+    return ::rpc::compression_policy::from_threshold(
+      config::shard_local_cfg().rpc_data_transforms_compression_bytes());
+}
+
 ss::future<produce_reply>
 network_service::produce(produce_request req, ::rpc::streaming_context&) {
     co_await ss::coroutine::switch_to(get_scheduling_group());
@@ -120,6 +120,14 @@ public:
     ss::future<generate_report_reply> generate_report(
       generate_report_request, ::rpc::streaming_context&) override;
 
+    ::rpc::compression_policy reply_compression() const override;
+
+    std::optional<::rpc::admission_limits>
+    get_admission_limits() const override {
+        return ::rpc::admission_limits{
+          .memory_share = 0.25, .max_concurrency = 256};
+    }
+
 private:
     ss::sharded<local_service>* _service;
 };
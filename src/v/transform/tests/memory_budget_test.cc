@@ -0,0 +1,89 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "base/units.h"
+#include "config/mock_property.h"
+#include "transform/memory_budget.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace transform {
+namespace {
+
+constexpr size_t total = 1_MiB;
+
+size_t sum_of_limits(const std::vector<memory_budget::share_holder>& shares) {
+    size_t sum = 0;
+    for (const auto& s : shares) {
+        sum += s->limit();
+    }
+    return sum;
+}
+
+TEST(MemoryBudget, IdleSharesSplitEvenly) {
+    memory_budget budget(config::mock_binding<size_t>(total));
+    std::vector<memory_budget::share_holder> shares;
+    for (int i = 0; i < 4; ++i) {
+        shares.push_back(budget.acquire_share());
+    }
+    for (const auto& s : shares) {
+        EXPECT_EQ(s->limit(), total / 4);
+    }
+}
+
+TEST(MemoryBudget, BusySharesGetTheHeadroom) {
+    memory_budget budget(config::mock_binding<size_t>(total));
+    std::vector<memory_budget::share_holder> shares;
+    for (int i = 0; i < 4; ++i) {
+        shares.push_back(budget.acquire_share());
+    }
+    shares[0]->record_read(1_MiB);
+    shares[1]->record_read(1_MiB);
+    shares[1]->report_lag(10);
+    budget.rebalance();
+    EXPECT_EQ(shares[2]->limit(), memory_budget::min_share);
+    EXPECT_EQ(shares[3]->limit(), memory_budget::min_share);
+    // The lagging share demands twice as much
+    EXPECT_GT(shares[1]->limit(), shares[0]->limit());
+    EXPECT_GT(shares[0]->limit(), memory_budget::min_share);
+    EXPECT_LE(sum_of_limits(shares), total);
+}
+
+TEST(MemoryBudget, StaysWithinBudget) {
+    memory_budget budget(config::mock_binding<size_t>(total));
+    std::vector<memory_budget::share_holder> shares;
+    // More shares than fit with the minimum each
+    for (size_t i = 0; i < 2 * total / memory_budget::min_share; ++i) {
+        shares.push_back(budget.acquire_share());
+        shares.back()->record_read(i * 1_KiB);
+    }
+    budget.rebalance();
+    EXPECT_LE(sum_of_limits(shares), total);
+}
+
+TEST(MemoryBudget, NotifiesAndReleasesShares) {
+    memory_budget budget(config::mock_binding<size_t>(total));
+    auto first = budget.acquire_share();
+    size_t notified = 0;
+    first->watch([&notified](size_t limit) { notified = limit; });
+    EXPECT_EQ(first->limit(), total);
+    auto second = budget.acquire_share();
+    EXPECT_EQ(notified, total / 2);
+    second.reset();
+    budget.rebalance();
+    EXPECT_EQ(notified, total);
+    EXPECT_EQ(first->limit(), total);
+}
+
+} // namespace
+} // namespace transform
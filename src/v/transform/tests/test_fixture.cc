@@ -20,6 +20,7 @@
 #include <seastar/core/abort_source.hh>
 #include <seastar/core/condition-variable.hh>
 #include <seastar/core/lowres_clock.hh>
+#include <seastar/core/sleep.hh>
 
 #include <gtest/gtest.h>
 
@@ -62,7 +63,8 @@ kafka::offset fake_source::latest_offset() {
 }
 
 ss::future<model::record_batch_reader>
-fake_source::read_batch(kafka::offset offset, ss::abort_source* as) {
+fake_source::read_batch(
+  kafka::offset offset, size_t /*max_bytes*/, ss::abort_source* as) {
     auto sub = as->subscribe([this]() noexcept { _cond_var.broadcast(); });
     co_await _cond_var.wait([this, as, offset] {
         if (as->abort_requested()) {
@@ -110,10 +112,17 @@ void fake_wasm_engine::set_use_default_output_topic() {
     _output_topics = std::nullopt;
 }
 
+void fake_wasm_engine::set_transform_delay(ss::lowres_clock::duration delay) {
+    _delay = delay;
+}
+
 ss::future<> fake_wasm_engine::transform(
   model::record_batch batch,
   wasm::transform_probe*,
   wasm::transform_callback cb) {
+    if (_delay > ss::lowres_clock::duration::zero()) {
+        co_await ss::sleep<ss::lowres_clock>(_delay);
+    }
     auto it = model::record_batch_iterator::create(batch);
     while (it.has_next()) {
         auto transformed = model::transformed_data::from_record(it.next());
@@ -23,6 +23,7 @@
 
 #include <seastar/core/chunked_fifo.hh>
 #include <seastar/core/condition-variable.hh>
+#include <seastar/core/lowres_clock.hh>
 
 #include <optional>
 #include <utility>
@@ -61,6 +62,8 @@ public:
 
     void set_output_topics(std::vector<model::topic> topics);
     void set_use_default_output_topic();
+    // Sleep for this long before transforming each batch.
+    void set_transform_delay(ss::lowres_clock::duration delay);
 
     ss::future<> start() override;
     ss::future<> stop() override;
@@ -68,6 +71,7 @@ public:
 private:
     bool _started = false;
     std::optional<std::vector<model::topic>> _output_topics;
+    ss::lowres_clock::duration _delay{0};
 };
 
 class fake_source : public source {
@@ -80,7 +84,8 @@ public:
     ss::future<> stop() override;
     kafka::offset latest_offset() override;
     ss::future<model::record_batch_reader>
-    read_batch(kafka::offset offset, ss::abort_source* as) override;
+    read_batch(
+      kafka::offset offset, size_t max_bytes, ss::abort_source* as) override;
 
     ss::future<> push_batch(model::record_batch batch);
 
@@ -110,6 +110,25 @@ TEST(TransferQueue, CanAlwaysPushAtLeastOneEntry) {
     fut.get();
 }
 
+TEST(TransferQueue, LimitCanChange) {
+    ss::abort_source as;
+    transfer_queue<entry> q(8);
+    q.push(entry{6}, &as).get();
+    auto fut = q.push(entry{4}, &as);
+    tests::drain_task_queue().get();
+    EXPECT_FALSE(fut.available());
+    q.set_max_memory(16);
+    fut.get();
+    // Shrinking keeps what is queued
+    q.set_max_memory(4);
+    fut = q.push(entry{1}, &as);
+    tests::drain_task_queue().get();
+    EXPECT_FALSE(fut.available());
+    EXPECT_NE(q.pop_one(&as).get(), std::nullopt);
+    EXPECT_NE(q.pop_one(&as).get(), std::nullopt);
+    fut.get();
+}
+
 TEST(TransferQueue, PushCanBeAborted) {
     ss::abort_source as;
     transfer_queue<entry> q(1);
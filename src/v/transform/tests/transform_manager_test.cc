@@ -192,7 +192,7 @@ class processor_tracker : public processor_factory {
             id,
             std::move(ntp),
             std::move(meta),
-            ss::make_shared<testing::fake_wasm_engine>(),
+            {ss::make_shared<testing::fake_wasm_engine>()},
             [](auto, auto, auto) {},
             std::make_unique<testing::fake_source>(),
             make_sink(),
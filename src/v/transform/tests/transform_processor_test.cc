@@ -87,8 +87,17 @@ class ProcessorTestFixture
   : public ::testing::TestWithParam<model::transform_metadata> {
 public:
     void SetUp() override {
-        auto engine = ss::make_shared<testing::fake_wasm_engine>();
-        _engine = engine.get();
+        std::vector<ss::shared_ptr<wasm::engine>> engines;
+        size_t count = engine_count();
+        for (size_t i = 0; i < count; ++i) {
+            auto engine = ss::make_shared<testing::fake_wasm_engine>();
+            // The first engines are the slowest, so that batches are done
+            // out of order.
+            engine->set_transform_delay(
+              std::chrono::milliseconds(count - i - 1));
+            _engines.push_back(engine.get());
+            engines.push_back(std::move(engine));
+        }
         auto src = std::make_unique<testing::fake_source>();
         _src = src.get();
         std::vector<std::unique_ptr<transform::sink>> sinks;
@@ -104,7 +113,7 @@ public:
           testing::my_transform_id,
           testing::my_ntp,
           GetParam(),
-          std::move(engine),
+          std::move(engines),
           [this](auto, auto, processor::state state) {
               if (state == processor::state::errored) {
                   ++_error_count;
@@ -123,6 +132,8 @@ public:
     }
     void TearDown() override { _p->stop().get(); }
 
+    virtual size_t engine_count() const { return 1; }
+
     bool wait_for_committed_offset(model::output_topic_index idx) {
         return wait_for_committed_offset(idx, kafka::prev_offset(_offset));
     }
@@ -157,14 +168,24 @@ public:
         return _offset_tracker->load_committed_offsets().get();
     }
 
-    void set_default_output() { _engine->set_use_default_output_topic(); }
-    void set_devnull_output() { _engine->set_output_topics({}); }
+    void set_default_output() {
+        for (auto* engine : _engines) {
+            engine->set_use_default_output_topic();
+        }
+    }
+    void set_devnull_output() {
+        for (auto* engine : _engines) {
+            engine->set_output_topics({});
+        }
+    }
     void set_tee_output() {
         std::vector<model::topic> topics;
         for (const auto& tp_ns : GetParam().output_topics) {
             topics.push_back(tp_ns.tp);
         }
-        _engine->set_output_topics(std::move(topics));
+        for (auto* engine : _engines) {
+            engine->set_output_topics(topics);
+        }
     }
 
     std::vector<model::record> make_records(size_t n) {
@@ -251,7 +272,7 @@ private:
 
     kafka::offset _offset = start_offset;
     std::unique_ptr<transform::processor> _p;
-    testing::fake_wasm_engine* _engine = nullptr;
+    std::vector<testing::fake_wasm_engine*> _engines;
     testing::fake_source* _src = nullptr;
     testing::fake_offset_tracker* _offset_tracker = nullptr;
     std::vector<testing::fake_sink*> _sinks;
@@ -498,4 +519,58 @@ INSTANTIATE_TEST_SUITE_P(
   MultipleOutputsProcessorTestFixture,
   ::testing::Values(testing::my_multiple_output_metadata));
 
+class ParallelProcessorTestFixture : public ProcessorTestFixture {
+public:
+    size_t engine_count() const override { return 3; }
+};
+
+TEST_P(ParallelProcessorTestFixture, ProcessManyInOrder) {
+    set_tee_output();
+    constexpr int num_records = 32;
+    auto records = make_records(num_records);
+    for (auto& r : records) {
+        push_record(r.share());
+    }
+    for (auto output : output_topics()) {
+        auto returned = read_records(output, num_records);
+        EXPECT_THAT(returned, SameRecords(records));
+    }
+    EXPECT_TRUE(wait_for_all_committed());
+    EXPECT_EQ(error_count(), 0);
+}
+
+TEST_P(ParallelProcessorTestFixture, TracksOffsets) {
+    constexpr int num_records = 16;
+    auto first_batches = make_records(num_records);
+    auto second_batches = make_records(num_records);
+    for (auto& b : first_batches) {
+        push_record(b.share());
+    }
+    EXPECT_THAT(read_records(num_records), SameRecords(first_batches));
+    ASSERT_TRUE(wait_for_all_committed());
+    restart();
+    for (auto& b : second_batches) {
+        push_record(b.share());
+    }
+    EXPECT_THAT(read_records(num_records), SameRecords(second_batches));
+    EXPECT_EQ(error_count(), 0);
+}
+
+TEST_P(ParallelProcessorTestFixture, StopsWhileTransforming) {
+    auto records = make_records(8);
+    for (auto& r : records) {
+        push_record(r.share());
+    }
+    stop();
+    start();
+    EXPECT_TRUE(wait_for_all_committed());
+    EXPECT_EQ(error_count(), 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  ParallelProcessorTest,
+  ParallelProcessorTestFixture,
+  ::testing::Values(
+    testing::my_single_output_metadata, testing::my_multiple_output_metadata));
+
 } // namespace transform
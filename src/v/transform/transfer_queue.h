@@ -63,10 +63,7 @@ public:
      * the floor.
      */
     ss::future<> push(T entry, ss::abort_source* as) noexcept {
-        // We want to be able to always insert at least one item, so cap memory
-        // usage by _max_memory so we don't overload our semaphore and so we
-        // can't get stuck.
-        size_t mem = std::min(entry.memory_usage(), _max_memory);
+        size_t mem = entry.memory_usage();
         co_await wait_for_free_memory(as, mem);
         if (as->abort_requested()) {
             co_return;
@@ -89,7 +86,7 @@ public:
         }
         T entry = std::move(_entries.front());
         _entries.pop_front();
-        _used_memory -= std::min(entry.memory_usage(), _max_memory);
+        _used_memory -= entry.memory_usage();
         _cond_var.signal();
         co_return entry;
     }
@@ -111,6 +108,17 @@ public:
         co_return std::exchange(_entries, {});
     }
 
+    /**
+     * Change the soft limit of memory in the queue, entries already in the
+     * queue are kept if it's now over the limit.
+     */
+    void set_max_memory(size_t max_memory_usage) noexcept {
+        _max_memory = max_memory_usage;
+        _cond_var.signal();
+    }
+
+    size_t max_memory() const noexcept { return _max_memory; }
+
     /**
      * Remove all entries from this queue.
      */
@@ -128,7 +136,10 @@ private:
                 if (as->abort_requested()) {
                     return true;
                 }
-                return (_used_memory + needed_memory) <= _max_memory;
+                // We want to be able to always insert at least one item, so
+                // we can't get stuck.
+                return _entries.empty()
+                       || (_used_memory + needed_memory) <= _max_memory;
             });
         }
     }
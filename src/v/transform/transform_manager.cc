@@ -12,6 +12,7 @@
 
 #include "base/vassert.h"
 #include "base/vlog.h"
+#include "config/configuration.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
 #include "model/transform.h"
@@ -263,6 +264,8 @@ manager<ClockType>::manager(
           vlog(tlog.error, "unexpected transform manager error: {}", ex);
       })
   , _registry(std::move(r))
+  , _memory_budget(
+      config::shard_local_cfg().data_transforms_per_core_buffer_memory.bind())
   , _processors(std::make_unique<processor_table<ClockType>>())
   , _processor_factory(std::move(f)) {}
 
@@ -451,6 +454,7 @@ ss::future<> manager<ClockType>::create_processor(
         // start it, so that if start fails and calls the error callback
         // we properly know that it's in flight.
         auto& entry = _processors->insert(std::move(fut).get(), std::move(p));
+        entry.processor()->set_memory_share(_memory_budget.acquire_share());
         vlog(tlog.info, "starting transform {} on {}", meta.name, ntp);
         entry.mark_start_attempt();
         co_await entry.processor()->start();
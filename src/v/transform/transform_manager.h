@@ -18,6 +18,7 @@
 #include "ssx/work_queue.h"
 #include "transform/fwd.h"
 #include "transform/io.h"
+#include "transform/memory_budget.h"
 #include "transform/transform_processor.h"
 #include "wasm/fwd.h"
 
@@ -158,6 +159,8 @@ private:
     model::node_id _self;
     ssx::work_queue _queue;
     std::unique_ptr<registry> _registry;
+    // Declared before the processors, which hold shares of it.
+    memory_budget _memory_budget;
     std::unique_ptr<processor_table<ClockType>> _processors;
     std::unique_ptr<processor_factory> _processor_factory;
 };
@@ -35,7 +35,7 @@ void transform_offsets_stm_factory::create(
       cfg.has_value(),
       "When creating transform stm the topic configuration must exists");
 
-    builder.create_stm<transform_offsets_stm_t>(
+    builder.create_deferred_stm<transform_offsets_stm_t>(
       cfg->partition_count, tlog, raft);
 }
 
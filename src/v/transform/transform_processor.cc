@@ -47,10 +47,12 @@ public:
     queue_output_consumer(
       transfer_queue<model::record_batch, buffer_chunk_size>* output,
       ss::abort_source* as,
-      probe* probe)
+      probe* probe,
+      memory_budget::share* share)
       : _output(output)
       , _as(as)
-      , _probe(probe) {}
+      , _probe(probe)
+      , _share(share) {}
 
     ss::future<ss::stop_iteration> operator()(model::record_batch b) {
         // This is a "safe" cast as all our offsets come from the translating
@@ -58,6 +60,9 @@ public:
         // model::record_batch.
         _last_offset = model::offset_cast(b.last_offset());
         _probe->increment_read_bytes(b.size_bytes());
+        if (_share) {
+            _share->record_read(b.size_bytes());
+        }
         co_await _output->push(std::move(b), _as);
         co_return ss::stop_iteration::no;
     }
@@ -68,6 +73,7 @@ private:
     transfer_queue<model::record_batch, buffer_chunk_size>* _output;
     ss::abort_source* _as;
     probe* _probe;
+    memory_budget::share* _share;
 };
 
 struct drain_result {
@@ -89,13 +95,21 @@ class processor_shutdown_exception : public std::exception {
 // limiting the size based on the amount of memory in the transform subsystem.
 constexpr size_t max_buffer_size = 128_KiB;
 
+// Reads from the source are sized to what the transform's input can buffer,
+// so that a busy processor with a large memory share reads ahead in few large
+// reads instead of many small ones. The input queue admits a read when it's
+// empty, so the largest read is also a bound on how far a processor overshoots
+// its share.
+constexpr size_t min_read_bytes = 128_KiB;
+constexpr size_t max_read_bytes = 4_MiB;
+
 } // namespace
 
 processor::processor(
   model::transform_id id,
   model::ntp ntp,
   model::transform_metadata meta,
-  ss::shared_ptr<wasm::engine> engine,
+  std::vector<ss::shared_ptr<wasm::engine>> engines,
   state_callback cb,
   std::unique_ptr<source> source,
   std::vector<std::unique_ptr<sink>> sinks,
@@ -104,19 +118,23 @@ processor::processor(
   : _id(id)
   , _ntp(std::move(ntp))
   , _meta(std::move(meta))
-  , _engine(std::move(engine))
+  , _engines(std::move(engines))
   , _source(std::move(source))
   , _offset_tracker(std::move(offset_tracker))
   , _state_callback(std::move(cb))
   , _probe(p)
   , _consumer_transform_pipe(max_buffer_size)
   , _outputs()
+  , _in_flight(max_buffer_size)
+  , _idle_engines(_engines)
   , _task(ss::now())
   , _logger(tlog, ss::format("{}/{}", _meta.name(), _ntp.tp.partition())) {
     const auto& outputs = _meta.output_topics;
     vassert(
       outputs.size() == sinks.size(),
       "expected the same number of output topics and sinks");
+    vassert(!_engines.empty(), "expected at least one engine");
+    _idle_engines_sem.signal(_engines.size());
     _outputs.reserve(outputs.size());
     _last_reported_lag.reserve(outputs.size());
     for (size_t i : boost::irange(outputs.size())) {
@@ -145,7 +163,8 @@ ss::future<> processor::start() {
     co_await _source->start();
     co_await _offset_tracker->start();
     _task = handle_processor_task(
-      _engine->start()
+      ss::parallel_for_each(
+        _engines, [](const auto& engine) { return engine->start(); })
         .then([this] { return load_latest_committed(); })
         .then(
           [this](absl::flat_hash_map<model::output_topic_index, kafka::offset>
@@ -178,13 +197,19 @@ ss::future<> processor::stop() {
     auto ex = std::make_exception_ptr(processor_shutdown_exception());
     _as.request_abort_ex(ex);
     co_await std::exchange(_task, ss::now());
+    // Batches still being transformed hold on to their engine, wait for them
+    // so that the engines can be stopped.
+    co_await _idle_engines_sem.wait(_engines.size());
+    _idle_engines_sem.signal(_engines.size());
     _consumer_transform_pipe.clear();
+    _in_flight.clear();
     for (auto& [_, output] : _outputs) {
         output.queue.clear();
     }
     co_await _source->stop();
     co_await _offset_tracker->stop();
-    co_await _engine->stop();
+    co_await ss::parallel_for_each(
+      _engines, [](const auto& engine) { return engine->stop(); });
     // reset lag now that we've stopped
     for (const auto& [_, output] : _outputs) {
         report_lag(output.index, 0);
@@ -249,9 +274,14 @@ ss::future<> processor::run_consumer_loop(kafka::offset offset) {
         co_await output.queue.push({kafka::prev_offset(offset)}, &_as);
     }
     while (!_as.abort_requested()) {
-        auto reader = co_await _source->read_batch(offset, &_as);
+        size_t max_bytes = std::clamp(
+          _consumer_transform_pipe.max_memory(),
+          min_read_bytes,
+          max_read_bytes);
+        auto reader = co_await _source->read_batch(offset, max_bytes, &_as);
         auto last_offset = co_await std::move(reader).consume(
-          queue_output_consumer(&_consumer_transform_pipe, &_as, _probe),
+          queue_output_consumer(
+            &_consumer_transform_pipe, &_as, _probe, _memory_share.get()),
           model::no_timeout);
         if (!last_offset) {
             vlog(
@@ -267,15 +297,22 @@ ss::future<> processor::run_consumer_loop(kafka::offset offset) {
 }
 
 ss::future<> processor::run_transform_loop() {
+    if (_engines.size() > 1) {
+        co_await when_all_shutdown(
+          run_parallel_transform_loop(), run_reassembly_loop());
+        co_return;
+    }
+    const auto& engine = _engines.front();
     while (!_as.abort_requested()) {
-        auto batch = co_await _consumer_transform_pipe.pop_one(&_as);
+        auto batch = co_await pop_input();
         if (!batch) {
             continue;
         }
         auto offset = model::offset_cast(batch->last_offset());
+        auto max_timestamp = batch->header().max_timestamp;
         ss::chunked_fifo<model::transformed_data> transformed;
         vlog(_logger.trace, "transforming offset {}", offset);
-        co_await _engine->transform(
+        co_await engine->transform(
           std::move(*batch),
           _probe,
           [this](
@@ -296,7 +333,84 @@ ss::future<> processor::run_transform_loop() {
         vlog(_logger.trace, "transformed offset {}", offset);
         // Mark all queues as processsed up to this point.
         for (auto& [_, output] : _outputs) {
-            co_await output.queue.push({offset}, &_as);
+            co_await output.queue.push({offset, max_timestamp}, &_as);
+        }
+    }
+}
+
+ss::future<> processor::run_parallel_transform_loop() {
+    while (!_as.abort_requested()) {
+        auto batch = co_await pop_input();
+        if (!batch) {
+            continue;
+        }
+        // Engines become idle once they're done with a batch, whether or not
+        // we're stopping, so this is not abortable.
+        co_await _idle_engines_sem.wait(1);
+        auto engine = std::move(_idle_engines.back());
+        _idle_engines.pop_back();
+        auto offset = model::offset_cast(batch->last_offset());
+        auto max_timestamp = batch->header().max_timestamp;
+        size_t batch_size = batch->size_bytes();
+        auto result = ss::make_lw_shared<transform_result>();
+        vlog(_logger.trace, "transforming offset {}", offset);
+        // The output is buffered until the batches before it are written.
+        auto cb = [this, result](
+                    std::optional<model::topic_view> topic,
+                    model::transformed_data data) {
+            output* out = _default_output;
+            if (topic) {
+                auto it = _outputs.find(topic.value());
+                if (it == _outputs.end()) {
+                    return ssx::now(wasm::write_success::no);
+                }
+                out = &it->second;
+            }
+            result->records.emplace_back(out, std::move(data));
+            return ssx::now(wasm::write_success::yes);
+        };
+        auto done = engine->transform(std::move(*batch), _probe, std::move(cb))
+                      .handle_exception([result](std::exception_ptr ex) {
+                          result->error = std::move(ex);
+                      })
+                      .finally([this, engine]() mutable {
+                          _idle_engines.push_back(std::move(engine));
+                          _idle_engines_sem.signal();
+                      });
+        co_await _in_flight.push(
+          {.offset = offset,
+           .max_timestamp = max_timestamp,
+           .batch_size = batch_size,
+           .result = std::move(result),
+           .done = std::move(done)},
+          &_as);
+    }
+}
+
+ss::future<std::optional<model::record_batch>> processor::pop_input() {
+    auto m = _probe->read_wait_measurement();
+    co_return co_await _consumer_transform_pipe.pop_one(&_as);
+}
+
+ss::future<> processor::run_reassembly_loop() {
+    while (!_as.abort_requested()) {
+        auto transform = co_await _in_flight.pop_one(&_as);
+        if (!transform) {
+            continue;
+        }
+        co_await std::move(transform->done);
+        auto& result = *transform->result;
+        if (result.error) {
+            std::rethrow_exception(result.error);
+        }
+        vlog(_logger.trace, "transformed offset {}", transform->offset);
+        for (auto& [out, data] : result.records) {
+            co_await out->queue.push({std::move(data)}, &_as);
+        }
+        // Mark all queues as processsed up to this point.
+        for (auto& [_, output] : _outputs) {
+            co_await output.queue.push(
+              {transform->offset, transform->max_timestamp}, &_as);
         }
     }
 }
@@ -332,6 +446,7 @@ ss::future<> processor::run_producer_loop(
             continue;
         }
         kafka::offset latest_offset = last_committed;
+        auto source_timestamp = model::timestamp::missing();
         ss::chunked_fifo<model::transformed_data> records;
         for (auto& entry : popped) {
             ss::visit(
@@ -342,14 +457,14 @@ ss::future<> processor::run_producer_loop(
                   }
                   records.push_back(std::move(d));
               },
-              [&latest_offset, &suppress, last_committed](
-                kafka::offset offset) {
+              [&](kafka::offset offset) {
                   // Stop supressing new records when we see new records from
                   // the last commit.
                   // This can happen if other sinks are behind this one and we
                   // have to replay history.
                   suppress = last_committed > offset;
                   latest_offset = offset;
+                  source_timestamp = entry.source_timestamp;
               });
         }
         if (!records.empty()) {
@@ -360,7 +475,19 @@ ss::future<> processor::run_producer_loop(
             _probe->increment_write_bytes(index, batch.size_bytes());
             ss::chunked_fifo<model::record_batch> batches;
             batches.push_back(std::move(batch));
-            co_await sink->write(std::move(batches));
+            {
+                auto m = _probe->write_wait_measurement();
+                co_await sink->write(std::move(batches));
+            }
+            // Clients can set timestamps from a clock that is ahead of ours.
+            auto latency = model::timestamp::now().value()
+                           - source_timestamp.value();
+            if (
+              source_timestamp != model::timestamp::missing()
+              && latency >= 0) {
+                _probe->record_end_to_end_latency(
+                  std::chrono::milliseconds(latency));
+            }
         }
         if (latest_offset > last_committed) {
             vlog(
@@ -396,6 +523,25 @@ void processor::report_lag(model::output_topic_index idx, int64_t lag) {
     int64_t delta = lag - _last_reported_lag[idx()];
     _probe->report_lag(idx, delta);
     _last_reported_lag[idx()] = lag;
+    if (_memory_share) {
+        _memory_share->report_lag(current_lag());
+    }
+}
+
+void processor::set_memory_share(memory_budget::share_holder share) {
+    _memory_share = std::move(share);
+    _memory_share->watch([this](size_t limit) { set_memory_limit(limit); });
+    set_memory_limit(_memory_share->limit());
+}
+
+void processor::set_memory_limit(size_t limit) {
+    // Split evenly between the input of the transform and each output.
+    size_t per_queue = limit / (_outputs.size() + 1);
+    _consumer_transform_pipe.set_max_memory(per_queue);
+    _in_flight.set_max_memory(per_queue);
+    for (auto& [_, output] : _outputs) {
+        output.queue.set_max_memory(per_queue);
+    }
 }
 
 model::transform_id processor::id() const { return _id; }
@@ -411,6 +557,12 @@ int64_t processor::current_lag() const {
       _last_reported_lag.begin(), _last_reported_lag.end());
 }
 
+size_t processor::in_flight_transform::memory_usage() const {
+    // The transformed records are not known until the transform is done, the
+    // size of the batch stands in for them.
+    return sizeof(in_flight_transform) + batch_size;
+}
+
 size_t transformed_output::memory_usage() const {
     return sizeof(transformed_output)
            + ss::visit(
@@ -18,19 +18,26 @@
 #include "model/record_batch_reader.h"
 #include "model/transform.h"
 #include "transform/io.h"
+#include "transform/memory_budget.h"
 #include "transform/probe.h"
 #include "transform/transfer_queue.h"
+#include "ssx/semaphore.h"
 #include "utils/prefix_logger.h"
 #include "wasm/fwd.h"
 
 #include <seastar/core/abort_source.hh>
+#include <seastar/core/chunked_fifo.hh>
 #include <seastar/core/queue.hh>
+#include <seastar/core/shared_ptr.hh>
 #include <seastar/util/noncopyable_function.hh>
 
 #include <absl/container/flat_hash_map.h>
 
+#include <exception>
 #include <memory>
+#include <utility>
 #include <variant>
+#include <vector>
 
 namespace transform {
 
@@ -40,6 +47,9 @@ namespace transform {
  */
 struct transformed_output {
     std::variant<model::transformed_data, kafka::offset> data;
+    // For a committed offset, the max timestamp of the input batch that ends
+    // at the offset.
+    model::timestamp source_timestamp = model::timestamp::missing();
 
     // How much memory this object is using.
     size_t memory_usage() const;
@@ -50,6 +60,10 @@ struct transformed_output {
  *
  * At it's heart it's a fiber that reads->transforms->writes batches
  * from an input ntp to an output ntp.
+ *
+ * Given more than one engine, batches are handed out to the engines that are
+ * idle, so that several batches are transformed at once, and the output of
+ * each is written once the batches before it are written.
  */
 class processor {
 public:
@@ -61,7 +75,7 @@ public:
       model::transform_id,
       model::ntp,
       model::transform_metadata,
-      ss::shared_ptr<wasm::engine>,
+      std::vector<ss::shared_ptr<wasm::engine>>,
       state_callback,
       std::unique_ptr<source>,
       std::vector<std::unique_ptr<sink>>,
@@ -81,9 +95,17 @@ public:
     const model::transform_metadata& meta() const;
     int64_t current_lag() const;
 
+    // Limit the memory buffered by this processor to its share of the
+    // budget of the shard. Otherwise each queue has a fixed limit.
+    void set_memory_share(memory_budget::share_holder);
+
 private:
     ss::future<> run_consumer_loop(kafka::offset);
     ss::future<> run_transform_loop();
+    ss::future<> run_parallel_transform_loop();
+    ss::future<> run_reassembly_loop();
+    // Pop the next batch to transform, recording how long it took to arrive.
+    ss::future<std::optional<model::record_batch>> pop_input();
     ss::future<> run_all_producers(
       absl::flat_hash_map<model::output_topic_index, kafka::offset>);
     ss::future<> run_producer_loop(
@@ -95,6 +117,7 @@ private:
     ss::future<absl::flat_hash_map<model::output_topic_index, kafka::offset>>
     load_latest_committed();
     void report_lag(model::output_topic_index, int64_t);
+    void set_memory_limit(size_t);
 
     template<typename... Future>
     ss::future<> when_all_shutdown(Future&&...);
@@ -103,7 +126,7 @@ private:
     model::transform_id _id;
     model::ntp _ntp;
     model::transform_metadata _meta;
-    ss::shared_ptr<wasm::engine> _engine;
+    std::vector<ss::shared_ptr<wasm::engine>> _engines;
     std::unique_ptr<source> _source;
     std::unique_ptr<offset_tracker> _offset_tracker;
     state_callback _state_callback;
@@ -122,10 +145,31 @@ private:
     absl::flat_hash_map<model::topic, output> _outputs;
     output* _default_output = nullptr;
 
+    struct transform_result {
+        ss::chunked_fifo<std::pair<output*, model::transformed_data>> records;
+        std::exception_ptr error;
+    };
+    // A batch that is being transformed when there are multiple engines.
+    struct in_flight_transform {
+        kafka::offset offset;
+        model::timestamp max_timestamp;
+        size_t batch_size;
+        ss::lw_shared_ptr<transform_result> result;
+        // Never fails, errors are in the result.
+        ss::future<> done;
+
+        size_t memory_usage() const;
+    };
+    transfer_queue<in_flight_transform> _in_flight;
+    // The engines that are not transforming a batch.
+    std::vector<ss::shared_ptr<wasm::engine>> _idle_engines;
+    ssx::semaphore _idle_engines_sem{0, "transform_idle_engines"};
+
     ss::abort_source _as;
     ss::future<> _task;
     prefix_logger _logger;
 
     std::vector<int64_t> _last_reported_lag;
+    memory_budget::share_holder _memory_share;
 };
 } // namespace transform
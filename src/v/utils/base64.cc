@@ -10,12 +10,18 @@
  */
 #include "utils/base64.h"
 
+#include "base/units.h"
 #include "base/vassert.h"
 
 #include <seastar/core/sstring.hh>
+#include <seastar/core/temporary_buffer.hh>
 
 #include <libbase64.h>
 
+// Size of the input decoded into each fragment of base64_to_iobuf, the output
+// fragments are 3/4 of it (12KiB)
+static constexpr size_t decode_chunk_size = 16_KiB;
+
 // Required length is ceil(4n/3) rounded up to 4 bytes
 static inline size_t encode_capacity(size_t input_size) {
     return (((4 * input_size) / 3) + 3) & ~0x3U;
@@ -110,3 +116,43 @@ ss::sstring iobuf_to_base64(const iobuf& input) {
     output.resize(written);
     return output;
 }
+
+iobuf base64_to_iobuf(std::string_view input) {
+    iobuf output;
+    base64_state state; // NOLINT
+    base64_stream_decode_init(&state, 0);
+
+    while (!input.empty()) {
+        const auto chunk = input.substr(0, decode_chunk_size);
+        input.remove_prefix(chunk.size());
+
+        // at most 3 characters of the previous chunk are carried over
+        const size_t output_capacity = (chunk.size() + 3) / 4 * 3;
+        ss::temporary_buffer<char> fragment(output_capacity);
+        size_t output_len; // NOLINT
+        int ret = base64_stream_decode(
+          &state,
+          chunk.data(),
+          chunk.size(),
+          fragment.get_write(),
+          &output_len);
+        if (unlikely(ret != 1)) {
+            throw base64_decoder_exception();
+        }
+        vassert(
+          output_len <= output_capacity,
+          "base64 decode overflow: {} > {}",
+          output_len,
+          output_capacity);
+        if (output_len > 0) {
+            fragment.trim(output_len);
+            output.append(std::move(fragment));
+        }
+    }
+
+    // a partial quantum left at the end means the input was truncated
+    if (unlikely(state.bytes != 0)) {
+        throw base64_decoder_exception();
+    }
+    return output;
+}
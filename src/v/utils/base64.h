@@ -31,3 +31,5 @@ ss::sstring base64_to_string(std::string_view);
 
 // base64 <-> iobuf
 ss::sstring iobuf_to_base64(const iobuf&);
+// decodes in fragments, without a contiguous allocation for the whole output
+iobuf base64_to_iobuf(std::string_view);
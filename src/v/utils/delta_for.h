@@ -18,11 +18,14 @@
 
 #include <seastar/util/log.hh>
 
+#include <array>
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <span>
 #include <type_traits>
+#include <utility>
 #include <variant>
 
 namespace details {
@@ -176,6 +179,16 @@ constexpr auto unsigned_decomposition = [] {
     return decomposition;
 }();
 
+// the unsigned type of a word of the decomposition
+template<size_t bytes>
+using word_t = std::conditional_t<
+  bytes == sizeof(uint64_t),
+  uint64_t,
+  std::conditional_t<
+    bytes == sizeof(uint32_t),
+    uint32_t,
+    std::conditional_t<bytes == sizeof(uint16_t), uint16_t, uint8_t>>>;
+
 template<size_t N_BITS>
 constexpr auto whole_bytes = N_BITS / 8;
 template<size_t N_BITS>
@@ -609,60 +622,110 @@ public:
 private:
     template<size_t N_BITS>
     void unpack(std::span<TVal, row_width> output) {
-        std::ranges::fill(output, TVal{0});
+        unpack_row<N_BITS>(output);
+    }
+
+#if defined(__x86_64__)
+    // the same kernels built for AVX2, the widening loops below then work on
+    // 256 bit vectors. On aarch64 the baseline kernels already use NEON.
+    template<size_t N_BITS>
+    [[gnu::target("avx2")]] void
+    unpack_avx2(std::span<TVal, row_width> output) {
+        unpack_row<N_BITS>(output);
+    }
+#endif
+
+    template<size_t N_BITS>
+    [[gnu::always_inline]] void unpack_row(std::span<TVal, row_width> output) {
+        std::array<uint64_t, row_width> values{};
         if constexpr (N_BITS > 0) {
             using namespace details::decomp;
 
             std::array<uint8_t, serialized_size<N_BITS, row_width>> tmp_buffer;
             _data.consume_to(tmp_buffer.size(), tmp_buffer.begin());
 
-            auto end_it = tmp_buffer.cbegin();
+            const uint8_t* end_it = tmp_buffer.data();
             // step 1: deserialize whole bytes and paste them in place,
-            // following decomposition in words
+            // following decomposition in words. The words of a row are
+            // stored back to back so they're loaded as a block and widened
+            // in a fixed width loop which the compiler vectorizes.
             constexpr static auto decom = unsigned_decomposition<N_BITS>;
             [&]<size_t... Is>(std::index_sequence<Is...>) {
                 (
                   [&] {
                       constexpr auto bytes_to_restore = decom[Is].first;
                       constexpr auto shift_of_restored = decom[Is].second;
-                      for (auto& e : output) {
-                          auto tmp = std::make_unsigned_t<TVal>{};
-                          end_it = deserialize_little_endian<bytes_to_restore>(
-                            end_it, tmp);
-                          e |= tmp << shift_of_restored;
+                      static_assert(
+                        std::endian::native == std::endian::little,
+                        "to work on a big-endian machine, insert "
+                        "`words[i]=std::byteswap(words[i]);`");
+                      std::array<word_t<bytes_to_restore>, row_width> words;
+                      std::memcpy(words.data(), end_it, sizeof(words));
+                      end_it += sizeof(words);
+                      for (size_t i = 0; i < row_width; ++i) {
+                          values[i] |= uint64_t(words[i]) << shift_of_restored;
                       }
                   }(),
                   ...);
             }(std::make_index_sequence<decom.size()>{});
 
-            // step 2: unpack leftover bits into from a single __uint128_t,
-            // little endian wise. masking is not strictly necessary, but it
-            // ensures that the elements to not clash once unpacked
+            // step 2: unpack the leftover bits. pack() stores them back to
+            // back, `residual` bits per element, so the residuals of the
+            // first and of the last eight elements of the row each fill
+            // exactly `residual` bytes. Each half is loaded in a 64 bit word
+            // and split at constant shifts, rather than shifting a
+            // __uint128_t for every element.
             constexpr static auto residual = residual_bits<N_BITS>;
             if constexpr (residual > 0) {
                 constexpr static auto prev_saved_bits = whole_bytes<N_BITS> * 8;
-                constexpr static auto mask = residual_save_mask<N_BITS>;
-
-                constexpr static auto bytes_to_restore = residual
-                                                         * output.size() / 8;
-                auto bits = __uint128_t{};
-                deserialize_little_endian<bytes_to_restore>(end_it, bits);
-
-                [&]<size_t... Is>(std::index_sequence<Is...>) {
-                    // select residual bits, shift them down to zero and then
-                    // shift them to the appropriate position
-                    return (
-                      (output[Is]
-                       |= ((bits >> (residual * Is)) << prev_saved_bits) & mask)
-                      | ...);
-                }(std::make_index_sequence<output.size()>());
+                constexpr static uint64_t mask = (uint64_t{1} << residual) - 1;
+                constexpr static size_t half = row_width / 2;
+                for (size_t h = 0; h < 2; ++h) {
+                    uint64_t bits = 0;
+                    std::memcpy(&bits, end_it + h * residual, residual);
+                    for (size_t i = 0; i < half; ++i) {
+                        values[h * half + i]
+                          |= ((bits >> (residual * i)) & mask)
+                             << prev_saved_bits;
+                    }
+                }
             }
         }
+        for (size_t i = 0; i < row_width; ++i) {
+            output[i] = static_cast<TVal>(values[i]);
+        }
     }
+
     void unpack(std::span<TVal, row_width> output, uint8_t n) {
-        [&]<size_t... Is>(std::index_sequence<Is...>) {
-            ((void)(n == Is ? (unpack<Is>(output), true) : false), ...);
-        }(std::make_index_sequence<sizeof(uint64_t) * 8 + 1>{});
+        // jump straight to the unpacker of the row's width instead of
+        // testing every width in turn
+        const auto& unpackers = select_unpackers();
+        if (n < unpackers.size()) {
+            (this->*unpackers[n])(output);
+        }
+    }
+
+    using unpack_fn = void (deltafor_decoder::*)(std::span<TVal, row_width>);
+    using unpackers_t = std::array<unpack_fn, sizeof(uint64_t) * 8 + 1>;
+
+    // the unpackers of the best instruction set of the cpu, detected once
+    static const unpackers_t& select_unpackers() {
+        static constexpr auto baseline =
+          []<size_t... Is>(std::index_sequence<Is...>) {
+              return unpackers_t{&deltafor_decoder::unpack<Is>...};
+          }(std::make_index_sequence<std::tuple_size_v<unpackers_t>>{});
+#if defined(__x86_64__)
+        static constexpr auto avx2 =
+          []<size_t... Is>(std::index_sequence<Is...>) {
+              return unpackers_t{&deltafor_decoder::unpack_avx2<Is>...};
+          }(std::make_index_sequence<std::tuple_size_v<unpackers_t>>{});
+        static const unpackers_t& selected = __builtin_cpu_supports("avx2")
+                                               ? avx2
+                                               : baseline;
+        return selected;
+#else
+        return baseline;
+#endif
     }
 
     TVal _initial;
@@ -709,6 +772,26 @@ public:
 
     value_t get_frame_initial_value() const noexcept { return _frame_initial; }
 
+    /// Skip the decoded rows in which every value is below \p value without
+    /// visiting their elements. Only valid for monotonic (delta_delta)
+    /// frames. Stops at the first row that may contain \p value or a larger
+    /// one and at the partially filled head of the frame.
+    void skip_rows_below(value_t value) {
+        while (_pos < _size) {
+            auto row_end = (_pos & ~index_mask) + buffer_depth;
+            if (row_end > _size || _read_buf.back() >= value) {
+                return;
+            }
+            _pos = row_end;
+            if (_pos < _size) {
+                _read_buf = {};
+                if (!_decoder->read(_read_buf)) {
+                    _read_buf = _head;
+                }
+            }
+        }
+    }
+
 private:
     const value_t& dereference() const {
         auto ix = _pos & index_mask;
@@ -996,7 +1079,13 @@ private:
     template<class PredT>
     const_iterator pred_search(value_t value) const {
         PredT pred;
-        for (auto it = begin(); it != end(); ++it) {
+        auto it = begin();
+        if constexpr (std::
+                        is_same_v<delta_alg, details::delta_delta<value_t>>) {
+            // all predicates are false for values below 'value'
+            it.skip_rows_below(value);
+        }
+        for (; it != end(); ++it) {
             if (pred(*it, value)) {
                 return it;
             }
@@ -1149,6 +1238,22 @@ public:
         return _outer_it->get_frame_initial_value();
     }
 
+    /// Skip the rows of the current frame in which every value is below
+    /// \p value. Only valid for monotonic (delta_delta) columns.
+    void skip_rows_below(value_t value) {
+        if (is_end()) {
+            return;
+        }
+        auto before = _inner_it.index();
+        _inner_it.skip_rows_below(value);
+        _ix_column += _inner_it.index() - before;
+        if (_inner_it == _inner_end) {
+            ++_outer_it;
+            _inner_it = _outer_it == _snapshot.end() ? frame_iter_t()
+                                                     : std::move(*_outer_it);
+        }
+    }
+
 private:
     iter_list_t _snapshot;
     outer_iter_t _outer_it;
@@ -1547,6 +1652,8 @@ public:
         }
         if (it != this->_frames.end()) {
             auto start = const_iterator(it, this->_frames.end(), 0, index);
+            // the frame holds a value >= 'value', so the skip stays in it
+            start.skip_rows_below(value);
             for (; start != this->end(); ++start) {
                 if (pred(*start, value)) {
                     return start;
@@ -0,0 +1,42 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "utils/lock_contention.h"
+
+thread_local bool lock_class::_tracking_enabled = false;
+thread_local std::vector<std::unique_ptr<lock_class_stats>>
+  lock_class::_local_stats;
+
+std::vector<const lock_class*>& lock_class::registry() {
+    // classes register themselves during static initialization, the
+    // registry is built on first use to not depend on the order of it
+    static std::vector<const lock_class*> classes;
+    return classes;
+}
+
+lock_class::lock_class(const char* name)
+  : _name(name)
+  , _id(registry().size()) {
+    registry().push_back(this);
+}
+
+const std::vector<const lock_class*>& lock_class::all() { return registry(); }
+
+lock_class_stats& lock_class::local_stats() const {
+    if (_local_stats.size() <= _id) {
+        _local_stats.resize(_id + 1);
+    }
+    auto& stats = _local_stats[_id];
+    if (!stats) {
+        stats = std::make_unique<lock_class_stats>();
+    }
+    return *stats;
+}
@@ -0,0 +1,141 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "base/seastarx.h"
+#include "utils/mergeable_hist.h"
+
+#include <seastar/core/future.hh>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/// Contention of the locks of a lock_class on a shard.
+struct lock_class_stats {
+    // time spent waiting for the lock by the acquisitions that had to wait
+    mergeable_hist wait_us;
+    // time the lock was held for, by the holders that say when they release
+    // it (e.g. mutex::with)
+    mergeable_hist hold_us;
+    uint64_t acquisitions{0};
+    uint64_t contended_acquisitions{0};
+    // acquisitions currently waiting for the lock
+    uint64_t waiters{0};
+};
+
+/**
+ * A named class of locks whose contention is measured, e.g. every segment
+ * rolling lock of the shard. The locks of a class share its statistics, so
+ * that the cardinality of the metrics is the number of classes rather than
+ * the number of locks.
+ *
+ * Classes are declared with static storage at namespace scope, the set of
+ * classes is fixed once the program started:
+ *
+ *    ```
+ *    inline const lock_class roll_lock_class{"segments_rolling_lock"};
+ *    mutex _lock{"segments_rolling_lock", roll_lock_class};
+ *    ```
+ *
+ * Tracking is off by default. Locks without a class, or all locks while it
+ * is off, are acquired as before, at the cost of a branch.
+ */
+class lock_class {
+public:
+    using clock_type = std::chrono::steady_clock;
+
+    explicit lock_class(const char* name);
+    lock_class(const lock_class&) = delete;
+    lock_class& operator=(const lock_class&) = delete;
+    lock_class(lock_class&&) = delete;
+    lock_class& operator=(lock_class&&) = delete;
+    ~lock_class() = default;
+
+    const char* name() const { return _name; }
+
+    /// The statistics of the class on this shard.
+    lock_class_stats& local_stats() const;
+
+    /// Every declared class.
+    static const std::vector<const lock_class*>& all();
+
+    /// Whether contention is tracked on this shard.
+    static bool tracking_enabled() { return _tracking_enabled; }
+    static void set_tracking_enabled(bool enabled) {
+        _tracking_enabled = enabled;
+    }
+
+private:
+    static std::vector<const lock_class*>& registry();
+
+    const char* _name;
+    size_t _id;
+
+    static thread_local bool _tracking_enabled;
+    static thread_local std::vector<std::unique_ptr<lock_class_stats>>
+      _local_stats;
+};
+
+namespace detail {
+
+inline uint64_t elapsed_us(lock_class::clock_type::time_point since) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+             lock_class::clock_type::now() - since)
+      .count();
+}
+
+} // namespace detail
+
+/**
+ * Acquires a lock with \p acquire, which returns the future of the units of
+ * the lock, and records the acquisition on the statistics of \p cls if it
+ * is tracked. A future that is ready right away did not wait.
+ */
+template<typename Acquire>
+auto acquire_tracked(const lock_class* cls, Acquire&& acquire) noexcept {
+    if (likely(cls == nullptr || !lock_class::tracking_enabled())) {
+        return acquire();
+    }
+    auto fut = acquire();
+    auto& stats = cls->local_stats();
+    ++stats.acquisitions;
+    if (fut.available()) {
+        return fut;
+    }
+    ++stats.contended_acquisitions;
+    ++stats.waiters;
+    return std::move(fut).finally(
+      [&stats, start = lock_class::clock_type::now()] {
+          --stats.waiters;
+          stats.wait_us.record(detail::elapsed_us(start));
+      });
+}
+
+/**
+ * Runs \p func under \p units, the units of a lock of \p cls, and records for
+ * how long the lock was held if it is tracked.
+ */
+template<typename Units, typename Func>
+auto hold_tracked(const lock_class* cls, Units units, Func&& func) noexcept {
+    if (likely(cls == nullptr || !lock_class::tracking_enabled())) {
+        return ss::futurize_invoke(std::forward<Func>(func))
+          .finally([units = std::move(units)] {});
+    }
+    return ss::futurize_invoke(std::forward<Func>(func))
+      .finally([cls,
+                units = std::move(units),
+                start = lock_class::clock_type::now()] {
+          cls->local_stats().hold_us.record(detail::elapsed_us(start));
+      });
+}
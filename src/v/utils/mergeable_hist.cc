@@ -0,0 +1,81 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "utils/mergeable_hist.h"
+
+#include <cmath>
+
+mergeable_hist& mergeable_hist::operator+=(const mergeable_hist& o) noexcept {
+    for (size_t i = 0; i < bucket_count; ++i) {
+        _counts[i] += o._counts[i];
+    }
+    _sample_count += o._sample_count;
+    _sample_sum += o._sample_sum;
+    _max = std::max(_max, o._max);
+    return *this;
+}
+
+double mergeable_hist::mean() const {
+    if (_sample_count == 0) {
+        return 0;
+    }
+    return static_cast<double>(_sample_sum)
+           / static_cast<double>(_sample_count);
+}
+
+uint64_t mergeable_hist::get_value_at(double percentile) const {
+    if (_sample_count == 0) {
+        return 0;
+    }
+    const auto target = std::max<uint64_t>(
+      1,
+      static_cast<uint64_t>(std::ceil(
+        std::clamp(percentile, 0.0, 100.0) / 100.0
+        * static_cast<double>(_sample_count))));
+    uint64_t cumulative = 0;
+    for (size_t i = 0; i < bucket_count; ++i) {
+        cumulative += _counts[i];
+        if (cumulative >= target) {
+            return std::min(highest_value(i), _max);
+        }
+    }
+    return _max;
+}
+
+ss::metrics::histogram mergeable_hist::seastar_histogram_logform(
+  size_t num_buckets,
+  int64_t first_value,
+  double log_base,
+  int64_t scale) const {
+    ss::metrics::histogram sshist;
+    sshist.buckets.resize(num_buckets);
+    sshist.sample_count = _sample_count;
+    sshist.sample_sum = static_cast<double>(_sample_sum)
+                        / static_cast<double>(scale);
+
+    // like hdr_hist, the bounds grow by the integral part of log_base and the
+    // upper bound of a bucket is the highest value equivalent to its bound
+    uint64_t bound = std::max<int64_t>(first_value, 1);
+    const auto growth = std::max<uint64_t>(static_cast<uint64_t>(log_base), 2);
+    uint64_t cumulative = 0;
+    size_t counted = 0;
+    for (auto& bucket : sshist.buckets) {
+        const auto index = bucket_index(bound);
+        for (; counted <= index; ++counted) {
+            cumulative += _counts[counted];
+        }
+        bucket.count = cumulative;
+        bucket.upper_bound = static_cast<double>(highest_value(index))
+                             / static_cast<double>(scale);
+        bound = bound > ~uint64_t{0} / growth ? ~uint64_t{0} : bound * growth;
+    }
+    return sshist;
+}
@@ -0,0 +1,131 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "base/seastarx.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/metrics_types.hh>
+#include <seastar/core/sharded.hh>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <functional>
+
+/*
+ * A histogram of fixed size that is cheap to record to and to merge, meant
+ * for the latencies and sizes aggregated over all the shards.
+ *
+ * Values below 2^sub_bucket_bits have a bucket each, every power of two range
+ * [2^k, 2^(k+1)) above is split in 2^sub_bucket_bits buckets of the same
+ * width, so a value is known within 1/2^sub_bucket_bits of itself (12.5%),
+ * over the whole range of uint64_t. The buckets are a flat array of counters
+ * (about 4KiB): recording is a few arithmetic instructions and an increment,
+ * it never allocates nor waits, and merging two histograms adds their arrays.
+ *
+ * Every shard records to its own histogram, histograms are merged when read,
+ * see merge_shards.
+ */
+class mergeable_hist {
+public:
+    static constexpr unsigned sub_bucket_bits = 3;
+    static constexpr size_t sub_bucket_count = size_t{1} << sub_bucket_bits;
+    static constexpr size_t bucket_count = (64 - sub_bucket_bits + 1)
+                                           * sub_bucket_count;
+
+    void record(uint64_t value) noexcept { record_multiple_times(value, 1); }
+
+    void record_multiple_times(uint64_t value, uint64_t times) noexcept {
+        _counts[bucket_index(value)] += times;
+        _sample_count += times;
+        _sample_sum += value * times;
+        _max = std::max(_max, value);
+    }
+
+    mergeable_hist& operator+=(const mergeable_hist& o) noexcept;
+
+    void reset() noexcept { *this = mergeable_hist{}; }
+
+    uint64_t sample_count() const { return _sample_count; }
+    uint64_t sample_sum() const { return _sample_sum; }
+    uint64_t max() const { return _max; }
+    double mean() const;
+
+    /// The highest value equivalent to the value at the percentile, within
+    /// the precision of the histogram, or 0 when it is empty
+    uint64_t get_value_at(double percentile) const;
+
+    /// Same buckets as hdr_hist::seastar_histogram_logform
+    ss::metrics::histogram seastar_histogram_logform(
+      size_t num_buckets = 26,
+      int64_t first_value = 10,
+      double log_base = 2.0,
+      int64_t scale = 1) const;
+
+    static constexpr size_t memory_size() { return sizeof(mergeable_hist); }
+
+    static constexpr size_t bucket_index(uint64_t value) {
+        if (value < sub_bucket_count) {
+            return value;
+        }
+        const unsigned shift = std::bit_width(value) - 1 - sub_bucket_bits;
+        return (shift + 1) * sub_bucket_count
+               + ((value >> shift) & (sub_bucket_count - 1));
+    }
+
+    static constexpr uint64_t lowest_value(size_t index) {
+        if (index < sub_bucket_count) {
+            return index;
+        }
+        const size_t shift = index / sub_bucket_count - 1;
+        return (sub_bucket_count + index % sub_bucket_count) << shift;
+    }
+
+    static constexpr uint64_t highest_value(size_t index) {
+        if (index < sub_bucket_count) {
+            return index;
+        }
+        const size_t shift = index / sub_bucket_count - 1;
+        return lowest_value(index) + ((uint64_t{1} << shift) - 1);
+    }
+
+private:
+    std::array<uint64_t, bucket_count> _counts{};
+    uint64_t _sample_count{0};
+    uint64_t _sample_sum{0};
+    uint64_t _max{0};
+};
+
+static_assert(
+  mergeable_hist::bucket_index(~uint64_t{0})
+  == mergeable_hist::bucket_count - 1);
+static_assert(mergeable_hist::highest_value(15) == 15);
+static_assert(mergeable_hist::lowest_value(16) == 16);
+static_assert(mergeable_hist::highest_value(16) == 17);
+
+/// Merges the histograms of all the shards of a service, `hist` returns the
+/// histogram of the local instance.
+template<typename Service, typename Func>
+ss::future<mergeable_hist>
+merge_shards(ss::sharded<Service>& service, Func hist) {
+    return service.map_reduce0(
+      [hist = std::move(hist)](Service& local) {
+          return mergeable_hist(std::invoke(hist, local));
+      },
+      mergeable_hist{},
+      [](mergeable_hist acc, const mergeable_hist& h) {
+          acc += h;
+          return acc;
+      });
+}
@@ -12,6 +12,7 @@
 #pragma once
 #include "base/seastarx.h"
 #include "ssx/semaphore.h"
+#include "utils/lock_contention.h"
 
 /*
  * A traditional mutex. If you are trying to count things or need timeouts, you
@@ -27,6 +28,8 @@
  *    return m.with([] { ... });
  *    ```
  *
+ * A mutex constructed with a lock_class records its contention on the
+ * statistics of the class while tracking is enabled, see lock_contention.h.
  */
 class mutex {
 public:
@@ -37,29 +40,48 @@ public:
     explicit mutex(ss::sstring name)
       : _sem(1, std::move(name)) {}
 
+    mutex(ss::sstring name, const lock_class& cls)
+      : _sem(1, std::move(name))
+      , _class(&cls) {}
+
     template<typename Func>
     auto with(Func&& func) noexcept {
-        return ss::with_semaphore(_sem, 1, std::forward<Func>(func));
+        if (likely(!is_tracked())) {
+            return ss::with_semaphore(_sem, 1, std::forward<Func>(func));
+        }
+        return with_units(get_units(), std::forward<Func>(func));
     }
 
     template<typename Func>
     auto with(duration timeout, Func&& func) noexcept {
-        return ss::with_semaphore(_sem, 1, timeout, std::forward<Func>(func));
+        if (likely(!is_tracked())) {
+            return ss::with_semaphore(
+              _sem, 1, timeout, std::forward<Func>(func));
+        }
+        auto acquire = [this, timeout] {
+            return ss::get_units(_sem, 1, timeout);
+        };
+        return with_units(
+          acquire_tracked(_class, acquire), std::forward<Func>(func));
     }
 
     template<typename Func>
     auto with(time_point timeout, Func&& func) noexcept {
-        return ss::get_units(_sem, 1, timeout)
-          .then([func = std::forward<Func>(func)](auto units) mutable {
-              return ss::futurize_invoke(std::forward<Func>(func))
-                .finally([units = std::move(units)] {});
-          });
+        auto acquire = [this, timeout] {
+            return ss::get_units(_sem, 1, timeout);
+        };
+        return with_units(
+          acquire_tracked(_class, acquire), std::forward<Func>(func));
     }
 
-    ss::future<units> get_units() noexcept { return ss::get_units(_sem, 1); }
+    ss::future<units> get_units() noexcept {
+        return acquire_tracked(
+          _class, [this] { return ss::get_units(_sem, 1); });
+    }
 
     ss::future<units> get_units(ss::abort_source& as) noexcept {
-        return ss::get_units(_sem, 1, as);
+        return acquire_tracked(
+          _class, [this, &as] { return ss::get_units(_sem, 1, as); });
     }
 
     std::optional<units> try_get_units() noexcept {
@@ -75,5 +97,19 @@ public:
     size_t waiters() const noexcept { return _sem.waiters(); }
 
 private:
+    bool is_tracked() const noexcept {
+        return _class != nullptr && lock_class::tracking_enabled();
+    }
+
+    template<typename Func>
+    auto with_units(ss::future<units> f, Func&& func) noexcept {
+        return std::move(f).then(
+          [this, func = std::forward<Func>(func)](units u) mutable {
+              return hold_tracked(
+                _class, std::move(u), std::forward<Func>(func));
+          });
+    }
+
     ssx::semaphore _sem;
+    const lock_class* _class{nullptr};
 };
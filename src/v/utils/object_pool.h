@@ -17,7 +17,10 @@
 
 #include <concepts>
 #include <deque>
+#include <optional>
 #include <stack>
+#include <type_traits>
+#include <vector>
 
 /*
  * This class provides a pool of objects that can allocated or released to.
@@ -136,3 +139,45 @@ private:
     std::stack<T> _objects;
     std::deque<std::unique_ptr<wait_item>> _waiters;
 };
+
+/*
+ * A bounded cache of objects that are worth reusing rather than allocating
+ * again, e.g. the buffers of vectors, meant to be shard local.
+ *
+ * Unlike object_pool it never waits: take_object() returns nothing when the
+ * cache is empty, and objects released to a full cache are dropped.
+ */
+template<std::movable T, size_t max_objects>
+class object_cache {
+public:
+    object_cache() { _objects.reserve(max_objects); }
+
+    /*
+     * Returns the most recently released object, if any.
+     */
+    std::optional<T> take_object() noexcept(
+      std::is_nothrow_move_constructible_v<T>) {
+        if (_objects.empty()) {
+            return std::nullopt;
+        }
+        std::optional<T> ret(std::move(_objects.back()));
+        _objects.pop_back();
+        return ret;
+    }
+
+    /*
+     * Keeps the object for a later take_object() unless the cache is full.
+     * Never allocates.
+     */
+    void
+    release_object(T obj) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (_objects.size() < max_objects) {
+            _objects.push_back(std::move(obj));
+        }
+    }
+
+    size_t size() const { return _objects.size(); }
+
+private:
+    std::vector<T> _objects;
+};
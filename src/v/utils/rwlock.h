@@ -12,6 +12,7 @@
 #pragma once
 #include "base/seastarx.h"
 #include "ssx/semaphore.h"
+#include "utils/lock_contention.h"
 
 #include <seastar/core/rwlock.hh>
 
@@ -52,8 +53,34 @@ public:
     ~rwlock_unit() noexcept;
 };
 
+/*
+ * A rwlock constructed with a lock_class records the contention of
+ * hold_read_lock and hold_write_lock on the statistics of the class while
+ * tracking is enabled, see lock_contention.h.
+ */
 class rwlock : public ss::basic_rwlock<> {
 public:
+    using time_point = ss::semaphore::time_point;
+
+    rwlock() = default;
+    explicit rwlock(const lock_class& cls)
+      : _class(&cls) {}
+
+    using ss::basic_rwlock<>::hold_read_lock;
+    using ss::basic_rwlock<>::hold_write_lock;
+
+    ss::future<holder> hold_read_lock(time_point timeout = time_point::max()) {
+        return acquire_tracked(_class, [this, timeout] {
+            return ss::basic_rwlock<>::hold_read_lock(timeout);
+        });
+    }
+
+    ss::future<holder> hold_write_lock(time_point timeout = time_point::max()) {
+        return acquire_tracked(_class, [this, timeout] {
+            return ss::basic_rwlock<>::hold_write_lock(timeout);
+        });
+    }
+
     std::optional<rwlock_unit> attempt_read_lock() {
         bool locked = try_read_lock();
 
@@ -73,6 +100,9 @@ public:
 
         return rwlock_unit(this, true);
     }
+
+private:
+    const lock_class* _class{nullptr};
 };
 
 inline rwlock_unit::~rwlock_unit() noexcept {
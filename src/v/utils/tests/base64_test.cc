@@ -7,6 +7,7 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "base/units.h"
 #include "bytes/random.h"
 #include "random/generators.h"
 #include "utils/base64.h"
@@ -49,3 +50,27 @@ BOOST_AUTO_TEST_CASE(iobuf_type) {
     auto decoded = base64_to_bytes(encoded);
     BOOST_REQUIRE_EQUAL(decoded, iobuf_to_bytes(buf));
 }
+
+BOOST_AUTO_TEST_CASE(base64_to_iobuf_type) {
+    auto decode = [](std::string_view encoded) {
+        return iobuf_to_bytes(base64_to_iobuf(encoded));
+    };
+
+    BOOST_REQUIRE(base64_to_iobuf("").empty());
+    BOOST_REQUIRE_EQUAL(decode("dGhpcyBpcyBhIHN0cmluZw=="), "this is a string");
+    BOOST_REQUIRE_EQUAL(decode("YQ=="), "a");
+    BOOST_REQUIRE_THROW(base64_to_iobuf("YQ"), base64_decoder_exception);
+    BOOST_REQUIRE_THROW(base64_to_iobuf("Y!=="), base64_decoder_exception);
+
+    // larger than a decoded fragment, the quanta straddle the fragments
+    for (size_t size : {12_KiB - 1, 12_KiB, 12_KiB + 1, 100_KiB + 7}) {
+        auto data = random_generators::get_bytes(size);
+        auto encoded = bytes_to_base64(data);
+        auto decoded = base64_to_iobuf(encoded);
+        BOOST_REQUIRE_EQUAL(decoded.size_bytes(), size);
+        if (size > 12_KiB) {
+            BOOST_REQUIRE_GT(std::distance(decoded.begin(), decoded.end()), 1);
+        }
+        BOOST_REQUIRE_EQUAL(iobuf_to_bytes(decoded), data);
+    }
+}
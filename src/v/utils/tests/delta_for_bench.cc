@@ -17,7 +17,9 @@
 #include <seastar/util/defer.hh>
 
 #include <absl/container/btree_map.h>
+#include <fmt/core.h>
 
+#include <chrono>
 #include <ranges>
 #include <vector>
 
@@ -264,3 +266,98 @@ PERF_TEST(deltafor_bench, xor_column_at_with_index_4K) {
     column.at_index(4000, it);
     perf_tests::stop_measuring_time();
 }
+
+/*
+ * Decoding of rows packed with exactly `N_BITS` bits per value. Every run
+ * decodes the same rows, perf_tests reports the time per value and the summary
+ * printed at the end of each test the values decoded per second.
+ */
+template<size_t N_BITS>
+class unpack_bench {
+public:
+    static constexpr size_t rows = 1024;
+    static constexpr size_t row_width = details::FOR_buffer_depth;
+
+    unpack_bench()
+      : _encoder(0) {
+        constexpr uint64_t mask = N_BITS == 64 ? ~uint64_t{0}
+                                               : (uint64_t{1} << N_BITS) - 1;
+        constexpr uint64_t top_bit = N_BITS == 0 ? 0
+                                                 : uint64_t{1} << (N_BITS - 1);
+        uint64_t value = 0;
+        for (size_t r = 0; r < rows; ++r) {
+            std::array<uint64_t, row_width> row{};
+            for (auto& v : row) {
+                // the xor of consecutive values is the delta, setting its
+                // top bit makes every row exactly N_BITS wide
+                value ^= (random_generators::get_int<uint64_t>() & mask)
+                         | top_bit;
+                v = value;
+            }
+            _encoder.add(row);
+        }
+    }
+
+    unpack_bench(const unpack_bench&) = delete;
+    unpack_bench(unpack_bench&&) = delete;
+    unpack_bench& operator=(const unpack_bench&) = delete;
+    unpack_bench& operator=(unpack_bench&&) = delete;
+
+    ~unpack_bench() {
+        const auto seconds = std::chrono::duration<double>(_measured).count();
+        if (_values == 0 || seconds <= 0) {
+            return;
+        }
+        fmt::print(
+          "bits: {} values/s: {:.0f}\n",
+          N_BITS,
+          static_cast<double>(_values) / seconds);
+    }
+
+    size_t run() {
+        deltafor_decoder<uint64_t> decoder(
+          0, _encoder.get_row_count(), _encoder.copy());
+        std::array<uint64_t, row_width> row{};
+        const auto start = clock_type::now();
+        perf_tests::start_measuring_time();
+        while (decoder.read(row)) {
+            perf_tests::do_not_optimize(row);
+        }
+        perf_tests::stop_measuring_time();
+        _measured += clock_type::now() - start;
+        _values += rows * row_width;
+        return rows * row_width;
+    }
+
+private:
+    using clock_type = std::chrono::steady_clock;
+
+    deltafor_encoder<uint64_t> _encoder;
+    clock_type::duration _measured{0};
+    size_t _values{0};
+};
+
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define UNPACK_PERF_TEST(n_bits)                                               \
+    class unpack_bench_##n_bits : public unpack_bench<n_bits> {};              \
+    PERF_TEST_F(unpack_bench_##n_bits, decode) { return run(); }
+
+UNPACK_PERF_TEST(1);
+UNPACK_PERF_TEST(2);
+UNPACK_PERF_TEST(3);
+UNPACK_PERF_TEST(4);
+UNPACK_PERF_TEST(5);
+UNPACK_PERF_TEST(6);
+UNPACK_PERF_TEST(7);
+UNPACK_PERF_TEST(8);
+UNPACK_PERF_TEST(12);
+UNPACK_PERF_TEST(16);
+UNPACK_PERF_TEST(20);
+UNPACK_PERF_TEST(24);
+UNPACK_PERF_TEST(31);
+UNPACK_PERF_TEST(32);
+UNPACK_PERF_TEST(41);
+UNPACK_PERF_TEST(48);
+UNPACK_PERF_TEST(56);
+UNPACK_PERF_TEST(63);
+UNPACK_PERF_TEST(64);
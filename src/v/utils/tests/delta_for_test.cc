@@ -239,6 +239,42 @@ BOOST_AUTO_TEST_CASE(random_walk_test_8) {
     test_random_walk_roundtrip<int64_t>(test_size, max_delta);
 }
 
+template<class TVal>
+void test_every_width_roundtrip() {
+    // the xor of consecutive values is the delta, rows get every width
+    // from 0 to 64 bits
+    deltafor_encoder<TVal> enc(0);
+    std::vector<TVal> expected;
+    uint64_t value = 0;
+    for (size_t nbits = 0; nbits <= 64; nbits++) {
+        const uint64_t mask = nbits == 64 ? ~uint64_t{0}
+                                          : (uint64_t{1} << nbits) - 1;
+        const uint64_t top_bit = nbits == 0 ? 0 : uint64_t{1} << (nbits - 1);
+        std::array<TVal, details::FOR_buffer_depth> buf{};
+        for (auto& v : buf) {
+            value ^= (random_generators::get_int<uint64_t>() & mask) | top_bit;
+            v = static_cast<TVal>(value);
+            expected.push_back(v);
+        }
+        enc.add(buf);
+    }
+
+    deltafor_decoder<TVal> dec(0, enc.get_row_count(), enc.copy());
+    std::vector<TVal> actual;
+    std::array<TVal, details::FOR_buffer_depth> buf{};
+    while (dec.read(buf)) {
+        std::copy(buf.begin(), buf.end(), std::back_inserter(actual));
+    }
+    BOOST_REQUIRE(expected == actual);
+}
+
+BOOST_AUTO_TEST_CASE(every_width_roundtrip_test) {
+    for (int i = 0; i < 100; i++) {
+        test_every_width_roundtrip<uint64_t>();
+        test_every_width_roundtrip<int64_t>();
+    }
+}
+
 BOOST_AUTO_TEST_CASE(test_compression_ratio) {
     const int num_rows = 100000;
     const int num_elements = num_rows * 16;
@@ -0,0 +1,102 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "base/seastarx.h"
+#include "utils/lock_contention.h"
+#include "utils/mutex.h"
+#include "utils/rwlock.h"
+
+#include <seastar/core/sleep.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+const lock_class test_mutex_class{"test_mutex"};
+const lock_class test_rwlock_class{"test_rwlock"};
+
+struct tracking_enabled {
+    tracking_enabled() { lock_class::set_tracking_enabled(true); }
+    tracking_enabled(const tracking_enabled&) = delete;
+    tracking_enabled& operator=(const tracking_enabled&) = delete;
+    ~tracking_enabled() { lock_class::set_tracking_enabled(false); }
+};
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(test_lock_classes_are_registered) {
+    const auto& all = lock_class::all();
+    BOOST_REQUIRE(
+      std::find(all.begin(), all.end(), &test_mutex_class) != all.end());
+    BOOST_REQUIRE(
+      std::find(all.begin(), all.end(), &test_rwlock_class) != all.end());
+}
+
+SEASTAR_THREAD_TEST_CASE(test_mutex_contention_is_tracked) {
+    tracking_enabled enabled;
+    auto& stats = test_mutex_class.local_stats();
+    const auto acquisitions = stats.acquisitions;
+    const auto contended = stats.contended_acquisitions;
+    const auto waits = stats.wait_us.sample_count();
+    const auto holds = stats.hold_us.sample_count();
+
+    mutex m{"test", test_mutex_class};
+    auto holder = m.get_units().get();
+    auto waiter = m.with([] {});
+    BOOST_REQUIRE_EQUAL(stats.waiters, 1);
+
+    ss::sleep(10ms).get();
+    holder.return_all();
+    waiter.get();
+
+    BOOST_REQUIRE_EQUAL(stats.acquisitions, acquisitions + 2);
+    BOOST_REQUIRE_EQUAL(stats.contended_acquisitions, contended + 1);
+    BOOST_REQUIRE_EQUAL(stats.waiters, 0);
+    BOOST_REQUIRE_EQUAL(stats.wait_us.sample_count(), waits + 1);
+    BOOST_REQUIRE_GE(stats.wait_us.max(), 10000);
+    BOOST_REQUIRE_EQUAL(stats.hold_us.sample_count(), holds + 1);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_rwlock_contention_is_tracked) {
+    tracking_enabled enabled;
+    auto& stats = test_rwlock_class.local_stats();
+    const auto contended = stats.contended_acquisitions;
+
+    ssx::rwlock lock{test_rwlock_class};
+    auto reader = lock.hold_read_lock().get();
+    auto other_reader = lock.hold_read_lock().get();
+    BOOST_REQUIRE_EQUAL(stats.contended_acquisitions, contended);
+
+    auto writer = lock.hold_write_lock();
+    BOOST_REQUIRE_EQUAL(stats.waiters, 1);
+    reader.return_all();
+    other_reader.return_all();
+    writer.get();
+    BOOST_REQUIRE_EQUAL(stats.contended_acquisitions, contended + 1);
+    BOOST_REQUIRE_EQUAL(stats.waiters, 0);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_untracked_when_disabled) {
+    auto& stats = test_mutex_class.local_stats();
+    const auto acquisitions = stats.acquisitions;
+
+    mutex m{"test", test_mutex_class};
+    auto holder = m.get_units().get();
+    auto waiter = m.with([] {});
+    holder.return_all();
+    waiter.get();
+
+    BOOST_REQUIRE_EQUAL(stats.acquisitions, acquisitions);
+    BOOST_REQUIRE_EQUAL(stats.waiters, 0);
+}
@@ -0,0 +1,127 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "utils/mergeable_hist.h"
+
+#include <seastar/core/sharded.hh>
+#include <seastar/core/smp.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+#include <boost/test/tools/old/interface.hpp>
+#include <fmt/core.h>
+
+#include <cstdint>
+#include <random>
+
+namespace {
+
+// the precision of the histogram, a value is known within 1/8 of itself
+bool within_precision(uint64_t actual, uint64_t expected) {
+    const auto diff = actual > expected ? actual - expected : expected - actual;
+    return diff <= expected / mergeable_hist::sub_bucket_count;
+}
+
+struct recorder {
+    mergeable_hist hist;
+
+    ss::future<> stop() { return ss::now(); }
+};
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(test_mergeable_hist_percentiles) {
+    mergeable_hist h;
+    BOOST_REQUIRE_EQUAL(h.get_value_at(50.0), 0);
+    for (uint64_t v = 1; v <= 10000; ++v) {
+        h.record(v);
+    }
+    BOOST_REQUIRE_EQUAL(h.sample_count(), 10000);
+    BOOST_REQUIRE_EQUAL(h.sample_sum(), 10000 * 10001 / 2);
+    BOOST_REQUIRE_EQUAL(h.max(), 10000);
+    BOOST_REQUIRE_EQUAL(h.get_value_at(100.0), 10000);
+    for (double p : {1.0, 10.0, 50.0, 90.0, 99.0, 99.9}) {
+        const auto expected = static_cast<uint64_t>(p * 100);
+        BOOST_CHECK_MESSAGE(
+          within_precision(h.get_value_at(p), expected),
+          fmt::format("p{}: {} vs {}", p, h.get_value_at(p), expected));
+    }
+    // small values are exact
+    mergeable_hist small;
+    small.record_multiple_times(3, 10);
+    BOOST_REQUIRE_EQUAL(small.get_value_at(50.0), 3);
+    BOOST_REQUIRE_EQUAL(small.mean(), 3.0);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_mergeable_hist_merge) {
+    std::mt19937_64 gen(1);
+    mergeable_hist a;
+    mergeable_hist b;
+    mergeable_hist all;
+    for (int i = 0; i < 10000; ++i) {
+        const auto v = gen() >> (gen() % 64);
+        (i % 2 ? a : b).record(v);
+        all.record(v);
+    }
+    a += b;
+    BOOST_REQUIRE_EQUAL(a.sample_count(), all.sample_count());
+    BOOST_REQUIRE_EQUAL(a.sample_sum(), all.sample_sum());
+    BOOST_REQUIRE_EQUAL(a.max(), all.max());
+    for (double p : {0.0, 25.0, 50.0, 75.0, 99.0, 100.0}) {
+        BOOST_REQUIRE_EQUAL(a.get_value_at(p), all.get_value_at(p));
+    }
+    const auto logform_a = a.seastar_histogram_logform();
+    const auto logform_all = all.seastar_histogram_logform();
+    BOOST_REQUIRE_EQUAL(logform_a.sample_count, logform_all.sample_count);
+    for (size_t i = 0; i < logform_a.buckets.size(); ++i) {
+        BOOST_REQUIRE_EQUAL(
+          logform_a.buckets[i].count, logform_all.buckets[i].count);
+    }
+}
+
+SEASTAR_THREAD_TEST_CASE(test_mergeable_hist_logform) {
+    mergeable_hist h;
+    h.record(5);
+    h.record(15);
+    h.record(1000);
+    h.record(uint64_t{1} << 40);
+    const auto logform = h.seastar_histogram_logform();
+    BOOST_REQUIRE_EQUAL(logform.buckets.size(), 26);
+    BOOST_REQUIRE_EQUAL(logform.sample_count, 4);
+    uint64_t prev_count = 0;
+    double prev_bound = 0;
+    for (const auto& bucket : logform.buckets) {
+        BOOST_REQUIRE_GE(bucket.count, prev_count);
+        BOOST_REQUIRE_GT(bucket.upper_bound, prev_bound);
+        prev_count = bucket.count;
+        prev_bound = bucket.upper_bound;
+    }
+    // 10 is the first bound, 20 the second
+    BOOST_REQUIRE_EQUAL(logform.buckets[0].count, 1);
+    BOOST_REQUIRE_EQUAL(logform.buckets[1].count, 2);
+    BOOST_REQUIRE_EQUAL(logform.buckets.back().count, 3);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_mergeable_hist_merge_shards) {
+    ss::sharded<recorder> recorders;
+    recorders.start().get();
+    recorders
+      .invoke_on_all([](recorder& r) {
+          for (uint64_t v = 0; v < 1000; ++v) {
+              r.hist.record(v + 1000 * ss::this_shard_id());
+          }
+      })
+      .get();
+    auto merged = merge_shards(recorders, &recorder::hist).get();
+    recorders.stop().get();
+
+    BOOST_REQUIRE_EQUAL(merged.sample_count(), 1000 * ss::smp::count);
+    BOOST_REQUIRE_EQUAL(merged.max(), 1000 * ss::smp::count - 1);
+    BOOST_REQUIRE(within_precision(
+      merged.get_value_at(50.0), 1000 * ss::smp::count / 2));
+}
@@ -145,3 +145,24 @@ SEASTAR_THREAD_TEST_CASE(test_ordering_waiters) {
     BOOST_REQUIRE(!f3.failed());
     BOOST_REQUIRE(f3.get() == 3);
 }
+
+SEASTAR_THREAD_TEST_CASE(object_cache_test) {
+    object_cache<std::vector<int>, 2> cache;
+    BOOST_REQUIRE(!cache.take_object());
+
+    std::vector<int> a;
+    a.reserve(8);
+    const auto* a_data = a.data();
+    cache.release_object(std::move(a));
+    cache.release_object(std::vector<int>(4));
+    // the cache is full, the object is dropped
+    cache.release_object(std::vector<int>(2));
+    BOOST_REQUIRE_EQUAL(cache.size(), 2);
+
+    // most recently released first
+    BOOST_REQUIRE_EQUAL(cache.take_object()->size(), 4);
+    auto reused = cache.take_object();
+    BOOST_REQUIRE(reused);
+    BOOST_REQUIRE_EQUAL(reused->data(), a_data);
+    BOOST_REQUIRE(!cache.take_object());
+}
@@ -9,7 +9,9 @@
 
 #include "utils/hdr_hist.h"
 #include "utils/log_hist.h"
+#include "utils/mergeable_hist.h"
 
+#include <seastar/core/coroutine.hh>
 #include <seastar/core/reactor.hh>
 #include <seastar/core/sharded.hh>
 #include <seastar/testing/perf_tests.hh>
@@ -37,3 +39,65 @@ PERF_TEST(log_hist, record) {
     perf_tests::stop_measuring_time();
     perf_tests::do_not_optimize(h.internal_histogram_logform());
 }
+
+PERF_TEST(mergeable_hist, record) {
+    mergeable_hist h;
+    perf_tests::start_measuring_time();
+#pragma nounroll
+    for (int i = 0; i < number_of_values_to_record; i++) {
+        [[clang::noinline]] h.record(i);
+    }
+    perf_tests::stop_measuring_time();
+    perf_tests::do_not_optimize(h.seastar_histogram_logform());
+}
+
+namespace {
+struct shard_hists {
+    hdr_hist hdr;
+    mergeable_hist mergeable;
+
+    ss::future<> stop() { return ss::now(); }
+};
+} // namespace
+
+// merging the histograms of all the shards, as done when aggregated
+// percentiles are reported
+PERF_TEST(hdr_hist, merge_shards) {
+    ss::sharded<shard_hists> hists;
+    co_await hists.start();
+    co_await hists.invoke_on_all([](shard_hists& h) {
+        for (int i = 0; i < 100'000; i++) {
+            h.hdr.record(i);
+        }
+    });
+    perf_tests::start_measuring_time();
+    auto merged = co_await hists.map_reduce0(
+      [](shard_hists& h) {
+          hdr_hist copy;
+          copy += h.hdr;
+          return copy;
+      },
+      hdr_hist{},
+      [](hdr_hist acc, const hdr_hist& h) {
+          acc += h;
+          return acc;
+      });
+    perf_tests::stop_measuring_time();
+    perf_tests::do_not_optimize(merged.get_value_at(99.0));
+    co_await hists.stop();
+}
+
+PERF_TEST(mergeable_hist, merge_shards) {
+    ss::sharded<shard_hists> hists;
+    co_await hists.start();
+    co_await hists.invoke_on_all([](shard_hists& h) {
+        for (int i = 0; i < 100'000; i++) {
+            h.mergeable.record(i);
+        }
+    });
+    perf_tests::start_measuring_time();
+    auto merged = co_await merge_shards(hists, &shard_hists::mergeable);
+    perf_tests::stop_measuring_time();
+    perf_tests::do_not_optimize(merged.get_value_at(99.0));
+    co_await hists.stop();
+}
@@ -9,6 +9,7 @@
 
 #include "bytes/bytes.h"
 #include "bytes/iobuf.h"
+#include "bytes/iobuf_parser.h"
 #include "bytes/iostream.h"
 #include "random/generators.h"
 #include "utils/vint.h"
@@ -28,6 +29,8 @@
 #include <iostream>
 #include <optional>
 #include <random>
+#include <span>
+#include <vector>
 
 struct iobuf_reader {
     explicit iobuf_reader(iobuf io)
@@ -414,3 +417,107 @@ PERF_TEST(vint_bench, make_stream) {
     perf_tests::do_not_optimize(b);
     return count;
 }
+
+namespace {
+
+/*
+ * Signed varints the size of those of kafka records: mostly one or two byte
+ * deltas and lengths, with a few larger ones.
+ */
+std::vector<uint8_t> make_record_vints(size_t count) {
+    std::vector<uint8_t> ret;
+    for (size_t c = 0; c < count; c++) {
+        const auto bits = random_generators::get_int<int>(0, 7) == 0 ? 30 : 10;
+        const auto value = random_generators::get_int<int64_t>(
+          -(int64_t{1} << bits), int64_t{1} << bits);
+        const auto b = vint::to_bytes(value);
+        ret.insert(ret.end(), b.begin(), b.end());
+    }
+    return ret;
+}
+
+const std::vector<uint8_t>& record_vints() {
+    static const auto vints = make_record_vints(STREAM_SIZE);
+    return vints;
+}
+
+template<typename F>
+size_t decode_contiguous(F f) {
+    const std::span<const uint8_t> src(record_vints());
+    size_t count = 0;
+    perf_tests::start_measuring_time();
+    for (size_t pos = 0; pos < src.size(); ++count) {
+        auto [value, length] = f(src.subspan(pos));
+        perf_tests::do_not_optimize(value);
+        pos += length;
+    }
+    perf_tests::stop_measuring_time();
+    return count;
+}
+
+iobuf record_vints_iobuf() {
+    iobuf ret;
+    ret.append(record_vints().data(), record_vints().size());
+    return ret;
+}
+
+} // namespace
+
+PERF_TEST(vint_bench, decode_contiguous_byte_at_a_time) {
+    return decode_contiguous([](std::span<const uint8_t> src) {
+        return vint::deserialize<std::span<const uint8_t>>(std::move(src));
+    });
+}
+
+PERF_TEST(vint_bench, decode_contiguous_word_at_a_time) {
+    return decode_contiguous(
+      [](std::span<const uint8_t> src) { return vint::deserialize(src); });
+}
+
+PERF_TEST(vint_bench, decode_contiguous_run) {
+    const std::span<const uint8_t> src(record_vints());
+    std::array<int64_t, 3> values{};
+    size_t count = 0;
+    perf_tests::start_measuring_time();
+    size_t pos = 0;
+    while (pos < src.size()) {
+        auto [decoded, bytes_read] = vint::deserialize_run(
+          src.subspan(pos), values);
+        if (decoded == 0) {
+            auto [value, length] = vint::deserialize(src.subspan(pos));
+            values[0] = value;
+            decoded = 1;
+            bytes_read = length;
+        }
+        perf_tests::do_not_optimize(values);
+        pos += bytes_read;
+        count += decoded;
+    }
+    perf_tests::stop_measuring_time();
+    return count;
+}
+
+PERF_TEST(vint_bench, decode_iobuf_parser_read_varlong) {
+    iobuf_parser parser(record_vints_iobuf());
+    size_t count = 0;
+    perf_tests::start_measuring_time();
+    while (parser.bytes_left() > 0) {
+        perf_tests::do_not_optimize(parser.read_varlong());
+        ++count;
+    }
+    perf_tests::stop_measuring_time();
+    return count;
+}
+
+PERF_TEST(vint_bench, decode_iobuf_parser_read_varlongs) {
+    iobuf_parser parser(record_vints_iobuf());
+    size_t count = 0;
+    perf_tests::start_measuring_time();
+    // the three varints at the start of every record
+    while (count + 3 <= STREAM_SIZE) {
+        perf_tests::do_not_optimize(parser.read_varlongs<3>());
+        count += 3;
+    }
+    perf_tests::stop_measuring_time();
+    return count;
+}
@@ -8,6 +8,7 @@
 // by the Apache License, Version 2.0
 
 #include "bytes/bytes.h"
+#include "bytes/iobuf_parser.h"
 #include "bytes/iostream.h"
 #include "random/generators.h"
 #include "utils/vint.h"
@@ -21,6 +22,8 @@
 #include <cstdint>
 #include <iostream>
 #include <random>
+#include <span>
+#include <vector>
 
 namespace {
 
@@ -43,6 +46,17 @@ void check_roundtrip_sweep_unsigned(const uint64_t count) {
     }
 }
 
+int64_t random_value_of_any_length() {
+    // spread the values over all the encoded lengths, up to 10 bytes
+    const auto bits = random_generators::get_int<int>(0, 62);
+    return random_generators::get_int<int64_t>(
+      -(int64_t{1} << bits), (int64_t{1} << bits) - 1);
+}
+
+std::span<const uint8_t> as_span(const std::vector<uint8_t>& v) {
+    return {v.data(), v.size()};
+}
+
 } // namespace
 
 SEASTAR_THREAD_TEST_CASE(sanity_signed_sweep_64) {
@@ -65,3 +79,81 @@ SEASTAR_THREAD_TEST_CASE(test_unsigned_stream_deserializer) {
       = unsigned_vint::stream_deserialize(istream).get();
     BOOST_CHECK_EQUAL(result, test_number);
 }
+
+SEASTAR_THREAD_TEST_CASE(word_decoder_matches_byte_decoder) {
+    for (int i = 0; i < 100000; ++i) {
+        const auto value = random_value_of_any_length();
+        const auto b = vint::to_bytes(value);
+        // the word at a time decoder with the bytes of a following value
+        std::vector<uint8_t> buf(b.begin(), b.end());
+        buf.resize(b.size() + unsigned_vint::detail::word_size, 0xff);
+        auto [word_value, word_length] = vint::deserialize(as_span(buf));
+        BOOST_REQUIRE_EQUAL(word_value, value);
+        BOOST_REQUIRE_EQUAL(word_length, b.size());
+        // and the byte at a time one, too short for the word
+        buf.resize(b.size());
+        auto [byte_value, byte_length] = vint::deserialize(as_span(buf));
+        BOOST_REQUIRE_EQUAL(byte_value, value);
+        BOOST_REQUIRE_EQUAL(byte_length, b.size());
+
+        const auto unsigned_value = static_cast<uint32_t>(value);
+        const auto ub = unsigned_vint::to_bytes(unsigned_value);
+        std::vector<uint8_t> ubuf(ub.begin(), ub.end());
+        ubuf.resize(ub.size() + unsigned_vint::detail::word_size, 0xff);
+        auto [u_value, u_length] = unsigned_vint::deserialize(as_span(ubuf));
+        BOOST_REQUIRE_EQUAL(u_value, unsigned_value);
+        BOOST_REQUIRE_EQUAL(u_length, ub.size());
+    }
+}
+
+SEASTAR_THREAD_TEST_CASE(deserialize_run_stops_short_of_the_end) {
+    std::vector<int64_t> values;
+    std::vector<uint8_t> buf;
+    for (int i = 0; i < 100; ++i) {
+        values.push_back(random_value_of_any_length());
+        const auto b = vint::to_bytes(values.back());
+        buf.insert(buf.end(), b.begin(), b.end());
+    }
+    std::vector<int64_t> decoded(values.size());
+    auto [count, bytes_read] = vint::deserialize_run(as_span(buf), decoded);
+    BOOST_REQUIRE_LT(count, values.size());
+    BOOST_REQUIRE_LE(bytes_read, buf.size());
+    // the rest one by one
+    while (bytes_read < buf.size()) {
+        auto [value, length] = vint::deserialize(
+          as_span(buf).subspan(bytes_read));
+        decoded[count++] = value;
+        bytes_read += length;
+    }
+    BOOST_REQUIRE_EQUAL(count, values.size());
+    BOOST_REQUIRE(decoded == values);
+}
+
+SEASTAR_THREAD_TEST_CASE(iobuf_parser_varlongs_across_fragments) {
+    std::vector<int64_t> values;
+    iobuf buf;
+    for (int i = 0; i < 1000; ++i) {
+        values.push_back(random_value_of_any_length());
+        const auto b = vint::to_bytes(values.back());
+        // one fragment per varint, some varints split over two of them
+        const auto split = random_generators::get_int<size_t>(0, b.size());
+        iobuf head;
+        head.append(b.data(), split);
+        iobuf tail;
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        tail.append(b.data() + split, b.size() - split);
+        buf.append_fragments(std::move(head));
+        buf.append_fragments(std::move(tail));
+    }
+    iobuf_parser parser(std::move(buf));
+    for (size_t i = 0; i + 3 <= values.size(); i += 4) {
+        auto [a, b, c] = parser.read_varlongs<3>();
+        BOOST_REQUIRE_EQUAL(a, values[i]);
+        BOOST_REQUIRE_EQUAL(b, values[i + 1]);
+        BOOST_REQUIRE_EQUAL(c, values[i + 2]);
+        if (i + 3 < values.size()) {
+            BOOST_REQUIRE_EQUAL(parser.read_varlong().first, values[i + 3]);
+        }
+    }
+    BOOST_REQUIRE_EQUAL(parser.bytes_left(), 0);
+}
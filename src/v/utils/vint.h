@@ -12,7 +12,12 @@
 #pragma once
 #include "bytes/bytes.h"
 
+#include <seastar/core/byteorder.hh>
+
+#include <bit>
 #include <cstdint>
+#include <cstring>
+#include <span>
 
 namespace unsigned_vint {
 /// At most 5 bytes are needed to encode a 32 bit value
@@ -63,6 +68,41 @@ deserialize(Range&& r, uint8_t limit) noexcept {
     return std::make_pair(decoder.result, decoder.bytes_read);
 }
 
+/// Bytes read at once by the word at a time decoder. Only the bytes of the
+/// varint are used, but all of them must be readable.
+inline constexpr size_t word_size = sizeof(uint64_t);
+
+/**
+ * Decodes a varint of at most `max_bytes` bytes (and at most 8) reading a
+ * whole word at once: the terminating byte is the first one without the
+ * continuation bit and the 7 bit groups are compacted with shifts and masks,
+ * without a branch per byte.
+ *
+ * Returns {0, 0} when the varint is longer, so that the caller falls back to
+ * the byte at a time decoder.
+ */
+inline std::pair<uint64_t, size_t>
+deserialize_word(const uint8_t* src, size_t max_bytes) noexcept {
+    uint64_t word = 0;
+    std::memcpy(&word, src, sizeof(word));
+    word = ss::le_to_cpu(word);
+    const uint64_t stops = ~word & 0x8080808080808080ULL;
+    if (unlikely(stops == 0)) {
+        return {0, 0};
+    }
+    const size_t length = (std::countr_zero(stops) / 8) + 1;
+    if (unlikely(length > max_bytes)) {
+        return {0, 0};
+    }
+    uint64_t x = word & (~uint64_t{0} >> (64 - 8 * length))
+                 & 0x7f7f7f7f7f7f7f7fULL;
+    // group k of 7 bits is at bit 8k, move it to bit 7k
+    x = ((x & 0x7f007f007f007f00ULL) >> 1) | (x & 0x007f007f007f007fULL);
+    x = ((x & 0x3fff00003fff0000ULL) >> 2) | (x & 0x00003fff00003fffULL);
+    x = ((x & 0x0fffffff00000000ULL) >> 4) | (x & 0x000000000fffffffULL);
+    return {x, length};
+}
+
 } // namespace detail
 
 inline size_t serialize(uint64_t value, uint8_t* out) noexcept {
@@ -94,6 +134,23 @@ inline std::pair<uint32_t, size_t> deserialize(Range&& r) noexcept {
     return {static_cast<uint32_t>(result), bytes_read};
 }
 
+/**
+ * Decodes a varint from a contiguous buffer, a word at a time when at least
+ * detail::word_size bytes are left and byte at a time otherwise, e.g. at the
+ * end of an iobuf fragment.
+ */
+inline std::pair<uint32_t, size_t>
+deserialize(std::span<const uint8_t> src) noexcept {
+    if (likely(src.size() >= detail::word_size)) {
+        auto [result, bytes_read] = detail::deserialize_word(
+          src.data(), max_length);
+        if (likely(bytes_read != 0)) {
+            return {static_cast<uint32_t>(result), bytes_read};
+        }
+    }
+    return deserialize<std::span<const uint8_t>>(std::move(src));
+}
+
 inline constexpr size_t size(uint64_t v) noexcept {
     size_t len = 1;
     while (v >= 128) {
@@ -160,6 +217,46 @@ inline std::pair<int64_t, size_t> deserialize(Range&& r) noexcept {
     return {decode_zigzag(result), bytes_read};
 }
 
+/**
+ * Decodes a varint from a contiguous buffer, a word at a time when at least
+ * unsigned_vint::detail::word_size bytes are left and byte at a time
+ * otherwise, e.g. at the end of an iobuf fragment.
+ */
+inline std::pair<int64_t, size_t>
+deserialize(std::span<const uint8_t> src) noexcept {
+    if (likely(src.size() >= unsigned_vint::detail::word_size)) {
+        auto [result, bytes_read] = unsigned_vint::detail::deserialize_word(
+          src.data(), unsigned_vint::detail::word_size);
+        if (likely(bytes_read != 0)) {
+            return {decode_zigzag(result), bytes_read};
+        }
+    }
+    return deserialize<std::span<const uint8_t>>(std::move(src));
+}
+
+/**
+ * Decodes up to out.size() consecutive varints from a contiguous buffer, a
+ * word at a time, as long as at least unsigned_vint::detail::word_size bytes
+ * are left. Returns the number of varints decoded and the bytes they took,
+ * the caller decodes the rest, if any, some other way.
+ */
+inline std::pair<size_t, size_t>
+deserialize_run(std::span<const uint8_t> src, std::span<int64_t> out) noexcept {
+    size_t decoded = 0;
+    size_t bytes_read = 0;
+    while (decoded < out.size()
+           && src.size() - bytes_read >= unsigned_vint::detail::word_size) {
+        auto [result, length] = unsigned_vint::detail::deserialize_word(
+          src.data() + bytes_read, unsigned_vint::detail::word_size);
+        if (unlikely(length == 0)) {
+            break;
+        }
+        out[decoded++] = decode_zigzag(result);
+        bytes_read += length;
+    }
+    return {decoded, bytes_read};
+}
+
 inline bytes to_bytes(int64_t value) noexcept {
     // our bytes uses a short-string optimization of 31 bytes, at most
     // vint::max_length bytes will be used to allocate the encoded size at the
@@ -12,6 +12,8 @@
 
 #include "base/vassert.h"
 #include "base/vlog.h"
+#include "config/configuration.h"
+#include "prometheus/prometheus_sanitize.h"
 #include "ssx/future-util.h"
 #include "wasm/logger.h"
 
@@ -27,6 +29,8 @@
 
 #include <sys/mman.h>
 
+#include <cerrno>
+#include <cstring>
 #include <span>
 #include <stdexcept>
 #include <unistd.h>
@@ -34,11 +38,19 @@
 namespace wasm {
 
 heap_allocator::heap_allocator(config c)
-  : _memset_chunk_size(c.memset_chunk_size) {
-    size_t page_size = ::getpagesize();
+  : _memset_chunk_size(c.memset_chunk_size)
+  , _huge_pages(c.huge_pages) {
+    size_t page_size = _huge_pages ? huge_page_size : ::getpagesize();
     _size = ss::align_up(c.heap_memory_size, page_size);
     for (size_t i = 0; i < c.num_heaps; ++i) {
         auto buffer = ss::allocate_aligned_buffer<uint8_t>(_size, page_size);
+        if (
+          _huge_pages && ::madvise(buffer.get(), _size, MADV_HUGEPAGE) != 0) {
+            vlog(
+              wasm_log.warn,
+              "unable to back wasm heap memory with huge pages: {}",
+              std::strerror(errno));
+        }
         _memory_pool.push_back(
           async_zero_memory({std::move(buffer), _size}, _size));
     }
@@ -84,6 +96,42 @@ heap_allocator::async_zero_memory(heap_memory m, size_t used_amount) {
 
 size_t heap_allocator::max_size() const { return _size; }
 
+void heap_allocator::record_growth(size_t from, size_t to) {
+    ++_stats.grow_count;
+    _stats.grown_bytes += to - from;
+}
+
+void heap_allocator::record_failed_growth() { ++_stats.failed_grow_count; }
+
+void heap_allocator::setup_metrics() {
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+    namespace sm = ss::metrics;
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("wasm_heap"),
+      {
+        sm::make_counter(
+          "grows",
+          [this] { return _stats.grow_count; },
+          sm::description("Number of times a WebAssembly heap grew")),
+        sm::make_counter(
+          "grown_bytes",
+          [this] { return _stats.grown_bytes; },
+          sm::description("Total bytes WebAssembly heaps grew by")),
+        sm::make_counter(
+          "failed_grows",
+          [this] { return _stats.failed_grow_count; },
+          sm::description(
+            "Number of times a WebAssembly heap could not grow as large as "
+            "asked")),
+        sm::make_gauge(
+          "free_heaps",
+          [this] { return _memory_pool.size(); },
+          sm::description("Number of WebAssembly heaps that are not in use")),
+      });
+}
+
 stack_memory::stack_memory(stack_bounds bounds, allocated_memory data)
   : _bounds(bounds)
   , _data(std::move(data)) {}
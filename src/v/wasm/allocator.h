@@ -11,6 +11,8 @@
 #pragma once
 
 #include "base/seastarx.h"
+#include "base/units.h"
+#include "metrics/metrics.h"
 
 #include <seastar/core/aligned_buffer.hh>
 #include <seastar/core/chunked_fifo.hh>
@@ -52,9 +54,17 @@ struct heap_memory {
 // with memory fragmentation and support spinning down VMs to defragment our
 // pool of memory.
 //
+// Optionally heaps are aligned to and sized in multiples of huge pages, and
+// advised to be backed by transparent huge pages. A huge page is then never
+// shared with other allocations, such as the guard pages of stacks that
+// break them up. The heaps are zero-filled when the pool is created, which
+// faults in the (huge) pages before the VMs use them.
+//
 // Instance on every core.
 class heap_allocator {
 public:
+    static constexpr size_t huge_page_size = 2_MiB;
+
     struct config {
         // The size of a single allocated heap memory.
         size_t heap_memory_size;
@@ -62,6 +72,20 @@ public:
         size_t num_heaps;
         // The amount of memory we zero out at once.
         size_t memset_chunk_size;
+        // Back the heaps with huge pages.
+        bool huge_pages = false;
+    };
+
+    /**
+     * How the heaps grew as the VMs using them asked for more memory.
+     */
+    struct growth_stats {
+        // The number of times a VM grew its heap.
+        uint64_t grow_count = 0;
+        // The total bytes heaps grew by.
+        uint64_t grown_bytes = 0;
+        // The number of times a heap could not grow as large as asked.
+        uint64_t failed_grow_count = 0;
     };
 
     explicit heap_allocator(config);
@@ -105,11 +129,29 @@ public:
      */
     size_t max_size() const;
 
+    /**
+     * Record that a VM grew the heap it was given from `from` bytes to `to`
+     * bytes.
+     */
+    void record_growth(size_t from, size_t to);
+    /**
+     * Record that a VM asked to grow a heap past its size.
+     */
+    void record_failed_growth();
+
+    bool huge_pages() const { return _huge_pages; }
+    const growth_stats& stats() const { return _stats; }
+
+    void setup_metrics();
+
 private:
     ss::future<heap_memory> async_zero_memory(heap_memory, size_t used_amount);
 
     size_t _memset_chunk_size;
     size_t _size;
+    bool _huge_pages;
+    growth_stats _stats;
+    metrics::internal_metric_groups _metrics;
     // We expect this list to be small, so override the chunk to be smaller too.
     static constexpr size_t items_per_chunk = 16;
     ss::chunked_fifo<ss::future<heap_memory>, items_per_chunk> _memory_pool;
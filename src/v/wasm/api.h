@@ -22,7 +22,9 @@
 #include <seastar/util/noncopyable_function.hh>
 
 #include <chrono>
+#include <filesystem>
 #include <memory>
+#include <optional>
 
 namespace wasm {
 
@@ -107,6 +109,8 @@ public:
             size_t per_core_pool_size_bytes;
             // per engine the max amount of memory
             size_t per_engine_memory_limit;
+            // back the engine's memory with huge pages
+            bool huge_pages = false;
         };
         heap_memory heap_memory;
         struct stack_memory {
@@ -128,6 +132,14 @@ public:
             std::chrono::milliseconds per_invocation_timeout;
         };
         cpu cpu;
+        // Keep a started spare of each engine on each core, that takes over
+        // when the engine fails so that the transform doesn't wait for a
+        // new instance to be created and initialized. A spare uses as much
+        // memory as the engine.
+        bool standby_engines = false;
+        // Where to cache the native code compiled from modules on local
+        // disk, if anywhere.
+        std::optional<std::filesystem::path> compilation_cache_directory;
     };
 
     virtual ss::future<> start(config) = 0;
@@ -58,21 +58,46 @@ gc_btree_map(absl::btree_map<Key, ss::weak_ptr<Value>>* cache) {
     co_return cleanup_count;
 }
 
+/**
+ * A logger shared by an engine and its standby.
+ */
+class forwarding_logger final : public logger {
+public:
+    explicit forwarding_logger(ss::lw_shared_ptr<std::unique_ptr<logger>> l)
+      : _underlying(std::move(l)) {}
+
+    void log(ss::log_level lvl, std::string_view message) noexcept final {
+        (*_underlying)->log(lvl, message);
+    }
+
+private:
+    ss::lw_shared_ptr<std::unique_ptr<logger>> _underlying;
+};
+
 /**
  * Allows sharing an engine between multiple uses.
  *
  * Must live on a single core.
+ *
+ * If it's given a way to make them, a started standby engine is kept while the
+ * engine is running. When the engine fails the standby takes over, and a new
+ * standby is started in the background.
  */
 class shared_engine
   : public engine
   , public ss::enable_shared_from_this<shared_engine>
   , public ss::weakly_referencable<shared_engine> {
 public:
-    explicit shared_engine(
+    using engine_maker
+      = ss::noncopyable_function<ss::future<ss::shared_ptr<engine>>()>;
+
+    shared_engine(
       ss::shared_ptr<engine> underlying,
-      ss::foreign_ptr<ss::shared_ptr<factory>> f)
+      ss::foreign_ptr<ss::shared_ptr<factory>> f,
+      engine_maker make_standby)
       : _underlying(std::move(underlying))
-      , _factory(std::move(f)) {}
+      , _factory(std::move(f))
+      , _make_standby(std::move(make_standby)) {}
 
     ss::future<> transform(
       model::record_batch batch,
@@ -87,7 +112,12 @@ public:
         // Restart the engine
         try {
             co_await _underlying->stop();
-            co_await _underlying->start();
+            if (_standby) {
+                _underlying = std::exchange(_standby, nullptr);
+                prepare_standby();
+            } else {
+                co_await _underlying->start();
+            }
         } catch (...) {
             vlog(
               wasm_log.warn,
@@ -101,6 +131,7 @@ public:
         auto u = co_await _mu.get_units();
         if (_ref_count++ == 0) {
             co_await _underlying->start();
+            prepare_standby();
         }
     }
     ss::future<> stop() override {
@@ -109,6 +140,10 @@ public:
         auto u = co_await _mu.get_units();
         if (--_ref_count == 0) {
             co_await _underlying->stop();
+            co_await std::exchange(_standby_ready, ss::now());
+            if (_standby) {
+                co_await std::exchange(_standby, nullptr)->stop();
+            }
         }
     }
 
@@ -118,11 +153,46 @@ public:
     }
 
 private:
+    void prepare_standby() {
+        if (!_make_standby || _standby || !_standby_ready.available()) {
+            return;
+        }
+        _standby_ready = start_standby();
+    }
+
+    ss::future<> start_standby() {
+        ss::shared_ptr<engine> standby;
+        auto fut = co_await ss::coroutine::as_future(
+          ss::futurize_invoke(_make_standby)
+            .then([&standby](ss::shared_ptr<engine> e) {
+                standby = std::move(e);
+                return standby->start();
+            }));
+        if (fut.failed()) {
+            vlog(
+              wasm_log.warn,
+              "failed to start standby wasm engine: {}",
+              fut.get_exception());
+        } else if (_ref_count > 0) {
+            _standby = std::move(standby);
+            co_return;
+        }
+        if (standby) {
+            // Stopped before the standby was ready, or failed to start
+            co_await standby->stop().handle_exception(
+              [](const std::exception_ptr&) {});
+        }
+    }
+
     mutex _mu{"wasm_shared_engine"};
     size_t _ref_count = 0;
     ss::shared_ptr<engine> _underlying;
     // This factory reference is here to keep the cache entry alive.
     ss::foreign_ptr<ss::shared_ptr<factory>> _factory;
+    engine_maker _make_standby;
+    ss::shared_ptr<engine> _standby;
+    // Resolves once the standby being started, if any, is ready
+    ss::future<> _standby_ready = ss::now();
 };
 
 /**
@@ -188,6 +258,11 @@ private:
 /** A cache for engines on a particular core. */
 class engine_cache {
 public:
+    explicit engine_cache(bool standby_engines)
+      : _standby_engines(standby_engines) {}
+
+    bool standby_engines() const { return _standby_engines; }
+
     void
     put(model::offset offset, const ss::shared_ptr<shared_engine>& engine) {
         _cache.insert_or_assign(offset, engine->weak_from_this());
@@ -208,6 +283,7 @@ public:
 private:
     mutex _mu{"wasm_engine_cache"};
     absl::btree_map<model::offset, ss::weak_ptr<shared_engine>> _cache;
+    bool _standby_engines;
 };
 
 /**
@@ -250,9 +326,21 @@ public:
         // expected to keep a reference to a factory after the engine is
         // created.
         auto foreign_this = co_await foreign_from_this();
+        shared_engine::engine_maker make_standby;
+        if (_engine_cache->local().standby_engines()) {
+            auto shared_logger
+              = ss::make_lw_shared<std::unique_ptr<wasm::logger>>(
+                std::move(logger));
+            logger = std::make_unique<forwarding_logger>(shared_logger);
+            make_standby = [this, shared_logger] {
+                return _underlying->make_engine(
+                  std::make_unique<forwarding_logger>(shared_logger));
+            };
+        }
         auto created = ss::make_shared<shared_engine>(
           co_await _underlying->make_engine(std::move(logger)),
-          std::move(foreign_this));
+          std::move(foreign_this),
+          std::move(make_standby));
         _engine_cache->local().put(_offset, created);
         co_return created;
     }
@@ -285,7 +373,7 @@ caching_runtime::~caching_runtime() = default;
 
 ss::future<> caching_runtime::start(runtime::config c) {
     co_await _underlying->start(c);
-    co_await _engine_caches.start();
+    co_await _engine_caches.start(c.standby_engines);
     _gc_timer.arm(_gc_interval);
 }
 
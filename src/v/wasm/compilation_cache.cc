@@ -0,0 +1,115 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "wasm/compilation_cache.h"
+
+#include "hashing/secure.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/print.hh>
+#include <seastar/coroutine/maybe_yield.hh>
+
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+namespace wasm {
+
+namespace {
+// Bump if the layout of the cache changes.
+constexpr std::string_view cache_format_version = "v1";
+constexpr std::string_view artifact_suffix = ".cwasm";
+constexpr std::string_view tmp_suffix = ".tmp";
+} // namespace
+
+compilation_cache::compilation_cache(std::filesystem::path directory)
+  : _directory(std::move(directory)) {}
+
+ss::future<ss::sstring> compilation_cache::make_key(
+  const iobuf& module, std::string_view engine_version) {
+    hash_sha256 h;
+    // Modules can be large, don't stall the reactor hashing them.
+    for (const auto& frag : module) {
+        h.update(std::string_view(frag.get(), frag.size()));
+        co_await ss::coroutine::maybe_yield();
+    }
+    co_return ss::format(
+      "{}-{}-{}", to_hex(h.reset()), engine_version, cache_format_version);
+}
+
+std::filesystem::path compilation_cache::path_for(std::string_view key) const {
+    return _directory / ss::format("{}{}", key, artifact_suffix);
+}
+
+std::optional<bytes> compilation_cache::load(std::string_view key) {
+    auto path = path_for(key);
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        return std::nullopt;
+    }
+    std::streamsize size = file.tellg();
+    auto artifact = ss::uninitialized_string<bytes>(size);
+    file.seekg(0);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    if (!file.read(reinterpret_cast<char*>(artifact.data()), size)) {
+        throw std::runtime_error(
+          ss::format("unable to read compiled wasm module from {}", path));
+    }
+    // Mark the artifact as recently used for eviction.
+    std::filesystem::last_write_time(
+      path, std::filesystem::file_time_type::clock::now());
+    return artifact;
+}
+
+void compilation_cache::store(std::string_view key, bytes_view artifact) {
+    std::filesystem::create_directories(_directory);
+    auto path = path_for(key);
+    auto tmp = path;
+    tmp += tmp_suffix;
+    {
+        std::ofstream file(tmp, std::ios::binary | std::ios::trunc);
+        file.write(
+          // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+          reinterpret_cast<const char*>(artifact.data()),
+          static_cast<std::streamsize>(artifact.size()));
+        file.flush();
+        if (!file) {
+            throw std::runtime_error(
+              ss::format("unable to write compiled wasm module to {}", tmp));
+        }
+    }
+    // Readers never see a partially written artifact.
+    std::filesystem::rename(tmp, path);
+    evict();
+}
+
+void compilation_cache::evict() {
+    std::vector<std::filesystem::directory_entry> artifacts;
+    for (const auto& entry : std::filesystem::directory_iterator(_directory)) {
+        if (
+          entry.is_regular_file()
+          && entry.path().extension() == artifact_suffix) {
+            artifacts.push_back(entry);
+        }
+    }
+    if (artifacts.size() <= max_entries) {
+        return;
+    }
+    std::ranges::sort(artifacts, std::less<>(), [](const auto& entry) {
+        return entry.last_write_time();
+    });
+    for (size_t i = 0; i < artifacts.size() - max_entries; ++i) {
+        std::filesystem::remove(artifacts[i].path());
+    }
+}
+
+} // namespace wasm
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "base/seastarx.h"
+#include "bytes/bytes.h"
+#include "bytes/iobuf.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/sstring.hh>
+
+#include <filesystem>
+#include <optional>
+#include <string_view>
+
+namespace wasm {
+
+/**
+ * A cache on local disk of the native code compiled from WebAssembly
+ * modules, so that deploying a transform again or moving it to this node
+ * doesn't compile the module again.
+ *
+ * Artifacts are keyed by the hash of the module and the engine that
+ * compiled it. The engine checks that an artifact was compiled for the
+ * same configuration and CPU features when it loads it, an artifact that
+ * fails to load is compiled again and replaced.
+ *
+ * The cache keeps at most `max_entries` artifacts, dropping the ones that
+ * were used the least recently.
+ *
+ * NOTE: Loading and storing artifacts does blocking file IO, so must only be
+ * done on an alien thread.
+ */
+class compilation_cache {
+public:
+    static constexpr size_t max_entries = 128;
+
+    explicit compilation_cache(std::filesystem::path directory);
+
+    /**
+     * The key of a module compiled by the engine with the given version.
+     */
+    static ss::future<ss::sstring>
+    make_key(const iobuf& module, std::string_view engine_version);
+
+    /**
+     * Load the artifact stored for a key, if any.
+     */
+    std::optional<bytes> load(std::string_view key);
+
+    /**
+     * Store the artifact for a key, replacing any that is stored already.
+     */
+    void store(std::string_view key, bytes_view artifact);
+
+private:
+    std::filesystem::path path_for(std::string_view key) const;
+    void evict();
+
+    std::filesystem::path _directory;
+};
+
+} // namespace wasm
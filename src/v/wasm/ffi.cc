@@ -161,6 +161,19 @@ std::string_view reader::read_sized_string_view() {
     int64_t size = read_varint();
     return read_string_view(size);
 }
+array<uint8_t> reader::read_sized_array() {
+    int64_t size = read_varint();
+    auto r = slice_remainder();
+    if (size < 0 || r.size() < size_t(size)) {
+        throw std::out_of_range(ss::format(
+          "ffi::array buffer too small {} > {}, total: {}",
+          size,
+          r.size(),
+          _input.size()));
+    }
+    _offset += size;
+    return r.subspan(0, size);
+}
 int64_t reader::read_varint() {
     auto r = slice_remainder();
     auto [v, sz] = vint::deserialize(std::span<uint8_t>{r.data(), r.size()});
@@ -159,6 +159,7 @@ public:
     iobuf read_sized_iobuf();
     ss::sstring read_sized_string();
     std::string_view read_sized_string_view();
+    array<uint8_t> read_sized_array();
     int64_t read_varint();
     uint8_t read_byte();
 
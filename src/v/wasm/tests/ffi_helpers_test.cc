@@ -78,6 +78,19 @@ TEST(FFIHelpers, ReaderOverflow) {
     ASSERT_THROW(r.read_string(data.size() + 1), std::out_of_range);
 }
 
+TEST(FFIHelpers, ReadSizedArray) {
+    std::vector<uint8_t> data(8, 0);
+    array<uint8_t> ffi_array(data);
+    writer w(ffi_array);
+    w.append_with_length("abc");
+    w.append(int64_t(5));
+    reader r(ffi_array);
+    auto arr = r.read_sized_array();
+    ASSERT_EQ(array_as_string_view(arr), "abc");
+    // The buffer is shorter than the size prefix
+    ASSERT_THROW(r.read_sized_array(), std::out_of_range);
+}
+
 TEST(FFIHelpers, WriterOverflow) {
     std::vector<uint8_t> data(2, 0);
     array<uint8_t> ffi_array(data);
@@ -211,6 +211,44 @@ TEST(HeapAllocatorTest, MemoryIsZeroFilled) {
     EXPECT_THAT(allocated, Optional(HeapIsZeroed()));
 }
 
+TEST(HeapAllocatorTest, HugePagesAreAligned) {
+    size_t page_size = ::getpagesize();
+    heap_allocator allocator(heap_allocator::config{
+      .heap_memory_size = page_size,
+      .num_heaps = 2,
+      .memset_chunk_size = default_memset_chunk_size,
+      .huge_pages = true,
+    });
+    EXPECT_EQ(allocator.max_size(), heap_allocator::huge_page_size);
+    heap_allocator::request req{
+      .minimum = 0, .maximum = std::numeric_limits<size_t>::max()};
+    for (int i = 0; i < 2; ++i) {
+        auto mem = allocator.allocate(req).get();
+        ASSERT_TRUE(mem.has_value());
+        EXPECT_EQ(mem->size, heap_allocator::huge_page_size);
+        EXPECT_EQ(
+          reinterpret_cast<uintptr_t>(mem->data.get())
+            % heap_allocator::huge_page_size,
+          0);
+        EXPECT_THAT(mem, Optional(HeapIsZeroed()));
+    }
+}
+
+TEST(HeapAllocatorTest, TracksGrowth) {
+    size_t page_size = ::getpagesize();
+    heap_allocator allocator(heap_allocator::config{
+      .heap_memory_size = page_size * 4,
+      .num_heaps = 1,
+      .memset_chunk_size = default_memset_chunk_size,
+    });
+    allocator.record_growth(0, page_size);
+    allocator.record_growth(page_size, page_size * 3);
+    allocator.record_failed_growth();
+    EXPECT_EQ(allocator.stats().grow_count, 2);
+    EXPECT_EQ(allocator.stats().grown_bytes, page_size * 3);
+    EXPECT_EQ(allocator.stats().failed_grow_count, 1);
+}
+
 TEST(StackAllocatorParamsTest, TrackingCanBeEnabled) {
     stack_allocator allocator(stack_allocator::config{
       .tracking_enabled = true,
@@ -15,6 +15,7 @@
 #include "model/tests/randoms.h"
 #include "model/transform.h"
 #include "random/generators.h"
+#include "test_utils/async.h"
 #include "wasm/api.h"
 #include "wasm/cache.h"
 
@@ -147,9 +148,11 @@ public:
         // Effectively disable the gc interval
         _caching_runtime = std::make_unique<caching_runtime>(
           std::move(fr), /*gc_interval=*/std::chrono::hours(1));
-        _caching_runtime->start({}).get();
+        _caching_runtime->start(runtime_config()).get();
     }
 
+    virtual runtime::config runtime_config() const { return {}; }
+
     void TearDown() override {
         _caching_runtime->stop().get();
         _fake_runtime = nullptr;
@@ -197,6 +200,21 @@ private:
     std::unique_ptr<caching_runtime> _caching_runtime;
 };
 
+class WasmStandbyCacheTest : public WasmCacheTest {
+public:
+    runtime::config runtime_config() const override {
+        runtime::config c{};
+        c.standby_engines = true;
+        return c;
+    }
+
+    void wait_for_running_engines(int n) {
+        tests::cooperative_spin_wait_with_timeout(
+          5s, [this, n] { return state()->running_engines == n; })
+          .get();
+    }
+};
+
 void PrintTo(const ss::shared_ptr<factory>& f, std::ostream* os) {
     *os << "factory{" << f.get() << "}";
 }
@@ -334,4 +352,41 @@ TEST_F(WasmCacheTest, EngineReplacementBeforeGC) {
     EXPECT_EQ(state()->engines, 1);
 }
 
+TEST_F(WasmStandbyCacheTest, StandbyTakesOverFailedEngine) {
+    auto meta = random_metadata();
+    auto factory = ss::make_foreign(make_factory(meta));
+    auto engine = factory->make_engine(std::make_unique<fake_logger>()).get();
+    engine->start().get();
+    // The engine and its standby
+    wait_for_running_engines(2);
+    EXPECT_EQ(state()->engines, 2);
+
+    state()->engine_transform_should_throw = true;
+    EXPECT_THROW(
+      engine
+        ->transform(
+          random_batch(),
+          nullptr,
+          [](auto, auto) { return ssx::now(write_success::yes); })
+        .get(),
+      std::runtime_error);
+    state()->engine_transform_should_throw = false;
+    // The failed engine is replaced instead of restarted, and a new standby
+    // is started.
+    EXPECT_EQ(state()->engine_restarts, 0);
+    wait_for_running_engines(2);
+    EXPECT_EQ(state()->engines, 2);
+    EXPECT_NO_THROW(engine
+                      ->transform(
+                        random_batch(),
+                        nullptr,
+                        [](auto, auto) { return ssx::now(write_success::yes); })
+                      .get());
+
+    engine->stop().get();
+    EXPECT_EQ(state()->running_engines, 0);
+    engine = nullptr;
+    EXPECT_EQ(state()->engines, 0);
+}
+
 } // namespace wasm
@@ -0,0 +1,91 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "bytes/bytes.h"
+#include "bytes/iobuf.h"
+#include "test_utils/tmp_dir.h"
+#include "wasm/compilation_cache.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+
+namespace wasm {
+
+namespace {
+iobuf make_module(std::string_view contents) {
+    iobuf buf;
+    buf.append(contents.data(), contents.size());
+    return buf;
+}
+bytes make_artifact(std::string_view contents) {
+    return iobuf_to_bytes(make_module(contents));
+}
+} // namespace
+
+using ::testing::Optional;
+
+class CompilationCacheTest : public ::testing::Test {
+public:
+    compilation_cache& cache() { return _cache; }
+    std::filesystem::path directory() const { return _dir.get_path(); }
+
+private:
+    temporary_dir _dir{"wasm_compilation_cache"};
+    compilation_cache _cache{_dir.get_path()};
+};
+
+TEST_F(CompilationCacheTest, KeysDependOnModuleAndEngine) {
+    auto a = compilation_cache::make_key(make_module("a"), "v1").get();
+    auto b = compilation_cache::make_key(make_module("b"), "v1").get();
+    auto a2 = compilation_cache::make_key(make_module("a"), "v2").get();
+    EXPECT_EQ(a, compilation_cache::make_key(make_module("a"), "v1").get());
+    EXPECT_NE(a, b);
+    EXPECT_NE(a, a2);
+}
+
+TEST_F(CompilationCacheTest, MissingArtifact) {
+    EXPECT_EQ(cache().load("missing"), std::nullopt);
+}
+
+TEST_F(CompilationCacheTest, RoundTrip) {
+    auto artifact = make_artifact("compiled");
+    cache().store("key", artifact);
+    EXPECT_THAT(cache().load("key"), Optional(artifact));
+
+    auto replaced = make_artifact("recompiled");
+    cache().store("key", replaced);
+    EXPECT_THAT(cache().load("key"), Optional(replaced));
+}
+
+TEST_F(CompilationCacheTest, EvictsLeastRecentlyUsed) {
+    auto artifact = make_artifact("compiled");
+    for (size_t i = 0; i < compilation_cache::max_entries; ++i) {
+        cache().store(ss::format("key-{}", i), artifact);
+    }
+    // Make the first artifacts the oldest ones, then use the very first one.
+    auto old = std::filesystem::file_time_type::clock::now()
+               - std::chrono::hours(1);
+    for (int i = 0; i < 2; ++i) {
+        std::filesystem::last_write_time(
+          directory() / ss::format("key-{}.cwasm", i), old);
+    }
+    EXPECT_TRUE(cache().load("key-0").has_value());
+
+    cache().store("new", artifact);
+    EXPECT_TRUE(cache().load("new").has_value());
+    EXPECT_TRUE(cache().load("key-0").has_value());
+    EXPECT_EQ(cache().load("key-1"), std::nullopt);
+}
+
+} // namespace wasm
@@ -91,7 +91,9 @@ public:
         _runtime = nullptr;
     }
 
-    ss::future<> run_test() {
+    // Returns the records transformed, so that the time is reported per
+    // record, where the per call overhead of the ABI shows.
+    ss::future<size_t> run_test() {
         model::record_batch batch = model::test::make_random_batch(
           model::test::record_batch_spec{
             .allow_compression = false,
@@ -113,6 +115,7 @@ public:
               perf_tests::do_not_optimize(model::transformed_data::make_batch(
                 model::timestamp::now(), std::move(*output)));
               perf_tests::stop_measuring_time();
+              return BatchSize;
           });
     }
 
@@ -135,6 +138,8 @@ private:
 WASM_IDENTITY_PERF_TEST(1, 1_KiB);
 WASM_IDENTITY_PERF_TEST(10, 1_KiB);
 WASM_IDENTITY_PERF_TEST(10, 512);
+WASM_IDENTITY_PERF_TEST(1000, 16);
+WASM_IDENTITY_PERF_TEST(1000, 64);
 
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #define MEMSET_PERF_TEST(buf_size)                                             \
@@ -30,6 +30,7 @@
 #include <seastar/coroutine/maybe_yield.hh>
 
 #include <exception>
+#include <iterator>
 #include <optional>
 
 namespace wasm {
@@ -125,6 +126,11 @@ void transform_module::check_abi_version_2() {
     // static analysis of the module to determine which ABI version to use.
 }
 
+void transform_module::check_abi_version_3() {
+    // This function does nothing at runtime, it's only an opportunity for
+    // static analysis of the module to determine which ABI version to use.
+}
+
 // NOLINTBEGIN(bugprone-easily-swappable-parameters)
 ss::future<int32_t> transform_module::read_batch_header(
   int64_t* base_offset,
@@ -263,6 +269,104 @@ ss::future<int32_t> transform_module::write_record_with_options(
                                            : INVALID_WRITE;
 }
 
+ss::future<int32_t>
+transform_module::read_records(ffi::array<uint8_t> buf) {
+    if (!_call_ctx || _call_ctx->records.empty()) {
+        co_return NO_ACTIVE_TRANSFORM;
+    }
+
+    // Callback that we finished processing the previous records, but not
+    // before the first read of the batch.
+    if (
+      _call_ctx->records.size()
+      != size_t(_call_ctx->batch_header.record_count)) {
+        _call_ctx->callback->post_record();
+    }
+
+    co_await ss::coroutine::maybe_yield();
+
+    auto& records = _call_ctx->records;
+    iobuf_const_parser parser(_call_ctx->batch_data);
+    size_t written = 0;
+    size_t count = 0;
+    model::timestamp last_timestamp;
+    while (!records.empty()) {
+        const auto& record = records.front();
+        const size_t size = 1 + vint::vint_size(record.timestamp())
+                            + vint::vint_size(record.offset())
+                            + vint::vint_size(int64_t(record.payload_size))
+                            + record.payload_size;
+        if (size > buf.size() - written) {
+            break;
+        }
+        uint8_t* out = buf.data() + written;
+        *out++ = record.attributes.value();
+        out += vint::serialize(record.timestamp(), out);
+        out += vint::serialize(record.offset(), out);
+        out += vint::serialize(int64_t(record.payload_size), out);
+        // Skip over the metadata we already parsed and copy out the payload
+        parser.skip(record.metadata_size);
+        parser.consume_to(record.payload_size, out);
+        written += size;
+        last_timestamp = record.timestamp;
+        records.pop_front();
+        ++count;
+    }
+    if (count == 0) {
+        vlog(
+          wasm_log.debug,
+          "read_records invalid buffer size: {} < {}",
+          buf.size(),
+          records.front().payload_size + max_record_overhead);
+        co_return INVALID_BUFFER;
+    }
+    _call_ctx->batch_data.trim_front(parser.bytes_consumed());
+
+    // The guest sees the time of the latest record it was given
+    _wasi_module->set_walltime(last_timestamp);
+
+    // Call back so we can refuel, for all the records at once.
+    _call_ctx->callback->pre_records(count);
+
+    co_return int32_t(written);
+}
+
+ss::future<int32_t>
+transform_module::write_records(ffi::array<uint8_t> buf) {
+    if (!_call_ctx) {
+        co_return NO_ACTIVE_TRANSFORM;
+    }
+    // Copy the records out of guest memory at once, the payload of each record
+    // shares its part of the copy instead of being allocated on its own.
+    iobuf copy;
+    copy.append(buf.data(), buf.size());
+    ffi::reader r(buf);
+    int32_t count = 0;
+    while (r.remaining_bytes() > 0) {
+        std::optional<write_options> options;
+        std::optional<model::transformed_data> d;
+        try {
+            options = write_options::parse(r.read_sized_array());
+            auto payload = r.read_sized_array();
+            d = model::transformed_data::create_validated(copy.share(
+              std::distance(buf.data(), payload.data()), payload.size()));
+        } catch (const std::out_of_range& ex) {
+            vlog(wasm_log.debug, "write_records invalid buffer: {}", ex.what());
+            co_return INVALID_BUFFER;
+        }
+        if (!options || !d) {
+            co_return INVALID_BUFFER;
+        }
+        auto result = co_await _call_ctx->callback->emit(
+          options->topic, *std::move(d));
+        if (result != write_success::yes) {
+            co_return INVALID_WRITE;
+        }
+        ++count;
+    }
+    co_return count;
+}
+
 void transform_module::start() {
     _guest_cond_var.emplace();
     _host_cond_var.emplace();
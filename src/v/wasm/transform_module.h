@@ -16,6 +16,7 @@
 #include "model/record.h"
 #include "model/transform.h"
 #include "utils/named_type.h"
+#include "utils/vint.h"
 #include "wasm/api.h"
 #include "wasm/ffi.h"
 #include "wasm/wasi.h"
@@ -57,6 +58,8 @@ struct record_metadata {
  * emit({...});
  * post_record();
  *
+ * Guests using the batch ABI are surfaced many records at once, with a single
+ * pre_records(n) for them and a single post_record() when they are done.
  */
 class record_callback {
 public:
@@ -69,6 +72,8 @@ public:
 
     // Called before surfacing a record to the VM.
     virtual void pre_record() = 0;
+    // Called before surfacing `count` records to the VM at once.
+    virtual void pre_records(size_t count) = 0;
     // Called for each record output from the VM.
     virtual ss::future<write_success>
       emit(std::optional<model::topic_view>, model::transformed_data) = 0;
@@ -134,6 +139,7 @@ public:
 
     void check_abi_version_1();
     void check_abi_version_2();
+    void check_abi_version_3();
 
     ss::future<int32_t> read_batch_header(
       int64_t* base_offset,
@@ -158,6 +164,39 @@ public:
     ss::future<int32_t>
       write_record_with_options(ffi::array<uint8_t>, ffi::array<uint8_t>);
 
+    // The batch ABI (version 3), which trades a host call per record for one
+    // per batch, or per buffer full of records.
+
+    /**
+     * Copies as many of the remaining records of the batch as fit in the
+     * buffer, each as:
+     *
+     * attributes: int8
+     * timestamp: varint
+     * offset: varint
+     * payload_length: varint
+     * payload: byte[]
+     *
+     * A buffer of the size returned by read_batch_header, plus
+     * max_record_overhead, holds any record of the batch.
+     *
+     * Returns the amount of bytes written.
+     */
+    ss::future<int32_t> read_records(ffi::array<uint8_t>);
+    static constexpr size_t max_record_overhead = 1 + 3 * vint::max_length;
+
+    /**
+     * Writes a sequence of records, each as:
+     *
+     * options_length: varint
+     * options: byte[] (as in write_record_with_options)
+     * payload_length: varint
+     * payload: byte[]
+     *
+     * Returns the amount of records written.
+     */
+    ss::future<int32_t> write_records(ffi::array<uint8_t>);
+
     // End ABI exports
 
 private:
@@ -17,11 +17,12 @@
 #include "model/timestamp.h"
 #include "model/transform.h"
 #include "prometheus/prometheus_sanitize.h"
-#include "storage/parser_utils.h"
+#include "storage/decompression_cache.h"
 #include "utils/human.h"
 #include "utils/type_traits.h"
 #include "wasm/allocator.h"
 #include "wasm/api.h"
+#include "wasm/compilation_cache.h"
 #include "wasm/engine_probe.h"
 #include "wasm/errc.h"
 #include "wasm/ffi.h"
@@ -85,6 +86,10 @@ constexpr size_t max_host_function_stack_usage = vm_stack_size
 // infinite loop workload on x86_64.
 constexpr uint64_t millisecond_fuel_amount = 2'000'000;
 
+// Part of the key of compiled modules in the compilation cache, keep in sync
+// with the version of wasmtime we build against.
+constexpr std::string_view engine_version = "wasmtime-16.0.0";
+
 // The reserved memory for an instance of a WebAssembly VM.
 //
 // The wasmtime memory APIs don't allow us to pass information into an
@@ -128,8 +133,19 @@ public:
     size_t per_invocation_fuel_amount() const;
 
 private:
+    using module_handle = handle<wasmtime_module_t, wasmtime_module_delete>;
+
     void register_metrics();
 
+    // Load and store compiled modules in the compilation cache, these must be
+    // called on the alien thread.
+    module_handle
+    load_cached_module(const model::transform_metadata&, std::string_view key);
+    void store_cached_module(
+      const model::transform_metadata&,
+      std::string_view key,
+      wasmtime_module_t*);
+
     static wasmtime_error_t* allocate_stack_memory(
       void* env, size_t size, wasmtime_stack_memory_t* memory_ret);
 
@@ -160,6 +176,7 @@ private:
     metrics::public_metric_groups _public_metrics;
     ss::sharded<wasm::engine_probe_cache> _engine_probe_cache;
     size_t _per_invocation_fuel_amount = 0;
+    std::optional<compilation_cache> _compilation_cache;
 };
 
 void check_error(const wasmtime_error_t* error) {
@@ -489,8 +506,8 @@ public:
             co_return;
         }
         if (batch.compressed()) {
-            batch = co_await storage::internal::decompress_batch(
-              std::move(batch));
+            batch = co_await storage::decompressed_batches().decompress(
+              batch);
         }
         ss::future<> fut = co_await ss::coroutine::as_future(
           invoke_transform(std::move(batch), probe, std::move(cb)));
@@ -751,9 +768,11 @@ private:
               , _cb(std::move(cb))
               , _probe(p) {}
 
-            void pre_record() final {
+            void pre_record() final { pre_records(1); }
+
+            void pre_records(size_t count) final {
                 handle<wasmtime_error_t, wasmtime_error_delete> error(
-                  wasmtime_context_set_fuel(_context, _fuel_amt));
+                  wasmtime_context_set_fuel(_context, _fuel_amt * count));
                 check_error(error.get());
                 _measurement = _probe->latency_measurement();
             }
@@ -1218,10 +1237,13 @@ void register_transform_module(
     host_function<&transform_module::name>::reg(linker, #name, ssc)
     REG_HOST_FN(check_abi_version_1);
     REG_HOST_FN(check_abi_version_2);
+    REG_HOST_FN(check_abi_version_3);
     REG_HOST_FN(read_batch_header);
     REG_HOST_FN(read_next_record);
     REG_HOST_FN(write_record);
     REG_HOST_FN(write_record_with_options);
+    REG_HOST_FN(read_records);
+    REG_HOST_FN(write_records);
 #undef REG_HOST_FN
 }
 
@@ -1327,6 +1349,9 @@ wasmtime_runtime::wasmtime_runtime(std::unique_ptr<schema_registry> sr)
 ss::future<> wasmtime_runtime::start(runtime::config c) {
     _per_invocation_fuel_amount = (c.cpu.per_invocation_timeout / 1ms)
                                   * millisecond_fuel_amount;
+    if (c.compilation_cache_directory) {
+        _compilation_cache.emplace(*c.compilation_cache_directory);
+    }
 
     size_t page_size = ::getpagesize();
     size_t aligned_pool_size = ss::align_down(
@@ -1347,6 +1372,12 @@ ss::future<> wasmtime_runtime::start(runtime::config c) {
           page_size,
           c.heap_memory.per_engine_memory_limit));
     }
+    if (c.heap_memory.huge_pages) {
+        // Heaps are made of whole huge pages, round up so that the pool fits
+        // the heaps it is split into.
+        aligned_instance_limit = ss::align_up(
+          aligned_instance_limit, heap_allocator::huge_page_size);
+    }
     size_t num_heaps = aligned_pool_size / aligned_instance_limit;
     if (num_heaps == 0) {
         throw std::runtime_error("must allow at least one wasm heap");
@@ -1362,7 +1393,9 @@ ss::future<> wasmtime_runtime::start(runtime::config c) {
       .heap_memory_size = aligned_instance_limit,
       .num_heaps = num_heaps,
       .memset_chunk_size = memset_chunk_size,
+      .huge_pages = c.heap_memory.huge_pages,
     });
+    co_await _heap_allocator.invoke_on_all(&heap_allocator::setup_metrics);
     co_await _stack_allocator.start(stack_allocator::config{
       .tracking_enabled = c.stack_memory.debug_host_stack_usage,
     });
@@ -1415,20 +1448,32 @@ wasmtime_runtime::make_factory(model::transform_metadata meta, iobuf buf) {
                      ? &_stack_allocator
                      : nullptr,
     };
+    std::optional<ss::sstring> cache_key;
+    if (_compilation_cache) {
+        cache_key = co_await compilation_cache::make_key(buf, engine_version);
+    }
     size_t memory_usage_size = co_await _alien_thread.submit(
-      [this, &meta, &buf, &preinitialized, &ssc] {
-          vlog(wasm_log.debug, "compiling wasm module {}", meta.name);
-          // This can be a large contiguous allocation, however it happens
-          // on an alien thread so it bypasses the seastar allocator.
-          bytes b = iobuf_to_bytes(buf);
-          wasmtime_module_t* user_module_ptr = nullptr;
-          handle<wasmtime_error_t, wasmtime_error_delete> error{
-            wasmtime_module_new(
-              _engine.get(), b.data(), b.size(), &user_module_ptr)};
-          check_error(error.get());
-          handle<wasmtime_module_t, wasmtime_module_delete> user_module{
-            user_module_ptr};
-          wasm_log.info("Finished compiling wasm module {}", meta.name);
+      [this, &meta, &buf, &preinitialized, &ssc, &cache_key] {
+          module_handle user_module;
+          if (cache_key) {
+              user_module = load_cached_module(meta, *cache_key);
+          }
+          if (!user_module) {
+              vlog(wasm_log.debug, "compiling wasm module {}", meta.name);
+              // This can be a large contiguous allocation, however it happens
+              // on an alien thread so it bypasses the seastar allocator.
+              bytes b = iobuf_to_bytes(buf);
+              wasmtime_module_t* user_module_ptr = nullptr;
+              handle<wasmtime_error_t, wasmtime_error_delete> error{
+                wasmtime_module_new(
+                  _engine.get(), b.data(), b.size(), &user_module_ptr)};
+              check_error(error.get());
+              user_module.reset(user_module_ptr);
+              wasm_log.info("Finished compiling wasm module {}", meta.name);
+              if (cache_key) {
+                  store_cached_module(meta, *cache_key, user_module.get());
+              }
+          }
 
           handle<wasmtime_linker_t, wasmtime_linker_delete> linker{
             wasmtime_linker_new(_engine.get())};
@@ -1438,8 +1483,9 @@ wasmtime_runtime::make_factory(model::transform_metadata meta, iobuf buf) {
           register_wasi_module(linker.get(), ssc);
 
           wasmtime_instance_pre_t* preinitialized_ptr = nullptr;
-          error.reset(wasmtime_linker_instantiate_pre(
-            linker.get(), user_module.get(), &preinitialized_ptr));
+          handle<wasmtime_error_t, wasmtime_error_delete> error{
+            wasmtime_linker_instantiate_pre(
+              linker.get(), user_module.get(), &preinitialized_ptr)};
           preinitialized->_underlying.reset(preinitialized_ptr);
           preinitialized->_memory_limits = lookup_memory_limits(
             user_module.get());
@@ -1460,6 +1506,58 @@ wasmtime_runtime::make_factory(model::transform_metadata meta, iobuf buf) {
       _sr.get());
 }
 
+wasmtime_runtime::module_handle wasmtime_runtime::load_cached_module(
+  const model::transform_metadata& meta, std::string_view key) {
+    try {
+        auto artifact = _compilation_cache->load(key);
+        if (!artifact) {
+            return nullptr;
+        }
+        // Only artifacts that we've compiled and stored ourselves are
+        // deserialized, wasmtime trusts that they are valid native code.
+        wasmtime_module_t* user_module_ptr = nullptr;
+        handle<wasmtime_error_t, wasmtime_error_delete> error{
+          wasmtime_module_deserialize(
+            _engine.get(),
+            artifact->data(),
+            artifact->size(),
+            &user_module_ptr)};
+        check_error(error.get());
+        wasm_log.info("Loaded compiled wasm module {} from cache", meta.name);
+        return module_handle{user_module_ptr};
+    } catch (const std::exception& ex) {
+        // For example the module was compiled for other CPU features.
+        wasm_log.info(
+          "Unable to load compiled wasm module {} from cache, compiling it: "
+          "{}",
+          meta.name,
+          ex.what());
+        return nullptr;
+    }
+}
+
+void wasmtime_runtime::store_cached_module(
+  const model::transform_metadata& meta,
+  std::string_view key,
+  wasmtime_module_t* user_module) {
+    wasm_byte_vec_t artifact{.size = 0, .data = nullptr};
+    auto cleanup = ss::defer([&artifact] { wasm_byte_vec_delete(&artifact); });
+    try {
+        handle<wasmtime_error_t, wasmtime_error_delete> error{
+          wasmtime_module_serialize(user_module, &artifact)};
+        check_error(error.get());
+        _compilation_cache->store(
+          key,
+          // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+          {reinterpret_cast<const uint8_t*>(artifact.data), artifact.size});
+    } catch (const std::exception& ex) {
+        wasm_log.warn(
+          "Unable to store compiled wasm module {} in cache: {}",
+          meta.name,
+          ex.what());
+    }
+}
+
 wasm_engine_t* wasmtime_runtime::engine() const { return _engine.get(); }
 heap_allocator* wasmtime_runtime::heap_allocator() {
     return &_heap_allocator.local();
@@ -1575,9 +1673,13 @@ wasmtime_error_t* wasmtime_runtime::allocate_heap_memory(
       [](void* env, size_t new_size) -> wasmtime_error_t* {
         auto* mem = static_cast<linear_memory*>(env);
         if (new_size <= mem->underlying.size) {
-            mem->used_memory = std::max(new_size, mem->used_memory);
+            if (new_size > mem->used_memory) {
+                mem->allocator->record_growth(mem->used_memory, new_size);
+                mem->used_memory = new_size;
+            }
             return nullptr;
         }
+        mem->allocator->record_failed_growth();
         auto msg = ss::format(
           "unable to grow memory past {} to {}",
           human::bytes(double(mem->underlying.size)),
@@ -1602,7 +1704,7 @@ bool is_exported_memory(const parser::module_export& mod_export) {
 }
 
 bool is_transform_abi_check_fn(const parser::module_import& mod_import) {
-    constexpr std::array version = {1, 2};
+    constexpr std::array version = {1, 2, 3};
     return absl::c_any_of(version, [&mod_import](int version) {
         return mod_import
                == parser::module_import{
@@ -0,0 +1,169 @@
+#!/usr/bin/env python3
+#
+# Copyright 2024 Redpanda Data, Inc.
+#
+# Use of this software is governed by the Business Source License
+# included in the file licenses/BSL.md
+#
+# As of the Change Date specified in that file, in accordance with
+# the Business Source License, use of this software will be governed
+# by the Apache License, Version 2.0
+"""
+Correlates the reactor stall reports of redpanda logs with their call sites.
+
+Every report, e.g.
+
+    Reactor stalled for 32 ms on shard 3. Backtrace: 0x5a6ba9e 0x5a1f7e4 ...
+
+is grouped with the reports of the same backtrace. The backtraces are
+symbolized with addr2line against the redpanda binary they came from, and
+every group is attributed to its call site: the innermost frame that is not
+in seastar, the standard library or the async helpers of ssx. The groups are
+printed by total stalled time, so the loops most worth yielding in come
+first.
+"""
+
+import argparse
+import collections
+import re
+import subprocess
+import sys
+
+# redpanda adds the scheduling group when it attributes the stalls
+STALL_RE = re.compile(r'Reactor stalled for (\d+) ms on shard (\d+)'
+                      r'(?: in scheduling group \S+)?\.'
+                      r'\s*Backtrace:\s*(.*)$')
+# frames are either absolute addresses in the binary, or offsets in a
+# shared object
+FRAME_RE = re.compile(r'^(?:(\S+)\+)?(0x[0-9a-fA-F]+)$')
+
+# frames of these namespaces or files are never the call site
+NOT_CALL_SITES = (
+    'seastar::',
+    'std::',
+    'ssx::async_',
+    'ssx::detail::',
+    '__libc',
+    '__restore_rt',
+    '/seastar/',
+    '/libstdc++',
+    '/libc++',
+)
+
+
+class Symbolizer:
+    def __init__(self, binary):
+        self._binary = binary
+        self._cache = {}
+
+    def symbolize(self, addresses):
+        """Returns the (function, location) frames of the addresses, with
+        the frames inlined at an address innermost first."""
+        missing = [a for a in addresses if a not in self._cache]
+        if missing and self._binary:
+            # -a prints every address before its frames, -i expands the
+            # frames inlined at it, which are often where the loop is
+            out = subprocess.run(
+                ['addr2line', '-Cfiae', self._binary] + missing,
+                check=True,
+                capture_output=True,
+                text=True).stdout.splitlines()
+            symbolized = []
+            for line in out:
+                if line.startswith('0x'):
+                    symbolized.append([])
+                elif symbolized:
+                    symbolized[-1].append(line)
+            for address, lines in zip(missing, symbolized):
+                self._cache[address] = list(zip(lines[0::2], lines[1::2]))
+        return [f for a in addresses for f in self._cache.get(a, [(a, '??')])]
+
+
+def parse_backtrace(text):
+    """Returns the frames of the binary and the raw frames of a backtrace."""
+    addresses = []
+    frames = []
+    for token in text.split():
+        m = FRAME_RE.match(token)
+        if not m:
+            continue
+        frames.append(token)
+        if m.group(1) is None:
+            addresses.append(m.group(2))
+    return addresses, tuple(frames)
+
+
+def call_site(symbols):
+    for function, location in symbols:
+        if function == '??':
+            continue
+        text = f'{function} {location}'
+        if not any(skip in text for skip in NOT_CALL_SITES):
+            return function, location
+    return symbols[0] if symbols else ('??', '??')
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Correlate reactor stall reports with their call sites')
+    parser.add_argument('logs',
+                        nargs='*',
+                        type=argparse.FileType('r'),
+                        default=[sys.stdin],
+                        help='redpanda log files, stdin by default')
+    parser.add_argument('--binary',
+                        help='the redpanda binary the logs come from, '
+                        'addresses are not symbolized without it')
+    parser.add_argument('--top',
+                        type=int,
+                        default=20,
+                        help='number of call sites to print')
+    parser.add_argument('--stacks',
+                        action='store_true',
+                        help='print the symbolized stack of every call site')
+    options = parser.parse_args()
+
+    stalls = collections.defaultdict(list)
+    addresses_of = {}
+    for log in options.logs:
+        for line in log:
+            m = STALL_RE.search(line)
+            if not m:
+                continue
+            addresses, frames = parse_backtrace(m.group(3))
+            stalls[frames].append((int(m.group(1)), int(m.group(2))))
+            addresses_of[frames] = addresses
+
+    symbolizer = Symbolizer(options.binary)
+    by_site = collections.defaultdict(lambda: {
+        'count': 0,
+        'total_ms': 0,
+        'max_ms': 0,
+        'shards': set(),
+        'stack': None
+    })
+    for frames, reports in stalls.items():
+        symbols = symbolizer.symbolize(addresses_of[frames])
+        site = call_site(symbols) if symbols else (frames[0], '??')
+        entry = by_site[site]
+        entry['count'] += len(reports)
+        entry['total_ms'] += sum(ms for ms, _ in reports)
+        entry['max_ms'] = max([entry['max_ms']] + [ms for ms, _ in reports])
+        entry['shards'].update(shard for _, shard in reports)
+        if entry['stack'] is None:
+            entry['stack'] = symbols
+
+    sites = sorted(by_site.items(), key=lambda kv: -kv[1]['total_ms'])
+    print(f'{"count":>7} {"total_ms":>9} {"max_ms":>7} {"shards":>6}  '
+          'call site')
+    for (function, location), entry in sites[:options.top]:
+        print(f'{entry["count"]:>7} {entry["total_ms"]:>9} '
+              f'{entry["max_ms"]:>7} {len(entry["shards"]):>6}  '
+              f'{function} at {location}')
+        if options.stacks and entry['stack']:
+            for frame_function, frame_location in entry['stack']:
+                print(f'{"":>34}{frame_function} at {frame_location}')
+
+
+if __name__ == '__main__':
+    main()